@@ -0,0 +1,104 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+// Libraries
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class Benchmark
+/**
+ * This abstract class represents a benchmark. A benchmark measures the
+ * time spent in some parts of the library and writes it into an output stream.
+ */
+class Benchmark {
+
+    private :
+
+        // ---------- Attributes ---------- //
+
+        /// Name of the benchmark
+        std::string mName;
+
+        /// Output stream
+        std::ostream* mOutputStream;
+
+        // ---------- Methods ---------- //
+
+        /// Copy constructor is private
+        Benchmark(const Benchmark&);
+
+        /// Assignment operator is private
+        Benchmark& operator=(const Benchmark& benchmark);
+
+    protected :
+
+        // ---------- Methods ---------- //
+
+        /// Return the current time in milliseconds
+        static double getCurrentTimeMs() {
+            const auto now = std::chrono::steady_clock::now().time_since_epoch();
+            return std::chrono::duration<double, std::milli>(now).count();
+        }
+
+        /// Write the result of a measurement into the output stream
+        void report(const std::string& label, double totalTimeMs, long nbIterations, const std::string& unit) {
+            *mOutputStream << "    " << std::left << std::setw(50) << label << " : " << std::right
+                           << std::fixed << std::setprecision(4) << std::setw(12) << (totalTimeMs / nbIterations)
+                           << " ms/" << unit << std::endl;
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        Benchmark(const std::string& name, std::ostream* stream = &std::cout)
+            : mName(name), mOutputStream(stream) {
+
+        }
+
+        /// Destructor
+        virtual ~Benchmark() = default;
+
+        /// Return the name of the benchmark
+        const std::string& getName() const {
+            return mName;
+        }
+
+        /// Run the benchmark
+        virtual void run()=0;
+};
+
+}
+
+#endif
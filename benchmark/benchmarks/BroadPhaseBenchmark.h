@@ -0,0 +1,237 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef BROAD_PHASE_BENCHMARK_H
+#define BROAD_PHASE_BENCHMARK_H
+
+// Libraries
+#include "Benchmark.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <cmath>
+#include <sstream>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class BroadPhaseBenchmark
+/**
+ * This benchmark compares the broad-phase algorithms on headless versions of the
+ * "Cubes" and "Pile" scenes of the testbed application and on a scene with a large
+ * static level (many static colliders) and falling bodies. Each scene can be duplicated
+ * on a grid to increase the number of bodies. The time of a full simulation step and
+ * of a world raycast is reported for each broad-phase.
+ */
+class BroadPhaseBenchmark : public Benchmark {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Number of simulation steps before the measures
+        static const int NB_WARMUP_STEPS = 60;
+
+        /// Number of measured simulation steps
+        static const int NB_MEASURED_STEPS = 300;
+
+        /// Number of measured raycasts
+        static const int NB_RAYCASTS = 2000;
+
+        /// Distance between two copies of a scene
+        static constexpr decimal SCENE_SPACING = decimal(60.0);
+
+        // ---------- Methods ---------- //
+
+        /// Create the "Cubes" scene of the testbed at a given offset
+        static void createCubesScene(PhysicsCommon& physicsCommon, PhysicsWorld* world, const Vector3& offset) {
+
+            BoxShape* boxShape = physicsCommon.createBoxShape(Vector3(1, 1, 1));
+            const decimal radius = decimal(2.0);
+            for (int i=0; i < 40; i++) {
+                const decimal angle = decimal(i) * decimal(30.0);
+                const Vector3 position(radius * std::cos(angle), 10 + i * decimal(2.3), 0);
+                RigidBody* body = world->createRigidBody(Transform(offset + position, Quaternion::identity()));
+                body->addCollider(boxShape, Transform::identity());
+            }
+
+            createFloor(physicsCommon, world, offset, Vector3(25, decimal(0.5), 25));
+        }
+
+        /// Create the "Pile" scene of the testbed at a given offset (with a box floor instead of a concave mesh)
+        static void createPileScene(PhysicsCommon& physicsCommon, PhysicsWorld* world, const Vector3& offset) {
+
+            BoxShape* boxShape = physicsCommon.createBoxShape(Vector3(1, 1, 1));
+            SphereShape* sphereShape = physicsCommon.createSphereShape(decimal(1.5));
+            CapsuleShape* capsuleShape = physicsCommon.createCapsuleShape(decimal(1.0), decimal(1.0));
+            const decimal radius = decimal(3.0);
+
+            for (int i=0; i < 150; i++) {
+                const decimal angle = decimal(i) * decimal(30.0);
+                const Vector3 position(radius * std::cos(angle), 85 + i * decimal(2.8), radius * std::sin(angle));
+                RigidBody* body = world->createRigidBody(Transform(offset + position, Quaternion::identity()));
+                body->addCollider(boxShape, Transform::identity());
+            }
+            for (int i=0; i < 80; i++) {
+                const decimal angle = decimal(i) * decimal(35.0);
+                const Vector3 position(radius * std::cos(angle), 75 + i * decimal(2.3), radius * std::sin(angle));
+                RigidBody* body = world->createRigidBody(Transform(offset + position, Quaternion::identity()));
+                body->addCollider(sphereShape, Transform::identity());
+            }
+            for (int i=0; i < 5; i++) {
+                const decimal angle = decimal(i) * decimal(45.0);
+                const Vector3 position(radius * std::cos(angle), 40 + i * decimal(1.3), radius * std::sin(angle));
+                RigidBody* body = world->createRigidBody(Transform(offset + position, Quaternion::identity()));
+                body->addCollider(capsuleShape, Transform::identity());
+            }
+
+            createFloor(physicsCommon, world, offset, Vector3(25, decimal(0.25), 25));
+        }
+
+        /// Create a scene with a static level made of many blocks and some bodies falling between them
+        static void createLevelScene(PhysicsCommon& physicsCommon, PhysicsWorld* world, const Vector3& offset) {
+
+            BoxShape* blockShape = physicsCommon.createBoxShape(Vector3(decimal(0.5), 2, decimal(0.5)));
+            SphereShape* sphereShape = physicsCommon.createSphereShape(decimal(0.4));
+
+            RigidBody* level = world->createRigidBody(Transform(offset, Quaternion::identity()));
+            level->setType(BodyType::STATIC);
+            for (int i=0; i < 24; i++) {
+                for (int j=0; j < 24; j++) {
+                    const Vector3 position(-23 + i * 2, decimal(2.0) - (i + j) % 3, -23 + j * 2);
+                    level->addCollider(blockShape, Transform(position, Quaternion::identity()));
+                }
+            }
+
+            for (int i=0; i < 100; i++) {
+                const Vector3 position(-22 + (i % 10) * decimal(4.5), 8 + (i / 10) * decimal(1.5), -22 + (i / 10) * decimal(4.7));
+                RigidBody* body = world->createRigidBody(Transform(offset + position, Quaternion::identity()));
+                body->addCollider(sphereShape, Transform::identity());
+            }
+
+            createFloor(physicsCommon, world, offset, Vector3(25, decimal(0.25), 25));
+        }
+
+        /// Create a static box floor
+        static void createFloor(PhysicsCommon& physicsCommon, PhysicsWorld* world, const Vector3& offset,
+                                const Vector3& halfExtents) {
+            RigidBody* floor = world->createRigidBody(Transform(offset, Quaternion::identity()));
+            floor->setType(BodyType::STATIC);
+            floor->addCollider(physicsCommon.createBoxShape(halfExtents), Transform::identity());
+        }
+
+        /// Run a scene duplicated on a grid with a given broad-phase
+        template<typename CreateSceneFunction>
+        void runScene(const std::string& sceneName, CreateSceneFunction createScene, int gridSize, BroadPhaseType broadPhaseType) {
+
+            PhysicsCommon physicsCommon;
+            PhysicsWorld::WorldSettings settings;
+            settings.broadPhaseType = broadPhaseType;
+            PhysicsWorld* world = physicsCommon.createPhysicsWorld(settings);
+
+            for (int x=0; x < gridSize; x++) {
+                for (int z=0; z < gridSize; z++) {
+                    createScene(physicsCommon, world, Vector3(x * SCENE_SPACING, 0, z * SCENE_SPACING));
+                }
+            }
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+            for (int i=0; i < NB_WARMUP_STEPS; i++) {
+                world->update(timeStep);
+            }
+
+            std::ostringstream label;
+            label << sceneName << " x" << (gridSize * gridSize) << " ("
+                  << world->getNbRigidBodies() << " bodies) "
+                  << (broadPhaseType == BroadPhaseType::SWEEP_AND_PRUNE ? "SweepAndPrune" : "DynamicAABBTree");
+
+            double startTime = getCurrentTimeMs();
+            for (int i=0; i < NB_MEASURED_STEPS; i++) {
+                world->update(timeStep);
+            }
+            report(label.str() + " step", getCurrentTimeMs() - startTime, NB_MEASURED_STEPS, "step");
+
+            // Vertical rays spread over the scenes
+            RaycastCounter raycastCounter;
+            const decimal extent = gridSize * SCENE_SPACING;
+            startTime = getCurrentTimeMs();
+            for (int i=0; i < NB_RAYCASTS; i++) {
+                const decimal x = std::fmod(decimal(i) * decimal(7.31), extent) - decimal(25.0);
+                const decimal z = std::fmod(decimal(i) * decimal(3.17), extent) - decimal(25.0);
+                world->raycast(Ray(Vector3(x, 500, z), Vector3(x, -10, z)), &raycastCounter);
+            }
+            report(label.str() + " raycast", getCurrentTimeMs() - startTime, NB_RAYCASTS, "raycast");
+
+            physicsCommon.destroyPhysicsWorld(world);
+        }
+
+        /// Callback that counts the raycast hits
+        class RaycastCounter : public RaycastCallback {
+
+            public:
+
+                long nbHits = 0;
+
+                virtual decimal notifyRaycastHit(const RaycastInfo& /*raycastInfo*/) override {
+                    nbHits++;
+                    return decimal(1.0);
+                }
+        };
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        BroadPhaseBenchmark(const std::string& name) : Benchmark(name) {
+
+        }
+
+        /// Run the benchmark
+        virtual void run() override {
+
+            const BroadPhaseType broadPhaseTypes[] = {BroadPhaseType::DYNAMIC_AABB_TREE, BroadPhaseType::SWEEP_AND_PRUNE};
+
+            for (int gridSize : {1, 3, 6}) {
+                for (BroadPhaseType broadPhaseType : broadPhaseTypes) {
+                    runScene("Cubes", createCubesScene, gridSize, broadPhaseType);
+                }
+            }
+
+            for (int gridSize : {1, 2, 4}) {
+                for (BroadPhaseType broadPhaseType : broadPhaseTypes) {
+                    runScene("Pile", createPileScene, gridSize, broadPhaseType);
+                }
+            }
+
+            for (int gridSize : {1, 3}) {
+                for (BroadPhaseType broadPhaseType : broadPhaseTypes) {
+                    runScene("Level", createLevelScene, gridSize, broadPhaseType);
+                }
+            }
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,215 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef CONCAVE_MESH_BENCHMARK_H
+#define CONCAVE_MESH_BENCHMARK_H
+
+// Libraries
+#include "Benchmark.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/collision/broadphase/StaticAABBTree.h>
+#include <cmath>
+#include <sstream>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class ConcaveMeshBenchmark
+/**
+ * This benchmark compares the static AABB tree used by the concave mesh shape with a dynamic
+ * AABB tree built by inserting the triangles one by one (as the concave mesh did before). The
+ * triangles are the ones of a large grid terrain. The build time, the time of AABB overlap
+ * queries and the time of raycasts (clipped at the first hit) are reported for both trees.
+ */
+class ConcaveMeshBenchmark : public Benchmark {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Number of AABB queries and raycasts
+        static const int NB_QUERIES = 20000;
+
+        // ---------- Attributes ---------- //
+
+        DefaultAllocator mAllocator;
+
+        // ---------- Methods ---------- //
+
+        /// Callback that clips the ray at the entry point of the AABB of each triangle
+        class ClippingRaycastCallback : public DynamicAABBTreeRaycastCallback {
+
+            public:
+
+                const List<AABB>& trianglesAABBs;
+                const DynamicAABBTree* dynamicTree;
+                long nbTestedTriangles = 0;
+
+                ClippingRaycastCallback(const List<AABB>& aabbs, const DynamicAABBTree* tree)
+                    : trianglesAABBs(aabbs), dynamicTree(tree) {
+
+                }
+
+                virtual decimal raycastBroadPhaseShape(int32 id, const Ray& ray) override {
+
+                    nbTestedTriangles++;
+
+                    // The dynamic tree reports node IDs and the static tree reports triangle IDs
+                    const int32 triangleId = dynamicTree != nullptr ? dynamicTree->getNodeDataInt(id)[0] : id;
+                    const AABB& aabb = trianglesAABBs[triangleId];
+
+                    decimal entry = 0, exit = ray.maxFraction;
+                    const Vector3 direction = ray.point2 - ray.point1;
+                    for (int i=0; i < 3; i++) {
+                        if (std::abs(direction[i]) < MACHINE_EPSILON) {
+                            if (ray.point1[i] < aabb.getMin()[i] || ray.point1[i] > aabb.getMax()[i]) return decimal(-1.0);
+                            continue;
+                        }
+                        decimal t1 = (aabb.getMin()[i] - ray.point1[i]) / direction[i];
+                        decimal t2 = (aabb.getMax()[i] - ray.point1[i]) / direction[i];
+                        if (t1 > t2) std::swap(t1, t2);
+                        entry = std::max(entry, t1);
+                        exit = std::min(exit, t2);
+                    }
+
+                    return entry <= exit ? std::max(entry, decimal(0.0001)) : decimal(-1.0);
+                }
+        };
+
+        /// Create the AABBs of the triangles of a grid terrain with nbCells x nbCells cells
+        void createTerrain(int nbCells, List<AABB>& trianglesAABBs) {
+
+            auto height = [](int i, int j) {
+                return decimal(4.0) * std::sin(decimal(i) * decimal(0.05)) * std::cos(decimal(j) * decimal(0.07));
+            };
+
+            for (int i=0; i < nbCells; i++) {
+                for (int j=0; j < nbCells; j++) {
+                    const Vector3 p00(decimal(i), height(i, j), decimal(j));
+                    const Vector3 p10(decimal(i + 1), height(i + 1, j), decimal(j));
+                    const Vector3 p01(decimal(i), height(i, j + 1), decimal(j + 1));
+                    const Vector3 p11(decimal(i + 1), height(i + 1, j + 1), decimal(j + 1));
+                    const Vector3 triangle1[3] = {p00, p10, p11};
+                    const Vector3 triangle2[3] = {p00, p11, p01};
+                    trianglesAABBs.add(AABB::createAABBForTriangle(triangle1));
+                    trianglesAABBs.add(AABB::createAABBForTriangle(triangle2));
+                }
+            }
+        }
+
+        /// Run the benchmark with a terrain of a given size
+        void runTerrain(int nbCells) {
+
+            List<AABB> trianglesAABBs(mAllocator);
+            createTerrain(nbCells, trianglesAABBs);
+
+            std::ostringstream label;
+            label << "Terrain (" << trianglesAABBs.size() << " triangles) ";
+
+            // Build the trees
+            double startTime = getCurrentTimeMs();
+            DynamicAABBTree dynamicTree(mAllocator);
+            for (uint32 i=0; i < trianglesAABBs.size(); i++) {
+                dynamicTree.addObject(trianglesAABBs[i], static_cast<int32>(i), 0);
+            }
+            report(label.str() + "DynamicAABBTree build", getCurrentTimeMs() - startTime, 1, "build");
+
+            startTime = getCurrentTimeMs();
+            StaticAABBTree staticTree(mAllocator);
+            staticTree.build(trianglesAABBs);
+            report(label.str() + "StaticAABBTree build", getCurrentTimeMs() - startTime, 1, "build");
+
+            // AABB queries (the size of a small body)
+            const decimal size = decimal(nbCells);
+            auto queryAABB = [size](int q) {
+                const Vector3 center(std::fmod(decimal(q) * decimal(7.31), size), decimal(0.0), std::fmod(decimal(q) * decimal(3.17), size));
+                return AABB(center - Vector3(1, 5, 1), center + Vector3(1, 5, 1));
+            };
+
+            long nbOverlaps = 0;
+            List<int32> overlappingObjects(mAllocator);
+            startTime = getCurrentTimeMs();
+            for (int q=0; q < NB_QUERIES; q++) {
+                overlappingObjects.clear();
+                dynamicTree.reportAllShapesOverlappingWithAABB(queryAABB(q), overlappingObjects);
+                nbOverlaps += overlappingObjects.size();
+            }
+            report(label.str() + "DynamicAABBTree AABB query", getCurrentTimeMs() - startTime, NB_QUERIES, "query");
+
+            startTime = getCurrentTimeMs();
+            for (int q=0; q < NB_QUERIES; q++) {
+                overlappingObjects.clear();
+                staticTree.reportAllShapesOverlappingWithAABB(queryAABB(q), overlappingObjects);
+                nbOverlaps -= overlappingObjects.size();
+            }
+            report(label.str() + "StaticAABBTree AABB query", getCurrentTimeMs() - startTime, NB_QUERIES, "query");
+
+            // Slanted rays across the terrain
+            auto ray = [size](int q) {
+                const Vector3 point1(std::fmod(decimal(q) * decimal(7.31), size), decimal(30.0), std::fmod(decimal(q) * decimal(3.17), size));
+                return Ray(point1, point1 + Vector3(decimal(40.0), decimal(-60.0), decimal(25.0)));
+            };
+
+            ClippingRaycastCallback dynamicTreeCallback(trianglesAABBs, &dynamicTree);
+            startTime = getCurrentTimeMs();
+            for (int q=0; q < NB_QUERIES; q++) {
+                dynamicTree.raycast(ray(q), dynamicTreeCallback);
+            }
+            report(label.str() + "DynamicAABBTree raycast", getCurrentTimeMs() - startTime, NB_QUERIES, "raycast");
+
+            ClippingRaycastCallback staticTreeCallback(trianglesAABBs, nullptr);
+            startTime = getCurrentTimeMs();
+            for (int q=0; q < NB_QUERIES; q++) {
+                staticTree.raycast(ray(q), staticTreeCallback);
+            }
+            report(label.str() + "StaticAABBTree raycast", getCurrentTimeMs() - startTime, NB_QUERIES, "raycast");
+
+            if (nbOverlaps < 0) {
+                std::cout << "    Warning : the static tree reports more overlapping triangles (quantized AABBs)" << std::endl;
+            }
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        ConcaveMeshBenchmark(const std::string& name) : Benchmark(name) {
+
+        }
+
+        /// Run the benchmark
+        virtual void run() override {
+
+            runTerrain(64);
+            runTerrain(256);
+            runTerrain(724);
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,151 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef CONTAINERS_BENCHMARK_H
+#define CONTAINERS_BENCHMARK_H
+
+// Libraries
+#include "Benchmark.h"
+#include <reactphysics3d/containers/Map.h>
+#include <reactphysics3d/containers/FlatMap.h>
+#include <reactphysics3d/memory/DefaultAllocator.h>
+#include <vector>
+#include <utility>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class ContainersBenchmark
+/**
+ * This benchmark compares the Map and FlatMap containers with the access pattern of
+ * the overlapping pairs of the engine: the keys are pair ids built from two shape ids
+ * and each frame adds some pairs, looks up all of them and removes some of them.
+ */
+class ContainersBenchmark : public Benchmark {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Number of keys in the map
+        static const int NB_KEYS = 100000;
+
+        /// Number of simulated frames
+        static const int NB_FRAMES = 20;
+
+        // ---------- Attributes ---------- //
+
+        /// Memory allocator
+        DefaultAllocator mAllocator;
+
+        // ---------- Methods ---------- //
+
+        /// Run the benchmark for a given map type
+        template<typename MapType>
+        void runMap(const std::string& label, const std::vector<uint64>& keys, const std::vector<uint64>& lookupKeys) {
+
+            MapType map(mAllocator);
+
+            // Insert all the keys
+            double startTime = getCurrentTimeMs();
+            for (size_t i=0; i < keys.size(); i++) {
+                map.add(Pair<uint64, uint64>(keys[i], i));
+            }
+            report(label + " insert", getCurrentTimeMs() - startTime, keys.size() / 1000, "1000 operations");
+
+            // Lookup all the keys in a different order during a few frames
+            uint64 sum = 0;
+            startTime = getCurrentTimeMs();
+            for (int f=0; f < NB_FRAMES; f++) {
+                for (size_t i=0; i < lookupKeys.size(); i++) {
+                    auto it = map.find(lookupKeys[i]);
+                    if (it != map.end()) sum += it->second;
+                }
+            }
+            report(label + " find", getCurrentTimeMs() - startTime, NB_FRAMES * keys.size() / 1000, "1000 operations");
+
+            // Remove a key and insert it again (pairs that stop and start overlapping)
+            startTime = getCurrentTimeMs();
+            for (int f=0; f < NB_FRAMES; f++) {
+                for (size_t i=f; i < keys.size(); i += 10) {
+                    map.remove(keys[i]);
+                    map.add(Pair<uint64, uint64>(keys[i], i));
+                }
+            }
+            report(label + " remove + insert", getCurrentTimeMs() - startTime, NB_FRAMES * (keys.size() / 10) / 1000, "1000 operations");
+
+            if (sum == 0) {
+                std::cout << "    Warning : no key has been found" << std::endl;
+            }
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        ContainersBenchmark(const std::string& name) : Benchmark(name) {
+
+        }
+
+        /// Run the benchmark
+        virtual void run() override {
+
+            // Pair ids of shapes that are close to each other
+            std::vector<uint64> keys;
+            uint32 seed = 12345;
+            for (int i=0; i < NB_KEYS; i++) {
+                seed = seed * 1664525u + 1013904223u;
+                const uint32 shapeId1 = seed % (NB_KEYS / 4);
+                const uint32 shapeId2 = shapeId1 + 1 + (i % 64);
+                const uint64 pairId = (uint64(shapeId1) << 32) | shapeId2;
+                keys.push_back(pairId);
+            }
+
+            // Remove the duplicated pair ids
+            Map<uint64, bool> uniqueKeys(mAllocator);
+            std::vector<uint64> pairIds;
+            for (uint64 key : keys) {
+                if (!uniqueKeys.containsKey(key)) {
+                    uniqueKeys.add(Pair<uint64, bool>(key, true));
+                    pairIds.push_back(key);
+                }
+            }
+
+            // Shuffle the pair ids for the lookups
+            std::vector<uint64> lookupPairIds(pairIds);
+            for (size_t i=lookupPairIds.size() - 1; i > 0; i--) {
+                seed = seed * 1664525u + 1013904223u;
+                std::swap(lookupPairIds[i], lookupPairIds[seed % (i + 1)]);
+            }
+
+            runMap<Map<uint64, uint64>>("Map", pairIds, lookupPairIds);
+            runMap<FlatMap<uint64, uint64>>("FlatMap", pairIds, lookupPairIds);
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,140 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef HEIGHT_FIELD_BENCHMARK_H
+#define HEIGHT_FIELD_BENCHMARK_H
+
+// Libraries
+#include "Benchmark.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class HeightFieldBenchmark
+/**
+ * This benchmark measures the time of raycasts against the collider of a large height
+ * field. The rays are short vertical rays (ground probes), long slanted rays across the
+ * terrain (line of sight) and rays that are above the terrain and do not hit it.
+ */
+class HeightFieldBenchmark : public Benchmark {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Number of raycasts
+        static const int NB_RAYCASTS = 2000;
+
+        // ---------- Methods ---------- //
+
+        /// Run the benchmark with a height field of a given size
+        void runTerrain(int nbCells) {
+
+            const int nbPoints = nbCells + 1;
+            std::vector<float> heights(nbPoints * nbPoints);
+            for (int j=0; j < nbPoints; j++) {
+                for (int i=0; i < nbPoints; i++) {
+                    heights[j * nbPoints + i] = float(4.0 * std::sin(i * 0.05) * std::cos(j * 0.07));
+                }
+            }
+
+            PhysicsCommon physicsCommon;
+            PhysicsWorld* world = physicsCommon.createPhysicsWorld();
+            HeightFieldShape* heightField = physicsCommon.createHeightFieldShape(nbPoints, nbPoints, -4, 4, heights.data(),
+                                                                                 HeightFieldShape::HeightDataType::HEIGHT_FLOAT_TYPE);
+            CollisionBody* body = world->createCollisionBody(Transform::identity());
+            Collider* collider = body->addCollider(heightField, Transform::identity());
+
+            std::ostringstream label;
+            label << "Height field (" << nbCells << "x" << nbCells << " cells) ";
+
+            const decimal halfSize = decimal(nbCells) * decimal(0.5);
+            auto randomPoint = [halfSize](int q) {
+                return Vector3(std::fmod(decimal(q) * decimal(7.31), 2 * halfSize) - halfSize, decimal(0.0),
+                               std::fmod(decimal(q) * decimal(3.17), 2 * halfSize) - halfSize);
+            };
+
+            // Short vertical rays
+            int nbHits = 0;
+            double startTime = getCurrentTimeMs();
+            for (int q=0; q < NB_RAYCASTS; q++) {
+                const Vector3 point = randomPoint(q);
+                RaycastInfo raycastInfo;
+                nbHits += collider->raycast(Ray(point + Vector3(0, 10, 0), point - Vector3(0, 10, 0)), raycastInfo);
+            }
+            report(label.str() + "short raycast", getCurrentTimeMs() - startTime, NB_RAYCASTS, "raycast");
+
+            // Long slanted rays across the terrain
+            startTime = getCurrentTimeMs();
+            for (int q=0; q < NB_RAYCASTS; q++) {
+                const Vector3 point = randomPoint(q);
+                RaycastInfo raycastInfo;
+                nbHits += collider->raycast(Ray(Vector3(-halfSize, 6, point.z), Vector3(halfSize, -2, -point.z)), raycastInfo);
+            }
+            report(label.str() + "long raycast", getCurrentTimeMs() - startTime, NB_RAYCASTS, "raycast");
+
+            // Long rays above the terrain
+            startTime = getCurrentTimeMs();
+            for (int q=0; q < NB_RAYCASTS; q++) {
+                const Vector3 point = randomPoint(q);
+                RaycastInfo raycastInfo;
+                nbHits += collider->raycast(Ray(Vector3(-halfSize, decimal(3.9), point.z), Vector3(halfSize, decimal(3.9), -point.z)), raycastInfo);
+            }
+            report(label.str() + "long raycast (miss)", getCurrentTimeMs() - startTime, NB_RAYCASTS, "raycast");
+
+            if (nbHits == 0) {
+                std::cout << "    Warning : no ray has hit the height field" << std::endl;
+            }
+
+            body->removeCollider(collider);
+            physicsCommon.destroyHeightFieldShape(heightField);
+            physicsCommon.destroyPhysicsWorld(world);
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        HeightFieldBenchmark(const std::string& name) : Benchmark(name) {
+
+        }
+
+        /// Run the benchmark
+        virtual void run() override {
+
+            runTerrain(64);
+            runTerrain(256);
+            runTerrain(1024);
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,166 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef SLEEPING_BODIES_BENCHMARK_H
+#define SLEEPING_BODIES_BENCHMARK_H
+
+// Libraries
+#include "Benchmark.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <cmath>
+#include <sstream>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class SleepingBodiesBenchmark
+/**
+ * This benchmark measures the time of a physics world update with a fixed number of
+ * awake bodies and a growing number of sleeping bodies. The sleeping bodies are boxes
+ * (without gravity) lying on a large static ground and the awake bodies are spheres (that
+ * are not allowed to sleep) falling on another part of the same ground. The ground is made
+ * of tiles so that each of its colliders only overlaps a small number of boxes. The time
+ * of an update should grow as little as possible with the number of sleeping bodies.
+ */
+class SleepingBodiesBenchmark : public Benchmark {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Number of awake bodies
+        static const int NB_AWAKE_BODIES = 256;
+
+        /// Number of sleeping boxes along each side of a tile of the ground
+        static const int GROUND_TILE_SIZE = 16;
+
+        /// Number of updates before the measurement
+        static const int NB_WARMUP_UPDATES = 10;
+
+        /// Number of measured updates
+        static const int NB_UPDATES = 60;
+
+        // ---------- Methods ---------- //
+
+        /// Run the benchmark with a given number of sleeping bodies
+        void runScene(int nbSleepingBodies) {
+
+            const decimal timeStep = decimal(1.0 / 60.0);
+            const int gridSize = int(std::ceil(std::sqrt(double(nbSleepingBodies))));
+            const decimal spacing = decimal(2.0);
+            const decimal gridOrigin = -decimal(gridSize) * spacing * decimal(0.5);
+
+            PhysicsCommon physicsCommon;
+            PhysicsWorld* world = physicsCommon.createPhysicsWorld();
+
+            // Static ground made of tiles (each tile is under GROUND_TILE_SIZE x GROUND_TILE_SIZE boxes)
+            const decimal tileHalfSize = GROUND_TILE_SIZE * spacing * decimal(0.5);
+            const int nbTiles = (gridSize + GROUND_TILE_SIZE - 1) / GROUND_TILE_SIZE;
+            BoxShape* groundShape = physicsCommon.createBoxShape(Vector3(tileHalfSize, 1, tileHalfSize));
+            RigidBody* ground = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            ground->setType(BodyType::STATIC);
+            for (int i=0; i < nbTiles; i++) {
+                for (int j=0; j < nbTiles; j++) {
+                    const Vector3 tileCenter(gridOrigin + (2 * i + 1) * tileHalfSize - spacing * decimal(0.5), 0,
+                                             gridOrigin + (2 * j + 1) * tileHalfSize - spacing * decimal(0.5));
+                    ground->addCollider(groundShape, Transform(tileCenter, Quaternion::identity()));
+                }
+            }
+
+            // Sleeping boxes lying on the ground
+            BoxShape* boxShape = physicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            for (int i=0; i < nbSleepingBodies; i++) {
+                const Vector3 position(gridOrigin + (i % gridSize) * spacing, decimal(0.5), gridOrigin + (i / gridSize) * spacing);
+                RigidBody* body = world->createRigidBody(Transform(position, Quaternion::identity()));
+                body->addCollider(boxShape, Transform::identity());
+                body->enableGravity(false);
+            }
+
+            // Awake spheres falling on another tile of the ground, far enough from the grid of sleeping
+            // boxes so that they cannot wake them up
+            const decimal awakeOrigin = gridOrigin - decimal(120.0);
+            BoxShape* awakeGroundShape = physicsCommon.createBoxShape(Vector3(40, 1, 40));
+            ground->addCollider(awakeGroundShape, Transform(Vector3(awakeOrigin + 11, 0, 0), Quaternion::identity()));
+            SphereShape* sphereShape = physicsCommon.createSphereShape(decimal(0.5));
+            for (int i=0; i < NB_AWAKE_BODIES; i++) {
+                const Vector3 position(awakeOrigin + (i % 16) * decimal(1.5), decimal(1.0) + (i / 16) * decimal(1.2), (i % 7) * decimal(0.2));
+                RigidBody* body = world->createRigidBody(Transform(position, Quaternion::identity()));
+                body->addCollider(sphereShape, Transform::identity());
+                body->setIsAllowedToSleep(false);
+            }
+
+            // The first updates create the overlapping pairs of all the bodies. The boxes do not
+            // move and fall asleep after the first update.
+            world->setTimeBeforeSleep(timeStep * decimal(0.5));
+            for (int i=0; i < NB_WARMUP_UPDATES; i++) {
+                world->update(timeStep);
+            }
+
+            int nbBodiesSleeping = 0;
+            for (uint32 i=0; i < world->getNbRigidBodies(); i++) {
+                nbBodiesSleeping += world->getRigidBody(i)->isSleeping();
+            }
+            if (nbBodiesSleeping != nbSleepingBodies) {
+                std::cout << "    Warning : " << nbBodiesSleeping << " bodies are sleeping instead of " << nbSleepingBodies << std::endl;
+            }
+
+            std::ostringstream label;
+            label << "Update (" << NB_AWAKE_BODIES << " awake, " << nbSleepingBodies << " sleeping bodies)";
+
+            const double startTime = getCurrentTimeMs();
+            for (int i=0; i < NB_UPDATES; i++) {
+                world->update(timeStep);
+            }
+            report(label.str(), getCurrentTimeMs() - startTime, NB_UPDATES, "update");
+
+            physicsCommon.destroyPhysicsWorld(world);
+            physicsCommon.destroyBoxShape(groundShape);
+            physicsCommon.destroyBoxShape(awakeGroundShape);
+            physicsCommon.destroyBoxShape(boxShape);
+            physicsCommon.destroySphereShape(sphereShape);
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        SleepingBodiesBenchmark(const std::string& name) : Benchmark(name) {
+
+        }
+
+        /// Run the benchmark
+        virtual void run() override {
+
+            runScene(1000);
+            runScene(10000);
+            runScene(100000);
+            runScene(1000000);
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,71 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include "benchmarks/BroadPhaseBenchmark.h"
+#include "benchmarks/ContainersBenchmark.h"
+#include "benchmarks/ConcaveMeshBenchmark.h"
+#include "benchmarks/HeightFieldBenchmark.h"
+#include "benchmarks/SleepingBodiesBenchmark.h"
+#include <vector>
+
+using namespace reactphysics3d;
+
+// Run the benchmarks whose name contains one of the strings given as arguments (all of them if there is no argument)
+int main(int argc, char** argv) {
+
+    std::vector<Benchmark*> benchmarks;
+
+    // ---------- Containers benchmarks ---------- //
+
+    benchmarks.push_back(new ContainersBenchmark("Containers"));
+
+    // ---------- Collision Detection benchmarks ---------- //
+
+    benchmarks.push_back(new BroadPhaseBenchmark("BroadPhase"));
+    benchmarks.push_back(new ConcaveMeshBenchmark("ConcaveMesh"));
+    benchmarks.push_back(new HeightFieldBenchmark("HeightField"));
+
+    // ---------- Dynamics benchmarks ---------- //
+
+    benchmarks.push_back(new SleepingBodiesBenchmark("SleepingBodies"));
+
+    for (Benchmark* benchmark : benchmarks) {
+
+        bool isSelected = argc < 2;
+        for (int i=1; i < argc; i++) {
+            isSelected |= benchmark->getName().find(argv[i]) != std::string::npos;
+        }
+
+        if (isSelected) {
+            std::cout << benchmark->getName() << std::endl;
+            benchmark->run();
+        }
+
+        delete benchmark;
+    }
+
+    return 0;
+}
@@ -0,0 +1,192 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_CONVEX_POLYHEDRON_ARRAYS_H
+#define REACTPHYSICS3D_CONVEX_POLYHEDRON_ARRAYS_H
+
+// Libraries
+#include <reactphysics3d/mathematics/mathematics.h>
+#include <reactphysics3d/collision/HalfEdgeStructure.h>
+
+namespace reactphysics3d {
+
+// Class ConvexPolyhedronArrays
+/**
+ * This class contains the faces and the edges of a convex polyhedron stored as structures of
+ * arrays (the x coordinates of all the elements, then their y and z coordinates) so that the
+ * SAT algorithm can test several faces or edges at once with SIMD instructions. The number of
+ * elements in each array is rounded up to a multiple of the number of SIMD lanes and the padding
+ * is filled with a copy of the first face or edge. Only one of the two half-edges of each edge
+ * (the one with an even index) is stored. The positions of the vertices are the positions before
+ * the scaling of the collision shape.
+ */
+class ConvexPolyhedronArrays {
+
+    private:
+
+        // -------------------- Attributes -------------------- //
+
+        /// Number of faces
+        uint mNbFaces;
+
+        /// Number of faces rounded up to a multiple of the number of SIMD lanes
+        uint mNbPaddedFaces;
+
+        /// Number of edges (half the number of half-edges)
+        uint mNbEdges;
+
+        /// Number of edges rounded up to a multiple of the number of SIMD lanes
+        uint mNbPaddedEdges;
+
+        /// Memory with all the arrays
+        decimal* mData;
+
+        /// Normals of the faces
+        decimal* mFacesNormals;
+
+        /// First vertex of each face
+        decimal* mFacesVertices;
+
+        /// Start vertex of each edge
+        decimal* mEdgesVertices1;
+
+        /// End vertex of each edge (start vertex of its twin edge)
+        decimal* mEdgesVertices2;
+
+        /// Normal of the face of each edge
+        decimal* mEdgesFacesNormals1;
+
+        /// Normal of the face of the twin of each edge
+        decimal* mEdgesFacesNormals2;
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        ConvexPolyhedronArrays();
+
+        /// Destructor
+        ~ConvexPolyhedronArrays();
+
+        /// Deleted copy-constructor
+        ConvexPolyhedronArrays(const ConvexPolyhedronArrays& arrays) = delete;
+
+        /// Deleted assignment operator
+        ConvexPolyhedronArrays& operator=(const ConvexPolyhedronArrays& arrays) = delete;
+
+        /// Compute the arrays from the half-edge structure, the vertices and the face normals of a polyhedron
+        void compute(const HalfEdgeStructure& halfEdgeStructure, const Vector3* vertices, const Vector3* facesNormals);
+
+        /// Return the number of faces
+        uint getNbFaces() const;
+
+        /// Return the number of faces rounded up to a multiple of the number of SIMD lanes
+        uint getNbPaddedFaces() const;
+
+        /// Return the number of edges
+        uint getNbEdges() const;
+
+        /// Return the number of edges rounded up to a multiple of the number of SIMD lanes
+        uint getNbPaddedEdges() const;
+
+        /// Return the array with the normals of the faces
+        const decimal* getFacesNormals() const;
+
+        /// Return the array with the first vertex of each face
+        const decimal* getFacesVertices() const;
+
+        /// Return the array with the start vertex of each edge
+        const decimal* getEdgesVertices1() const;
+
+        /// Return the array with the end vertex of each edge
+        const decimal* getEdgesVertices2() const;
+
+        /// Return the array with the normal of the face of each edge
+        const decimal* getEdgesFacesNormals1() const;
+
+        /// Return the array with the normal of the face of the twin of each edge
+        const decimal* getEdgesFacesNormals2() const;
+};
+
+// Return the number of faces
+inline uint ConvexPolyhedronArrays::getNbFaces() const {
+    return mNbFaces;
+}
+
+// Return the number of faces rounded up to a multiple of the number of SIMD lanes
+inline uint ConvexPolyhedronArrays::getNbPaddedFaces() const {
+    return mNbPaddedFaces;
+}
+
+// Return the number of edges
+inline uint ConvexPolyhedronArrays::getNbEdges() const {
+    return mNbEdges;
+}
+
+// Return the number of edges rounded up to a multiple of the number of SIMD lanes
+inline uint ConvexPolyhedronArrays::getNbPaddedEdges() const {
+    return mNbPaddedEdges;
+}
+
+// Return the array with the normals of the faces
+/// The x coordinates of the normals are followed by the y and z coordinates (getNbPaddedFaces() values each)
+inline const decimal* ConvexPolyhedronArrays::getFacesNormals() const {
+    return mFacesNormals;
+}
+
+// Return the array with the first vertex of each face
+/// The x coordinates of the vertices are followed by the y and z coordinates (getNbPaddedFaces() values each)
+inline const decimal* ConvexPolyhedronArrays::getFacesVertices() const {
+    return mFacesVertices;
+}
+
+// Return the array with the start vertex of each edge
+/// The x coordinates of the vertices are followed by the y and z coordinates (getNbPaddedEdges() values each)
+inline const decimal* ConvexPolyhedronArrays::getEdgesVertices1() const {
+    return mEdgesVertices1;
+}
+
+// Return the array with the end vertex of each edge
+/// The x coordinates of the vertices are followed by the y and z coordinates (getNbPaddedEdges() values each)
+inline const decimal* ConvexPolyhedronArrays::getEdgesVertices2() const {
+    return mEdgesVertices2;
+}
+
+// Return the array with the normal of the face of each edge
+/// The x coordinates of the normals are followed by the y and z coordinates (getNbPaddedEdges() values each)
+inline const decimal* ConvexPolyhedronArrays::getEdgesFacesNormals1() const {
+    return mEdgesFacesNormals1;
+}
+
+// Return the array with the normal of the face of the twin of each edge
+/// The x coordinates of the normals are followed by the y and z coordinates (getNbPaddedEdges() values each)
+inline const decimal* ConvexPolyhedronArrays::getEdgesFacesNormals2() const {
+    return mEdgesFacesNormals2;
+}
+
+}
+
+#endif
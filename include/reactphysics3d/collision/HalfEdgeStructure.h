@@ -99,6 +99,9 @@ class HalfEdgeStructure {
         /// Initialize the structure (when all vertices and faces have been added)
         void init();
 
+        /// Initialize the structure with half-edges computed before (when all vertices and faces have been added)
+        void init(const Edge* edges, uint nbEdges, const uint* verticesEdges, const uint* facesEdges);
+
         /// Add a vertex
         uint addVertex(uint vertexPointIndex);
 
@@ -0,0 +1,239 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_MESH_COOKER_H
+#define REACTPHYSICS3D_MESH_COOKER_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/containers/List.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+class TriangleMesh;
+class PolyhedronMesh;
+class HeightFieldShape;
+class MemoryAllocator;
+
+// Class MeshCooker
+/**
+ * This class cooks the collision data of triangle meshes, polyhedron meshes and height fields
+ * into a binary format that can be saved into a file. Creating a mesh from cooked data (see
+ * the PhysicsCommon::createXXXFromCookedData() methods) is much faster than creating it from
+ * the vertices because the AABB tree of a triangle mesh and the half-edge structure of a polyhedron
+ * mesh are stored in the cooked data. Moreover, the vertices, indices, heights and tree nodes are
+ * used directly from the cooked data without being copied. The cooked data can therefore be a file
+ * mapped into memory (see MemoryMappedFile) that must remain valid while the mesh is used.
+ *
+ * The cooked data starts with a header (with a version number and a checksum of the data) followed
+ * by the description of the mesh and by its arrays. Each array starts at an offset (from the beginning
+ * of the data) that is a multiple of 64 bytes. The cooked data of a single mesh is limited to 2 GB. Note that
+ * cooked data can only be loaded on a platform with the same endianness and with the same decimal precision
+ * as the platform that has cooked it.
+ */
+class MeshCooker {
+
+    public:
+
+        // -------------------- Types -------------------- //
+
+        /// Type of cooked data
+        enum class CookedDataType : uint32 {TRIANGLE_MESH = 1, POLYHEDRON_MESH = 2, HEIGHT_FIELD = 3};
+
+        /// Header at the beginning of cooked data
+        struct Header {
+
+            /// Magic string to identify cooked data
+            char magic[8];
+
+            /// Version of the format of the cooked data
+            uint32 version;
+
+            /// Type of cooked data
+            uint32 dataType;
+
+            /// Size in bytes of a decimal value on the platform that has cooked the data
+            uint32 decimalSize;
+
+            /// Known value used to check the endianness of the data
+            uint32 endiannessCheck;
+
+            /// Total size of the data in bytes (including the header)
+            uint64 dataSize;
+
+            /// Checksum of all the bytes of the data after the header
+            uint64 checksum;
+        };
+
+        /// Cooked triangle mesh (after the header)
+        struct TriangleMeshData {
+
+            /// Number of sub-parts (triangle vertex arrays) of the mesh
+            uint32 nbSubparts;
+
+            /// Total number of triangles of the mesh
+            uint32 nbTriangles;
+
+            /// Reference of the root of the AABB tree of the triangles
+            int32 treeRootReference;
+
+            /// Padding
+            uint32 padding;
+
+            /// Minimum coordinates of the AABB of the root of the tree
+            decimal treeRootMin[3];
+
+            /// Maximum coordinates of the AABB of the root of the tree
+            decimal treeRootMax[3];
+
+            /// Offset of the array of sub-parts (TriangleMeshSubpartData)
+            uint64 subpartsOffset;
+
+            /// Offset of the array of the (nbTriangles - 1) internal nodes of the tree (StaticAABBTreeNode)
+            uint64 treeNodesOffset;
+        };
+
+        /// Cooked sub-part of a triangle mesh
+        struct TriangleMeshSubpartData {
+
+            /// Number of vertices of the sub-part
+            uint32 nbVertices;
+
+            /// Number of triangles of the sub-part
+            uint32 nbTriangles;
+
+            /// Offset of the array with the three coordinates (decimal) of each vertex
+            uint64 verticesOffset;
+
+            /// Offset of the array with the three coordinates (decimal) of each vertex normal
+            uint64 normalsOffset;
+
+            /// Offset of the array with the three vertex indices (uint32) of each triangle
+            uint64 indicesOffset;
+        };
+
+        /// Cooked polyhedron mesh (after the header)
+        struct PolyhedronMeshData {
+
+            /// Number of vertices
+            uint32 nbVertices;
+
+            /// Number of faces
+            uint32 nbFaces;
+
+            /// Number of vertex indices of all the faces
+            uint32 nbFacesIndices;
+
+            /// Number of half-edges
+            uint32 nbHalfEdges;
+
+            /// Offset of the array with the three coordinates (decimal) of each vertex
+            uint64 verticesOffset;
+
+            /// Offset of the array of faces (PolygonVertexArray::PolygonFace)
+            uint64 facesOffset;
+
+            /// Offset of the array with the vertex indices (uint32) of all the faces
+            uint64 facesIndicesOffset;
+
+            /// Offset of the array of half-edges (HalfEdgeStructure::Edge)
+            uint64 halfEdgesOffset;
+
+            /// Offset of the array with the index (uint32) of an half-edge emanating from each vertex
+            uint64 verticesEdgesOffset;
+
+            /// Offset of the array with the index (uint32) of an half-edge of each face
+            uint64 facesEdgesOffset;
+        };
+
+        /// Cooked height field (after the header)
+        struct HeightFieldData {
+
+            /// Number of columns of the grid
+            int32 nbColumns;
+
+            /// Number of rows of the grid
+            int32 nbRows;
+
+            /// Up axis of the height field (0 for x, 1 for y and 2 for z)
+            int32 upAxis;
+
+            /// Data type of the height values (HeightFieldShape::HeightDataType)
+            int32 heightDataType;
+
+            /// Minimum height value
+            decimal minHeight;
+
+            /// Maximum height value
+            decimal maxHeight;
+
+            /// Scaling factor of the integer height values
+            decimal integerHeightScale;
+
+            /// Offset of the array of height values
+            uint64 heightsOffset;
+        };
+
+        // -------------------- Constants -------------------- //
+
+        /// Version of the format of the cooked data
+        static const uint32 VERSION;
+
+        /// Alignment (in bytes) of the arrays in the cooked data
+        static const uint64 ALIGNMENT;
+
+        // -------------------- Methods -------------------- //
+
+        /// Cook a triangle mesh (with the AABB tree of its triangles)
+        static bool cookTriangleMesh(const TriangleMesh& triangleMesh, MemoryAllocator& allocator, List<uint8>& outData);
+
+        /// Cook a polyhedron mesh (with its half-edge structure)
+        static bool cookPolyhedronMesh(const PolyhedronMesh& polyhedronMesh, List<uint8>& outData);
+
+        /// Cook the height values of a height field
+        static bool cookHeightField(const HeightFieldShape& heightField, List<uint8>& outData);
+
+        /// Return true if a buffer contains valid cooked data of a given type
+        static bool isCookedDataValid(const void* data, size_t dataSize, CookedDataType dataType, bool isChecksumVerified = true);
+
+        /// Compute the checksum of a buffer
+        static uint64 computeChecksum(const void* data, size_t size);
+
+        /// Return a pointer to an array of the cooked data at a given offset
+        template<typename T>
+        static const T* getArray(const void* data, uint64 offset);
+};
+
+// Return a pointer to an array of the cooked data at a given offset
+template<typename T>
+inline const T* MeshCooker::getArray(const void* data, uint64 offset) {
+    return reinterpret_cast<const T*>(static_cast<const uint8*>(data) + offset);
+}
+
+}
+
+#endif
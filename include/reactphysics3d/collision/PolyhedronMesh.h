@@ -29,6 +29,7 @@
 // Libraries
 #include <reactphysics3d/mathematics/mathematics.h>
 #include "HalfEdgeStructure.h"
+#include "ConvexPolyhedronArrays.h"
 
 namespace reactphysics3d {
 
@@ -60,20 +61,65 @@ class PolyhedronMesh {
         /// Array with the face normals
         Vector3* mFacesNormals;
 
+        /// Faces and edges of the mesh stored as structures of arrays for the SAT algorithm
+        ConvexPolyhedronArrays mPolyhedronArrays;
+
         /// Centroid of the polyhedron
         Vector3 mCentroid;
 
+        /// Number of vertices in each array of coordinates of the vertices. This is the number of
+        /// vertices rounded up to a multiple of the number of SIMD lanes
+        uint mNbPaddedVertices;
+
+        /// Coordinates of the vertices stored as a structure of arrays (the x coordinates of all
+        /// the vertices, then their y and z coordinates). The padding is filled with the first vertex
+        decimal* mVerticesCoordinates;
+
+        /// For each vertex, index of its first neighbor vertex in the mVerticesNeighbors array (the
+        /// last element is the total number of neighbors)
+        uint* mVerticesNeighborsStartIndices;
+
+        /// Indices of the neighbor vertices (vertices linked with an edge) of all the vertices
+        uint* mVerticesNeighbors;
+
+        /// True if each vertex of the mesh has at least three neighbors so that the support
+        /// vertex can be found with hill-climbing
+        bool mIsHillClimbingEnabled;
+
+        /// True if the polygon vertex array has been created with the mesh (from cooked data)
+        /// and must be destroyed with it
+        bool mIsPolygonVertexArrayOwned;
+
         // -------------------- Methods -------------------- //
 
         /// Constructor
         PolyhedronMesh(PolygonVertexArray* polygonVertexArray, MemoryAllocator& allocator);
 
+        /// Constructor with the half-edges of the mesh computed before
+        PolyhedronMesh(PolygonVertexArray* polygonVertexArray, const HalfEdgeStructure::Edge* halfEdges, uint nbHalfEdges,
+                       const uint* verticesEdges, const uint* facesEdges, MemoryAllocator& allocator);
+
+        /// Add the vertices and faces of the polygon vertex array into the half-edge structure
+        void addVerticesAndFaces();
+
         /// Create the half-edge structure of the mesh
         void createHalfEdgeStructure();
 
+        /// Return a vertex read from the polygon vertex array
+        Vector3 readVertex(uint index) const;
+
+        /// Compute the arrays with the coordinates of the vertices
+        void computeVerticesCoordinates();
+
+        /// Compute the neighbor vertices of each vertex
+        void computeVerticesNeighbors();
+
         /// Compute the faces normals
         void computeFacesNormals();
 
+        /// Compute the arrays of faces and edges used by the SAT algorithm
+        void computePolyhedronArrays();
+
         /// Compute the centroid of the polyhedron
         void computeCentroid() ;
 
@@ -102,12 +148,27 @@ class PolyhedronMesh {
         /// Return the half-edge structure of the mesh
         const HalfEdgeStructure& getHalfEdgeStructure() const;
 
+        /// Return the arrays of faces and edges used by the SAT algorithm
+        const ConvexPolyhedronArrays& getPolyhedronArrays() const;
+
         /// Return the centroid of the polyhedron
         Vector3 getCentroid() const;
 
         /// Compute and return the volume of the polyhedron
         decimal getVolume() const;
 
+        /// Return true if the support vertex can be found with hill-climbing
+        bool isHillClimbingEnabled() const;
+
+        /// Return the index of the vertex with the largest dot product with a direction
+        uint computeSupportVertexLinearScan(const Vector3& direction) const;
+
+        /// Return the index of the support vertex found with hill-climbing from a given vertex
+        uint computeSupportVertexHillClimbing(const Vector3& direction, uint startVertexIndex) const;
+
+        /// Compute the indices of the vertices with the largest dot products with several directions
+        void computeSupportVerticesLinearScan(const decimal* directions, uint nbDirections, uint* outVerticesIndices) const;
+
         // ---------- Friendship ---------- //
 
         friend class PhysicsCommon;
@@ -121,6 +182,17 @@ inline uint PolyhedronMesh::getNbVertices() const {
     return mHalfEdgeStructure.getNbVertices();
 }
 
+// Return a vertex
+/**
+ * @param index Index of a given vertex in the mesh
+ * @return The coordinates of a given vertex in the mesh
+ */
+inline Vector3 PolyhedronMesh::getVertex(uint index) const {
+    assert(index < getNbVertices());
+    return Vector3(mVerticesCoordinates[index], mVerticesCoordinates[mNbPaddedVertices + index],
+                   mVerticesCoordinates[2 * mNbPaddedVertices + index]);
+}
+
 // Return the number of faces
 /**
  * @return The number of faces in the mesh
@@ -147,6 +219,14 @@ inline const HalfEdgeStructure& PolyhedronMesh::getHalfEdgeStructure() const {
     return mHalfEdgeStructure;
 }
 
+// Return the arrays of faces and edges used by the SAT algorithm
+/**
+ * @return The faces and edges of the mesh stored as structures of arrays
+ */
+inline const ConvexPolyhedronArrays& PolyhedronMesh::getPolyhedronArrays() const {
+    return mPolyhedronArrays;
+}
+
 // Return the centroid of the polyhedron
 /**
  * @return The centroid of the mesh
@@ -155,6 +235,13 @@ inline Vector3 PolyhedronMesh::getCentroid() const {
     return mCentroid;
 }
 
+// Return true if the support vertex can be found with hill-climbing
+/// This is false if a vertex of the mesh is not linked to the other vertices by at
+/// least three edges (vertex not used by any face for instance).
+inline bool PolyhedronMesh::isHillClimbingEnabled() const {
+    return mIsHillClimbingEnabled;
+}
+
 }
 
 #endif
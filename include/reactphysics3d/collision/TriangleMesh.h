@@ -30,11 +30,13 @@
 #include <cassert>
 #include <reactphysics3d/containers/List.h>
 #include <reactphysics3d/memory/MemoryAllocator.h>
+#include <reactphysics3d/collision/shapes/AABB.h>
 
 namespace reactphysics3d {
 
 // Declarations
 class TriangleVertexArray;
+struct StaticAABBTreeNode;
 
 // Class TriangleMesh
 /**
@@ -48,9 +50,27 @@ class TriangleMesh {
 
     protected:
 
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
         /// All the triangle arrays of the mesh (one triangle array per part)
         List<TriangleVertexArray*> mTriangleArrays;
 
+        /// Triangle arrays created with the mesh when it is loaded from cooked data (destroyed with the mesh)
+        List<TriangleVertexArray*> mCookedTriangleArrays;
+
+        /// Internal nodes of the AABB tree of the triangles when the mesh is loaded from cooked data
+        const StaticAABBTreeNode* mCookedTreeNodes;
+
+        /// Reference of the root of the cooked AABB tree
+        int32 mCookedTreeRootReference;
+
+        /// AABB of all the triangles of the cooked AABB tree
+        AABB mCookedTreeRootAABB;
+
+        /// Number of triangles in the cooked AABB tree (zero if the mesh has not been loaded from cooked data)
+        uint32 mCookedTreeNbTriangles;
+
         /// Constructor
         TriangleMesh(reactphysics3d::MemoryAllocator& allocator);
 
@@ -72,6 +92,7 @@ class TriangleMesh {
         // ---------- Friendship ---------- //
 
         friend class PhysicsCommon;
+        friend class ConcaveMeshShape;
 };
 
 // Add a subpart of the mesh
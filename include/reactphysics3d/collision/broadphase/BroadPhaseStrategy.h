@@ -0,0 +1,186 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_BROAD_PHASE_STRATEGY_H
+#define REACTPHYSICS3D_BROAD_PHASE_STRATEGY_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/collision/shapes/AABB.h>
+#include <reactphysics3d/containers/List.h>
+#include <reactphysics3d/containers/Pair.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+class DynamicAABBTreeRaycastCallback;
+class Profiler;
+struct Ray;
+
+/// Enumeration for the data structure used by the broad-phase collision detection of a world
+/// DYNAMIC_AABB_TREE : Dynamic tree of fat AABBs. This is the best choice for most of the worlds
+/// SWEEP_AND_PRUNE : Colliders sorted along an axis and swept to find the overlapping pairs. This is
+///                   faster than the tree when most of the bodies are moving (coherently) all the time
+enum class BroadPhaseType {DYNAMIC_AABB_TREE, SWEEP_AND_PRUNE};
+
+// Class BroadPhaseStrategy
+/**
+ * This abstract class is the interface of the data structures that can be used by the
+ * BroadPhaseSystem to store the fat AABBs of the colliders and to compute the pairs of
+ * colliders with overlapping fat AABBs. Each object of the structure is identified by a
+ * non-negative integer ID that can be reused once the object has been removed. An object
+ * can be static (collider of a static body). The static objects never move (except when the
+ * user sets the transform of their body) and they never need to be tested against each other.
+ * The fat AABB of an object is its AABB inflated by a percentage of its size and extended along
+ * the predicted displacement of the object. It is recomputed when the object moves out of it or
+ * when it has become much larger than needed (for instance when a fast object has slowed down).
+ * An overlap query is split into items (for instance the objects to test) so that it can run
+ * on several threads. Between beginOverlapQuery() and endOverlapQuery(), the structure is not
+ * modified and reportOverlappingPairs() can be called at the same time for disjoint ranges of items.
+ */
+class BroadPhaseStrategy {
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        BroadPhaseStrategy() = default;
+
+        /// Destructor
+        virtual ~BroadPhaseStrategy() = default;
+
+        /// Deleted copy-constructor
+        BroadPhaseStrategy(const BroadPhaseStrategy& strategy) = delete;
+
+        /// Deleted assignment operator
+        BroadPhaseStrategy& operator=(const BroadPhaseStrategy& strategy) = delete;
+
+        /// Return the type of the broad-phase data structure
+        virtual BroadPhaseType getType() const=0;
+
+        /// Add an object and return its ID
+        virtual int32 addObject(const AABB& aabb, void* data, bool isStatic)=0;
+
+        /// Remove an object
+        virtual void removeObject(int32 objectId)=0;
+
+        /// Update an object after it has moved and return true if its fat AABB has changed
+        virtual bool updateObject(int32 objectId, const AABB& newAABB, bool forceReinsert, const Vector3& displacement)=0;
+
+        /// Return the fat AABB of an object
+        virtual const AABB& getFatAABB(int32 objectId) const=0;
+
+        /// Return the data pointer of an object
+        virtual void* getObjectData(int32 objectId) const=0;
+
+        /// Prepare the data structure for an overlap query with the objects to test
+        virtual void beginOverlapQuery(const List<int32>& objectsToTest)=0;
+
+        /// Return the number of items of an overlap query
+        virtual uint32 getNbOverlapQueryItems(const List<int32>& objectsToTest) const=0;
+
+        /// Report the pairs (object to test, other object) of overlapping fat AABBs found by the items [startIndex, endIndex) of the query.
+        /// The pairs of two static objects are not reported
+        virtual void reportOverlappingPairs(const List<int32>& objectsToTest, uint32 startIndex, uint32 endIndex,
+                                            List<Pair<int32, int32>>& outOverlappingObjects) const=0;
+
+        /// Finish an overlap query with the objects to test
+        virtual void endOverlapQuery(const List<int32>& objectsToTest)=0;
+
+        /// Report the pairs (object to test, other object) of overlapping fat AABBs for the objects to test
+        void reportAllShapesOverlappingWithShapes(const List<int32>& objectsToTest, List<Pair<int32, int32>>& outOverlappingObjects);
+
+        /// Ray casting method
+        virtual void raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const=0;
+
+        /// Rebuild the data structure from all its objects to improve the speed of the queries
+        virtual void rebuild()=0;
+
+        /// Compute the surface area heuristic (SAH) cost of the data structure (zero if it is not a hierarchy)
+        virtual decimal computeSAHCost() const=0;
+
+        /// Compute the fat AABB of an object from its AABB and its predicted displacement
+        static void computeFatAABB(const AABB& aabb, const Vector3& displacement, decimal inflatePercentage, AABB& outFatAABB);
+
+        /// Return true if the fat AABB of an object can be kept after the object has moved
+        static bool isFatAABBStillValid(const AABB& fatAABB, const AABB& newAABB, const Vector3& displacement, decimal inflatePercentage);
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+        /// Set the profiler
+        virtual void setProfiler(Profiler* profiler)=0;
+
+#endif
+
+};
+
+// Report the pairs (object to test, other object) of overlapping fat AABBs for the objects to test
+/// The whole query runs on the calling thread. A pair can be reported several times and an
+/// object to test can be reported with itself.
+inline void BroadPhaseStrategy::reportAllShapesOverlappingWithShapes(const List<int32>& objectsToTest,
+                                                                     List<Pair<int32, int32>>& outOverlappingObjects) {
+
+    beginOverlapQuery(objectsToTest);
+    reportOverlappingPairs(objectsToTest, 0, getNbOverlapQueryItems(objectsToTest), outOverlappingObjects);
+    endOverlapQuery(objectsToTest);
+}
+
+// Compute the fat AABB of an object from its AABB and its predicted displacement
+/// The AABB is inflated by a percentage of its size on each side and it is extended in the direction
+/// of the displacement (as in Box2D) so that an object moving at a constant velocity stays in its fat AABB
+/// during several frames.
+inline void BroadPhaseStrategy::computeFatAABB(const AABB& aabb, const Vector3& displacement, decimal inflatePercentage,
+                                               AABB& outFatAABB) {
+
+    const Vector3 gap(aabb.getExtent() * inflatePercentage * decimal(0.5));
+    outFatAABB.setMin(aabb.getMin() - gap + Vector3::min(displacement, Vector3::zero()));
+    outFatAABB.setMax(aabb.getMax() + gap + Vector3::max(displacement, Vector3::zero()));
+
+    assert(outFatAABB.contains(aabb));
+}
+
+// Return true if the fat AABB of an object can be kept after the object has moved
+/// The fat AABB must contain the new AABB of the object. It must also not be much larger than the fat AABB
+/// that would be computed now. Otherwise, an object that has moved fast would keep its large fat AABB
+/// (and its false overlapping pairs) after it has slowed down.
+inline bool BroadPhaseStrategy::isFatAABBStillValid(const AABB& fatAABB, const AABB& newAABB, const Vector3& displacement,
+                                                    decimal inflatePercentage) {
+
+    if (!fatAABB.contains(newAABB)) return false;
+
+    const Vector3 maxExcess(newAABB.getExtent() * inflatePercentage * decimal(0.5) * (decimal(1.0) + DYNAMIC_TREE_FAT_AABB_MAX_EXCESS_GAP_FACTOR) +
+                            displacement.getAbsoluteVector());
+    const Vector3 maxFatAABBMin = newAABB.getMin() - maxExcess;
+    const Vector3 maxFatAABBMax = newAABB.getMax() + maxExcess;
+
+    return fatAABB.getMin().x >= maxFatAABBMin.x && fatAABB.getMin().y >= maxFatAABBMin.y && fatAABB.getMin().z >= maxFatAABBMin.z &&
+           fatAABB.getMax().x <= maxFatAABBMax.x && fatAABB.getMax().y <= maxFatAABBMax.y && fatAABB.getMax().z <= maxFatAABBMax.z;
+}
+
+}
+
+#endif
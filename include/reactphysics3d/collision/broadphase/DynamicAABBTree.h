@@ -43,6 +43,7 @@ struct RaycastTest;
 class AABB;
 class Profiler;
 class MemoryAllocator;
+template<typename T> class Stack;
 
 
 // Structure TreeNode
@@ -138,6 +139,29 @@ class DynamicAABBTree {
 
     private:
 
+        // -------------------- Types -------------------- //
+
+        /// Leaf with its bounds while the tree is rebuilt
+        struct BuildLeaf {
+
+            /// Minimum coordinates of the AABB of the leaf
+            Vector3 aabbMin;
+
+            /// Maximum coordinates of the AABB of the leaf
+            Vector3 aabbMax;
+
+            /// Center of the AABB of the leaf
+            Vector3 centroid;
+
+            /// ID of the leaf node
+            int32 nodeID;
+        };
+
+        // -------------------- Constants -------------------- //
+
+        /// Number of bins used to find the best split of a node along an axis when the tree is rebuilt
+        const static uint32 NB_BINS = 16;
+
         // -------------------- Attributes -------------------- //
 
         /// Memory allocator
@@ -161,6 +185,9 @@ class DynamicAABBTree {
         /// The fat AABB is the initial AABB inflated by a given percentage of its size.
         decimal mFatAABBInflatePercentage;
 
+        /// ID of the next node to visit by the incremental optimization of the tree
+        int32 mOptimizationNodeID;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Pointer to the profiler
@@ -188,6 +215,18 @@ class DynamicAABBTree {
         /// Compute the height of a given node in the tree
         int computeHeight(int32 nodeID);
 
+        /// Split the leaves [startIndex, endIndex) in two groups and return the index of the first leaf of the second group
+        uint32 splitLeaves(List<BuildLeaf>& leaves, uint32 startIndex, uint32 endIndex) const;
+
+        /// Apply the rotation below an internal node that reduces the most the surface area of its children
+        bool rotateNode(int32 nodeID);
+
+        /// Exchange the positions of two nodes in the tree (none of them is an ancestor of the other)
+        void swapNodes(int32 nodeID1, int32 nodeID2);
+
+        /// Recompute the AABB and the height of an internal node from its children
+        void refitNode(int32 nodeID);
+
         /// Internally add an object into the tree
         int32 addObjectInternal(const AABB& aabb);
 
@@ -224,7 +263,8 @@ class DynamicAABBTree {
         void removeObject(int32 nodeID);
 
         /// Update the dynamic tree after an object has moved.
-        bool updateObject(int32 nodeID, const AABB& newAABB, bool forceReinsert = false);
+        bool updateObject(int32 nodeID, const AABB& newAABB, bool forceReinsert = false,
+                          const Vector3& displacement = Vector3::zero());
 
         /// Return the fat AABB corresponding to a given node ID
         const AABB& getFatAABB(int32 nodeID) const;
@@ -242,12 +282,25 @@ class DynamicAABBTree {
         /// Report all shapes overlapping with the AABB given in parameter.
         void reportAllShapesOverlappingWithAABB(const AABB& aabb, List<int>& overlappingNodes) const;
 
+        /// Report the pairs (ID in parameter, leaf node) for all the leaf nodes overlapping with an AABB
+        void reportAllShapesOverlappingWithAABB(const AABB& aabb, int32 idToReport, Stack<int32>& stack,
+                                                List<Pair<int32, int32>>& outOverlappingNodes) const;
+
         /// Ray casting method
         void raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const;
 
         /// Compute the height of the tree
         int computeHeight();
 
+        /// Rebuild the tree top-down from its leaves
+        void rebuild();
+
+        /// Improve the tree with rotations of a limited number of internal nodes
+        void optimize(uint32 nbMaxNodesToVisit);
+
+        /// Compute the surface area heuristic (SAH) cost of the tree
+        decimal computeSAHCost() const;
+
         /// Return the root AABB of the tree
         AABB getRootAABB() const;
 
@@ -0,0 +1,294 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_DYNAMIC_AABB_TREE_BROAD_PHASE_H
+#define REACTPHYSICS3D_DYNAMIC_AABB_TREE_BROAD_PHASE_H
+
+// Libraries
+#include <reactphysics3d/collision/broadphase/BroadPhaseStrategy.h>
+#include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Class DynamicAABBTreeBroadPhase
+/**
+ * This class is the broad-phase data structure that stores the fat AABBs of the colliders
+ * into dynamic AABB trees. The static objects are stored in a separate tree that is almost
+ * never modified. Therefore, the tree of the moving objects stays small and an object that
+ * has moved is tested against both trees while a static object is only tested against the
+ * tree of the non-static objects. The ID of an object is the ID of its leaf node in its
+ * tree shifted by one bit and the lowest bit is set for a static object. Before each overlap
+ * query, a few nodes of the tree of the non-static objects are optimized with tree rotations and
+ * the tree of the static objects is rebuilt if many static objects have changed since its last build.
+ */
+class DynamicAABBTreeBroadPhase : public BroadPhaseStrategy {
+
+    private :
+
+        // Class TreeRaycastCallback
+        /**
+         * Raycast callback that converts the node IDs of a tree into object IDs and that
+         * keeps the closest hit fraction so that the ray is clipped in the second tree.
+         */
+        class TreeRaycastCallback : public DynamicAABBTreeRaycastCallback {
+
+            public :
+
+                /// Raycast callback of the broad-phase
+                DynamicAABBTreeRaycastCallback& mCallback;
+
+                /// True if the tree that is currently raycast is the tree of the static objects
+                bool mIsStaticTree;
+
+                /// Maximum hit fraction of the ray
+                decimal mMaxFraction;
+
+                /// True if the callback has asked to stop the raycast
+                bool mIsStopped;
+
+                /// Constructor
+                TreeRaycastCallback(DynamicAABBTreeRaycastCallback& callback, decimal maxFraction)
+                    : mCallback(callback), mIsStaticTree(false), mMaxFraction(maxFraction), mIsStopped(false) {
+
+                }
+
+                /// Called for a leaf node of the tree that is hit by the ray
+                virtual decimal raycastBroadPhaseShape(int32 nodeId, const Ray& ray) override;
+        };
+
+        // -------------------- Constants -------------------- //
+
+        /// The tree of the static objects is rebuilt when the number of static objects that have been
+        /// added, removed or moved since the last build is larger than the number of static objects
+        /// divided by this value
+        const static uint32 STATIC_TREE_REBUILD_RATIO = 8;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        /// Dynamic AABB tree with the non-static objects
+        DynamicAABBTree mDynamicAABBTree;
+
+        /// Dynamic AABB tree with the static objects
+        DynamicAABBTree mStaticAABBTree;
+
+        /// Number of static objects
+        uint32 mNbStaticObjects;
+
+        /// Number of changes of the tree of the static objects since it has been rebuilt
+        uint32 mNbStaticTreeChanges;
+
+        // -------------------- Methods -------------------- //
+
+        /// Return the ID of an object from its tree and the ID of its node
+        static int32 computeObjectId(int32 nodeId, bool isStatic);
+
+        /// Return the ID of the node of an object in its tree
+        static int32 getNodeId(int32 objectId);
+
+        /// Return true if an object is static
+        static bool isStaticObject(int32 objectId);
+
+        /// Return the tree of an object
+        DynamicAABBTree& getTree(int32 objectId);
+
+        /// Return the tree of an object
+        const DynamicAABBTree& getTree(int32 objectId) const;
+
+        /// Convert the node IDs of the second objects of the pairs found by a query of a tree into object IDs
+        static void convertToObjectIds(List<Pair<int32, int32>>& pairs, uint32 startIndex, bool isStatic);
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        DynamicAABBTreeBroadPhase(MemoryAllocator& allocator, decimal fatAABBInflatePercentage);
+
+        /// Destructor
+        virtual ~DynamicAABBTreeBroadPhase() override = default;
+
+        /// Return the type of the broad-phase data structure
+        virtual BroadPhaseType getType() const override;
+
+        /// Add an object and return its ID
+        virtual int32 addObject(const AABB& aabb, void* data, bool isStatic) override;
+
+        /// Remove an object
+        virtual void removeObject(int32 objectId) override;
+
+        /// Update an object after it has moved and return true if its fat AABB has changed
+        virtual bool updateObject(int32 objectId, const AABB& newAABB, bool forceReinsert, const Vector3& displacement) override;
+
+        /// Return the fat AABB of an object
+        virtual const AABB& getFatAABB(int32 objectId) const override;
+
+        /// Return the data pointer of an object
+        virtual void* getObjectData(int32 objectId) const override;
+
+        /// Prepare the data structure for an overlap query with the objects to test
+        virtual void beginOverlapQuery(const List<int32>& objectsToTest) override;
+
+        /// Return the number of items of an overlap query
+        virtual uint32 getNbOverlapQueryItems(const List<int32>& objectsToTest) const override;
+
+        /// Report the pairs (object to test, other object) of overlapping fat AABBs found by the items [startIndex, endIndex) of the query
+        virtual void reportOverlappingPairs(const List<int32>& objectsToTest, uint32 startIndex, uint32 endIndex,
+                                            List<Pair<int32, int32>>& outOverlappingObjects) const override;
+
+        /// Finish an overlap query with the objects to test
+        virtual void endOverlapQuery(const List<int32>& objectsToTest) override;
+
+        /// Ray casting method
+        virtual void raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const override;
+
+        /// Rebuild the data structure from all its objects to improve the speed of the queries
+        virtual void rebuild() override;
+
+        /// Compute the surface area heuristic (SAH) cost of the data structure
+        virtual decimal computeSAHCost() const override;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+        /// Set the profiler
+        virtual void setProfiler(Profiler* profiler) override;
+
+#endif
+
+};
+
+// Constructor
+inline DynamicAABBTreeBroadPhase::DynamicAABBTreeBroadPhase(MemoryAllocator& allocator, decimal fatAABBInflatePercentage)
+    : mAllocator(allocator), mDynamicAABBTree(allocator, fatAABBInflatePercentage),
+      mStaticAABBTree(allocator, fatAABBInflatePercentage), mNbStaticObjects(0), mNbStaticTreeChanges(0) {
+
+}
+
+// Return the ID of an object from its tree and the ID of its node
+inline int32 DynamicAABBTreeBroadPhase::computeObjectId(int32 nodeId, bool isStatic) {
+    assert(nodeId >= 0);
+    return (nodeId << 1) | (isStatic ? 1 : 0);
+}
+
+// Return the ID of the node of an object in its tree
+inline int32 DynamicAABBTreeBroadPhase::getNodeId(int32 objectId) {
+    assert(objectId >= 0);
+    return objectId >> 1;
+}
+
+// Return true if an object is static
+inline bool DynamicAABBTreeBroadPhase::isStaticObject(int32 objectId) {
+    return (objectId & 1) != 0;
+}
+
+// Return the tree of an object
+inline DynamicAABBTree& DynamicAABBTreeBroadPhase::getTree(int32 objectId) {
+    return isStaticObject(objectId) ? mStaticAABBTree : mDynamicAABBTree;
+}
+
+// Return the tree of an object
+inline const DynamicAABBTree& DynamicAABBTreeBroadPhase::getTree(int32 objectId) const {
+    return isStaticObject(objectId) ? mStaticAABBTree : mDynamicAABBTree;
+}
+
+// Return the type of the broad-phase data structure
+inline BroadPhaseType DynamicAABBTreeBroadPhase::getType() const {
+    return BroadPhaseType::DYNAMIC_AABB_TREE;
+}
+
+// Add an object and return its ID
+inline int32 DynamicAABBTreeBroadPhase::addObject(const AABB& aabb, void* data, bool isStatic) {
+
+    if (isStatic) {
+        mNbStaticObjects++;
+        mNbStaticTreeChanges++;
+    }
+
+    DynamicAABBTree& tree = isStatic ? mStaticAABBTree : mDynamicAABBTree;
+    return computeObjectId(tree.addObject(aabb, data), isStatic);
+}
+
+// Remove an object
+inline void DynamicAABBTreeBroadPhase::removeObject(int32 objectId) {
+
+    if (isStaticObject(objectId)) {
+        assert(mNbStaticObjects > 0);
+        mNbStaticObjects--;
+        mNbStaticTreeChanges++;
+    }
+
+    getTree(objectId).removeObject(getNodeId(objectId));
+}
+
+// Update an object after it has moved and return true if its fat AABB has changed
+inline bool DynamicAABBTreeBroadPhase::updateObject(int32 objectId, const AABB& newAABB, bool forceReinsert,
+                                                    const Vector3& displacement) {
+
+    const bool hasChanged = getTree(objectId).updateObject(getNodeId(objectId), newAABB, forceReinsert, displacement);
+
+    if (hasChanged && isStaticObject(objectId)) {
+        mNbStaticTreeChanges++;
+    }
+
+    return hasChanged;
+}
+
+// Return the fat AABB of an object
+inline const AABB& DynamicAABBTreeBroadPhase::getFatAABB(int32 objectId) const {
+    return getTree(objectId).getFatAABB(getNodeId(objectId));
+}
+
+// Return the data pointer of an object
+inline void* DynamicAABBTreeBroadPhase::getObjectData(int32 objectId) const {
+    return getTree(objectId).getNodeDataPointer(getNodeId(objectId));
+}
+
+// Return the number of items of an overlap query
+/// Each object to test is an item of the query and traverses the trees on its own
+inline uint32 DynamicAABBTreeBroadPhase::getNbOverlapQueryItems(const List<int32>& objectsToTest) const {
+    return objectsToTest.size();
+}
+
+// Finish an overlap query with the objects to test
+inline void DynamicAABBTreeBroadPhase::endOverlapQuery(const List<int32>& /*objectsToTest*/) {
+
+}
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+// Set the profiler
+inline void DynamicAABBTreeBroadPhase::setProfiler(Profiler* profiler) {
+    mDynamicAABBTree.setProfiler(profiler);
+    mStaticAABBTree.setProfiler(profiler);
+}
+
+#endif
+
+}
+
+#endif
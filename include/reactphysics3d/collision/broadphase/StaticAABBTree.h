@@ -0,0 +1,289 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_STATIC_AABB_TREE_H
+#define REACTPHYSICS3D_STATIC_AABB_TREE_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/collision/shapes/AABB.h>
+#include <reactphysics3d/containers/List.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+class DynamicAABBTreeRaycastCallback;
+class MemoryAllocator;
+class Profiler;
+struct Ray;
+
+// Structure StaticAABBTreeNode
+/**
+ * This structure represents an internal node of the static AABB tree. The node stores the AABBs
+ * of its two children so that both of them are tested when the node is visited. Those AABBs are
+ * quantized on 16 bits relative to the AABB of the node. The minimum coordinates are stored as a
+ * distance to the minimum of the node and the maximum coordinates as a distance to the maximum of the
+ * node so that a zero value decodes exactly to the bound of the node. The quantized AABBs always contain
+ * the exact AABBs of the children. A node uses 32 bytes and therefore two nodes fit in a cache line.
+ */
+struct StaticAABBTreeNode {
+
+    // -------------------- Constants -------------------- //
+
+    /// Largest quantized coordinate
+    const static uint16 MAX_QUANTIZED_VALUE = 65535;
+
+    // -------------------- Attributes -------------------- //
+
+    /// Quantized distances between the minimum of the node AABB and the minimum of each child AABB
+    uint16 childrenMin[2][3];
+
+    /// Quantized distances between the maximum of each child AABB and the maximum of the node AABB
+    uint16 childrenMax[2][3];
+
+    /// Reference of each child. A non-negative reference is the index of an internal node
+    /// and a negative reference is a leaf with the object (-reference - 1)
+    int32 children[2];
+
+    // -------------------- Methods -------------------- //
+
+    /// Return the AABB of a child from the AABB of the node
+    AABB decodeChildAABB(int child, const AABB& nodeAABB) const;
+
+    /// Set the quantized AABB of a child so that it contains a given AABB and return the decoded child AABB
+    AABB encodeChildAABB(int child, const AABB& nodeAABB, const AABB& childAABB);
+};
+
+// Class StaticAABBTree
+/**
+ * This class represents a bounding volume hierarchy of objects that do not move (the triangles of
+ * a concave mesh for instance). The tree is built once from the AABBs of all the objects with a top-down
+ * binned surface area heuristic (SAH) and cannot be modified after. The nodes are stored in a single
+ * array (the first node is the root) and each leaf contains a single object. An object is identified
+ * by its index in the array of AABBs used to build the tree.
+ */
+class StaticAABBTree {
+
+    private:
+
+        // -------------------- Types -------------------- //
+
+        /// Object with its bounds while the tree is built
+        struct BuildObject {
+
+            /// Minimum coordinates of the AABB of the object
+            Vector3 aabbMin;
+
+            /// Maximum coordinates of the AABB of the object
+            Vector3 aabbMax;
+
+            /// Center of the AABB of the object
+            Vector3 centroid;
+
+            /// Index of the object
+            int32 object;
+        };
+
+        // -------------------- Constants -------------------- //
+
+        /// Reference of the root of an empty tree
+        const static int32 NULL_REFERENCE;
+
+        /// Number of bins used to find the best split of a node along an axis
+        const static uint32 NB_BINS = 16;
+
+        /// Alignment of the array of nodes (size of a cache line)
+        const static size_t NODES_ALIGNMENT;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        /// Memory allocated for the nodes (larger than the nodes to align them on a cache line). It
+        /// is null if the tree has not been built but uses nodes stored somewhere else
+        void* mNodesMemory;
+
+        /// Array of internal nodes
+        const StaticAABBTreeNode* mNodes;
+
+        /// Number of internal nodes
+        uint32 mNbNodes;
+
+        /// Reference of the root (index of an internal node, leaf or NULL_REFERENCE)
+        int32 mRootReference;
+
+        /// Exact AABB of all the objects of the tree
+        AABB mRootAABB;
+
+        /// Number of objects in the tree
+        uint32 mNbObjects;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+		/// Pointer to the profiler
+		Profiler* mProfiler;
+
+#endif
+
+        // -------------------- Methods -------------------- //
+
+        /// Release the memory of the nodes
+        void releaseNodes();
+
+        /// Split the objects [startIndex, endIndex) in two groups and return the index of the first object of the second group
+        uint32 splitObjects(List<BuildObject>& objects, uint32 startIndex, uint32 endIndex, AABB* outChildrenAABBs) const;
+
+        /// Return true if the reference is a leaf
+        static bool isLeaf(int32 reference);
+
+        /// Return the object of a leaf reference
+        static int32 getLeafObject(int32 reference);
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        StaticAABBTree(MemoryAllocator& allocator);
+
+        /// Destructor
+        ~StaticAABBTree();
+
+        /// Deleted copy-constructor
+        StaticAABBTree(const StaticAABBTree& tree) = delete;
+
+        /// Deleted assignment operator
+        StaticAABBTree& operator=(const StaticAABBTree& tree) = delete;
+
+        /// Build the tree with the AABBs of the objects (object i has the AABB objectsAABBs[i])
+        void build(const List<AABB>& objectsAABBs);
+
+        /// Initialize the tree with the nodes of a tree that has been built before
+        void init(const StaticAABBTreeNode* nodes, uint32 nbNodes, int32 rootReference,
+                  const AABB& rootAABB, uint32 nbObjects);
+
+        /// Return true if the references of nodes built before are inside the tree
+        static bool areNodesValid(const StaticAABBTreeNode* nodes, uint32 nbNodes, int32 rootReference, uint32 nbObjects);
+
+        /// Report all the objects whose AABB overlaps with the AABB in parameter
+        void reportAllShapesOverlappingWithAABB(const AABB& aabb, List<int32>& overlappingObjects) const;
+
+        /// Ray casting method
+        void raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const;
+
+        /// Return the AABB of all the objects of the tree
+        const AABB& getRootAABB() const;
+
+        /// Return the number of objects in the tree
+        uint32 getNbObjects() const;
+
+        /// Return the number of internal nodes of the tree
+        uint32 getNbNodes() const;
+
+        /// Return the array of internal nodes of the tree
+        const StaticAABBTreeNode* getNodes() const;
+
+        /// Return the reference of the root of the tree
+        int32 getRootReference() const;
+
+        /// Return the height of the tree (zero if the root is a leaf)
+        int getHeight() const;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+		/// Set the profiler
+		void setProfiler(Profiler* profiler);
+
+#endif
+
+};
+
+// Return the AABB of a child from the AABB of the node
+/// The same computation is used to build the tree and to traverse it so that the decoded
+/// AABBs are always the same.
+inline AABB StaticAABBTreeNode::decodeChildAABB(int child, const AABB& nodeAABB) const {
+
+    const Vector3& nodeMin = nodeAABB.getMin();
+    const Vector3& nodeMax = nodeAABB.getMax();
+    const Vector3 step = (nodeMax - nodeMin) * (decimal(1.0) / decimal(MAX_QUANTIZED_VALUE));
+
+    return AABB(Vector3(nodeMin.x + decimal(childrenMin[child][0]) * step.x,
+                        nodeMin.y + decimal(childrenMin[child][1]) * step.y,
+                        nodeMin.z + decimal(childrenMin[child][2]) * step.z),
+                Vector3(nodeMax.x - decimal(childrenMax[child][0]) * step.x,
+                        nodeMax.y - decimal(childrenMax[child][1]) * step.y,
+                        nodeMax.z - decimal(childrenMax[child][2]) * step.z));
+}
+
+// Return true if the reference is a leaf
+inline bool StaticAABBTree::isLeaf(int32 reference) {
+    return reference < 0 && reference != NULL_REFERENCE;
+}
+
+// Return the object of a leaf reference
+inline int32 StaticAABBTree::getLeafObject(int32 reference) {
+    assert(isLeaf(reference));
+    return -reference - 1;
+}
+
+// Return the AABB of all the objects of the tree
+inline const AABB& StaticAABBTree::getRootAABB() const {
+    return mRootAABB;
+}
+
+// Return the number of objects in the tree
+inline uint32 StaticAABBTree::getNbObjects() const {
+    return mNbObjects;
+}
+
+// Return the number of internal nodes of the tree
+inline uint32 StaticAABBTree::getNbNodes() const {
+    return mNbNodes;
+}
+
+// Return the array of internal nodes of the tree
+inline const StaticAABBTreeNode* StaticAABBTree::getNodes() const {
+    return mNodes;
+}
+
+// Return the reference of the root of the tree
+inline int32 StaticAABBTree::getRootReference() const {
+    return mRootReference;
+}
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+// Set the profiler
+inline void StaticAABBTree::setProfiler(Profiler* profiler) {
+    mProfiler = profiler;
+}
+
+#endif
+
+}
+
+#endif
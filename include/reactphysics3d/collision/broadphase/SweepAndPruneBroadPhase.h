@@ -0,0 +1,265 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_SWEEP_AND_PRUNE_BROAD_PHASE_H
+#define REACTPHYSICS3D_SWEEP_AND_PRUNE_BROAD_PHASE_H
+
+// Libraries
+#include <reactphysics3d/collision/broadphase/BroadPhaseStrategy.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Structure SweepAndPruneProxy
+/**
+ * This structure represents an object of the sweep-and-prune broad-phase.
+ */
+struct SweepAndPruneProxy {
+
+    // -------------------- Constants -------------------- //
+
+    /// Index in the sorted array of a proxy that is not used
+    const static int32 NULL_SORTED_INDEX;
+
+    // -------------------- Attributes -------------------- //
+
+    /// Fat axis aligned bounding box (AABB) of the object
+    AABB aabb;
+
+    /// Data pointer of the object
+    void* data;
+
+    /// Index of the object in the array of sorted objects (NULL_SORTED_INDEX if the proxy is free)
+    int32 sortedIndex;
+
+    /// True if the object has to be tested for overlap during the current query
+    bool isToTest;
+
+    /// True if the object is static
+    bool isStatic;
+};
+
+// Class SweepAndPruneBroadPhase
+/**
+ * This class is a broad-phase data structure that uses an incremental sort-and-sweep
+ * (also called box pruning). The objects are sorted by the minimum coordinate of their
+ * fat AABB along a sweep axis. To compute the overlapping pairs, the sorted array is
+ * swept once and each object is only compared with the following objects whose AABB
+ * starts before its own AABB ends along the axis. The sweep can be split into ranges of
+ * sorted objects that are processed independently. Because the bodies usually move
+ * coherently, the array is almost sorted from one query to the next and an insertion
+ * sort is used to restore the order. The sweep axis is the axis with the largest
+ * spread of the AABB centers so that the objects overlap as little as possible along it.
+ * Two static objects are never compared. A raycast only visits the sorted objects whose
+ * range along the sweep axis can overlap the segment of the ray.
+ */
+class SweepAndPruneBroadPhase : public BroadPhaseStrategy {
+
+    private :
+
+        // -------------------- Constants -------------------- //
+
+        /// Value in the array of sorted objects for an object that has been removed
+        const static int32 REMOVED_OBJECT;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        /// Array of proxies (the ID of an object is the index of its proxy)
+        List<SweepAndPruneProxy> mProxies;
+
+        /// IDs of the proxies that are free and can be reused
+        List<int32> mFreeProxies;
+
+        /// IDs of the objects sorted by the minimum coordinate of their AABB along the sweep axis
+        List<int32> mSortedObjects;
+
+        /// Number of objects at the beginning of the sorted array that have been sorted during the last query.
+        /// The objects after them have been added since the last query
+        uint32 mNbSortedObjects;
+
+        /// Minimum coordinate along the sweep axis of the fat AABBs of the objects that have been
+        /// sorted during the last query (in the order of the sorted array)
+        List<decimal> mSortedMins;
+
+        /// Largest decrease of the minimum coordinate along the sweep axis of a sorted object
+        /// since the last query
+        decimal mMaxMinDecrease;
+
+        /// Largest distance along the sweep axis between the minimum coordinate of a sorted object at
+        /// the last query and the current maximum coordinate of its fat AABB
+        decimal mMaxSortedMinToMax;
+
+        /// Index of the sweep axis (0, 1 or 2)
+        int mSweepAxis;
+
+        /// The fat AABB is the initial AABB inflated by a given percentage of its size.
+        decimal mFatAABBInflatePercentage;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+		/// Pointer to the profiler
+		Profiler* mProfiler;
+
+#endif
+
+        // -------------------- Methods -------------------- //
+
+        /// Return the axis along which the AABB centers are the most spread out
+        int computeSweepAxis() const;
+
+        /// Remove the removed objects from the sorted array and sort it again along the sweep axis
+        void sortObjects();
+
+        /// Return true if the first object has to be before the second one in the sorted array
+        bool isBefore(int32 objectId1, int32 objectId2) const;
+
+        /// Raycast against an object and return false if the raycast has to stop
+        bool raycastObject(int32 objectId, const Ray& ray, decimal& maxFraction, DynamicAABBTreeRaycastCallback& callback) const;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        SweepAndPruneBroadPhase(MemoryAllocator& allocator, decimal fatAABBInflatePercentage);
+
+        /// Destructor
+        virtual ~SweepAndPruneBroadPhase() override = default;
+
+        /// Return the type of the broad-phase data structure
+        virtual BroadPhaseType getType() const override;
+
+        /// Add an object and return its ID
+        virtual int32 addObject(const AABB& aabb, void* data, bool isStatic) override;
+
+        /// Remove an object
+        virtual void removeObject(int32 objectId) override;
+
+        /// Update an object after it has moved and return true if its fat AABB has changed
+        virtual bool updateObject(int32 objectId, const AABB& newAABB, bool forceReinsert, const Vector3& displacement) override;
+
+        /// Return the fat AABB of an object
+        virtual const AABB& getFatAABB(int32 objectId) const override;
+
+        /// Return the data pointer of an object
+        virtual void* getObjectData(int32 objectId) const override;
+
+        /// Prepare the data structure for an overlap query with the objects to test
+        virtual void beginOverlapQuery(const List<int32>& objectsToTest) override;
+
+        /// Return the number of items of an overlap query
+        virtual uint32 getNbOverlapQueryItems(const List<int32>& objectsToTest) const override;
+
+        /// Report the pairs (object to test, other object) of overlapping fat AABBs found by the items [startIndex, endIndex) of the query
+        virtual void reportOverlappingPairs(const List<int32>& objectsToTest, uint32 startIndex, uint32 endIndex,
+                                            List<Pair<int32, int32>>& outOverlappingObjects) const override;
+
+        /// Finish an overlap query with the objects to test
+        virtual void endOverlapQuery(const List<int32>& objectsToTest) override;
+
+        /// Ray casting method
+        virtual void raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const override;
+
+        /// Rebuild the data structure from all its objects to improve the speed of the queries
+        virtual void rebuild() override;
+
+        /// Compute the surface area heuristic (SAH) cost of the data structure
+        virtual decimal computeSAHCost() const override;
+
+        /// Return the number of objects
+        uint32 getNbObjects() const;
+
+        /// Return the index of the current sweep axis
+        int getSweepAxis() const;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+        /// Set the profiler
+        virtual void setProfiler(Profiler* profiler) override;
+
+#endif
+
+};
+
+// Return the type of the broad-phase data structure
+inline BroadPhaseType SweepAndPruneBroadPhase::getType() const {
+    return BroadPhaseType::SWEEP_AND_PRUNE;
+}
+
+// Return the fat AABB of an object
+inline const AABB& SweepAndPruneBroadPhase::getFatAABB(int32 objectId) const {
+    assert(objectId >= 0 && objectId < static_cast<int32>(mProxies.size()));
+    assert(mProxies[objectId].sortedIndex != SweepAndPruneProxy::NULL_SORTED_INDEX);
+    return mProxies[objectId].aabb;
+}
+
+// Return the data pointer of an object
+inline void* SweepAndPruneBroadPhase::getObjectData(int32 objectId) const {
+    assert(objectId >= 0 && objectId < static_cast<int32>(mProxies.size()));
+    assert(mProxies[objectId].sortedIndex != SweepAndPruneProxy::NULL_SORTED_INDEX);
+    return mProxies[objectId].data;
+}
+
+// Return the number of objects
+inline uint32 SweepAndPruneBroadPhase::getNbObjects() const {
+    return mProxies.size() - mFreeProxies.size();
+}
+
+// Return the number of items of an overlap query
+/// Each sorted object is an item of the query (it is compared with the following sorted objects)
+inline uint32 SweepAndPruneBroadPhase::getNbOverlapQueryItems(const List<int32>& objectsToTest) const {
+    return objectsToTest.size() > 0 ? mSortedObjects.size() : 0;
+}
+
+// Return the index of the current sweep axis
+inline int SweepAndPruneBroadPhase::getSweepAxis() const {
+    return mSweepAxis;
+}
+
+// Return true if the first object has to be before the second one in the sorted array
+inline bool SweepAndPruneBroadPhase::isBefore(int32 objectId1, int32 objectId2) const {
+
+    const decimal min1 = mProxies[objectId1].aabb.getMin()[mSweepAxis];
+    const decimal min2 = mProxies[objectId2].aabb.getMin()[mSweepAxis];
+
+    // The IDs are used to break the ties so that the order does not depend on the previous order
+    return min1 < min2 || (min1 == min2 && objectId1 < objectId2);
+}
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+// Set the profiler
+inline void SweepAndPruneBroadPhase::setProfiler(Profiler* profiler) {
+    mProfiler = profiler;
+}
+
+#endif
+
+}
+
+#endif
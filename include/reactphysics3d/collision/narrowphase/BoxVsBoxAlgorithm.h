@@ -0,0 +1,110 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_BOX_VS_BOX_ALGORITHM_H
+#define	REACTPHYSICS3D_BOX_VS_BOX_ALGORITHM_H
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseAlgorithm.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+struct BoxVsBoxNarrowPhaseInfoBatch;
+class Vector3;
+class Matrix3x3;
+class Transform;
+
+// Class BoxVsBoxAlgorithm
+/**
+ * This class is used to compute the narrow-phase collision detection
+ * between two box collision shapes. Instead of running the generic SAT algorithm
+ * on the half-edge structures of the boxes, we directly test the 15 candidate
+ * separating axes of two boxes (the three face normals of each box and the nine
+ * cross products of their edges directions) in the local-space of the first box.
+ * The contact points of a face contact are computed by clipping the incident
+ * face of a box against the side planes of the reference face of the other box.
+ * This is similar to the box-box collision detector of ODE and Bullet. The axis
+ * of minimum penetration is cached in the last frame collision info of the pair
+ * for temporal coherence.
+ */
+class BoxVsBoxAlgorithm : public NarrowPhaseAlgorithm {
+
+    protected :
+
+        // -------------------- Constants -------------------- //
+
+        /// Number of candidate separating axes of two boxes
+        static const uint8 NB_SEPARATING_AXES = 15;
+
+        /// Relative and absolute bias used to make sure the algorithm prefers the axis
+        /// of the first box and prefers face contacts over edge contacts when two penetration
+        /// depths are almost the same (same values as in the SAT algorithm)
+        static const decimal SEPARATING_AXIS_RELATIVE_TOLERANCE;
+        static const decimal SEPARATING_AXIS_ABSOLUTE_TOLERANCE;
+
+        // -------------------- Methods -------------------- //
+
+        /// Compute the penetration depth of the two boxes along a candidate separating axis
+        decimal computePenetrationDepth(uint8 axisIndex, const Vector3& halfExtents1, const Vector3& halfExtents2,
+                                        const Matrix3x3& box2Rotation, const Matrix3x3& box2AbsoluteRotation,
+                                        const Vector3& box2Position, Vector3& outAxis) const;
+
+        /// Compute the contact points between a reference face of a box and the incident face of the other box
+        bool computeFaceContactPoints(uint8 axisIndex, const Vector3& halfExtents1, const Vector3& halfExtents2,
+                                      const Transform& box2ToBox1, const Transform& box1ToBox2,
+                                      BoxVsBoxNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchIndex) const;
+
+        /// Compute the contact point between an edge of the first box and an edge of the second box
+        void computeEdgeContactPoint(uint8 axisIndex, decimal penetrationDepth, const Vector3& axis,
+                                     const Vector3& halfExtents1, const Vector3& halfExtents2,
+                                     const Transform& box2ToBox1, const Transform& box1ToBox2,
+                                     BoxVsBoxNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchIndex) const;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        BoxVsBoxAlgorithm() = default;
+
+        /// Destructor
+        virtual ~BoxVsBoxAlgorithm() override = default;
+
+        /// Deleted copy-constructor
+        BoxVsBoxAlgorithm(const BoxVsBoxAlgorithm& algorithm) = delete;
+
+        /// Deleted assignment operator
+        BoxVsBoxAlgorithm& operator=(const BoxVsBoxAlgorithm& algorithm) = delete;
+
+        /// Compute the narrow-phase collision detection between two boxes
+        bool testCollision(BoxVsBoxNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchStartIndex, uint batchNbItems,
+                           bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& memoryAllocator);
+};
+
+}
+
+#endif
@@ -44,11 +44,19 @@ class ContactPoint;
  * algorithm here. We directly compute the contact points and contact normal.
  * This is based on the "Robust Contact Creation for Physics Simulation"
  * presentation by Dirk Gregorius.
+ * The pairs of a batch are first tested for overlap SIMD_DECIMAL_NB_LANES at a
+ * time with SIMD instructions and the contacts are only computed for the pairs
+ * that may overlap.
  */
 class CapsuleVsCapsuleAlgorithm : public NarrowPhaseAlgorithm {
 
     protected :
 
+        // -------------------- Methods -------------------- //
+
+        /// Compute the narrow-phase collision detection of a single pair of capsules of the batch
+        bool testCollisionPair(CapsuleVsCapsuleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchIndex);
+
     public :
 
         // -------------------- Methods -------------------- //
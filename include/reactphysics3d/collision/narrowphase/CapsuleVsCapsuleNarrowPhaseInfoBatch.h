@@ -54,6 +54,46 @@ struct CapsuleVsCapsuleNarrowPhaseInfoBatch : public NarrowPhaseInfoBatch {
         /// List of heights for the second capsules
         List<decimal> capsule2Heights;
 
+        // The centers and the directions of the inner segments of the capsules are also stored as
+        // a structure of arrays so that the overlap tests of several pairs can be computed at once
+        // with SIMD instructions
+
+        /// World-space x coordinates of the centers of the first capsules
+        List<decimal> capsule1CentersX;
+
+        /// World-space y coordinates of the centers of the first capsules
+        List<decimal> capsule1CentersY;
+
+        /// World-space z coordinates of the centers of the first capsules
+        List<decimal> capsule1CentersZ;
+
+        /// World-space x coordinates of the unit directions of the inner segments of the first capsules
+        List<decimal> capsule1AxesX;
+
+        /// World-space y coordinates of the unit directions of the inner segments of the first capsules
+        List<decimal> capsule1AxesY;
+
+        /// World-space z coordinates of the unit directions of the inner segments of the first capsules
+        List<decimal> capsule1AxesZ;
+
+        /// World-space x coordinates of the centers of the second capsules
+        List<decimal> capsule2CentersX;
+
+        /// World-space y coordinates of the centers of the second capsules
+        List<decimal> capsule2CentersY;
+
+        /// World-space z coordinates of the centers of the second capsules
+        List<decimal> capsule2CentersZ;
+
+        /// World-space x coordinates of the unit directions of the inner segments of the second capsules
+        List<decimal> capsule2AxesX;
+
+        /// World-space y coordinates of the unit directions of the inner segments of the second capsules
+        List<decimal> capsule2AxesY;
+
+        /// World-space z coordinates of the unit directions of the inner segments of the second capsules
+        List<decimal> capsule2AxesZ;
+
         /// Constructor
         CapsuleVsCapsuleNarrowPhaseInfoBatch(MemoryAllocator& allocator, OverlappingPairs& overlappingPairs);
 
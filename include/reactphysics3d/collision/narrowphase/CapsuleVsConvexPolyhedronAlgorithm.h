@@ -34,6 +34,7 @@ namespace reactphysics3d {
 
 // Declarations
 class ContactPoint;
+struct NarrowPhaseStatistics;
 
 // Class CapsuleVsConvexPolyhedronAlgorithm
 /**
@@ -71,7 +72,7 @@ class CapsuleVsConvexPolyhedronAlgorithm : public NarrowPhaseAlgorithm {
         /// Compute the narrow-phase collision detection between a capsule and a polyhedron
         bool testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchStartIndex,
                            uint batchNbItems, bool clipWithPreviousAxisIfStillColliding,
-                           MemoryAllocator& memoryAllocator);
+                           MemoryAllocator& memoryAllocator, NarrowPhaseStatistics& statistics);
 };
 
 }
@@ -39,6 +39,8 @@ struct NarrowPhaseInfoBatch;
 class ConvexShape;
 class Profiler;
 class VoronoiSimplex;
+struct Vector3;
+struct NarrowPhaseStatistics;
 template<typename T> class List;
 
 // Constants
@@ -74,6 +76,12 @@ class GJKAlgorithm {
 
         // -------------------- Methods -------------------- //
 
+        /// Return a local support point of a shape (without margin) in a given direction
+        static Vector3 computeSupportPoint(const ConvexShape* shape, const Vector3& direction, uint& supportVertexIndex);
+
+        /// Return the radius of a sphere centered at the origin of the local-space of a shape that contains the shape
+        static decimal computeBoundingRadius(const ConvexShape* shape);
+
     public :
 
         enum class GJKResult {
@@ -98,7 +106,7 @@ class GJKAlgorithm {
 
         /// Compute a contact info if the two bounding volumes collide.
         void testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchStartIndex,
-                           uint batchNbItems, List<GJKResult>& gjkResults);
+                           uint batchNbItems, List<GJKResult>& gjkResults, NarrowPhaseStatistics& statistics);
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -90,6 +90,10 @@ struct NarrowPhaseInfoBatch {
         /// List of contact points created during the narrow-phase
         List<List<ContactPointInfo*>> contactPoints;
 
+        /// Memory allocators of the contact points of each item (the contact points of the items
+        /// tested by a task of the parallel narrow-phase are allocated by the thread of the task)
+        List<MemoryAllocator*> contactPointsAllocators;
+
         /// Memory allocators for the collision shape (Used to release TriangleShape memory in destructor)
         List<MemoryAllocator*> collisionShapeAllocators;
 
@@ -117,6 +121,9 @@ struct NarrowPhaseInfoBatch {
         /// Reset the remaining contact points
         void resetContactPoints(uint index);
 
+        /// Set the memory allocator of the contact points of the items in a range of the batch
+        void setContactPointsAllocator(uint startIndex, uint endIndex, MemoryAllocator& allocator);
+
         // Initialize the containers using cached capacity
         virtual void reserveMemory();
 
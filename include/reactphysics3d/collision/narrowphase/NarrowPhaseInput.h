@@ -32,6 +32,7 @@
 #include <reactphysics3d/collision/narrowphase/SphereVsSphereNarrowPhaseInfoBatch.h>
 #include <reactphysics3d/collision/narrowphase/CapsuleVsCapsuleNarrowPhaseInfoBatch.h>
 #include <reactphysics3d/collision/narrowphase/SphereVsCapsuleNarrowPhaseInfoBatch.h>
+#include <reactphysics3d/collision/narrowphase/BoxVsBoxNarrowPhaseInfoBatch.h>
 
 /// Namespace ReactPhysics3D
 namespace reactphysics3d {
@@ -61,6 +62,11 @@ class NarrowPhaseInput {
         NarrowPhaseInfoBatch mSphereVsConvexPolyhedronBatch;
         NarrowPhaseInfoBatch mCapsuleVsConvexPolyhedronBatch;
         NarrowPhaseInfoBatch mConvexPolyhedronVsConvexPolyhedronBatch;
+        BoxVsBoxNarrowPhaseInfoBatch mBoxVsBoxBatch;
+
+        /// Batch of the overlapping pairs at rest whose contacts of the previous frame are reused. The
+        /// items of this batch are not tested by a narrow-phase algorithm, their contacts are added directly
+        NarrowPhaseInfoBatch mRestingPairsBatch;
 
     public:
 
@@ -91,6 +97,12 @@ class NarrowPhaseInput {
         /// Get a reference to the convex polyhedron vs convex polyhedron batch
         NarrowPhaseInfoBatch& getConvexPolyhedronVsConvexPolyhedronBatch();
 
+        /// Get a reference to the box vs box batch
+        BoxVsBoxNarrowPhaseInfoBatch& getBoxVsBoxBatch();
+
+        /// Get a reference to the batch of the pairs at rest
+        NarrowPhaseInfoBatch& getRestingPairsBatch();
+
         /// Reserve memory for the containers with cached capacity
         void reserveMemory();
 
@@ -129,5 +141,15 @@ inline NarrowPhaseInfoBatch& NarrowPhaseInput::getConvexPolyhedronVsConvexPolyhe
    return mConvexPolyhedronVsConvexPolyhedronBatch;
 }
 
+// Get a reference to the box vs box batch contacts
+inline BoxVsBoxNarrowPhaseInfoBatch& NarrowPhaseInput::getBoxVsBoxBatch() {
+   return mBoxVsBoxBatch;
+}
+
+// Get a reference to the batch of the pairs at rest
+inline NarrowPhaseInfoBatch& NarrowPhaseInput::getRestingPairsBatch() {
+   return mRestingPairsBatch;
+}
+
 }
 #endif
@@ -0,0 +1,110 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_NARROW_PHASE_STATISTICS_H
+#define REACTPHYSICS3D_NARROW_PHASE_STATISTICS_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Structure NarrowPhaseStatistics
+/**
+ * This structure contains the number of narrow-phase tests of the pairs of shapes
+ * during the last update of the physics world and the number of those tests that
+ * have used the temporal coherence data of the previous frames to do less work.
+ * It also contains the number of overlapping pairs at rest whose contacts have been
+ * reused instead of being computed by the narrow-phase.
+ * It is returned by PhysicsWorld::getNarrowPhaseStatistics().
+ */
+struct NarrowPhaseStatistics {
+
+    // -------------------- Attributes -------------------- //
+
+    /// Number of pairs of shapes tested with the GJK algorithm (including the skipped tests)
+    uint32 nbGJKTests;
+
+    /// Number of GJK tests that have been skipped because the shapes cannot have moved
+    /// enough since the previous test to close the gap that was separating them
+    uint32 nbGJKSkippedTests;
+
+    /// Number of GJK tests that have started from the simplex of the previous test
+    uint32 nbGJKWarmStartedTests;
+
+    /// Number of active overlapping pairs of colliders whose contacts have been computed
+    /// (including the pairs whose narrow-phase has been skipped)
+    uint32 nbOverlappingPairsTests;
+
+    /// Number of overlapping pairs at rest whose contacts of the previous frame have been
+    /// reused because the relative transform of their colliders has almost not changed
+    uint32 nbRestingPairsSkippedTests;
+
+    // -------------------- Methods -------------------- //
+
+    /// Constructor
+    NarrowPhaseStatistics() {
+        reset();
+    }
+
+    /// Set all the numbers of tests to zero
+    void reset() {
+        nbGJKTests = 0;
+        nbGJKSkippedTests = 0;
+        nbGJKWarmStartedTests = 0;
+        nbOverlappingPairsTests = 0;
+        nbRestingPairsSkippedTests = 0;
+    }
+
+    /// Return the ratio of the GJK tests that have been skipped
+    decimal getGJKSkipRate() const {
+        return nbGJKTests > 0 ? decimal(nbGJKSkippedTests) / decimal(nbGJKTests) : decimal(0.0);
+    }
+
+    /// Return the ratio of the GJK tests that have started from the simplex of the previous test
+    decimal getGJKWarmStartRate() const {
+        return nbGJKTests > 0 ? decimal(nbGJKWarmStartedTests) / decimal(nbGJKTests) : decimal(0.0);
+    }
+
+    /// Return the ratio of the overlapping pairs whose narrow-phase has been skipped because they are at rest
+    decimal getRestingPairsSkipRate() const {
+        return nbOverlappingPairsTests > 0 ? decimal(nbRestingPairsSkippedTests) / decimal(nbOverlappingPairsTests) : decimal(0.0);
+    }
+
+    /// Overloaded operator to add the numbers of tests of other statistics
+    NarrowPhaseStatistics& operator+=(const NarrowPhaseStatistics& statistics) {
+        nbGJKTests += statistics.nbGJKTests;
+        nbGJKSkippedTests += statistics.nbGJKSkippedTests;
+        nbGJKWarmStartedTests += statistics.nbGJKWarmStartedTests;
+        nbOverlappingPairsTests += statistics.nbOverlappingPairsTests;
+        nbRestingPairsSkippedTests += statistics.nbRestingPairsSkippedTests;
+        return *this;
+    }
+};
+
+}
+
+#endif
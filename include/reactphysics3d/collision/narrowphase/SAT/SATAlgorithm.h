@@ -39,6 +39,7 @@ class SphereShape;
 class ContactManifoldInfo;
 struct NarrowPhaseInfoBatch;
 class ConvexPolyhedronShape;
+class ConvexPolyhedronArrays;
 class MemoryAllocator;
 class Profiler;
 
@@ -114,6 +115,19 @@ class SATAlgorithm {
         decimal testFacesDirectionPolyhedronVsPolyhedron(const ConvexPolyhedronShape* polyhedron1, const ConvexPolyhedronShape* polyhedron2,
                                                         const Transform& polyhedron1ToPolyhedron2, uint& minFaceIndex) const;
 
+        /// Test all the normals of a polyhedron for separating axis with SIMD instructions in the polyhedron vs polyhedron case
+        decimal testFacesDirectionPolyhedronVsPolyhedronSimd(const ConvexPolyhedronArrays& polyhedron1Arrays, const Vector3& polyhedron1Scale,
+                                                             const ConvexPolyhedronShape* polyhedron2,
+                                                             const Transform& polyhedron1ToPolyhedron2, uint& minFaceIndex) const;
+
+        /// Test an edge of the first polyhedron against SIMD_DECIMAL_NB_LANES edges of the second polyhedron with SIMD instructions
+        void testEdgesPolyhedronVsPolyhedronSimd(const Vector3& a, const Vector3& b, const Vector3& bCrossA,
+                                                 const Vector3& edge1A, const Vector3& edge1Direction,
+                                                 const Vector3& polyhedron1Centroid, const Vector3& polyhedron2Centroid,
+                                                 bool isShape1Triangle, const ConvexPolyhedronArrays& polyhedron2Arrays,
+                                                 const Vector3& polyhedron2Scale, uint firstEdgeIndex,
+                                                 bool* outIsMinkowskiFace, decimal* outPenetrationDepths) const;
+
         /// Compute the penetration depth between a face of the polyhedron and a sphere along the polyhedron face normal direction
         decimal computePolyhedronFaceVsSpherePenetrationDepth(uint faceIndex, const ConvexPolyhedronShape* polyhedron,
                                                               const SphereShape* sphere, const Vector3& sphereCenter) const;
@@ -43,11 +43,19 @@ struct SphereVsCapsuleNarrowPhaseInfoBatch;
  * For this case, we do not use GJK or SAT algorithm. We directly compute the
  * contact points and contact normal. This is based on the "Robust Contact
  * Creation for Physics Simulation" presentation by Dirk Gregorius.
+ * The pairs of a batch are first tested for overlap SIMD_DECIMAL_NB_LANES at a
+ * time with SIMD instructions and the contacts are only computed for the pairs
+ * that may overlap.
  */
 class SphereVsCapsuleAlgorithm : public NarrowPhaseAlgorithm {
 
     protected :
 
+        // -------------------- Methods -------------------- //
+
+        /// Compute the narrow-phase collision detection of a single pair made of a sphere and a capsule of the batch
+        bool testCollisionPair(SphereVsCapsuleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchIndex);
+
     public :
 
         // -------------------- Methods -------------------- //
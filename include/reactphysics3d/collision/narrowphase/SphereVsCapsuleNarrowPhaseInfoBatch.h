@@ -54,6 +54,37 @@ struct SphereVsCapsuleNarrowPhaseInfoBatch : public NarrowPhaseInfoBatch {
         /// List of heights for the capsules
         List<decimal> capsuleHeights;
 
+        // The centers of the shapes and the directions of the inner segments of the capsules are
+        // also stored as a structure of arrays so that the overlap tests of several pairs can be
+        // computed at once with SIMD instructions
+
+        /// World-space x coordinates of the centers of the spheres
+        List<decimal> sphereCentersX;
+
+        /// World-space y coordinates of the centers of the spheres
+        List<decimal> sphereCentersY;
+
+        /// World-space z coordinates of the centers of the spheres
+        List<decimal> sphereCentersZ;
+
+        /// World-space x coordinates of the centers of the capsules
+        List<decimal> capsuleCentersX;
+
+        /// World-space y coordinates of the centers of the capsules
+        List<decimal> capsuleCentersY;
+
+        /// World-space z coordinates of the centers of the capsules
+        List<decimal> capsuleCentersZ;
+
+        /// World-space x coordinates of the unit directions of the inner segments of the capsules
+        List<decimal> capsuleAxesX;
+
+        /// World-space y coordinates of the unit directions of the inner segments of the capsules
+        List<decimal> capsuleAxesY;
+
+        /// World-space z coordinates of the unit directions of the inner segments of the capsules
+        List<decimal> capsuleAxesZ;
+
         /// Constructor
         SphereVsCapsuleNarrowPhaseInfoBatch(MemoryAllocator& allocator, OverlappingPairs& overlappingPairs);
 
@@ -34,6 +34,7 @@ namespace reactphysics3d {
 
 // Declarations
 class ContactPoint;
+struct NarrowPhaseStatistics;
 
 // Class SphereVsConvexPolyhedronAlgorithm
 /**
@@ -71,7 +72,8 @@ class SphereVsConvexPolyhedronAlgorithm : public NarrowPhaseAlgorithm {
 
         /// Compute the narrow-phase collision detection between a sphere and a convex polyhedron
         bool testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchStartIndex, uint batchNbItems,
-                           bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& memoryAllocator);
+                           bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& memoryAllocator,
+                           NarrowPhaseStatistics& statistics);
 };
 
 }
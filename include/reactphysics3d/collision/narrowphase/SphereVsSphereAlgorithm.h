@@ -43,11 +43,19 @@ struct SphereVsSphereNarrowPhaseInfoBatch;
  * point and contact normal between two spheres if they are colliding.
  * This case is simple, we do not need to use GJK or SAT algorithm. We
  * directly compute the contact points if any.
+ * The pairs of a batch are first tested for overlap SIMD_DECIMAL_NB_LANES at a
+ * time with SIMD instructions and the contacts are only computed for the pairs
+ * that may overlap.
  */
 class SphereVsSphereAlgorithm : public NarrowPhaseAlgorithm {
 
     protected :
 
+        // -------------------- Methods -------------------- //
+
+        /// Compute the narrow-phase collision detection of a single pair of spheres of the batch
+        bool testCollisionPair(SphereVsSphereNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchIndex);
+
     public :
 
         // -------------------- Methods -------------------- //
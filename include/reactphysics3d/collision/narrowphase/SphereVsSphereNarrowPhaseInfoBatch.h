@@ -48,6 +48,27 @@ struct SphereVsSphereNarrowPhaseInfoBatch : public NarrowPhaseInfoBatch {
         /// List of radiuses for the second spheres
         List<decimal> sphere2Radiuses;
 
+        // The centers of the spheres are also stored as a structure of arrays so that the
+        // overlap tests of several pairs can be computed at once with SIMD instructions
+
+        /// World-space x coordinates of the centers of the first spheres
+        List<decimal> sphere1CentersX;
+
+        /// World-space y coordinates of the centers of the first spheres
+        List<decimal> sphere1CentersY;
+
+        /// World-space z coordinates of the centers of the first spheres
+        List<decimal> sphere1CentersZ;
+
+        /// World-space x coordinates of the centers of the second spheres
+        List<decimal> sphere2CentersX;
+
+        /// World-space y coordinates of the centers of the second spheres
+        List<decimal> sphere2CentersY;
+
+        /// World-space z coordinates of the centers of the second spheres
+        List<decimal> sphere2CentersZ;
+
         /// Constructor
         SphereVsSphereNarrowPhaseInfoBatch(MemoryAllocator& allocator, OverlappingPairs& overlappingPairs);
 
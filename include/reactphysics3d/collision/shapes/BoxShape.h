@@ -28,6 +28,7 @@
 
 // Libraries
 #include <reactphysics3d/collision/shapes/ConvexPolyhedronShape.h>
+#include <reactphysics3d/collision/ConvexPolyhedronArrays.h>
 #include <reactphysics3d/mathematics/mathematics.h>
 
 /// ReactPhysics3D namespace
@@ -56,6 +57,9 @@ class BoxShape : public ConvexPolyhedronShape {
         /// Half-edge structure of the polyhedron
         HalfEdgeStructure mHalfEdgeStructure;
 
+        /// Faces and edges of the box with half-extents of one (scaled by the half-extents when used)
+        ConvexPolyhedronArrays mPolyhedronArrays;
+
         // -------------------- Methods -------------------- //
 
         /// Constructor
@@ -64,6 +68,10 @@ class BoxShape : public ConvexPolyhedronShape {
         /// Return a local support point in a given direction without the object margin
         virtual Vector3 getLocalSupportPointWithoutMargin(const Vector3& direction) const override;
 
+        /// Compute the local support points without margin in several directions
+        virtual void getLocalSupportPointsWithoutMargin(const decimal* directions, uint nbDirections,
+                                                        decimal* outSupportPoints) const override;
+
         /// Return true if a point is inside the collision shape
         virtual bool testPointInside(const Vector3& localPoint, Collider* collider) const override;
 
@@ -128,6 +136,9 @@ class BoxShape : public ConvexPolyhedronShape {
         /// Return the centroid of the polyhedron
         virtual Vector3 getCentroid() const override;
 
+        /// Return the arrays of faces and edges used to test the polyhedron with SIMD instructions
+        virtual const ConvexPolyhedronArrays* getPolyhedronArrays(Vector3& outVerticesScale) const override;
+
         /// Return the string representation of the shape
         virtual std::string to_string() const override;
 
@@ -256,6 +267,16 @@ inline Vector3 BoxShape::getCentroid() const {
     return Vector3::zero();
 }
 
+// Return the arrays of faces and edges used to test the polyhedron with SIMD instructions
+/**
+ * @param[out] outVerticesScale Scale to apply to the vertices of the arrays (the half-extents of the box)
+ * @return A pointer to the arrays of the box
+ */
+inline const ConvexPolyhedronArrays* BoxShape::getPolyhedronArrays(Vector3& outVerticesScale) const {
+    outVerticesScale = mHalfExtents;
+    return &mPolyhedronArrays;
+}
+
 // Compute and return the volume of the collision shape
 inline decimal BoxShape::getVolume() const {
     return 8 * mHalfExtents.x * mHalfExtents.y * mHalfExtents.z;
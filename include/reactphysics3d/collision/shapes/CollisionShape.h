@@ -194,8 +194,16 @@ inline void CollisionShape::addCollider(Collider* collider) {
 }
 
 // Remove an assigned collider from the collision shape
+/// The colliders are usually removed in the reverse order of their creation (when
+/// a world is destroyed for instance) and are therefore searched from the end of the list
 inline void CollisionShape::removeCollider(Collider* collider) {
-    mColliders.remove(collider);
+    for (uint32 i=mColliders.size(); i > 0; i--) {
+        if (mColliders[i - 1] == collider) {
+            mColliders.removeAt(i - 1);
+            return;
+        }
+    }
+    assert(false);
 }
 
 #ifdef IS_RP3D_PROFILING_ENABLED
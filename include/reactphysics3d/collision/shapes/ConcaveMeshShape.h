@@ -29,6 +29,7 @@
 // Libraries
 #include <reactphysics3d/collision/shapes/ConcaveShape.h>
 #include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/collision/broadphase/StaticAABBTree.h>
 #include <reactphysics3d/containers/List.h>
 
 namespace reactphysics3d {
@@ -39,45 +40,14 @@ class Profiler;
 class TriangleShape;
 class TriangleMesh;
 
-// class ConvexTriangleAABBOverlapCallback
-class ConvexTriangleAABBOverlapCallback : public DynamicAABBTreeOverlapCallback {
-
-    private:
-
-        TriangleCallback& mTriangleTestCallback;
-
-        // Reference to the concave mesh shape
-        const ConcaveMeshShape& mConcaveMeshShape;
-
-        // Reference to the Dynamic AABB tree
-        const DynamicAABBTree& mDynamicAABBTree;
-
-    public:
-
-        // Constructor
-        ConvexTriangleAABBOverlapCallback(TriangleCallback& triangleCallback, const ConcaveMeshShape& concaveShape,
-                                          const DynamicAABBTree& dynamicAABBTree)
-          : mTriangleTestCallback(triangleCallback), mConcaveMeshShape(concaveShape), mDynamicAABBTree(dynamicAABBTree) {
-
-        }
-
-        // Called when a overlapping node has been found during the call to
-        // DynamicAABBTree:reportAllShapesOverlappingWithAABB()
-        virtual void notifyOverlappingNode(int nodeId) override;
-
-};
-
 /// Class ConcaveMeshRaycastCallback
 class ConcaveMeshRaycastCallback : public DynamicAABBTreeRaycastCallback {
 
     private :
 
-        List<int32> mHitAABBNodes;
-        const DynamicAABBTree& mDynamicAABBTree;
         const ConcaveMeshShape& mConcaveMeshShape;
         Collider* mCollider;
         RaycastInfo& mRaycastInfo;
-        const Ray& mRay;
         bool mIsHit;
         MemoryAllocator& mAllocator;
         const Vector3& mMeshScale;
@@ -92,18 +62,15 @@ class ConcaveMeshRaycastCallback : public DynamicAABBTreeRaycastCallback {
     public:
 
         // Constructor
-        ConcaveMeshRaycastCallback(const DynamicAABBTree& dynamicAABBTree, const ConcaveMeshShape& concaveMeshShape,
-                                   Collider* collider, RaycastInfo& raycastInfo, const Ray& ray, const Vector3& meshScale, MemoryAllocator& allocator)
-            : mHitAABBNodes(allocator), mDynamicAABBTree(dynamicAABBTree), mConcaveMeshShape(concaveMeshShape), mCollider(collider),
-              mRaycastInfo(raycastInfo), mRay(ray), mIsHit(false), mAllocator(allocator), mMeshScale(meshScale) {
+        ConcaveMeshRaycastCallback(const ConcaveMeshShape& concaveMeshShape, Collider* collider, RaycastInfo& raycastInfo,
+                                   const Vector3& meshScale, MemoryAllocator& allocator)
+            : mConcaveMeshShape(concaveMeshShape), mCollider(collider), mRaycastInfo(raycastInfo), mIsHit(false),
+              mAllocator(allocator), mMeshScale(meshScale) {
 
         }
 
-        /// Collect all the AABB nodes that are hit by the ray in the Dynamic AABB Tree
-        virtual decimal raycastBroadPhaseShape(int32 nodeId, const Ray& ray) override;
-
-        /// Raycast all collision shapes that have been collected
-        void raycastTriangles();
+        /// Raycast the triangle of a leaf of the AABB tree hit by the ray
+        virtual decimal raycastBroadPhaseShape(int32 triangleId, const Ray& ray) override;
 
         /// Return true if a raycast hit has been found
         bool getIsHit() const {
@@ -135,8 +102,12 @@ class ConcaveMeshShape : public ConcaveShape {
         /// Pointer to the triangle mesh
         TriangleMesh* mTriangleMesh;
 
-        /// Dynamic AABB tree to accelerate collision with the triangles
-        DynamicAABBTree mDynamicAABBTree;
+        /// Static AABB tree to accelerate collision with the triangles (the object index of a
+        /// triangle in the tree is its triangle ID)
+        StaticAABBTree mAABBTree;
+
+        /// For each sub part of the mesh, ID of its first triangle (with an extra ID at the end)
+        List<uint> mSubpartsFirstTriangleIds;
 
         /// Array with computed vertices normals for each TriangleVertexArray of the triangle mesh (only
         /// if the user did not provide its own vertices normals)
@@ -153,8 +124,8 @@ class ConcaveMeshShape : public ConcaveShape {
         /// Return the number of bytes used by the collision shape
         virtual size_t getSizeInBytes() const override;
 
-        /// Insert all the triangles into the dynamic AABB tree
-        void initBVHTree();
+        /// Build the AABB tree with all the triangles of the mesh
+        void initBVHTree(MemoryAllocator& allocator);
 
         /// Return the three vertices coordinates (in the list outTriangleVertices) of a triangle
         void getTriangleVertices(uint subPart, uint triangleIndex, Vector3* outTriangleVertices) const;
@@ -165,6 +136,9 @@ class ConcaveMeshShape : public ConcaveShape {
         /// Compute the shape Id for a given triangle of the mesh
         uint computeTriangleShapeId(uint subPart, uint triangleIndex) const;
 
+        /// Return the sub part and the index in the sub part of the triangle with a given ID
+        void getTriangleSubpartAndIndex(uint triangleId, uint& outSubPart, uint& outTriangleIndex) const;
+
         /// Compute all the triangles of the mesh that are overlapping with the AABB in parameter
         virtual void computeOverlappingTriangles(const AABB& localAABB, List<Vector3>& triangleVertices,
                                                  List<Vector3> &triangleVerticesNormals, List<uint>& shapeIds,
@@ -205,7 +179,6 @@ class ConcaveMeshShape : public ConcaveShape {
 
         // ---------- Friendship ----------- //
 
-        friend class ConvexTriangleAABBOverlapCallback;
         friend class ConcaveMeshRaycastCallback;
         friend class PhysicsCommon;
         friend class DebugRenderer;
@@ -225,29 +198,15 @@ inline size_t ConcaveMeshShape::getSizeInBytes() const {
 inline void ConcaveMeshShape::getLocalBounds(Vector3& min, Vector3& max) const {
 
     // Get the AABB of the whole tree
-    AABB treeAABB = mDynamicAABBTree.getRootAABB();
+    const AABB& treeAABB = mAABBTree.getRootAABB();
 
     min = treeAABB.getMin();
     max = treeAABB.getMax();
 }
 
-// Called when a overlapping node has been found during the call to
-// DynamicAABBTree:reportAllShapesOverlappingWithAABB()
-inline void ConvexTriangleAABBOverlapCallback::notifyOverlappingNode(int nodeId) {
-
-    // Get the node data (triangle index and mesh subpart index)
-    int32* data = mDynamicAABBTree.getNodeDataInt(nodeId);
-
-    // Get the triangle vertices for this node from the concave mesh shape
-    Vector3 trianglePoints[3];
-    mConcaveMeshShape.getTriangleVertices(data[0], data[1], trianglePoints);
-
-    // Get the vertices normals of the triangle
-    Vector3 verticesNormals[3];
-    mConcaveMeshShape.getTriangleVerticesNormals(data[0], data[1], verticesNormals);
-
-    // Call the callback to test narrow-phase collision with this triangle
-    mTriangleTestCallback.testTriangle(trianglePoints, verticesNormals, mConcaveMeshShape.computeTriangleShapeId(data[0], data[1]));
+// Compute the shape Id for a given triangle of the mesh
+inline uint ConcaveMeshShape::computeTriangleShapeId(uint subPart, uint triangleIndex) const {
+    return mSubpartsFirstTriangleIds[subPart] + triangleIndex;
 }
 
 #ifdef IS_RP3D_PROFILING_ENABLED
@@ -257,7 +216,7 @@ inline void ConcaveMeshShape::setProfiler(Profiler* profiler) {
 
     CollisionShape::setProfiler(profiler);
 
-    mDynamicAABBTree.setProfiler(profiler);
+    mAABBTree.setProfiler(profiler);
 }
 
 
@@ -74,6 +74,10 @@ class ConvexMeshShape : public ConvexPolyhedronShape {
         /// Return a local support point in a given direction without the object margin.
         virtual Vector3 getLocalSupportPointWithoutMargin(const Vector3& direction) const override;
 
+        /// Compute the local support points without margin in several directions
+        virtual void getLocalSupportPointsWithoutMargin(const decimal* directions, uint nbDirections,
+                                                        decimal* outSupportPoints) const override;
+
         /// Return true if a point is inside the collision shape
         virtual bool testPointInside(const Vector3& localPoint, Collider* collider) const override;
 
@@ -135,6 +139,12 @@ class ConvexMeshShape : public ConvexPolyhedronShape {
         /// Return the centroid of the polyhedron
         virtual Vector3 getCentroid() const override;
 
+        /// Return the arrays of faces and edges used to test the polyhedron with SIMD instructions
+        virtual const ConvexPolyhedronArrays* getPolyhedronArrays(Vector3& outVerticesScale) const override;
+
+        /// Return the index of the support vertex in a given direction starting the search from a given vertex
+        uint getSupportVertexIndex(const Vector3& direction, uint startVertexIndex) const;
+
         /// Compute and return the volume of the collision shape
         virtual decimal getVolume() const override;
 
@@ -241,6 +251,16 @@ inline Vector3 ConvexMeshShape::getCentroid() const {
     return mPolyhedronMesh->getCentroid() * mScale;
 }
 
+// Return the arrays of faces and edges used to test the polyhedron with SIMD instructions
+/**
+ * @param[out] outVerticesScale Scale to apply to the vertices of the arrays (the scale of the mesh)
+ * @return A pointer to the arrays of the mesh
+ */
+inline const ConvexPolyhedronArrays* ConvexMeshShape::getPolyhedronArrays(Vector3& outVerticesScale) const {
+    outVerticesScale = mScale;
+    return &(mPolyhedronMesh->getPolyhedronArrays());
+}
+
 
 // Compute and return the volume of the collision shape
 inline decimal ConvexMeshShape::getVolume() const {
@@ -33,6 +33,9 @@
 /// ReactPhysics3D namespace
 namespace reactphysics3d {
 
+// Declarations
+class ConvexPolyhedronArrays;
+
 // Class ConvexPolyhedronShape
 /**
  * This abstract class represents a convex polyhedron collision shape associated with a
@@ -42,6 +45,12 @@ class ConvexPolyhedronShape : public ConvexShape {
 
     protected :
 
+        // -------------------- Methods -------------------- //
+
+        /// Compute the local support points without margin in several directions
+        virtual void getLocalSupportPointsWithoutMargin(const decimal* directions, uint nbDirections,
+                                                        decimal* outSupportPoints) const;
+
     public :
 
         // -------------------- Methods -------------------- //
@@ -88,9 +97,16 @@ class ConvexPolyhedronShape : public ConvexShape {
         /// Return the centroid of the polyhedron
         virtual Vector3 getCentroid() const=0;
 
+        /// Return the arrays of faces and edges used to test the polyhedron with SIMD instructions
+        virtual const ConvexPolyhedronArrays* getPolyhedronArrays(Vector3& outVerticesScale) const;
+
         /// Find and return the index of the polyhedron face with the most anti-parallel face
         /// normal given a direction vector
         uint findMostAntiParallelFace(const Vector3& direction) const;
+
+        // -------------------- Friendship -------------------- //
+
+        friend class SATAlgorithm;
 };
 
 // Return true if the collision shape is a polyhedron
@@ -98,6 +114,17 @@ inline bool ConvexPolyhedronShape::isPolyhedron() const {
     return true;
 }
 
+// Return the arrays of faces and edges used to test the polyhedron with SIMD instructions
+/// A polyhedron without such arrays (a triangle for instance) returns null and is tested one
+/// face or edge at a time by the SAT algorithm.
+/**
+ * @param[out] outVerticesScale Scale to apply to the vertices of the arrays to get the vertices of the shape
+ * @return A pointer to the arrays of the polyhedron or null if it has none
+ */
+inline const ConvexPolyhedronArrays* ConvexPolyhedronShape::getPolyhedronArrays(Vector3& /*outVerticesScale*/) const {
+    return nullptr;
+}
+
 
 }
 
@@ -29,6 +29,7 @@
 // Libraries
 #include <reactphysics3d/collision/shapes/ConcaveShape.h>
 #include <reactphysics3d/collision/shapes/AABB.h>
+#include <reactphysics3d/containers/List.h>
 
 namespace reactphysics3d {
 
@@ -46,6 +47,9 @@ class TriangleShape;
  * your height field. Note that the HeightFieldShape will be re-centered based on its AABB. It means
  * that for instance, if the minimum height value is -200 and the maximum value is 400, the final
  * minimum height of the field in the simulation will be -300 and the maximum height will be 300.
+ * The minimum and maximum heights of each block of BLOCK_SIZE x BLOCK_SIZE cells are computed
+ * when the shape is created in order to speed up the raycasting. Therefore, the shared height
+ * values must not be modified while the shape is used.
  */
 class HeightFieldShape : public ConcaveShape {
 
@@ -56,6 +60,11 @@ class HeightFieldShape : public ConcaveShape {
 
     protected:
 
+        // -------------------- Constants -------------------- //
+
+        /// Number of cells on each side of a block of the grid with precomputed min/max heights
+        static const int BLOCK_SIZE = 8;
+
         // -------------------- Attributes -------------------- //
 
         /// Number of columns in the grid of the height field
@@ -91,6 +100,18 @@ class HeightFieldShape : public ConcaveShape {
         /// Local AABB of the height field (without scaling)
         AABB mAABB;
 
+        /// Number of blocks of cells along the columns direction of the grid
+        int mNbBlocksColumns;
+
+        /// Number of blocks of cells along the rows direction of the grid
+        int mNbBlocksRows;
+
+        /// Minimum local height (without scaling) of the vertices of each block of cells
+        List<decimal> mBlocksMinHeight;
+
+        /// Maximum local height (without scaling) of the vertices of each block of cells
+        List<decimal> mBlocksMaxHeight;
+
         // -------------------- Methods -------------------- //
 
         /// Constructor
@@ -105,8 +126,20 @@ class HeightFieldShape : public ConcaveShape {
         /// Return the number of bytes used by the collision shape
         virtual size_t getSizeInBytes() const override;
 
-        /// Insert all the triangles into the dynamic AABB tree
-        void initBVHTree();
+        /// Compute the minimum and maximum heights of each block of cells of the grid
+        void computeBlocksMinMaxHeights();
+
+        /// Raycast a triangle of the height field and return true if it is hit
+        bool raycastTriangle(const Vector3& a, const Vector3& b, const Vector3& c, const Ray& ray,
+                             decimal& hitFraction, Vector3& hitNormal) const;
+
+        /// Raycast the two triangles of a cell of the grid and return true if one of them is hit
+        bool raycastCell(int i, int j, const Ray& ray, RaycastInfo& raycastInfo, Collider* collider) const;
+
+        /// Visit the cells of a grid traversed by a 2D segment in the order of the segment
+        template<typename CellCallback>
+        bool walkGridCells(decimal u, decimal v, decimal du, decimal dv, decimal tStart, decimal tEnd,
+                           int cellSize, int iMin, int jMin, int iMax, int jMax, CellCallback& callback) const;
 
         /// Return the three vertices coordinates (in the array outTriangleVertices) of a triangle
         /// given the start vertex index pointer of the triangle.
@@ -161,9 +194,9 @@ class HeightFieldShape : public ConcaveShape {
 
         // ---------- Friendship ----------- //
 
-        friend class ConvexTriangleAABBOverlapCallback;
         friend class ConcaveMeshRaycastCallback;
         friend class PhysicsCommon;
+        friend class MeshCooker;
 };
 
 // Return the number of rows in the height field
@@ -185,6 +185,7 @@ class BallAndSocketJointComponents : public Components {
 
         friend class BroadPhaseSystem;
         friend class SolveBallAndSocketJointSystem;
+        friend class ConstraintSolverSystem;
 };
 
 // Return a pointer to a given joint
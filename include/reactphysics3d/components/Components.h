@@ -30,6 +30,7 @@
 #include <reactphysics3d/configuration.h>
 #include <reactphysics3d/engine/Entity.h>
 #include <reactphysics3d/containers/Map.h>
+#include <reactphysics3d/components/EntityComponentIndexMap.h>
 
 // ReactPhysics3D namespace
 namespace reactphysics3d {
@@ -70,7 +71,7 @@ class Components {
         void* mBuffer;
 
         /// Map an entity to the index of its component in the array
-        Map<Entity, uint32> mMapEntityToComponentIndex;
+        EntityComponentIndexMap mMapEntityToComponentIndex;
 
         /// Index of the first component of a disabled (sleeping or inactive) entity
         /// Disabled components are stored at the end of the components array
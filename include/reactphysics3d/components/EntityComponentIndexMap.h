@@ -0,0 +1,164 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_ENTITY_COMPONENT_INDEX_MAP_H
+#define REACTPHYSICS3D_ENTITY_COMPONENT_INDEX_MAP_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/engine/Entity.h>
+#include <reactphysics3d/containers/Pair.h>
+#include <cassert>
+
+// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Class declarations
+class MemoryAllocator;
+
+// Class EntityComponentIndexMap
+/**
+ * This class maps the entities to the index of their component in the arrays of a
+ * Components class. It is a sparse array indexed by the index part of the entity
+ * (see Entity::getIndex()). Each slot stores the id of the entity that owns it so that
+ * an entity with the same index but another generation is not found. Therefore, finding
+ * the component of an entity is a single array access instead of a hash table lookup.
+ * Because all the entities of the world share the same indices, the array is split into
+ * pages that are only allocated when a component is added for an entity of this page.
+ */
+class EntityComponentIndexMap {
+
+    private:
+
+        /// A slot of the sparse array
+        struct Slot {
+
+            /// Id of the entity that owns the slot
+            uint32 entityId;
+
+            /// Index of the component of the entity or INVALID_INDEX if the slot is empty
+            uint32 componentIndex;
+        };
+
+        // -------------------- Constants -------------------- //
+
+        /// Number of bits of the entity index used to find the slot in a page
+        static const uint32 PAGE_SIZE_BITS = 10;
+
+        /// Number of slots in a page
+        static const uint32 PAGE_SIZE = 1 << PAGE_SIZE_BITS;
+
+        /// Component index of an empty slot
+        static const uint32 INVALID_INDEX = 0xFFFFFFFF;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        /// Array of pointers to the pages (nullptr if the page is not allocated)
+        Slot** mPages;
+
+        /// Number of elements in the array of pages
+        uint32 mNbPages;
+
+        /// Number of entities in the map
+        uint32 mNbEntities;
+
+        // -------------------- Methods -------------------- //
+
+        /// Return the slot of an entity or nullptr if its page is not allocated
+        const Slot* getSlot(Entity entity) const;
+
+        /// Allocate the page of a given entity index if necessary and return it
+        Slot* getOrAllocatePage(uint32 entityIndex);
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        EntityComponentIndexMap(MemoryAllocator& allocator);
+
+        /// Destructor
+        ~EntityComponentIndexMap();
+
+        /// Deleted copy-constructor
+        EntityComponentIndexMap(const EntityComponentIndexMap& map) = delete;
+
+        /// Deleted assignment operator
+        EntityComponentIndexMap& operator=(const EntityComponentIndexMap& map) = delete;
+
+        /// Return true if the map contains a component index for a given entity
+        bool containsKey(Entity entity) const;
+
+        /// Add the component index of an entity (the entity must not be in the map)
+        void add(const Pair<Entity, uint32>& entityComponentIndex);
+
+        /// Remove an entity from the map
+        void remove(Entity entity);
+
+        /// Return the number of entities in the map
+        int size() const;
+
+        /// Return the component index of an entity
+        uint32 operator[](Entity entity) const;
+};
+
+// Return the slot of an entity or nullptr if its page is not allocated
+inline const EntityComponentIndexMap::Slot* EntityComponentIndexMap::getSlot(Entity entity) const {
+
+    const uint32 entityIndex = entity.getIndex();
+    const uint32 pageIndex = entityIndex >> PAGE_SIZE_BITS;
+
+    if (pageIndex >= mNbPages || mPages[pageIndex] == nullptr) return nullptr;
+
+    return mPages[pageIndex] + (entityIndex & (PAGE_SIZE - 1));
+}
+
+// Return true if the map contains a component index for a given entity
+inline bool EntityComponentIndexMap::containsKey(Entity entity) const {
+
+    const Slot* slot = getSlot(entity);
+    return slot != nullptr && slot->componentIndex != INVALID_INDEX && slot->entityId == entity.id;
+}
+
+// Return the number of entities in the map
+inline int EntityComponentIndexMap::size() const {
+    return static_cast<int>(mNbEntities);
+}
+
+// Return the component index of an entity
+inline uint32 EntityComponentIndexMap::operator[](Entity entity) const {
+
+    assert(containsKey(entity));
+
+    const uint32 entityIndex = entity.getIndex();
+    return mPages[entityIndex >> PAGE_SIZE_BITS][entityIndex & (PAGE_SIZE - 1)].componentIndex;
+}
+
+}
+
+#endif
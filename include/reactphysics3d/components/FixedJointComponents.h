@@ -221,6 +221,7 @@ class FixedJointComponents : public Components {
 
         friend class BroadPhaseSystem;
         friend class SolveFixedJointSystem;
+        friend class ConstraintSolverSystem;
 };
 
 // Return a pointer to a given joint
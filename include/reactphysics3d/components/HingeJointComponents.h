@@ -412,6 +412,7 @@ class HingeJointComponents : public Components {
 
         friend class BroadPhaseSystem;
         friend class SolveHingeJointSystem;
+        friend class ConstraintSolverSystem;
 };
 
 // Return a pointer to a given joint
@@ -136,6 +136,15 @@ class RigidBodyComponents : public Components {
         /// Array of center of mass of each component (in world-space coordinates)
         Vector3* mCentersOfMassWorld;
 
+        /// For each body, the parent body in the union-find tree of its persistent island
+        Entity* mIslandParents;
+
+        /// For each body, the next body of its persistent island (circular list of the bodies of an island)
+        Entity* mIslandNextBodies;
+
+        /// For each root body of a persistent island, number of bodies in the island
+        uint32* mIslandSizes;
+
         /// True if the gravity needs to be applied to this component
         bool* mIsGravityEnabled;
 
@@ -145,6 +154,9 @@ class RigidBodyComponents : public Components {
         /// For each body, the list of joints entities the body is part of
         List<Entity>* mJoints;
 
+        /// For each root body of a persistent island, true if the island might not be connected anymore
+        bool* mIsIslandSplitNeeded;
+
         // -------------------- Methods -------------------- //
 
         /// Allocate memory for a given number of components
@@ -309,6 +321,10 @@ class RigidBodyComponents : public Components {
         /// Set the constrained angular velocity of an entity
         void setConstrainedAngularVelocity(Entity bodyEntity, const Vector3& constrainedAngularVelocity);
 
+        /// Store the constrained velocities of a body computed by a constraint solver (except for a static body)
+        void storeConstrainedVelocities(uint32 componentIndex, const Vector3& constrainedLinearVelocity,
+                                        const Vector3& constrainedAngularVelocity);
+
         /// Set the split linear velocity of an entity
         void setSplitLinearVelocity(Entity bodyEntity, const Vector3& splitLinearVelocity);
 
@@ -342,6 +358,24 @@ class RigidBodyComponents : public Components {
         /// Remove a joint from a body component
         void removeJointFromBody(Entity bodyEntity, Entity jointEntity);
 
+        /// Return the entity of the root body of the persistent island of a body
+        Entity getIslandRoot(Entity bodyEntity);
+
+        /// Return the next body in the persistent island of a body
+        Entity getIslandNextBody(Entity bodyEntity) const;
+
+        /// Merge the persistent islands of two bodies
+        void mergeIslands(Entity body1Entity, Entity body2Entity);
+
+        /// Remove a body from its persistent island
+        void removeBodyFromIsland(Entity bodyEntity);
+
+        /// Return true if the persistent island of a body might not be connected anymore
+        bool getIsIslandSplitNeeded(Entity bodyEntity);
+
+        /// Flag the persistent island of a body as possibly not connected anymore
+        void setIsIslandSplitNeeded(Entity bodyEntity);
+
         // -------------------- Friendship -------------------- //
 
         friend class PhysicsWorld;
@@ -350,6 +384,7 @@ class RigidBodyComponents : public Components {
         friend class SolveFixedJointSystem;
         friend class SolveHingeJointSystem;
         friend class SolveSliderJointSystem;
+        friend class ConstraintSolverSystem;
         friend class DynamicsSystem;
         friend class BallAndSocketJoint;
         friend class FixedJoint;
@@ -669,6 +704,21 @@ inline void RigidBodyComponents::setConstrainedAngularVelocity(Entity bodyEntity
    mConstrainedAngularVelocities[mMapEntityToComponentIndex[bodyEntity]] = constrainedAngularVelocity;
 }
 
+// Store the constrained velocities of a body computed by a constraint solver (except for a static body)
+/// A static body can be part of several islands solved in parallel. The solvers never change its
+/// velocities (its inverse mass and inverse inertia tensor are zero) and they are not written here
+/// so that the threads never write the same velocities.
+inline void RigidBodyComponents::storeConstrainedVelocities(uint32 componentIndex, const Vector3& constrainedLinearVelocity,
+                                                            const Vector3& constrainedAngularVelocity) {
+
+   assert(componentIndex < mNbComponents);
+
+   if (mBodyTypes[componentIndex] != BodyType::STATIC) {
+       mConstrainedLinearVelocities[componentIndex] = constrainedLinearVelocity;
+       mConstrainedAngularVelocities[componentIndex] = constrainedAngularVelocity;
+   }
+}
+
 // Set the split linear velocity of an entity
 inline void RigidBodyComponents::setSplitLinearVelocity(Entity bodyEntity, const Vector3& splitLinearVelocity) {
 
@@ -769,6 +819,27 @@ inline void RigidBodyComponents::removeJointFromBody(Entity bodyEntity, Entity j
     mJoints[mMapEntityToComponentIndex[bodyEntity]].remove(jointEntity);
 }
 
+// Return the next body in the persistent island of a body
+inline Entity RigidBodyComponents::getIslandNextBody(Entity bodyEntity) const {
+
+    assert(mMapEntityToComponentIndex.containsKey(bodyEntity));
+    return mIslandNextBodies[mMapEntityToComponentIndex[bodyEntity]];
+}
+
+// Return true if the persistent island of a body might not be connected anymore
+inline bool RigidBodyComponents::getIsIslandSplitNeeded(Entity bodyEntity) {
+
+    assert(mMapEntityToComponentIndex.containsKey(bodyEntity));
+    return mIsIslandSplitNeeded[mMapEntityToComponentIndex[getIslandRoot(bodyEntity)]];
+}
+
+// Flag the persistent island of a body as possibly not connected anymore
+inline void RigidBodyComponents::setIsIslandSplitNeeded(Entity bodyEntity) {
+
+    assert(mMapEntityToComponentIndex.containsKey(bodyEntity));
+    mIsIslandSplitNeeded[mMapEntityToComponentIndex[getIslandRoot(bodyEntity)]] = true;
+}
+
 }
 
 #endif
@@ -100,8 +100,55 @@ constexpr decimal PI_TIMES_2 = decimal(6.28318530);
 
 /// In the broad-phase collision detection (dynamic AABB tree), the AABBs are
 /// inflated by a constant percentage of its size to allow the collision shape to move a little bit
-/// without triggering a large modification of the tree each frame which can be costly
-constexpr decimal DYNAMIC_TREE_FAT_AABB_INFLATE_PERCENTAGE = decimal(0.08);
+/// without triggering a large modification of the tree each frame which can be costly. This is the
+/// default value of WorldSettings::fatAABBInflatePercentage
+constexpr decimal DYNAMIC_TREE_FAT_AABB_INFLATE_PERCENTAGE = decimal(0.04);
+
+/// In the broad-phase collision detection, the fat AABB of a collider is recomputed if it is larger than
+/// the fat AABB that would be computed now by more than this number of times the inflation gap on a side
+/// (plus the predicted displacement). This shrinks the fat AABB of a collider that has slowed down
+constexpr decimal DYNAMIC_TREE_FAT_AABB_MAX_EXCESS_GAP_FACTOR = decimal(4.0);
+
+/// Default multiplier of the linear displacement of a body during a time step used to extend
+/// the fat AABBs of its colliders in the broad-phase collision detection
+constexpr decimal DYNAMIC_TREE_FAT_AABB_DISPLACEMENT_MULTIPLIER = decimal(2.0);
+
+/// Number of internal nodes of the dynamic AABB tree of the moving colliders that are
+/// incrementally optimized with tree rotations at each frame
+constexpr uint32 DYNAMIC_TREE_NB_OPTIMIZED_NODES_PER_FRAME = 64;
+
+/// Maximum number of bodies in the islands that are split into their connected parts at each frame
+/// when these islands are not split by the sleeping technique (when it is disabled for instance).
+/// At least one flagged island is split at each frame even if it is larger
+constexpr uint32 NB_SPLIT_ISLANDS_BODIES_PER_FRAME = 256;
+
+/// Relative tolerance on the sum of the radiuses used by the SIMD overlap test of the sphere and capsule
+/// narrow-phase algorithms. A pair is only rejected by this test if the distance between the centers (or
+/// inner segments) of its shapes is larger than the increased sum of radiuses. Therefore, the rounding
+/// errors of the test never reject a pair that the exact test would find colliding
+constexpr decimal NARROW_PHASE_SIMD_OVERLAP_TOLERANCE = decimal(0.01);
+
+/// Minimum number of vertices of a convex mesh for its support points to be found with hill-climbing
+/// from the support vertex of the previous query (during the GJK algorithm) instead of a linear scan
+/// over all its vertices
+constexpr uint32 CONVEX_MESH_HILL_CLIMBING_MIN_NB_VERTICES = 32;
+
+/// Number of components processed by a single task when a per-component loop of the
+/// simulation is split between the threads of the task scheduler
+constexpr uint32 PARALLEL_FOR_GRAIN_SIZE = 256;
+
+/// Number of items of a broad-phase overlap query (colliders to test for the dynamic AABB tree)
+/// processed by a single task
+constexpr uint32 PARALLEL_BROAD_PHASE_GRAIN_SIZE = 64;
+
+/// Number of items of a narrow-phase batch (pairs of shapes) tested by a single task
+constexpr uint32 PARALLEL_NARROW_PHASE_GRAIN_SIZE = 32;
+
+/// Number of islands solved by a single task of the contact and joint solvers
+constexpr uint32 PARALLEL_ISLANDS_GRAIN_SIZE = 4;
+
+/// Number of constraints of the same color solved by a single task of the contact and joint solvers
+constexpr uint32 PARALLEL_COLOR_GRAIN_SIZE = 64;
 
 /// Current version of ReactPhysics3D
 const std::string RP3D_VERSION = std::string("0.8.0");
@@ -0,0 +1,592 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_FLAT_MAP_H
+#define REACTPHYSICS3D_FLAT_MAP_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/memory/MemoryAllocator.h>
+#include <reactphysics3d/containers/Pair.h>
+#include <cstring>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+#include <iterator>
+#include <cassert>
+
+namespace reactphysics3d {
+
+// Class FlatMap
+/**
+ * This class represents a generic associative map implemented with an open-addressing
+ * hash table (robin hood hashing). The key/value pairs are stored directly in a single
+ * array of slots. Each slot also stores the distance of its pair to the slot given by the hash
+ * of the key. A lookup scans consecutive slots and stops as soon as it finds a slot closer to
+ * its own home slot than the searched key would be. The removals shift the next pairs backward
+ * so that no tombstone is needed. The hash codes are mixed with a Fibonacci hashing step because
+ * the capacity is a power of two. The table does not wrap around: some extra slots are allocated
+ * after the last home slot and the table grows if a pair would need to be further away. Therefore,
+ * the pairs are only moved backward when a pair is removed during an iteration and the iteration
+ * remains valid if the returned iterator is used. If the hash codes are badly distributed,
+ * more extra slots are allocated instead of growing the table forever.
+ */
+template<typename K, typename V, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>>
+class FlatMap {
+
+    private:
+
+        /// A slot of the table
+        struct Slot {
+
+            /// Distance (plus one) of the pair to its home slot or zero if the slot is empty
+            uint32 distance;
+
+            /// Storage for the key/value pair
+            typename std::aligned_storage<sizeof(Pair<K, V>), alignof(Pair<K, V>)>::type keyValueStorage;
+
+            /// Return the key/value pair of the slot
+            Pair<K, V>& keyValue() {
+                return *reinterpret_cast<Pair<K, V>*>(&keyValueStorage);
+            }
+
+            /// Return the key/value pair of the slot
+            const Pair<K, V>& keyValue() const {
+                return *reinterpret_cast<const Pair<K, V>*>(&keyValueStorage);
+            }
+        };
+
+        // -------------------- Constants -------------------- //
+
+        /// Minimum number of home slots of a non-empty table
+        static constexpr uint32 MIN_CAPACITY = 8;
+
+        /// Maximum distance of a pair to its home slot before the table grows
+        static constexpr uint32 MAX_PROBE_DISTANCE = 128;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Number of pairs in the map
+        uint32 mNbElements;
+
+        /// Number of home slots (power of two)
+        uint32 mCapacity;
+
+        /// Total number of slots (home slots and extra slots at the end)
+        uint32 mNbSlots;
+
+        /// Shift to apply to the mixed hash code to get the home slot
+        uint32 mHashShift;
+
+        /// Array with all the slots
+        Slot* mSlots;
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        // -------------------- Methods -------------------- //
+
+        /// Return the home slot of a key
+        uint32 computeHomeSlot(const K& key) const {
+            const uint64 hashCode = static_cast<uint64>(Hash()(key));
+            return static_cast<uint32>((hashCode * UINT64_C(0x9E3779B97F4A7C15)) >> mHashShift);
+        }
+
+        /// Return the index of the slot with a given key or -1 if there is no pair with this key
+        int findSlot(const K& key) const {
+
+            if (mNbElements == 0) return -1;
+
+            auto keyEqual = KeyEqual();
+
+            uint32 slot = computeHomeSlot(key);
+            uint32 distance = 1;
+
+            // The pairs are sorted by distance along a probe sequence. We can stop as soon
+            // as a slot has a pair closer to its home slot than the key would be.
+            while (slot < mNbSlots && mSlots[slot].distance >= distance) {
+
+                if (mSlots[slot].distance == distance && keyEqual(mSlots[slot].keyValue().first, key)) {
+                    return static_cast<int>(slot);
+                }
+
+                slot++;
+                distance++;
+            }
+
+            return -1;
+        }
+
+        /// Allocate the slots of the table for a given number of home slots and extra slots
+        void allocateSlots(uint32 capacity, uint32 nbExtraSlots) {
+
+            assert(capacity >= MIN_CAPACITY);
+            assert((capacity & (capacity - 1)) == 0);
+
+            uint32 log2Capacity = 0;
+            while ((uint32(1) << log2Capacity) < capacity) log2Capacity++;
+
+            mCapacity = capacity;
+            mNbSlots = mCapacity + nbExtraSlots;
+            mHashShift = 64 - log2Capacity;
+
+            mSlots = static_cast<Slot*>(mAllocator.allocate(mNbSlots * sizeof(Slot)));
+            for (uint32 i=0; i < mNbSlots; i++) {
+                mSlots[i].distance = 0;
+            }
+        }
+
+        /// Return the default number of extra slots for a given number of home slots
+        static uint32 computeNbExtraSlots(uint32 capacity) {
+            return capacity < MAX_PROBE_DISTANCE ? capacity : MAX_PROBE_DISTANCE;
+        }
+
+        /// Change the number of slots and re-insert all the pairs
+        void rehash(uint32 newCapacity, uint32 nbExtraSlots) {
+
+            Slot* oldSlots = mSlots;
+            const uint32 oldNbSlots = mNbSlots;
+
+            allocateSlots(newCapacity, nbExtraSlots);
+            mNbElements = 0;
+
+            if (oldSlots != nullptr) {
+
+                for (uint32 i=0; i < oldNbSlots; i++) {
+                    if (oldSlots[i].distance != 0) {
+                        insertNewPair(oldSlots[i].keyValue());
+                        oldSlots[i].keyValue().~Pair<K, V>();
+                    }
+                }
+
+                mAllocator.release(oldSlots, oldNbSlots * sizeof(Slot));
+            }
+        }
+
+        /// Insert a pair whose key is not in the map yet
+        void insertNewPair(const Pair<K, V>& keyValue) {
+
+            // Grow the table if the load factor would be larger than 3/4
+            if (mCapacity == 0) {
+                rehash(MIN_CAPACITY, computeNbExtraSlots(MIN_CAPACITY));
+            }
+            else if (4 * (mNbElements + 1) > 3 * mCapacity) {
+                grow();
+            }
+
+            Pair<K, V> pairToInsert(keyValue);
+            uint32 slot = computeHomeSlot(pairToInsert.first);
+            uint32 distance = 1;
+
+            while (true) {
+
+                // If the pair would be too far from its home slot or past the last slot, we grow the table
+                if (slot == mNbSlots || (distance > MAX_PROBE_DISTANCE && 8 * mNbElements >= mCapacity)) {
+                    grow();
+                    insertNewPair(pairToInsert);
+                    return;
+                }
+
+                Slot& currentSlot = mSlots[slot];
+
+                // If the slot is empty, we insert the pair in it
+                if (currentSlot.distance == 0) {
+                    new (&currentSlot.keyValueStorage) Pair<K, V>(pairToInsert);
+                    currentSlot.distance = distance;
+                    mNbElements++;
+                    return;
+                }
+
+                // If the pair in the slot is closer to its home slot, we take its place
+                // and we continue with the pair that we have replaced
+                if (currentSlot.distance < distance) {
+                    Pair<K, V> replacedPair(currentSlot.keyValue());
+                    currentSlot.keyValue() = pairToInsert;
+                    pairToInsert = replacedPair;
+                    const uint32 replacedDistance = currentSlot.distance;
+                    currentSlot.distance = distance;
+                    distance = replacedDistance;
+                }
+
+                slot++;
+                distance++;
+            }
+        }
+
+        /// Grow the table
+        void grow() {
+
+            const uint32 nbExtraSlots = mNbSlots - mCapacity;
+
+            // If the table is not almost empty, we double the number of home slots. Otherwise,
+            // the long probe sequences are caused by the hash codes and we only add extra slots.
+            if (8 * mNbElements >= mCapacity) {
+                const uint32 newNbExtraSlots = computeNbExtraSlots(mCapacity * 2);
+                rehash(mCapacity * 2, newNbExtraSlots > nbExtraSlots ? newNbExtraSlots : nbExtraSlots);
+            }
+            else {
+                rehash(mCapacity, nbExtraSlots * 2);
+            }
+        }
+
+        /// Return the index of the first used slot starting at a given one
+        uint32 findNextUsedSlot(uint32 slot) const {
+            while (slot < mNbSlots && mSlots[slot].distance == 0) slot++;
+            return slot;
+        }
+
+    public:
+
+        /// Class Iterator
+        /**
+         * This class represents an iterator for the FlatMap
+         */
+        class Iterator {
+
+            private:
+
+                /// Array of slots
+                Slot* mSlots;
+
+                /// Number of slots of the map
+                uint32 mNbSlots;
+
+                /// Index of the current slot
+                uint32 mCurrentSlot;
+
+                /// Advance the iterator
+                void advance() {
+
+                    // If we are trying to move past the end
+                    assert(mCurrentSlot < mNbSlots);
+
+                    for (mCurrentSlot += 1; mCurrentSlot < mNbSlots; mCurrentSlot++) {
+                        if (mSlots[mCurrentSlot].distance != 0) return;
+                    }
+                }
+
+            public:
+
+                // Iterator traits
+                using value_type = Pair<K,V>;
+                using difference_type = std::ptrdiff_t;
+                using pointer = Pair<K, V>*;
+                using reference = Pair<K,V>&;
+                using iterator_category = std::forward_iterator_tag;
+
+                /// Constructor
+                Iterator() = default;
+
+                /// Constructor
+                Iterator(Slot* slots, uint32 nbSlots, uint32 currentSlot)
+                     :mSlots(slots), mNbSlots(nbSlots), mCurrentSlot(currentSlot) {
+
+                }
+
+                /// Deferencable
+                reference operator*() const {
+                    assert(mCurrentSlot < mNbSlots && mSlots[mCurrentSlot].distance != 0);
+                    return mSlots[mCurrentSlot].keyValue();
+                }
+
+                /// Deferencable
+                pointer operator->() const {
+                    assert(mCurrentSlot < mNbSlots && mSlots[mCurrentSlot].distance != 0);
+                    return &(mSlots[mCurrentSlot].keyValue());
+                }
+
+                /// Pre increment (++it)
+                Iterator& operator++() {
+                    advance();
+                    return *this;
+                }
+
+                /// Post increment (it++)
+                Iterator operator++(int) {
+                    Iterator tmp = *this;
+                    advance();
+                    return tmp;
+                }
+
+                /// Equality operator (it == end())
+                bool operator==(const Iterator& iterator) const {
+                    return mCurrentSlot == iterator.mCurrentSlot && mSlots == iterator.mSlots;
+                }
+
+                /// Inequality operator (it != end())
+                bool operator!=(const Iterator& iterator) const {
+                    return !(*this == iterator);
+                }
+        };
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        FlatMap(MemoryAllocator& allocator, size_t capacity = 0)
+            : mNbElements(0), mCapacity(0), mNbSlots(0), mHashShift(0),
+              mSlots(nullptr), mAllocator(allocator) {
+
+            if (capacity > 0) {
+                reserve(static_cast<int>(capacity));
+            }
+        }
+
+        /// Copy constructor
+        FlatMap(const FlatMap<K, V, Hash, KeyEqual>& map)
+            : mNbElements(0), mCapacity(0), mNbSlots(0), mHashShift(0),
+              mSlots(nullptr), mAllocator(map.mAllocator) {
+
+            copySlots(map);
+        }
+
+        /// Destructor
+        ~FlatMap() {
+
+            clear(true);
+        }
+
+        /// Allocate memory for a given number of elements
+        void reserve(int capacity) {
+
+            // Compute the number of home slots needed to keep a load factor of at most 3/4
+            uint32 newCapacity = MIN_CAPACITY;
+            while (3 * static_cast<uint64>(newCapacity) < 4 * static_cast<uint64>(capacity)) newCapacity *= 2;
+
+            if (newCapacity > mCapacity) {
+                const uint32 nbExtraSlots = mNbSlots - mCapacity;
+                const uint32 newNbExtraSlots = computeNbExtraSlots(newCapacity);
+                rehash(newCapacity, newNbExtraSlots > nbExtraSlots ? newNbExtraSlots : nbExtraSlots);
+            }
+        }
+
+        /// Return true if the map contains an item with the given key
+        bool containsKey(const K& key) const {
+            return findSlot(key) != -1;
+        }
+
+        /// Add an element into the map
+        void add(const Pair<K,V>& keyValue, bool insertIfAlreadyPresent = false) {
+
+            const int slot = findSlot(keyValue.first);
+
+            // If there is already an item with the same key in the map
+            if (slot != -1) {
+
+                if (insertIfAlreadyPresent) {
+                    mSlots[slot].keyValue().second = keyValue.second;
+                    return;
+                }
+                else {
+                    throw std::runtime_error("The key and value pair already exists in the map");
+                }
+            }
+
+            insertNewPair(keyValue);
+        }
+
+        /// Remove the element pointed by some iterator
+        /// This method returns an iterator pointing to the element after
+        /// the one that has been removed
+        Iterator remove(const Iterator& it) {
+
+            const K key = it->first;
+            return remove(key);
+        }
+
+        /// Remove the element from the map with a given key
+        /// This method returns an iterator pointing to the element after
+        /// the one that has been removed
+        Iterator remove(const K& key) {
+
+            const int slotIndex = findSlot(key);
+            if (slotIndex == -1) return end();
+
+            uint32 slot = static_cast<uint32>(slotIndex);
+            mSlots[slot].keyValue().~Pair<K, V>();
+            mSlots[slot].distance = 0;
+            mNbElements--;
+
+            // Shift backward the next pairs that are not in their home slot
+            uint32 nextSlot = slot + 1;
+            while (nextSlot < mNbSlots && mSlots[nextSlot].distance > 1) {
+
+                new (&mSlots[nextSlot - 1].keyValueStorage) Pair<K, V>(mSlots[nextSlot].keyValue());
+                mSlots[nextSlot - 1].distance = mSlots[nextSlot].distance - 1;
+                mSlots[nextSlot].keyValue().~Pair<K, V>();
+                mSlots[nextSlot].distance = 0;
+                nextSlot++;
+            }
+
+            // The next pair is now in the slot of the removed pair (if it has been shifted)
+            return Iterator(mSlots, mNbSlots, findNextUsedSlot(slot));
+        }
+
+        /// Clear the map
+        void clear(bool releaseMemory = false) {
+
+            if (mNbElements > 0) {
+
+                for (uint32 i=0; i < mNbSlots; i++) {
+                    if (mSlots[i].distance != 0) {
+                        mSlots[i].keyValue().~Pair<K, V>();
+                        mSlots[i].distance = 0;
+                    }
+                }
+
+                mNbElements = 0;
+            }
+
+            // If memory has been allocated
+            if (releaseMemory && mSlots != nullptr) {
+
+                mAllocator.release(mSlots, mNbSlots * sizeof(Slot));
+
+                mSlots = nullptr;
+                mCapacity = 0;
+                mNbSlots = 0;
+                mHashShift = 0;
+            }
+
+            assert(size() == 0);
+        }
+
+        /// Return the number of elements in the map
+        int size() const {
+            return static_cast<int>(mNbElements);
+        }
+
+        /// Return the capacity of the map
+        int capacity() const {
+            return static_cast<int>(mCapacity);
+        }
+
+        /// Try to find an item of the map given a key.
+        /// The method returns an iterator to the found item or
+        /// an iterator pointing to the end if not found
+        Iterator find(const K& key) const {
+
+            const int slot = findSlot(key);
+            if (slot == -1) return end();
+
+            return Iterator(mSlots, mNbSlots, static_cast<uint32>(slot));
+        }
+
+        /// Overloaded index operator
+        V& operator[](const K& key) {
+
+            const int slot = findSlot(key);
+
+            if (slot == -1) {
+                assert(false);
+                throw std::runtime_error("No item with given key has been found in the map");
+            }
+
+            return mSlots[slot].keyValue().second;
+        }
+
+        /// Overloaded index operator
+        const V& operator[](const K& key) const {
+
+            const int slot = findSlot(key);
+
+            if (slot == -1) {
+                throw std::runtime_error("No item with given key has been found in the map");
+            }
+
+            return mSlots[slot].keyValue().second;
+        }
+
+        /// Overloaded equality operator
+        bool operator==(const FlatMap<K, V, Hash, KeyEqual>& map) const {
+
+            if (size() != map.size()) return false;
+
+            for (auto it = begin(); it != end(); ++it) {
+                auto it2 = map.find(it->first);
+                if (it2 == map.end() || it2->second != it->second) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /// Overloaded not equal operator
+        bool operator!=(const FlatMap<K, V, Hash, KeyEqual>& map) const {
+
+            return !((*this) == map);
+        }
+
+        /// Overloaded assignment operator
+        FlatMap<K, V, Hash, KeyEqual>& operator=(const FlatMap<K, V, Hash, KeyEqual>& map) {
+
+            // Check for self assignment
+            if (this != &map) {
+
+                clear(true);
+                copySlots(map);
+            }
+
+            return *this;
+        }
+
+        /// Return a begin iterator
+        Iterator begin() const {
+
+            if (mNbElements == 0) return end();
+
+            return Iterator(mSlots, mNbSlots, findNextUsedSlot(0));
+        }
+
+        /// Return a end iterator
+        Iterator end() const {
+            return Iterator(mSlots, mNbSlots, mNbSlots);
+        }
+
+    private:
+
+        /// Copy the slots of another map into this empty map
+        void copySlots(const FlatMap<K, V, Hash, KeyEqual>& map) {
+
+            assert(mSlots == nullptr);
+
+            if (map.mSlots != nullptr) {
+
+                // The pairs keep the same slots because the number of slots is the same
+                allocateSlots(map.mCapacity, map.mNbSlots - map.mCapacity);
+                for (uint32 i=0; i < mNbSlots; i++) {
+                    if (map.mSlots[i].distance != 0) {
+                        new (&mSlots[i].keyValueStorage) Pair<K, V>(map.mSlots[i].keyValue());
+                        mSlots[i].distance = map.mSlots[i].distance;
+                    }
+                }
+                mNbElements = map.mNbElements;
+            }
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,560 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_FLAT_SET_H
+#define REACTPHYSICS3D_FLAT_SET_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/memory/MemoryAllocator.h>
+#include <reactphysics3d/containers/List.h>
+#include <cstring>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+#include <iterator>
+#include <cassert>
+
+namespace reactphysics3d {
+
+// Class FlatSet
+/**
+ * This class represents a generic set implemented with an open-addressing hash table
+ * (robin hood hashing). It uses the same table layout as the FlatMap class: the values are
+ * stored directly in an array of slots together with their distance to their home slot and
+ * the removals shift the next values backward instead of leaving tombstones.
+ */
+template<typename V, class Hash = std::hash<V>, class KeyEqual = std::equal_to<V>>
+class FlatSet {
+
+    private:
+
+        /// A slot of the table
+        struct Slot {
+
+            /// Distance (plus one) of the value to its home slot or zero if the slot is empty
+            uint32 distance;
+
+            /// Storage for the value
+            typename std::aligned_storage<sizeof(V), alignof(V)>::type valueStorage;
+
+            /// Return the value of the slot
+            V& value() {
+                return *reinterpret_cast<V*>(&valueStorage);
+            }
+
+            /// Return the value of the slot
+            const V& value() const {
+                return *reinterpret_cast<const V*>(&valueStorage);
+            }
+        };
+
+        // -------------------- Constants -------------------- //
+
+        /// Minimum number of home slots of a non-empty table
+        static constexpr uint32 MIN_CAPACITY = 8;
+
+        /// Maximum distance of a value to its home slot before the table grows
+        static constexpr uint32 MAX_PROBE_DISTANCE = 128;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Number of values in the set
+        uint32 mNbElements;
+
+        /// Number of home slots (power of two)
+        uint32 mCapacity;
+
+        /// Total number of slots (home slots and extra slots at the end)
+        uint32 mNbSlots;
+
+        /// Shift to apply to the mixed hash code to get the home slot
+        uint32 mHashShift;
+
+        /// Array with all the slots
+        Slot* mSlots;
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        // -------------------- Methods -------------------- //
+
+        /// Return the home slot of a value
+        uint32 computeHomeSlot(const V& value) const {
+            const uint64 hashCode = static_cast<uint64>(Hash()(value));
+            return static_cast<uint32>((hashCode * UINT64_C(0x9E3779B97F4A7C15)) >> mHashShift);
+        }
+
+        /// Return the index of the slot with a given value or -1 if the value is not in the set
+        int findSlot(const V& value) const {
+
+            if (mNbElements == 0) return -1;
+
+            auto keyEqual = KeyEqual();
+
+            uint32 slot = computeHomeSlot(value);
+            uint32 distance = 1;
+
+            while (slot < mNbSlots && mSlots[slot].distance >= distance) {
+
+                if (mSlots[slot].distance == distance && keyEqual(mSlots[slot].value(), value)) {
+                    return static_cast<int>(slot);
+                }
+
+                slot++;
+                distance++;
+            }
+
+            return -1;
+        }
+
+        /// Allocate the slots of the table for a given number of home slots and extra slots
+        void allocateSlots(uint32 capacity, uint32 nbExtraSlots) {
+
+            assert(capacity >= MIN_CAPACITY);
+            assert((capacity & (capacity - 1)) == 0);
+
+            uint32 log2Capacity = 0;
+            while ((uint32(1) << log2Capacity) < capacity) log2Capacity++;
+
+            mCapacity = capacity;
+            mNbSlots = mCapacity + nbExtraSlots;
+            mHashShift = 64 - log2Capacity;
+
+            mSlots = static_cast<Slot*>(mAllocator.allocate(mNbSlots * sizeof(Slot)));
+            for (uint32 i=0; i < mNbSlots; i++) {
+                mSlots[i].distance = 0;
+            }
+        }
+
+        /// Return the default number of extra slots for a given number of home slots
+        static uint32 computeNbExtraSlots(uint32 capacity) {
+            return capacity < MAX_PROBE_DISTANCE ? capacity : MAX_PROBE_DISTANCE;
+        }
+
+        /// Change the number of slots and re-insert all the values
+        void rehash(uint32 newCapacity, uint32 nbExtraSlots) {
+
+            Slot* oldSlots = mSlots;
+            const uint32 oldNbSlots = mNbSlots;
+
+            allocateSlots(newCapacity, nbExtraSlots);
+            mNbElements = 0;
+
+            if (oldSlots != nullptr) {
+
+                for (uint32 i=0; i < oldNbSlots; i++) {
+                    if (oldSlots[i].distance != 0) {
+                        insertNewValue(oldSlots[i].value());
+                        oldSlots[i].value().~V();
+                    }
+                }
+
+                mAllocator.release(oldSlots, oldNbSlots * sizeof(Slot));
+            }
+        }
+
+        /// Insert a value that is not in the set yet
+        void insertNewValue(const V& value) {
+
+            // Grow the table if the load factor would be larger than 3/4
+            if (mCapacity == 0) {
+                rehash(MIN_CAPACITY, computeNbExtraSlots(MIN_CAPACITY));
+            }
+            else if (4 * (mNbElements + 1) > 3 * mCapacity) {
+                grow();
+            }
+
+            V valueToInsert(value);
+            uint32 slot = computeHomeSlot(valueToInsert);
+            uint32 distance = 1;
+
+            while (true) {
+
+                // If the value would be too far from its home slot or past the last slot, we grow the table
+                if (slot == mNbSlots || (distance > MAX_PROBE_DISTANCE && 8 * mNbElements >= mCapacity)) {
+                    grow();
+                    insertNewValue(valueToInsert);
+                    return;
+                }
+
+                Slot& currentSlot = mSlots[slot];
+
+                // If the slot is empty, we insert the value in it
+                if (currentSlot.distance == 0) {
+                    new (&currentSlot.valueStorage) V(valueToInsert);
+                    currentSlot.distance = distance;
+                    mNbElements++;
+                    return;
+                }
+
+                // If the value in the slot is closer to its home slot, we take its place
+                // and we continue with the value that we have replaced
+                if (currentSlot.distance < distance) {
+                    V replacedValue(currentSlot.value());
+                    currentSlot.value() = valueToInsert;
+                    valueToInsert = replacedValue;
+                    const uint32 replacedDistance = currentSlot.distance;
+                    currentSlot.distance = distance;
+                    distance = replacedDistance;
+                }
+
+                slot++;
+                distance++;
+            }
+        }
+
+        /// Grow the table
+        void grow() {
+
+            const uint32 nbExtraSlots = mNbSlots - mCapacity;
+
+            // If the table is not almost empty, we double the number of home slots. Otherwise,
+            // the long probe sequences are caused by the hash codes and we only add extra slots.
+            if (8 * mNbElements >= mCapacity) {
+                const uint32 newNbExtraSlots = computeNbExtraSlots(mCapacity * 2);
+                rehash(mCapacity * 2, newNbExtraSlots > nbExtraSlots ? newNbExtraSlots : nbExtraSlots);
+            }
+            else {
+                rehash(mCapacity, nbExtraSlots * 2);
+            }
+        }
+
+        /// Return the index of the first used slot starting at a given one
+        uint32 findNextUsedSlot(uint32 slot) const {
+            while (slot < mNbSlots && mSlots[slot].distance == 0) slot++;
+            return slot;
+        }
+
+        /// Copy the slots of another set into this empty set
+        void copySlots(const FlatSet<V, Hash, KeyEqual>& set) {
+
+            assert(mSlots == nullptr);
+
+            if (set.mSlots != nullptr) {
+
+                // The values keep the same slots because the number of slots is the same
+                allocateSlots(set.mCapacity, set.mNbSlots - set.mCapacity);
+                for (uint32 i=0; i < mNbSlots; i++) {
+                    if (set.mSlots[i].distance != 0) {
+                        new (&mSlots[i].valueStorage) V(set.mSlots[i].value());
+                        mSlots[i].distance = set.mSlots[i].distance;
+                    }
+                }
+                mNbElements = set.mNbElements;
+            }
+        }
+
+    public:
+
+        /// Class Iterator
+        /**
+         * This class represents an iterator for the FlatSet
+         */
+        class Iterator {
+
+            private:
+
+                /// Array of slots
+                const Slot* mSlots;
+
+                /// Number of slots of the set
+                uint32 mNbSlots;
+
+                /// Index of the current slot
+                uint32 mCurrentSlot;
+
+                /// Advance the iterator
+                void advance() {
+
+                    // If we are trying to move past the end
+                    assert(mCurrentSlot < mNbSlots);
+
+                    for (mCurrentSlot += 1; mCurrentSlot < mNbSlots; mCurrentSlot++) {
+                        if (mSlots[mCurrentSlot].distance != 0) return;
+                    }
+                }
+
+            public:
+
+                // Iterator traits
+                using value_type = V;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const V*;
+                using reference = const V&;
+                using iterator_category = std::forward_iterator_tag;
+
+                /// Constructor
+                Iterator() = default;
+
+                /// Constructor
+                Iterator(const Slot* slots, uint32 nbSlots, uint32 currentSlot)
+                     :mSlots(slots), mNbSlots(nbSlots), mCurrentSlot(currentSlot) {
+
+                }
+
+                /// Deferencable
+                reference operator*() const {
+                    assert(mCurrentSlot < mNbSlots && mSlots[mCurrentSlot].distance != 0);
+                    return mSlots[mCurrentSlot].value();
+                }
+
+                /// Deferencable
+                pointer operator->() const {
+                    assert(mCurrentSlot < mNbSlots && mSlots[mCurrentSlot].distance != 0);
+                    return &(mSlots[mCurrentSlot].value());
+                }
+
+                /// Pre increment (++it)
+                Iterator& operator++() {
+                    advance();
+                    return *this;
+                }
+
+                /// Post increment (it++)
+                Iterator operator++(int) {
+                    Iterator tmp = *this;
+                    advance();
+                    return tmp;
+                }
+
+                /// Equality operator (it == end())
+                bool operator==(const Iterator& iterator) const {
+                    return mCurrentSlot == iterator.mCurrentSlot && mSlots == iterator.mSlots;
+                }
+
+                /// Inequality operator (it != end())
+                bool operator!=(const Iterator& iterator) const {
+                    return !(*this == iterator);
+                }
+        };
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        FlatSet(MemoryAllocator& allocator, size_t capacity = 0)
+            : mNbElements(0), mCapacity(0), mNbSlots(0), mHashShift(0),
+              mSlots(nullptr), mAllocator(allocator) {
+
+            if (capacity > 0) {
+                reserve(static_cast<int>(capacity));
+            }
+        }
+
+        /// Copy constructor
+        FlatSet(const FlatSet<V, Hash, KeyEqual>& set)
+            : mNbElements(0), mCapacity(0), mNbSlots(0), mHashShift(0),
+              mSlots(nullptr), mAllocator(set.mAllocator) {
+
+            copySlots(set);
+        }
+
+        /// Destructor
+        ~FlatSet() {
+
+            clear(true);
+        }
+
+        /// Allocate memory for a given number of elements
+        void reserve(int capacity) {
+
+            // Compute the number of home slots needed to keep a load factor of at most 3/4
+            uint32 newCapacity = MIN_CAPACITY;
+            while (3 * static_cast<uint64>(newCapacity) < 4 * static_cast<uint64>(capacity)) newCapacity *= 2;
+
+            if (newCapacity > mCapacity) {
+                const uint32 nbExtraSlots = mNbSlots - mCapacity;
+                const uint32 newNbExtraSlots = computeNbExtraSlots(newCapacity);
+                rehash(newCapacity, newNbExtraSlots > nbExtraSlots ? newNbExtraSlots : nbExtraSlots);
+            }
+        }
+
+        /// Return true if the set contains a given value
+        bool contains(const V& value) const {
+            return findSlot(value) != -1;
+        }
+
+        /// Add a value into the set.
+        /// Returns true if the item has been inserted and false otherwise.
+        bool add(const V& value) {
+
+            // If the value is already in the set
+            if (findSlot(value) != -1) return false;
+
+            insertNewValue(value);
+
+            return true;
+        }
+
+        /// Remove the element pointed by some iterator
+        /// This method returns an iterator pointing to the
+        /// element after the one that has been removed
+        Iterator remove(const Iterator& it) {
+
+            const V value = *it;
+            return remove(value);
+        }
+
+        /// Remove the element from the set with a given value
+        /// This method returns an iterator pointing to the
+        /// element after the one that has been removed
+        Iterator remove(const V& value) {
+
+            const int slotIndex = findSlot(value);
+            if (slotIndex == -1) return end();
+
+            uint32 slot = static_cast<uint32>(slotIndex);
+            mSlots[slot].value().~V();
+            mSlots[slot].distance = 0;
+            mNbElements--;
+
+            // Shift backward the next values that are not in their home slot
+            uint32 nextSlot = slot + 1;
+            while (nextSlot < mNbSlots && mSlots[nextSlot].distance > 1) {
+
+                new (&mSlots[nextSlot - 1].valueStorage) V(mSlots[nextSlot].value());
+                mSlots[nextSlot - 1].distance = mSlots[nextSlot].distance - 1;
+                mSlots[nextSlot].value().~V();
+                mSlots[nextSlot].distance = 0;
+                nextSlot++;
+            }
+
+            return Iterator(mSlots, mNbSlots, findNextUsedSlot(slot));
+        }
+
+        /// Return a list with all the values of the set
+        List<V> toList(MemoryAllocator& listAllocator) const {
+
+            List<V> list(listAllocator, mNbElements);
+
+            for (uint32 i=0; i < mNbSlots; i++) {
+                if (mSlots[i].distance != 0) {
+                    list.add(mSlots[i].value());
+                }
+            }
+
+            return list;
+        }
+
+        /// Clear the set
+        void clear(bool releaseMemory = false) {
+
+            if (mNbElements > 0) {
+
+                for (uint32 i=0; i < mNbSlots; i++) {
+                    if (mSlots[i].distance != 0) {
+                        mSlots[i].value().~V();
+                        mSlots[i].distance = 0;
+                    }
+                }
+
+                mNbElements = 0;
+            }
+
+            // If memory has been allocated
+            if (releaseMemory && mSlots != nullptr) {
+
+                mAllocator.release(mSlots, mNbSlots * sizeof(Slot));
+
+                mSlots = nullptr;
+                mCapacity = 0;
+                mNbSlots = 0;
+                mHashShift = 0;
+            }
+
+            assert(size() == 0);
+        }
+
+        /// Return the number of elements in the set
+        int size() const {
+            return static_cast<int>(mNbElements);
+        }
+
+        /// Return the capacity of the set
+        int capacity() const {
+            return static_cast<int>(mCapacity);
+        }
+
+        /// Try to find an item of the set given a key.
+        /// The method returns an iterator to the found item or
+        /// an iterator pointing to the end if not found
+        Iterator find(const V& value) const {
+
+            const int slot = findSlot(value);
+            if (slot == -1) return end();
+
+            return Iterator(mSlots, mNbSlots, static_cast<uint32>(slot));
+        }
+
+        /// Overloaded equality operator
+        bool operator==(const FlatSet<V, Hash, KeyEqual>& set) const {
+
+            if (size() != set.size()) return false;
+
+            for (auto it = begin(); it != end(); ++it) {
+                if(!set.contains(*it)) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /// Overloaded not equal operator
+        bool operator!=(const FlatSet<V, Hash, KeyEqual>& set) const {
+
+            return !((*this) == set);
+        }
+
+        /// Overloaded assignment operator
+        FlatSet<V, Hash, KeyEqual>& operator=(const FlatSet<V, Hash, KeyEqual>& set) {
+
+            // Check for self assignment
+            if (this != &set) {
+
+                clear(true);
+                copySlots(set);
+            }
+
+            return *this;
+        }
+
+        /// Return a begin iterator
+        Iterator begin() const {
+
+            if (mNbElements == 0) return end();
+
+            return Iterator(mSlots, mNbSlots, findNextUsedSlot(0));
+        }
+
+        /// Return a end iterator
+        Iterator end() const {
+            return Iterator(mSlots, mNbSlots, mNbSlots);
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,135 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_CONSTRAINT_GRAPH_COLORING_H
+#define REACTPHYSICS3D_CONSTRAINT_GRAPH_COLORING_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/containers/List.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Class ConstraintGraphColoring
+/**
+ * This class computes a coloring of the constraint graph of an island. Each constraint
+ * (contact manifold or joint) between two bodies receives a color such that two constraints
+ * with the same color never share a body. Therefore, all the constraints of a given color can
+ * be solved in parallel without write conflicts on the velocities of the bodies. The colors are
+ * assigned greedily in the order of the constraints which makes the coloring deterministic.
+ * The constraints that cannot be colored with the maximum number of colors are put in an
+ * overflow batch that has to be solved sequentially after the colors.
+ */
+class ConstraintGraphColoring {
+
+    public:
+
+        // -------------------- Constants -------------------- //
+
+        /// Maximum number of colors
+        static const uint32 MAX_NB_COLORS = 64;
+
+        /// Body index used for a body that does not need to be taken into account by the coloring
+        static const uint32 IGNORED_BODY = ~uint32(0);
+
+    private:
+
+        // -------------------- Attributes -------------------- //
+
+        /// Indices of the constraints sorted by color (the overflow constraints are at the end)
+        List<uint32> mConstraintsIndices;
+
+        /// For each color, index of its first constraint in mConstraintsIndices. The last
+        /// element is the index of the first overflow constraint
+        List<uint32> mColorsStartIndices;
+
+        /// For each body, bit mask of the colors already used by its constraints
+        List<uint64> mBodiesColors;
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        ConstraintGraphColoring(MemoryAllocator& allocator);
+
+        /// Destructor
+        ~ConstraintGraphColoring() = default;
+
+        /// Compute the colors of the constraints
+        void computeColors(const List<uint32>& bodies1, const List<uint32>& bodies2, uint32 nbBodies);
+
+        /// Return the number of colors
+        uint32 getNbColors() const;
+
+        /// Return the index of the first constraint of a given color
+        uint32 getColorStartIndex(uint32 color) const;
+
+        /// Return the index of the first overflow constraint
+        uint32 getOverflowStartIndex() const;
+
+        /// Return the total number of constraints
+        uint32 getNbConstraints() const;
+
+        /// Return the indices of the constraints sorted by color
+        const List<uint32>& getConstraintsIndices() const;
+};
+
+// Return the number of colors
+inline uint32 ConstraintGraphColoring::getNbColors() const {
+    return mColorsStartIndices.size() - 1;
+}
+
+// Return the index of the first constraint of a given color
+/**
+ * The constraints of the color are in the range [getColorStartIndex(color), getColorStartIndex(color + 1))
+ * of the constraints indices list
+ * @param color Index of the color (between 0 and getNbColors())
+ * @return The index of the first constraint of the color in the list of constraints indices
+ */
+inline uint32 ConstraintGraphColoring::getColorStartIndex(uint32 color) const {
+    assert(color < mColorsStartIndices.size());
+    return mColorsStartIndices[color];
+}
+
+// Return the index of the first overflow constraint
+inline uint32 ConstraintGraphColoring::getOverflowStartIndex() const {
+    return mColorsStartIndices[mColorsStartIndices.size() - 1];
+}
+
+// Return the total number of constraints
+inline uint32 ConstraintGraphColoring::getNbConstraints() const {
+    return mConstraintsIndices.size();
+}
+
+// Return the indices of the constraints sorted by color
+inline const List<uint32>& ConstraintGraphColoring::getConstraintsIndices() const {
+    return mConstraintsIndices;
+}
+
+}
+
+#endif
@@ -0,0 +1,148 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_DEFAULT_TASK_SCHEDULER_H
+#define REACTPHYSICS3D_DEFAULT_TASK_SCHEDULER_H
+
+// Libraries
+#include <reactphysics3d/engine/TaskScheduler.h>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Class DefaultTaskScheduler
+/**
+ * This class is the default task scheduler of the library. It is a pool of worker threads
+ * using work stealing. When some tasks are run, the range of task indices is split into one
+ * contiguous range per thread. Each thread executes the tasks from the front of its own range
+ * and, when its range is empty, steals tasks from the back of the ranges of the other threads.
+ * The thread that calls runTasks() also executes tasks (it is the thread with index zero).
+ */
+class DefaultTaskScheduler : public TaskScheduler {
+
+    private:
+
+        // Structure WorkerQueue
+        /**
+         * Range of task indices [begin, end) that remain to be executed by a thread. The two
+         * indices are packed into a single atomic 64-bits integer (begin in the low bits).
+         * The structure is padded to a cache line to avoid false sharing between threads.
+         */
+        struct WorkerQueue {
+
+            /// Packed range of remaining task indices
+            std::atomic<uint64> range;
+
+            /// Padding up to the size of a cache line
+            char padding[64 - sizeof(std::atomic<uint64>)];
+        };
+
+        // -------------------- Attributes -------------------- //
+
+        /// Number of threads (including the calling thread) used to run tasks
+        uint32 mNbThreads;
+
+        /// Worker threads (there are mNbThreads - 1 of them)
+        std::thread* mWorkers;
+
+        /// Range of tasks of each thread
+        WorkerQueue* mQueues;
+
+        /// Task currently executed
+        const Task* mTask;
+
+        /// Number of tasks of the current job that have not been executed yet
+        std::atomic<uint32> mNbRemainingTasks;
+
+        /// Number of worker threads currently executing tasks of a job
+        uint32 mNbActiveWorkers;
+
+        /// Counter incremented each time a new job is submitted to the workers
+        uint64 mJobCounter;
+
+        /// True if the worker threads need to exit
+        bool mIsExiting;
+
+        /// Mutex protecting the job counter and the number of active workers
+        std::mutex mMutex;
+
+        /// Mutex used to run a single job at a time
+        std::mutex mRunMutex;
+
+        /// Condition variable used to wake up the workers when a job is submitted
+        std::condition_variable mJobSubmittedCondition;
+
+        /// Condition variable used to notify the calling thread that a worker is done
+        std::condition_variable mWorkerDoneCondition;
+
+        // -------------------- Methods -------------------- //
+
+        /// Main function of the worker threads
+        void workerMain(uint32 threadIndex);
+
+        /// Execute tasks of the current job until no task is left to take
+        void executeTasks(uint32 threadIndex);
+
+        /// Take the next task from the front of the range of a thread
+        bool popTask(uint32 queueIndex, uint32& taskIndex);
+
+        /// Steal a task from the back of the range of a thread
+        bool stealTask(uint32 queueIndex, uint32& taskIndex);
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        DefaultTaskScheduler(uint32 nbThreads = 0);
+
+        /// Destructor
+        virtual ~DefaultTaskScheduler() override;
+
+        /// Deleted copy-constructor
+        DefaultTaskScheduler(const DefaultTaskScheduler& scheduler) = delete;
+
+        /// Deleted assignment operator
+        DefaultTaskScheduler& operator=(const DefaultTaskScheduler& scheduler) = delete;
+
+        /// Return the number of threads used to run tasks
+        virtual uint32 getNbThreads() const override;
+
+        /// Execute the tasks with index in [0, nbTasks) and return when all of them are finished
+        virtual void runTasks(uint32 nbTasks, const Task& task) override;
+};
+
+// Return the number of threads used to run tasks
+inline uint32 DefaultTaskScheduler::getNbThreads() const {
+    return mNbThreads;
+}
+
+}
+
+#endif
@@ -65,12 +65,18 @@ struct Islands {
         /// For each island, list of all the entities of the bodies in the island
         List<List<Entity>> bodyEntities;
 
+        /// Indices of the contact pairs of all the islands (sorted by island)
+        List<uint> contactPairsIndices;
+
+        /// For each island, true if its constraints are solved using a graph coloring
+        List<bool> isSolvedWithGraphColoring;
+
         // -------------------- Methods -------------------- //
 
         /// Constructor
         Islands(MemoryAllocator& allocator)
             :memoryAllocator(allocator), contactManifoldsIndices(allocator), nbContactManifolds(allocator),
-             bodyEntities(allocator) {
+             bodyEntities(allocator), contactPairsIndices(allocator), isSolvedWithGraphColoring(allocator) {
 
         }
 
@@ -96,6 +102,7 @@ struct Islands {
             contactManifoldsIndices.add(contactManifoldStartIndex);
             nbContactManifolds.add(0);
             bodyEntities.add(List<Entity>(memoryAllocator));
+            isSolvedWithGraphColoring.add(false);
 
             return islandIndex;
         }
@@ -106,6 +113,8 @@ struct Islands {
             contactManifoldsIndices.clear(true);
             nbContactManifolds.clear(true);
             bodyEntities.clear(true);
+            contactPairsIndices.clear(true);
+            isSolvedWithGraphColoring.clear(true);
         }
 };
 
@@ -0,0 +1,251 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_LAST_FRAME_COLLISION_INFO_POOL_H
+#define REACTPHYSICS3D_LAST_FRAME_COLLISION_INFO_POOL_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/mathematics/Vector3.h>
+#include <reactphysics3d/mathematics/Transform.h>
+#include <reactphysics3d/containers/List.h>
+#include <reactphysics3d/containers/Pair.h>
+#include <reactphysics3d/containers/FlatMap.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Declarations
+class MemoryAllocator;
+
+// Structure LastFrameCollisionInfo
+/**
+ * This structure contains collision info about the last frame.
+ * This is used for temporal coherence between frames.
+ */
+struct LastFrameCollisionInfo {
+
+    /// True if we have information about the previous frame
+    bool isValid;
+
+    /// True if the two shapes were colliding in the previous frame
+    bool wasColliding;
+
+    /// True if we were using GJK algorithm to check for collision in the previous frame
+    bool wasUsingGJK;
+
+    /// True if we were using SAT algorithm to check for collision in the previous frame
+    bool wasUsingSAT;
+
+    // ----- GJK Algorithm -----
+
+    /// Previous separating axis
+    Vector3 gjkSeparatingAxis;
+
+    /// Index of the last support vertex of the first shape (if it is a convex mesh)
+    uint gjkSupportVertexIndex1;
+
+    /// Index of the last support vertex of the second shape (if it is a convex mesh)
+    uint gjkSupportVertexIndex2;
+
+    /// Number of points of the simplex at the end of the previous GJK test (zero if the shapes were
+    /// interpenetrating). There are at most three points because the simplex is not full in this case
+    uint8 gjkNbSimplexPoints;
+
+    /// Support points of the first shape (in its local-space) of the points of the previous simplex
+    Vector3 gjkSimplexSupportPoints1[3];
+
+    /// Support points of the second shape (in its local-space) of the points of the previous simplex
+    Vector3 gjkSimplexSupportPoints2[3];
+
+    /// Lower bound of the distance between the two shapes (with their margins) found by the
+    /// previous GJK test if the shapes were separated and zero otherwise
+    decimal gjkSeparationGap;
+
+    /// Transform from the local-space of the second shape to the local-space of the first
+    /// shape when the separation gap has been computed
+    Transform gjkSeparationShape2ToShape1;
+
+    /// Bounding radius of the first shape when the previous simplex and separation gap have been
+    /// cached (used to detect a change of the size of the shape)
+    decimal gjkBoundingRadius1;
+
+    /// Bounding radius of the second shape when the previous simplex and separation gap have been
+    /// cached (used to detect a change of the size of the shape)
+    decimal gjkBoundingRadius2;
+
+    // SAT Algorithm
+    bool satIsAxisFacePolyhedron1;
+    bool satIsAxisFacePolyhedron2;
+    uint satMinAxisFaceIndex;
+    uint satMinEdge1Index;
+    uint satMinEdge2Index;
+
+    // ----- Box vs Box Algorithm -----
+
+    /// Index (between 0 and 14) of the separating axis (or axis of minimum penetration)
+    /// found in the previous frame (face normals of the first box, face normals of the second
+    /// box and cross products of their edges directions)
+    uint8 boxVsBoxAxisIndex;
+
+    /// Constructor
+    LastFrameCollisionInfo() {
+
+        isValid = false;
+        wasColliding = false;
+        wasUsingSAT = false;
+        wasUsingGJK = false;
+        boxVsBoxAxisIndex = 0;
+        gjkSupportVertexIndex1 = 0;
+        gjkSupportVertexIndex2 = 0;
+        gjkNbSimplexPoints = 0;
+        gjkSeparationGap = decimal(0.0);
+        gjkBoundingRadius1 = decimal(0.0);
+        gjkBoundingRadius2 = decimal(0.0);
+        satIsAxisFacePolyhedron1 = false;
+        satIsAxisFacePolyhedron2 = false;
+        satMinAxisFaceIndex = 0;
+        satMinEdge1Index = 0;
+        satMinEdge2Index = 0;
+
+        gjkSeparatingAxis = Vector3(0, 1, 0);
+        gjkSeparationShape2ToShape1 = Transform::identity();
+        for (int i=0; i < 3; i++) {
+            gjkSimplexSupportPoints1[i].setToZero();
+            gjkSimplexSupportPoints2[i].setToZero();
+        }
+    }
+};
+
+// Class LastFrameCollisionInfoPool
+/**
+ * This class stores the last frame collision infos of all the overlapping pairs. An info is
+ * identified by a key (unique id of the pair and shape ids of the two collision shapes). The infos
+ * are packed in pages that are never moved so that the pointers given to the narrow-phase stay
+ * valid until the next call to clearObsoleteInfos(). The infos that have been used since the last
+ * call to clearObsoleteInfos() are kept at the beginning of the pool. An info is moved there when it
+ * is used for the first time in a frame and all the infos after them are obsolete when the pool is
+ * cleared. Therefore, clearing the pool only visits the obsolete infos.
+ */
+class LastFrameCollisionInfoPool {
+
+    private:
+
+        // -------------------- Constants -------------------- //
+
+        /// Number of infos in a page of the pool
+        static const uint32 NB_INFOS_PER_PAGE = 256;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory allocator of the pages
+        MemoryAllocator& mAllocator;
+
+        /// Pages of the pool
+        List<LastFrameCollisionInfo*> mPages;
+
+        /// Key of each info of the pool
+        List<Pair<uint64, uint64>> mKeys;
+
+        /// Map the key of an info to its index in the pool
+        FlatMap<Pair<uint64, uint64>, uint32> mMapKeyToIndex;
+
+        /// Number of infos at the beginning of the pool that have been used since the last call to clearObsoleteInfos()
+        uint32 mNbUsedInfos;
+
+        // -------------------- Methods -------------------- //
+
+        /// Return the info at a given index of the pool
+        LastFrameCollisionInfo* getInfoAtIndex(uint32 index) const;
+
+        /// Swap two infos of the pool (with their keys)
+        void swapInfos(uint32 index1, uint32 index2);
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        LastFrameCollisionInfoPool(MemoryAllocator& allocator);
+
+        /// Destructor
+        ~LastFrameCollisionInfoPool();
+
+        /// Deleted copy-constructor
+        LastFrameCollisionInfoPool(const LastFrameCollisionInfoPool& pool) = delete;
+
+        /// Deleted assignment operator
+        LastFrameCollisionInfoPool& operator=(const LastFrameCollisionInfoPool& pool) = delete;
+
+        /// Return the info with a given key (created if necessary) and mark it as used in the current frame
+        LastFrameCollisionInfo* addInfoIfNecessary(const Pair<uint64, uint64>& key);
+
+        /// Return the info with a given key or nullptr if there is none
+        LastFrameCollisionInfo* getInfo(const Pair<uint64, uint64>& key) const;
+
+        /// Remove the infos that have not been used since the previous call and mark the others as not used
+        void clearObsoleteInfos();
+
+        /// Return the number of infos in the pool
+        uint32 getNbInfos() const;
+
+        /// Return the number of infos that have been used since the last call to clearObsoleteInfos()
+        uint32 getNbUsedInfos() const;
+
+        /// Return the number of allocated pages
+        uint32 getNbPages() const;
+};
+
+// Return the info at a given index of the pool
+inline LastFrameCollisionInfo* LastFrameCollisionInfoPool::getInfoAtIndex(uint32 index) const {
+    assert(index < mKeys.size());
+    return mPages[index / NB_INFOS_PER_PAGE] + (index % NB_INFOS_PER_PAGE);
+}
+
+// Return the info with a given key or nullptr if there is none
+inline LastFrameCollisionInfo* LastFrameCollisionInfoPool::getInfo(const Pair<uint64, uint64>& key) const {
+
+    auto it = mMapKeyToIndex.find(key);
+    return it != mMapKeyToIndex.end() ? getInfoAtIndex(it->second) : nullptr;
+}
+
+// Return the number of infos in the pool
+inline uint32 LastFrameCollisionInfoPool::getNbInfos() const {
+    return static_cast<uint32>(mKeys.size());
+}
+
+// Return the number of infos that have been used since the last call to clearObsoleteInfos()
+inline uint32 LastFrameCollisionInfoPool::getNbUsedInfos() const {
+    return mNbUsedInfos;
+}
+
+// Return the number of allocated pages
+inline uint32 LastFrameCollisionInfoPool::getNbPages() const {
+    return static_cast<uint32>(mPages.size());
+}
+
+}
+
+#endif
@@ -28,14 +28,18 @@
 
 // Libraries
 #include <reactphysics3d/collision/Collider.h>
+#include <reactphysics3d/containers/List.h>
 #include <reactphysics3d/containers/Map.h>
 #include <reactphysics3d/containers/Pair.h>
 #include <reactphysics3d/containers/Set.h>
+#include <reactphysics3d/containers/FlatMap.h>
+#include <reactphysics3d/containers/FlatSet.h>
 #include <reactphysics3d/containers/containers_common.h>
 #include <reactphysics3d/utils/Profiler.h>
 #include <reactphysics3d/components/ColliderComponents.h>
 #include <reactphysics3d/components/CollisionBodyComponents.h>
 #include <reactphysics3d/components/RigidBodyComponents.h>
+#include <reactphysics3d/engine/LastFrameCollisionInfoPool.h>
 #include <cstddef>
 
 /// ReactPhysics3D namespace
@@ -47,53 +51,6 @@ enum class NarrowPhaseAlgorithmType;
 class CollisionShape;
 class CollisionDispatch;
 
-// Structure LastFrameCollisionInfo
-/**
- * This structure contains collision info about the last frame.
- * This is used for temporal coherence between frames.
- */
-struct LastFrameCollisionInfo {
-
-    /// True if we have information about the previous frame
-    bool isValid;
-
-    /// True if the frame info is obsolete (the collision shape are not overlapping in middle phase)
-    bool isObsolete;
-
-    /// True if the two shapes were colliding in the previous frame
-    bool wasColliding;
-
-    /// True if we were using GJK algorithm to check for collision in the previous frame
-    bool wasUsingGJK;
-
-    /// True if we were using SAT algorithm to check for collision in the previous frame
-    bool wasUsingSAT;
-
-    // ----- GJK Algorithm -----
-
-    /// Previous separating axis
-    Vector3 gjkSeparatingAxis;
-
-    // SAT Algorithm
-    bool satIsAxisFacePolyhedron1;
-    bool satIsAxisFacePolyhedron2;
-    uint satMinAxisFaceIndex;
-    uint satMinEdge1Index;
-    uint satMinEdge2Index;
-
-    /// Constructor
-    LastFrameCollisionInfo() {
-
-        isValid = false;
-        isObsolete = false;
-        wasColliding = false;
-        wasUsingSAT = false;
-        wasUsingGJK = false;
-
-        gjkSeparatingAxis = Vector3(0, 1, 0);
-    }
-};
-
 // Class OverlappingPairs
 /**
  * This class contains pairs of two colliders that are overlapping
@@ -124,9 +81,14 @@ class OverlappingPairs {
         /// Current number of components
         uint64 mNbPairs;
 
-        /// Index in the array of the first convex vs concave pair
+        /// Index in the array of the first active convex vs concave pair
         uint64 mConcavePairsStartIndex;
 
+        /// Index in the array of the first inactive pair. The active convex vs convex pairs are stored
+        /// first, then the active convex vs concave pairs and finally all the inactive pairs so that
+        /// the per-frame loops over the pairs do not need to visit the pairs of sleeping bodies
+        uint64 mInactivePairsStartIndex;
+
         /// Size (in bytes) of a single pair
         size_t mPairDataSize;
 
@@ -137,7 +99,7 @@ class OverlappingPairs {
         void* mBuffer;
 
         /// Map a pair id to the internal array index
-        Map<uint64, uint64> mMapPairIdToPairIndex;
+        FlatMap<uint64, uint64> mMapPairIdToPairIndex;
 
         /// Ids of the convex vs convex pairs
         uint64* mPairIds;
@@ -154,12 +116,17 @@ class OverlappingPairs {
         /// Array of Entity of the second collider of the convex vs convex pairs
         Entity* mColliders2;
 
-        /// Temporal coherence collision data for each overlapping collision shapes of this pair.
-        /// Temporal coherence data store collision information about the last frame.
-        /// If two convex shapes overlap, we have a single collision data but if one shape is concave,
-        /// we might have collision data for several overlapping triangles. The key in the map is the
-        /// shape Ids of the two collision shapes.
-        Map<uint64, LastFrameCollisionInfo*>* mLastFrameCollisionInfos;
+        /// Unique id of each pair (never reused by another pair) used as the first part of the
+        /// key of its last frame collision infos
+        uint64* mPairUniqueIds;
+
+        /// Transform from the local-space of the second collider to the local-space of the first collider
+        /// when the contacts of the pair have been computed by the narrow-phase for the last time
+        Transform* mContactsShape2ToShape1;
+
+        /// Orientation of the first collider in the world when the contacts of the pair in the last frame
+        /// have been computed or reused (used to rotate the normals of the reused contacts)
+        Quaternion* mLastFrameShape1Orientations;
 
         /// True if we need to test if the convex vs convex overlapping pairs of shapes still overlap
         bool* mNeedToTestOverlap;
@@ -179,6 +146,19 @@ class OverlappingPairs {
         /// True if the colliders of the overlapping pair are colliding in the current frame
         bool* mCollidingInCurrentFrame;
 
+        /// True if the contacts of the pair in the last frame can be reused in the current frame when the
+        /// relative transform of its colliders has almost not changed since the narrow-phase has been computed
+        bool* mAreContactsReusable;
+
+        /// Next unique id of a pair
+        uint64 mNextPairUniqueId;
+
+        /// Pool with the temporal coherence collision data of all the pairs.
+        /// Temporal coherence data store collision information about the last frame.
+        /// If two convex shapes overlap, we have a single collision data but if one shape is concave,
+        /// we might have collision data for several overlapping triangles.
+        LastFrameCollisionInfoPool mLastFrameInfoPool;
+
         /// Reference to the colliders components
         ColliderComponents& mColliderComponents;
 
@@ -189,7 +169,7 @@ class OverlappingPairs {
         RigidBodyComponents& mRigidBodyComponents;
 
         /// Reference to the set of bodies that cannot collide with each others
-        Set<bodypair>& mNoCollisionPairs;
+        FlatSet<bodypair>& mNoCollisionPairs;
 
         /// Reference to the collision dispatch
         CollisionDispatch& mCollisionDispatch;
@@ -218,6 +198,9 @@ class OverlappingPairs {
         /// Swap two pairs in the array
         void swapPairs(uint64 index1, uint64 index2);
 
+        /// Return true if the two collision shapes of the pair at a given index are convex
+        bool isConvexVsConvexPair(uint64 index) const;
+
     public:
 
         // -------------------- Methods -------------------- //
@@ -225,7 +208,7 @@ class OverlappingPairs {
         /// Constructor
         OverlappingPairs(MemoryAllocator& persistentMemoryAllocator, MemoryAllocator& temporaryMemoryAllocator,
                          ColliderComponents& colliderComponents, CollisionBodyComponents& collisionBodyComponents,
-                         RigidBodyComponents& rigidBodyComponents, Set<bodypair>& noCollisionPairs,
+                         RigidBodyComponents& rigidBodyComponents, FlatSet<bodypair>& noCollisionPairs,
                          CollisionDispatch& collisionDispatch);
 
         /// Destructor
@@ -246,13 +229,16 @@ class OverlappingPairs {
         /// Return the number of pairs
         uint64 getNbPairs() const;
 
-        /// Return the number of convex vs convex pairs
+        /// Return the number of active pairs
+        uint64 getNbActivePairs() const;
+
+        /// Return the number of active convex vs convex pairs
         uint64 getNbConvexVsConvexPairs() const;
 
-        /// Return the number of convex vs concave pairs
+        /// Return the number of active convex vs concave pairs
         uint64 getNbConvexVsConcavePairs() const;
 
-        /// Return the starting index of the convex vs concave pairs
+        /// Return the starting index of the active convex vs concave pairs
         uint64 getConvexVsConcavePairsStartIndex() const;
 
         /// Return the entity of the first collider
@@ -261,9 +247,6 @@ class OverlappingPairs {
         /// Return the entity of the second collider
         Entity getCollider2(uint64 pairId) const;
 
-        /// Notify if a given pair is active or not
-        void setIsPairActive(uint64 pairId, bool isActive);
-
         /// Return the index of a given overlapping pair in the internal array
         uint64 getPairIndex(uint64 pairId) const;
 
@@ -324,14 +307,6 @@ inline Entity OverlappingPairs::getCollider2(uint64 pairId) const {
     return mColliders2[mMapPairIdToPairIndex[pairId]];
 }
 
-// Notify if a given pair is active or not
-inline void OverlappingPairs::setIsPairActive(uint64 pairId, bool isActive) {
-
-    assert(mMapPairIdToPairIndex.containsKey(pairId));
-    assert(mMapPairIdToPairIndex[pairId] < mNbPairs);
-    mIsActive[mMapPairIdToPairIndex[pairId]] = isActive;
-}
-
 // Return the index of a given overlapping pair in the internal array
 inline uint64 OverlappingPairs::getPairIndex(uint64 pairId) const {
     assert(mMapPairIdToPairIndex.containsKey(pairId));
@@ -345,12 +320,13 @@ inline LastFrameCollisionInfo* OverlappingPairs::getLastFrameCollisionInfo(uint6
     const uint64 index = mMapPairIdToPairIndex[pairId];
     assert(index < mNbPairs);
 
-    Map<uint64, LastFrameCollisionInfo*>::Iterator it = mLastFrameCollisionInfos[index].find(shapesId);
-    if (it != mLastFrameCollisionInfos[index].end()) {
-        return it->second;
-    }
+    return mLastFrameInfoPool.getInfo(Pair<uint64, uint64>(mPairUniqueIds[index], shapesId));
+}
 
-    return nullptr;
+// Return true if the two collision shapes of the pair at a given index are convex
+inline bool OverlappingPairs::isConvexVsConvexPair(uint64 index) const {
+    return mColliderComponents.getCollisionShape(mColliders1[index])->isConvex() &&
+           mColliderComponents.getCollisionShape(mColliders2[index])->isConvex();
 }
 
 // Return the pair of bodies index
@@ -369,17 +345,22 @@ inline uint64 OverlappingPairs::getNbPairs() const {
     return mNbPairs;
 }
 
-// Return the number of convex vs convex pairs
+// Return the number of active pairs
+inline uint64 OverlappingPairs::getNbActivePairs() const {
+   return mInactivePairsStartIndex;
+}
+
+// Return the number of active convex vs convex pairs
 inline uint64 OverlappingPairs::getNbConvexVsConvexPairs() const {
    return mConcavePairsStartIndex;
 }
 
-// Return the number of convex vs concave pairs
+// Return the number of active convex vs concave pairs
 inline uint64 OverlappingPairs::getNbConvexVsConcavePairs() const {
-   return mNbPairs - mConcavePairsStartIndex;
+   return mInactivePairsStartIndex - mConcavePairsStartIndex;
 }
 
-// Return the starting index of the convex vs concave pairs
+// Return the starting index of the active convex vs concave pairs
 inline uint64 OverlappingPairs::getConvexVsConcavePairsStartIndex() const {
    return mConcavePairsStartIndex;
 }
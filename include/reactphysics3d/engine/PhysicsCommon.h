@@ -56,6 +56,9 @@ class PhysicsCommon {
         /// Memory manager
         MemoryManager mMemoryManager;
 
+        /// Task scheduler used by the worlds that do not have their own one (can be null)
+        TaskScheduler* mTaskScheduler;
+
         /// Set of physics worlds
         Set<PhysicsWorld*> mPhysicsWorlds;
 
@@ -113,7 +116,7 @@ class PhysicsCommon {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        PhysicsCommon(MemoryAllocator* baseMemoryAllocator = nullptr);
+        PhysicsCommon(MemoryAllocator* baseMemoryAllocator = nullptr, TaskScheduler* taskScheduler = nullptr);
 
         /// Destructor
         ~PhysicsCommon();
@@ -154,6 +157,11 @@ class PhysicsCommon {
                                                  int upAxis = 1, decimal integerHeightScale = 1.0f,
                                                   const Vector3& scaling = Vector3(1,1,1));
 
+        /// Create and return a height-field shape from cooked data
+        HeightFieldShape* createHeightFieldShapeFromCookedData(const void* cookedData, size_t cookedDataSize,
+                                                               const Vector3& scaling = Vector3(1,1,1),
+                                                               bool isChecksumVerified = true);
+
         /// Destroy a height-field shape
         void destroyHeightFieldShape(HeightFieldShape* heightFieldShape);
 
@@ -166,12 +174,20 @@ class PhysicsCommon {
         /// Create a polyhedron mesh
         PolyhedronMesh* createPolyhedronMesh(PolygonVertexArray* polygonVertexArray);
 
+        /// Create a polyhedron mesh from cooked data
+        PolyhedronMesh* createPolyhedronMeshFromCookedData(const void* cookedData, size_t cookedDataSize,
+                                                           bool isChecksumVerified = true);
+
         /// Destroy a polyhedron mesh
         void destroyPolyhedronMesh(PolyhedronMesh* polyhedronMesh);
 
         /// Create a triangle mesh
         TriangleMesh* createTriangleMesh();
 
+        /// Create a triangle mesh from cooked data
+        TriangleMesh* createTriangleMeshFromCookedData(const void* cookedData, size_t cookedDataSize,
+                                                       bool isChecksumVerified = true);
+
         /// Destroy a triangle mesh
         void destroyTriangleMesh(TriangleMesh* triangleMesh);
 
@@ -50,6 +50,7 @@
 #include <reactphysics3d/systems/ContactSolverSystem.h>
 #include <reactphysics3d/systems/DynamicsSystem.h>
 #include <reactphysics3d/engine/Islands.h>
+#include <reactphysics3d/engine/DefaultTaskScheduler.h>
 #include <reactphysics3d/utils/DebugRenderer.h>
 #include <sstream>
 
@@ -124,6 +125,47 @@ class PhysicsWorld {
             /// than the value bellow, the manifold are considered to be similar.
             decimal cosAngleSimilarContactManifold;
 
+            /// Number of threads used to run the simulation with the default task scheduler
+            /// (1 to run everything on the calling thread, 0 to use all the hardware threads)
+            uint nbThreads;
+
+            /// Task scheduler used to run the simulation on several threads. If null, the task
+            /// scheduler of the PhysicsCommon is used and, if there is none, a default task
+            /// scheduler with nbThreads threads is created for the world.
+            TaskScheduler* taskScheduler;
+
+            /// Minimum number of constraints (contact manifolds and joints) in an island to solve it
+            /// with a graph coloring of its constraints so that a single large island can also be solved
+            /// on several threads (0 to disable)
+            uint minNbConstraintsGraphColoring;
+
+            /// True if the contacts are solved by blocks of contact manifolds using SIMD instructions.
+            /// The default value can be changed with the RP3D_WIDE_CONTACT_SOLVER_ENABLED CMake option
+            bool isWideContactSolverEnabled;
+
+            /// Data structure used by the broad-phase collision detection
+            BroadPhaseType broadPhaseType;
+
+            /// Percentage of the size of the AABB of a collider used to inflate its fat AABB on each
+            /// side in the broad-phase collision detection
+            decimal fatAABBInflatePercentage;
+
+            /// The fat AABB of a collider is extended in the direction of the linear displacement of its
+            /// body during a time step multiplied by this value (0 to disable). A larger value means less
+            /// updates of the broad-phase for the fast bodies but more false overlapping pairs
+            decimal fatAABBDisplacementMultiplier;
+
+            /// The contacts of an overlapping pair computed by the narrow-phase are reused in the next frames
+            /// (re-projected with the current transforms of the colliders) as long as the relative translation
+            /// of its colliders since they have been computed is smaller than this distance and their relative
+            /// rotation is smaller than restingPairAngularThreshold. This skips the narrow-phase of the pairs at
+            /// rest in stacks and piles (0 to disable, which is the default)
+            decimal restingPairLinearThreshold;
+
+            /// Maximum angle (in radians) of the relative rotation of the colliders of an overlapping pair since
+            /// its contacts have been computed by the narrow-phase to reuse them (see restingPairLinearThreshold)
+            decimal restingPairAngularThreshold;
+
             WorldSettings() {
 
                 worldName = "";
@@ -141,7 +183,19 @@ class PhysicsWorld {
                 defaultSleepAngularVelocity = decimal(3.0) * (PI / decimal(180.0));
                 nbMaxContactManifolds = 3;
                 cosAngleSimilarContactManifold = decimal(0.95);
-
+                nbThreads = 1;
+                taskScheduler = nullptr;
+                minNbConstraintsGraphColoring = 512;
+#ifdef IS_RP3D_WIDE_CONTACT_SOLVER_ENABLED
+                isWideContactSolverEnabled = true;
+#else
+                isWideContactSolverEnabled = false;
+#endif
+                broadPhaseType = BroadPhaseType::DYNAMIC_AABB_TREE;
+                fatAABBInflatePercentage = DYNAMIC_TREE_FAT_AABB_INFLATE_PERCENTAGE;
+                fatAABBDisplacementMultiplier = DYNAMIC_TREE_FAT_AABB_DISPLACEMENT_MULTIPLIER;
+                restingPairLinearThreshold = decimal(0.0);
+                restingPairAngularThreshold = decimal(0.0);
             }
 
             ~WorldSettings() = default;
@@ -166,6 +220,15 @@ class PhysicsWorld {
                 ss << "defaultSleepAngularVelocity=" << defaultSleepAngularVelocity << std::endl;
                 ss << "nbMaxContactManifolds=" << nbMaxContactManifolds << std::endl;
                 ss << "cosAngleSimilarContactManifold=" << cosAngleSimilarContactManifold << std::endl;
+                ss << "nbThreads=" << nbThreads << std::endl;
+                ss << "taskScheduler=" << (taskScheduler != nullptr ? "custom" : "default") << std::endl;
+                ss << "minNbConstraintsGraphColoring=" << minNbConstraintsGraphColoring << std::endl;
+                ss << "isWideContactSolverEnabled=" << isWideContactSolverEnabled << std::endl;
+                ss << "broadPhaseType=" << (broadPhaseType == BroadPhaseType::SWEEP_AND_PRUNE ? "SweepAndPrune" : "DynamicAABBTree") << std::endl;
+                ss << "fatAABBInflatePercentage=" << fatAABBInflatePercentage << std::endl;
+                ss << "fatAABBDisplacementMultiplier=" << fatAABBDisplacementMultiplier << std::endl;
+                ss << "restingPairLinearThreshold=" << restingPairLinearThreshold << std::endl;
+                ss << "restingPairAngularThreshold=" << restingPairAngularThreshold << std::endl;
 
                 return ss.str();
             }
@@ -175,12 +238,19 @@ class PhysicsWorld {
 
         // -------------------- Attributes -------------------- //
 
-        /// Memory manager
-        MemoryManager& mMemoryManager;
+        /// Memory manager of the world (it uses the allocators of the memory manager of the PhysicsCommon
+        /// but has its own allocators for the threads running a simulation step of this world)
+        MemoryManager mMemoryManager;
 
         /// Configuration of the physics world
         WorldSettings mConfig;
 
+        /// Task scheduler of the world (only used if no task scheduler is given in the settings)
+        DefaultTaskScheduler mDefaultTaskScheduler;
+
+        /// Task scheduler used to split the work of a simulation step between threads
+        TaskScheduler& mTaskScheduler;
+
         /// Entity Manager for the ECS
         EntityManager mEntityManager;
 
@@ -295,15 +365,33 @@ class PhysicsWorld {
         /// Solve the position error correction of the constraints
         void solvePositionCorrection();
 
+        /// Return true if an island has to be solved using a graph coloring of its constraints
+        bool isIslandSolvedWithGraphColoring(uint32 islandIndex) const;
+
         /// Compute the islands of awake bodies.
         void computeIslands();
 
         /// Compute the islands using potential contacts and joints and create the actual contacts.
         void createIslands();
 
+        /// Return true if a contact pair is a constraint between two rigid bodies that is solved in the islands
+        bool isIslandContactPair(const ContactPair& pair) const;
+
+        /// Flag the islands that have lost a contact between two of their bodies
+        void flagIslandsWithLostContacts();
+
+        /// Wake up all the bodies of the persistent island of a body
+        void awakeIsland(Entity bodyEntity);
+
+        /// Split the persistent island of a body into its connected parts
+        void splitIsland(Entity bodyEntity, List<Entity>& newIslandsRoots);
+
         /// Put bodies to sleep if needed.
         void updateSleepingBodies(decimal timeStep);
 
+        /// Split the islands that might not be connected anymore within a budget of bodies
+        void splitFlaggedIslands();
+
         /// Add the joint to the list of joints of the two bodies involved in the joint
         void addJointToBodies(Entity body1, Entity body2, Entity joint);
 
@@ -347,12 +435,27 @@ class PhysicsWorld {
         /// Return a reference to the memory manager of the world
         MemoryManager& getMemoryManager();
 
+        /// Return a reference to the task scheduler of the world
+        TaskScheduler& getTaskScheduler();
+
         /// Return the current world-space AABB of given collider
         AABB getWorldAABB(const Collider* collider) const;
 
         /// Return the name of the world
         const std::string& getName() const;
 
+        /// Return the statistics of the narrow-phase collision detection of the last update
+        const NarrowPhaseStatistics& getNarrowPhaseStatistics() const;
+
+        /// Return the surface area heuristic (SAH) cost of the broad-phase data structure
+        decimal getBroadPhaseSAHCost() const;
+
+        /// Rebuild the broad-phase data structure from all the colliders of the world
+        void rebuildBroadPhase();
+
+        /// Return true if two rigid bodies are in the same island
+        bool areBodiesInSameIsland(const RigidBody* body1, const RigidBody* body2);
+
         /// Deleted copy-constructor
         PhysicsWorld(const PhysicsWorld& world) = delete;
 
@@ -579,6 +682,11 @@ inline MemoryManager& PhysicsWorld::getMemoryManager() {
     return mMemoryManager;
 }
 
+// Return a reference to the task scheduler of the world
+inline TaskScheduler& PhysicsWorld::getTaskScheduler() {
+    return mTaskScheduler;
+}
+
 // Return the name of the world
 /**
  * @return Name of the world
@@ -587,6 +695,35 @@ inline const std::string& PhysicsWorld::getName() const {
     return mName;
 }
 
+// Return the statistics of the narrow-phase collision detection of the last update
+/**
+ * @return The numbers of narrow-phase tests of the pairs of shapes during the last call
+ *         of the update() method and of the tests that have used the temporal coherence
+ */
+inline const NarrowPhaseStatistics& PhysicsWorld::getNarrowPhaseStatistics() const {
+    return mCollisionDetection.getNarrowPhaseStatistics();
+}
+
+// Return the surface area heuristic (SAH) cost of the broad-phase data structure
+/// The cost is proportional to the expected number of nodes visited by an overlap query. It can be used
+/// to monitor the quality of the broad-phase and to decide when to call rebuildBroadPhase(). It is always
+/// zero with the sweep-and-prune broad-phase. This method visits all the nodes of the broad-phase.
+/**
+ * @return The SAH cost of the broad-phase data structure
+ */
+inline decimal PhysicsWorld::getBroadPhaseSAHCost() const {
+    return mCollisionDetection.getBroadPhaseSAHCost();
+}
+
+// Rebuild the broad-phase data structure from all the colliders of the world
+/// The dynamic AABB trees are rebuilt top-down with the surface area heuristic. This takes O(n log n)
+/// time and can be used after a large change of the world (a level has been loaded or many bodies have been
+/// teleported for instance). The overlapping pairs of colliders are not modified. This method must not be
+/// called during the update of the world.
+inline void PhysicsWorld::rebuildBroadPhase() {
+    mCollisionDetection.rebuildBroadPhase();
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Return a pointer to the profiler
@@ -0,0 +1,113 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_TASK_SCHEDULER_H
+#define REACTPHYSICS3D_TASK_SCHEDULER_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <functional>
+#include <algorithm>
+#include <cassert>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Class TaskScheduler
+/**
+ * Abstract class with the interface used by a physics world to execute the independent
+ * parts of a simulation step on several threads. The library provides a default
+ * implementation (DefaultTaskScheduler) but you can inherit from this class in order to
+ * run the work of the physics engine on your own job system. A task scheduler can be
+ * given to the PhysicsCommon (used by all the worlds) or to the WorldSettings of a world.
+ */
+class TaskScheduler {
+
+    public:
+
+        /// Function executing a single task. The first argument is the index of the task and
+        /// the second one is the index (smaller than getNbThreads()) of the thread running it
+        using Task = std::function<void(uint32 taskIndex, uint32 threadIndex)>;
+
+        /// Function processing the items [startIndex, endIndex) of a parallel loop
+        using RangeTask = std::function<void(uint32 startIndex, uint32 endIndex, uint32 threadIndex)>;
+
+        /// Constructor
+        TaskScheduler() = default;
+
+        /// Destructor
+        virtual ~TaskScheduler() = default;
+
+        /// Return the maximum number of threads that can execute tasks at the same time
+        virtual uint32 getNbThreads() const=0;
+
+        /// Execute the tasks with index in [0, nbTasks) and return when all of them are finished.
+        /// Two tasks running at the same time must be given two different thread indices.
+        virtual void runTasks(uint32 nbTasks, const Task& task)=0;
+
+        /// Split the items [startIndex, endIndex) into chunks and process the chunks in parallel
+        void parallelFor(uint32 startIndex, uint32 endIndex, uint32 grainSize, const RangeTask& task);
+};
+
+// Split the items [startIndex, endIndex) into chunks and process the chunks in parallel
+/// The chunks only depend on the range and on the grain size (not on the number of threads).
+/// Therefore, if the items are independent, the result does not depend on the scheduling.
+/// The profiler is not thread-safe and therefore the loop runs on the calling thread when
+/// profiling is enabled.
+/**
+ * @param startIndex Index of the first item to process
+ * @param endIndex Index after the last item to process
+ * @param grainSize Maximum number of items processed by a single task
+ * @param task Function that processes a chunk of items
+ */
+inline void TaskScheduler::parallelFor(uint32 startIndex, uint32 endIndex, uint32 grainSize, const RangeTask& task) {
+
+    assert(grainSize > 0);
+
+    if (endIndex <= startIndex) return;
+
+    const uint32 nbTasks = (endIndex - startIndex + grainSize - 1) / grainSize;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+    const bool isParallel = false;
+#else
+    const bool isParallel = nbTasks > 1 && getNbThreads() > 1;
+#endif
+
+    // If there is nothing to run in parallel, we process the whole range on the calling thread
+    if (!isParallel) {
+        task(startIndex, endIndex, 0);
+        return;
+    }
+
+    runTasks(nbTasks, [&](uint32 taskIndex, uint32 threadIndex) {
+        const uint32 taskStartIndex = startIndex + taskIndex * grainSize;
+        task(taskStartIndex, std::min(taskStartIndex + grainSize, endIndex), threadIndex);
+    });
+}
+
+}
+
+#endif
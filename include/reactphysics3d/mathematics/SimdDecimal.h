@@ -0,0 +1,526 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_SIMD_DECIMAL_H
+#define REACTPHYSICS3D_SIMD_DECIMAL_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <cmath>
+
+// Select the instruction set used for the SIMD operations. The double precision values
+// and the unsupported architectures use a portable implementation
+#if !defined(IS_RP3D_DOUBLE_PRECISION_ENABLED) && !defined(IS_RP3D_SIMD_DISABLED)
+    #if defined(__AVX__)
+        #define RP3D_SIMD_AVX
+        #include <immintrin.h>
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define RP3D_SIMD_SSE
+        #include <emmintrin.h>
+    #elif defined(__ARM_NEON) && defined(__aarch64__)
+        #define RP3D_SIMD_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+/// Number of decimal values (lanes) processed by a single SIMD operation
+#if defined(RP3D_SIMD_AVX)
+constexpr uint32 SIMD_DECIMAL_NB_LANES = 8;
+#else
+constexpr uint32 SIMD_DECIMAL_NB_LANES = 4;
+#endif
+
+// Class SimdDecimal
+/**
+ * This class represents SIMD_DECIMAL_NB_LANES decimal values on which the same
+ * arithmetic operation is applied at once (AVX, SSE or NEON register). When no
+ * SIMD instruction set is available, the operations are applied on each lane
+ * with a loop.
+ */
+class SimdDecimal {
+
+    private:
+
+        // -------------------- Attributes -------------------- //
+
+#if defined(RP3D_SIMD_AVX)
+
+        /// Register with the values of the lanes
+        __m256 mValues;
+
+#elif defined(RP3D_SIMD_SSE)
+
+        /// Register with the values of the lanes
+        __m128 mValues;
+
+#elif defined(RP3D_SIMD_NEON)
+
+        /// Register with the values of the lanes
+        float32x4_t mValues;
+
+#else
+
+        /// Values of the lanes
+        decimal mValues[SIMD_DECIMAL_NB_LANES];
+
+#endif
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor (the values are not initialized)
+        SimdDecimal() = default;
+
+        /// Constructor with the same value in all the lanes
+        SimdDecimal(decimal value);
+
+        /// Return the values loaded from an array of SIMD_DECIMAL_NB_LANES decimals
+        static SimdDecimal load(const decimal* values);
+
+        /// Store the values into an array of SIMD_DECIMAL_NB_LANES decimals
+        void store(decimal* values) const;
+
+        /// Overloaded operator for addition with assignment
+        SimdDecimal& operator+=(const SimdDecimal& value);
+
+        /// Overloaded operator for substraction with assignment
+        SimdDecimal& operator-=(const SimdDecimal& value);
+
+        /// Return the minimum of each lane of two values
+        static SimdDecimal min(const SimdDecimal& value1, const SimdDecimal& value2);
+
+        /// Return the maximum of each lane of two values
+        static SimdDecimal max(const SimdDecimal& value1, const SimdDecimal& value2);
+
+        /// Return the square root of each lane of a value
+        static SimdDecimal sqrt(const SimdDecimal& value);
+
+        /// For each lane, return ifGreater if value1 > value2 and otherwise otherwise
+        static SimdDecimal selectGreater(const SimdDecimal& value1, const SimdDecimal& value2,
+                                         const SimdDecimal& ifGreater, const SimdDecimal& otherwise);
+
+        // -------------------- Friends -------------------- //
+
+        friend SimdDecimal operator+(const SimdDecimal& value1, const SimdDecimal& value2);
+        friend SimdDecimal operator-(const SimdDecimal& value1, const SimdDecimal& value2);
+        friend SimdDecimal operator-(const SimdDecimal& value);
+        friend SimdDecimal operator*(const SimdDecimal& value1, const SimdDecimal& value2);
+        friend SimdDecimal operator/(const SimdDecimal& value1, const SimdDecimal& value2);
+};
+
+#if defined(RP3D_SIMD_AVX)
+
+// Constructor with the same value in all the lanes
+inline SimdDecimal::SimdDecimal(decimal value) : mValues(_mm256_set1_ps(value)) {
+
+}
+
+// Return the values loaded from an array of SIMD_DECIMAL_NB_LANES decimals
+inline SimdDecimal SimdDecimal::load(const decimal* values) {
+    SimdDecimal result;
+    result.mValues = _mm256_loadu_ps(values);
+    return result;
+}
+
+// Store the values into an array of SIMD_DECIMAL_NB_LANES decimals
+inline void SimdDecimal::store(decimal* values) const {
+    _mm256_storeu_ps(values, mValues);
+}
+
+// Overloaded operator for addition with assignment
+inline SimdDecimal& SimdDecimal::operator+=(const SimdDecimal& value) {
+    mValues = _mm256_add_ps(mValues, value.mValues);
+    return *this;
+}
+
+// Overloaded operator for substraction with assignment
+inline SimdDecimal& SimdDecimal::operator-=(const SimdDecimal& value) {
+    mValues = _mm256_sub_ps(mValues, value.mValues);
+    return *this;
+}
+
+// Return the minimum of each lane of two values
+inline SimdDecimal SimdDecimal::min(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = _mm256_min_ps(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Return the maximum of each lane of two values
+inline SimdDecimal SimdDecimal::max(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = _mm256_max_ps(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Return the square root of each lane of a value
+inline SimdDecimal SimdDecimal::sqrt(const SimdDecimal& value) {
+    SimdDecimal result;
+    result.mValues = _mm256_sqrt_ps(value.mValues);
+    return result;
+}
+
+// For each lane, return ifGreater if value1 > value2 and otherwise otherwise
+inline SimdDecimal SimdDecimal::selectGreater(const SimdDecimal& value1, const SimdDecimal& value2,
+                                              const SimdDecimal& ifGreater, const SimdDecimal& otherwise) {
+    SimdDecimal result;
+    result.mValues = _mm256_blendv_ps(otherwise.mValues, ifGreater.mValues, _mm256_cmp_ps(value1.mValues, value2.mValues, _CMP_GT_OQ));
+    return result;
+}
+
+// Overloaded operator for addition
+inline SimdDecimal operator+(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = _mm256_add_ps(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Overloaded operator for substraction
+inline SimdDecimal operator-(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = _mm256_sub_ps(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Overloaded operator for the negative of a value
+inline SimdDecimal operator-(const SimdDecimal& value) {
+    SimdDecimal result;
+    result.mValues = _mm256_xor_ps(value.mValues, _mm256_set1_ps(-0.0f));
+    return result;
+}
+
+// Overloaded operator for multiplication
+inline SimdDecimal operator*(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = _mm256_mul_ps(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Overloaded operator for division
+inline SimdDecimal operator/(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = _mm256_div_ps(value1.mValues, value2.mValues);
+    return result;
+}
+
+#elif defined(RP3D_SIMD_SSE)
+
+// Constructor with the same value in all the lanes
+inline SimdDecimal::SimdDecimal(decimal value) : mValues(_mm_set1_ps(value)) {
+
+}
+
+// Return the values loaded from an array of SIMD_DECIMAL_NB_LANES decimals
+inline SimdDecimal SimdDecimal::load(const decimal* values) {
+    SimdDecimal result;
+    result.mValues = _mm_loadu_ps(values);
+    return result;
+}
+
+// Store the values into an array of SIMD_DECIMAL_NB_LANES decimals
+inline void SimdDecimal::store(decimal* values) const {
+    _mm_storeu_ps(values, mValues);
+}
+
+// Overloaded operator for addition with assignment
+inline SimdDecimal& SimdDecimal::operator+=(const SimdDecimal& value) {
+    mValues = _mm_add_ps(mValues, value.mValues);
+    return *this;
+}
+
+// Overloaded operator for substraction with assignment
+inline SimdDecimal& SimdDecimal::operator-=(const SimdDecimal& value) {
+    mValues = _mm_sub_ps(mValues, value.mValues);
+    return *this;
+}
+
+// Return the minimum of each lane of two values
+inline SimdDecimal SimdDecimal::min(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = _mm_min_ps(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Return the maximum of each lane of two values
+inline SimdDecimal SimdDecimal::max(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = _mm_max_ps(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Return the square root of each lane of a value
+inline SimdDecimal SimdDecimal::sqrt(const SimdDecimal& value) {
+    SimdDecimal result;
+    result.mValues = _mm_sqrt_ps(value.mValues);
+    return result;
+}
+
+// For each lane, return ifGreater if value1 > value2 and otherwise otherwise
+inline SimdDecimal SimdDecimal::selectGreater(const SimdDecimal& value1, const SimdDecimal& value2,
+                                              const SimdDecimal& ifGreater, const SimdDecimal& otherwise) {
+    const __m128 mask = _mm_cmpgt_ps(value1.mValues, value2.mValues);
+    SimdDecimal result;
+    result.mValues = _mm_or_ps(_mm_and_ps(mask, ifGreater.mValues), _mm_andnot_ps(mask, otherwise.mValues));
+    return result;
+}
+
+// Overloaded operator for addition
+inline SimdDecimal operator+(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = _mm_add_ps(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Overloaded operator for substraction
+inline SimdDecimal operator-(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = _mm_sub_ps(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Overloaded operator for the negative of a value
+inline SimdDecimal operator-(const SimdDecimal& value) {
+    SimdDecimal result;
+    result.mValues = _mm_xor_ps(value.mValues, _mm_set1_ps(-0.0f));
+    return result;
+}
+
+// Overloaded operator for multiplication
+inline SimdDecimal operator*(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = _mm_mul_ps(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Overloaded operator for division
+inline SimdDecimal operator/(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = _mm_div_ps(value1.mValues, value2.mValues);
+    return result;
+}
+
+#elif defined(RP3D_SIMD_NEON)
+
+// Constructor with the same value in all the lanes
+inline SimdDecimal::SimdDecimal(decimal value) : mValues(vdupq_n_f32(value)) {
+
+}
+
+// Return the values loaded from an array of SIMD_DECIMAL_NB_LANES decimals
+inline SimdDecimal SimdDecimal::load(const decimal* values) {
+    SimdDecimal result;
+    result.mValues = vld1q_f32(values);
+    return result;
+}
+
+// Store the values into an array of SIMD_DECIMAL_NB_LANES decimals
+inline void SimdDecimal::store(decimal* values) const {
+    vst1q_f32(values, mValues);
+}
+
+// Overloaded operator for addition with assignment
+inline SimdDecimal& SimdDecimal::operator+=(const SimdDecimal& value) {
+    mValues = vaddq_f32(mValues, value.mValues);
+    return *this;
+}
+
+// Overloaded operator for substraction with assignment
+inline SimdDecimal& SimdDecimal::operator-=(const SimdDecimal& value) {
+    mValues = vsubq_f32(mValues, value.mValues);
+    return *this;
+}
+
+// Return the minimum of each lane of two values
+inline SimdDecimal SimdDecimal::min(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = vminq_f32(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Return the maximum of each lane of two values
+inline SimdDecimal SimdDecimal::max(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = vmaxq_f32(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Return the square root of each lane of a value
+inline SimdDecimal SimdDecimal::sqrt(const SimdDecimal& value) {
+    SimdDecimal result;
+    result.mValues = vsqrtq_f32(value.mValues);
+    return result;
+}
+
+// For each lane, return ifGreater if value1 > value2 and otherwise otherwise
+inline SimdDecimal SimdDecimal::selectGreater(const SimdDecimal& value1, const SimdDecimal& value2,
+                                              const SimdDecimal& ifGreater, const SimdDecimal& otherwise) {
+    SimdDecimal result;
+    result.mValues = vbslq_f32(vcgtq_f32(value1.mValues, value2.mValues), ifGreater.mValues, otherwise.mValues);
+    return result;
+}
+
+// Overloaded operator for addition
+inline SimdDecimal operator+(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = vaddq_f32(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Overloaded operator for substraction
+inline SimdDecimal operator-(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = vsubq_f32(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Overloaded operator for the negative of a value
+inline SimdDecimal operator-(const SimdDecimal& value) {
+    SimdDecimal result;
+    result.mValues = vnegq_f32(value.mValues);
+    return result;
+}
+
+// Overloaded operator for multiplication
+inline SimdDecimal operator*(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = vmulq_f32(value1.mValues, value2.mValues);
+    return result;
+}
+
+// Overloaded operator for division
+inline SimdDecimal operator/(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    result.mValues = vdivq_f32(value1.mValues, value2.mValues);
+    return result;
+}
+
+#else
+
+// Constructor with the same value in all the lanes
+inline SimdDecimal::SimdDecimal(decimal value) {
+    for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) mValues[i] = value;
+}
+
+// Return the values loaded from an array of SIMD_DECIMAL_NB_LANES decimals
+inline SimdDecimal SimdDecimal::load(const decimal* values) {
+    SimdDecimal result;
+    for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) result.mValues[i] = values[i];
+    return result;
+}
+
+// Store the values into an array of SIMD_DECIMAL_NB_LANES decimals
+inline void SimdDecimal::store(decimal* values) const {
+    for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) values[i] = mValues[i];
+}
+
+// Overloaded operator for addition with assignment
+inline SimdDecimal& SimdDecimal::operator+=(const SimdDecimal& value) {
+    for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) mValues[i] += value.mValues[i];
+    return *this;
+}
+
+// Overloaded operator for substraction with assignment
+inline SimdDecimal& SimdDecimal::operator-=(const SimdDecimal& value) {
+    for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) mValues[i] -= value.mValues[i];
+    return *this;
+}
+
+// Return the minimum of each lane of two values
+inline SimdDecimal SimdDecimal::min(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) {
+        result.mValues[i] = value1.mValues[i] < value2.mValues[i] ? value1.mValues[i] : value2.mValues[i];
+    }
+    return result;
+}
+
+// Return the maximum of each lane of two values
+inline SimdDecimal SimdDecimal::max(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) {
+        result.mValues[i] = value1.mValues[i] > value2.mValues[i] ? value1.mValues[i] : value2.mValues[i];
+    }
+    return result;
+}
+
+// Return the square root of each lane of a value
+inline SimdDecimal SimdDecimal::sqrt(const SimdDecimal& value) {
+    SimdDecimal result;
+    for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) result.mValues[i] = std::sqrt(value.mValues[i]);
+    return result;
+}
+
+// For each lane, return ifGreater if value1 > value2 and otherwise otherwise
+inline SimdDecimal SimdDecimal::selectGreater(const SimdDecimal& value1, const SimdDecimal& value2,
+                                              const SimdDecimal& ifGreater, const SimdDecimal& otherwise) {
+    SimdDecimal result;
+    for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) {
+        result.mValues[i] = value1.mValues[i] > value2.mValues[i] ? ifGreater.mValues[i] : otherwise.mValues[i];
+    }
+    return result;
+}
+
+// Overloaded operator for addition
+inline SimdDecimal operator+(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result(value1);
+    return result += value2;
+}
+
+// Overloaded operator for substraction
+inline SimdDecimal operator-(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result(value1);
+    return result -= value2;
+}
+
+// Overloaded operator for the negative of a value
+inline SimdDecimal operator-(const SimdDecimal& value) {
+    SimdDecimal result;
+    for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) result.mValues[i] = -value.mValues[i];
+    return result;
+}
+
+// Overloaded operator for multiplication
+inline SimdDecimal operator*(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) result.mValues[i] = value1.mValues[i] * value2.mValues[i];
+    return result;
+}
+
+// Overloaded operator for division
+inline SimdDecimal operator/(const SimdDecimal& value1, const SimdDecimal& value2) {
+    SimdDecimal result;
+    for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) result.mValues[i] = value1.mValues[i] / value2.mValues[i];
+    return result;
+}
+
+#endif
+
+}
+
+#endif
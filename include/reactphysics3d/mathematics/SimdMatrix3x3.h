@@ -0,0 +1,111 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_SIMD_MATRIX3X3_H
+#define REACTPHYSICS3D_SIMD_MATRIX3X3_H
+
+// Libraries
+#include <reactphysics3d/mathematics/SimdVector3.h>
+#include <reactphysics3d/mathematics/Matrix3x3.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Structure Matrix3x3Lanes
+/**
+ * This structure stores SIMD_DECIMAL_NB_LANES 3x3 matrices as a structure of arrays
+ * so that they can be loaded into a SimdMatrix3x3.
+ */
+struct Matrix3x3Lanes {
+
+    public:
+
+        // -------------------- Attributes -------------------- //
+
+        /// Values of the matrices (row, column, lane)
+        decimal values[3][3][SIMD_DECIMAL_NB_LANES];
+
+        // -------------------- Methods -------------------- //
+
+        /// Set the matrix of a given lane
+        void setLane(uint32 lane, const Matrix3x3& matrix) {
+            assert(lane < SIMD_DECIMAL_NB_LANES);
+            for (int i=0; i < 3; i++) {
+                for (int j=0; j < 3; j++) {
+                    values[i][j][lane] = matrix[i][j];
+                }
+            }
+        }
+};
+
+// Class SimdMatrix3x3
+/**
+ * This class represents SIMD_DECIMAL_NB_LANES 3x3 matrices on which the same
+ * operation is applied at once.
+ */
+class SimdMatrix3x3 {
+
+    private:
+
+        // -------------------- Attributes -------------------- //
+
+        /// Rows of the matrices
+        SimdVector3 mRows[3];
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor (the values are not initialized)
+        SimdMatrix3x3() = default;
+
+        /// Return the matrices loaded from a structure of arrays
+        static SimdMatrix3x3 load(const Matrix3x3Lanes& matrices);
+
+        // -------------------- Friends -------------------- //
+
+        friend SimdVector3 operator*(const SimdMatrix3x3& matrix, const SimdVector3& vector);
+};
+
+// Return the matrices loaded from a structure of arrays
+inline SimdMatrix3x3 SimdMatrix3x3::load(const Matrix3x3Lanes& matrices) {
+    SimdMatrix3x3 result;
+    for (int i=0; i < 3; i++) {
+        result.mRows[i] = SimdVector3(SimdDecimal::load(matrices.values[i][0]), SimdDecimal::load(matrices.values[i][1]),
+                                      SimdDecimal::load(matrices.values[i][2]));
+    }
+    return result;
+}
+
+// Overloaded operator for multiplication with a vector
+inline SimdVector3 operator*(const SimdMatrix3x3& matrix, const SimdVector3& vector) {
+    return SimdVector3(matrix.mRows[0].x * vector.x + matrix.mRows[0].y * vector.y + matrix.mRows[0].z * vector.z,
+                       matrix.mRows[1].x * vector.x + matrix.mRows[1].y * vector.y + matrix.mRows[1].z * vector.z,
+                       matrix.mRows[2].x * vector.x + matrix.mRows[2].y * vector.y + matrix.mRows[2].z * vector.z);
+}
+
+}
+
+#endif
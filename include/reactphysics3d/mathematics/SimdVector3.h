@@ -0,0 +1,199 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_SIMD_VECTOR3_H
+#define REACTPHYSICS3D_SIMD_VECTOR3_H
+
+// Libraries
+#include <reactphysics3d/mathematics/SimdDecimal.h>
+#include <reactphysics3d/mathematics/Vector3.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Structure Vector3Lanes
+/**
+ * This structure stores SIMD_DECIMAL_NB_LANES 3D vectors as a structure of arrays
+ * so that they can be loaded into a SimdVector3.
+ */
+struct Vector3Lanes {
+
+    public:
+
+        // -------------------- Attributes -------------------- //
+
+        /// Component x of the vectors
+        decimal x[SIMD_DECIMAL_NB_LANES];
+
+        /// Component y of the vectors
+        decimal y[SIMD_DECIMAL_NB_LANES];
+
+        /// Component z of the vectors
+        decimal z[SIMD_DECIMAL_NB_LANES];
+
+        // -------------------- Methods -------------------- //
+
+        /// Set the vector of a given lane
+        void setLane(uint32 lane, const Vector3& vector) {
+            assert(lane < SIMD_DECIMAL_NB_LANES);
+            x[lane] = vector.x;
+            y[lane] = vector.y;
+            z[lane] = vector.z;
+        }
+
+        /// Return the vector of a given lane
+        Vector3 getLane(uint32 lane) const {
+            assert(lane < SIMD_DECIMAL_NB_LANES);
+            return Vector3(x[lane], y[lane], z[lane]);
+        }
+};
+
+// Structure SimdVector3
+/**
+ * This class represents SIMD_DECIMAL_NB_LANES 3D vectors on which the same
+ * operation is applied at once.
+ */
+struct SimdVector3 {
+
+    public:
+
+        // -------------------- Attributes -------------------- //
+
+        /// Component x of the vectors
+        SimdDecimal x;
+
+        /// Component y of the vectors
+        SimdDecimal y;
+
+        /// Component z of the vectors
+        SimdDecimal z;
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor (the components are not initialized)
+        SimdVector3() = default;
+
+        /// Constructor with arguments
+        SimdVector3(const SimdDecimal& newX, const SimdDecimal& newY, const SimdDecimal& newZ);
+
+        /// Return the vectors loaded from a structure of arrays
+        static SimdVector3 load(const Vector3Lanes& vectors);
+
+        /// Store the vectors into a structure of arrays
+        void store(Vector3Lanes& vectors) const;
+
+        /// Return the square of the length of the vectors
+        SimdDecimal lengthSquare() const;
+
+        /// Dot product of two vectors
+        SimdDecimal dot(const SimdVector3& vector) const;
+
+        /// Overloaded operator for addition with assignment
+        SimdVector3& operator+=(const SimdVector3& vector);
+
+        /// Overloaded operator for substraction with assignment
+        SimdVector3& operator-=(const SimdVector3& vector);
+
+        // -------------------- Friends -------------------- //
+
+        friend SimdVector3 operator+(const SimdVector3& vector1, const SimdVector3& vector2);
+        friend SimdVector3 operator-(const SimdVector3& vector1, const SimdVector3& vector2);
+        friend SimdVector3 operator-(const SimdVector3& vector);
+        friend SimdVector3 operator*(const SimdVector3& vector, const SimdDecimal& number);
+        friend SimdVector3 operator*(const SimdDecimal& number, const SimdVector3& vector);
+};
+
+// Constructor with arguments
+inline SimdVector3::SimdVector3(const SimdDecimal& newX, const SimdDecimal& newY, const SimdDecimal& newZ)
+            : x(newX), y(newY), z(newZ) {
+
+}
+
+// Return the vectors loaded from a structure of arrays
+inline SimdVector3 SimdVector3::load(const Vector3Lanes& vectors) {
+    return SimdVector3(SimdDecimal::load(vectors.x), SimdDecimal::load(vectors.y), SimdDecimal::load(vectors.z));
+}
+
+// Store the vectors into a structure of arrays
+inline void SimdVector3::store(Vector3Lanes& vectors) const {
+    x.store(vectors.x);
+    y.store(vectors.y);
+    z.store(vectors.z);
+}
+
+// Return the square of the length of the vectors
+inline SimdDecimal SimdVector3::lengthSquare() const {
+    return x * x + y * y + z * z;
+}
+
+// Dot product of two vectors
+inline SimdDecimal SimdVector3::dot(const SimdVector3& vector) const {
+    return x * vector.x + y * vector.y + z * vector.z;
+}
+
+// Overloaded operator for addition with assignment
+inline SimdVector3& SimdVector3::operator+=(const SimdVector3& vector) {
+    x += vector.x;
+    y += vector.y;
+    z += vector.z;
+    return *this;
+}
+
+// Overloaded operator for substraction with assignment
+inline SimdVector3& SimdVector3::operator-=(const SimdVector3& vector) {
+    x -= vector.x;
+    y -= vector.y;
+    z -= vector.z;
+    return *this;
+}
+
+// Overloaded operator for addition
+inline SimdVector3 operator+(const SimdVector3& vector1, const SimdVector3& vector2) {
+    return SimdVector3(vector1.x + vector2.x, vector1.y + vector2.y, vector1.z + vector2.z);
+}
+
+// Overloaded operator for substraction
+inline SimdVector3 operator-(const SimdVector3& vector1, const SimdVector3& vector2) {
+    return SimdVector3(vector1.x - vector2.x, vector1.y - vector2.y, vector1.z - vector2.z);
+}
+
+// Overloaded operator for the negative of a vector
+inline SimdVector3 operator-(const SimdVector3& vector) {
+    return SimdVector3(-vector.x, -vector.y, -vector.z);
+}
+
+// Overloaded operator for multiplication with a number
+inline SimdVector3 operator*(const SimdVector3& vector, const SimdDecimal& number) {
+    return SimdVector3(vector.x * number, vector.y * number, vector.z * number);
+}
+
+// Overloaded operator for multiplication with a number
+inline SimdVector3 operator*(const SimdDecimal& number, const SimdVector3& vector) {
+    return vector * number;
+}
+
+}
+
+#endif
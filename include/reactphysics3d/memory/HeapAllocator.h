@@ -72,11 +72,18 @@ class HeapAllocator : public MemoryAllocator {
                 /// True if the next memory unit has been allocated with the same call to malloc()
                 bool isNextContiguousMemory;
 
+                /// Pointer to the previous free memory unit (if the unit is not allocated)
+                MemoryUnitHeader* previousFreeUnit;
+
+                /// Pointer to the next free memory unit (if the unit is not allocated)
+                MemoryUnitHeader* nextFreeUnit;
+
                 // -------------------- Methods -------------------- //
 
                 MemoryUnitHeader(size_t size, MemoryUnitHeader* previousUnit, MemoryUnitHeader* nextUnit, bool isNextContiguousMemory)
                     : size(size), isAllocated(false), previousUnit(previousUnit),
-                      nextUnit(nextUnit), isNextContiguousMemory(isNextContiguousMemory) {
+                      nextUnit(nextUnit), isNextContiguousMemory(isNextContiguousMemory),
+                      previousFreeUnit(nullptr), nextFreeUnit(nullptr) {
 
                     assert(size > 0);
                 }
@@ -101,6 +108,10 @@ class HeapAllocator : public MemoryAllocator {
         /// Pointer to the first memory unit of the linked-list
         MemoryUnitHeader* mMemoryUnits;
 
+        /// Pointer to the first memory unit of the linked-list of free memory units. An allocation
+        /// only needs to visit the free units and not all the allocated ones
+        MemoryUnitHeader* mFreeUnits;
+
         /// Pointer to a cached free memory unit
         MemoryUnitHeader* mCachedFreeUnit;
 
@@ -124,6 +135,12 @@ class HeapAllocator : public MemoryAllocator {
         /// Reserve more memory for the allocator
         void reserve(size_t sizeToAllocate);
 
+        /// Add a memory unit into the linked-list of free memory units
+        void addFreeUnit(MemoryUnitHeader* unit);
+
+        /// Remove a memory unit from the linked-list of free memory units
+        void removeFreeUnit(MemoryUnitHeader* unit);
+
     public :
 
         // -------------------- Methods -------------------- //
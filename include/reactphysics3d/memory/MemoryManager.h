@@ -29,6 +29,7 @@
 // Libraries
 #include <reactphysics3d/memory/DefaultAllocator.h>
 #include <reactphysics3d/memory/PoolAllocator.h>
+#include <reactphysics3d/memory/PoolAllocatorCache.h>
 #include <reactphysics3d/memory/HeapAllocator.h>
 #include <reactphysics3d/memory/SingleFrameAllocator.h>
 
@@ -46,25 +47,65 @@ class MemoryAllocator;
  * The SingleFrameAllocator is used for memory that is allocated only during a frame and the PoolAllocator
  * is used to allocated objects of small size. Both SingleFrameAllocator and PoolAllocator will fall back to
  * HeapAllocator if an allocation request cannot be fulfilled.
+ * The memory manager also has allocators for each thread of the task scheduler running a simulation step.
+ * Each thread has its own SingleFrameAllocator and its own cache of the PoolAllocator that are used without
+ * locking any mutex. The frame allocator of the thread with index zero (the thread running the simulation step)
+ * is the single frame allocator of the memory manager. The frame allocators of all the threads are reset
+ * at the end of each step.
+ * Each physics world has its own memory manager that uses the base, heap and pool allocators of the memory
+ * manager of the PhysicsCommon but owns the allocators of its threads. This way, two worlds created with the
+ * same PhysicsCommon can be updated at the same time by different threads.
  */
 class MemoryManager {
 
     private:
 
+        // Structure ThreadAllocators
+        /**
+         * The allocators used by a single thread
+         */
+        struct ThreadAllocators {
+
+            /// Single frame stack allocator of the thread
+            SingleFrameAllocator frameAllocator;
+
+            /// Cache of the pool allocator of the thread
+            PoolAllocatorCache poolAllocator;
+
+            /// Constructor
+            ThreadAllocators(MemoryAllocator& heapAllocator, PoolAllocator& poolAllocator, size_t frameAllocatorInitSize)
+                : frameAllocator(heapAllocator, false, frameAllocatorInitSize), poolAllocator(poolAllocator) {
+
+            }
+        };
+
+        // -------------------- Constants -------------------- //
+
+        /// Initial size (in bytes) of the frame allocators of the threads with an index larger than zero
+        static const size_t INIT_THREAD_FRAME_ALLOCATOR_NB_BYTES = 65536;
+
+        // -------------------- Attributes -------------------- //
+
        /// Default malloc/free memory allocator
        DefaultAllocator mDefaultAllocator;
 
        /// Pointer to the base memory allocator to use
        MemoryAllocator* mBaseAllocator;
 
-       /// Memory heap allocator
-       HeapAllocator mHeapAllocator;
+       /// Memory heap allocator (owned or shared with another memory manager)
+       HeapAllocator* mHeapAllocator;
+
+       /// Memory pool allocator (owned or shared with another memory manager)
+       PoolAllocator* mPoolAllocator;
+
+       /// True if the heap and pool allocators are owned by this memory manager
+       bool mIsOwningAllocators;
 
-       /// Memory pool allocator
-       PoolAllocator mPoolAllocator;
+       /// Allocators of each thread
+       ThreadAllocators** mThreadAllocators;
 
-       /// Single frame stack allocator
-       SingleFrameAllocator mSingleFrameAllocator;
+       /// Number of threads with allocators
+       uint32 mNbThreadAllocators;
 
     public:
 
@@ -79,8 +120,17 @@ class MemoryManager {
        /// Constructor
        MemoryManager(MemoryAllocator* baseAllocator, size_t initAllocatedMemory = 0);
 
+       /// Constructor of a memory manager that shares the allocators of another one except for the thread allocators
+       MemoryManager(MemoryManager& sharedMemoryManager, uint32 nbThreads);
+
        /// Destructor
-       ~MemoryManager() = default;
+       ~MemoryManager();
+
+       /// Deleted copy-constructor
+       MemoryManager(const MemoryManager& memoryManager) = delete;
+
+       /// Deleted assignment operator
+       MemoryManager& operator=(const MemoryManager& memoryManager) = delete;
 
         /// Allocate memory of a given type
         void* allocate(AllocationType allocationType, size_t size);
@@ -97,7 +147,19 @@ class MemoryManager {
         /// Return the heap allocator
         HeapAllocator& getHeapAllocator();
 
-        /// Reset the single frame allocator
+        /// Make sure that the threads with index in [0, nbThreads) have allocators
+        void reserveThreadAllocators(uint32 nbThreads);
+
+        /// Return the number of threads with allocators
+        uint32 getNbThreadAllocators() const;
+
+        /// Return the single frame allocator of a given thread
+        SingleFrameAllocator& getThreadFrameAllocator(uint32 threadIndex);
+
+        /// Return the cache of the pool allocator of a given thread
+        PoolAllocatorCache& getThreadPoolAllocator(uint32 threadIndex);
+
+        /// Reset the single frame allocators of all the threads
         void resetFrameAllocator();
 };
 
@@ -106,9 +168,9 @@ inline void* MemoryManager::allocate(AllocationType allocationType, size_t size)
 
     switch (allocationType) {
        case AllocationType::Base: return mBaseAllocator->allocate(size);
-       case AllocationType::Pool: return mPoolAllocator.allocate(size);
-       case AllocationType::Heap: return mHeapAllocator.allocate(size);
-       case AllocationType::Frame: return mSingleFrameAllocator.allocate(size);
+       case AllocationType::Pool: return mPoolAllocator->allocate(size);
+       case AllocationType::Heap: return mHeapAllocator->allocate(size);
+       case AllocationType::Frame: return getSingleFrameAllocator().allocate(size);
     }
 
     return nullptr;
@@ -119,30 +181,52 @@ inline void MemoryManager::release(AllocationType allocationType, void* pointer,
 
     switch (allocationType) {
        case AllocationType::Base: mBaseAllocator->release(pointer, size); break;
-       case AllocationType::Pool: mPoolAllocator.release(pointer, size); break;
-       case AllocationType::Heap: mHeapAllocator.release(pointer, size); break;
-       case AllocationType::Frame: mSingleFrameAllocator.release(pointer, size); break;
+       case AllocationType::Pool: mPoolAllocator->release(pointer, size); break;
+       case AllocationType::Heap: mHeapAllocator->release(pointer, size); break;
+       case AllocationType::Frame: getSingleFrameAllocator().release(pointer, size); break;
     }
 }
 
 // Return the pool allocator
 inline PoolAllocator& MemoryManager::getPoolAllocator() {
-   return mPoolAllocator;
+   return *mPoolAllocator;
 }
 
 // Return the single frame stack allocator
+/// This is the frame allocator of the thread with index zero. It is not thread-safe and must only
+/// be used by the thread running the simulation step.
 inline SingleFrameAllocator& MemoryManager::getSingleFrameAllocator() {
-   return mSingleFrameAllocator;
+   return mThreadAllocators[0]->frameAllocator;
 }
 
 // Return the heap allocator
 inline HeapAllocator& MemoryManager::getHeapAllocator() {
-   return mHeapAllocator;
+   return *mHeapAllocator;
+}
+
+// Return the number of threads with allocators
+inline uint32 MemoryManager::getNbThreadAllocators() const {
+    return mNbThreadAllocators;
 }
 
-// Reset the single frame allocator
-inline void MemoryManager::resetFrameAllocator() {
-   mSingleFrameAllocator.reset();
+// Return the single frame allocator of a given thread
+/**
+ * @param threadIndex Index of the thread (given by the task scheduler)
+ * @return The single frame allocator that only this thread can use
+ */
+inline SingleFrameAllocator& MemoryManager::getThreadFrameAllocator(uint32 threadIndex) {
+    assert(threadIndex < mNbThreadAllocators);
+    return mThreadAllocators[threadIndex]->frameAllocator;
+}
+
+// Return the cache of the pool allocator of a given thread
+/**
+ * @param threadIndex Index of the thread (given by the task scheduler)
+ * @return The cache of the pool allocator that only this thread can use
+ */
+inline PoolAllocatorCache& MemoryManager::getThreadPoolAllocator(uint32 threadIndex) {
+    assert(threadIndex < mNbThreadAllocators);
+    return mThreadAllocators[threadIndex]->poolAllocator;
 }
 
 }
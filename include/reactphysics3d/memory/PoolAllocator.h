@@ -128,6 +128,20 @@ class PoolAllocator : public MemoryAllocator {
         int mNbTimesAllocateMethodCalled;
 #endif
 
+        // -------------------- Methods -------------------- //
+
+        /// Return a free memory unit of a given heap (the mutex must be locked)
+        void* allocateUnit(int indexHeap);
+
+        /// Insert a memory unit into the free memory units of a given heap (the mutex must be locked)
+        void releaseUnit(int indexHeap, void* pointer);
+
+        /// Allocate several memory units of the same size with a single lock of the mutex
+        void allocateUnits(int indexHeap, uint nbUnits, void** units);
+
+        /// Release several memory units of the same size with a single lock of the mutex
+        void releaseUnits(int indexHeap, uint nbUnits, void** units);
+
     public :
 
         // -------------------- Methods -------------------- //
@@ -147,6 +161,10 @@ class PoolAllocator : public MemoryAllocator {
 
         /// Release previously allocated memory.
         virtual void release(void* pointer, size_t size) override;
+
+        // -------------------- Friendship -------------------- //
+
+        friend class PoolAllocatorCache;
 };
 
 }
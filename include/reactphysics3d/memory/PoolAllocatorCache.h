@@ -0,0 +1,93 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_POOL_ALLOCATOR_CACHE_H
+#define REACTPHYSICS3D_POOL_ALLOCATOR_CACHE_H
+
+// Libraries
+#include <reactphysics3d/memory/PoolAllocator.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Class PoolAllocatorCache
+/**
+ * This class is a cache of memory units of a PoolAllocator used by a single thread.
+ * For each size of memory units, the cache keeps a small array (magazine) of free
+ * memory units. The allocations and releases are served from the magazine without
+ * locking the mutex of the pool allocator. The mutex is only locked to refill an empty
+ * magazine or to give back half of a full magazine to the pool allocator. Since the
+ * cache is not thread-safe, each thread must use its own cache.
+ */
+class PoolAllocatorCache : public MemoryAllocator {
+
+    private :
+
+        // -------------------- Constants -------------------- //
+
+        /// Maximum number of free memory units in the magazine of each heap
+        static const uint MAGAZINE_SIZE = 16;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Pool allocator where the memory units come from
+        PoolAllocator& mPoolAllocator;
+
+        /// Free memory units of each heap of the pool allocator
+        void* mMagazines[PoolAllocator::NB_HEAPS][MAGAZINE_SIZE];
+
+        /// Number of free memory units in the magazine of each heap
+        uint mNbUnitsInMagazines[PoolAllocator::NB_HEAPS];
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        PoolAllocatorCache(PoolAllocator& poolAllocator);
+
+        /// Destructor
+        virtual ~PoolAllocatorCache() override;
+
+        /// Deleted copy-constructor
+        PoolAllocatorCache(const PoolAllocatorCache& cache) = delete;
+
+        /// Deleted assignment operator
+        PoolAllocatorCache& operator=(const PoolAllocatorCache& cache) = delete;
+
+        /// Allocate memory of a given size (in bytes) and return a pointer to the
+        /// allocated memory.
+        virtual void* allocate(size_t size) override;
+
+        /// Release previously allocated memory.
+        virtual void release(void* pointer, size_t size) override;
+
+        /// Give back all the free memory units of the cache to the pool allocator
+        void flush();
+};
+
+}
+
+#endif
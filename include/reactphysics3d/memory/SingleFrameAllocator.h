@@ -37,7 +37,9 @@ namespace reactphysics3d {
 // Class SingleFrameAllocator
 /**
  * This class represent a memory allocator used to efficiently allocate
- * memory on the heap that is used during a single frame.
+ * memory on the heap that is used during a single frame. An allocator that
+ * is only used by a single thread can be created without thread-safety in
+ * order to avoid locking a mutex at each allocation.
  */
 class SingleFrameAllocator : public MemoryAllocator {
 
@@ -49,14 +51,14 @@ class SingleFrameAllocator : public MemoryAllocator {
         /// memory if too much is allocated
         static const int NB_FRAMES_UNTIL_SHRINK = 120;
 
-        /// Initial size (in bytes) of the single frame allocator
-        size_t INIT_SINGLE_FRAME_ALLOCATOR_NB_BYTES = 1048576; // 1Mb
-
         // -------------------- Attributes -------------------- //
 
         /// Mutex
         std::mutex mMutex;
 
+        /// True if the allocator can be used by several threads at the same time
+        bool mIsThreadSafe;
+
         /// Reference to the base memory allocator
         MemoryAllocator& mBaseAllocator;
 
@@ -78,10 +80,16 @@ class SingleFrameAllocator : public MemoryAllocator {
 
     public :
 
+        // -------------------- Constants -------------------- //
+
+        /// Initial size (in bytes) of the single frame allocator
+        static const size_t INIT_SINGLE_FRAME_ALLOCATOR_NB_BYTES = 1048576; // 1Mb
+
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        SingleFrameAllocator(MemoryAllocator& baseAllocator);
+        SingleFrameAllocator(MemoryAllocator& baseAllocator, bool isThreadSafe = true,
+                             size_t initSizeBytes = INIT_SINGLE_FRAME_ALLOCATOR_NB_BYTES);
 
         /// Destructor
         virtual ~SingleFrameAllocator() override;
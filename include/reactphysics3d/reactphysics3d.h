@@ -43,6 +43,8 @@
 #include <reactphysics3d/engine/PhysicsWorld.h>
 #include <reactphysics3d/engine/Material.h>
 #include <reactphysics3d/engine/EventListener.h>
+#include <reactphysics3d/engine/TaskScheduler.h>
+#include <reactphysics3d/engine/DefaultTaskScheduler.h>
 #include <reactphysics3d/collision/shapes/CollisionShape.h>
 #include <reactphysics3d/collision/shapes/BoxShape.h>
 #include <reactphysics3d/collision/shapes/SphereShape.h>
@@ -58,6 +60,8 @@
 #include <reactphysics3d/collision/PolyhedronMesh.h>
 #include <reactphysics3d/collision/TriangleVertexArray.h>
 #include <reactphysics3d/collision/PolygonVertexArray.h>
+#include <reactphysics3d/collision/MeshCooker.h>
+#include <reactphysics3d/utils/MemoryMappedFile.h>
 #include <reactphysics3d/collision/CollisionCallback.h>
 #include <reactphysics3d/collision/OverlapCallback.h>
 #include <reactphysics3d/constraint/BallAndSocketJoint.h>
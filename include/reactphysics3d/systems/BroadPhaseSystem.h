@@ -28,11 +28,14 @@
 
 // Libraries
 #include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/collision/broadphase/BroadPhaseStrategy.h>
 #include <reactphysics3d/containers/LinkedList.h>
 #include <reactphysics3d/containers/Set.h>
+#include <reactphysics3d/containers/FlatSet.h>
 #include <reactphysics3d/components/ColliderComponents.h>
 #include <reactphysics3d/components/TransformComponents.h>
 #include <reactphysics3d/components/RigidBodyComponents.h>
+#include <reactphysics3d/engine/TaskScheduler.h>
 #include <cstring>
 
 /// Namespace ReactPhysics3D
@@ -66,14 +69,14 @@ class AABBOverlapCallback : public DynamicAABBTreeOverlapCallback {
 
 // Class BroadPhaseRaycastCallback
 /**
- * Callback called when the AABB of a leaf node is hit by a ray the
- * broad-phase Dynamic AABB Tree.
+ * Callback called when the fat AABB of a collider is hit by a ray in the
+ * broad-phase data structure.
  */
 class BroadPhaseRaycastCallback : public DynamicAABBTreeRaycastCallback {
 
     private :
 
-        const DynamicAABBTree& mDynamicAABBTree;
+        const BroadPhaseStrategy& mBroadPhaseStrategy;
 
         unsigned short mRaycastWithCategoryMaskBits;
 
@@ -82,9 +85,9 @@ class BroadPhaseRaycastCallback : public DynamicAABBTreeRaycastCallback {
     public:
 
         // Constructor
-        BroadPhaseRaycastCallback(const DynamicAABBTree& dynamicAABBTree, unsigned short raycastWithCategoryMaskBits,
+        BroadPhaseRaycastCallback(const BroadPhaseStrategy& broadPhaseStrategy, unsigned short raycastWithCategoryMaskBits,
                                   RaycastTest& raycastTest)
-            : mDynamicAABBTree(dynamicAABBTree), mRaycastWithCategoryMaskBits(raycastWithCategoryMaskBits),
+            : mBroadPhaseStrategy(broadPhaseStrategy), mRaycastWithCategoryMaskBits(raycastWithCategoryMaskBits),
               mRaycastTest(raycastTest) {
 
         }
@@ -102,8 +105,9 @@ class BroadPhaseRaycastCallback : public DynamicAABBTreeRaycastCallback {
  * This class represents the broad-phase collision detection. The
  * goal of the broad-phase collision detection is to compute the pairs of colliders
  * that have their AABBs overlapping. Only those pairs of bodies will be tested
- * later for collision during the narrow-phase collision detection. A dynamic AABB
- * tree data structure is used for fast broad-phase collision detection.
+ * later for collision during the narrow-phase collision detection. The fat AABBs of
+ * the colliders are stored in a broad-phase data structure (a dynamic AABB tree by
+ * default) that is selected with the WorldSettings of the world.
  */
 class BroadPhaseSystem {
 
@@ -111,8 +115,11 @@ class BroadPhaseSystem {
 
         // -------------------- Attributes -------------------- //
 
-        /// Dynamic AABB tree
-        DynamicAABBTree mDynamicAABBTree;
+        /// Memory allocator of the broad-phase data structure
+        MemoryAllocator& mAllocator;
+
+        /// Broad-phase data structure with the fat AABBs of the colliders
+        BroadPhaseStrategy* mBroadPhaseStrategy;
 
         /// Reference to the colliders components
         ColliderComponents& mCollidersComponents;
@@ -126,11 +133,22 @@ class BroadPhaseSystem {
         /// Set with the broad-phase IDs of all collision shapes that have moved (or have been
         /// created) during the last simulation step. Those are the shapes that need to be tested
         /// for overlapping in the next simulation step.
-        Set<int> mMovedShapes;
+        FlatSet<int> mMovedShapes;
+
+        /// For each task of the overlap query, the overlapping pairs found by the task. Those
+        /// buffers are merged in the order of the tasks so that the result does not depend on the threads
+        List<List<Pair<int32, int32>>> mOverlappingPairsBuffers;
 
         /// Reference to the collision detection object
         CollisionDetectionSystem& mCollisionDetection;
 
+        /// Task scheduler used to compute the AABBs and the overlapping pairs of the colliders in parallel
+        TaskScheduler& mTaskScheduler;
+
+        /// Multiplier of the linear displacement of a body during a time step used to extend the
+        /// fat AABBs of its colliders
+        decimal mFatAABBDisplacementMultiplier;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Pointer to the profiler
@@ -141,21 +159,26 @@ class BroadPhaseSystem {
 
         /// Notify the Dynamic AABB tree that a collider needs to be updated
         void updateColliderInternal(int32 broadPhaseId, Collider* collider, const AABB& aabb,
-                                    bool forceReInsert);
+                                    const Vector3& displacement, bool forceReInsert);
 
         /// Update the broad-phase state of some colliders components
         void updateCollidersComponents(uint32 startIndex, uint32 nbItems, decimal timeStep);
 
+        /// Remove the self-pairs and the pairs reported twice from the pairs found by a task of the overlap query
+        void removeDuplicatedPairs(List<Pair<int32, int32>>& overlappingPairs) const;
+
     public :
 
         // -------------------- Methods -------------------- //
 
         /// Constructor
         BroadPhaseSystem(CollisionDetectionSystem& collisionDetection, ColliderComponents& collidersComponents,
-                         TransformComponents& transformComponents, RigidBodyComponents& rigidBodyComponents);
+                         TransformComponents& transformComponents, RigidBodyComponents& rigidBodyComponents,
+                         TaskScheduler& taskScheduler, BroadPhaseType broadPhaseType, decimal fatAABBInflatePercentage,
+                         decimal fatAABBDisplacementMultiplier);
 
         /// Destructor
-        ~BroadPhaseSystem() = default;
+        ~BroadPhaseSystem();
 
         /// Deleted copy-constructor
         BroadPhaseSystem(const BroadPhaseSystem& algorithm) = delete;
@@ -198,6 +221,15 @@ class BroadPhaseSystem {
         /// Ray casting method
         void raycast(const Ray& ray, RaycastTest& raycastTest, unsigned short raycastWithCategoryMaskBits) const;
 
+        /// Return the type of the broad-phase data structure
+        BroadPhaseType getBroadPhaseType() const;
+
+        /// Rebuild the broad-phase data structure from all the colliders
+        void rebuild();
+
+        /// Compute the surface area heuristic (SAH) cost of the broad-phase data structure
+        decimal computeSAHCost() const;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
@@ -209,7 +241,22 @@ class BroadPhaseSystem {
 
 // Return the fat AABB of a given broad-phase shape
 inline const AABB& BroadPhaseSystem::getFatAABB(int broadPhaseId) const  {
-    return mDynamicAABBTree.getFatAABB(broadPhaseId);
+    return mBroadPhaseStrategy->getFatAABB(broadPhaseId);
+}
+
+// Return the type of the broad-phase data structure
+inline BroadPhaseType BroadPhaseSystem::getBroadPhaseType() const {
+    return mBroadPhaseStrategy->getType();
+}
+
+// Rebuild the broad-phase data structure from all the colliders
+inline void BroadPhaseSystem::rebuild() {
+    mBroadPhaseStrategy->rebuild();
+}
+
+// Compute the surface area heuristic (SAH) cost of the broad-phase data structure
+inline decimal BroadPhaseSystem::computeSAHCost() const {
+    return mBroadPhaseStrategy->computeSAHCost();
 }
 
 // Remove a collider from the array of colliders that have moved in the last simulation step
@@ -222,7 +269,7 @@ inline void BroadPhaseSystem::removeMovedCollider(int broadPhaseID) {
 
 // Return the collider corresponding to the broad-phase node id in parameter
 inline Collider* BroadPhaseSystem::getColliderForBroadPhaseId(int broadPhaseId) const {
-    return static_cast<Collider*>(mDynamicAABBTree.getNodeDataPointer(broadPhaseId));
+    return static_cast<Collider*>(mBroadPhaseStrategy->getObjectData(broadPhaseId));
 }
 
 #ifdef IS_RP3D_PROFILING_ENABLED
@@ -230,7 +277,7 @@ inline Collider* BroadPhaseSystem::getColliderForBroadPhaseId(int broadPhaseId)
 // Set the profiler
 inline void BroadPhaseSystem::setProfiler(Profiler* profiler) {
 	mProfiler = profiler;
-	mDynamicAABBTree.setProfiler(profiler);
+	mBroadPhaseStrategy->setProfiler(profiler);
 }
 
 #endif
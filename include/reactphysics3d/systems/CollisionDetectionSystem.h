@@ -38,11 +38,15 @@
 #include <reactphysics3d/engine/OverlappingPairs.h>
 #include <reactphysics3d/engine/OverlappingPairs.h>
 #include <reactphysics3d/collision/narrowphase/NarrowPhaseInput.h>
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseStatistics.h>
 #include <reactphysics3d/collision/narrowphase/CollisionDispatch.h>
 #include <reactphysics3d/containers/Map.h>
 #include <reactphysics3d/containers/Set.h>
+#include <reactphysics3d/containers/FlatMap.h>
+#include <reactphysics3d/containers/FlatSet.h>
 #include <reactphysics3d/components/ColliderComponents.h>
 #include <reactphysics3d/components/TransformComponents.h>
+#include <reactphysics3d/engine/TaskScheduler.h>
 
 /// ReactPhysics3D namespace
 namespace reactphysics3d {
@@ -70,6 +74,12 @@ class CollisionDetectionSystem {
 
         using OverlappingPairMap = Map<Pair<uint, uint>, OverlappingPair*>;
 
+        /// Narrow-phase test of the items in a range of a batch. The arguments are the index of the first
+        /// item, the number of items, the memory allocator to use for the temporary memory of the test and
+        /// the statistics of the tests of the range
+        using NarrowPhaseBatchTest = std::function<bool(uint batchStartIndex, uint batchNbItems, MemoryAllocator& allocator,
+                                                        NarrowPhaseStatistics& statistics)>;
+
         // -------------------- Constants -------------------- //
 
         /// Maximum number of contact points in a reduced contact manifold
@@ -80,6 +90,9 @@ class CollisionDetectionSystem {
         /// Memory manager
         MemoryManager& mMemoryManager;
 
+        /// Task scheduler used to split the work between threads
+        TaskScheduler& mTaskScheduler;
+
         /// Reference the collider components
         ColliderComponents& mCollidersComponents;
 
@@ -90,7 +103,7 @@ class CollisionDetectionSystem {
         PhysicsWorld* mWorld;
 
         /// Set of pair of bodies that cannot collide between each other
-        Set<bodypair> mNoCollisionPairs;
+        FlatSet<bodypair> mNoCollisionPairs;
 
         /// Broad-phase overlapping pairs
         OverlappingPairs mOverlappingPairs;
@@ -99,11 +112,14 @@ class CollisionDetectionSystem {
         BroadPhaseSystem mBroadPhaseSystem;
 
         /// Map a broad-phase id with the corresponding entity of the collider
-        Map<int, Entity> mMapBroadPhaseIdToColliderEntity;
+        FlatMap<int, Entity> mMapBroadPhaseIdToColliderEntity;
 
         /// Narrow-phase collision detection input
         NarrowPhaseInput mNarrowPhaseInput;
 
+        /// Statistics of the narrow-phase collision detection of the last update
+        NarrowPhaseStatistics mNarrowPhaseStatistics;
+
         /// List of the potential contact points
         List<ContactPointInfo> mPotentialContactPoints;
 
@@ -126,18 +142,18 @@ class CollisionDetectionSystem {
         List<ContactPair> mLostContactPairs;
 
         /// First map of overlapping pair id to the index of the corresponding pair contact
-        Map<uint64, uint> mMapPairIdToContactPairIndex1;
+        FlatMap<uint64, uint> mMapPairIdToContactPairIndex1;
 
         /// Second map of overlapping pair id to the index of the corresponding pair contact
-        Map<uint64, uint> mMapPairIdToContactPairIndex2;
+        FlatMap<uint64, uint> mMapPairIdToContactPairIndex2;
 
         /// Pointer to the map of overlappingPairId to the index of contact pair of the previous frame
         /// (either mMapPairIdToContactPairIndex1 or mMapPairIdToContactPairIndex2)
-        Map<uint64, uint>* mPreviousMapPairIdToContactPairIndex;
+        FlatMap<uint64, uint>* mPreviousMapPairIdToContactPairIndex;
 
         /// Pointer to the map of overlappingPairId to the index of contact pair of the current frame
         /// (either mMapPairIdToContactPairIndex1 or mMapPairIdToContactPairIndex2)
-        Map<uint64, uint>* mCurrentMapPairIdToContactPairIndex;
+        FlatMap<uint64, uint>* mCurrentMapPairIdToContactPairIndex;
 
         /// First list with the contact manifolds
         List<ContactManifold> mContactManifolds1;
@@ -179,7 +195,7 @@ class CollisionDetectionSystem {
         void computeBroadPhase();
 
         /// Compute the middle-phase collision detection
-        void computeMiddlePhase(NarrowPhaseInput& narrowPhaseInput, bool needToReportContacts);
+        void computeMiddlePhase(NarrowPhaseInput& narrowPhaseInput, bool needToReportContacts, bool isWorldUpdate);
 
         // Compute the middle-phase collision detection
         void computeMiddlePhaseCollisionSnapshot(List<uint64>& convexPairs, List<uint64>& concavePairs, NarrowPhaseInput& narrowPhaseInput,
@@ -199,7 +215,7 @@ class CollisionDetectionSystem {
 
         /// Convert the potential contact into actual contacts
         void computeOverlapSnapshotContactPairs(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, List<ContactPair>& contactPairs,
-                                         Set<uint64>& setOverlapContactPairId) const;
+                                         FlatSet<uint64>& setOverlapContactPairId) const;
 
         /// Take a list of overlapping nodes in the broad-phase and create new overlapping pairs if necessary
         void updateOverlappingPairs(const List<Pair<int32, int32> >& overlappingNodes);
@@ -211,25 +227,34 @@ class CollisionDetectionSystem {
         void addLostContactPair(uint64 overlappingPairIndex);
 
         /// Execute the narrow-phase collision detection algorithm on batches
-        bool testNarrowPhaseCollision(NarrowPhaseInput& narrowPhaseInput, bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& allocator);
+        bool testNarrowPhaseCollision(NarrowPhaseInput& narrowPhaseInput, bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& allocator,
+                                      NarrowPhaseStatistics& statistics);
+
+        /// Execute a narrow-phase collision detection test on the items of a batch in parallel
+        bool testNarrowPhaseBatchInParallel(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, MemoryAllocator& allocator,
+                                            NarrowPhaseStatistics& statistics, const NarrowPhaseBatchTest& testItems);
 
         /// Compute the concave vs convex middle-phase algorithm for a given pair of bodies
         void computeConvexVsConcaveMiddlePhase(uint64 pairIndex, MemoryAllocator& allocator,
                                                NarrowPhaseInput& narrowPhaseInput);
 
+        /// Reuse the contacts of the previous frame of an overlapping pair at rest instead of computing them with the narrow-phase
+        bool reuseRestingPairContacts(uint64 pairIndex, bool reportContacts, decimal cosHalfMaxAngle,
+                                      NarrowPhaseInput& narrowPhaseInput);
+
         /// Swap the previous and current contacts lists
         void swapPreviousAndCurrentContacts();
 
         /// Convert the potential contact into actual contacts
         void processPotentialContacts(NarrowPhaseInfoBatch& narrowPhaseInfoBatch,
                                       bool updateLastFrameInfo, List<ContactPointInfo>& potentialContactPoints,
-                                      Map<uint64, uint>* mapPairIdToContactPairIndex,
+                                      FlatMap<uint64, uint>* mapPairIdToContactPairIndex,
                                       List<ContactManifoldInfo>& potentialContactManifolds, List<ContactPair>* contactPairs,
                                       Map<Entity, List<uint>>& mapBodyToContactPairs);
 
         /// Process the potential contacts after narrow-phase collision detection
         void processAllPotentialContacts(NarrowPhaseInput& narrowPhaseInput, bool updateLastFrameInfo, List<ContactPointInfo>& potentialContactPoints,
-                                         Map<uint64, uint>* mapPairIdToContactPairIndex,
+                                         FlatMap<uint64, uint>* mapPairIdToContactPairIndex,
                                          List<ContactManifoldInfo>& potentialContactManifolds, List<ContactPair>* contactPairs,
                                          Map<Entity, List<uint>>& mapBodyToContactPairs);
 
@@ -237,8 +262,8 @@ class CollisionDetectionSystem {
         void reducePotentialContactManifolds(List<ContactPair>* contactPairs, List<ContactManifoldInfo>& potentialContactManifolds,
                                              const List<ContactPointInfo>& potentialContactPoints) const;
 
-        /// Create the actual contact manifolds and contacts points (from potential contacts) for a given contact pair
-        void createContacts();
+        /// Create the actual contact manifolds and contacts points (from potential contacts) of the contact pairs
+        void createContacts(const List<uint>& islandsContactPairs);
 
         /// Compute the lost contact pairs (contact pairs in contact in the previous frame but not in the current one)
         void computeLostContactPairs();
@@ -286,7 +311,8 @@ class CollisionDetectionSystem {
         /// Constructor
         CollisionDetectionSystem(PhysicsWorld* world, ColliderComponents& collidersComponents,
                            TransformComponents& transformComponents, CollisionBodyComponents& collisionBodyComponents, RigidBodyComponents& rigidBodyComponents,
-                           MemoryManager& memoryManager);
+                           MemoryManager& memoryManager, TaskScheduler& taskScheduler, BroadPhaseType broadPhaseType,
+                           decimal fatAABBInflatePercentage, decimal fatAABBDisplacementMultiplier);
 
         /// Destructor
         ~CollisionDetectionSystem() = default;
@@ -324,6 +350,9 @@ class CollisionDetectionSystem {
         /// Notify that the overlapping pairs where a given collider is involved need to be tested for overlap
         void notifyOverlappingPairsToTestOverlap(Collider* collider);
 
+        /// Notify that the contacts of the overlapping pairs where a given collider is involved cannot be reused
+        void notifyOverlappingPairsToComputeContacts(Collider* collider);
+
         /// Report contacts and triggers
         void reportContactsAndTriggers();
 
@@ -355,6 +384,9 @@ class CollisionDetectionSystem {
         /// Return a reference to the memory manager
         MemoryManager& getMemoryManager() const;
 
+        /// Return a reference to the task scheduler
+        TaskScheduler& getTaskScheduler() const;
+
         /// Return a pointer to the world
         PhysicsWorld* getWorld();
 
@@ -371,6 +403,15 @@ class CollisionDetectionSystem {
         /// Return the world-space AABB of a given collider
         const AABB getWorldAABB(const Collider* collider) const;
 
+        /// Return the statistics of the narrow-phase collision detection of the last update
+        const NarrowPhaseStatistics& getNarrowPhaseStatistics() const;
+
+        /// Rebuild the broad-phase data structure from all the colliders
+        void rebuildBroadPhase();
+
+        /// Return the surface area heuristic (SAH) cost of the broad-phase data structure
+        decimal getBroadPhaseSAHCost() const;
+
         // -------------------- Friendship -------------------- //
 
         friend class PhysicsWorld;
@@ -428,6 +469,26 @@ inline MemoryManager& CollisionDetectionSystem::getMemoryManager() const {
     return mMemoryManager;
 }
 
+// Return a reference to the task scheduler
+inline TaskScheduler& CollisionDetectionSystem::getTaskScheduler() const {
+    return mTaskScheduler;
+}
+
+// Return the statistics of the narrow-phase collision detection of the last update
+inline const NarrowPhaseStatistics& CollisionDetectionSystem::getNarrowPhaseStatistics() const {
+    return mNarrowPhaseStatistics;
+}
+
+// Rebuild the broad-phase data structure from all the colliders
+inline void CollisionDetectionSystem::rebuildBroadPhase() {
+    mBroadPhaseSystem.rebuild();
+}
+
+// Return the surface area heuristic (SAH) cost of the broad-phase data structure
+inline decimal CollisionDetectionSystem::getBroadPhaseSAHCost() const {
+    return mBroadPhaseSystem.computeSAHCost();
+}
+
 // Update a collider (that has moved for instance)
 inline void CollisionDetectionSystem::updateCollider(Entity colliderEntity, decimal timeStep) {
 
@@ -33,6 +33,8 @@
 #include <reactphysics3d/systems/SolveFixedJointSystem.h>
 #include <reactphysics3d/systems/SolveHingeJointSystem.h>
 #include <reactphysics3d/systems/SolveSliderJointSystem.h>
+#include <reactphysics3d/containers/List.h>
+#include <reactphysics3d/engine/ConstraintGraphColoring.h>
 
 namespace reactphysics3d {
 
@@ -44,6 +46,8 @@ class Profiler;
 class RigidBodyComponents;
 class JointComponents;
 class DynamicsComponents;
+class TaskScheduler;
+class MemoryManager;
 
 // Structure ConstraintSolverData
 /**
@@ -74,6 +78,31 @@ struct ConstraintSolverData {
 
 };
 
+// Structure JointsGroups
+/**
+ * This structure contains the indices of the enabled components of a given type of joint
+ * sorted by group. A group is either an island or a color of the constraint graph of an
+ * island. The joints of different groups can be solved independently.
+ */
+struct JointsGroups {
+
+    public :
+
+        /// Indices of the joint components (sorted by group)
+        List<uint32> componentsIndices;
+
+        /// For each group, index of its first joint in the componentsIndices list. This list has one
+        /// more element than the number of groups so that the joints of group i are in the range
+        /// [groupsStartIndices[i], groupsStartIndices[i+1])
+        List<uint32> groupsStartIndices;
+
+        /// Constructor
+        JointsGroups(MemoryAllocator& allocator)
+            :componentsIndices(allocator), groupsStartIndices(allocator) {
+
+        }
+};
+
 // Class ConstraintSolverSystem
 /**
  * This class represents the constraint solver that is used to solve constraints between
@@ -155,9 +184,55 @@ class ConstraintSolverSystem {
         /// True if the warm starting of the solver is active
         bool mIsWarmStartingActive;
 
+        /// Memory manager
+        MemoryManager& mMemoryManager;
+
         /// Reference to the islands
         Islands& mIslands;
 
+        /// Reference to the task scheduler
+        TaskScheduler& mTaskScheduler;
+
+        /// Reference to the ball-and-socket joint components
+        BallAndSocketJointComponents& mBallAndSocketJointComponents;
+
+        /// Reference to the fixed joint components
+        FixedJointComponents& mFixedJointComponents;
+
+        /// Reference to the hinge joint components
+        HingeJointComponents& mHingeJointComponents;
+
+        /// Reference to the slider joint components
+        SliderJointComponents& mSliderJointComponents;
+
+        /// Ball-and-socket joints of each island
+        JointsGroups mBallAndSocketIslandsJoints;
+
+        /// Fixed joints of each island
+        JointsGroups mFixedIslandsJoints;
+
+        /// Hinge joints of each island
+        JointsGroups mHingeIslandsJoints;
+
+        /// Slider joints of each island
+        JointsGroups mSliderIslandsJoints;
+
+        /// Graph coloring of the joints of the island solved with colors
+        ConstraintGraphColoring mColoring;
+
+        /// Ball-and-socket joints of each color of the colored island (the last group contains
+        /// the joints that could not be colored)
+        JointsGroups mBallAndSocketColorsJoints;
+
+        /// Fixed joints of each color of the colored island
+        JointsGroups mFixedColorsJoints;
+
+        /// Hinge joints of each color of the colored island
+        JointsGroups mHingeColorsJoints;
+
+        /// Slider joints of each color of the colored island
+        JointsGroups mSliderColorsJoints;
+
         /// Constraint solver data used to initialize and solve the constraints
         ConstraintSolverData mConstraintSolverData;
 
@@ -179,12 +254,24 @@ class ConstraintSolverSystem {
 		Profiler* mProfiler;
 #endif
 
+        // -------------------- Methods -------------------- //
+
+        /// Sort the enabled components of a given type of joint by island
+        template<typename JointsComponents>
+        void computeIslandsJoints(const JointsComponents& jointsComponents, const List<uint32>& bodiesIslands,
+                                  JointsGroups& islandsJoints) const;
+
+        /// Solve the joints of the colored island with a given solve function
+        template<typename SolveFunction>
+        void solveColoredIslandJoints(SolveFunction solveJoints);
+
     public :
 
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        ConstraintSolverSystem(PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
+        ConstraintSolverSystem(PhysicsWorld& world, MemoryManager& memoryManager, TaskScheduler& taskScheduler,
+                               Islands& islands, RigidBodyComponents& rigidBodyComponents,
                                TransformComponents& transformComponents,
                                JointComponents& jointComponents,
                                BallAndSocketJointComponents& ballAndSocketJointComponents,
@@ -197,11 +284,23 @@ class ConstraintSolverSystem {
         /// Initialize the constraint solver
         void initialize(decimal dt);
 
-        /// Solve the constraints
-        void solveVelocityConstraints();
+        /// Solve the velocity constraints of the joints of an island
+        void solveVelocityConstraints(uint32 islandIndex);
+
+        /// Solve the position constraints of the joints of an island
+        void solvePositionConstraints(uint32 islandIndex);
+
+        /// Return the number of joints in an island
+        uint32 getNbIslandJoints(uint32 islandIndex) const;
+
+        /// Compute the graph coloring of the joints of an island
+        void computeIslandColoring(uint32 islandIndex);
+
+        /// Solve the velocity constraints of the joints of the colored island
+        void solveColoredIslandVelocityConstraints();
 
-        /// Solve the position constraints
-        void solvePositionConstraints();
+        /// Solve the position constraints of the joints of the colored island
+        void solveColoredIslandPositionConstraints();
 
         /// Return true if the Non-Linear-Gauss-Seidel position correction technique is active
         bool getIsNonLinearGaussSeidelPositionCorrectionActive() const;
@@ -30,6 +30,8 @@
 #include <reactphysics3d/configuration.h>
 #include <reactphysics3d/mathematics/Vector3.h>
 #include <reactphysics3d/mathematics/Matrix3x3.h>
+#include <reactphysics3d/mathematics/SimdMatrix3x3.h>
+#include <reactphysics3d/engine/ConstraintGraphColoring.h>
 
 /// ReactPhysics3D namespace
 namespace reactphysics3d {
@@ -49,6 +51,7 @@ class CollisionBodyComponents;
 class DynamicsComponents;
 class RigidBodyComponents;
 class ColliderComponents;
+class TaskScheduler;
 
 // Class ContactSolverSystem
 /**
@@ -118,6 +121,11 @@ class ColliderComponents;
  * constraints at the center of the contact manifold, we need two constraints for tangential
  * friction but also another twist friction constraint to prevent spin of the body around the
  * contact manifold center.
+ *
+ * The contacts can also be solved by a wide (SIMD) solver. In this case, the contact manifolds
+ * of an island are packed into blocks of SIMD_DECIMAL_NB_LANES manifolds that do not share any
+ * dynamic body. The data of a block is stored as a structure of arrays and each lane of a SIMD
+ * register solves one manifold of the block.
  */
 class ContactSolverSystem {
 
@@ -183,6 +191,13 @@ class ContactSolverSystem {
             /// Index of body 2 in the dynamics components arrays
             uint32 rigidBodyComponentIndexBody2;
 
+            /// True if the velocities of body 1 have to be updated (a static body can be shared by
+            /// several islands or colors solved in parallel and its velocities are never written)
+            bool isBody1Updated;
+
+            /// True if the velocities of body 2 have to be updated
+            bool isBody2Updated;
+
             /// Inverse of the mass of body 1
             decimal massInverseBody1;
 
@@ -270,6 +285,149 @@ class ContactSolverSystem {
             int8 nbContacts;
         };
 
+        /// Maximum number of contact points of a contact manifold in a block of the wide solver
+        static const uint32 MAX_NB_CONTACT_POINTS_IN_BLOCK = 4;
+
+        // Structure ContactPointsLanes
+        /**
+         * Wide contact solver data structure that stores the i-th contact point of
+         * each contact manifold of a block
+         */
+        struct ContactPointsLanes {
+
+            /// Normal vector of the contacts
+            Vector3Lanes normal;
+
+            /// Vectors from the body 1 center to the contact points
+            Vector3Lanes r1;
+
+            /// Vectors from the body 2 center to the contact points
+            Vector3Lanes r2;
+
+            /// Bias of the penetration depth position correction
+            decimal penetrationBias[SIMD_DECIMAL_NB_LANES];
+
+            /// Velocity restitution bias
+            decimal restitutionBias[SIMD_DECIMAL_NB_LANES];
+
+            /// Inverse of the matrix K for the penenetration
+            decimal inversePenetrationMass[SIMD_DECIMAL_NB_LANES];
+
+            /// Cross product of r1 with the contact normal
+            Vector3Lanes i1TimesR1CrossN;
+
+            /// Cross product of r2 with the contact normal
+            Vector3Lanes i2TimesR2CrossN;
+
+            /// Accumulated normal impulses
+            decimal penetrationImpulse[SIMD_DECIMAL_NB_LANES];
+
+            /// Accumulated split impulses for penetration correction
+            decimal penetrationSplitImpulse[SIMD_DECIMAL_NB_LANES];
+        };
+
+        // Structure ContactManifoldsBlockSolver
+        /**
+         * Wide contact solver data structure that stores SIMD_DECIMAL_NB_LANES contact
+         * manifolds that do not share any dynamic body (one manifold per lane). The unused
+         * lanes of a block contain zeros and do not modify any body.
+         */
+        struct ContactManifoldsBlockSolver {
+
+            /// Index of the contact manifold of each lane (INVALID_MANIFOLD_INDEX if the lane is not used)
+            uint32 contactManifoldsIndices[SIMD_DECIMAL_NB_LANES];
+
+            /// Index of body 1 in the dynamics components arrays
+            uint32 rigidBodyComponentIndexBody1[SIMD_DECIMAL_NB_LANES];
+
+            /// Index of body 2 in the dynamics components arrays
+            uint32 rigidBodyComponentIndexBody2[SIMD_DECIMAL_NB_LANES];
+
+            /// True if the velocities of body 1 have to be updated (the static bodies are shared between lanes)
+            bool isBody1Updated[SIMD_DECIMAL_NB_LANES];
+
+            /// True if the velocities of body 2 have to be updated
+            bool isBody2Updated[SIMD_DECIMAL_NB_LANES];
+
+            /// Largest number of contact points of the manifolds of the block
+            int8 nbContacts;
+
+            /// True if at least one manifold of the block has a rolling resistance
+            bool hasRollingResistance;
+
+            /// Inverse of the mass of body 1
+            decimal massInverseBody1[SIMD_DECIMAL_NB_LANES];
+
+            /// Inverse of the mass of body 2
+            decimal massInverseBody2[SIMD_DECIMAL_NB_LANES];
+
+            /// Inverse inertia tensor of body 1
+            Matrix3x3Lanes inverseInertiaTensorBody1;
+
+            /// Inverse inertia tensor of body 2
+            Matrix3x3Lanes inverseInertiaTensorBody2;
+
+            /// Mix friction coefficient for the two bodies
+            decimal frictionCoefficient[SIMD_DECIMAL_NB_LANES];
+
+            /// Rolling resistance factor between the two bodies
+            decimal rollingResistanceFactor[SIMD_DECIMAL_NB_LANES];
+
+            /// Average normal vector of the contact manifold
+            Vector3Lanes normal;
+
+            /// R1 vector for the friction constraints
+            Vector3Lanes r1Friction;
+
+            /// R2 vector for the friction constraints
+            Vector3Lanes r2Friction;
+
+            /// Cross product of r1 with 1st friction vector
+            Vector3Lanes r1CrossT1;
+
+            /// Cross product of r1 with 2nd friction vector
+            Vector3Lanes r1CrossT2;
+
+            /// Cross product of r2 with 1st friction vector
+            Vector3Lanes r2CrossT1;
+
+            /// Cross product of r2 with 2nd friction vector
+            Vector3Lanes r2CrossT2;
+
+            /// Matrix K for the first friction constraint
+            decimal inverseFriction1Mass[SIMD_DECIMAL_NB_LANES];
+
+            /// Matrix K for the second friction constraint
+            decimal inverseFriction2Mass[SIMD_DECIMAL_NB_LANES];
+
+            /// Matrix K for the twist friction constraint
+            decimal inverseTwistFrictionMass[SIMD_DECIMAL_NB_LANES];
+
+            /// Matrix K for the rolling resistance constraint
+            Matrix3x3Lanes inverseRollingResistance;
+
+            /// First friction direction at contact manifold center
+            Vector3Lanes frictionVector1;
+
+            /// Second friction direction at contact manifold center
+            Vector3Lanes frictionVector2;
+
+            /// First friction direction impulse at manifold center
+            decimal friction1Impulse[SIMD_DECIMAL_NB_LANES];
+
+            /// Second friction direction impulse at manifold center
+            decimal friction2Impulse[SIMD_DECIMAL_NB_LANES];
+
+            /// Twist friction impulse at contact manifold center
+            decimal frictionTwistImpulse[SIMD_DECIMAL_NB_LANES];
+
+            /// Rolling resistance impulse
+            Vector3Lanes rollingResistanceImpulse;
+
+            /// Contact points of the manifolds
+            ContactPointsLanes contactPoints[MAX_NB_CONTACT_POINTS_IN_BLOCK];
+        };
+
         // -------------------- Constants --------------------- //
 
         /// Beta value for the penetration depth position correction without split impulses
@@ -281,6 +439,12 @@ class ContactSolverSystem {
         /// Slop distance (allowed penetration distance between bodies)
         static const decimal SLOP;
 
+        /// Index of the contact manifold of an unused lane of a block
+        static const uint32 INVALID_MANIFOLD_INDEX;
+
+        /// Number of blocks of an island that can still receive contact manifolds while packing the island
+        static const uint32 NB_OPEN_BLOCKS = 4;
+
         // -------------------- Attributes -------------------- //
 
         /// Memory manager
@@ -289,6 +453,9 @@ class ContactSolverSystem {
         /// Physics world
         PhysicsWorld& mWorld;
 
+        /// Reference to the task scheduler
+        TaskScheduler& mTaskScheduler;
+
         /// Current time step
         decimal mTimeStep;
 
@@ -301,12 +468,6 @@ class ContactSolverSystem {
         /// Contact points
         ContactPointSolver* mContactPoints;
 
-        /// Number of contact point constraints
-        uint mNbContactPoints;
-
-        /// Number of contact constraints
-        uint mNbContactManifolds;
-
         /// Reference to the islands
         Islands& mIslands;
 
@@ -328,6 +489,34 @@ class ContactSolverSystem {
         /// True if the split impulse position correction is active
         bool mIsSplitImpulseActive;
 
+        /// Graph coloring of the contact manifolds of the island solved with colors
+        ConstraintGraphColoring mColoring;
+
+        /// Index of the island of the graph coloring
+        uint32 mColoredIslandIndex;
+
+        /// True if the contacts are solved with the wide (SIMD) solver
+        bool mIsWideSolverActive;
+
+        /// Blocks of contact manifolds of the islands for the wide solver
+        ContactManifoldsBlockSolver* mContactBlocks;
+
+        /// Number of blocks in the mContactBlocks array
+        uint32 mNbContactBlocks;
+
+        /// For each island, index of its first block in the mContactBlocks array (one more element than
+        /// the number of islands)
+        uint32* mIslandsBlocksStartIndices;
+
+        /// For each contact manifold, index of its lane in the blocks of its island (block * SIMD_DECIMAL_NB_LANES + lane)
+        uint32* mContactManifoldsLanes;
+
+        /// Blocks of contact manifolds of the island solved with the graph coloring for the wide solver
+        ContactManifoldsBlockSolver* mColoredIslandBlocks;
+
+        /// For each color of the colored island, index of its first block in mColoredIslandBlocks
+        List<uint32> mColorsBlocksStartIndices;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Pointer to the profiler
@@ -353,15 +542,41 @@ class ContactSolverSystem {
         void computeFrictionVectors(const Vector3& deltaVelocity,
                                     ContactManifoldSolver& contactPoint) const;
 
-        /// Warm start the solver.
-        void warmStart();
+        /// Warm start the solver for a given island
+        void warmStart(uint32 islandIndex);
+
+        /// Solve the contacts of a contact manifold
+        void solveContactManifold(uint32 contactManifoldIndex);
+
+        /// Store the constrained velocities of the non-static bodies of a contact manifold
+        void storeConstrainedVelocities(uint32 contactManifoldIndex, const Vector3& v1, const Vector3& w1,
+                                        const Vector3& v2, const Vector3& w2);
+
+        /// Store the split velocities of the non-static bodies of a contact manifold
+        void storeSplitVelocities(uint32 contactManifoldIndex, const Vector3& v1Split, const Vector3& w1Split,
+                                  const Vector3& v2Split, const Vector3& w2Split);
+
+        /// Assign the contact manifolds of an island to the lanes of its blocks and return the number of blocks
+        uint32 computeIslandBlocksLanes(uint32 islandIndex);
+
+        /// Initialize a block of contact manifolds with empty lanes
+        void initBlock(ContactManifoldsBlockSolver& block) const;
+
+        /// Copy the solver data of a contact manifold into a lane of a block
+        void packContactManifold(ContactManifoldsBlockSolver& block, uint32 lane, uint32 contactManifoldIndex) const;
+
+        /// Copy the accumulated impulses of the manifolds of blocks back into the contact manifolds solver data
+        void unpackBlocks(const ContactManifoldsBlockSolver* blocks, uint32 nbBlocks);
+
+        /// Solve the contacts of a block of contact manifolds with SIMD operations
+        void solveBlock(ContactManifoldsBlockSolver& block);
 
    public:
 
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        ContactSolverSystem(MemoryManager& memoryManager, PhysicsWorld& world, Islands& islands, CollisionBodyComponents& bodyComponents,
+        ContactSolverSystem(MemoryManager& memoryManager, PhysicsWorld& world, TaskScheduler& taskScheduler, Islands& islands, CollisionBodyComponents& bodyComponents,
                       RigidBodyComponents& rigidBodyComponents, ColliderComponents& colliderComponents, decimal& restitutionVelocityThreshold);
 
         /// Destructor
@@ -373,12 +588,21 @@ class ContactSolverSystem {
         /// Initialize the constraint solver for a given island
         void initializeForIsland(uint islandIndex);
 
-        /// Store the computed impulses to use them to
+        /// Pack the contact manifolds of the islands into blocks for the wide solver
+        void createBlocks();
+
+        /// Store the computed impulses of an island to use them to
         /// warm start the solver at the next iteration
-        void storeImpulses();
+        void storeImpulses(uint32 islandIndex);
+
+        /// Solve the contacts of an island
+        void solve(uint32 islandIndex);
 
-        /// Solve the contacts
-        void solve();
+        /// Compute the graph coloring of the contact manifolds of an island
+        void computeIslandColoring(uint32 islandIndex);
+
+        /// Solve the contacts of the island for which the graph coloring has been computed
+        void solveColoredIsland();
 
         /// Release allocated memory
         void reset();
@@ -389,6 +613,12 @@ class ContactSolverSystem {
         /// Activate or Deactivate the split impulses for contacts
         void setIsSplitImpulseActive(bool isActive);
 
+        /// Return true if the contacts are solved with the wide (SIMD) solver
+        bool isWideSolverActive() const;
+
+        /// Enable or disable the wide (SIMD) solver
+        void setIsWideSolverActive(bool isActive);
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
@@ -407,6 +637,16 @@ inline void ContactSolverSystem::setIsSplitImpulseActive(bool isActive) {
     mIsSplitImpulseActive = isActive;
 }
 
+// Return true if the contacts are solved with the wide (SIMD) solver
+inline bool ContactSolverSystem::isWideSolverActive() const {
+    return mIsWideSolverActive;
+}
+
+// Enable or disable the wide (SIMD) solver
+inline void ContactSolverSystem::setIsWideSolverActive(bool isActive) {
+    mIsWideSolverActive = isActive;
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Set the profiler
@@ -32,6 +32,7 @@
 #include <reactphysics3d/components/RigidBodyComponents.h>
 #include <reactphysics3d/components/TransformComponents.h>
 #include <reactphysics3d/components/ColliderComponents.h>
+#include <reactphysics3d/engine/TaskScheduler.h>
 
 namespace reactphysics3d {
 
@@ -63,6 +64,9 @@ class DynamicsSystem {
         /// Reference to the colliders components
         ColliderComponents& mColliderComponents;
 
+        /// Reference to the task scheduler used to split the loops over the components
+        TaskScheduler& mTaskScheduler;
+
         /// Reference to the variable to know if gravity is enabled in the world
         bool& mIsGravityEnabled;
 
@@ -82,7 +86,8 @@ class DynamicsSystem {
         /// Constructor
         DynamicsSystem(PhysicsWorld& world, CollisionBodyComponents& collisionBodyComponents,
                        RigidBodyComponents& rigidBodyComponents, TransformComponents& transformComponents,
-                       ColliderComponents& colliderComponents, bool& isGravityEnabled, Vector3& gravity);
+                       ColliderComponents& colliderComponents, TaskScheduler& taskScheduler,
+                       bool& isGravityEnabled, Vector3& gravity);
 
         /// Destructor
         ~DynamicsSystem() = default;
@@ -108,17 +108,17 @@ class SolveHingeJointSystem {
         /// Destructor
         ~SolveHingeJointSystem() = default;
 
-        /// Initialize before solving the constraint
-        void initBeforeSolve();
+        /// Initialize the joint components in the range [startIndex, endIndex) before solving the constraint
+        void initBeforeSolve(uint32 startIndex, uint32 endIndex);
 
-        /// Warm start the constraint (apply the previous impulse at the beginning of the step)
-         void warmstart();
+        /// Warm start the given joints (apply the previous impulse at the beginning of the step)
+         void warmstart(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex);
 
-        /// Solve the velocity constraint
-        void solveVelocityConstraint();
+        /// Solve the velocity constraint of the given joints
+        void solveVelocityConstraint(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex);
 
-        /// Solve the position constraint (for position error correction)
-        void solvePositionConstraint();
+        /// Solve the position constraint of the given joints (for position error correction)
+        void solvePositionConstraint(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex);
 
         /// Set the time step
         void setTimeStep(decimal timeStep);
@@ -0,0 +1,122 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_MEMORY_MAPPED_FILE_H
+#define REACTPHYSICS3D_MEMORY_MAPPED_FILE_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <string>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Class MemoryMappedFile
+/**
+ * This class maps a file into memory in read-only mode. The content of the file is only
+ * loaded from the disk when it is accessed and it can be shared by several processes. This
+ * is used to create meshes from cooked data (see MeshCooker) without copying the data.
+ * Note that the file must remain mapped while the meshes created from its data are used.
+ */
+class MemoryMappedFile {
+
+    private:
+
+        // -------------------- Attributes -------------------- //
+
+        /// Pointer to the content of the file (null if the file is not mapped)
+        const void* mData;
+
+        /// Size of the file in bytes
+        size_t mSize;
+
+#if defined(WINDOWS_OS)
+
+        /// Handle of the file
+        void* mFileHandle;
+
+        /// Handle of the file mapping
+        void* mMappingHandle;
+
+#endif
+
+        // -------------------- Methods -------------------- //
+
+        /// Unmap the file
+        void unmap();
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        MemoryMappedFile();
+
+        /// Constructor that maps a file
+        MemoryMappedFile(const std::string& filePath);
+
+        /// Destructor
+        ~MemoryMappedFile();
+
+        /// Deleted copy-constructor
+        MemoryMappedFile(const MemoryMappedFile& file) = delete;
+
+        /// Deleted assignment operator
+        MemoryMappedFile& operator=(const MemoryMappedFile& file) = delete;
+
+        /// Map a file into memory and return true if it has been mapped
+        bool map(const std::string& filePath);
+
+        /// Return true if a file is mapped
+        bool isMapped() const;
+
+        /// Return a pointer to the content of the file
+        const void* getData() const;
+
+        /// Return the size of the file in bytes
+        size_t getSize() const;
+};
+
+// Return true if a file is mapped
+inline bool MemoryMappedFile::isMapped() const {
+    return mData != nullptr;
+}
+
+// Return a pointer to the content of the file
+/**
+ * @return A pointer to the beginning of the file (aligned on a memory page)
+ */
+inline const void* MemoryMappedFile::getData() const {
+    return mData;
+}
+
+// Return the size of the file in bytes
+inline size_t MemoryMappedFile::getSize() const {
+    return mSize;
+}
+
+}
+
+#endif
@@ -66,13 +66,41 @@ BodyType RigidBody::getType() const {
  */
 void RigidBody::setType(BodyType type) {
 
-    if (mWorld.mRigidBodyComponents.getBodyType(mEntity) == type) return;
+    const BodyType previousType = mWorld.mRigidBodyComponents.getBodyType(mEntity);
+    if (previousType == type) return;
 
     mWorld.mRigidBodyComponents.setBodyType(mEntity, type);
 
+    // The colliders of a static body are static objects of the broad-phase. If the body
+    // becomes static or is not static anymore, its colliders are added again into the broad-phase
+    if ((previousType == BodyType::STATIC) != (type == BodyType::STATIC)) {
+
+        const Transform& transform = mWorld.mTransformComponents.getTransform(mEntity);
+
+        // For each collider of the body
+        const List<Entity>& colliderEntities = mWorld.mCollisionBodyComponents.getColliders(mEntity);
+        for (uint i=0; i < colliderEntities.size(); i++) {
+
+            Collider* collider = mWorld.mCollidersComponents.getCollider(colliderEntities[i]);
+
+            if (collider->getBroadPhaseId() != -1) {
+
+                // Compute the world-space AABB of the collider
+                AABB aabb;
+                collider->getCollisionShape()->computeAABB(aabb, transform * mWorld.mCollidersComponents.getLocalToBodyTransform(collider->getEntity()));
+
+                mWorld.mCollisionDetection.removeCollider(collider);
+                mWorld.mCollisionDetection.addCollider(collider, aabb);
+            }
+        }
+    }
+
     // If it is a static body
     if (type == BodyType::STATIC) {
 
+        // A static body does not connect the bodies of an island
+        mWorld.mRigidBodyComponents.removeBodyFromIsland(mEntity);
+
         // Reset the velocity to zero
         mWorld.mRigidBodyComponents.setLinearVelocity(mEntity, Vector3::zero());
         mWorld.mRigidBodyComponents.setAngularVelocity(mEntity, Vector3::zero());
@@ -632,6 +660,9 @@ Collider* RigidBody::addCollider(CollisionShape* collisionShape, const Transform
  */
 void RigidBody::removeCollider(Collider* collider) {
 
+    // The contacts of the collider are removed and the island of the body might not be connected anymore
+    mWorld.mRigidBodyComponents.setIsIslandSplitNeeded(mEntity);
+
     // Remove the collision shape
     CollisionBody::removeCollider(collider);
 }
@@ -920,6 +951,11 @@ void RigidBody::setIsActive(bool isActive) {
 
     setIsSleeping(!isActive);
 
+    // An inactive body does not connect the bodies of an island
+    if (!isActive) {
+        mWorld.mRigidBodyComponents.removeBodyFromIsland(mEntity);
+    }
+
     CollisionBody::setIsActive(isActive);
 }
 
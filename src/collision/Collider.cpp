@@ -215,6 +215,11 @@ unsigned short Collider::getCollideWithMaskBits() const {
 // Notify the collider that the size of the collision shape has been changed by the user
 void Collider::setHasCollisionShapeChangedSize(bool hasCollisionShapeChangedSize) {
     mBody->mWorld.mCollidersComponents.setHasCollisionShapeChangedSize(mEntity, hasCollisionShapeChangedSize);
+
+    // The contacts of the pairs of the collider that are at rest cannot be reused anymore
+    if (hasCollisionShapeChangedSize) {
+        mBody->mWorld.mCollisionDetection.notifyOverlappingPairsToComputeContacts(this);
+    }
 }
 
 // Set a new material for this rigid body
@@ -0,0 +1,101 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/ConvexPolyhedronArrays.h>
+#include <reactphysics3d/mathematics/SimdDecimal.h>
+
+using namespace reactphysics3d;
+
+// Constructor
+ConvexPolyhedronArrays::ConvexPolyhedronArrays()
+                       : mNbFaces(0), mNbPaddedFaces(0), mNbEdges(0), mNbPaddedEdges(0), mData(nullptr),
+                         mFacesNormals(nullptr), mFacesVertices(nullptr), mEdgesVertices1(nullptr),
+                         mEdgesVertices2(nullptr), mEdgesFacesNormals1(nullptr), mEdgesFacesNormals2(nullptr) {
+
+}
+
+// Destructor
+ConvexPolyhedronArrays::~ConvexPolyhedronArrays() {
+    delete[] mData;
+}
+
+// Compute the arrays from the half-edge structure, the vertices and the face normals of a polyhedron
+/**
+ * @param halfEdgeStructure The half-edge structure of the polyhedron
+ * @param vertices Array with the positions of the vertices (indexed like the vertices of the half-edge structure)
+ * @param facesNormals Array with the normals of the faces (indexed like the faces of the half-edge structure)
+ */
+void ConvexPolyhedronArrays::compute(const HalfEdgeStructure& halfEdgeStructure, const Vector3* vertices, const Vector3* facesNormals) {
+
+    assert(halfEdgeStructure.getNbFaces() > 0);
+    assert(halfEdgeStructure.getNbHalfEdges() > 0);
+
+    delete[] mData;
+
+    mNbFaces = halfEdgeStructure.getNbFaces();
+    mNbPaddedFaces = ((mNbFaces + SIMD_DECIMAL_NB_LANES - 1) / SIMD_DECIMAL_NB_LANES) * SIMD_DECIMAL_NB_LANES;
+    mNbEdges = halfEdgeStructure.getNbHalfEdges() / 2;
+    mNbPaddedEdges = ((mNbEdges + SIMD_DECIMAL_NB_LANES - 1) / SIMD_DECIMAL_NB_LANES) * SIMD_DECIMAL_NB_LANES;
+
+    mData = new decimal[6 * mNbPaddedFaces + 12 * mNbPaddedEdges];
+    mFacesNormals = mData;
+    mFacesVertices = mFacesNormals + 3 * mNbPaddedFaces;
+    mEdgesVertices1 = mFacesVertices + 3 * mNbPaddedFaces;
+    mEdgesVertices2 = mEdgesVertices1 + 3 * mNbPaddedEdges;
+    mEdgesFacesNormals1 = mEdgesVertices2 + 3 * mNbPaddedEdges;
+    mEdgesFacesNormals2 = mEdgesFacesNormals1 + 3 * mNbPaddedEdges;
+
+    for (uint f=0; f < mNbPaddedFaces; f++) {
+
+        // The padding is filled with the first face
+        const uint faceIndex = f < mNbFaces ? f : 0;
+        const Vector3& normal = facesNormals[faceIndex];
+        const Vector3& vertex = vertices[halfEdgeStructure.getFace(faceIndex).faceVertices[0]];
+
+        for (int i=0; i < 3; i++) {
+            mFacesNormals[i * mNbPaddedFaces + f] = normal[i];
+            mFacesVertices[i * mNbPaddedFaces + f] = vertex[i];
+        }
+    }
+
+    for (uint e=0; e < mNbPaddedEdges; e++) {
+
+        // The padding is filled with the first edge
+        const HalfEdgeStructure::Edge& edge = halfEdgeStructure.getHalfEdge(e < mNbEdges ? 2 * e : 0);
+        const HalfEdgeStructure::Edge& twinEdge = halfEdgeStructure.getHalfEdge(edge.twinEdgeIndex);
+        const Vector3& vertex1 = vertices[edge.vertexIndex];
+        const Vector3& vertex2 = vertices[twinEdge.vertexIndex];
+        const Vector3& normal1 = facesNormals[edge.faceIndex];
+        const Vector3& normal2 = facesNormals[twinEdge.faceIndex];
+
+        for (int i=0; i < 3; i++) {
+            mEdgesVertices1[i * mNbPaddedEdges + e] = vertex1[i];
+            mEdgesVertices2[i * mNbPaddedEdges + e] = vertex2[i];
+            mEdgesFacesNormals1[i * mNbPaddedEdges + e] = normal1[i];
+            mEdgesFacesNormals2[i * mNbPaddedEdges + e] = normal2[i];
+        }
+    }
+}
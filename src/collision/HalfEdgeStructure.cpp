@@ -116,3 +116,29 @@ void HalfEdgeStructure::init() {
         mFaces[f].edgeIndex = mapEdgeToIndex[mapFaceIndexToEdgeKey[f]];
     }
 }
+
+// Initialize the structure with half-edges computed before (when all vertices and faces have been added)
+/// This is used to create the structure from cooked data without computing the half-edges again.
+/**
+ * @param edges Array with the half-edges of the structure
+ * @param nbEdges Number of half-edges in the array
+ * @param verticesEdges For each vertex, index of one half-edge emanating from the vertex
+ * @param facesEdges For each face, index of one half-edge of the face
+ */
+void HalfEdgeStructure::init(const Edge* edges, uint nbEdges, const uint* verticesEdges, const uint* facesEdges) {
+
+    mEdges.reserve(nbEdges);
+    for (uint e=0; e < nbEdges; e++) {
+        mEdges.add(edges[e]);
+    }
+
+    for (uint v=0; v < mVertices.size(); v++) {
+        assert(verticesEdges[v] < nbEdges);
+        mVertices[v].edgeIndex = verticesEdges[v];
+    }
+
+    for (uint f=0; f < mFaces.size(); f++) {
+        assert(facesEdges[f] < nbEdges);
+        mFaces[f].edgeIndex = facesEdges[f];
+    }
+}
@@ -0,0 +1,586 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/MeshCooker.h>
+#include <reactphysics3d/collision/TriangleMesh.h>
+#include <reactphysics3d/collision/TriangleVertexArray.h>
+#include <reactphysics3d/collision/PolyhedronMesh.h>
+#include <reactphysics3d/collision/PolygonVertexArray.h>
+#include <reactphysics3d/collision/broadphase/StaticAABBTree.h>
+#include <reactphysics3d/collision/shapes/HeightFieldShape.h>
+#include <reactphysics3d/engine/PhysicsCommon.h>
+#include <cstring>
+#include <limits>
+
+using namespace reactphysics3d;
+
+// Static variables definition
+const uint32 MeshCooker::VERSION = 1;
+const uint64 MeshCooker::ALIGNMENT = 64;
+
+// Magic string at the beginning of cooked data
+static const char COOKED_DATA_MAGIC[8] = {'R', 'P', '3', 'D', 'C', 'O', 'O', 'K'};
+
+// Value stored in the header to check the endianness of the data
+static const uint32 ENDIANNESS_CHECK = 0x01020304;
+
+// The arrays of the cooked data are used in place without being converted
+static_assert(sizeof(uint) == sizeof(uint32), "The cooked data require 32 bits unsigned integers");
+static_assert(sizeof(PolygonVertexArray::PolygonFace) == 2 * sizeof(uint32), "Unexpected size of a polygon face");
+static_assert(sizeof(HalfEdgeStructure::Edge) == 4 * sizeof(uint32), "Unexpected size of a half-edge");
+static_assert(sizeof(StaticAABBTreeNode) == 32, "Unexpected size of a static AABB tree node");
+
+namespace {
+
+// Class CookedDataWriter
+/**
+ * This class writes the header, the description and the arrays of cooked data into a buffer.
+ */
+class CookedDataWriter {
+
+    private:
+
+        /// Buffer with the cooked data
+        List<uint8>& mData;
+
+        /// True if the data is too large for the buffer
+        bool mIsTooLarge;
+
+    public:
+
+        /// Constructor
+        CookedDataWriter(List<uint8>& outData, MeshCooker::CookedDataType dataType, size_t descriptionSize)
+            : mData(outData), mIsTooLarge(false) {
+
+            mData.clear();
+
+            // Reserve the space of the header and of the description of the data (written at the end)
+            allocate(sizeof(MeshCooker::Header));
+            allocate(descriptionSize);
+
+            MeshCooker::Header& header = *getArray<MeshCooker::Header>(0);
+            std::memcpy(header.magic, COOKED_DATA_MAGIC, sizeof(COOKED_DATA_MAGIC));
+            header.version = MeshCooker::VERSION;
+            header.dataType = static_cast<uint32>(dataType);
+            header.decimalSize = sizeof(decimal);
+            header.endiannessCheck = ENDIANNESS_CHECK;
+        }
+
+        /// Return true if the data is too large for the buffer
+        bool isTooLarge() const {
+            return mIsTooLarge;
+        }
+
+        /// Add an array (filled with zeros) at an aligned offset at the end of the data and return its offset
+        uint64 allocate(uint64 nbBytes) {
+
+            const uint64 offset = (mData.size() + MeshCooker::ALIGNMENT - 1) / MeshCooker::ALIGNMENT * MeshCooker::ALIGNMENT;
+
+            // The size of a list is limited to 32 bits
+            const size_t maxSize = std::numeric_limits<uint32>::max() / 2;
+            if (mIsTooLarge || offset + nbBytes > maxSize) {
+                mIsTooLarge = true;
+                return 0;
+            }
+
+            const uint32 previousSize = mData.size();
+            const uint32 newSize = static_cast<uint32>(offset + nbBytes);
+            if (newSize > mData.capacity()) {
+                mData.reserve(std::max(size_t(newSize), std::min(mData.capacity() * 2, maxSize)));
+            }
+            if (newSize > previousSize) {
+                mData.addWithoutInit(newSize - previousSize);
+                std::memset(&(mData[previousSize]), 0, newSize - previousSize);
+            }
+
+            return offset;
+        }
+
+        /// Return a pointer to an array of the data (only valid until the next allocation)
+        template<typename T>
+        T* getArray(uint64 offset) {
+            assert(!mIsTooLarge);
+            return reinterpret_cast<T*>(&(mData[static_cast<uint32>(offset)]));
+        }
+
+        /// Write the description of the data after the header and the checksum of the data in the header
+        template<typename T>
+        bool finish(const T& description) {
+
+            // The size of the data is a multiple of the alignment
+            allocate(0);
+
+            if (mIsTooLarge) {
+                mData.clear();
+                return false;
+            }
+
+            *getArray<T>(MeshCooker::ALIGNMENT) = description;
+
+            MeshCooker::Header& header = *getArray<MeshCooker::Header>(0);
+            header.dataSize = mData.size();
+            header.checksum = MeshCooker::computeChecksum(&(mData[sizeof(MeshCooker::Header)]), mData.size() - sizeof(MeshCooker::Header));
+
+            return true;
+        }
+};
+
+// Return true if an array of the cooked data is aligned and inside the data
+bool isArrayValid(const MeshCooker::Header& header, uint64 offset, uint64 nbElements, uint64 elementSize) {
+    return offset % MeshCooker::ALIGNMENT == 0 && offset <= header.dataSize &&
+           nbElements * elementSize <= header.dataSize - offset;
+}
+
+// Return true if the indices of the vertices of the triangles and the references of the AABB tree are inside the mesh
+bool areTriangleMeshIndicesValid(const void* data, const MeshCooker::TriangleMeshData& mesh) {
+
+    const MeshCooker::TriangleMeshSubpartData* subparts = MeshCooker::getArray<MeshCooker::TriangleMeshSubpartData>(data, mesh.subpartsOffset);
+    for (uint32 s=0; s < mesh.nbSubparts; s++) {
+
+        const uint32* indices = MeshCooker::getArray<uint32>(data, subparts[s].indicesOffset);
+        const uint64 nbIndices = uint64(subparts[s].nbTriangles) * 3;
+        for (uint64 i=0; i < nbIndices; i++) {
+            if (indices[i] >= subparts[s].nbVertices) return false;
+        }
+    }
+
+    return StaticAABBTree::areNodesValid(MeshCooker::getArray<StaticAABBTreeNode>(data, mesh.treeNodesOffset),
+                                         mesh.nbTriangles > 0 ? mesh.nbTriangles - 1 : 0, mesh.treeRootReference, mesh.nbTriangles);
+}
+
+// Return true if the indices of the faces and of the half-edge structure are inside the mesh
+bool arePolyhedronMeshIndicesValid(const void* data, const MeshCooker::PolyhedronMeshData& mesh) {
+
+    const PolygonVertexArray::PolygonFace* faces = MeshCooker::getArray<PolygonVertexArray::PolygonFace>(data, mesh.facesOffset);
+    const uint32* facesIndices = MeshCooker::getArray<uint32>(data, mesh.facesIndicesOffset);
+    for (uint32 f=0; f < mesh.nbFaces; f++) {
+        if (uint64(faces[f].indexBase) + faces[f].nbVertices > mesh.nbFacesIndices) return false;
+    }
+    for (uint32 i=0; i < mesh.nbFacesIndices; i++) {
+        if (facesIndices[i] >= mesh.nbVertices) return false;
+    }
+
+    const HalfEdgeStructure::Edge* edges = MeshCooker::getArray<HalfEdgeStructure::Edge>(data, mesh.halfEdgesOffset);
+    for (uint32 e=0; e < mesh.nbHalfEdges; e++) {
+        if (edges[e].vertexIndex >= mesh.nbVertices || edges[e].twinEdgeIndex >= mesh.nbHalfEdges ||
+            edges[e].faceIndex >= mesh.nbFaces || edges[e].nextEdgeIndex >= mesh.nbHalfEdges) {
+            return false;
+        }
+    }
+
+    const uint32* verticesEdges = MeshCooker::getArray<uint32>(data, mesh.verticesEdgesOffset);
+    for (uint32 v=0; v < mesh.nbVertices; v++) {
+        if (verticesEdges[v] >= mesh.nbHalfEdges) return false;
+    }
+    const uint32* facesEdges = MeshCooker::getArray<uint32>(data, mesh.facesEdgesOffset);
+    for (uint32 f=0; f < mesh.nbFaces; f++) {
+        if (facesEdges[f] >= mesh.nbHalfEdges) return false;
+    }
+
+    return true;
+}
+
+// Log an error about invalid cooked data and return false
+bool logInvalidCookedData(const std::string& reason) {
+
+    RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+             "Invalid cooked data: " + reason,  __FILE__, __LINE__);
+
+    return false;
+}
+
+}
+
+// Cook a triangle mesh (with the AABB tree of its triangles)
+/// The vertices are converted into decimal values and the vertices normals are stored in the cooked data so
+/// that they do not have to be computed when the mesh is loaded. The AABB tree is built with the triangles
+/// numbered sub-part after sub-part in the same way as a ConcaveMeshShape does.
+/**
+ * @param triangleMesh The triangle mesh to cook
+ * @param allocator Memory allocator used for the temporary memory
+ * @param outData Output buffer filled with the cooked data
+ * @return False if the mesh is too large to be cooked
+ */
+bool MeshCooker::cookTriangleMesh(const TriangleMesh& triangleMesh, MemoryAllocator& allocator, List<uint8>& outData) {
+
+    CookedDataWriter writer(outData, CookedDataType::TRIANGLE_MESH, sizeof(TriangleMeshData));
+
+    const uint nbSubparts = triangleMesh.getNbSubparts();
+    const uint64 subpartsOffset = writer.allocate(nbSubparts * sizeof(TriangleMeshSubpartData));
+
+    List<AABB> trianglesAABBs(allocator);
+
+    // For each sub-part of the mesh
+    for (uint s=0; s < nbSubparts && !writer.isTooLarge(); s++) {
+
+        TriangleVertexArray* triangleArray = triangleMesh.getSubpart(s);
+
+        TriangleMeshSubpartData subpart;
+        subpart.nbVertices = triangleArray->getNbVertices();
+        subpart.nbTriangles = triangleArray->getNbTriangles();
+        subpart.verticesOffset = writer.allocate(uint64(subpart.nbVertices) * 3 * sizeof(decimal));
+        subpart.normalsOffset = writer.allocate(uint64(subpart.nbVertices) * 3 * sizeof(decimal));
+        subpart.indicesOffset = writer.allocate(uint64(subpart.nbTriangles) * 3 * sizeof(uint32));
+        if (writer.isTooLarge()) break;
+
+        // Copy the vertices and their normals
+        decimal* vertices = writer.getArray<decimal>(subpart.verticesOffset);
+        decimal* normals = writer.getArray<decimal>(subpart.normalsOffset);
+        for (uint v=0; v < subpart.nbVertices; v++) {
+
+            Vector3 vertex;
+            Vector3 normal;
+            triangleArray->getVertex(v, &vertex);
+            triangleArray->getNormal(v, &normal);
+
+            for (int i=0; i < 3; i++) {
+                vertices[v * 3 + i] = vertex[i];
+                normals[v * 3 + i] = normal[i];
+            }
+        }
+
+        // Copy the indices and compute the AABBs of the triangles with the converted vertices
+        uint32* indices = writer.getArray<uint32>(subpart.indicesOffset);
+        for (uint t=0; t < subpart.nbTriangles; t++) {
+
+            uint verticesIndices[3];
+            triangleArray->getTriangleVerticesIndices(t, verticesIndices);
+
+            Vector3 trianglePoints[3];
+            for (int i=0; i < 3; i++) {
+                indices[t * 3 + i] = verticesIndices[i];
+                trianglePoints[i].setAllValues(vertices[verticesIndices[i] * 3], vertices[verticesIndices[i] * 3 + 1],
+                                               vertices[verticesIndices[i] * 3 + 2]);
+            }
+
+            trianglesAABBs.add(AABB::createAABBForTriangle(trianglePoints));
+        }
+
+        *(writer.getArray<TriangleMeshSubpartData>(subpartsOffset) + s) = subpart;
+    }
+
+    if (writer.isTooLarge()) {
+        return writer.finish(TriangleMeshData());
+    }
+
+    // Build the AABB tree of the triangles
+    StaticAABBTree tree(allocator);
+    tree.build(trianglesAABBs);
+
+    const uint64 treeNodesOffset = writer.allocate(uint64(tree.getNbNodes()) * sizeof(StaticAABBTreeNode));
+    if (!writer.isTooLarge() && tree.getNbNodes() > 0) {
+        std::memcpy(writer.getArray<StaticAABBTreeNode>(treeNodesOffset), tree.getNodes(), tree.getNbNodes() * sizeof(StaticAABBTreeNode));
+    }
+
+    TriangleMeshData description;
+    description.nbSubparts = nbSubparts;
+    description.nbTriangles = tree.getNbObjects();
+    description.treeRootReference = tree.getRootReference();
+    description.padding = 0;
+    for (int i=0; i < 3; i++) {
+        description.treeRootMin[i] = tree.getRootAABB().getMin()[i];
+        description.treeRootMax[i] = tree.getRootAABB().getMax()[i];
+    }
+    description.subpartsOffset = subpartsOffset;
+    description.treeNodesOffset = treeNodesOffset;
+
+    return writer.finish(description);
+}
+
+// Cook a polyhedron mesh (with its half-edge structure)
+/**
+ * @param polyhedronMesh The polyhedron mesh to cook
+ * @param outData Output buffer filled with the cooked data
+ * @return False if the mesh is too large to be cooked
+ */
+bool MeshCooker::cookPolyhedronMesh(const PolyhedronMesh& polyhedronMesh, List<uint8>& outData) {
+
+    CookedDataWriter writer(outData, CookedDataType::POLYHEDRON_MESH, sizeof(PolyhedronMeshData));
+
+    const HalfEdgeStructure& halfEdgeStructure = polyhedronMesh.getHalfEdgeStructure();
+
+    PolyhedronMeshData description;
+    description.nbVertices = halfEdgeStructure.getNbVertices();
+    description.nbFaces = halfEdgeStructure.getNbFaces();
+    description.nbHalfEdges = halfEdgeStructure.getNbHalfEdges();
+    description.nbFacesIndices = 0;
+    for (uint f=0; f < description.nbFaces; f++) {
+        description.nbFacesIndices += halfEdgeStructure.getFace(f).faceVertices.size();
+    }
+
+    description.verticesOffset = writer.allocate(uint64(description.nbVertices) * 3 * sizeof(decimal));
+    description.facesOffset = writer.allocate(uint64(description.nbFaces) * sizeof(PolygonVertexArray::PolygonFace));
+    description.facesIndicesOffset = writer.allocate(uint64(description.nbFacesIndices) * sizeof(uint32));
+    description.halfEdgesOffset = writer.allocate(uint64(description.nbHalfEdges) * sizeof(HalfEdgeStructure::Edge));
+    description.verticesEdgesOffset = writer.allocate(uint64(description.nbVertices) * sizeof(uint32));
+    description.facesEdgesOffset = writer.allocate(uint64(description.nbFaces) * sizeof(uint32));
+    if (writer.isTooLarge()) return writer.finish(description);
+
+    // Vertices (the vertex i of the half-edge structure is the point i of the cooked vertices)
+    decimal* vertices = writer.getArray<decimal>(description.verticesOffset);
+    uint32* verticesEdges = writer.getArray<uint32>(description.verticesEdgesOffset);
+    for (uint v=0; v < description.nbVertices; v++) {
+
+        const Vector3 vertex = polyhedronMesh.getVertex(v);
+        vertices[v * 3] = vertex.x;
+        vertices[v * 3 + 1] = vertex.y;
+        vertices[v * 3 + 2] = vertex.z;
+
+        verticesEdges[v] = halfEdgeStructure.getVertex(v).edgeIndex;
+    }
+
+    // Faces
+    PolygonVertexArray::PolygonFace* faces = writer.getArray<PolygonVertexArray::PolygonFace>(description.facesOffset);
+    uint32* facesIndices = writer.getArray<uint32>(description.facesIndicesOffset);
+    uint32* facesEdges = writer.getArray<uint32>(description.facesEdgesOffset);
+    uint32 indexBase = 0;
+    for (uint f=0; f < description.nbFaces; f++) {
+
+        const HalfEdgeStructure::Face& face = halfEdgeStructure.getFace(f);
+
+        faces[f].nbVertices = face.faceVertices.size();
+        faces[f].indexBase = indexBase;
+        for (uint v=0; v < face.faceVertices.size(); v++) {
+            facesIndices[indexBase + v] = face.faceVertices[v];
+        }
+        indexBase += face.faceVertices.size();
+
+        facesEdges[f] = face.edgeIndex;
+    }
+
+    // Half-edges
+    HalfEdgeStructure::Edge* halfEdges = writer.getArray<HalfEdgeStructure::Edge>(description.halfEdgesOffset);
+    for (uint e=0; e < description.nbHalfEdges; e++) {
+        halfEdges[e] = halfEdgeStructure.getHalfEdge(e);
+    }
+
+    return writer.finish(description);
+}
+
+// Cook the height values of a height field
+/// Note that the scaling of the height field shape is not cooked.
+/**
+ * @param heightField The height field shape to cook
+ * @param outData Output buffer filled with the cooked data
+ * @return False if the height field is too large to be cooked
+ */
+bool MeshCooker::cookHeightField(const HeightFieldShape& heightField, List<uint8>& outData) {
+
+    CookedDataWriter writer(outData, CookedDataType::HEIGHT_FIELD, sizeof(HeightFieldData));
+
+    uint64 heightSize = sizeof(int);
+    switch (heightField.mHeightDataType) {
+        case HeightFieldShape::HeightDataType::HEIGHT_FLOAT_TYPE: heightSize = sizeof(float); break;
+        case HeightFieldShape::HeightDataType::HEIGHT_DOUBLE_TYPE: heightSize = sizeof(double); break;
+        case HeightFieldShape::HeightDataType::HEIGHT_INT_TYPE: heightSize = sizeof(int); break;
+    }
+    const uint64 heightsSize = uint64(heightField.mNbColumns) * uint64(heightField.mNbRows) * heightSize;
+
+    HeightFieldData description;
+    description.nbColumns = heightField.mNbColumns;
+    description.nbRows = heightField.mNbRows;
+    description.upAxis = heightField.mUpAxis;
+    description.heightDataType = static_cast<int32>(heightField.mHeightDataType);
+    description.minHeight = heightField.mMinHeight;
+    description.maxHeight = heightField.mMaxHeight;
+    description.integerHeightScale = heightField.mIntegerHeightScale;
+    description.heightsOffset = writer.allocate(heightsSize);
+
+    if (!writer.isTooLarge()) {
+        std::memcpy(writer.getArray<uint8>(description.heightsOffset), heightField.mHeightFieldData, heightsSize);
+    }
+
+    return writer.finish(description);
+}
+
+// Return true if a buffer contains valid cooked data of a given type
+/// The header of the data is checked (version, type of data, decimal precision, endianness and checksum)
+/// and all the arrays described in the data must be inside the buffer. The checksum only detects accidental
+/// corruption and the indices stored in the arrays (indices of the vertices of the triangles, references of the
+/// AABB tree nodes and indices of the half-edge structure) are therefore always checked to be inside the mesh
+/// (a single pass over the indices). The address of the data must be a multiple of 8 bytes.
+/**
+ * @param data Pointer to the beginning of the cooked data
+ * @param dataSize Size of the cooked data in bytes
+ * @param dataType Expected type of cooked data
+ * @param isChecksumVerified True if the checksum of the data has to be verified (all the data is read)
+ * @return True if the data is valid
+ */
+bool MeshCooker::isCookedDataValid(const void* data, size_t dataSize, CookedDataType dataType, bool isChecksumVerified) {
+
+    if (data == nullptr || dataSize < ALIGNMENT || reinterpret_cast<size_t>(data) % sizeof(uint64) != 0) {
+        return logInvalidCookedData("the data must be a buffer aligned on 8 bytes");
+    }
+
+    const Header& header = *getArray<Header>(data, 0);
+
+    if (std::memcmp(header.magic, COOKED_DATA_MAGIC, sizeof(COOKED_DATA_MAGIC)) != 0) {
+        return logInvalidCookedData("the data has not been cooked by ReactPhysics3D");
+    }
+    if (header.endiannessCheck != ENDIANNESS_CHECK || header.decimalSize != sizeof(decimal)) {
+        return logInvalidCookedData("the data has been cooked on a platform with a different endianness or decimal precision");
+    }
+    if (header.version != VERSION) {
+        return logInvalidCookedData("the data has been cooked with version " + std::to_string(header.version) +
+                                    " of the format instead of version " + std::to_string(VERSION));
+    }
+    if (header.dataType != static_cast<uint32>(dataType)) {
+        return logInvalidCookedData("the data does not contain the expected type of mesh");
+    }
+    if (header.dataSize != dataSize) {
+        return logInvalidCookedData("the size of the data is not the cooked size");
+    }
+    if (isChecksumVerified && header.checksum != computeChecksum(static_cast<const uint8*>(data) + sizeof(Header), dataSize - sizeof(Header))) {
+        return logInvalidCookedData("the checksum of the data is not correct");
+    }
+
+    bool isValid = true;
+
+    switch (dataType) {
+
+        case CookedDataType::TRIANGLE_MESH:
+        {
+            isValid = isArrayValid(header, ALIGNMENT, 1, sizeof(TriangleMeshData));
+            if (!isValid) break;
+
+            const TriangleMeshData& mesh = *getArray<TriangleMeshData>(data, ALIGNMENT);
+            isValid = isArrayValid(header, mesh.subpartsOffset, mesh.nbSubparts, sizeof(TriangleMeshSubpartData)) &&
+                      isArrayValid(header, mesh.treeNodesOffset, mesh.nbTriangles > 0 ? mesh.nbTriangles - 1 : 0, sizeof(StaticAABBTreeNode));
+
+            uint64 nbTriangles = 0;
+            for (uint32 s=0; isValid && s < mesh.nbSubparts; s++) {
+                const TriangleMeshSubpartData& subpart = getArray<TriangleMeshSubpartData>(data, mesh.subpartsOffset)[s];
+                isValid = isArrayValid(header, subpart.verticesOffset, subpart.nbVertices, 3 * sizeof(decimal)) &&
+                          isArrayValid(header, subpart.normalsOffset, subpart.nbVertices, 3 * sizeof(decimal)) &&
+                          isArrayValid(header, subpart.indicesOffset, subpart.nbTriangles, 3 * sizeof(uint32));
+                nbTriangles += subpart.nbTriangles;
+            }
+            isValid = isValid && nbTriangles == mesh.nbTriangles;
+            if (!isValid) break;
+
+            if (!areTriangleMeshIndicesValid(data, mesh)) {
+                return logInvalidCookedData("the indices of the triangle mesh are out of range");
+            }
+            break;
+        }
+
+        case CookedDataType::POLYHEDRON_MESH:
+        {
+            isValid = isArrayValid(header, ALIGNMENT, 1, sizeof(PolyhedronMeshData));
+            if (!isValid) break;
+
+            const PolyhedronMeshData& mesh = *getArray<PolyhedronMeshData>(data, ALIGNMENT);
+            isValid = mesh.nbVertices > 0 && mesh.nbFaces > 0 &&
+                      isArrayValid(header, mesh.verticesOffset, mesh.nbVertices, 3 * sizeof(decimal)) &&
+                      isArrayValid(header, mesh.facesOffset, mesh.nbFaces, sizeof(PolygonVertexArray::PolygonFace)) &&
+                      isArrayValid(header, mesh.facesIndicesOffset, mesh.nbFacesIndices, sizeof(uint32)) &&
+                      isArrayValid(header, mesh.halfEdgesOffset, mesh.nbHalfEdges, sizeof(HalfEdgeStructure::Edge)) &&
+                      isArrayValid(header, mesh.verticesEdgesOffset, mesh.nbVertices, sizeof(uint32)) &&
+                      isArrayValid(header, mesh.facesEdgesOffset, mesh.nbFaces, sizeof(uint32));
+            if (!isValid) break;
+
+            if (!arePolyhedronMeshIndicesValid(data, mesh)) {
+                return logInvalidCookedData("the indices of the polyhedron mesh are out of range");
+            }
+            break;
+        }
+
+        case CookedDataType::HEIGHT_FIELD:
+        {
+            isValid = isArrayValid(header, ALIGNMENT, 1, sizeof(HeightFieldData));
+            if (!isValid) break;
+
+            const HeightFieldData& heightField = *getArray<HeightFieldData>(data, ALIGNMENT);
+            uint64 heightSize = 0;
+            switch (static_cast<HeightFieldShape::HeightDataType>(heightField.heightDataType)) {
+                case HeightFieldShape::HeightDataType::HEIGHT_FLOAT_TYPE: heightSize = sizeof(float); break;
+                case HeightFieldShape::HeightDataType::HEIGHT_DOUBLE_TYPE: heightSize = sizeof(double); break;
+                case HeightFieldShape::HeightDataType::HEIGHT_INT_TYPE: heightSize = sizeof(int); break;
+            }
+            isValid = heightSize > 0 && heightField.nbColumns >= 2 && heightField.nbRows >= 2 &&
+                      heightField.upAxis >= 0 && heightField.upAxis <= 2 && heightField.minHeight <= heightField.maxHeight &&
+                      isArrayValid(header, heightField.heightsOffset, uint64(heightField.nbColumns) * uint64(heightField.nbRows), heightSize);
+            break;
+        }
+    }
+
+    if (!isValid) {
+        return logInvalidCookedData("the arrays of the mesh are not inside the data");
+    }
+
+    return true;
+}
+
+// Compute the checksum of a buffer
+/// This is a Fletcher-64 checksum computed on 32-bits words. The modulo is only applied after blocks
+/// of words so that the checksum of a large mesh can be verified quickly.
+/**
+ * @param data Pointer to the beginning of the buffer
+ * @param size Size of the buffer in bytes
+ * @return The checksum of the buffer
+ */
+uint64 MeshCooker::computeChecksum(const void* data, size_t size) {
+
+    const uint64 modulo = 0xffffffff;
+
+    // Maximum number of words that can be added before the sums overflow
+    const size_t blockSize = 32768;
+
+    const uint8* bytes = static_cast<const uint8*>(data);
+    size_t nbWords = size / sizeof(uint32);
+
+    uint64 sum1 = 0;
+    uint64 sum2 = 0;
+    while (nbWords > 0) {
+
+        const size_t nbBlockWords = std::min(nbWords, blockSize);
+        for (size_t i=0; i < nbBlockWords; i++) {
+
+            uint32 word;
+            std::memcpy(&word, bytes, sizeof(uint32));
+            bytes += sizeof(uint32);
+
+            sum1 += word;
+            sum2 += sum1;
+        }
+
+        sum1 %= modulo;
+        sum2 %= modulo;
+        nbWords -= nbBlockWords;
+    }
+
+    // The last bytes are completed with zeros
+    const size_t nbRemainingBytes = size % sizeof(uint32);
+    if (nbRemainingBytes > 0) {
+
+        uint32 word = 0;
+        std::memcpy(&word, bytes, nbRemainingBytes);
+        sum1 = (sum1 + word) % modulo;
+        sum2 = (sum2 + sum1) % modulo;
+    }
+
+    return (sum2 << 32) | sum1;
+}
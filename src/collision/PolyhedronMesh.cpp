@@ -27,6 +27,7 @@
 #include <reactphysics3d/collision/PolyhedronMesh.h>
 #include <reactphysics3d/memory/MemoryManager.h>
 #include <reactphysics3d/collision/PolygonVertexArray.h>
+#include <reactphysics3d/mathematics/SimdDecimal.h>
 #include <cstdlib>
 
 using namespace reactphysics3d;
@@ -39,30 +40,68 @@ using namespace reactphysics3d;
  */
 PolyhedronMesh::PolyhedronMesh(PolygonVertexArray* polygonVertexArray, MemoryAllocator &allocator)
                : mMemoryAllocator(allocator), mHalfEdgeStructure(allocator, polygonVertexArray->getNbFaces(), polygonVertexArray->getNbVertices(),
-                                    (polygonVertexArray->getNbFaces() + polygonVertexArray->getNbVertices() - 2) * 2) {
+                                    (polygonVertexArray->getNbFaces() + polygonVertexArray->getNbVertices() - 2) * 2),
+                 mIsPolygonVertexArrayOwned(false) {
 
    mPolygonVertexArray = polygonVertexArray;
 
    // Create the half-edge structure of the mesh
    createHalfEdgeStructure();
 
+   // Compute the data used to find the support vertices
+   computeVerticesCoordinates();
+   computeVerticesNeighbors();
+
    // Create the face normals array
    mFacesNormals = new Vector3[mHalfEdgeStructure.getNbFaces()];
 
    // Compute the faces normals
    computeFacesNormals();
 
+   // Compute the arrays used by the SAT algorithm
+   computePolyhedronArrays();
+
    // Compute the centroid
    computeCentroid();
 }
 
+// Constructor with the half-edges of the mesh computed before
+/// This constructor is used to create a mesh from cooked data. The mesh takes the ownership of
+/// the polygon vertex array and the half-edges are copied into the half-edge structure.
+PolyhedronMesh::PolyhedronMesh(PolygonVertexArray* polygonVertexArray, const HalfEdgeStructure::Edge* halfEdges, uint nbHalfEdges,
+                               const uint* verticesEdges, const uint* facesEdges, MemoryAllocator& allocator)
+               : mMemoryAllocator(allocator), mHalfEdgeStructure(allocator, polygonVertexArray->getNbFaces(), polygonVertexArray->getNbVertices(), nbHalfEdges),
+                 mIsPolygonVertexArrayOwned(true) {
+
+   mPolygonVertexArray = polygonVertexArray;
+
+   addVerticesAndFaces();
+   mHalfEdgeStructure.init(halfEdges, nbHalfEdges, verticesEdges, facesEdges);
+
+   computeVerticesCoordinates();
+   computeVerticesNeighbors();
+
+   mFacesNormals = new Vector3[mHalfEdgeStructure.getNbFaces()];
+   computeFacesNormals();
+   computePolyhedronArrays();
+   computeCentroid();
+}
+
 // Destructor
 PolyhedronMesh::~PolyhedronMesh() {
     delete[] mFacesNormals;
+    delete[] mVerticesCoordinates;
+    delete[] mVerticesNeighborsStartIndices;
+    delete[] mVerticesNeighbors;
+
+    if (mIsPolygonVertexArrayOwned) {
+        mPolygonVertexArray->~PolygonVertexArray();
+        mMemoryAllocator.release(mPolygonVertexArray, sizeof(PolygonVertexArray));
+    }
 }
 
-// Create the half-edge structure of the mesh
-void PolyhedronMesh::createHalfEdgeStructure() {
+// Add the vertices and faces of the polygon vertex array into the half-edge structure
+void PolyhedronMesh::addVerticesAndFaces() {
 
     // For each vertex of the mesh
     for (uint v=0; v < mPolygonVertexArray->getNbVertices(); v++) {
@@ -87,17 +126,23 @@ void PolyhedronMesh::createHalfEdgeStructure() {
         // Addd the face into the half-edge structure
         mHalfEdgeStructure.addFace(faceVertices);
     }
+}
+
+// Create the half-edge structure of the mesh
+void PolyhedronMesh::createHalfEdgeStructure() {
+
+    addVerticesAndFaces();
 
     // Initialize the half-edge structure
     mHalfEdgeStructure.init();
 }
 
-/// Return a vertex
+// Return a vertex read from the polygon vertex array
 /**
  * @param index Index of a given vertex in the mesh
  * @return The coordinates of a given vertex in the mesh
  */
-Vector3 PolyhedronMesh::getVertex(uint index) const {
+Vector3 PolyhedronMesh::readVertex(uint index) const {
     assert(index < getNbVertices());
 
     // Get the vertex index in the array with all vertices
@@ -127,6 +172,226 @@ Vector3 PolyhedronMesh::getVertex(uint index) const {
     return vertex;
 }
 
+// Compute the arrays with the coordinates of the vertices
+/// The vertices are copied from the polygon vertex array (whatever their data type is) into
+/// three arrays of decimals so that the dot products of several vertices with a support
+/// direction can be computed at once with SIMD instructions.
+void PolyhedronMesh::computeVerticesCoordinates() {
+
+    const uint nbVertices = getNbVertices();
+    assert(nbVertices > 0);
+
+    mNbPaddedVertices = ((nbVertices + SIMD_DECIMAL_NB_LANES - 1) / SIMD_DECIMAL_NB_LANES) * SIMD_DECIMAL_NB_LANES;
+    mVerticesCoordinates = new decimal[3 * mNbPaddedVertices];
+
+    for (uint v=0; v < mNbPaddedVertices; v++) {
+
+        // The padding is filled with the first vertex so that it is never
+        // selected instead of a real vertex as a support vertex
+        const Vector3 vertex = readVertex(v < nbVertices ? v : 0);
+        mVerticesCoordinates[v] = vertex.x;
+        mVerticesCoordinates[mNbPaddedVertices + v] = vertex.y;
+        mVerticesCoordinates[2 * mNbPaddedVertices + v] = vertex.z;
+    }
+}
+
+// Compute the neighbor vertices of each vertex
+/// Each half-edge of the mesh gives a neighbor of its start vertex (the start vertex of
+/// its twin edge).
+void PolyhedronMesh::computeVerticesNeighbors() {
+
+    const uint nbVertices = getNbVertices();
+    const uint nbHalfEdges = mHalfEdgeStructure.getNbHalfEdges();
+
+    mVerticesNeighborsStartIndices = new uint[nbVertices + 1];
+    mVerticesNeighbors = new uint[nbHalfEdges];
+
+    // Count the number of neighbors of each vertex
+    for (uint v=0; v <= nbVertices; v++) {
+        mVerticesNeighborsStartIndices[v] = 0;
+    }
+    for (uint e=0; e < nbHalfEdges; e++) {
+        mVerticesNeighborsStartIndices[mHalfEdgeStructure.getHalfEdge(e).vertexIndex + 1]++;
+    }
+
+    mIsHillClimbingEnabled = true;
+    for (uint v=0; v < nbVertices; v++) {
+        if (mVerticesNeighborsStartIndices[v + 1] < 3) {
+            mIsHillClimbingEnabled = false;
+        }
+        mVerticesNeighborsStartIndices[v + 1] += mVerticesNeighborsStartIndices[v];
+    }
+
+    // Fill the neighbors of each vertex
+    List<uint> nbAddedNeighbors(mMemoryAllocator, nbVertices);
+    for (uint v=0; v < nbVertices; v++) {
+        nbAddedNeighbors.add(0);
+    }
+    for (uint e=0; e < nbHalfEdges; e++) {
+
+        const HalfEdgeStructure::Edge& edge = mHalfEdgeStructure.getHalfEdge(e);
+        const uint neighborIndex = mHalfEdgeStructure.getHalfEdge(edge.twinEdgeIndex).vertexIndex;
+
+        mVerticesNeighbors[mVerticesNeighborsStartIndices[edge.vertexIndex] + nbAddedNeighbors[edge.vertexIndex]] = neighborIndex;
+        nbAddedNeighbors[edge.vertexIndex]++;
+    }
+}
+
+// Return the index of the vertex with the largest dot product with a direction
+/// The dot products of SIMD_DECIMAL_NB_LANES vertices are computed at once. If several
+/// vertices have the same largest dot product, the one with the smallest index is returned
+/// (as with a scalar loop over the vertices).
+/**
+ * @param direction Support direction (in the space of the mesh vertices)
+ * @return The index of the support vertex
+ */
+uint PolyhedronMesh::computeSupportVertexLinearScan(const Vector3& direction) const {
+
+    const decimal* verticesX = mVerticesCoordinates;
+    const decimal* verticesY = mVerticesCoordinates + mNbPaddedVertices;
+    const decimal* verticesZ = mVerticesCoordinates + 2 * mNbPaddedVertices;
+
+    const SimdDecimal directionX(direction.x);
+    const SimdDecimal directionY(direction.y);
+    const SimdDecimal directionZ(direction.z);
+    const SimdDecimal indicesIncrement = SimdDecimal(decimal(SIMD_DECIMAL_NB_LANES));
+
+    // The vertex indices are stored as decimals in order to be selected like the dot products
+    decimal lanesIndices[SIMD_DECIMAL_NB_LANES];
+    for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) {
+        lanesIndices[i] = decimal(i);
+    }
+    SimdDecimal indices = SimdDecimal::load(lanesIndices);
+
+    SimdDecimal maxDotProducts(DECIMAL_SMALLEST);
+    SimdDecimal maxIndices(decimal(0.0));
+
+    for (uint v=0; v < mNbPaddedVertices; v += SIMD_DECIMAL_NB_LANES) {
+
+        const SimdDecimal dotProducts = SimdDecimal::load(verticesX + v) * directionX +
+                                        SimdDecimal::load(verticesY + v) * directionY +
+                                        SimdDecimal::load(verticesZ + v) * directionZ;
+
+        maxIndices = SimdDecimal::selectGreater(dotProducts, maxDotProducts, indices, maxIndices);
+        maxDotProducts = SimdDecimal::max(dotProducts, maxDotProducts);
+        indices += indicesIncrement;
+    }
+
+    // Select the largest dot product among the lanes
+    decimal lanesMaxDotProducts[SIMD_DECIMAL_NB_LANES];
+    maxDotProducts.store(lanesMaxDotProducts);
+    maxIndices.store(lanesIndices);
+
+    decimal maxDotProduct = lanesMaxDotProducts[0];
+    decimal maxIndex = lanesIndices[0];
+    for (uint32 i=1; i < SIMD_DECIMAL_NB_LANES; i++) {
+        if (lanesMaxDotProducts[i] > maxDotProduct ||
+            (lanesMaxDotProducts[i] == maxDotProduct && lanesIndices[i] < maxIndex)) {
+            maxDotProduct = lanesMaxDotProducts[i];
+            maxIndex = lanesIndices[i];
+        }
+    }
+
+    assert(uint(maxIndex) < getNbVertices());
+
+    return uint(maxIndex);
+}
+
+// Return the index of the support vertex found with hill-climbing from a given vertex
+/// At each step, we move to the neighbor vertex with the largest dot product with the
+/// direction if it is larger than the one of the current vertex. Because the mesh is
+/// convex, a vertex without a better neighbor is a support vertex. This is much faster
+/// than a linear scan when the start vertex is close to the support vertex (support
+/// vertex of the previous frame for instance).
+/**
+ * @param direction Support direction (in the space of the mesh vertices)
+ * @param startVertexIndex Index of the vertex where the search starts
+ * @return The index of the support vertex
+ */
+uint PolyhedronMesh::computeSupportVertexHillClimbing(const Vector3& direction, uint startVertexIndex) const {
+
+    assert(mIsHillClimbingEnabled);
+
+    uint currentIndex = startVertexIndex < getNbVertices() ? startVertexIndex : 0;
+    decimal currentDotProduct = direction.dot(getVertex(currentIndex));
+
+    // The dot product of the current vertex strictly increases at each step
+    // and therefore the search always ends
+    bool isBetterNeighborFound;
+    do {
+
+        isBetterNeighborFound = false;
+        uint bestNeighborIndex = currentIndex;
+
+        // For each neighbor of the current vertex
+        for (uint n = mVerticesNeighborsStartIndices[currentIndex]; n < mVerticesNeighborsStartIndices[currentIndex + 1]; n++) {
+
+            const uint neighborIndex = mVerticesNeighbors[n];
+            const decimal dotProduct = direction.dot(getVertex(neighborIndex));
+
+            if (dotProduct > currentDotProduct) {
+                currentDotProduct = dotProduct;
+                bestNeighborIndex = neighborIndex;
+                isBetterNeighborFound = true;
+            }
+        }
+
+        currentIndex = bestNeighborIndex;
+
+    } while (isBetterNeighborFound);
+
+    return currentIndex;
+}
+
+// Compute the indices of the vertices with the largest dot products with several directions
+/// The directions are processed SIMD_DECIMAL_NB_LANES at a time and the dot products of the
+/// vertices with those directions are computed at once. The selected vertices are the same as
+/// the ones returned by computeSupportVertexLinearScan() for each direction.
+/**
+ * @param directions Array with the x, y and z coordinates of the directions (nbDirections values each)
+ * @param nbDirections Number of directions (a multiple of the number of SIMD lanes)
+ * @param[out] outVerticesIndices Array with the index of the support vertex of each direction
+ */
+void PolyhedronMesh::computeSupportVerticesLinearScan(const decimal* directions, uint nbDirections,
+                                                      uint* outVerticesIndices) const {
+
+    assert(nbDirections % SIMD_DECIMAL_NB_LANES == 0);
+
+    const uint nbVertices = getNbVertices();
+    const decimal* verticesX = mVerticesCoordinates;
+    const decimal* verticesY = mVerticesCoordinates + mNbPaddedVertices;
+    const decimal* verticesZ = mVerticesCoordinates + 2 * mNbPaddedVertices;
+
+    for (uint d=0; d < nbDirections; d += SIMD_DECIMAL_NB_LANES) {
+
+        const SimdDecimal directionX = SimdDecimal::load(directions + d);
+        const SimdDecimal directionY = SimdDecimal::load(directions + nbDirections + d);
+        const SimdDecimal directionZ = SimdDecimal::load(directions + 2 * nbDirections + d);
+
+        SimdDecimal maxDotProducts(DECIMAL_SMALLEST);
+        SimdDecimal maxIndices(decimal(0.0));
+
+        // A vertex only replaces the current support vertex of a direction if its dot product
+        // is strictly larger. Therefore, the vertex with the smallest index is kept in case of equality
+        for (uint v=0; v < nbVertices; v++) {
+
+            const SimdDecimal dotProducts = SimdDecimal(verticesX[v]) * directionX +
+                                            SimdDecimal(verticesY[v]) * directionY +
+                                            SimdDecimal(verticesZ[v]) * directionZ;
+
+            maxIndices = SimdDecimal::selectGreater(dotProducts, maxDotProducts, SimdDecimal(decimal(v)), maxIndices);
+            maxDotProducts = SimdDecimal::max(dotProducts, maxDotProducts);
+        }
+
+        decimal lanesIndices[SIMD_DECIMAL_NB_LANES];
+        maxIndices.store(lanesIndices);
+        for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) {
+            assert(uint(lanesIndices[i]) < nbVertices);
+            outVerticesIndices[d + i] = uint(lanesIndices[i]);
+        }
+    }
+}
+
 // Compute the faces normals
 void PolyhedronMesh::computeFacesNormals() {
 
@@ -143,6 +408,20 @@ void PolyhedronMesh::computeFacesNormals() {
     }
 }
 
+// Compute the arrays of faces and edges used by the SAT algorithm
+void PolyhedronMesh::computePolyhedronArrays() {
+
+    const uint nbVertices = getNbVertices();
+    Vector3* vertices = new Vector3[nbVertices];
+    for (uint v=0; v < nbVertices; v++) {
+        vertices[v] = getVertex(v);
+    }
+
+    mPolyhedronArrays.compute(mHalfEdgeStructure, vertices, mFacesNormals);
+
+    delete[] vertices;
+}
+
 // Compute the centroid of the polyhedron
 void PolyhedronMesh::computeCentroid() {
 
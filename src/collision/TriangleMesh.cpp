@@ -25,15 +25,23 @@
 
 // Libraries
 #include <reactphysics3d/collision/TriangleMesh.h>
+#include <reactphysics3d/collision/TriangleVertexArray.h>
 
 using namespace reactphysics3d;
 
 // Constructor
-TriangleMesh::TriangleMesh(MemoryAllocator& allocator) : mTriangleArrays(allocator) {
+TriangleMesh::TriangleMesh(MemoryAllocator& allocator)
+             : mAllocator(allocator), mTriangleArrays(allocator), mCookedTriangleArrays(allocator), mCookedTreeNodes(nullptr),
+               mCookedTreeRootReference(0), mCookedTreeRootAABB(Vector3::zero(), Vector3::zero()), mCookedTreeNbTriangles(0) {
 
 }
 
 // Destructor
 TriangleMesh::~TriangleMesh() {
 
+    // Destroy the triangle arrays created from cooked data
+    for (uint i=0; i < mCookedTriangleArrays.size(); i++) {
+        mCookedTriangleArrays[i]->~TriangleVertexArray();
+        mAllocator.release(mCookedTriangleArrays[i], sizeof(TriangleVertexArray));
+    }
 }
@@ -25,14 +25,33 @@
 
 // Libraries
 #include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/collision/broadphase/BroadPhaseStrategy.h>
 #include <reactphysics3d/systems/BroadPhaseSystem.h>
 #include <reactphysics3d/containers/Stack.h>
 #include <reactphysics3d/utils/Profiler.h>
+#include <algorithm>
 
 using namespace reactphysics3d;
 
 // Initialization of static variables
 const int32 TreeNode::NULL_TREE_NODE = -1;
+const uint32 DynamicAABBTree::NB_BINS;
+
+// Return half the surface area of an AABB
+static inline decimal computeHalfSurfaceArea(const Vector3& aabbMin, const Vector3& aabbMax) {
+    const Vector3 extent = aabbMax - aabbMin;
+    return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
+
+// Return half the surface area of an AABB
+static inline decimal computeHalfSurfaceArea(const AABB& aabb) {
+    return computeHalfSurfaceArea(aabb.getMin(), aabb.getMax());
+}
+
+// Return half the surface area of the union of two AABBs
+static inline decimal computeHalfSurfaceArea(const AABB& aabb1, const AABB& aabb2) {
+    return computeHalfSurfaceArea(Vector3::min(aabb1.getMin(), aabb2.getMin()), Vector3::max(aabb1.getMax(), aabb2.getMax()));
+}
 
 // Constructor
 DynamicAABBTree::DynamicAABBTree(MemoryAllocator& allocator, decimal fatAABBInflatePercentage)
@@ -54,6 +73,7 @@ void DynamicAABBTree::init() {
     mRootNodeID = TreeNode::NULL_TREE_NODE;
     mNbNodes = 0;
     mNbAllocatedNodes = 8;
+    mOptimizationNodeID = 0;
 
     // Allocate memory for the nodes of the tree
     mNodes = static_cast<TreeNode*>(mAllocator.allocate(static_cast<size_t>(mNbAllocatedNodes) * sizeof(TreeNode)));
@@ -136,9 +156,7 @@ int32 DynamicAABBTree::addObjectInternal(const AABB& aabb) {
     int32 nodeID = allocateNode();
 
     // Create the fat aabb to use in the tree (inflate the aabb by a constant percentage of its size)
-    const Vector3 gap(aabb.getExtent() * mFatAABBInflatePercentage * decimal(0.5f));
-    mNodes[nodeID].aabb.setMin(aabb.getMin() - gap);
-    mNodes[nodeID].aabb.setMax(aabb.getMax() + gap);
+    BroadPhaseStrategy::computeFatAABB(aabb, Vector3::zero(), mFatAABBInflatePercentage, mNodes[nodeID].aabb);
 
     // Set the height of the node in the tree
     mNodes[nodeID].height = 0;
@@ -165,13 +183,14 @@ void DynamicAABBTree::removeObject(int32 nodeID) {
 }
 
 // Update the dynamic tree after an object has moved.
-/// If the new AABB of the object that has moved is still inside its fat AABB, then
-/// nothing is done. Otherwise, the corresponding node is removed and reinserted into the tree.
+/// If the new AABB of the object that has moved is still inside its fat AABB (and the fat AABB
+/// is not much larger than needed), then nothing is done. Otherwise, the corresponding node is removed
+/// and reinserted into the tree with a new fat AABB extended along the predicted displacement of the object.
 /// The method returns true if the object has been reinserted into the tree.
 /// If the "forceReInsert" parameter is true, we force the existing AABB to take the size
 /// of the "newAABB" parameter even if it is larger than "newAABB". This can be used to shrink the
 /// AABB in the tree for instance if the corresponding collision shape has been shrunk.
-bool DynamicAABBTree::updateObject(int32 nodeID, const AABB& newAABB, bool forceReinsert) {
+bool DynamicAABBTree::updateObject(int32 nodeID, const AABB& newAABB, bool forceReinsert, const Vector3& displacement) {
 
     RP3D_PROFILE("DynamicAABBTree::updateObject()", mProfiler);
 
@@ -180,20 +199,17 @@ bool DynamicAABBTree::updateObject(int32 nodeID, const AABB& newAABB, bool force
     assert(mNodes[nodeID].height >= 0);
 
     // If the new AABB is still inside the fat AABB of the node
-    if (!forceReinsert && mNodes[nodeID].aabb.contains(newAABB)) {
+    if (!forceReinsert && BroadPhaseStrategy::isFatAABBStillValid(mNodes[nodeID].aabb, newAABB, displacement,
+                                                                  mFatAABBInflatePercentage)) {
         return false;
     }
 
     // If the new AABB is outside the fat AABB, we remove the corresponding node
     removeLeafNode(nodeID);
 
-    // Compute the fat AABB by inflating the AABB with by a constant percentage of the size of the AABB
-    mNodes[nodeID].aabb = newAABB;
-    const Vector3 gap(newAABB.getExtent() * mFatAABBInflatePercentage * decimal(0.5f));
-    mNodes[nodeID].aabb.mMinCoordinates -= gap;
-    mNodes[nodeID].aabb.mMaxCoordinates += gap;
-
-    assert(mNodes[nodeID].aabb.contains(newAABB));
+    // Compute the fat AABB by inflating the AABB by a constant percentage of its size and
+    // by extending it along the displacement
+    BroadPhaseStrategy::computeFatAABB(newAABB, displacement, mFatAABBInflatePercentage, mNodes[nodeID].aabb);
 
     // Reinsert the node into the tree
     insertLeafNode(nodeID);
@@ -574,54 +590,80 @@ int32 DynamicAABBTree::balanceSubTreeAtNode(int32 nodeID) {
 }
 
 /// Take a list of shapes to be tested for broad-phase overlap and return a list of pair of overlapping shapes
+/// This method does not modify the tree and can be called by several threads at the same time.
 void DynamicAABBTree::reportAllShapesOverlappingWithShapes(const List<int32>& nodesToTest, size_t startIndex,
                                                            size_t endIndex, List<Pair<int32, int32>>& outOverlappingNodes) const {
 
-    RP3D_PROFILE("DynamicAABBTree::reportAllShapesOverlappingWithAABB()", mProfiler);
+    RP3D_PROFILE("DynamicAABBTree::reportAllShapesOverlappingWithShapes()", mProfiler);
 
-    // Create a stack with the nodes to visit
+    if (mRootNodeID == TreeNode::NULL_TREE_NODE) return;
+
+    // Create a stack with the internal nodes to visit
     Stack<int32> stack(mAllocator, 64);
 
     // For each shape to be tested for overlap
-    for (uint i=startIndex; i < endIndex; i++) {
+    for (size_t i=startIndex; i < endIndex; i++) {
+
+        const int32 nodeIDToTest = nodesToTest[i];
+        assert(nodeIDToTest != -1);
+
+        reportAllShapesOverlappingWithAABB(getFatAABB(nodeIDToTest), nodeIDToTest, stack, outOverlappingNodes);
+    }
+}
+
+// Report the pairs (ID in parameter, leaf node) for all the leaf nodes overlapping with an AABB
+/// The children of a node are tested before being pushed on the stack. Therefore, only the internal
+/// nodes that overlap with the AABB are pushed and the overlapping leaves are reported directly. The
+/// stack is given by the caller so that it can be reused for several AABBs and it is empty at the end.
+/// This method does not modify the tree and can be called by several threads at the same time.
+void DynamicAABBTree::reportAllShapesOverlappingWithAABB(const AABB& aabb, int32 idToReport, Stack<int32>& stack,
+                                                         List<Pair<int32, int32>>& outOverlappingNodes) const {
+
+    if (mRootNodeID == TreeNode::NULL_TREE_NODE) return;
+
+    const TreeNode* rootNode = mNodes + mRootNodeID;
 
-        assert(nodesToTest[i] != -1);
+    if (!aabb.testCollision(rootNode->aabb)) return;
 
-        stack.push(mRootNodeID);
+    if (rootNode->isLeaf()) {
+        outOverlappingNodes.add(Pair<int32, int32>(idToReport, mRootNodeID));
+        return;
+    }
 
-        const AABB& shapeAABB = getFatAABB(nodesToTest[i]);
+    assert(stack.size() == 0);
+    stack.push(mRootNodeID);
 
-        // While there are still nodes to visit
-        while(stack.size() > 0) {
+    // While there are still nodes to visit
+    while(stack.size() > 0) {
 
-            // Get the next node ID to visit
-            const int32 nodeIDToVisit = stack.pop();
+        // Get the next internal node (overlapping with the AABB) to visit
+        const TreeNode* nodeToVisit = mNodes + stack.pop();
 
-            // Skip it if it is a null node
-            if (nodeIDToVisit == TreeNode::NULL_TREE_NODE) continue;
+        assert(!nodeToVisit->isLeaf());
 
-            // Get the corresponding node
-            const TreeNode* nodeToVisit = mNodes + nodeIDToVisit;
+        // For each child of the node
+        for (int c=0; c < 2; c++) {
 
-            // If the AABB in parameter overlaps with the AABB of the node to visit
-            if (shapeAABB.testCollision(nodeToVisit->aabb)) {
+            const int32 childNodeID = nodeToVisit->children[c];
+            assert(childNodeID != TreeNode::NULL_TREE_NODE);
+            const TreeNode* childNode = mNodes + childNodeID;
 
-                // If the node is a leaf
-                if (nodeToVisit->isLeaf()) {
+            // If the AABB in parameter overlaps with the AABB of the child
+            if (aabb.testCollision(childNode->aabb)) {
+
+                // If the child is a leaf
+                if (childNode->isLeaf()) {
 
                     // Add the node in the list of overlapping nodes
-                    outOverlappingNodes.add(Pair<int32, int32>(nodesToTest[i], nodeIDToVisit));
+                    outOverlappingNodes.add(Pair<int32, int32>(idToReport, childNodeID));
                 }
-                else {  // If the node is not a leaf
+                else {
 
-                    // We need to visit its children
-                    stack.push(nodeToVisit->children[0]);
-                    stack.push(nodeToVisit->children[1]);
+                    // We need to visit the children of the child
+                    stack.push(childNodeID);
                 }
             }
         }
-
-        stack.clear();
     }
 }
 
@@ -727,6 +769,359 @@ void DynamicAABBTree::raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& ca
     }
 }
 
+// Rebuild the tree top-down from its leaves
+/// The internal nodes are released and the leaves are recursively split in two groups using the surface
+/// area heuristic (SAH) with binned centroids as in the StaticAABBTree. This takes O(n log n) time and
+/// gives a much better tree than the incremental insertions when the objects have moved a lot. The IDs
+/// of the leaf nodes (and therefore of the objects) do not change.
+void DynamicAABBTree::rebuild() {
+
+    RP3D_PROFILE("DynamicAABBTree::rebuild()", mProfiler);
+
+    if (mRootNodeID == TreeNode::NULL_TREE_NODE || mNodes[mRootNodeID].isLeaf()) return;
+
+    // Collect the leaves and release the internal nodes (in decreasing order of their IDs so that the
+    // nodes of the new tree are allocated in increasing order)
+    const int32 nbLeaves = (mNbNodes + 1) / 2;
+    List<BuildLeaf> leaves(mAllocator, static_cast<uint32>(nbLeaves));
+    for (int32 nodeID = mNbAllocatedNodes - 1; nodeID >= 0; nodeID--) {
+
+        const TreeNode& node = mNodes[nodeID];
+
+        if (node.isLeaf()) {
+            BuildLeaf leaf;
+            leaf.aabbMin = node.aabb.getMin();
+            leaf.aabbMax = node.aabb.getMax();
+            leaf.centroid = (leaf.aabbMin + leaf.aabbMax) * decimal(0.5);
+            leaf.nodeID = nodeID;
+            leaves.add(leaf);
+        }
+        else if (node.height > 0) {
+            releaseNode(nodeID);
+        }
+    }
+    assert(static_cast<int32>(leaves.size()) == nbLeaves);
+    assert(mNbNodes == nbLeaves);
+
+    // Range of leaves to put into the sub-tree of a child of an internal node
+    struct BuildTask {
+        uint32 startIndex;
+        uint32 endIndex;
+        int32 parentNodeID;
+        int childIndex;
+    };
+
+    // The internal nodes are created before their children. Their AABBs and heights are
+    // computed at the end in the reverse order
+    List<int32> internalNodes(mAllocator, static_cast<uint32>(nbLeaves - 1));
+
+    Stack<BuildTask> tasks(mAllocator, 64);
+    tasks.push(BuildTask{0, static_cast<uint32>(leaves.size()), TreeNode::NULL_TREE_NODE, 0});
+
+    while (tasks.size() > 0) {
+
+        const BuildTask task = tasks.pop();
+
+        int32 nodeID;
+
+        // If the range contains a single leaf, the leaf is the child
+        if (task.endIndex - task.startIndex == 1) {
+            nodeID = leaves[task.startIndex].nodeID;
+        }
+        else {
+
+            nodeID = allocateNode();
+            mNodes[nodeID].height = 1;
+            internalNodes.add(nodeID);
+
+            const uint32 splitIndex = splitLeaves(leaves, task.startIndex, task.endIndex);
+            tasks.push(BuildTask{task.startIndex, splitIndex, nodeID, 0});
+            tasks.push(BuildTask{splitIndex, task.endIndex, nodeID, 1});
+        }
+
+        mNodes[nodeID].parentID = task.parentNodeID;
+        if (task.parentNodeID != TreeNode::NULL_TREE_NODE) {
+            mNodes[task.parentNodeID].children[task.childIndex] = nodeID;
+        }
+        else {
+            mRootNodeID = nodeID;
+        }
+    }
+
+    for (int32 i = static_cast<int32>(internalNodes.size()) - 1; i >= 0; i--) {
+        refitNode(internalNodes[i]);
+    }
+
+    assert(mNbNodes == 2 * nbLeaves - 1);
+}
+
+// Split the leaves [startIndex, endIndex) in two groups and return the index of the first leaf of the second group
+/// The centroids of the leaves are put into bins along the axis where they are the most spread out and the
+/// split plane between two bins with the smallest SAH cost (surface area times number of leaves of each side)
+/// is selected. If all the centroids are at the same position, the leaves are split in two halves.
+uint32 DynamicAABBTree::splitLeaves(List<BuildLeaf>& leaves, uint32 startIndex, uint32 endIndex) const {
+
+    assert(endIndex - startIndex >= 2);
+
+    BuildLeaf* leavesArray = &(leaves[0]);
+
+    // Compute the AABB of the centroids
+    Vector3 centroidsMin = leavesArray[startIndex].centroid;
+    Vector3 centroidsMax = centroidsMin;
+    for (uint32 i=startIndex + 1; i < endIndex; i++) {
+        centroidsMin = Vector3::min(centroidsMin, leavesArray[i].centroid);
+        centroidsMax = Vector3::max(centroidsMax, leavesArray[i].centroid);
+    }
+    const Vector3 centroidsExtent = centroidsMax - centroidsMin;
+
+    const int axis = centroidsExtent.getMaxAxis();
+    if (centroidsExtent[axis] <= decimal(0.0)) return (startIndex + endIndex) / 2;
+
+    const decimal binScale = decimal(NB_BINS) / centroidsExtent[axis];
+    const decimal centroidsMinAxis = centroidsMin[axis];
+
+    auto computeBin = [&](const BuildLeaf& leaf) {
+        return std::min(NB_BINS - 1, static_cast<uint32>((leaf.centroid[axis] - centroidsMinAxis) * binScale));
+    };
+
+    // Put the leaves into the bins
+    Vector3 binsMin[NB_BINS];
+    Vector3 binsMax[NB_BINS];
+    uint32 binsNbLeaves[NB_BINS] = {};
+    for (uint32 bin=0; bin < NB_BINS; bin++) {
+        binsMin[bin].setAllValues(DECIMAL_LARGEST, DECIMAL_LARGEST, DECIMAL_LARGEST);
+        binsMax[bin].setAllValues(-DECIMAL_LARGEST, -DECIMAL_LARGEST, -DECIMAL_LARGEST);
+    }
+    for (uint32 i=startIndex; i < endIndex; i++) {
+
+        const BuildLeaf& leaf = leavesArray[i];
+        const uint32 bin = computeBin(leaf);
+        binsMin[bin] = Vector3::min(binsMin[bin], leaf.aabbMin);
+        binsMax[bin] = Vector3::max(binsMax[bin], leaf.aabbMax);
+        binsNbLeaves[bin]++;
+    }
+
+    // Sweep from the right to compute the surface area and the number of leaves on the right of
+    // each plane (the plane i is between the bins i-1 and i)
+    decimal rightCosts[NB_BINS];
+    Vector3 rightMin = binsMin[NB_BINS - 1];
+    Vector3 rightMax = binsMax[NB_BINS - 1];
+    uint32 nbLeaves = binsNbLeaves[NB_BINS - 1];
+    for (uint32 plane=NB_BINS - 1; plane > 0; plane--) {
+        if (plane < NB_BINS - 1) {
+            rightMin = Vector3::min(rightMin, binsMin[plane]);
+            rightMax = Vector3::max(rightMax, binsMax[plane]);
+            nbLeaves += binsNbLeaves[plane];
+        }
+        rightCosts[plane] = nbLeaves > 0 ? computeHalfSurfaceArea(rightMin, rightMax) * nbLeaves : decimal(-1.0);
+    }
+
+    // Sweep from the left to find the plane with the smallest cost
+    decimal bestCost = DECIMAL_LARGEST;
+    uint32 bestPlane = 0;
+    Vector3 leftMin = binsMin[0];
+    Vector3 leftMax = binsMax[0];
+    nbLeaves = 0;
+    for (uint32 plane=1; plane < NB_BINS; plane++) {
+
+        const uint32 bin = plane - 1;
+        leftMin = Vector3::min(leftMin, binsMin[bin]);
+        leftMax = Vector3::max(leftMax, binsMax[bin]);
+        nbLeaves += binsNbLeaves[bin];
+
+        if (nbLeaves == 0 || rightCosts[plane] < decimal(0.0)) continue;
+
+        const decimal cost = computeHalfSurfaceArea(leftMin, leftMax) * nbLeaves + rightCosts[plane];
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestPlane = plane;
+        }
+    }
+
+    // The first and the last bins are never empty because they contain the extreme centroids
+    assert(bestPlane > 0);
+
+    // Move the leaves on the left of the best plane before the other ones
+    BuildLeaf* split = std::partition(leavesArray + startIndex, leavesArray + endIndex, [&](const BuildLeaf& leaf) {
+        return computeBin(leaf) < bestPlane;
+    });
+    const uint32 splitIndex = static_cast<uint32>(split - leavesArray);
+
+    assert(splitIndex > startIndex && splitIndex < endIndex);
+
+    return splitIndex;
+}
+
+// Improve the tree with rotations of a limited number of internal nodes
+/// The internal nodes are visited in the order of their IDs, starting where the previous call has
+/// stopped, and the best rotation below each of them is applied if it reduces the surface area of its
+/// children. This is the incremental optimization of "Fast, Effective BVH Updates for Animated Scenes"
+/// by Kopta et al. Calling this method each frame with a small number of nodes keeps the quality of
+/// the tree close to the quality of a rebuilt tree while the objects are moving.
+void DynamicAABBTree::optimize(uint32 nbMaxNodesToVisit) {
+
+    RP3D_PROFILE("DynamicAABBTree::optimize()", mProfiler);
+
+    if (mRootNodeID == TreeNode::NULL_TREE_NODE || mNodes[mRootNodeID].isLeaf()) return;
+
+    // Each allocated node is considered at most once
+    uint32 nbNodesToVisit = std::min(nbMaxNodesToVisit, static_cast<uint32>(mNbNodes));
+    for (int32 i=0; i < mNbAllocatedNodes && nbNodesToVisit > 0; i++) {
+
+        if (mOptimizationNodeID >= mNbAllocatedNodes) {
+            mOptimizationNodeID = 0;
+        }
+
+        const int32 nodeID = mOptimizationNodeID;
+        mOptimizationNodeID++;
+
+        // Skip the free nodes and the leaves
+        if (mNodes[nodeID].height <= 0) continue;
+
+        rotateNode(nodeID);
+        nbNodesToVisit--;
+    }
+}
+
+// Apply the rotation below an internal node that reduces the most the surface area of its children
+/// A rotation exchanges a child with a child of the other child or two grand-children from different
+/// children. The AABB of the node itself does not change. The method returns true if a rotation
+/// has been applied.
+bool DynamicAABBTree::rotateNode(int32 nodeID) {
+
+    assert(mNodes[nodeID].height > 0);
+
+    const int32 leftID = mNodes[nodeID].children[0];
+    const int32 rightID = mNodes[nodeID].children[1];
+    const TreeNode& left = mNodes[leftID];
+    const TreeNode& right = mNodes[rightID];
+
+    // The node cannot be improved if both children are leaves
+    if (left.isLeaf() && right.isLeaf()) return false;
+
+    const decimal leftArea = computeHalfSurfaceArea(left.aabb);
+    const decimal rightArea = computeHalfSurfaceArea(right.aabb);
+
+    // Find the rotation with the largest reduction of the surface area of the children
+    decimal bestGain = decimal(0.0);
+    int32 bestNode1 = TreeNode::NULL_TREE_NODE;
+    int32 bestNode2 = TreeNode::NULL_TREE_NODE;
+
+    auto testRotation = [&](decimal gain, int32 node1, int32 node2) {
+        if (gain > bestGain) {
+            bestGain = gain;
+            bestNode1 = node1;
+            bestNode2 = node2;
+        }
+    };
+
+    if (!right.isLeaf()) {
+
+        // Exchange the left child with a child of the right child
+        const AABB& rightLeft = mNodes[right.children[0]].aabb;
+        const AABB& rightRight = mNodes[right.children[1]].aabb;
+        testRotation(rightArea - computeHalfSurfaceArea(left.aabb, rightRight), leftID, right.children[0]);
+        testRotation(rightArea - computeHalfSurfaceArea(left.aabb, rightLeft), leftID, right.children[1]);
+    }
+
+    if (!left.isLeaf()) {
+
+        // Exchange the right child with a child of the left child
+        const AABB& leftLeft = mNodes[left.children[0]].aabb;
+        const AABB& leftRight = mNodes[left.children[1]].aabb;
+        testRotation(leftArea - computeHalfSurfaceArea(right.aabb, leftRight), rightID, left.children[0]);
+        testRotation(leftArea - computeHalfSurfaceArea(right.aabb, leftLeft), rightID, left.children[1]);
+
+        if (!right.isLeaf()) {
+
+            // Exchange the left child of the left child with a child of the right child
+            const AABB& rightLeft = mNodes[right.children[0]].aabb;
+            const AABB& rightRight = mNodes[right.children[1]].aabb;
+            testRotation(leftArea + rightArea - computeHalfSurfaceArea(rightLeft, leftRight) -
+                         computeHalfSurfaceArea(leftLeft, rightRight), left.children[0], right.children[0]);
+            testRotation(leftArea + rightArea - computeHalfSurfaceArea(rightRight, leftRight) -
+                         computeHalfSurfaceArea(rightLeft, leftLeft), left.children[0], right.children[1]);
+        }
+    }
+
+    if (bestNode1 == TreeNode::NULL_TREE_NODE) return false;
+
+    const int32 parent1 = mNodes[bestNode1].parentID;
+    const int32 parent2 = mNodes[bestNode2].parentID;
+
+    swapNodes(bestNode1, bestNode2);
+
+    // Recompute the children whose content has changed and the node
+    if (parent1 != nodeID) refitNode(parent1);
+    if (parent2 != nodeID) refitNode(parent2);
+    refitNode(nodeID);
+
+    // The AABBs of the ancestors do not change but their heights might
+    int32 currentNodeID = mNodes[nodeID].parentID;
+    while (currentNodeID != TreeNode::NULL_TREE_NODE) {
+
+        const TreeNode& node = mNodes[currentNodeID];
+        const int16 height = std::max(mNodes[node.children[0]].height, mNodes[node.children[1]].height) + 1;
+        if (height == node.height) break;
+
+        mNodes[currentNodeID].height = height;
+        currentNodeID = node.parentID;
+    }
+
+    return true;
+}
+
+// Exchange the positions of two nodes in the tree (none of them is an ancestor of the other)
+void DynamicAABBTree::swapNodes(int32 nodeID1, int32 nodeID2) {
+
+    const int32 parentID1 = mNodes[nodeID1].parentID;
+    const int32 parentID2 = mNodes[nodeID2].parentID;
+    assert(parentID1 != TreeNode::NULL_TREE_NODE && parentID2 != TreeNode::NULL_TREE_NODE);
+
+    const int childIndex1 = mNodes[parentID1].children[0] == nodeID1 ? 0 : 1;
+    const int childIndex2 = mNodes[parentID2].children[0] == nodeID2 ? 0 : 1;
+    assert(mNodes[parentID1].children[childIndex1] == nodeID1);
+    assert(mNodes[parentID2].children[childIndex2] == nodeID2);
+
+    mNodes[parentID1].children[childIndex1] = nodeID2;
+    mNodes[parentID2].children[childIndex2] = nodeID1;
+    mNodes[nodeID1].parentID = parentID2;
+    mNodes[nodeID2].parentID = parentID1;
+}
+
+// Recompute the AABB and the height of an internal node from its children
+void DynamicAABBTree::refitNode(int32 nodeID) {
+
+    TreeNode& node = mNodes[nodeID];
+    assert(node.height > 0);
+
+    const TreeNode& leftChild = mNodes[node.children[0]];
+    const TreeNode& rightChild = mNodes[node.children[1]];
+    node.aabb.mergeTwoAABBs(leftChild.aabb, rightChild.aabb);
+    node.height = std::max(leftChild.height, rightChild.height) + 1;
+}
+
+// Compute the surface area heuristic (SAH) cost of the tree
+/// The cost is the sum of the surface areas of the internal nodes divided by the surface area of
+/// the root. It is proportional to the expected number of internal nodes visited by a query with a
+/// random small AABB and it can be used to monitor the quality of the tree. It is zero if the tree has
+/// no internal node. This method visits all the nodes of the tree.
+decimal DynamicAABBTree::computeSAHCost() const {
+
+    if (mRootNodeID == TreeNode::NULL_TREE_NODE || mNodes[mRootNodeID].isLeaf()) return decimal(0.0);
+
+    decimal totalArea = decimal(0.0);
+    for (int32 nodeID=0; nodeID < mNbAllocatedNodes; nodeID++) {
+        if (mNodes[nodeID].height > 0) {
+            totalArea += computeHalfSurfaceArea(mNodes[nodeID].aabb);
+        }
+    }
+
+    const decimal rootArea = computeHalfSurfaceArea(mNodes[mRootNodeID].aabb);
+
+    return rootArea > decimal(0.0) ? totalArea / rootArea : decimal(0.0);
+}
+
 #ifndef NDEBUG
 
 // Check if the tree structure is valid (for debugging purpose)
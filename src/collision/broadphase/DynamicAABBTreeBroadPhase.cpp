@@ -0,0 +1,133 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/broadphase/DynamicAABBTreeBroadPhase.h>
+#include <reactphysics3d/containers/Stack.h>
+#include <reactphysics3d/mathematics/Ray.h>
+#include <reactphysics3d/utils/Profiler.h>
+
+using namespace reactphysics3d;
+
+// Initialization of static variables
+const uint32 DynamicAABBTreeBroadPhase::STATIC_TREE_REBUILD_RATIO;
+
+// Convert the node IDs of the second objects of the pairs found by a query of a tree into object IDs
+void DynamicAABBTreeBroadPhase::convertToObjectIds(List<Pair<int32, int32>>& pairs, uint32 startIndex, bool isStatic) {
+
+    for (uint32 i=startIndex; i < pairs.size(); i++) {
+        pairs[i].second = computeObjectId(pairs[i].second, isStatic);
+    }
+}
+
+// Prepare the data structure for an overlap query with the objects to test
+/// The overlap query runs once per frame and it is used to maintain the quality of the trees. The
+/// objects are inserted one by one into the trees and the tree of the static objects would otherwise
+/// keep the shape given by the order in which the level has been created.
+void DynamicAABBTreeBroadPhase::beginOverlapQuery(const List<int32>& /*objectsToTest*/) {
+
+    if (mNbStaticTreeChanges > 0 && mNbStaticTreeChanges * STATIC_TREE_REBUILD_RATIO >= mNbStaticObjects) {
+        mStaticAABBTree.rebuild();
+        mNbStaticTreeChanges = 0;
+    }
+
+    mDynamicAABBTree.optimize(DYNAMIC_TREE_NB_OPTIMIZED_NODES_PER_FRAME);
+}
+
+// Rebuild the data structure from all its objects to improve the speed of the queries
+/// Both trees are rebuilt top-down with the surface area heuristic. The IDs of the objects do not change.
+void DynamicAABBTreeBroadPhase::rebuild() {
+
+    mDynamicAABBTree.rebuild();
+    mStaticAABBTree.rebuild();
+    mNbStaticTreeChanges = 0;
+}
+
+// Compute the surface area heuristic (SAH) cost of the data structure
+/// This is the sum of the costs of the tree of the non-static objects and of the tree of the static objects
+/// (see DynamicAABBTree::computeSAHCost()). All the nodes of the trees are visited.
+decimal DynamicAABBTreeBroadPhase::computeSAHCost() const {
+    return mDynamicAABBTree.computeSAHCost() + mStaticAABBTree.computeSAHCost();
+}
+
+// Report the pairs (object to test, other object) of overlapping fat AABBs found by the items [startIndex, endIndex) of the query
+/// A non-static object is tested against both trees and a static object is only tested against
+/// the tree of the non-static objects. The pairs of an object are reported before the pairs of the
+/// next one so that the order of the pairs does not depend on how the items are split into ranges.
+void DynamicAABBTreeBroadPhase::reportOverlappingPairs(const List<int32>& objectsToTest, uint32 startIndex, uint32 endIndex,
+                                                       List<Pair<int32, int32>>& outOverlappingObjects) const {
+
+    // Stack with the nodes to visit in the trees
+    Stack<int32> stack(mAllocator, 64);
+
+    for (uint32 i=startIndex; i < endIndex; i++) {
+
+        const int32 objectId = objectsToTest[i];
+        const AABB& aabb = getFatAABB(objectId);
+
+        uint32 nbPairs = outOverlappingObjects.size();
+        mDynamicAABBTree.reportAllShapesOverlappingWithAABB(aabb, objectId, stack, outOverlappingObjects);
+        convertToObjectIds(outOverlappingObjects, nbPairs, false);
+
+        if (!isStaticObject(objectId)) {
+
+            nbPairs = outOverlappingObjects.size();
+            mStaticAABBTree.reportAllShapesOverlappingWithAABB(aabb, objectId, stack, outOverlappingObjects);
+            convertToObjectIds(outOverlappingObjects, nbPairs, true);
+        }
+    }
+}
+
+// Ray casting method
+/// The ray is clipped in the tree of the static objects by the closest hit found in the tree
+/// of the non-static objects
+void DynamicAABBTreeBroadPhase::raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const {
+
+    TreeRaycastCallback treeCallback(callback, ray.maxFraction);
+
+    mDynamicAABBTree.raycast(ray, treeCallback);
+
+    if (treeCallback.mIsStopped) return;
+
+    treeCallback.mIsStaticTree = true;
+    mStaticAABBTree.raycast(Ray(ray.point1, ray.point2, treeCallback.mMaxFraction), treeCallback);
+}
+
+// Called for a leaf node of the tree that is hit by the ray
+decimal DynamicAABBTreeBroadPhase::TreeRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const Ray& ray) {
+
+    const decimal hitFraction = mCallback.raycastBroadPhaseShape(computeObjectId(nodeId, mIsStaticTree), ray);
+
+    // If the user returned a hitFraction of zero, it means that
+    // the raycasting should stop here
+    if (hitFraction == decimal(0.0)) {
+        mIsStopped = true;
+    }
+    else if (hitFraction > decimal(0.0) && hitFraction < mMaxFraction) {
+        mMaxFraction = hitFraction;
+    }
+
+    return hitFraction;
+}
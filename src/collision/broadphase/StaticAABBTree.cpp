@@ -0,0 +1,572 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/broadphase/StaticAABBTree.h>
+#include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/containers/Stack.h>
+#include <reactphysics3d/containers/Pair.h>
+#include <reactphysics3d/mathematics/mathematics_functions.h>
+#include <reactphysics3d/memory/MemoryAllocator.h>
+#include <reactphysics3d/mathematics/Ray.h>
+#include <reactphysics3d/utils/Profiler.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace reactphysics3d;
+
+// Initialization of static variables
+const uint16 StaticAABBTreeNode::MAX_QUANTIZED_VALUE;
+const int32 StaticAABBTree::NULL_REFERENCE = std::numeric_limits<int32>::min();
+const uint32 StaticAABBTree::NB_BINS;
+const size_t StaticAABBTree::NODES_ALIGNMENT = 64;
+
+// Set the quantized AABB of a child so that it contains a given AABB and return the decoded child AABB
+AABB StaticAABBTreeNode::encodeChildAABB(int child, const AABB& nodeAABB, const AABB& childAABB) {
+
+    const Vector3& nodeMin = nodeAABB.getMin();
+    const Vector3& nodeMax = nodeAABB.getMax();
+    const Vector3 nodeExtent = nodeMax - nodeMin;
+
+    for (int i=0; i < 3; i++) {
+
+        childrenMin[child][i] = 0;
+        childrenMax[child][i] = 0;
+
+        if (nodeExtent[i] > decimal(0.0)) {
+
+            // Quantize the distances to the bounds of the node (rounded down to enlarge the child AABB)
+            const decimal scale = decimal(MAX_QUANTIZED_VALUE) / nodeExtent[i];
+            const decimal minDistance = std::floor((childAABB.getMin()[i] - nodeMin[i]) * scale);
+            const decimal maxDistance = std::floor((nodeMax[i] - childAABB.getMax()[i]) * scale);
+            childrenMin[child][i] = static_cast<uint16>(clamp(minDistance, decimal(0.0), decimal(MAX_QUANTIZED_VALUE)));
+            childrenMax[child][i] = static_cast<uint16>(clamp(maxDistance, decimal(0.0), decimal(MAX_QUANTIZED_VALUE)));
+        }
+    }
+
+    // Because of the rounding errors, the decoded AABB might be a little bit smaller than the child AABB.
+    // In this case, the quantized distances are decreased (a zero distance is decoded exactly)
+    AABB decodedAABB = decodeChildAABB(child, nodeAABB);
+    for (int i=0; i < 3; i++) {
+
+        while (decodedAABB.getMin()[i] > childAABB.getMin()[i] && childrenMin[child][i] > 0) {
+            childrenMin[child][i]--;
+            decodedAABB = decodeChildAABB(child, nodeAABB);
+        }
+        while (decodedAABB.getMax()[i] < childAABB.getMax()[i] && childrenMax[child][i] > 0) {
+            childrenMax[child][i]--;
+            decodedAABB = decodeChildAABB(child, nodeAABB);
+        }
+    }
+
+    assert(decodedAABB.contains(childAABB));
+
+    return decodedAABB;
+}
+
+// Constructor
+StaticAABBTree::StaticAABBTree(MemoryAllocator& allocator)
+               : mAllocator(allocator), mNodesMemory(nullptr), mNodes(nullptr), mNbNodes(0),
+                 mRootReference(NULL_REFERENCE), mRootAABB(Vector3::zero(), Vector3::zero()), mNbObjects(0) {
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+    mProfiler = nullptr;
+
+#endif
+
+}
+
+// Destructor
+StaticAABBTree::~StaticAABBTree() {
+    releaseNodes();
+}
+
+// Release the memory of the nodes
+void StaticAABBTree::releaseNodes() {
+
+    if (mNodesMemory != nullptr) {
+        mAllocator.release(mNodesMemory, mNbNodes * sizeof(StaticAABBTreeNode) + NODES_ALIGNMENT);
+    }
+
+    mNodesMemory = nullptr;
+    mNodes = nullptr;
+    mNbNodes = 0;
+}
+
+// Initialize the tree with the nodes of a tree that has been built before
+/// The nodes are not copied and must remain valid during the life of the tree. This is
+/// used to create a tree from cooked data without building it again.
+void StaticAABBTree::init(const StaticAABBTreeNode* nodes, uint32 nbNodes, int32 rootReference,
+                          const AABB& rootAABB, uint32 nbObjects) {
+
+    assert(nbObjects == 0 || nbNodes == nbObjects - 1);
+    assert(nbNodes == 0 || nodes != nullptr);
+
+    releaseNodes();
+
+    mNodes = nodes;
+    mNbNodes = nbNodes;
+    mRootReference = nbObjects > 0 ? rootReference : NULL_REFERENCE;
+    mRootAABB = rootAABB;
+    mNbObjects = nbObjects;
+}
+
+// Return true if the references of nodes built before are inside the tree
+/// This is used to check nodes loaded from cooked data before they are used by init(). Each
+/// reference must be the index of an internal node or a leaf with an object of the tree. The
+/// child nodes must come after their parent in the array (as in a built tree) so that the
+/// traversal of the tree always terminates.
+/**
+ * @param nodes Array of internal nodes
+ * @param nbNodes Number of internal nodes (the number of objects minus one)
+ * @param rootReference Reference of the root of the tree
+ * @param nbObjects Number of objects in the tree
+ * @return True if all the references are valid
+ */
+bool StaticAABBTree::areNodesValid(const StaticAABBTreeNode* nodes, uint32 nbNodes, int32 rootReference, uint32 nbObjects) {
+
+    if (nbObjects == 0) return nbNodes == 0;
+    if (nbNodes != nbObjects - 1) return false;
+
+    // The root is the first node or the single leaf of the tree
+    if (rootReference != (nbNodes > 0 ? 0 : -1)) return false;
+
+    for (uint32 n=0; n < nbNodes; n++) {
+        for (int c=0; c < 2; c++) {
+
+            const int32 reference = nodes[n].children[c];
+            if (reference >= 0) {
+                if (uint32(reference) <= n || uint32(reference) >= nbNodes) return false;
+            }
+            else if (!isLeaf(reference) || uint32(getLeafObject(reference)) >= nbObjects) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Return the half of the surface area of an AABB
+static inline decimal computeHalfSurfaceArea(const Vector3& aabbMin, const Vector3& aabbMax) {
+    const Vector3 extent = aabbMax - aabbMin;
+    return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
+
+// Build the tree with the AABBs of the objects (object i has the AABB objectsAABBs[i])
+/// The objects are recursively split in two groups using the surface area heuristic (SAH). A binary
+/// tree with one object per leaf has exactly (nbObjects - 1) internal nodes. Therefore, all the nodes
+/// are allocated at once and the two children of a node are always next to each other in the array.
+void StaticAABBTree::build(const List<AABB>& objectsAABBs) {
+
+    RP3D_PROFILE("StaticAABBTree::build()", mProfiler);
+
+    releaseNodes();
+
+    mNbObjects = objectsAABBs.size();
+    mRootReference = NULL_REFERENCE;
+    mRootAABB = AABB(Vector3::zero(), Vector3::zero());
+
+    if (mNbObjects == 0) return;
+
+    mRootAABB = objectsAABBs[0];
+
+    // If there is a single object, the root is a leaf
+    if (mNbObjects == 1) {
+        mRootReference = -1;
+        return;
+    }
+
+    // Allocate the nodes on a cache line boundary
+    mNbNodes = mNbObjects - 1;
+    mNodesMemory = mAllocator.allocate(mNbNodes * sizeof(StaticAABBTreeNode) + NODES_ALIGNMENT);
+    const size_t offset = reinterpret_cast<size_t>(mNodesMemory) % NODES_ALIGNMENT;
+    StaticAABBTreeNode* nodes = reinterpret_cast<StaticAABBTreeNode*>(static_cast<char*>(mNodesMemory) + (offset > 0 ? NODES_ALIGNMENT - offset : 0));
+    mNodes = nodes;
+
+    // The objects are copied with their bounds into an array that is partitioned in place
+    // while the tree is built (which is more cache friendly than an array of indices)
+    List<BuildObject> objects(mAllocator, mNbObjects);
+    objects.addWithoutInit(mNbObjects);
+    Vector3 rootMin = objectsAABBs[0].getMin();
+    Vector3 rootMax = objectsAABBs[0].getMax();
+    for (uint32 i=0; i < mNbObjects; i++) {
+        BuildObject& object = objects[i];
+        object.aabbMin = objectsAABBs[i].getMin();
+        object.aabbMax = objectsAABBs[i].getMax();
+        object.centroid = (object.aabbMin + object.aabbMax) * decimal(0.5);
+        object.object = static_cast<int32>(i);
+        rootMin = Vector3::min(rootMin, object.aabbMin);
+        rootMax = Vector3::max(rootMax, object.aabbMax);
+    }
+    mRootAABB = AABB(rootMin, rootMax);
+
+    // Range of objects to split into the two children of a node
+    struct BuildTask {
+        uint32 startIndex;
+        uint32 endIndex;
+        int32 nodeIndex;
+        AABB nodeAABB;
+    };
+
+    Stack<BuildTask> tasks(mAllocator, 64);
+    tasks.push(BuildTask{0, mNbObjects, 0, mRootAABB});
+    mRootReference = 0;
+    uint32 nbNodes = 1;
+
+    while (tasks.size() > 0) {
+
+        const BuildTask task = tasks.pop();
+
+        AABB childrenAABBs[2];
+        const uint32 splitIndex = splitObjects(objects, task.startIndex, task.endIndex, childrenAABBs);
+        const uint32 childrenRanges[2][2] = {{task.startIndex, splitIndex}, {splitIndex, task.endIndex}};
+
+        StaticAABBTreeNode& node = nodes[task.nodeIndex];
+
+        for (int c=0; c < 2; c++) {
+
+            const uint32 startIndex = childrenRanges[c][0];
+            const uint32 endIndex = childrenRanges[c][1];
+            assert(endIndex > startIndex);
+
+            // If the child contains a single object, it is a leaf
+            if (endIndex - startIndex == 1) {
+                node.children[c] = -objects[startIndex].object - 1;
+                node.encodeChildAABB(c, task.nodeAABB, childrenAABBs[c]);
+            }
+            else {
+
+                node.children[c] = static_cast<int32>(nbNodes);
+                nbNodes++;
+
+                // The children of the child are quantized relative to its decoded AABB
+                const AABB decodedAABB = node.encodeChildAABB(c, task.nodeAABB, childrenAABBs[c]);
+                tasks.push(BuildTask{startIndex, endIndex, node.children[c], decodedAABB});
+            }
+        }
+    }
+
+    assert(nbNodes == mNbNodes);
+}
+
+// Split the objects [startIndex, endIndex) in two groups and return the index of the first object of the second group
+/// The centroids of the objects are put into bins along each axis and the split plane between two bins
+/// with the smallest SAH cost (surface area times number of objects of each side) is selected.
+uint32 StaticAABBTree::splitObjects(List<BuildObject>& objects, uint32 startIndex, uint32 endIndex, AABB* outChildrenAABBs) const {
+
+    assert(endIndex - startIndex >= 2);
+
+    BuildObject* objectsArray = &(objects[0]);
+
+    // Compute the AABB of the centroids
+    Vector3 centroidsMin = objectsArray[startIndex].centroid;
+    Vector3 centroidsMax = centroidsMin;
+    for (uint32 i=startIndex + 1; i < endIndex; i++) {
+        centroidsMin = Vector3::min(centroidsMin, objectsArray[i].centroid);
+        centroidsMax = Vector3::max(centroidsMax, objectsArray[i].centroid);
+    }
+    const Vector3 centroidsExtent = centroidsMax - centroidsMin;
+
+    // The objects are only binned along the axis where the centroids are the most spread out,
+    // which gives trees of almost the same quality as binning along the three axes for a third of the cost
+    const int axis = centroidsExtent.getMaxAxis();
+    const decimal binScale = centroidsExtent[axis] > decimal(0.0) ? decimal(NB_BINS) / centroidsExtent[axis] : decimal(0.0);
+    const decimal centroidsMinAxis = centroidsMin[axis];
+
+    auto computeBin = [&](const BuildObject& object) {
+        return std::min(NB_BINS - 1, static_cast<uint32>((object.centroid[axis] - centroidsMinAxis) * binScale));
+    };
+
+    // Put the objects into the bins
+    Vector3 binsMin[NB_BINS];
+    Vector3 binsMax[NB_BINS];
+    uint32 binsNbObjects[NB_BINS] = {};
+    for (uint32 bin=0; bin < NB_BINS; bin++) {
+        binsMin[bin].setAllValues(DECIMAL_LARGEST, DECIMAL_LARGEST, DECIMAL_LARGEST);
+        binsMax[bin].setAllValues(-DECIMAL_LARGEST, -DECIMAL_LARGEST, -DECIMAL_LARGEST);
+    }
+    if (binScale > decimal(0.0)) {
+        for (uint32 i=startIndex; i < endIndex; i++) {
+
+            const BuildObject& object = objectsArray[i];
+            const uint32 bin = computeBin(object);
+            binsMin[bin] = Vector3::min(binsMin[bin], object.aabbMin);
+            binsMax[bin] = Vector3::max(binsMax[bin], object.aabbMax);
+            binsNbObjects[bin]++;
+        }
+    }
+
+    // Find the split plane with the smallest cost
+    decimal bestCost = DECIMAL_LARGEST;
+    uint32 bestPlane = 0;
+    if (binScale > decimal(0.0)) {
+
+        // Sweep from the right to compute the bounds and the number of objects on the right of
+        // each plane (the plane i is between the bins i-1 and i)
+        Vector3 rightMins[NB_BINS];
+        Vector3 rightMaxs[NB_BINS];
+        uint32 rightNbObjects[NB_BINS];
+        Vector3 rightMin = binsMin[NB_BINS - 1];
+        Vector3 rightMax = binsMax[NB_BINS - 1];
+        uint32 nbObjects = binsNbObjects[NB_BINS - 1];
+        for (uint32 plane=NB_BINS - 1; plane > 0; plane--) {
+            if (plane < NB_BINS - 1) {
+                rightMin = Vector3::min(rightMin, binsMin[plane]);
+                rightMax = Vector3::max(rightMax, binsMax[plane]);
+                nbObjects += binsNbObjects[plane];
+            }
+            rightMins[plane] = rightMin;
+            rightMaxs[plane] = rightMax;
+            rightNbObjects[plane] = nbObjects;
+        }
+
+        // Sweep from the left to compute the cost of each plane
+        Vector3 leftMin = binsMin[0];
+        Vector3 leftMax = binsMax[0];
+        nbObjects = 0;
+        for (uint32 plane=1; plane < NB_BINS; plane++) {
+
+            const uint32 bin = plane - 1;
+            leftMin = Vector3::min(leftMin, binsMin[bin]);
+            leftMax = Vector3::max(leftMax, binsMax[bin]);
+            nbObjects += binsNbObjects[bin];
+
+            if (nbObjects == 0 || rightNbObjects[plane] == 0) continue;
+
+            const decimal cost = computeHalfSurfaceArea(leftMin, leftMax) * nbObjects +
+                                 computeHalfSurfaceArea(rightMins[plane], rightMaxs[plane]) * rightNbObjects[plane];
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestPlane = plane;
+                outChildrenAABBs[0] = AABB(leftMin, leftMax);
+                outChildrenAABBs[1] = AABB(rightMins[plane], rightMaxs[plane]);
+            }
+        }
+    }
+
+    uint32 splitIndex;
+
+    if (bestPlane > 0) {
+
+        // Move the objects on the left of the best plane before the other ones
+        BuildObject* split = std::partition(objectsArray + startIndex, objectsArray + endIndex, [&](const BuildObject& object) {
+            return computeBin(object) < bestPlane;
+        });
+        splitIndex = static_cast<uint32>(split - objectsArray);
+    }
+    else {
+
+        // All the centroids are at the same position and the objects are split in two halves
+        splitIndex = (startIndex + endIndex) / 2;
+
+        const uint32 childrenRanges[2][2] = {{startIndex, splitIndex}, {splitIndex, endIndex}};
+        for (int c=0; c < 2; c++) {
+            Vector3 childMin = objectsArray[childrenRanges[c][0]].aabbMin;
+            Vector3 childMax = objectsArray[childrenRanges[c][0]].aabbMax;
+            for (uint32 i=childrenRanges[c][0] + 1; i < childrenRanges[c][1]; i++) {
+                childMin = Vector3::min(childMin, objectsArray[i].aabbMin);
+                childMax = Vector3::max(childMax, objectsArray[i].aabbMax);
+            }
+            outChildrenAABBs[c] = AABB(childMin, childMax);
+        }
+    }
+
+    assert(splitIndex > startIndex && splitIndex < endIndex);
+
+    return splitIndex;
+}
+
+// Report all the objects whose AABB overlaps with the AABB in parameter
+/// The AABB of an object is the quantized AABB of its leaf which can be slightly larger than the AABB
+/// used to build the tree.
+void StaticAABBTree::reportAllShapesOverlappingWithAABB(const AABB& aabb, List<int32>& overlappingObjects) const {
+
+    RP3D_PROFILE("StaticAABBTree::reportAllShapesOverlappingWithAABB()", mProfiler);
+
+    if (mRootReference == NULL_REFERENCE || !aabb.testCollision(mRootAABB)) return;
+
+    if (isLeaf(mRootReference)) {
+        overlappingObjects.add(getLeafObject(mRootReference));
+        return;
+    }
+
+    // Internal node to visit with its decoded AABB
+    struct StackItem {
+        int32 nodeIndex;
+        AABB nodeAABB;
+    };
+
+    Stack<StackItem> stack(mAllocator, 64);
+    stack.push(StackItem{mRootReference, mRootAABB});
+
+    while (stack.size() > 0) {
+
+        const StackItem item = stack.pop();
+        const StaticAABBTreeNode& node = mNodes[item.nodeIndex];
+
+        for (int c=0; c < 2; c++) {
+
+            const AABB childAABB = node.decodeChildAABB(c, item.nodeAABB);
+            if (!aabb.testCollision(childAABB)) continue;
+
+            if (isLeaf(node.children[c])) {
+                overlappingObjects.add(getLeafObject(node.children[c]));
+            }
+            else {
+                stack.push(StackItem{node.children[c], childAABB});
+            }
+        }
+    }
+}
+
+// Compute the fraction of the ray where it enters an AABB and return false if it does not hit the AABB
+static bool computeRayAABBEntryFraction(const Vector3& rayOrigin, const Vector3& rayDirection, decimal maxFraction,
+                                        const AABB& aabb, decimal& outEntryFraction) {
+
+    decimal entryFraction = decimal(0.0);
+    decimal exitFraction = maxFraction;
+
+    for (int i=0; i < 3; i++) {
+
+        // If the ray is parallel to the slab of the AABB, its origin must be inside the slab
+        if (std::abs(rayDirection[i]) < MACHINE_EPSILON) {
+            if (rayOrigin[i] < aabb.getMin()[i] || rayOrigin[i] > aabb.getMax()[i]) return false;
+        }
+        else {
+
+            const decimal inverseDirection = decimal(1.0) / rayDirection[i];
+            decimal fraction1 = (aabb.getMin()[i] - rayOrigin[i]) * inverseDirection;
+            decimal fraction2 = (aabb.getMax()[i] - rayOrigin[i]) * inverseDirection;
+            if (fraction1 > fraction2) std::swap(fraction1, fraction2);
+
+            entryFraction = std::max(entryFraction, fraction1);
+            exitFraction = std::min(exitFraction, fraction2);
+
+            if (entryFraction > exitFraction) return false;
+        }
+    }
+
+    outEntryFraction = entryFraction;
+    return true;
+}
+
+// Ray casting method
+/// The children of a node are visited from the closest to the farthest along the ray and a node is
+/// skipped if the ray enters it after the current maximum fraction (clipped by the callback).
+void StaticAABBTree::raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const {
+
+    RP3D_PROFILE("StaticAABBTree::raycast()", mProfiler);
+
+    if (mRootReference == NULL_REFERENCE) return;
+
+    const Vector3 rayDirection = ray.point2 - ray.point1;
+    decimal maxFraction = ray.maxFraction;
+
+    decimal entryFraction;
+    if (!computeRayAABBEntryFraction(ray.point1, rayDirection, maxFraction, mRootAABB, entryFraction)) return;
+
+    // Node (or leaf) to visit with its decoded AABB and the fraction where the ray enters it
+    struct StackItem {
+        int32 reference;
+        decimal entryFraction;
+        AABB aabb;
+    };
+
+    Stack<StackItem> stack(mAllocator, 64);
+    stack.push(StackItem{mRootReference, entryFraction, mRootAABB});
+
+    while (stack.size() > 0) {
+
+        const StackItem item = stack.pop();
+
+        // Skip the node if the ray has been clipped before it
+        if (item.entryFraction > maxFraction) continue;
+
+        if (isLeaf(item.reference)) {
+
+            // Call the callback that will raycast again the object
+            decimal hitFraction = callback.raycastBroadPhaseShape(getLeafObject(item.reference),
+                                                                  Ray(ray.point1, ray.point2, maxFraction));
+
+            // If the user returned a hitFraction of zero, it means that
+            // the raycasting should stop here
+            if (hitFraction == decimal(0.0)) {
+                return;
+            }
+
+            // If the user returned a positive fraction, we clip the ray
+            if (hitFraction > decimal(0.0) && hitFraction < maxFraction) {
+                maxFraction = hitFraction;
+            }
+
+            continue;
+        }
+
+        const StaticAABBTreeNode& node = mNodes[item.reference];
+
+        StackItem children[2];
+        bool isChildHit[2];
+        for (int c=0; c < 2; c++) {
+            children[c].reference = node.children[c];
+            children[c].aabb = node.decodeChildAABB(c, item.aabb);
+            isChildHit[c] = computeRayAABBEntryFraction(ray.point1, rayDirection, maxFraction, children[c].aabb,
+                                                        children[c].entryFraction);
+        }
+
+        // Push the farthest child first so that the closest one is visited first
+        const int closestChild = (isChildHit[0] && isChildHit[1] && children[1].entryFraction < children[0].entryFraction) ? 1 : 0;
+        const int farthestChild = 1 - closestChild;
+        if (isChildHit[farthestChild]) stack.push(children[farthestChild]);
+        if (isChildHit[closestChild]) stack.push(children[closestChild]);
+    }
+}
+
+// Return the height of the tree (zero if the root is a leaf)
+int StaticAABBTree::getHeight() const {
+
+    if (mRootReference == NULL_REFERENCE || isLeaf(mRootReference)) return 0;
+
+    // Stack with the internal nodes to visit and their depth
+    Stack<Pair<int32, int>> stack(mAllocator, 64);
+    stack.push(Pair<int32, int>(mRootReference, 1));
+
+    int height = 0;
+    while (stack.size() > 0) {
+
+        const Pair<int32, int> item = stack.pop();
+        height = std::max(height, item.second);
+
+        for (int c=0; c < 2; c++) {
+            if (!isLeaf(mNodes[item.first].children[c])) {
+                stack.push(Pair<int32, int>(mNodes[item.first].children[c], item.second + 1));
+            }
+        }
+    }
+
+    return height;
+}
@@ -0,0 +1,379 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/broadphase/SweepAndPruneBroadPhase.h>
+#include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/mathematics/Ray.h>
+#include <reactphysics3d/utils/Profiler.h>
+#include <algorithm>
+
+using namespace reactphysics3d;
+
+// Initialization of static variables
+const int32 SweepAndPruneProxy::NULL_SORTED_INDEX = -1;
+const int32 SweepAndPruneBroadPhase::REMOVED_OBJECT = -1;
+
+// Constructor
+SweepAndPruneBroadPhase::SweepAndPruneBroadPhase(MemoryAllocator& allocator, decimal fatAABBInflatePercentage)
+                        : mAllocator(allocator), mProxies(allocator), mFreeProxies(allocator), mSortedObjects(allocator),
+                          mNbSortedObjects(0), mSortedMins(allocator), mMaxMinDecrease(0), mMaxSortedMinToMax(0),
+                          mSweepAxis(0), mFatAABBInflatePercentage(fatAABBInflatePercentage) {
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+    mProfiler = nullptr;
+
+#endif
+
+}
+
+// Add an object and return its ID
+int32 SweepAndPruneBroadPhase::addObject(const AABB& aabb, void* data, bool isStatic) {
+
+    // Get a free proxy
+    int32 objectId;
+    if (mFreeProxies.size() > 0) {
+        objectId = mFreeProxies[mFreeProxies.size() - 1];
+        mFreeProxies.removeAt(mFreeProxies.size() - 1);
+    }
+    else {
+        objectId = static_cast<int32>(mProxies.size());
+        mProxies.add(SweepAndPruneProxy());
+    }
+
+    SweepAndPruneProxy& proxy = mProxies[objectId];
+    proxy.data = data;
+    proxy.isToTest = false;
+    proxy.isStatic = isStatic;
+    computeFatAABB(aabb, Vector3::zero(), mFatAABBInflatePercentage, proxy.aabb);
+
+    // The new object is added at the end of the sorted array and will be sorted at the next query
+    proxy.sortedIndex = static_cast<int32>(mSortedObjects.size());
+    mSortedObjects.add(objectId);
+
+    return objectId;
+}
+
+// Remove an object
+void SweepAndPruneBroadPhase::removeObject(int32 objectId) {
+
+    assert(objectId >= 0 && objectId < static_cast<int32>(mProxies.size()));
+
+    SweepAndPruneProxy& proxy = mProxies[objectId];
+    assert(proxy.sortedIndex != SweepAndPruneProxy::NULL_SORTED_INDEX);
+    assert(mSortedObjects[proxy.sortedIndex] == objectId);
+
+    // The removed object will be removed from the sorted array at the next query
+    mSortedObjects[proxy.sortedIndex] = REMOVED_OBJECT;
+
+    proxy.sortedIndex = SweepAndPruneProxy::NULL_SORTED_INDEX;
+    proxy.data = nullptr;
+    mFreeProxies.add(objectId);
+}
+
+// Update an object after it has moved and return true if its fat AABB has changed
+bool SweepAndPruneBroadPhase::updateObject(int32 objectId, const AABB& newAABB, bool forceReinsert, const Vector3& displacement) {
+
+    assert(objectId >= 0 && objectId < static_cast<int32>(mProxies.size()));
+    assert(mProxies[objectId].sortedIndex != SweepAndPruneProxy::NULL_SORTED_INDEX);
+
+    SweepAndPruneProxy& proxy = mProxies[objectId];
+
+    // If the new AABB is still inside the fat AABB of the object
+    if (!forceReinsert && isFatAABBStillValid(proxy.aabb, newAABB, displacement, mFatAABBInflatePercentage)) {
+        return false;
+    }
+
+    // The position of the object in the sorted array will be updated at the next query
+    computeFatAABB(newAABB, displacement, mFatAABBInflatePercentage, proxy.aabb);
+
+    // Update the bounds used by the raycast to find the sorted objects that can be hit by a ray
+    if (static_cast<uint32>(proxy.sortedIndex) < mNbSortedObjects) {
+        const decimal sortedMin = mSortedMins[proxy.sortedIndex];
+        mMaxMinDecrease = std::max(mMaxMinDecrease, sortedMin - proxy.aabb.getMin()[mSweepAxis]);
+        mMaxSortedMinToMax = std::max(mMaxSortedMinToMax, proxy.aabb.getMax()[mSweepAxis] - sortedMin);
+    }
+
+    return true;
+}
+
+// Return the axis along which the AABB centers are the most spread out
+int SweepAndPruneBroadPhase::computeSweepAxis() const {
+
+    Vector3 sum(0, 0, 0);
+    Vector3 sumSquares(0, 0, 0);
+    uint32 nbObjects = 0;
+
+    for (uint32 i=0; i < mSortedObjects.size(); i++) {
+
+        if (mSortedObjects[i] == REMOVED_OBJECT) continue;
+
+        const Vector3 center = mProxies[mSortedObjects[i]].aabb.getCenter();
+        sum += center;
+        sumSquares += center * center;
+        nbObjects++;
+    }
+
+    if (nbObjects == 0) return mSweepAxis;
+
+    // Compute the variance of the AABB centers along each axis
+    const Vector3 mean = sum / decimal(nbObjects);
+    const Vector3 variance = sumSquares / decimal(nbObjects) - mean * mean;
+
+    // We only change the axis if the new one is clearly better because a new axis
+    // requires to sort all the objects again
+    const int maxAxis = variance.getMaxAxis();
+    return variance[maxAxis] > decimal(1.2) * variance[mSweepAxis] ? maxAxis : mSweepAxis;
+}
+
+// Remove the removed objects from the sorted array and sort it again along the sweep axis
+void SweepAndPruneBroadPhase::sortObjects() {
+
+    RP3D_PROFILE("SweepAndPruneBroadPhase::sortObjects()", mProfiler);
+
+    // Remove the objects that have been removed since the last query
+    uint32 nbObjects = 0;
+    uint32 nbSortedObjects = 0;
+    for (uint32 i=0; i < mSortedObjects.size(); i++) {
+
+        if (mSortedObjects[i] == REMOVED_OBJECT) continue;
+
+        mSortedObjects[nbObjects] = mSortedObjects[i];
+        nbObjects++;
+
+        if (i < mNbSortedObjects) nbSortedObjects++;
+    }
+    while (mSortedObjects.size() > nbObjects) {
+        mSortedObjects.removeAt(mSortedObjects.size() - 1);
+    }
+
+    auto isBeforeFunction = [this](int32 objectId1, int32 objectId2) {
+        return isBefore(objectId1, objectId2);
+    };
+
+    int32* objects = nbObjects > 0 ? &(mSortedObjects[0]) : nullptr;
+
+    const int sweepAxis = computeSweepAxis();
+    if (sweepAxis != mSweepAxis) {
+
+        // Sort all the objects along the new axis
+        mSweepAxis = sweepAxis;
+        std::sort(objects, objects + nbObjects, isBeforeFunction);
+    }
+    else {
+
+        // The objects sorted at the last query have usually moved a little bit and their
+        // order is almost correct. An insertion sort is therefore used for them.
+        for (uint32 i=1; i < nbSortedObjects; i++) {
+
+            const int32 objectId = objects[i];
+            uint32 j = i;
+            while (j > 0 && isBefore(objectId, objects[j - 1])) {
+                objects[j] = objects[j - 1];
+                j--;
+            }
+            objects[j] = objectId;
+        }
+
+        // The new objects are sorted and merged with the other ones
+        std::sort(objects + nbSortedObjects, objects + nbObjects, isBeforeFunction);
+        std::inplace_merge(objects, objects + nbSortedObjects, objects + nbObjects, isBeforeFunction);
+    }
+
+    // Update the index and the minimum coordinate of each object in the sorted array
+    mSortedMins.clear();
+    mMaxMinDecrease = decimal(0.0);
+    mMaxSortedMinToMax = decimal(0.0);
+    for (uint32 i=0; i < nbObjects; i++) {
+
+        SweepAndPruneProxy& proxy = mProxies[objects[i]];
+        proxy.sortedIndex = static_cast<int32>(i);
+        mSortedMins.add(proxy.aabb.getMin()[mSweepAxis]);
+        mMaxSortedMinToMax = std::max(mMaxSortedMinToMax, proxy.aabb.getMax()[mSweepAxis] - proxy.aabb.getMin()[mSweepAxis]);
+    }
+
+    mNbSortedObjects = nbObjects;
+}
+
+// Rebuild the data structure from all its objects to improve the speed of the queries
+/// The removed objects are removed from the sorted array and the objects are sorted again
+/// (along a new sweep axis if the objects are now more spread out along another axis).
+void SweepAndPruneBroadPhase::rebuild() {
+    sortObjects();
+}
+
+// Compute the surface area heuristic (SAH) cost of the data structure
+/// The sweep-and-prune is not a hierarchy of bounding volumes and its cost is always zero.
+decimal SweepAndPruneBroadPhase::computeSAHCost() const {
+    return decimal(0.0);
+}
+
+// Prepare the data structure for an overlap query with the objects to test
+/// The objects are sorted along the sweep axis and the objects to test are marked
+void SweepAndPruneBroadPhase::beginOverlapQuery(const List<int32>& objectsToTest) {
+
+    RP3D_PROFILE("SweepAndPruneBroadPhase::beginOverlapQuery()", mProfiler);
+
+    if (objectsToTest.size() == 0) return;
+
+    sortObjects();
+
+    for (uint32 i=0; i < objectsToTest.size(); i++) {
+        assert(mProxies[objectsToTest[i]].sortedIndex != SweepAndPruneProxy::NULL_SORTED_INDEX);
+        mProxies[objectsToTest[i]].isToTest = true;
+    }
+}
+
+// Report the pairs (object to test, other object) of overlapping fat AABBs found by the items [startIndex, endIndex) of the query
+/// Each sorted object of the range is compared with the following sorted objects. All the pairs with
+/// at least one object to test are found this way and a pair is only reported once. A pair of two
+/// objects to test is reported with the smallest ID first. The pairs of two static objects are skipped.
+void SweepAndPruneBroadPhase::reportOverlappingPairs(const List<int32>& /*objectsToTest*/, uint32 startIndex, uint32 endIndex,
+                                                     List<Pair<int32, int32>>& outOverlappingObjects) const {
+
+    RP3D_PROFILE("SweepAndPruneBroadPhase::reportOverlappingPairs()", mProfiler);
+
+    assert(endIndex <= mSortedObjects.size());
+
+    const uint32 nbObjects = mSortedObjects.size();
+    for (uint32 i=startIndex; i < endIndex; i++) {
+
+        const int32 objectId1 = mSortedObjects[i];
+        const SweepAndPruneProxy& proxy1 = mProxies[objectId1];
+        const decimal max1 = proxy1.aabb.getMax()[mSweepAxis];
+
+        // Compare the object with the next objects that start before its end along the sweep axis
+        for (uint32 j=i+1; j < nbObjects; j++) {
+
+            const int32 objectId2 = mSortedObjects[j];
+            const SweepAndPruneProxy& proxy2 = mProxies[objectId2];
+
+            if (proxy2.aabb.getMin()[mSweepAxis] > max1) break;
+
+            if ((proxy1.isToTest || proxy2.isToTest) && !(proxy1.isStatic && proxy2.isStatic) &&
+                proxy1.aabb.testCollision(proxy2.aabb)) {
+
+                if (proxy1.isToTest && (!proxy2.isToTest || objectId1 < objectId2)) {
+                    outOverlappingObjects.add(Pair<int32, int32>(objectId1, objectId2));
+                }
+                else {
+                    outOverlappingObjects.add(Pair<int32, int32>(objectId2, objectId1));
+                }
+            }
+        }
+    }
+}
+
+// Finish an overlap query with the objects to test
+void SweepAndPruneBroadPhase::endOverlapQuery(const List<int32>& objectsToTest) {
+
+    for (uint32 i=0; i < objectsToTest.size(); i++) {
+        mProxies[objectsToTest[i]].isToTest = false;
+    }
+}
+
+// Raycast against an object and return false if the raycast has to stop
+bool SweepAndPruneBroadPhase::raycastObject(int32 objectId, const Ray& ray, decimal& maxFraction,
+                                            DynamicAABBTreeRaycastCallback& callback) const {
+
+    if (objectId == REMOVED_OBJECT) return true;
+
+    Ray rayTemp(ray.point1, ray.point2, maxFraction);
+
+    // Test if the ray intersects with the AABB of the object
+    if (!mProxies[objectId].aabb.testRayIntersect(rayTemp)) return true;
+
+    // Call the callback that will raycast again the broad-phase shape
+    decimal hitFraction = callback.raycastBroadPhaseShape(objectId, rayTemp);
+
+    // If the user returned a hitFraction of zero, it means that
+    // the raycasting should stop here
+    if (hitFraction == decimal(0.0)) {
+        return false;
+    }
+
+    // If the user returned a positive fraction, we clip the ray
+    if (hitFraction > decimal(0.0) && hitFraction < maxFraction) {
+        maxFraction = hitFraction;
+    }
+
+    return true;
+}
+
+// Ray casting method
+/// The objects sorted during the last query might have moved since then. However, the minimum
+/// coordinate of an object along the sweep axis cannot be smaller than its sorted minimum minus
+/// mMaxMinDecrease and its maximum coordinate cannot be larger than its sorted minimum plus
+/// mMaxSortedMinToMax. A binary search in the sorted minimums therefore gives the range of sorted
+/// objects that can overlap the segment of the ray along the sweep axis. This range is visited in
+/// the direction of the ray so that it can be cut when the ray is clipped. The objects added since
+/// the last query are not sorted yet and are all tested.
+void SweepAndPruneBroadPhase::raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const {
+
+    RP3D_PROFILE("SweepAndPruneBroadPhase::raycast()", mProfiler);
+
+    decimal maxFraction = ray.maxFraction;
+
+    // Test the objects that have been added since the last query
+    for (uint32 i=mNbSortedObjects; i < mSortedObjects.size(); i++) {
+        if (!raycastObject(mSortedObjects[i], ray, maxFraction, callback)) return;
+    }
+
+    if (mNbSortedObjects == 0) return;
+
+    // Range of the segment of the ray along the sweep axis
+    const decimal rayStart = ray.point1[mSweepAxis];
+    const decimal rayDelta = ray.point2[mSweepAxis] - rayStart;
+    const decimal rayEnd = rayStart + maxFraction * rayDelta;
+
+    // Find the sorted objects that can overlap the segment along the sweep axis
+    const decimal* sortedMins = &(mSortedMins[0]);
+    const uint32 startIndex = static_cast<uint32>(std::lower_bound(sortedMins, sortedMins + mNbSortedObjects,
+                                                  std::min(rayStart, rayEnd) - mMaxSortedMinToMax) - sortedMins);
+    const uint32 endIndex = static_cast<uint32>(std::upper_bound(sortedMins, sortedMins + mNbSortedObjects,
+                                                std::max(rayStart, rayEnd) + mMaxMinDecrease) - sortedMins);
+
+    if (rayDelta >= decimal(0.0)) {
+
+        for (uint32 i=startIndex; i < endIndex; i++) {
+
+            // The next objects start after the end of the clipped ray
+            if (sortedMins[i] - mMaxMinDecrease > rayStart + maxFraction * rayDelta) return;
+
+            if (!raycastObject(mSortedObjects[i], ray, maxFraction, callback)) return;
+        }
+    }
+    else {
+
+        for (uint32 i=endIndex; i > startIndex; i--) {
+
+            // The previous objects end before the end of the clipped ray
+            if (sortedMins[i - 1] + mMaxSortedMinToMax < rayStart + maxFraction * rayDelta) return;
+
+            if (!raycastObject(mSortedObjects[i - 1], ray, maxFraction, callback)) return;
+        }
+    }
+}
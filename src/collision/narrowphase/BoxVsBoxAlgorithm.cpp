@@ -0,0 +1,434 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/BoxVsBoxAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/BoxVsBoxNarrowPhaseInfoBatch.h>
+#include <reactphysics3d/engine/OverlappingPairs.h>
+#include <reactphysics3d/mathematics/mathematics_functions.h>
+#include <reactphysics3d/utils/Profiler.h>
+#include <cassert>
+
+// We want to use the ReactPhysics3D namespace
+using namespace reactphysics3d;
+
+// Static variables initialization
+const decimal BoxVsBoxAlgorithm::SEPARATING_AXIS_RELATIVE_TOLERANCE = decimal(1.002);
+const decimal BoxVsBoxAlgorithm::SEPARATING_AXIS_ABSOLUTE_TOLERANCE = decimal(0.0005);
+
+// Compute the narrow-phase collision detection between two boxes
+/// The candidate separating axes are indexed as follows: 0 to 2 are the face normals of the
+/// first box, 3 to 5 are the face normals of the second box and 6 to 14 are the cross products
+/// of the edge direction (index - 6) / 3 of the first box with the edge direction (index - 6) % 3
+/// of the second box. All the computations are done in the local-space of the first box.
+bool BoxVsBoxAlgorithm::testCollision(BoxVsBoxNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchStartIndex, uint batchNbItems,
+                                      bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& /*memoryAllocator*/) {
+
+    RP3D_PROFILE("BoxVsBoxAlgorithm::testCollision()", mProfiler);
+
+    bool isCollisionFound = false;
+
+    for (uint batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
+
+        assert(narrowPhaseInfoBatch.contactPoints[batchIndex].size() == 0);
+
+        const Vector3& halfExtents1 = narrowPhaseInfoBatch.box1HalfExtents[batchIndex];
+        const Vector3& halfExtents2 = narrowPhaseInfoBatch.box2HalfExtents[batchIndex];
+
+        // Transforms between the local-spaces of the two boxes
+        const Transform box2ToBox1 = narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex].getInverse() * narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex];
+        const Transform box1ToBox2 = box2ToBox1.getInverse();
+
+        // The columns of this matrix are the axes of the second box in the local-space of the first box
+        const Matrix3x3 box2Rotation = box2ToBox1.getOrientation().getMatrix();
+        const Matrix3x3 box2AbsoluteRotation = box2Rotation.getAbsoluteMatrix();
+        const Vector3& box2Position = box2ToBox1.getPosition();
+
+        // Get the last frame collision info
+        LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.lastFrameCollisionInfos[batchIndex];
+
+        lastFrameCollisionInfo->wasUsingSAT = false;
+        lastFrameCollisionInfo->wasUsingGJK = false;
+
+        Vector3 axis;
+
+        // If the last frame collision info is valid
+        if (lastFrameCollisionInfo->isValid) {
+
+            // We perform temporal coherence, we check if there is still an overlapping along the previous minimum separating
+            // axis. If the shapes are still separated along this axis, we directly exit with no collision. If the previous axis
+            // was a face normal and the shapes are still overlapping along it, we directly clip the faces along this axis.
+
+            const uint8 previousAxisIndex = lastFrameCollisionInfo->boxVsBoxAxisIndex;
+            decimal penetrationDepth = computePenetrationDepth(previousAxisIndex, halfExtents1, halfExtents2, box2Rotation,
+                                                               box2AbsoluteRotation, box2Position, axis);
+
+            // If the previous axis was a separating axis and is still a separating axis in this frame
+            if (!lastFrameCollisionInfo->wasColliding && penetrationDepth <= decimal(0.0)) {
+
+                // Return no collision without testing the other axes
+                continue;
+            }
+
+            // The two shapes were overlapping in the previous frame and still seem to overlap in this one
+            if (lastFrameCollisionInfo->wasColliding && clipWithPreviousAxisIfStillColliding && previousAxisIndex < 6 &&
+                penetrationDepth > decimal(0.0)) {
+
+                if (computeFaceContactPoints(previousAxisIndex, halfExtents1, halfExtents2, box2ToBox1, box1ToBox2,
+                                             narrowPhaseInfoBatch, batchIndex)) {
+
+                    // The shapes are still overlapping in the previous axis (the contact manifold is not empty).
+                    // Therefore, we can return without testing the other axes
+                    narrowPhaseInfoBatch.isColliding[batchIndex] = true;
+                    isCollisionFound = true;
+                    continue;
+                }
+
+                // The contact manifold is empty. Therefore, we have to test all the axes again
+            }
+        }
+
+        bool isSeparatingAxisFound = false;
+
+        // Test the face normals of the first box and then the face normals of the second box
+        decimal minFacePenetrationDepths[2] = {DECIMAL_LARGEST, DECIMAL_LARGEST};
+        uint8 minFaceAxisIndices[2] = {0, 3};
+        for (uint8 axisIndex = 0; axisIndex < 6; axisIndex++) {
+
+            const decimal penetrationDepth = computePenetrationDepth(axisIndex, halfExtents1, halfExtents2, box2Rotation,
+                                                                     box2AbsoluteRotation, box2Position, axis);
+            if (penetrationDepth <= decimal(0.0)) {
+
+                lastFrameCollisionInfo->boxVsBoxAxisIndex = axisIndex;
+
+                // We have found a separating axis
+                isSeparatingAxisFound = true;
+                break;
+            }
+
+            const uint8 boxIndex = axisIndex / 3;
+            if (penetrationDepth < minFacePenetrationDepths[boxIndex]) {
+                minFacePenetrationDepths[boxIndex] = penetrationDepth;
+                minFaceAxisIndices[boxIndex] = axisIndex;
+            }
+        }
+
+        if (isSeparatingAxisFound) {
+            continue;
+        }
+
+        // As in the SAT algorithm, we use a relative and absolute bias so that we keep using the face of the
+        // first box when the two penetration depths are almost the same. This prevents the contact manifold of
+        // a resting contact from switching between the two reference faces
+        decimal minPenetrationDepth = std::min(minFacePenetrationDepths[0], minFacePenetrationDepths[1]);
+        uint8 minAxisIndex = minFacePenetrationDepths[0] < minFacePenetrationDepths[1] * SEPARATING_AXIS_RELATIVE_TOLERANCE +
+                                                           SEPARATING_AXIS_ABSOLUTE_TOLERANCE ? minFaceAxisIndices[0] : minFaceAxisIndices[1];
+        Vector3 minAxis;
+
+        // Test the cross products of the edges directions of the two boxes
+        for (uint8 axisIndex = 6; axisIndex < NB_SEPARATING_AXES; axisIndex++) {
+
+            const decimal penetrationDepth = computePenetrationDepth(axisIndex, halfExtents1, halfExtents2, box2Rotation,
+                                                                     box2AbsoluteRotation, box2Position, axis);
+            if (penetrationDepth <= decimal(0.0)) {
+
+                lastFrameCollisionInfo->boxVsBoxAxisIndex = axisIndex;
+
+                // We have found a separating axis
+                isSeparatingAxisFound = true;
+                break;
+            }
+
+            // We favor the face contacts (more stable with more contact points) over the edge contacts. Therefore, an
+            // edge-edge axis only replaces a face axis if its penetration depth is significantly smaller
+            const bool isMinAxisFaceNormal = minAxisIndex < 6;
+            if ((isMinAxisFaceNormal && penetrationDepth * SEPARATING_AXIS_RELATIVE_TOLERANCE + SEPARATING_AXIS_ABSOLUTE_TOLERANCE < minPenetrationDepth) ||
+                (!isMinAxisFaceNormal && penetrationDepth < minPenetrationDepth)) {
+
+                minPenetrationDepth = penetrationDepth;
+                minAxisIndex = axisIndex;
+                minAxis = axis;
+            }
+        }
+
+        if (isSeparatingAxisFound) {
+            continue;
+        }
+
+        // Here we know the shapes are overlapping on a given minimum separating axis.
+        // Now, we will clip the shapes along this axis to find the contact points
+
+        assert(minPenetrationDepth > decimal(0.0));
+
+        lastFrameCollisionInfo->boxVsBoxAxisIndex = minAxisIndex;
+
+        // If the minimum separating axis is a face normal
+        if (minAxisIndex < 6) {
+
+            // There should be clipping points here. If it is not the case, it might be
+            // because of a numerical issue
+            if (!computeFaceContactPoints(minAxisIndex, halfExtents1, halfExtents2, box2ToBox1, box1ToBox2,
+                                          narrowPhaseInfoBatch, batchIndex)) {
+
+                // Return no collision
+                continue;
+            }
+        }
+        else if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {    // If we have an edge vs edge contact to report
+
+            computeEdgeContactPoint(minAxisIndex, minPenetrationDepth, minAxis, halfExtents1, halfExtents2,
+                                    box2ToBox1, box1ToBox2, narrowPhaseInfoBatch, batchIndex);
+        }
+
+        narrowPhaseInfoBatch.isColliding[batchIndex] = true;
+        isCollisionFound = true;
+    }
+
+    return isCollisionFound;
+}
+
+// Compute the penetration depth of the two boxes along a candidate separating axis
+/// The penetration depth is negative or zero if the axis is a separating axis. The axis (in the local-space
+/// of the first box) is oriented from the first box toward the second box. If the axis is the cross product
+/// of two parallel edges, it is not a valid candidate and the method returns DECIMAL_LARGEST.
+decimal BoxVsBoxAlgorithm::computePenetrationDepth(uint8 axisIndex, const Vector3& halfExtents1, const Vector3& halfExtents2,
+                                                   const Matrix3x3& box2Rotation, const Matrix3x3& box2AbsoluteRotation,
+                                                   const Vector3& box2Position, Vector3& outAxis) const {
+
+    assert(axisIndex < NB_SEPARATING_AXES);
+
+    // Face normal of the first box
+    if (axisIndex < 3) {
+
+        const decimal distance = box2Position[axisIndex];
+        outAxis.setToZero();
+        outAxis[axisIndex] = distance < decimal(0.0) ? decimal(-1.0) : decimal(1.0);
+
+        return halfExtents1[axisIndex] + halfExtents2.dot(box2AbsoluteRotation[axisIndex]) - std::abs(distance);
+    }
+
+    // Face normal of the second box
+    if (axisIndex < 6) {
+
+        const Vector3 box2Axis = box2Rotation.getColumn(axisIndex - 3);
+        const decimal distance = box2Position.dot(box2Axis);
+        outAxis = distance < decimal(0.0) ? -box2Axis : box2Axis;
+
+        return halfExtents1.dot(box2AbsoluteRotation.getColumn(axisIndex - 3)) + halfExtents2[axisIndex - 3] - std::abs(distance);
+    }
+
+    // Cross product of an edge direction of the first box with an edge direction of the second box
+    Vector3 box1EdgeDirection(0, 0, 0);
+    box1EdgeDirection[(axisIndex - 6) / 3] = decimal(1.0);
+    const Vector3 crossProduct = box1EdgeDirection.cross(box2Rotation.getColumn((axisIndex - 6) % 3));
+
+    // If the two edges are parallel, the cross product is not a valid separating axis
+    const decimal crossProductLengthSquare = crossProduct.lengthSquare();
+    if (crossProductLengthSquare < decimal(0.00001)) {
+        return DECIMAL_LARGEST;
+    }
+
+    // Compute the radiuses of the projections of the two boxes onto the axis
+    const decimal box1Radius = halfExtents1.dot(crossProduct.getAbsoluteVector());
+    const decimal box2Radius = halfExtents2.dot((box2Rotation.getTranspose() * crossProduct).getAbsoluteVector());
+
+    const decimal distance = box2Position.dot(crossProduct);
+    const decimal crossProductLength = std::sqrt(crossProductLengthSquare);
+    outAxis = (distance < decimal(0.0) ? -crossProduct : crossProduct) / crossProductLength;
+
+    return (box1Radius + box2Radius - std::abs(distance)) / crossProductLength;
+}
+
+// Compute the contact points between a reference face of a box and the incident face of the other box
+/// The reference face is the face of the first box if the axis index is between 0 and 2 and the face of the
+/// second box if it is between 3 and 5. The incident face (most anti-parallel face of the other box) is clipped
+/// against the four side planes of the reference face and we keep the clipped points that are below the
+/// reference face. The method returns true if contact points have been found.
+bool BoxVsBoxAlgorithm::computeFaceContactPoints(uint8 axisIndex, const Vector3& halfExtents1, const Vector3& halfExtents2,
+                                                 const Transform& box2ToBox1, const Transform& box1ToBox2,
+                                                 BoxVsBoxNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchIndex) const {
+
+    RP3D_PROFILE("BoxVsBoxAlgorithm::computeFaceContactPoints", mProfiler);
+
+    assert(axisIndex < 6);
+
+    const bool isReferenceBox1 = axisIndex < 3;
+    const int referenceAxis = axisIndex % 3;
+    const Vector3& referenceHalfExtents = isReferenceBox1 ? halfExtents1 : halfExtents2;
+    const Vector3& incidentHalfExtents = isReferenceBox1 ? halfExtents2 : halfExtents1;
+    const Transform& incidentToReferenceTransform = isReferenceBox1 ? box2ToBox1 : box1ToBox2;
+    const Transform& referenceToIncidentTransform = isReferenceBox1 ? box1ToBox2 : box2ToBox1;
+
+    // Compute the reference face normal (pointing toward the incident box) in the reference local-space
+    const decimal referenceFaceSign = incidentToReferenceTransform.getPosition()[referenceAxis] < decimal(0.0) ? decimal(-1.0) : decimal(1.0);
+    Vector3 axisReferenceSpace(0, 0, 0);
+    axisReferenceSpace[referenceAxis] = referenceFaceSign;
+
+    // Compute the world normal
+    const Vector3 normalWorld = isReferenceBox1 ? narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex].getOrientation() * axisReferenceSpace :
+                                                  -(narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getOrientation() * axisReferenceSpace);
+
+    // Find the incident face on the other box (most anti-parallel face)
+    const Vector3 axisIncidentSpace = referenceToIncidentTransform.getOrientation() * axisReferenceSpace;
+    const int incidentAxis = axisIncidentSpace.getAbsoluteVector().getMaxAxis();
+    const decimal incidentFaceSign = axisIncidentSpace[incidentAxis] > decimal(0.0) ? decimal(-1.0) : decimal(1.0);
+    const int incidentAxisU = (incidentAxis + 1) % 3;
+    const int incidentAxisV = (incidentAxis + 2) % 3;
+
+    // Get the four vertices of the incident face (in the reference local-space). The clipping of a
+    // quadrilateral against four planes cannot produce more than eight vertices.
+    Vector3 clipPolygons[2][8];
+    uint nbPolygonVertices = 4;
+    const decimal verticesSignsU[4] = {decimal(1.0), decimal(-1.0), decimal(-1.0), decimal(1.0)};
+    const decimal verticesSignsV[4] = {decimal(1.0), decimal(1.0), decimal(-1.0), decimal(-1.0)};
+    for (uint i=0; i < 4; i++) {
+        Vector3 faceVertexIncidentSpace;
+        faceVertexIncidentSpace[incidentAxis] = incidentFaceSign * incidentHalfExtents[incidentAxis];
+        faceVertexIncidentSpace[incidentAxisU] = verticesSignsU[i] * incidentHalfExtents[incidentAxisU];
+        faceVertexIncidentSpace[incidentAxisV] = verticesSignsV[i] * incidentHalfExtents[incidentAxisV];
+        clipPolygons[0][i] = incidentToReferenceTransform * faceVertexIncidentSpace;
+    }
+
+    // Clip the incident face with the four side planes of the reference face (Sutherland-Hodgman algorithm)
+    uint inputPolygonIndex = 0;
+    for (uint p=0; p < 4 && nbPolygonVertices > 0; p++) {
+
+        const int planeAxis = (referenceAxis + 1 + p / 2) % 3;
+        const decimal planeSign = (p % 2 == 0) ? decimal(1.0) : decimal(-1.0);
+        const decimal planeOffset = referenceHalfExtents[planeAxis];
+
+        const Vector3* inputVertices = clipPolygons[inputPolygonIndex];
+        Vector3* outputVertices = clipPolygons[1 - inputPolygonIndex];
+        uint nbOutputVertices = 0;
+
+        Vector3 previousVertex = inputVertices[nbPolygonVertices - 1];
+        decimal previousDistance = planeSign * previousVertex[planeAxis] - planeOffset;
+        for (uint i=0; i < nbPolygonVertices; i++) {
+
+            const Vector3& vertex = inputVertices[i];
+            const decimal distance = planeSign * vertex[planeAxis] - planeOffset;
+
+            // If the segment crosses the clipping plane, we add the intersection point
+            if ((distance <= decimal(0.0)) != (previousDistance <= decimal(0.0))) {
+                const decimal t = previousDistance / (previousDistance - distance);
+                outputVertices[nbOutputVertices++] = previousVertex + t * (vertex - previousVertex);
+            }
+
+            // If the vertex is inside the clipping plane
+            if (distance <= decimal(0.0)) {
+                outputVertices[nbOutputVertices++] = vertex;
+            }
+
+            previousVertex = vertex;
+            previousDistance = distance;
+        }
+
+        assert(nbOutputVertices <= 8);
+
+        nbPolygonVertices = nbOutputVertices;
+        inputPolygonIndex = 1 - inputPolygonIndex;
+    }
+
+    // We only keep the clipped points that are below the reference face
+    const decimal referenceFaceOffset = referenceFaceSign * referenceHalfExtents[referenceAxis];
+    bool contactPointsFound = false;
+    for (uint i=0; i < nbPolygonVertices; i++) {
+
+        const Vector3& clipPolygonVertex = clipPolygons[inputPolygonIndex][i];
+
+        // Compute the penetration depth of this contact point (can be different from the minPenetration depth which is
+        // the maximal penetration depth of any contact point for this separating axis
+        const decimal penetrationDepth = referenceFaceSign * (referenceFaceOffset - clipPolygonVertex[referenceAxis]);
+
+        // If the clip point is below the reference face
+        if (penetrationDepth > decimal(0.0)) {
+
+            contactPointsFound = true;
+
+            // If we need to report contacts
+            if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
+
+                // Convert the clip incident box vertex into the incident box local-space
+                const Vector3 contactPointIncidentBox = referenceToIncidentTransform * clipPolygonVertex;
+
+                // Project the contact point onto the reference face
+                Vector3 contactPointReferenceBox = clipPolygonVertex;
+                contactPointReferenceBox[referenceAxis] = referenceFaceOffset;
+
+                // Create a new contact point
+                narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth,
+                                                     isReferenceBox1 ? contactPointReferenceBox : contactPointIncidentBox,
+                                                     isReferenceBox1 ? contactPointIncidentBox : contactPointReferenceBox);
+            }
+        }
+    }
+
+    return contactPointsFound;
+}
+
+// Compute the contact point between an edge of the first box and an edge of the second box
+/// We take the edge of each box that is the furthest along the separating axis in the direction of
+/// the other box and the contact point is given by the closest points between those two edges.
+void BoxVsBoxAlgorithm::computeEdgeContactPoint(uint8 axisIndex, decimal penetrationDepth, const Vector3& axis,
+                                                const Vector3& halfExtents1, const Vector3& halfExtents2,
+                                                const Transform& box2ToBox1, const Transform& box1ToBox2,
+                                                BoxVsBoxNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchIndex) const {
+
+    assert(axisIndex >= 6 && axisIndex < NB_SEPARATING_AXES);
+
+    const int edge1Axis = (axisIndex - 6) / 3;
+    const int edge2Axis = (axisIndex - 6) % 3;
+
+    // Compute the edge of the first box in the direction of the axis (in the local-space of the first box)
+    Vector3 edge1A;
+    for (int i=0; i < 3; i++) {
+        edge1A[i] = axis[i] < decimal(0.0) ? -halfExtents1[i] : halfExtents1[i];
+    }
+    Vector3 edge1B = edge1A;
+    edge1A[edge1Axis] = -halfExtents1[edge1Axis];
+    edge1B[edge1Axis] = halfExtents1[edge1Axis];
+
+    // Compute the edge of the second box in the opposite direction of the axis (in the local-space of the second box)
+    const Vector3 axisBox2Space = box1ToBox2.getOrientation() * axis;
+    Vector3 edge2A;
+    for (int i=0; i < 3; i++) {
+        edge2A[i] = axisBox2Space[i] > decimal(0.0) ? -halfExtents2[i] : halfExtents2[i];
+    }
+    Vector3 edge2B = edge2A;
+    edge2A[edge2Axis] = -halfExtents2[edge2Axis];
+    edge2B[edge2Axis] = halfExtents2[edge2Axis];
+
+    // Compute the closest points between the two edges (in the local-space of the first box)
+    Vector3 closestPointBox1Edge, closestPointBox2Edge;
+    computeClosestPointBetweenTwoSegments(edge1A, edge1B, box2ToBox1 * edge2A, box2ToBox1 * edge2B,
+                                          closestPointBox1Edge, closestPointBox2Edge);
+
+    // Compute the world normal
+    const Vector3 normalWorld = narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex].getOrientation() * axis;
+
+    // Create the contact point
+    narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth, closestPointBox1Edge,
+                                         box1ToBox2 * closestPointBox2Edge);
+}
@@ -27,212 +27,301 @@
 #include <reactphysics3d/collision/narrowphase/CapsuleVsCapsuleAlgorithm.h>
 #include <reactphysics3d/collision/shapes/CapsuleShape.h>
 #include <reactphysics3d/collision/narrowphase/CapsuleVsCapsuleNarrowPhaseInfoBatch.h>
+#include <reactphysics3d/mathematics/SimdVector3.h>
 
 // We want to use the ReactPhysics3D namespace
 using namespace reactphysics3d;  
 
-// Compute the narrow-phase collision detection between two capsules
-// This technique is based on the "Robust Contact Creation for Physics Simulations" presentation
-// by Dirk Gregorius.
+// Compute the narrow-phase collision detection between the pairs of capsules of a batch
 bool CapsuleVsCapsuleAlgorithm::testCollision(CapsuleVsCapsuleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchStartIndex, uint batchNbItems,
                                               MemoryAllocator& memoryAllocator) {
     
     bool isCollisionFound = false;
 
-    for (uint batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
-
-        assert(narrowPhaseInfoBatch.contactPoints[batchIndex].size() == 0);
+    const uint batchEndIndex = batchStartIndex + batchNbItems;
+    const SimdDecimal zero(decimal(0.0));
+    const SimdDecimal one(decimal(1.0));
+    const SimdDecimal toleranceFactor(decimal(1.0) + NARROW_PHASE_SIMD_OVERLAP_TOLERANCE);
+    const SimdDecimal parallelThreshold(decimal(0.0001));
+    const SimdDecimal smallestSquaredLength(MACHINE_EPSILON);
+    decimal overlapLanes[SIMD_DECIMAL_NB_LANES];
+
+    // For each group of SIMD_DECIMAL_NB_LANES items in the batch
+    uint batchIndex = batchStartIndex;
+    for (; batchIndex + SIMD_DECIMAL_NB_LANES <= batchEndIndex; batchIndex += SIMD_DECIMAL_NB_LANES) {
+
+        const SimdVector3 capsule1Centers(SimdDecimal::load(&narrowPhaseInfoBatch.capsule1CentersX[batchIndex]),
+                                          SimdDecimal::load(&narrowPhaseInfoBatch.capsule1CentersY[batchIndex]),
+                                          SimdDecimal::load(&narrowPhaseInfoBatch.capsule1CentersZ[batchIndex]));
+        const SimdVector3 capsule1Axes(SimdDecimal::load(&narrowPhaseInfoBatch.capsule1AxesX[batchIndex]),
+                                       SimdDecimal::load(&narrowPhaseInfoBatch.capsule1AxesY[batchIndex]),
+                                       SimdDecimal::load(&narrowPhaseInfoBatch.capsule1AxesZ[batchIndex]));
+        const SimdVector3 capsule2Centers(SimdDecimal::load(&narrowPhaseInfoBatch.capsule2CentersX[batchIndex]),
+                                          SimdDecimal::load(&narrowPhaseInfoBatch.capsule2CentersY[batchIndex]),
+                                          SimdDecimal::load(&narrowPhaseInfoBatch.capsule2CentersZ[batchIndex]));
+        const SimdVector3 capsule2Axes(SimdDecimal::load(&narrowPhaseInfoBatch.capsule2AxesX[batchIndex]),
+                                       SimdDecimal::load(&narrowPhaseInfoBatch.capsule2AxesY[batchIndex]),
+                                       SimdDecimal::load(&narrowPhaseInfoBatch.capsule2AxesZ[batchIndex]));
+        const SimdDecimal capsule1HalfHeights = SimdDecimal::load(&narrowPhaseInfoBatch.capsule1Heights[batchIndex]) * SimdDecimal(decimal(0.5));
+        const SimdDecimal capsule2HalfHeights = SimdDecimal::load(&narrowPhaseInfoBatch.capsule2Heights[batchIndex]) * SimdDecimal(decimal(0.5));
+
+        // Compute the inner segments of the capsules (start points and segment vectors)
+        const SimdVector3 seg1 = capsule1Axes * (capsule1HalfHeights + capsule1HalfHeights);
+        const SimdVector3 seg2 = capsule2Axes * (capsule2HalfHeights + capsule2HalfHeights);
+        const SimdVector3 capsule1SegA = capsule1Centers - capsule1Axes * capsule1HalfHeights;
+        const SimdVector3 capsule2SegA = capsule2Centers - capsule2Axes * capsule2HalfHeights;
+
+        // Compute the closest points between the two segments (parameters s on segment 1 and t on
+        // segment 2). This is the method described in the "Real-Time Collision Detection" book by
+        // Christer Ericson where the branches are replaced by selections
+        const SimdVector3 r = capsule1SegA - capsule2SegA;
+        const SimdDecimal a = SimdDecimal::max(seg1.lengthSquare(), smallestSquaredLength);
+        const SimdDecimal e = SimdDecimal::max(seg2.lengthSquare(), smallestSquaredLength);
+        const SimdDecimal b = seg1.dot(seg2);
+        const SimdDecimal c = seg1.dot(r);
+        const SimdDecimal f = seg2.dot(r);
+        const SimdDecimal denominator = a * e - b * b;
+        const SimdDecimal parallelDenominatorThreshold = parallelThreshold * a * e;
+
+        // For the (almost) parallel segments, we start from s=0
+        SimdDecimal s = SimdDecimal::min(SimdDecimal::max((b * f - c * e) / SimdDecimal::max(denominator, smallestSquaredLength), zero), one);
+        s = SimdDecimal::selectGreater(denominator, parallelDenominatorThreshold, s, zero);
+        const SimdDecimal tUnclamped = (b * s + f) / e;
+        const SimdDecimal t = SimdDecimal::min(SimdDecimal::max(tUnclamped, zero), one);
+
+        // If t has been clamped, we recompute s for the clamped value of t
+        const SimdDecimal sIfTIsZero = SimdDecimal::min(SimdDecimal::max(-c / a, zero), one);
+        const SimdDecimal sIfTIsOne = SimdDecimal::min(SimdDecimal::max((b - c) / a, zero), one);
+        s = SimdDecimal::selectGreater(zero, tUnclamped, sIfTIsZero, SimdDecimal::selectGreater(tUnclamped, one, sIfTIsOne, s));
+
+        const SimdVector3 closestPointsSeg1ToSeg2 = (capsule2SegA + seg2 * t) - (capsule1SegA + seg1 * s);
+
+        // Compute the sums of the radiuses (increased by the tolerance of the test)
+        const SimdDecimal sumRadiuses = (SimdDecimal::load(&narrowPhaseInfoBatch.capsule1Radiuses[batchIndex]) +
+                                         SimdDecimal::load(&narrowPhaseInfoBatch.capsule2Radiuses[batchIndex])) * toleranceFactor;
+
+        // A lane is positive if the two capsules may overlap. The (almost) parallel segments are
+        // always tested with the exact test because the closest points above are not accurate enough
+        const SimdDecimal overlap = sumRadiuses * sumRadiuses - closestPointsSeg1ToSeg2.lengthSquare();
+        SimdDecimal::selectGreater(denominator, parallelDenominatorThreshold, overlap, one).store(overlapLanes);
+
+        // Compute the contacts of the pairs that may overlap
+        for (uint32 lane = 0; lane < SIMD_DECIMAL_NB_LANES; lane++) {
+
+            assert(narrowPhaseInfoBatch.contactPoints[batchIndex + lane].size() == 0);
+            assert(!narrowPhaseInfoBatch.isColliding[batchIndex + lane]);
+
+            if (overlapLanes[lane] > decimal(0.0)) {
+                isCollisionFound |= testCollisionPair(narrowPhaseInfoBatch, batchIndex + lane);
+            }
+        }
+    }
 
-        assert(!narrowPhaseInfoBatch.isColliding[batchIndex]);
+    // For each remaining item in the batch
+    for (; batchIndex < batchEndIndex; batchIndex++) {
+        isCollisionFound |= testCollisionPair(narrowPhaseInfoBatch, batchIndex);
+    }
 
-        // Get the transform from capsule 1 local-space to capsule 2 local-space
-        const Transform capsule1ToCapsule2SpaceTransform = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getInverse() *
-                                                           narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex];
+    return isCollisionFound;
+}
 
-        // Compute the end-points of the inner segment of the first capsule
-        const decimal capsule1HalfHeight = narrowPhaseInfoBatch.capsule1Heights[batchIndex] * decimal(0.5);
-        Vector3 capsule1SegA(0, -capsule1HalfHeight, 0);
-        Vector3 capsule1SegB(0, capsule1HalfHeight, 0);
-        capsule1SegA = capsule1ToCapsule2SpaceTransform * capsule1SegA;
-        capsule1SegB = capsule1ToCapsule2SpaceTransform * capsule1SegB;
+// Compute the narrow-phase collision detection between two capsules
+// This technique is based on the "Robust Contact Creation for Physics Simulations" presentation
+// by Dirk Gregorius.
+bool CapsuleVsCapsuleAlgorithm::testCollisionPair(CapsuleVsCapsuleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchIndex) {
 
-        // Compute the end-points of the inner segment of the second capsule
-        const decimal capsule2HalfHeight = narrowPhaseInfoBatch.capsule2Heights[batchIndex] * decimal(0.5);
-        const Vector3 capsule2SegA(0, -capsule2HalfHeight, 0);
-        const Vector3 capsule2SegB(0, capsule2HalfHeight, 0);
+    assert(narrowPhaseInfoBatch.contactPoints[batchIndex].size() == 0);
 
-        // The two inner capsule segments
-        const Vector3 seg1 = capsule1SegB - capsule1SegA;
-        const Vector3 seg2 = capsule2SegB - capsule2SegA;
+    assert(!narrowPhaseInfoBatch.isColliding[batchIndex]);
 
-        // Compute the sum of the radius of the two capsules (virtual spheres)
-        const decimal capsule1Radius = narrowPhaseInfoBatch.capsule1Radiuses[batchIndex];
-        const decimal capsule2Radius = narrowPhaseInfoBatch.capsule2Radiuses[batchIndex];
-        const decimal sumRadius = capsule1Radius + capsule2Radius;
+    // Get the transform from capsule 1 local-space to capsule 2 local-space
+    const Transform capsule1ToCapsule2SpaceTransform = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getInverse() *
+                                                       narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex];
 
-        // If the two capsules are parallel (we create two contact points)
-        bool areCapsuleInnerSegmentsParralel = areParallelVectors(seg1, seg2);
-        if (areCapsuleInnerSegmentsParralel) {
+    // Compute the end-points of the inner segment of the first capsule
+    const decimal capsule1HalfHeight = narrowPhaseInfoBatch.capsule1Heights[batchIndex] * decimal(0.5);
+    Vector3 capsule1SegA(0, -capsule1HalfHeight, 0);
+    Vector3 capsule1SegB(0, capsule1HalfHeight, 0);
+    capsule1SegA = capsule1ToCapsule2SpaceTransform * capsule1SegA;
+    capsule1SegB = capsule1ToCapsule2SpaceTransform * capsule1SegB;
 
-            // If the distance between the two segments is larger than the sum of the capsules radius (we do not have overlapping)
-            const decimal segmentsPerpendicularDistance = computePointToLineDistance(capsule1SegA, capsule1SegB, capsule2SegA);
-            if (segmentsPerpendicularDistance >= sumRadius) {
+    // Compute the end-points of the inner segment of the second capsule
+    const decimal capsule2HalfHeight = narrowPhaseInfoBatch.capsule2Heights[batchIndex] * decimal(0.5);
+    const Vector3 capsule2SegA(0, -capsule2HalfHeight, 0);
+    const Vector3 capsule2SegB(0, capsule2HalfHeight, 0);
 
-                // The capsule are parallel but their inner segment distance is larger than the sum of the capsules radius.
-                // Therefore, we do not have overlap. If the inner segments overlap, we do not report any collision.
-                continue;
-            }
+    // The two inner capsule segments
+    const Vector3 seg1 = capsule1SegB - capsule1SegA;
+    const Vector3 seg2 = capsule2SegB - capsule2SegA;
 
-            // Compute the planes that goes through the extreme points of the inner segment of capsule 1
-            decimal d1 = seg1.dot(capsule1SegA);
-            decimal d2 = -seg1.dot(capsule1SegB);
+    // Compute the sum of the radius of the two capsules (virtual spheres)
+    const decimal capsule1Radius = narrowPhaseInfoBatch.capsule1Radiuses[batchIndex];
+    const decimal capsule2Radius = narrowPhaseInfoBatch.capsule2Radiuses[batchIndex];
+    const decimal sumRadius = capsule1Radius + capsule2Radius;
 
-            // Clip the inner segment of capsule 2 with the two planes that go through extreme points of inner
-            // segment of capsule 1
-            decimal t1 = computePlaneSegmentIntersection(capsule2SegB, capsule2SegA, d1, seg1);
-            decimal t2 = computePlaneSegmentIntersection(capsule2SegA, capsule2SegB, d2, -seg1);
+    // If the two capsules are parallel (we create two contact points)
+    bool areCapsuleInnerSegmentsParralel = areParallelVectors(seg1, seg2);
+    if (areCapsuleInnerSegmentsParralel) {
 
-            // If the segments were overlapping (the clip segment is valid)
-            if (t1 > decimal(0.0) && t2 > decimal(0.0)) {
+        // If the distance between the two segments is larger than the sum of the capsules radius (we do not have overlapping)
+        const decimal segmentsPerpendicularDistance = computePointToLineDistance(capsule1SegA, capsule1SegB, capsule2SegA);
+        if (segmentsPerpendicularDistance >= sumRadius) {
 
-                if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
+            // The capsule are parallel but their inner segment distance is larger than the sum of the capsules radius.
+            // Therefore, we do not have overlap. If the inner segments overlap, we do not report any collision.
+            return false;
+        }
 
-                    // Clip the inner segment of capsule 2
-                    if (t1 > decimal(1.0)) t1 = decimal(1.0);
-                    const Vector3 clipPointA = capsule2SegB - t1 * seg2;
-                    if (t2 > decimal(1.0)) t2 = decimal(1.0);
-                    const Vector3 clipPointB = capsule2SegA + t2 * seg2;
+        // Compute the planes that goes through the extreme points of the inner segment of capsule 1
+        decimal d1 = seg1.dot(capsule1SegA);
+        decimal d2 = -seg1.dot(capsule1SegB);
 
-                    // Project point capsule2SegA onto line of innner segment of capsule 1
-                    const Vector3 seg1Normalized = seg1.getUnit();
-                    Vector3 pointOnInnerSegCapsule1 = capsule1SegA + seg1Normalized.dot(capsule2SegA - capsule1SegA) * seg1Normalized;
+        // Clip the inner segment of capsule 2 with the two planes that go through extreme points of inner
+        // segment of capsule 1
+        decimal t1 = computePlaneSegmentIntersection(capsule2SegB, capsule2SegA, d1, seg1);
+        decimal t2 = computePlaneSegmentIntersection(capsule2SegA, capsule2SegB, d2, -seg1);
 
-                    Vector3 normalCapsule2SpaceNormalized;
-                    Vector3 segment1ToSegment2;
+        // If the segments were overlapping (the clip segment is valid)
+        if (t1 > decimal(0.0) && t2 > decimal(0.0)) {
 
-                    // If the inner capsule segments perpendicular distance is not zero (the inner segments are not overlapping)
-                    if (segmentsPerpendicularDistance > MACHINE_EPSILON) {
+            if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
 
-                        // Compute a perpendicular vector from segment 1 to segment 2
-                        segment1ToSegment2 = (capsule2SegA - pointOnInnerSegCapsule1);
-                        normalCapsule2SpaceNormalized = segment1ToSegment2.getUnit();
-                    }
-                    else {    // If the capsule inner segments are overlapping (degenerate case)
+                // Clip the inner segment of capsule 2
+                if (t1 > decimal(1.0)) t1 = decimal(1.0);
+                const Vector3 clipPointA = capsule2SegB - t1 * seg2;
+                if (t2 > decimal(1.0)) t2 = decimal(1.0);
+                const Vector3 clipPointB = capsule2SegA + t2 * seg2;
 
-                        // We cannot use the vector between segments as a contact normal. To generate a contact normal, we take
-                        // any vector that is orthogonal to the inner capsule segments.
+                // Project point capsule2SegA onto line of innner segment of capsule 1
+                const Vector3 seg1Normalized = seg1.getUnit();
+                Vector3 pointOnInnerSegCapsule1 = capsule1SegA + seg1Normalized.dot(capsule2SegA - capsule1SegA) * seg1Normalized;
 
-                        Vector3 vec1(1, 0, 0);
-                        Vector3 vec2(0, 1, 0);
+                Vector3 normalCapsule2SpaceNormalized;
+                Vector3 segment1ToSegment2;
 
-                        Vector3 seg2Normalized = seg2.getUnit();
+                // If the inner capsule segments perpendicular distance is not zero (the inner segments are not overlapping)
+                if (segmentsPerpendicularDistance > MACHINE_EPSILON) {
 
-                        // Get the vectors (among vec1 and vec2) that is the most orthogonal to the capsule 2 inner segment (smallest absolute dot product)
-                        decimal cosA1 = std::abs(seg2Normalized.x);		// abs(vec1.dot(seg2))
-                        decimal cosA2 = std::abs(seg2Normalized.y);	    // abs(vec2.dot(seg2))
+                    // Compute a perpendicular vector from segment 1 to segment 2
+                    segment1ToSegment2 = (capsule2SegA - pointOnInnerSegCapsule1);
+                    normalCapsule2SpaceNormalized = segment1ToSegment2.getUnit();
+                }
+                else {    // If the capsule inner segments are overlapping (degenerate case)
 
-                        segment1ToSegment2.setToZero();
+                    // We cannot use the vector between segments as a contact normal. To generate a contact normal, we take
+                    // any vector that is orthogonal to the inner capsule segments.
 
-                        // We choose as a contact normal, any direction that is perpendicular to the inner capsules segments
-                        normalCapsule2SpaceNormalized = cosA1 < cosA2 ? seg2Normalized.cross(vec1) : seg2Normalized.cross(vec2);
-                    }
+                    Vector3 vec1(1, 0, 0);
+                    Vector3 vec2(0, 1, 0);
 
-                    Transform capsule2ToCapsule1SpaceTransform = capsule1ToCapsule2SpaceTransform.getInverse();
-                    const Vector3 contactPointACapsule1Local = capsule2ToCapsule1SpaceTransform * (clipPointA - segment1ToSegment2 + normalCapsule2SpaceNormalized * capsule1Radius);
-                    const Vector3 contactPointBCapsule1Local = capsule2ToCapsule1SpaceTransform * (clipPointB - segment1ToSegment2 + normalCapsule2SpaceNormalized * capsule1Radius);
-                    const Vector3 contactPointACapsule2Local = clipPointA - normalCapsule2SpaceNormalized * capsule2Radius;
-                    const Vector3 contactPointBCapsule2Local = clipPointB - normalCapsule2SpaceNormalized * capsule2Radius;
+                    Vector3 seg2Normalized = seg2.getUnit();
 
-                    decimal penetrationDepth = sumRadius - segmentsPerpendicularDistance;
+                    // Get the vectors (among vec1 and vec2) that is the most orthogonal to the capsule 2 inner segment (smallest absolute dot product)
+                    decimal cosA1 = std::abs(seg2Normalized.x);		// abs(vec1.dot(seg2))
+                    decimal cosA2 = std::abs(seg2Normalized.y);	    // abs(vec2.dot(seg2))
 
-                    const Vector3 normalWorld = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getOrientation() * normalCapsule2SpaceNormalized;
+                    segment1ToSegment2.setToZero();
 
-                    // Create the contact info object
-                    narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth, contactPointACapsule1Local, contactPointACapsule2Local);
-                    narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth, contactPointBCapsule1Local, contactPointBCapsule2Local);
+                    // We choose as a contact normal, any direction that is perpendicular to the inner capsules segments
+                    normalCapsule2SpaceNormalized = cosA1 < cosA2 ? seg2Normalized.cross(vec1) : seg2Normalized.cross(vec2);
                 }
 
-                narrowPhaseInfoBatch.isColliding[batchIndex] = true;
-                isCollisionFound = true;
-                continue;
+                Transform capsule2ToCapsule1SpaceTransform = capsule1ToCapsule2SpaceTransform.getInverse();
+                const Vector3 contactPointACapsule1Local = capsule2ToCapsule1SpaceTransform * (clipPointA - segment1ToSegment2 + normalCapsule2SpaceNormalized * capsule1Radius);
+                const Vector3 contactPointBCapsule1Local = capsule2ToCapsule1SpaceTransform * (clipPointB - segment1ToSegment2 + normalCapsule2SpaceNormalized * capsule1Radius);
+                const Vector3 contactPointACapsule2Local = clipPointA - normalCapsule2SpaceNormalized * capsule2Radius;
+                const Vector3 contactPointBCapsule2Local = clipPointB - normalCapsule2SpaceNormalized * capsule2Radius;
+
+                decimal penetrationDepth = sumRadius - segmentsPerpendicularDistance;
+
+                const Vector3 normalWorld = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getOrientation() * normalCapsule2SpaceNormalized;
+
+                // Create the contact info object
+                narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth, contactPointACapsule1Local, contactPointACapsule2Local);
+                narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth, contactPointBCapsule1Local, contactPointBCapsule2Local);
             }
+
+            narrowPhaseInfoBatch.isColliding[batchIndex] = true;
+
+            return true;
         }
+    }
 
-        // Compute the closest points between the two inner capsule segments
-        Vector3 closestPointCapsule1Seg;
-        Vector3 closestPointCapsule2Seg;
-        computeClosestPointBetweenTwoSegments(capsule1SegA, capsule1SegB, capsule2SegA, capsule2SegB,
-                                              closestPointCapsule1Seg, closestPointCapsule2Seg);
+    // Compute the closest points between the two inner capsule segments
+    Vector3 closestPointCapsule1Seg;
+    Vector3 closestPointCapsule2Seg;
+    computeClosestPointBetweenTwoSegments(capsule1SegA, capsule1SegB, capsule2SegA, capsule2SegB,
+                                          closestPointCapsule1Seg, closestPointCapsule2Seg);
 
-        // Compute the distance between the sphere center and the closest point on the segment
-        Vector3 closestPointsSeg1ToSeg2 = (closestPointCapsule2Seg - closestPointCapsule1Seg);
-        const decimal closestPointsDistanceSquare = closestPointsSeg1ToSeg2.lengthSquare();
+    // Compute the distance between the sphere center and the closest point on the segment
+    Vector3 closestPointsSeg1ToSeg2 = (closestPointCapsule2Seg - closestPointCapsule1Seg);
+    const decimal closestPointsDistanceSquare = closestPointsSeg1ToSeg2.lengthSquare();
 
-        // If the collision shapes overlap
-        if (closestPointsDistanceSquare < sumRadius * sumRadius) {
+    // If the collision shapes overlap
+    if (closestPointsDistanceSquare < sumRadius * sumRadius) {
 
-            if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
+        if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
 
-                // If the distance between the inner segments is not zero
-                if (closestPointsDistanceSquare > MACHINE_EPSILON) {
+            // If the distance between the inner segments is not zero
+            if (closestPointsDistanceSquare > MACHINE_EPSILON) {
 
-                    decimal closestPointsDistance = std::sqrt(closestPointsDistanceSquare);
-                    closestPointsSeg1ToSeg2 /= closestPointsDistance;
+                decimal closestPointsDistance = std::sqrt(closestPointsDistanceSquare);
+                closestPointsSeg1ToSeg2 /= closestPointsDistance;
 
-                    const Vector3 contactPointCapsule1Local = capsule1ToCapsule2SpaceTransform.getInverse() * (closestPointCapsule1Seg + closestPointsSeg1ToSeg2 * capsule1Radius);
-                    const Vector3 contactPointCapsule2Local = closestPointCapsule2Seg - closestPointsSeg1ToSeg2 * capsule2Radius;
+                const Vector3 contactPointCapsule1Local = capsule1ToCapsule2SpaceTransform.getInverse() * (closestPointCapsule1Seg + closestPointsSeg1ToSeg2 * capsule1Radius);
+                const Vector3 contactPointCapsule2Local = closestPointCapsule2Seg - closestPointsSeg1ToSeg2 * capsule2Radius;
 
-                    const Vector3 normalWorld = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getOrientation() * closestPointsSeg1ToSeg2;
+                const Vector3 normalWorld = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getOrientation() * closestPointsSeg1ToSeg2;
 
-                    decimal penetrationDepth = sumRadius - closestPointsDistance;
+                decimal penetrationDepth = sumRadius - closestPointsDistance;
 
-                    // Create the contact info object
-                    narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth, contactPointCapsule1Local, contactPointCapsule2Local);
-                }
-                else { // The segment are overlapping (degenerate case)
+                // Create the contact info object
+                narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth, contactPointCapsule1Local, contactPointCapsule2Local);
+            }
+            else { // The segment are overlapping (degenerate case)
 
-                    // If the capsule segments are parralel
-                    if (areCapsuleInnerSegmentsParralel) {
+                // If the capsule segments are parralel
+                if (areCapsuleInnerSegmentsParralel) {
 
-                        // The segment are parallel, not overlapping and their distance is zero.
-                        // Therefore, the capsules are just touching at the top of their inner segments
-                        decimal squareDistCapsule2PointToCapsuleSegA = (capsule1SegA - closestPointCapsule2Seg).lengthSquare();
+                    // The segment are parallel, not overlapping and their distance is zero.
+                    // Therefore, the capsules are just touching at the top of their inner segments
+                    decimal squareDistCapsule2PointToCapsuleSegA = (capsule1SegA - closestPointCapsule2Seg).lengthSquare();
 
-                        Vector3 capsule1SegmentMostExtremePoint = squareDistCapsule2PointToCapsuleSegA > MACHINE_EPSILON ? capsule1SegA : capsule1SegB;
-                        Vector3 normalCapsuleSpace2 = (closestPointCapsule2Seg - capsule1SegmentMostExtremePoint);
-                        normalCapsuleSpace2.normalize();
+                    Vector3 capsule1SegmentMostExtremePoint = squareDistCapsule2PointToCapsuleSegA > MACHINE_EPSILON ? capsule1SegA : capsule1SegB;
+                    Vector3 normalCapsuleSpace2 = (closestPointCapsule2Seg - capsule1SegmentMostExtremePoint);
+                    normalCapsuleSpace2.normalize();
 
-                        const Vector3 contactPointCapsule1Local = capsule1ToCapsule2SpaceTransform.getInverse() * (closestPointCapsule1Seg + normalCapsuleSpace2 * capsule1Radius);
-                        const Vector3 contactPointCapsule2Local = closestPointCapsule2Seg - normalCapsuleSpace2 * capsule2Radius;
+                    const Vector3 contactPointCapsule1Local = capsule1ToCapsule2SpaceTransform.getInverse() * (closestPointCapsule1Seg + normalCapsuleSpace2 * capsule1Radius);
+                    const Vector3 contactPointCapsule2Local = closestPointCapsule2Seg - normalCapsuleSpace2 * capsule2Radius;
 
-                        const Vector3 normalWorld = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getOrientation() * normalCapsuleSpace2;
+                    const Vector3 normalWorld = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getOrientation() * normalCapsuleSpace2;
 
-                        // Create the contact info object
-                        narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, sumRadius, contactPointCapsule1Local, contactPointCapsule2Local);
-                    }
-                    else {   // If the capsules inner segments are not parallel
+                    // Create the contact info object
+                    narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, sumRadius, contactPointCapsule1Local, contactPointCapsule2Local);
+                }
+                else {   // If the capsules inner segments are not parallel
 
-                        // We cannot use a vector between the segments as contact normal. We need to compute a new contact normal with the cross
-                        // product between the two segments.
-                        Vector3 normalCapsuleSpace2 = seg1.cross(seg2);
-                        normalCapsuleSpace2.normalize();
+                    // We cannot use a vector between the segments as contact normal. We need to compute a new contact normal with the cross
+                    // product between the two segments.
+                    Vector3 normalCapsuleSpace2 = seg1.cross(seg2);
+                    normalCapsuleSpace2.normalize();
 
-                        // Compute the contact points on both shapes
-                        const Vector3 contactPointCapsule1Local = capsule1ToCapsule2SpaceTransform.getInverse() * (closestPointCapsule1Seg + normalCapsuleSpace2 * capsule1Radius);
-                        const Vector3 contactPointCapsule2Local = closestPointCapsule2Seg - normalCapsuleSpace2 * capsule2Radius;
+                    // Compute the contact points on both shapes
+                    const Vector3 contactPointCapsule1Local = capsule1ToCapsule2SpaceTransform.getInverse() * (closestPointCapsule1Seg + normalCapsuleSpace2 * capsule1Radius);
+                    const Vector3 contactPointCapsule2Local = closestPointCapsule2Seg - normalCapsuleSpace2 * capsule2Radius;
 
-                        const Vector3 normalWorld = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getOrientation() * normalCapsuleSpace2;
+                    const Vector3 normalWorld = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex].getOrientation() * normalCapsuleSpace2;
 
-                        // Create the contact info object
-                        narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, sumRadius, contactPointCapsule1Local, contactPointCapsule2Local);
-                    }
+                    // Create the contact info object
+                    narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, sumRadius, contactPointCapsule1Local, contactPointCapsule2Local);
                 }
             }
-
-            narrowPhaseInfoBatch.isColliding[batchIndex] = true;
-            isCollisionFound = true;
         }
+
+        narrowPhaseInfoBatch.isColliding[batchIndex] = true;
+
+        return true;
     }
 
-    return isCollisionFound;
+    return false;
 }
@@ -33,7 +33,9 @@ using namespace reactphysics3d;
 CapsuleVsCapsuleNarrowPhaseInfoBatch::CapsuleVsCapsuleNarrowPhaseInfoBatch(MemoryAllocator& allocator,
                                                                            OverlappingPairs& overlappingPairs)
       : NarrowPhaseInfoBatch(allocator, overlappingPairs), capsule1Radiuses(allocator), capsule2Radiuses(allocator),
-        capsule1Heights(allocator), capsule2Heights(allocator) {
+        capsule1Heights(allocator), capsule2Heights(allocator),
+        capsule1CentersX(allocator), capsule1CentersY(allocator), capsule1CentersZ(allocator), capsule1AxesX(allocator), capsule1AxesY(allocator), capsule1AxesZ(allocator),
+        capsule2CentersX(allocator), capsule2CentersY(allocator), capsule2CentersZ(allocator), capsule2AxesX(allocator), capsule2AxesY(allocator), capsule2AxesZ(allocator) {
 
 }
 
@@ -54,6 +56,24 @@ void CapsuleVsCapsuleNarrowPhaseInfoBatch::addNarrowPhaseInfo(uint64 pairId, uin
     capsule2Radiuses.add(capsule2->getRadius());
     capsule1Heights.add(capsule1->getHeight());
     capsule2Heights.add(capsule2->getHeight());
+
+    // Compute the world-space centers and directions of the inner segments of the capsules
+    const Vector3& capsule1Center = shape1Transform.getPosition();
+    const Vector3& capsule2Center = shape2Transform.getPosition();
+    const Vector3 capsule1Axis = shape1Transform.getOrientation() * Vector3(0, 1, 0);
+    const Vector3 capsule2Axis = shape2Transform.getOrientation() * Vector3(0, 1, 0);
+    capsule1CentersX.add(capsule1Center.x);
+    capsule1CentersY.add(capsule1Center.y);
+    capsule1CentersZ.add(capsule1Center.z);
+    capsule1AxesX.add(capsule1Axis.x);
+    capsule1AxesY.add(capsule1Axis.y);
+    capsule1AxesZ.add(capsule1Axis.z);
+    capsule2CentersX.add(capsule2Center.x);
+    capsule2CentersY.add(capsule2Center.y);
+    capsule2CentersZ.add(capsule2Center.z);
+    capsule2AxesX.add(capsule2Axis.x);
+    capsule2AxesY.add(capsule2Axis.y);
+    capsule2AxesZ.add(capsule2Axis.z);
 }
 
 // Initialize the containers using cached capacity
@@ -65,6 +85,18 @@ void CapsuleVsCapsuleNarrowPhaseInfoBatch::reserveMemory() {
     capsule2Radiuses.reserve(mCachedCapacity);
     capsule1Heights.reserve(mCachedCapacity);
     capsule2Heights.reserve(mCachedCapacity);
+    capsule1CentersX.reserve(mCachedCapacity);
+    capsule1CentersY.reserve(mCachedCapacity);
+    capsule1CentersZ.reserve(mCachedCapacity);
+    capsule1AxesX.reserve(mCachedCapacity);
+    capsule1AxesY.reserve(mCachedCapacity);
+    capsule1AxesZ.reserve(mCachedCapacity);
+    capsule2CentersX.reserve(mCachedCapacity);
+    capsule2CentersY.reserve(mCachedCapacity);
+    capsule2CentersZ.reserve(mCachedCapacity);
+    capsule2AxesX.reserve(mCachedCapacity);
+    capsule2AxesY.reserve(mCachedCapacity);
+    capsule2AxesZ.reserve(mCachedCapacity);
 }
 
 // Clear all the objects in the batch
@@ -81,4 +113,16 @@ void CapsuleVsCapsuleNarrowPhaseInfoBatch::clear() {
     capsule2Radiuses.clear(true);
     capsule1Heights.clear(true);
     capsule2Heights.clear(true);
+    capsule1CentersX.clear(true);
+    capsule1CentersY.clear(true);
+    capsule1CentersZ.clear(true);
+    capsule1AxesX.clear(true);
+    capsule1AxesY.clear(true);
+    capsule1AxesZ.clear(true);
+    capsule2CentersX.clear(true);
+    capsule2CentersY.clear(true);
+    capsule2CentersZ.clear(true);
+    capsule2AxesX.clear(true);
+    capsule2AxesY.clear(true);
+    capsule2AxesZ.clear(true);
 }
@@ -28,10 +28,12 @@
 #include <reactphysics3d/constraint/ContactPoint.h>
 #include <reactphysics3d/engine/OverlappingPairs.h>
 #include <reactphysics3d/collision/shapes/TriangleShape.h>
+#include <reactphysics3d/collision/shapes/ConvexMeshShape.h>
 #include <reactphysics3d/configuration.h>
 #include <reactphysics3d/utils/Profiler.h>
 #include <reactphysics3d/containers/List.h>
 #include <reactphysics3d/collision/narrowphase/NarrowPhaseInfoBatch.h>
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseStatistics.h>
 #include <reactphysics3d/collision/narrowphase/GJK/VoronoiSimplex.h>
 #include <cassert>
 
@@ -47,8 +49,11 @@ using namespace reactphysics3d;
 /// algorithm on the enlarged object to obtain a simplex polytope that contains the
 /// origin, they we give that simplex polytope to the EPA algorithm which will compute
 /// the correct penetration depth and contact points between the enlarged objects.
+/// If the shapes were separated in the previous test of the pair and cannot have moved enough
+/// since then to close the gap between them, the test is skipped. Otherwise, the algorithm
+/// starts from the simplex of the previous test (moved to the current position of the shapes).
 void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchStartIndex,
-                                 uint batchNbItems, List<GJKResult>& gjkResults) {
+                                 uint batchNbItems, List<GJKResult>& gjkResults, NarrowPhaseStatistics& statistics) {
 
     RP3D_PROFILE("GJKAlgorithm::testCollision()", mProfiler);
     
@@ -94,6 +99,41 @@ void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uin
         // Get the last collision frame info
         LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.lastFrameCollisionInfos[batchIndex];
 
+        statistics.nbGJKTests++;
+
+        // Compute the bounding radiuses of the shapes (if they have changed since the previous
+        // test, the cached simplex and separation gap cannot be used)
+        const decimal boundingRadius1 = computeBoundingRadius(shape1);
+        const decimal boundingRadius2 = computeBoundingRadius(shape2);
+        const bool isSameShapesSize = boundingRadius1 == lastFrameCollisionInfo->gjkBoundingRadius1 &&
+                                      boundingRadius2 == lastFrameCollisionInfo->gjkBoundingRadius2;
+
+        // If the shapes were separated in the previous test
+        if (lastFrameCollisionInfo->gjkSeparationGap > decimal(0.0) && isSameShapesSize) {
+
+            // Compute an upper bound of the displacement (since the previous test) of the points of the second
+            // shape in the local-space of the first shape. The displacement of a point is at most the translation
+            // plus the chord of the relative rotation angle (2 * sin(angle / 2)) times the bounding radius. The
+            // same bound is computed for the points of the first shape in the local-space of the second shape
+            const Transform& previousBody2ToBody1 = lastFrameCollisionInfo->gjkSeparationShape2ToShape1;
+            const Quaternion rotation = body2Tobody1.getOrientation() * previousBody2ToBody1.getOrientation().getInverse();
+            const decimal chordFactor = decimal(2.0) * rotation.getVectorV().length();
+            const decimal displacement2 = (body2Tobody1.getPosition() - previousBody2ToBody1.getPosition()).length() +
+                                          chordFactor * boundingRadius2;
+            const decimal displacement1 = (body2Tobody1.getInverse().getPosition() - previousBody2ToBody1.getInverse().getPosition()).length() +
+                                          chordFactor * boundingRadius1;
+
+            // If the shapes cannot have moved enough to close the gap, they are still separated
+            if (std::min(displacement1, displacement2) < lastFrameCollisionInfo->gjkSeparationGap) {
+
+                statistics.nbGJKSkippedTests++;
+
+                assert(gjkResults.size() == batchIndex - batchStartIndex);
+                gjkResults.add(GJKResult::SEPARATED);
+                continue;
+            }
+        }
+
         // Get the previous point V (last cached separating axis)
         Vector3 v;
         if (lastFrameCollisionInfo->isValid && lastFrameCollisionInfo->wasUsingGJK) {
@@ -104,16 +144,49 @@ void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uin
             v.setAllValues(0, 1, 0);
         }
 
+        // Get the support vertices of the previous frame (used as a start for the
+        // hill-climbing search of the support vertices of convex meshes)
+        uint supportVertexIndex1 = lastFrameCollisionInfo->gjkSupportVertexIndex1;
+        uint supportVertexIndex2 = lastFrameCollisionInfo->gjkSupportVertexIndex2;
+
         // Initialize the upper bound for the square distance
         decimal distSquare = DECIMAL_LARGEST;
 
+        // Start with the simplex of the previous test where the support points of both
+        // shapes have been moved to their current relative position
+        const uint8 nbPreviousSimplexPoints = lastFrameCollisionInfo->gjkNbSimplexPoints;
+        if (lastFrameCollisionInfo->isValid && lastFrameCollisionInfo->wasUsingGJK && nbPreviousSimplexPoints > 0 &&
+            isSameShapesSize) {
+
+            for (uint8 i=0; i < nbPreviousSimplexPoints; i++) {
+                suppA = lastFrameCollisionInfo->gjkSimplexSupportPoints1[i];
+                suppB = body2Tobody1 * lastFrameCollisionInfo->gjkSimplexSupportPoints2[i];
+                simplex.addPoint(suppA - suppB, suppA, suppB);
+            }
+
+            // If the simplex is degenerated with the new positions, we start with an empty simplex
+            Vector3 closestPoint;
+            if (!simplex.isAffinelyDependent() && simplex.computeClosestPoint(closestPoint) &&
+                closestPoint.lengthSquare() > MACHINE_EPSILON * simplex.getMaxLengthSquareOfAPoint()) {
+
+                v = closestPoint;
+                distSquare = v.lengthSquare();
+                statistics.nbGJKWarmStartedTests++;
+            }
+            else {
+                while (!simplex.isEmpty()) {
+                    simplex.removePoint(0);
+                }
+            }
+        }
+
         bool noIntersection = false;
 
         do {
 
             // Compute the support points for original objects (without margins) A and B
-            suppA = shape1->getLocalSupportPointWithoutMargin(-v);
-            suppB = body2Tobody1 * shape2->getLocalSupportPointWithoutMargin(rotateToBody2 * v);
+            suppA = computeSupportPoint(shape1, -v, supportVertexIndex1);
+            suppB = body2Tobody1 * computeSupportPoint(shape2, rotateToBody2 * v, supportVertexIndex2);
 
             // Compute the support point for the Minkowski difference A-B
             w = suppA - suppB;
@@ -127,7 +200,7 @@ void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uin
                 lastFrameCollisionInfo->gjkSeparatingAxis = v;
 
                 // No intersection, we return
-                assert(gjkResults.size() == batchIndex);
+                assert(gjkResults.size() == batchIndex - batchStartIndex);
                 gjkResults.add(GJKResult::SEPARATED);
                 noIntersection = true;
                 break;
@@ -180,6 +253,40 @@ void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uin
 
         } while(!simplex.isFull() && distSquare > MACHINE_EPSILON * simplex.getMaxLengthSquareOfAPoint());
 
+        // Cache the support vertices for frame coherence
+        lastFrameCollisionInfo->gjkSupportVertexIndex1 = supportVertexIndex1;
+        lastFrameCollisionInfo->gjkSupportVertexIndex2 = supportVertexIndex2;
+
+        // Cache the simplex (with the support points in the local-space of each shape) and a lower bound
+        // of the distance between the shapes if they are separated for frame coherence
+        lastFrameCollisionInfo->gjkNbSimplexPoints = 0;
+        lastFrameCollisionInfo->gjkSeparationGap = decimal(0.0);
+        lastFrameCollisionInfo->gjkBoundingRadius1 = boundingRadius1;
+        lastFrameCollisionInfo->gjkBoundingRadius2 = boundingRadius2;
+        if (noIntersection || contactFound) {
+
+            Vector3 simplexSupportPoints1[4];
+            Vector3 simplexSupportPoints2[4];
+            Vector3 simplexPoints[4];
+            const int nbSimplexPoints = simplex.getSimplex(simplexSupportPoints1, simplexSupportPoints2, simplexPoints);
+            if (nbSimplexPoints <= 3) {
+
+                const Transform body1ToBody2 = body2Tobody1.getInverse();
+                for (int i=0; i < nbSimplexPoints; i++) {
+                    lastFrameCollisionInfo->gjkSimplexSupportPoints1[i] = simplexSupportPoints1[i];
+                    lastFrameCollisionInfo->gjkSimplexSupportPoints2[i] = body1ToBody2 * simplexSupportPoints2[i];
+                }
+                lastFrameCollisionInfo->gjkNbSimplexPoints = static_cast<uint8>(nbSimplexPoints);
+            }
+
+            // The distance between the shapes (without margins) is at least the distance from the origin
+            // to the plane of the support point w with normal v
+            if (noIntersection) {
+                lastFrameCollisionInfo->gjkSeparationGap = vDotw / v.length() - margin;
+                lastFrameCollisionInfo->gjkSeparationShape2ToShape1 = body2Tobody1;
+            }
+        }
+
         if (noIntersection) {
             continue;
         }
@@ -202,14 +309,14 @@ void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uin
 
             // If the penetration depth is negative (due too numerical errors), there is no contact
             if (penetrationDepth <= decimal(0.0)) {
-                assert(gjkResults.size() == batchIndex);
+                assert(gjkResults.size() == batchIndex - batchStartIndex);
                 gjkResults.add(GJKResult::SEPARATED);
                 continue;
             }
 
             // Do not generate a contact point with zero normal length
             if (normal.lengthSquare() < MACHINE_EPSILON) {
-                assert(gjkResults.size() == batchIndex);
+                assert(gjkResults.size() == batchIndex - batchStartIndex);
                 gjkResults.add(GJKResult::SEPARATED);
                 continue;
             }
@@ -225,13 +332,46 @@ void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uin
                 narrowPhaseInfoBatch.addContactPoint(batchIndex, normal, penetrationDepth, pA, pB);
             }
 
-            assert(gjkResults.size() == batchIndex);
+            assert(gjkResults.size() == batchIndex - batchStartIndex);
             gjkResults.add(GJKResult::COLLIDE_IN_MARGIN);
 
             continue;
         }
 
-        assert(gjkResults.size() == batchIndex);
+        assert(gjkResults.size() == batchIndex - batchStartIndex);
         gjkResults.add(GJKResult::INTERPENETRATE);
     }
 }
+
+// Return a local support point of a shape (without margin) in a given direction
+/// The support vertex of a convex mesh is found with hill-climbing starting from its
+/// previous support vertex.
+/**
+ * @param shape Pointer to the convex shape
+ * @param direction Support direction in the local-space of the shape
+ * @param supportVertexIndex Previous support vertex of the shape (if it is a convex mesh)
+ *                           that is replaced by the new one
+ * @return The support point in the local-space of the shape
+ */
+Vector3 GJKAlgorithm::computeSupportPoint(const ConvexShape* shape, const Vector3& direction, uint& supportVertexIndex) {
+
+    if (shape->getName() == CollisionShapeName::CONVEX_MESH) {
+
+        const ConvexMeshShape* convexMesh = static_cast<const ConvexMeshShape*>(shape);
+        supportVertexIndex = convexMesh->getSupportVertexIndex(direction, supportVertexIndex);
+        return convexMesh->getVertexPosition(supportVertexIndex);
+    }
+
+    return shape->getLocalSupportPointWithoutMargin(direction);
+}
+
+// Return the radius of a sphere centered at the origin of the local-space of a shape that contains the shape
+decimal GJKAlgorithm::computeBoundingRadius(const ConvexShape* shape) {
+
+    Vector3 min;
+    Vector3 max;
+    shape->getLocalBounds(min, max);
+
+    return Vector3(std::max(std::abs(min.x), std::abs(max.x)), std::max(std::abs(min.y), std::abs(max.y)),
+                   std::max(std::abs(min.z), std::abs(max.z))).length();
+}
@@ -37,7 +37,7 @@ NarrowPhaseInfoBatch::NarrowPhaseInfoBatch(MemoryAllocator& allocator, Overlappi
       : mMemoryAllocator(allocator), mOverlappingPairs(overlappingPairs), overlappingPairIds(allocator),
         colliderEntities1(allocator), colliderEntities2(allocator), collisionShapes1(allocator), collisionShapes2(allocator),
         shape1ToWorldTransforms(allocator), shape2ToWorldTransforms(allocator), reportContacts(allocator),
-        isColliding(allocator), contactPoints(allocator), collisionShapeAllocators(allocator),
+        isColliding(allocator), contactPoints(allocator), contactPointsAllocators(allocator), collisionShapeAllocators(allocator),
         lastFrameCollisionInfos(allocator) {
 
 }
@@ -62,6 +62,7 @@ void NarrowPhaseInfoBatch::addNarrowPhaseInfo(uint64 pairId, uint64 pairIndex, E
     reportContacts.add(needToReportContacts);
     collisionShapeAllocators.add(&shapeAllocator);
     contactPoints.add(List<ContactPointInfo*>(mMemoryAllocator));
+    contactPointsAllocators.add(&mOverlappingPairs.getTemporaryAllocator());
     isColliding.add(false);
 
     // Add a collision info for the two collision shapes into the overlapping pair (if not present yet)
@@ -77,7 +78,7 @@ void NarrowPhaseInfoBatch::addContactPoint(uint index, const Vector3& contactNor
     assert(penDepth > decimal(0.0));
 
     // Get the memory allocator
-    MemoryAllocator& allocator = mOverlappingPairs.getTemporaryAllocator();
+    MemoryAllocator& allocator = *(contactPointsAllocators[index]);
 
     // Create the contact point info
     ContactPointInfo* contactPointInfo = new (allocator.allocate(sizeof(ContactPointInfo)))
@@ -91,7 +92,7 @@ void NarrowPhaseInfoBatch::addContactPoint(uint index, const Vector3& contactNor
 void NarrowPhaseInfoBatch::resetContactPoints(uint index) {
 
     // Get the memory allocator
-    MemoryAllocator& allocator = mOverlappingPairs.getTemporaryAllocator();
+    MemoryAllocator& allocator = *(contactPointsAllocators[index]);
 
     // For each remaining contact point info
     for (uint i=0; i < contactPoints[index].size(); i++) {
@@ -108,6 +109,27 @@ void NarrowPhaseInfoBatch::resetContactPoints(uint index) {
     contactPoints[index].clear();
 }
 
+// Set the memory allocator of the contact points of the items in a range of the batch
+/// The tasks of the parallel narrow-phase collision detection use this method so that the contact
+/// points (and the lists that contain them) of the items they test are allocated with the allocator
+/// of their own thread instead of an allocator shared with the other threads.
+void NarrowPhaseInfoBatch::setContactPointsAllocator(uint startIndex, uint endIndex, MemoryAllocator& allocator) {
+
+    assert(endIndex <= contactPoints.size());
+
+    for (uint i=startIndex; i < endIndex; i++) {
+
+        assert(contactPoints[i].size() == 0);
+
+        // The allocator of a list cannot be changed and therefore we replace the (empty) list
+        // of contact points of the item by a list that uses the new allocator
+        contactPoints[i].~List<ContactPointInfo*>();
+        new (&(contactPoints[i])) List<ContactPointInfo*>(allocator);
+
+        contactPointsAllocators[i] = &allocator;
+    }
+}
+
 // Initialize the containers using cached capacity
 void NarrowPhaseInfoBatch::reserveMemory() {
 
@@ -123,6 +145,7 @@ void NarrowPhaseInfoBatch::reserveMemory() {
     lastFrameCollisionInfos.reserve(mCachedCapacity);
     isColliding.reserve(mCachedCapacity);
     contactPoints.reserve(mCachedCapacity);
+    contactPointsAllocators.reserve(mCachedCapacity);
 }
 
 // Clear all the objects in the batch
@@ -163,4 +186,5 @@ void NarrowPhaseInfoBatch::clear() {
     lastFrameCollisionInfos.clear(true);
     isColliding.clear(true);
     contactPoints.clear(true);
+    contactPointsAllocators.clear(true);
 }
@@ -27,6 +27,7 @@
 #include <reactphysics3d/collision/narrowphase/SAT/SATAlgorithm.h>
 #include <reactphysics3d/constraint/ContactPoint.h>
 #include <reactphysics3d/collision/PolyhedronMesh.h>
+#include <reactphysics3d/collision/ConvexPolyhedronArrays.h>
 #include <reactphysics3d/collision/shapes/CapsuleShape.h>
 #include <reactphysics3d/collision/shapes/SphereShape.h>
 #include <reactphysics3d/engine/OverlappingPairs.h>
@@ -34,6 +35,7 @@
 #include <reactphysics3d/collision/shapes/TriangleShape.h>
 #include <reactphysics3d/configuration.h>
 #include <reactphysics3d/utils/Profiler.h>
+#include <reactphysics3d/mathematics/SimdDecimal.h>
 #include <cassert>
 
 // We want to use the ReactPhysics3D namespace
@@ -43,6 +45,27 @@ using namespace reactphysics3d;
 const decimal SATAlgorithm::SEPARATING_AXIS_RELATIVE_TOLERANCE = decimal(1.002);
 const decimal SATAlgorithm::SEPARATING_AXIS_ABSOLUTE_TOLERANCE = decimal(0.0005);
 
+// Rotate the vectors of the SIMD lanes with a quaternion
+/// The operations are the ones of Quaternion::operator*(const Vector3&) so that the result
+/// in each lane is exactly the rotation of the vector of the lane with the quaternion
+static inline void rotateVectors(const Quaternion& quaternion, const SimdDecimal& pointX, const SimdDecimal& pointY,
+                                 const SimdDecimal& pointZ, SimdDecimal& outX, SimdDecimal& outY, SimdDecimal& outZ) {
+
+    const SimdDecimal w = SimdDecimal(quaternion.w);
+    const SimdDecimal x = SimdDecimal(quaternion.x);
+    const SimdDecimal y = SimdDecimal(quaternion.y);
+    const SimdDecimal z = SimdDecimal(quaternion.z);
+    const SimdDecimal minusX = SimdDecimal(-quaternion.x);
+
+    const SimdDecimal prodX = w * pointX + y * pointZ - z * pointY;
+    const SimdDecimal prodY = w * pointY + z * pointX - x * pointZ;
+    const SimdDecimal prodZ = w * pointZ + x * pointY - y * pointX;
+    const SimdDecimal prodW = minusX * pointX - y * pointY - z * pointZ;
+    outX = w * prodX - prodY * z + prodZ * y - prodW * x;
+    outY = w * prodY - prodZ * x + prodX * z - prodW * y;
+    outZ = w * prodZ - prodX * y + prodY * x - prodW * z;
+}
+
 // Constructor
 SATAlgorithm::SATAlgorithm(bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& memoryAllocator)
              : mClipWithPreviousAxisIfStillColliding(clipWithPreviousAxisIfStillColliding), mMemoryAllocator(memoryAllocator) {
@@ -741,6 +764,15 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
 
         bool separatingAxisFound = false;
 
+        const Vector3 polyhedron1Centroid = polyhedron1ToPolyhedron2 * polyhedron1->getCentroid();
+        const Vector3 polyhedron2Centroid = polyhedron2->getCentroid();
+
+        // If the polyhedron 2 has arrays of edges, its edges are tested SIMD_DECIMAL_NB_LANES at a time
+        Vector3 polyhedron2Scale;
+        const ConvexPolyhedronArrays* polyhedron2Arrays = polyhedron2->getPolyhedronArrays(polyhedron2Scale);
+        bool areMinkowskiFaces[SIMD_DECIMAL_NB_LANES];
+        decimal edgesPenetrationDepths[SIMD_DECIMAL_NB_LANES];
+
         // Test the cross products of edges of polyhedron 1 with edges of polyhedron 2 for separating axis
         for (uint i=0; i < polyhedron1->getNbHalfEdges(); i += 2) {
 
@@ -751,25 +783,57 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
             const Vector3 edge1B = polyhedron1ToPolyhedron2 * polyhedron1->getVertexPosition(polyhedron1->getHalfEdge(edge1.nextEdgeIndex).vertexIndex);
             const Vector3 edge1Direction = edge1B - edge1A;
 
+            // Compute the adjacent face normals and the direction of the edge of polyhedron 1
+            // for the minkowski face tests (as in testEdgesBuildMinkowskiFace())
+            Vector3 a, b, bCrossA;
+            if (polyhedron2Arrays != nullptr) {
+                const HalfEdgeStructure::Edge& twinEdge1 = polyhedron1->getHalfEdge(edge1.twinEdgeIndex);
+                a = polyhedron1ToPolyhedron2.getOrientation() * polyhedron1->getFaceNormal(edge1.faceIndex);
+                b = polyhedron1ToPolyhedron2.getOrientation() * polyhedron1->getFaceNormal(twinEdge1.faceIndex);
+                bCrossA = polyhedron1ToPolyhedron2.getOrientation() * (polyhedron1->getVertexPosition(edge1.vertexIndex) -
+                                                                       polyhedron1->getVertexPosition(twinEdge1.vertexIndex));
+            }
+
             for (uint j=0; j < polyhedron2->getNbHalfEdges(); j += 2) {
 
-                // Get an edge of polyhedron 2
-                const HalfEdgeStructure::Edge& edge2 = polyhedron2->getHalfEdge(j);
+                bool isMinkowskiFace;
+                decimal penetrationDepth = DECIMAL_LARGEST;
+                Vector3 separatingAxisPolyhedron2Space;
 
-                const Vector3 edge2A = polyhedron2->getVertexPosition(edge2.vertexIndex);
-                const Vector3 edge2B = polyhedron2->getVertexPosition(polyhedron2->getHalfEdge(edge2.nextEdgeIndex).vertexIndex);
-                const Vector3 edge2Direction = edge2B - edge2A;
+                if (polyhedron2Arrays != nullptr) {
 
-                // If the two edges build a minkowski face (and the cross product is
-                // therefore a candidate for separating axis
-                if (testEdgesBuildMinkowskiFace(polyhedron1, edge1, polyhedron2, edge2, polyhedron1ToPolyhedron2)) {
+                    // Test the next SIMD_DECIMAL_NB_LANES edges of polyhedron 2 at once
+                    const uint edge2Index = j / 2;
+                    const uint lane = edge2Index % SIMD_DECIMAL_NB_LANES;
+                    if (lane == 0) {
+                        testEdgesPolyhedronVsPolyhedronSimd(a, b, bCrossA, edge1A, edge1Direction, polyhedron1Centroid,
+                                                            polyhedron2Centroid, isShape1Triangle, *polyhedron2Arrays,
+                                                            polyhedron2Scale, edge2Index, areMinkowskiFaces, edgesPenetrationDepths);
+                    }
 
-                    Vector3 separatingAxisPolyhedron2Space;
+                    isMinkowskiFace = areMinkowskiFaces[lane];
+                    penetrationDepth = edgesPenetrationDepths[lane];
+                }
+                else {
 
-                    // Compute the penetration depth
-                    const Vector3 polyhedron1Centroid = polyhedron1ToPolyhedron2 * polyhedron1->getCentroid();
-                    decimal penetrationDepth = computeDistanceBetweenEdges(edge1A, edge2A, polyhedron1Centroid, polyhedron2->getCentroid(),
-                               edge1Direction, edge2Direction, isShape1Triangle, separatingAxisPolyhedron2Space);
+                    // Get an edge of polyhedron 2
+                    const HalfEdgeStructure::Edge& edge2 = polyhedron2->getHalfEdge(j);
+
+                    // If the two edges build a minkowski face (and the cross product is
+                    // therefore a candidate for separating axis
+                    isMinkowskiFace = testEdgesBuildMinkowskiFace(polyhedron1, edge1, polyhedron2, edge2, polyhedron1ToPolyhedron2);
+                    if (isMinkowskiFace) {
+
+                        const Vector3 edge2A = polyhedron2->getVertexPosition(edge2.vertexIndex);
+                        const Vector3 edge2B = polyhedron2->getVertexPosition(polyhedron2->getHalfEdge(edge2.nextEdgeIndex).vertexIndex);
+
+                        // Compute the penetration depth
+                        penetrationDepth = computeDistanceBetweenEdges(edge1A, edge2A, polyhedron1Centroid, polyhedron2Centroid,
+                                   edge1Direction, edge2B - edge2A, isShape1Triangle, separatingAxisPolyhedron2Space);
+                    }
+                }
+
+                if (isMinkowskiFace) {
 
                     if (penetrationDepth <= decimal(0.0)) {
 
@@ -793,6 +857,17 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
                     if ((isMinPenetrationFaceNormal && penetrationDepth1 * SEPARATING_AXIS_RELATIVE_TOLERANCE + SEPARATING_AXIS_ABSOLUTE_TOLERANCE < minPenetrationDepth) ||
                         (!isMinPenetrationFaceNormal && penetrationDepth < minPenetrationDepth)) {
 
+                        const HalfEdgeStructure::Edge& edge2 = polyhedron2->getHalfEdge(j);
+                        const Vector3 edge2A = polyhedron2->getVertexPosition(edge2.vertexIndex);
+                        const Vector3 edge2B = polyhedron2->getVertexPosition(polyhedron2->getHalfEdge(edge2.nextEdgeIndex).vertexIndex);
+
+                        // The SIMD test of the edges does not return the separating axis. It is computed
+                        // again here (with the same result) for the new minimum penetration axis
+                        if (polyhedron2Arrays != nullptr) {
+                            computeDistanceBetweenEdges(edge1A, edge2A, polyhedron1Centroid, polyhedron2Centroid,
+                                                        edge1Direction, edge2B - edge2A, isShape1Triangle, separatingAxisPolyhedron2Space);
+                        }
+
                         minPenetrationDepth = penetrationDepth;
                         isMinPenetrationFaceNormalPolyhedron1 = false;
                         isMinPenetrationFaceNormal = false;
@@ -1085,6 +1160,14 @@ decimal SATAlgorithm::testFacesDirectionPolyhedronVsPolyhedron(const ConvexPolyh
 
     RP3D_PROFILE("SATAlgorithm::testFacesDirectionPolyhedronVsPolyhedron", mProfiler);
 
+    // If the polyhedron 1 has arrays of faces, its faces are tested SIMD_DECIMAL_NB_LANES at a time
+    Vector3 polyhedron1Scale;
+    const ConvexPolyhedronArrays* polyhedron1Arrays = polyhedron1->getPolyhedronArrays(polyhedron1Scale);
+    if (polyhedron1Arrays != nullptr) {
+        return testFacesDirectionPolyhedronVsPolyhedronSimd(*polyhedron1Arrays, polyhedron1Scale, polyhedron2,
+                                                            polyhedron1ToPolyhedron2, minFaceIndex);
+    }
+
     decimal minPenetrationDepth = DECIMAL_LARGEST;
 
     // For each face of the first polyhedron
@@ -1109,6 +1192,178 @@ decimal SATAlgorithm::testFacesDirectionPolyhedronVsPolyhedron(const ConvexPolyh
     return minPenetrationDepth;
 }
 
+// Test all the normals of a polyhedron for separating axis with SIMD instructions in the polyhedron vs polyhedron case
+/// The penetration depths along SIMD_DECIMAL_NB_LANES face normals of the first polyhedron are computed at once.
+/// The operations in each lane are the ones of testSingleFaceDirectionPolyhedronVsPolyhedron() and the faces are
+/// then processed in order as in testFacesDirectionPolyhedronVsPolyhedron(). Therefore, the results are the same.
+decimal SATAlgorithm::testFacesDirectionPolyhedronVsPolyhedronSimd(const ConvexPolyhedronArrays& polyhedron1Arrays,
+                                                                   const Vector3& polyhedron1Scale,
+                                                                   const ConvexPolyhedronShape* polyhedron2,
+                                                                   const Transform& polyhedron1ToPolyhedron2,
+                                                                   uint& minFaceIndex) const {
+
+    RP3D_PROFILE("SATAlgorithm::testFacesDirectionPolyhedronVsPolyhedronSimd", mProfiler);
+
+    const uint nbFaces = polyhedron1Arrays.getNbFaces();
+    const uint nbPaddedFaces = polyhedron1Arrays.getNbPaddedFaces();
+    const decimal* facesNormals = polyhedron1Arrays.getFacesNormals();
+    const decimal* facesVertices = polyhedron1Arrays.getFacesVertices();
+    const Quaternion& orientation = polyhedron1ToPolyhedron2.getOrientation();
+    const Vector3& position = polyhedron1ToPolyhedron2.getPosition();
+
+    decimal supportDirections[3 * SIMD_DECIMAL_NB_LANES];
+    decimal supportPoints[3 * SIMD_DECIMAL_NB_LANES];
+    decimal penetrationDepths[SIMD_DECIMAL_NB_LANES];
+
+    decimal minPenetrationDepth = DECIMAL_LARGEST;
+
+    // For each group of SIMD_DECIMAL_NB_LANES faces of the first polyhedron
+    for (uint f = 0; f < nbPaddedFaces; f += SIMD_DECIMAL_NB_LANES) {
+
+        // Convert the face normals into the local-space of polyhedron 2
+        SimdDecimal normalX, normalY, normalZ;
+        rotateVectors(orientation, SimdDecimal::load(facesNormals + f), SimdDecimal::load(facesNormals + nbPaddedFaces + f),
+                      SimdDecimal::load(facesNormals + 2 * nbPaddedFaces + f), normalX, normalY, normalZ);
+
+        // Get the support points of polyhedron 2 in the inverse directions of the face normals
+        (-normalX).store(supportDirections);
+        (-normalY).store(supportDirections + SIMD_DECIMAL_NB_LANES);
+        (-normalZ).store(supportDirections + 2 * SIMD_DECIMAL_NB_LANES);
+        polyhedron2->getLocalSupportPointsWithoutMargin(supportDirections, SIMD_DECIMAL_NB_LANES, supportPoints);
+
+        // Convert the face vertices into the local-space of polyhedron 2
+        SimdDecimal vertexX, vertexY, vertexZ;
+        rotateVectors(orientation, SimdDecimal::load(facesVertices + f) * SimdDecimal(polyhedron1Scale.x),
+                      SimdDecimal::load(facesVertices + nbPaddedFaces + f) * SimdDecimal(polyhedron1Scale.y),
+                      SimdDecimal::load(facesVertices + 2 * nbPaddedFaces + f) * SimdDecimal(polyhedron1Scale.z),
+                      vertexX, vertexY, vertexZ);
+        vertexX += SimdDecimal(position.x);
+        vertexY += SimdDecimal(position.y);
+        vertexZ += SimdDecimal(position.z);
+
+        // Compute the penetration depths
+        const SimdDecimal depths = (vertexX - SimdDecimal::load(supportPoints)) * normalX +
+                                   (vertexY - SimdDecimal::load(supportPoints + SIMD_DECIMAL_NB_LANES)) * normalY +
+                                   (vertexZ - SimdDecimal::load(supportPoints + 2 * SIMD_DECIMAL_NB_LANES)) * normalZ;
+        depths.store(penetrationDepths);
+
+        for (uint l = 0; l < SIMD_DECIMAL_NB_LANES && f + l < nbFaces; l++) {
+
+            // If the penetration depth is negative, we have found a separating axis
+            if (penetrationDepths[l] <= decimal(0.0)) {
+                minFaceIndex = f + l;
+                return penetrationDepths[l];
+            }
+
+            // Check if we have found a new minimum penetration axis
+            if (penetrationDepths[l] < minPenetrationDepth) {
+                minPenetrationDepth = penetrationDepths[l];
+                minFaceIndex = f + l;
+            }
+        }
+    }
+
+    return minPenetrationDepth;
+}
+
+// Test an edge of the first polyhedron against SIMD_DECIMAL_NB_LANES edges of the second polyhedron with SIMD instructions
+/// The edges of the second polyhedron start at index "firstEdgeIndex" in its arrays of edges (the edge with index
+/// "e" in the arrays is the half-edge "2 * e" of the polyhedron). For each of those edges, the method returns if the
+/// two edges build a minkowski face and the penetration depth along the cross product of the edges. The operations
+/// in each lane are the ones of testEdgesBuildMinkowskiFace() and computeDistanceBetweenEdges() so that the results
+/// are the same. The vectors "a", "b" and "bCrossA" are the normals of the adjacent faces and the direction of the
+/// edge of the first polyhedron (in the local-space of polyhedron 2) computed as in testEdgesBuildMinkowskiFace().
+void SATAlgorithm::testEdgesPolyhedronVsPolyhedronSimd(const Vector3& a, const Vector3& b, const Vector3& bCrossA,
+                                                       const Vector3& edge1A, const Vector3& edge1Direction,
+                                                       const Vector3& polyhedron1Centroid, const Vector3& polyhedron2Centroid,
+                                                       bool isShape1Triangle, const ConvexPolyhedronArrays& polyhedron2Arrays,
+                                                       const Vector3& polyhedron2Scale, uint firstEdgeIndex,
+                                                       bool* outIsMinkowskiFace, decimal* outPenetrationDepths) const {
+
+    RP3D_PROFILE("SATAlgorithm::testEdgesPolyhedronVsPolyhedronSimd", mProfiler);
+
+    assert(firstEdgeIndex % SIMD_DECIMAL_NB_LANES == 0);
+    assert(firstEdgeIndex < polyhedron2Arrays.getNbPaddedEdges());
+
+    const uint nbPaddedEdges = polyhedron2Arrays.getNbPaddedEdges();
+    const decimal* vertices1 = polyhedron2Arrays.getEdgesVertices1() + firstEdgeIndex;
+    const decimal* vertices2 = polyhedron2Arrays.getEdgesVertices2() + firstEdgeIndex;
+    const decimal* facesNormals1 = polyhedron2Arrays.getEdgesFacesNormals1() + firstEdgeIndex;
+    const decimal* facesNormals2 = polyhedron2Arrays.getEdgesFacesNormals2() + firstEdgeIndex;
+
+    const SimdDecimal zero = SimdDecimal(decimal(0.0));
+    const SimdDecimal one = SimdDecimal(decimal(1.0));
+
+    // Vertices of the edges of polyhedron 2
+    const SimdDecimal edge2AX = SimdDecimal::load(vertices1) * SimdDecimal(polyhedron2Scale.x);
+    const SimdDecimal edge2AY = SimdDecimal::load(vertices1 + nbPaddedEdges) * SimdDecimal(polyhedron2Scale.y);
+    const SimdDecimal edge2AZ = SimdDecimal::load(vertices1 + 2 * nbPaddedEdges) * SimdDecimal(polyhedron2Scale.z);
+    const SimdDecimal edge2BX = SimdDecimal::load(vertices2) * SimdDecimal(polyhedron2Scale.x);
+    const SimdDecimal edge2BY = SimdDecimal::load(vertices2 + nbPaddedEdges) * SimdDecimal(polyhedron2Scale.y);
+    const SimdDecimal edge2BZ = SimdDecimal::load(vertices2 + 2 * nbPaddedEdges) * SimdDecimal(polyhedron2Scale.z);
+
+    // Test if the two arcs of the Gauss Map intersect (therefore forming a minkowski face). The
+    // normals of the second polyhedron are negated as in testEdgesBuildMinkowskiFace()
+    const SimdDecimal cX = -SimdDecimal::load(facesNormals1);
+    const SimdDecimal cY = -SimdDecimal::load(facesNormals1 + nbPaddedEdges);
+    const SimdDecimal cZ = -SimdDecimal::load(facesNormals1 + 2 * nbPaddedEdges);
+    const SimdDecimal dX = -SimdDecimal::load(facesNormals2);
+    const SimdDecimal dY = -SimdDecimal::load(facesNormals2 + nbPaddedEdges);
+    const SimdDecimal dZ = -SimdDecimal::load(facesNormals2 + 2 * nbPaddedEdges);
+    const SimdDecimal dCrossCX = edge2AX - edge2BX;
+    const SimdDecimal dCrossCY = edge2AY - edge2BY;
+    const SimdDecimal dCrossCZ = edge2AZ - edge2BZ;
+
+    const SimdDecimal cba = cX * SimdDecimal(bCrossA.x) + cY * SimdDecimal(bCrossA.y) + cZ * SimdDecimal(bCrossA.z);
+    const SimdDecimal dba = dX * SimdDecimal(bCrossA.x) + dY * SimdDecimal(bCrossA.y) + dZ * SimdDecimal(bCrossA.z);
+    const SimdDecimal adc = SimdDecimal(a.x) * dCrossCX + SimdDecimal(a.y) * dCrossCY + SimdDecimal(a.z) * dCrossCZ;
+    const SimdDecimal bdc = SimdDecimal(b.x) * dCrossCX + SimdDecimal(b.y) * dCrossCY + SimdDecimal(b.z) * dCrossCZ;
+
+    // One if (cba * dba < 0 && adc * bdc < 0 && cba * bdc > 0) and zero otherwise
+    const SimdDecimal isMinkowskiFace = SimdDecimal::selectGreater(zero, cba * dba,
+                                            SimdDecimal::selectGreater(zero, adc * bdc,
+                                                SimdDecimal::selectGreater(cba * bdc, zero, one, zero), zero), zero);
+
+    // Compute the candidate separating axis (cross product between two polyhedrons edges)
+    const SimdDecimal edge2DirectionX = edge2BX - edge2AX;
+    const SimdDecimal edge2DirectionY = edge2BY - edge2AY;
+    const SimdDecimal edge2DirectionZ = edge2BZ - edge2AZ;
+    const SimdDecimal crossX = SimdDecimal(edge1Direction.y) * edge2DirectionZ - SimdDecimal(edge1Direction.z) * edge2DirectionY;
+    const SimdDecimal crossY = SimdDecimal(edge1Direction.z) * edge2DirectionX - SimdDecimal(edge1Direction.x) * edge2DirectionZ;
+    const SimdDecimal crossZ = SimdDecimal(edge1Direction.x) * edge2DirectionY - SimdDecimal(edge1Direction.y) * edge2DirectionX;
+    const SimdDecimal crossLengthSquare = crossX * crossX + crossY * crossY + crossZ * crossZ;
+    const SimdDecimal crossLengthInv = one / SimdDecimal::sqrt(crossLengthSquare);
+    SimdDecimal axisX = crossX * crossLengthInv;
+    SimdDecimal axisY = crossY * crossLengthInv;
+    SimdDecimal axisZ = crossZ * crossLengthInv;
+
+    // Make sure the axis direction is going from first to second polyhedron
+    SimdDecimal dotProd;
+    if (isShape1Triangle) {
+        dotProd = axisX * (edge2AX - SimdDecimal(polyhedron2Centroid.x)) + axisY * (edge2AY - SimdDecimal(polyhedron2Centroid.y)) +
+                  axisZ * (edge2AZ - SimdDecimal(polyhedron2Centroid.z));
+    }
+    else {
+        const Vector3 edge1AToCentroid1 = polyhedron1Centroid - edge1A;
+        dotProd = axisX * SimdDecimal(edge1AToCentroid1.x) + axisY * SimdDecimal(edge1AToCentroid1.y) +
+                  axisZ * SimdDecimal(edge1AToCentroid1.z);
+    }
+    axisX = SimdDecimal::selectGreater(dotProd, zero, -axisX, axisX);
+    axisY = SimdDecimal::selectGreater(dotProd, zero, -axisY, axisY);
+    axisZ = SimdDecimal::selectGreater(dotProd, zero, -axisZ, axisZ);
+
+    // Compute the distance between the edges (a large penetration depth for parallel edges to skip them)
+    const SimdDecimal distances = -(axisX * (edge2AX - SimdDecimal(edge1A.x)) + axisY * (edge2AY - SimdDecimal(edge1A.y)) +
+                                    axisZ * (edge2AZ - SimdDecimal(edge1A.z)));
+    SimdDecimal::selectGreater(SimdDecimal(decimal(0.00001)), crossLengthSquare, SimdDecimal(DECIMAL_LARGEST), distances)
+            .store(outPenetrationDepths);
+
+    decimal areMinkowskiFaces[SIMD_DECIMAL_NB_LANES];
+    isMinkowskiFace.store(areMinkowskiFaces);
+    for (uint32 l=0; l < SIMD_DECIMAL_NB_LANES; l++) {
+        outIsMinkowskiFace[l] = areMinkowskiFaces[l] != decimal(0.0);
+    }
+}
 
 // Return true if two edges of two polyhedrons build a minkowski face (and can therefore be a separating axis)
 bool SATAlgorithm::testEdgesBuildMinkowskiFace(const ConvexPolyhedronShape* polyhedron1, const HalfEdgeStructure::Edge& edge1,
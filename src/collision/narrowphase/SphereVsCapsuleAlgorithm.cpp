@@ -28,119 +28,172 @@
 #include <reactphysics3d/collision/shapes/SphereShape.h>
 #include <reactphysics3d/collision/shapes/CapsuleShape.h>
 #include <reactphysics3d/collision/narrowphase/SphereVsCapsuleNarrowPhaseInfoBatch.h>
+#include <reactphysics3d/mathematics/SimdVector3.h>
 
 // We want to use the ReactPhysics3D namespace
 using namespace reactphysics3d;  
 
-// Compute the narrow-phase collision detection between a sphere and a capsule
-// This technique is based on the "Robust Contact Creation for Physics Simulations" presentation
-// by Dirk Gregorius.
+// Compute the narrow-phase collision detection between the sphere and capsule pairs of a batch
 bool SphereVsCapsuleAlgorithm::testCollision(SphereVsCapsuleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchStartIndex, uint batchNbItems,
                                              MemoryAllocator& memoryAllocator) {
 
     bool isCollisionFound = false;
 
-    for (uint batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
+    const uint batchEndIndex = batchStartIndex + batchNbItems;
+    const SimdDecimal toleranceFactor(decimal(1.0) + NARROW_PHASE_SIMD_OVERLAP_TOLERANCE);
+    decimal overlapLanes[SIMD_DECIMAL_NB_LANES];
+
+    // For each group of SIMD_DECIMAL_NB_LANES items in the batch
+    uint batchIndex = batchStartIndex;
+    for (; batchIndex + SIMD_DECIMAL_NB_LANES <= batchEndIndex; batchIndex += SIMD_DECIMAL_NB_LANES) {
+
+        const SimdVector3 sphereCenters(SimdDecimal::load(&narrowPhaseInfoBatch.sphereCentersX[batchIndex]),
+                                        SimdDecimal::load(&narrowPhaseInfoBatch.sphereCentersY[batchIndex]),
+                                        SimdDecimal::load(&narrowPhaseInfoBatch.sphereCentersZ[batchIndex]));
+        const SimdVector3 capsuleCenters(SimdDecimal::load(&narrowPhaseInfoBatch.capsuleCentersX[batchIndex]),
+                                         SimdDecimal::load(&narrowPhaseInfoBatch.capsuleCentersY[batchIndex]),
+                                         SimdDecimal::load(&narrowPhaseInfoBatch.capsuleCentersZ[batchIndex]));
+        const SimdVector3 capsuleAxes(SimdDecimal::load(&narrowPhaseInfoBatch.capsuleAxesX[batchIndex]),
+                                      SimdDecimal::load(&narrowPhaseInfoBatch.capsuleAxesY[batchIndex]),
+                                      SimdDecimal::load(&narrowPhaseInfoBatch.capsuleAxesZ[batchIndex]));
+        const SimdDecimal capsuleHalfHeights = SimdDecimal::load(&narrowPhaseInfoBatch.capsuleHeights[batchIndex]) * SimdDecimal(decimal(0.5));
+
+        // Compute the vectors from the closest points on the capsule inner segments to the sphere centers
+        const SimdVector3 capsuleCenterToSphereCenter = sphereCenters - capsuleCenters;
+        const SimdDecimal segmentParameters = SimdDecimal::min(SimdDecimal::max(capsuleCenterToSphereCenter.dot(capsuleAxes),
+                                                                                -capsuleHalfHeights), capsuleHalfHeights);
+        const SimdVector3 segmentToSphereCenter = capsuleCenterToSphereCenter - capsuleAxes * segmentParameters;
+
+        // Compute the sums of the radiuses (increased by the tolerance of the test)
+        const SimdDecimal sumRadiuses = (SimdDecimal::load(&narrowPhaseInfoBatch.sphereRadiuses[batchIndex]) +
+                                         SimdDecimal::load(&narrowPhaseInfoBatch.capsuleRadiuses[batchIndex])) * toleranceFactor;
+
+        // A lane is positive if the two shapes may overlap
+        (sumRadiuses * sumRadiuses - segmentToSphereCenter.lengthSquare()).store(overlapLanes);
+
+        // Compute the contacts of the pairs that may overlap
+        for (uint32 lane = 0; lane < SIMD_DECIMAL_NB_LANES; lane++) {
+
+            assert(!narrowPhaseInfoBatch.isColliding[batchIndex + lane]);
+            assert(narrowPhaseInfoBatch.contactPoints[batchIndex + lane].size() == 0);
+
+            if (overlapLanes[lane] > decimal(0.0)) {
+                isCollisionFound |= testCollisionPair(narrowPhaseInfoBatch, batchIndex + lane);
+            }
+        }
+    }
 
-        assert(!narrowPhaseInfoBatch.isColliding[batchIndex]);
-        assert(narrowPhaseInfoBatch.contactPoints[batchIndex].size() == 0);
+    // For each remaining item in the batch
+    for (; batchIndex < batchEndIndex; batchIndex++) {
+        isCollisionFound |= testCollisionPair(narrowPhaseInfoBatch, batchIndex);
+    }
 
-        const bool isSphereShape1 = narrowPhaseInfoBatch.isSpheresShape1[batchIndex];
+    return isCollisionFound;
+}
 
-        // Get the transform from sphere local-space to capsule local-space
-        const Transform& sphereToWorldTransform = isSphereShape1 ? narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex] : narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex];
-        const Transform& capsuleToWorldTransform = isSphereShape1 ? narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex] : narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex];
-        const Transform worldToCapsuleTransform = capsuleToWorldTransform.getInverse();
-        const Transform sphereToCapsuleSpaceTransform = worldToCapsuleTransform * sphereToWorldTransform;
+// Compute the narrow-phase collision detection between a sphere and a capsule
+// This technique is based on the "Robust Contact Creation for Physics Simulations" presentation
+// by Dirk Gregorius.
+bool SphereVsCapsuleAlgorithm::testCollisionPair(SphereVsCapsuleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchIndex) {
 
-        // Transform the center of the sphere into the local-space of the capsule shape
-        const Vector3 sphereCenter = sphereToCapsuleSpaceTransform.getPosition();
+    assert(!narrowPhaseInfoBatch.isColliding[batchIndex]);
+    assert(narrowPhaseInfoBatch.contactPoints[batchIndex].size() == 0);
 
-        // Compute the end-points of the inner segment of the capsule
-        const decimal capsuleHalfHeight = narrowPhaseInfoBatch.capsuleHeights[batchIndex] * decimal(0.5);
-        const Vector3 capsuleSegA(0, -capsuleHalfHeight, 0);
-        const Vector3 capsuleSegB(0, capsuleHalfHeight, 0);
+    const bool isSphereShape1 = narrowPhaseInfoBatch.isSpheresShape1[batchIndex];
 
-        // Compute the point on the inner capsule segment that is the closes to center of sphere
-        const Vector3 closestPointOnSegment = computeClosestPointOnSegment(capsuleSegA, capsuleSegB, sphereCenter);
+    // Get the transform from sphere local-space to capsule local-space
+    const Transform& sphereToWorldTransform = isSphereShape1 ? narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex] : narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex];
+    const Transform& capsuleToWorldTransform = isSphereShape1 ? narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex] : narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex];
+    const Transform worldToCapsuleTransform = capsuleToWorldTransform.getInverse();
+    const Transform sphereToCapsuleSpaceTransform = worldToCapsuleTransform * sphereToWorldTransform;
 
-        // Compute the distance between the sphere center and the closest point on the segment
-        Vector3 sphereCenterToSegment = (closestPointOnSegment - sphereCenter);
-        const decimal sphereSegmentDistanceSquare = sphereCenterToSegment.lengthSquare();
+    // Transform the center of the sphere into the local-space of the capsule shape
+    const Vector3 sphereCenter = sphereToCapsuleSpaceTransform.getPosition();
 
-        // Compute the sum of the radius of the sphere and the capsule (virtual sphere)
-        decimal sumRadius = narrowPhaseInfoBatch.sphereRadiuses[batchIndex] + narrowPhaseInfoBatch.capsuleRadiuses[batchIndex];
+    // Compute the end-points of the inner segment of the capsule
+    const decimal capsuleHalfHeight = narrowPhaseInfoBatch.capsuleHeights[batchIndex] * decimal(0.5);
+    const Vector3 capsuleSegA(0, -capsuleHalfHeight, 0);
+    const Vector3 capsuleSegB(0, capsuleHalfHeight, 0);
 
-        // If the collision shapes overlap
-        if (sphereSegmentDistanceSquare < sumRadius * sumRadius) {
+    // Compute the point on the inner capsule segment that is the closes to center of sphere
+    const Vector3 closestPointOnSegment = computeClosestPointOnSegment(capsuleSegA, capsuleSegB, sphereCenter);
 
-            decimal penetrationDepth;
-            Vector3 normalWorld;
-            Vector3 contactPointSphereLocal;
-            Vector3 contactPointCapsuleLocal;
+    // Compute the distance between the sphere center and the closest point on the segment
+    Vector3 sphereCenterToSegment = (closestPointOnSegment - sphereCenter);
+    const decimal sphereSegmentDistanceSquare = sphereCenterToSegment.lengthSquare();
 
-            // If we need to report contacts
-            if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
+    // Compute the sum of the radius of the sphere and the capsule (virtual sphere)
+    decimal sumRadius = narrowPhaseInfoBatch.sphereRadiuses[batchIndex] + narrowPhaseInfoBatch.capsuleRadiuses[batchIndex];
 
-                // If the sphere center is not on the capsule inner segment
-                if (sphereSegmentDistanceSquare > MACHINE_EPSILON) {
+    // If the collision shapes overlap
+    if (sphereSegmentDistanceSquare < sumRadius * sumRadius) {
 
-                    decimal sphereSegmentDistance = std::sqrt(sphereSegmentDistanceSquare);
-                    sphereCenterToSegment /= sphereSegmentDistance;
+        decimal penetrationDepth;
+        Vector3 normalWorld;
+        Vector3 contactPointSphereLocal;
+        Vector3 contactPointCapsuleLocal;
 
-                    contactPointSphereLocal = sphereToCapsuleSpaceTransform.getInverse() * (sphereCenter + sphereCenterToSegment * narrowPhaseInfoBatch.sphereRadiuses[batchIndex]);
-                    contactPointCapsuleLocal = closestPointOnSegment - sphereCenterToSegment * narrowPhaseInfoBatch.capsuleRadiuses[batchIndex];
+        // If we need to report contacts
+        if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
 
-                    normalWorld = capsuleToWorldTransform.getOrientation() * sphereCenterToSegment;
+            // If the sphere center is not on the capsule inner segment
+            if (sphereSegmentDistanceSquare > MACHINE_EPSILON) {
 
-                    penetrationDepth = sumRadius - sphereSegmentDistance;
+                decimal sphereSegmentDistance = std::sqrt(sphereSegmentDistanceSquare);
+                sphereCenterToSegment /= sphereSegmentDistance;
 
-                    if (!isSphereShape1) {
-                        normalWorld = -normalWorld;
-                    }
-                }
-                else {  // If the sphere center is on the capsule inner segment (degenerate case)
+                contactPointSphereLocal = sphereToCapsuleSpaceTransform.getInverse() * (sphereCenter + sphereCenterToSegment * narrowPhaseInfoBatch.sphereRadiuses[batchIndex]);
+                contactPointCapsuleLocal = closestPointOnSegment - sphereCenterToSegment * narrowPhaseInfoBatch.capsuleRadiuses[batchIndex];
 
-                    // We take any direction that is orthogonal to the inner capsule segment as a contact normal
+                normalWorld = capsuleToWorldTransform.getOrientation() * sphereCenterToSegment;
 
-                    // Capsule inner segment
-                    Vector3 capsuleSegment = (capsuleSegB - capsuleSegA).getUnit();
+                penetrationDepth = sumRadius - sphereSegmentDistance;
 
-                    Vector3 vec1(1, 0, 0);
-                    Vector3 vec2(0, 1, 0);
+                if (!isSphereShape1) {
+                    normalWorld = -normalWorld;
+                }
+            }
+            else {  // If the sphere center is on the capsule inner segment (degenerate case)
 
-                    // Get the vectors (among vec1 and vec2) that is the most orthogonal to the capsule inner segment (smallest absolute dot product)
-                    decimal cosA1 = std::abs(capsuleSegment.x);		// abs(vec1.dot(seg2))
-                    decimal cosA2 = std::abs(capsuleSegment.y);	    // abs(vec2.dot(seg2))
+                // We take any direction that is orthogonal to the inner capsule segment as a contact normal
 
-                    penetrationDepth = sumRadius;
+                // Capsule inner segment
+                Vector3 capsuleSegment = (capsuleSegB - capsuleSegA).getUnit();
 
-                    // We choose as a contact normal, any direction that is perpendicular to the inner capsule segment
-                    Vector3 normalCapsuleSpace = cosA1 < cosA2 ? capsuleSegment.cross(vec1) : capsuleSegment.cross(vec2);
-                    normalWorld = capsuleToWorldTransform.getOrientation() * normalCapsuleSpace;
+                Vector3 vec1(1, 0, 0);
+                Vector3 vec2(0, 1, 0);
 
-                    // Compute the two local contact points
-                    contactPointSphereLocal = sphereToCapsuleSpaceTransform.getInverse() * (sphereCenter + normalCapsuleSpace * narrowPhaseInfoBatch.sphereRadiuses[batchIndex]);
-                    contactPointCapsuleLocal = sphereCenter - normalCapsuleSpace * narrowPhaseInfoBatch.capsuleRadiuses[batchIndex];
-                }
+                // Get the vectors (among vec1 and vec2) that is the most orthogonal to the capsule inner segment (smallest absolute dot product)
+                decimal cosA1 = std::abs(capsuleSegment.x);		// abs(vec1.dot(seg2))
+                decimal cosA2 = std::abs(capsuleSegment.y);	    // abs(vec2.dot(seg2))
 
-                if (penetrationDepth <= decimal(0.0)) {
+                penetrationDepth = sumRadius;
 
-                    // No collision
-                    continue;
-                }
+                // We choose as a contact normal, any direction that is perpendicular to the inner capsule segment
+                Vector3 normalCapsuleSpace = cosA1 < cosA2 ? capsuleSegment.cross(vec1) : capsuleSegment.cross(vec2);
+                normalWorld = capsuleToWorldTransform.getOrientation() * normalCapsuleSpace;
 
-                // Create the contact info object
-                narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth,
-                                                 isSphereShape1 ? contactPointSphereLocal : contactPointCapsuleLocal,
-                                                 isSphereShape1 ? contactPointCapsuleLocal : contactPointSphereLocal);
+                // Compute the two local contact points
+                contactPointSphereLocal = sphereToCapsuleSpaceTransform.getInverse() * (sphereCenter + normalCapsuleSpace * narrowPhaseInfoBatch.sphereRadiuses[batchIndex]);
+                contactPointCapsuleLocal = sphereCenter - normalCapsuleSpace * narrowPhaseInfoBatch.capsuleRadiuses[batchIndex];
             }
 
-            narrowPhaseInfoBatch.isColliding[batchIndex] = true;
-            isCollisionFound = true;
-            continue;
+            if (penetrationDepth <= decimal(0.0)) {
+
+                // No collision
+                return false;
+            }
+
+            // Create the contact info object
+            narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth,
+                                             isSphereShape1 ? contactPointSphereLocal : contactPointCapsuleLocal,
+                                             isSphereShape1 ? contactPointCapsuleLocal : contactPointSphereLocal);
         }
+
+        narrowPhaseInfoBatch.isColliding[batchIndex] = true;
+
+        return true;
     }
 
-    return isCollisionFound;
+    return false;
 }
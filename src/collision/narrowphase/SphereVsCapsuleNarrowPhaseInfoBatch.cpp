@@ -34,7 +34,9 @@ using namespace reactphysics3d;
 SphereVsCapsuleNarrowPhaseInfoBatch::SphereVsCapsuleNarrowPhaseInfoBatch(MemoryAllocator& allocator,
                                                                          OverlappingPairs& overlappingPairs)
       : NarrowPhaseInfoBatch(allocator, overlappingPairs), isSpheresShape1(allocator), sphereRadiuses(allocator), capsuleRadiuses(allocator),
-        capsuleHeights(allocator) {
+        capsuleHeights(allocator), sphereCentersX(allocator), sphereCentersY(allocator), sphereCentersZ(allocator),
+        capsuleCentersX(allocator), capsuleCentersY(allocator), capsuleCentersZ(allocator),
+        capsuleAxesX(allocator), capsuleAxesY(allocator), capsuleAxesZ(allocator) {
 
 }
 
@@ -58,6 +60,22 @@ void SphereVsCapsuleNarrowPhaseInfoBatch::addNarrowPhaseInfo(uint64 pairId, uint
     sphereRadiuses.add(sphereShape->getRadius());
     capsuleRadiuses.add(capsuleShape->getRadius());
     capsuleHeights.add(capsuleShape->getHeight());
+
+    // Compute the world-space center of the sphere and direction of the inner segment of the capsule
+    const Transform& sphereToWorldTransform = isSphereShape1 ? shape1Transform : shape2Transform;
+    const Transform& capsuleToWorldTransform = isSphereShape1 ? shape2Transform : shape1Transform;
+    const Vector3& sphereCenter = sphereToWorldTransform.getPosition();
+    const Vector3& capsuleCenter = capsuleToWorldTransform.getPosition();
+    const Vector3 capsuleAxis = capsuleToWorldTransform.getOrientation() * Vector3(0, 1, 0);
+    sphereCentersX.add(sphereCenter.x);
+    sphereCentersY.add(sphereCenter.y);
+    sphereCentersZ.add(sphereCenter.z);
+    capsuleCentersX.add(capsuleCenter.x);
+    capsuleCentersY.add(capsuleCenter.y);
+    capsuleCentersZ.add(capsuleCenter.z);
+    capsuleAxesX.add(capsuleAxis.x);
+    capsuleAxesY.add(capsuleAxis.y);
+    capsuleAxesZ.add(capsuleAxis.z);
 }
 
 // Initialize the containers using cached capacity
@@ -69,6 +87,15 @@ void SphereVsCapsuleNarrowPhaseInfoBatch::reserveMemory() {
     sphereRadiuses.reserve(mCachedCapacity);
     capsuleRadiuses.reserve(mCachedCapacity);
     capsuleHeights.reserve(mCachedCapacity);
+    sphereCentersX.reserve(mCachedCapacity);
+    sphereCentersY.reserve(mCachedCapacity);
+    sphereCentersZ.reserve(mCachedCapacity);
+    capsuleCentersX.reserve(mCachedCapacity);
+    capsuleCentersY.reserve(mCachedCapacity);
+    capsuleCentersZ.reserve(mCachedCapacity);
+    capsuleAxesX.reserve(mCachedCapacity);
+    capsuleAxesY.reserve(mCachedCapacity);
+    capsuleAxesZ.reserve(mCachedCapacity);
 }
 
 // Clear all the objects in the batch
@@ -85,4 +112,13 @@ void SphereVsCapsuleNarrowPhaseInfoBatch::clear() {
     sphereRadiuses.clear(true);
     capsuleRadiuses.clear(true);
     capsuleHeights.clear(true);
+    sphereCentersX.clear(true);
+    sphereCentersY.clear(true);
+    sphereCentersZ.clear(true);
+    capsuleCentersX.clear(true);
+    capsuleCentersY.clear(true);
+    capsuleCentersZ.clear(true);
+    capsuleAxesX.clear(true);
+    capsuleAxesY.clear(true);
+    capsuleAxesZ.clear(true);
 }
@@ -27,75 +27,122 @@
 #include <reactphysics3d/collision/narrowphase/SphereVsSphereAlgorithm.h>
 #include <reactphysics3d/collision/shapes/SphereShape.h>
 #include <reactphysics3d/collision/narrowphase/SphereVsSphereNarrowPhaseInfoBatch.h>
+#include <reactphysics3d/mathematics/SimdVector3.h>
 
 // We want to use the ReactPhysics3D namespace
 using namespace reactphysics3d;  
 
+// Compute the narrow-phase collision detection between the pairs of spheres of a batch
 bool SphereVsSphereAlgorithm::testCollision(SphereVsSphereNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchStartIndex, uint batchNbItems, MemoryAllocator& memoryAllocator) {
 
     bool isCollisionFound = false;
 
-    // For each item in the batch
-    for (uint batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
+    const uint batchEndIndex = batchStartIndex + batchNbItems;
+    const SimdDecimal toleranceFactor(decimal(1.0) + NARROW_PHASE_SIMD_OVERLAP_TOLERANCE);
+    decimal overlapLanes[SIMD_DECIMAL_NB_LANES];
 
-        assert(narrowPhaseInfoBatch.contactPoints[batchIndex].size() == 0);
-        assert(!narrowPhaseInfoBatch.isColliding[batchIndex]);
+    // For each group of SIMD_DECIMAL_NB_LANES items in the batch
+    uint batchIndex = batchStartIndex;
+    for (; batchIndex + SIMD_DECIMAL_NB_LANES <= batchEndIndex; batchIndex += SIMD_DECIMAL_NB_LANES) {
 
-        // Get the local-space to world-space transforms
-        const Transform& transform1 = narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex];
-        const Transform& transform2 = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex];
+        const SimdVector3 centers1(SimdDecimal::load(&narrowPhaseInfoBatch.sphere1CentersX[batchIndex]),
+                                   SimdDecimal::load(&narrowPhaseInfoBatch.sphere1CentersY[batchIndex]),
+                                   SimdDecimal::load(&narrowPhaseInfoBatch.sphere1CentersZ[batchIndex]));
+        const SimdVector3 centers2(SimdDecimal::load(&narrowPhaseInfoBatch.sphere2CentersX[batchIndex]),
+                                   SimdDecimal::load(&narrowPhaseInfoBatch.sphere2CentersY[batchIndex]),
+                                   SimdDecimal::load(&narrowPhaseInfoBatch.sphere2CentersZ[batchIndex]));
 
-        // Compute the distance between the centers
-        Vector3 vectorBetweenCenters = transform2.getPosition() - transform1.getPosition();
-        decimal squaredDistanceBetweenCenters = vectorBetweenCenters.lengthSquare();
+        // Compute the squared distances between the centers
+        const SimdDecimal squaredDistancesBetweenCenters = (centers2 - centers1).lengthSquare();
 
-        // Compute the sum of the radius
-        decimal sumRadiuses = narrowPhaseInfoBatch.sphere1Radiuses[batchIndex] + narrowPhaseInfoBatch.sphere2Radiuses[batchIndex];
+        // Compute the sums of the radiuses (increased by the tolerance of the test)
+        const SimdDecimal sumRadiuses = (SimdDecimal::load(&narrowPhaseInfoBatch.sphere1Radiuses[batchIndex]) +
+                                         SimdDecimal::load(&narrowPhaseInfoBatch.sphere2Radiuses[batchIndex])) * toleranceFactor;
 
-        // Compute the product of the sum of the radius
-        decimal sumRadiusesProducts = sumRadiuses * sumRadiuses;
+        // A lane is positive if the two spheres may overlap
+        (sumRadiuses * sumRadiuses - squaredDistancesBetweenCenters).store(overlapLanes);
 
-        // If the sphere collision shapes intersect
-        if (squaredDistanceBetweenCenters < sumRadiusesProducts) {
+        // Compute the contacts of the pairs that may overlap
+        for (uint32 lane = 0; lane < SIMD_DECIMAL_NB_LANES; lane++) {
 
-            // If we need to report contacts
-            if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
+            assert(narrowPhaseInfoBatch.contactPoints[batchIndex + lane].size() == 0);
+            assert(!narrowPhaseInfoBatch.isColliding[batchIndex + lane]);
 
-                const Transform transform1Inverse = transform1.getInverse();
-                const Transform transform2Inverse = transform2.getInverse();
+            if (overlapLanes[lane] > decimal(0.0)) {
+                isCollisionFound |= testCollisionPair(narrowPhaseInfoBatch, batchIndex + lane);
+            }
+        }
+    }
+
+    // For each remaining item in the batch
+    for (; batchIndex < batchEndIndex; batchIndex++) {
+        isCollisionFound |= testCollisionPair(narrowPhaseInfoBatch, batchIndex);
+    }
+
+    return isCollisionFound;
+}
+
+// Compute the narrow-phase collision detection of a single pair of spheres of the batch
+bool SphereVsSphereAlgorithm::testCollisionPair(SphereVsSphereNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint batchIndex) {
+
+    assert(narrowPhaseInfoBatch.contactPoints[batchIndex].size() == 0);
+    assert(!narrowPhaseInfoBatch.isColliding[batchIndex]);
 
-                decimal penetrationDepth = sumRadiuses - std::sqrt(squaredDistanceBetweenCenters);
-                Vector3 intersectionOnBody1;
-                Vector3 intersectionOnBody2;
-                Vector3 normal;
+    // Get the local-space to world-space transforms
+    const Transform& transform1 = narrowPhaseInfoBatch.shape1ToWorldTransforms[batchIndex];
+    const Transform& transform2 = narrowPhaseInfoBatch.shape2ToWorldTransforms[batchIndex];
 
-                // If the two sphere centers are not at the same position
-                if (squaredDistanceBetweenCenters > MACHINE_EPSILON) {
+    // Compute the distance between the centers
+    Vector3 vectorBetweenCenters = transform2.getPosition() - transform1.getPosition();
+    decimal squaredDistanceBetweenCenters = vectorBetweenCenters.lengthSquare();
 
-                    Vector3 centerSphere2InBody1LocalSpace = transform1Inverse * transform2.getPosition();
-                    Vector3 centerSphere1InBody2LocalSpace = transform2Inverse * transform1.getPosition();
+    // Compute the sum of the radius
+    decimal sumRadiuses = narrowPhaseInfoBatch.sphere1Radiuses[batchIndex] + narrowPhaseInfoBatch.sphere2Radiuses[batchIndex];
 
-                    intersectionOnBody1 = narrowPhaseInfoBatch.sphere1Radiuses[batchIndex] * centerSphere2InBody1LocalSpace.getUnit();
-                    intersectionOnBody2 = narrowPhaseInfoBatch.sphere2Radiuses[batchIndex] * centerSphere1InBody2LocalSpace.getUnit();
-                    normal = vectorBetweenCenters.getUnit();
-                }
-                else {    // If the sphere centers are at the same position (degenerate case)
+    // Compute the product of the sum of the radius
+    decimal sumRadiusesProducts = sumRadiuses * sumRadiuses;
 
-                    // Take any contact normal direction
-                    normal.setAllValues(0, 1, 0);
+    // If the sphere collision shapes intersect
+    if (squaredDistanceBetweenCenters < sumRadiusesProducts) {
 
-                    intersectionOnBody1 = narrowPhaseInfoBatch.sphere1Radiuses[batchIndex] * (transform1Inverse.getOrientation() * normal);
-                    intersectionOnBody2 = narrowPhaseInfoBatch.sphere2Radiuses[batchIndex] * (transform2Inverse.getOrientation() * normal);
-                }
+        // If we need to report contacts
+        if (narrowPhaseInfoBatch.reportContacts[batchIndex]) {
 
-                // Create the contact info object
-                narrowPhaseInfoBatch.addContactPoint(batchIndex, normal, penetrationDepth, intersectionOnBody1, intersectionOnBody2);
+            const Transform transform1Inverse = transform1.getInverse();
+            const Transform transform2Inverse = transform2.getInverse();
+
+            decimal penetrationDepth = sumRadiuses - std::sqrt(squaredDistanceBetweenCenters);
+            Vector3 intersectionOnBody1;
+            Vector3 intersectionOnBody2;
+            Vector3 normal;
+
+            // If the two sphere centers are not at the same position
+            if (squaredDistanceBetweenCenters > MACHINE_EPSILON) {
+
+                Vector3 centerSphere2InBody1LocalSpace = transform1Inverse * transform2.getPosition();
+                Vector3 centerSphere1InBody2LocalSpace = transform2Inverse * transform1.getPosition();
+
+                intersectionOnBody1 = narrowPhaseInfoBatch.sphere1Radiuses[batchIndex] * centerSphere2InBody1LocalSpace.getUnit();
+                intersectionOnBody2 = narrowPhaseInfoBatch.sphere2Radiuses[batchIndex] * centerSphere1InBody2LocalSpace.getUnit();
+                normal = vectorBetweenCenters.getUnit();
+            }
+            else {    // If the sphere centers are at the same position (degenerate case)
+
+                // Take any contact normal direction
+                normal.setAllValues(0, 1, 0);
+
+                intersectionOnBody1 = narrowPhaseInfoBatch.sphere1Radiuses[batchIndex] * (transform1Inverse.getOrientation() * normal);
+                intersectionOnBody2 = narrowPhaseInfoBatch.sphere2Radiuses[batchIndex] * (transform2Inverse.getOrientation() * normal);
             }
 
-            narrowPhaseInfoBatch.isColliding[batchIndex] = true;
-            isCollisionFound = true;
+            // Create the contact info object
+            narrowPhaseInfoBatch.addContactPoint(batchIndex, normal, penetrationDepth, intersectionOnBody1, intersectionOnBody2);
         }
+
+        narrowPhaseInfoBatch.isColliding[batchIndex] = true;
+
+        return true;
     }
 
-    return isCollisionFound;
+    return false;
 }
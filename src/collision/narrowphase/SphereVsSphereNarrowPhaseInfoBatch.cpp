@@ -31,7 +31,9 @@ using namespace reactphysics3d;
 
 // Constructor
 SphereVsSphereNarrowPhaseInfoBatch::SphereVsSphereNarrowPhaseInfoBatch(MemoryAllocator& allocator, OverlappingPairs& overlappingPairs)
-      : NarrowPhaseInfoBatch(allocator, overlappingPairs), sphere1Radiuses(allocator), sphere2Radiuses(allocator) {
+      : NarrowPhaseInfoBatch(allocator, overlappingPairs), sphere1Radiuses(allocator), sphere2Radiuses(allocator),
+        sphere1CentersX(allocator), sphere1CentersY(allocator), sphere1CentersZ(allocator),
+        sphere2CentersX(allocator), sphere2CentersY(allocator), sphere2CentersZ(allocator) {
 
 }
 
@@ -50,6 +52,15 @@ void SphereVsSphereNarrowPhaseInfoBatch::addNarrowPhaseInfo(uint64 pairId, uint6
 
     sphere1Radiuses.add(sphere1->getRadius());
     sphere2Radiuses.add(sphere2->getRadius());
+
+    const Vector3& sphere1Center = shape1Transform.getPosition();
+    const Vector3& sphere2Center = shape2Transform.getPosition();
+    sphere1CentersX.add(sphere1Center.x);
+    sphere1CentersY.add(sphere1Center.y);
+    sphere1CentersZ.add(sphere1Center.z);
+    sphere2CentersX.add(sphere2Center.x);
+    sphere2CentersY.add(sphere2Center.y);
+    sphere2CentersZ.add(sphere2Center.z);
 }
 
 // Initialize the containers using cached capacity
@@ -59,6 +70,12 @@ void SphereVsSphereNarrowPhaseInfoBatch::reserveMemory() {
 
     sphere1Radiuses.reserve(mCachedCapacity);
     sphere2Radiuses.reserve(mCachedCapacity);
+    sphere1CentersX.reserve(mCachedCapacity);
+    sphere1CentersY.reserve(mCachedCapacity);
+    sphere1CentersZ.reserve(mCachedCapacity);
+    sphere2CentersX.reserve(mCachedCapacity);
+    sphere2CentersY.reserve(mCachedCapacity);
+    sphere2CentersZ.reserve(mCachedCapacity);
 }
 
 // Clear all the objects in the batch
@@ -73,5 +90,11 @@ void SphereVsSphereNarrowPhaseInfoBatch::clear() {
 
     sphere1Radiuses.clear(true);
     sphere2Radiuses.clear(true);
+    sphere1CentersX.clear(true);
+    sphere1CentersY.clear(true);
+    sphere1CentersZ.clear(true);
+    sphere2CentersX.clear(true);
+    sphere2CentersY.clear(true);
+    sphere2CentersZ.clear(true);
 }
 
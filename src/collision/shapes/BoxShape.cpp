@@ -29,6 +29,7 @@
 #include <reactphysics3d/configuration.h>
 #include <reactphysics3d/memory/MemoryManager.h>
 #include <reactphysics3d/collision/RaycastInfo.h>
+#include <reactphysics3d/mathematics/SimdDecimal.h>
 #include <cassert>
 
 using namespace reactphysics3d;
@@ -77,6 +78,43 @@ BoxShape::BoxShape(const Vector3& halfExtents, MemoryAllocator& allocator)
     mHalfEdgeStructure.addFace(face5);
 
 	mHalfEdgeStructure.init();
+
+    // Compute the arrays of faces and edges of a box with half-extents of one. The
+    // vertices of those arrays are multiplied by the half-extents when they are used
+    const Vector3 unitVertices[8] = {Vector3(-1, -1, 1), Vector3(1, -1, 1), Vector3(1, 1, 1), Vector3(-1, 1, 1),
+                                     Vector3(-1, -1, -1), Vector3(1, -1, -1), Vector3(1, 1, -1), Vector3(-1, 1, -1)};
+    const Vector3 facesNormals[6] = {Vector3(0, 0, 1), Vector3(1, 0, 0), Vector3(0, 0, -1),
+                                     Vector3(-1, 0, 0), Vector3(0, -1, 0), Vector3(0, 1, 0)};
+    mPolyhedronArrays.compute(mHalfEdgeStructure, unitVertices, facesNormals);
+}
+
+// Compute the local support points without margin in several directions
+/// The support points of SIMD_DECIMAL_NB_LANES directions are computed at once with SIMD instructions
+/**
+ * @param directions Array with the x, y and z coordinates of the directions (nbDirections values each)
+ * @param nbDirections Number of directions (a multiple of the number of SIMD lanes)
+ * @param[out] outSupportPoints Array with the x, y and z coordinates of the support points
+ */
+void BoxShape::getLocalSupportPointsWithoutMargin(const decimal* directions, uint nbDirections,
+                                                  decimal* outSupportPoints) const {
+
+    assert(nbDirections % SIMD_DECIMAL_NB_LANES == 0);
+
+    const SimdDecimal zero = SimdDecimal(decimal(0.0));
+
+    for (int i=0; i < 3; i++) {
+
+        const SimdDecimal positiveHalfExtent = SimdDecimal(mHalfExtents[i]);
+        const SimdDecimal negativeHalfExtent = SimdDecimal(-mHalfExtents[i]);
+
+        for (uint d=0; d < nbDirections; d += SIMD_DECIMAL_NB_LANES) {
+
+            // Select the negative half-extent if the direction component is negative
+            const SimdDecimal direction = SimdDecimal::load(directions + i * nbDirections + d);
+            SimdDecimal::selectGreater(zero, direction, negativeHalfExtent, positiveHalfExtent)
+                        .store(outSupportPoints + i * nbDirections + d);
+        }
+    }
 }
 
 // Return the local inertia tensor of the collision shape
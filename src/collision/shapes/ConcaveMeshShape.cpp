@@ -30,24 +30,44 @@
 #include <reactphysics3d/collision/TriangleMesh.h>
 #include <reactphysics3d/utils/Profiler.h>
 #include <reactphysics3d/collision/TriangleVertexArray.h>
+#include <algorithm>
 
 using namespace reactphysics3d;
 
 // Constructor
 ConcaveMeshShape::ConcaveMeshShape(TriangleMesh* triangleMesh, MemoryAllocator& allocator, const Vector3& scaling)
-                 : ConcaveShape(CollisionShapeName::TRIANGLE_MESH, allocator, scaling), mDynamicAABBTree(allocator) {
+                 : ConcaveShape(CollisionShapeName::TRIANGLE_MESH, allocator, scaling), mAABBTree(allocator),
+                   mSubpartsFirstTriangleIds(allocator) {
 
     mTriangleMesh = triangleMesh;
     mRaycastTestType = TriangleRaycastSide::FRONT;
 
-    // Insert all the triangles into the dynamic AABB tree
-    initBVHTree();
+    // Build the AABB tree with all the triangles
+    initBVHTree(allocator);
 }
 
-// Insert all the triangles into the dynamic AABB tree
-void ConcaveMeshShape::initBVHTree() {
+// Build the AABB tree with all the triangles of the mesh
+/// The triangles are numbered sub part after sub part and the ID of a triangle is its index in the tree
+void ConcaveMeshShape::initBVHTree(MemoryAllocator& allocator) {
 
-    // TODO : Try to randomly add the triangles into the tree to obtain a better tree
+    // Compute the ID of the first triangle of each sub-part
+    uint nbTriangles = 0;
+    mSubpartsFirstTriangleIds.reserve(mTriangleMesh->getNbSubparts() + 1);
+    for (uint subPart=0; subPart<mTriangleMesh->getNbSubparts(); subPart++) {
+        mSubpartsFirstTriangleIds.add(nbTriangles);
+        nbTriangles += mTriangleMesh->getSubpart(subPart)->getNbTriangles();
+    }
+    mSubpartsFirstTriangleIds.add(nbTriangles);
+
+    // If the mesh has been loaded from cooked data, we use the tree stored in the data
+    if (mTriangleMesh->mCookedTreeNbTriangles > 0 && mTriangleMesh->mCookedTreeNbTriangles == nbTriangles) {
+
+        mAABBTree.init(mTriangleMesh->mCookedTreeNodes, nbTriangles - 1, mTriangleMesh->mCookedTreeRootReference,
+                       mTriangleMesh->mCookedTreeRootAABB, nbTriangles);
+        return;
+    }
+
+    List<AABB> trianglesAABBs(allocator, nbTriangles);
 
     // For each sub-part of the mesh
     for (uint subPart=0; subPart<mTriangleMesh->getNbSubparts(); subPart++) {
@@ -64,12 +84,24 @@ void ConcaveMeshShape::initBVHTree() {
             triangleVertexArray->getTriangleVertices(triangleIndex, trianglePoints);
 
             // Create the AABB for the triangle
-            AABB aabb = AABB::createAABBForTriangle(trianglePoints);
-
-            // Add the AABB with the index of the triangle into the dynamic AABB tree
-            mDynamicAABBTree.addObject(aabb, subPart, triangleIndex);
+            trianglesAABBs.add(AABB::createAABBForTriangle(trianglePoints));
         }
     }
+
+    mAABBTree.build(trianglesAABBs);
+}
+
+// Return the sub part and the index in the sub part of the triangle with a given ID
+void ConcaveMeshShape::getTriangleSubpartAndIndex(uint triangleId, uint& outSubPart, uint& outTriangleIndex) const {
+
+    assert(triangleId < mSubpartsFirstTriangleIds[mSubpartsFirstTriangleIds.size() - 1]);
+
+    // Find the last sub part that starts before the triangle
+    const uint* firstTriangleIds = &(mSubpartsFirstTriangleIds[0]);
+    const uint* subPart = std::upper_bound(firstTriangleIds, firstTriangleIds + mSubpartsFirstTriangleIds.size(), triangleId) - 1;
+
+    outSubPart = static_cast<uint>(subPart - firstTriangleIds);
+    outTriangleIndex = triangleId - *subPart;
 }
 
 // Return the three vertices coordinates (in the array outTriangleVertices) of a triangle
@@ -134,36 +166,36 @@ void ConcaveMeshShape::computeOverlappingTriangles(const AABB& localAABB, List<V
     RP3D_PROFILE("ConcaveMeshShape::computeOverlappingTriangles()", mProfiler);
 
     // Scale the input AABB with the inverse scale of the concave mesh (because
-    // we store the vertices without scale inside the dynamic AABB tree
+    // we store the vertices without scale inside the AABB tree
     AABB aabb(localAABB);
     aabb.applyScale(Vector3(decimal(1.0) / mScale.x, decimal(1.0) / mScale.y, decimal(1.0) / mScale.z));
 
-    // Compute the nodes of the internal AABB tree that are overlapping with the AABB
-    List<int> overlappingNodes(allocator);
-    mDynamicAABBTree.reportAllShapesOverlappingWithAABB(aabb, overlappingNodes);
+    // Compute the triangles whose AABB in the tree is overlapping with the AABB
+    List<int32> overlappingTriangles(allocator);
+    mAABBTree.reportAllShapesOverlappingWithAABB(aabb, overlappingTriangles);
 
-    const uint nbOverlappingNodes = overlappingNodes.size();
+    const uint nbOverlappingTriangles = overlappingTriangles.size();
 
     // Add space in the list of triangles vertices/normals for the new triangles
-    triangleVertices.addWithoutInit(nbOverlappingNodes * 3);
-    triangleVerticesNormals.addWithoutInit(nbOverlappingNodes * 3);
+    triangleVertices.addWithoutInit(nbOverlappingTriangles * 3);
+    triangleVerticesNormals.addWithoutInit(nbOverlappingTriangles * 3);
 
-    // For each overlapping node
-    for (uint i=0; i < nbOverlappingNodes; i++) {
+    // For each overlapping triangle
+    for (uint i=0; i < nbOverlappingTriangles; i++) {
 
-        int nodeId = overlappingNodes[i];
+        const uint triangleId = static_cast<uint>(overlappingTriangles[i]);
 
-        // Get the node data (triangle index and mesh subpart index)
-        int32* data = mDynamicAABBTree.getNodeDataInt(nodeId);
+        uint subPart, triangleIndex;
+        getTriangleSubpartAndIndex(triangleId, subPart, triangleIndex);
 
-        // Get the triangle vertices for this node from the concave mesh shape
-        getTriangleVertices(data[0], data[1], &(triangleVertices[i * 3]));
+        // Get the triangle vertices from the concave mesh shape
+        getTriangleVertices(subPart, triangleIndex, &(triangleVertices[i * 3]));
 
         // Get the vertices normals of the triangle
-        getTriangleVerticesNormals(data[0], data[1], &(triangleVerticesNormals[i * 3]));
+        getTriangleVerticesNormals(subPart, triangleIndex, &(triangleVerticesNormals[i * 3]));
 
-        // Compute the triangle shape ID
-        shapeIds.add(computeTriangleShapeId(data[0], data[1]));
+        // The triangle ID is also the triangle shape ID
+        shapeIds.add(triangleId);
     }
 }
 
@@ -175,12 +207,12 @@ bool ConcaveMeshShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collide
     RP3D_PROFILE("ConcaveMeshShape::raycast()", mProfiler);
 
     // Apply the concave mesh inverse scale factor because the mesh is stored without scaling
-    // inside the dynamic AABB tree
+    // inside the AABB tree
     const Vector3 inverseScale(decimal(1.0) / mScale.x, decimal(1.0) / mScale.y, decimal(1.0) / mScale.z);
     Ray scaledRay(ray.point1 * inverseScale, ray.point2 * inverseScale, ray.maxFraction);
 
     // Create the callback object that will compute ray casting against triangles
-    ConcaveMeshRaycastCallback raycastCallback(mDynamicAABBTree, *this, collider, raycastInfo, scaledRay, mScale, allocator);
+    ConcaveMeshRaycastCallback raycastCallback(*this, collider, raycastInfo, mScale, allocator);
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -190,95 +222,64 @@ bool ConcaveMeshShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collide
 
 #endif
 
-    // Ask the Dynamic AABB Tree to report all AABB nodes that are hit by the ray.
-    // The raycastCallback object will then compute ray casting against the triangles
-    // in the hit AABBs.
-    mDynamicAABBTree.raycast(scaledRay, raycastCallback);
-
-    raycastCallback.raycastTriangles();
+    // Ask the AABB tree to report the triangles whose AABB is hit by the ray. The tree
+    // visits the closest nodes first and the raycastCallback object clips the ray at
+    // each triangle hit so that the farther triangles are skipped.
+    mAABBTree.raycast(scaledRay, raycastCallback);
 
     return raycastCallback.getIsHit();
 }
 
-// Compute the shape Id for a given triangle of the mesh
-uint ConcaveMeshShape::computeTriangleShapeId(uint subPart, uint triangleIndex) const {
+// Raycast the triangle of a leaf of the AABB tree hit by the ray
+decimal ConcaveMeshRaycastCallback::raycastBroadPhaseShape(int32 triangleId, const Ray& ray) {
 
-    RP3D_PROFILE("ConcaveMeshShape::computeTriangleShapeId()", mProfiler);
+    uint subPart, triangleIndex;
+    mConcaveMeshShape.getTriangleSubpartAndIndex(static_cast<uint>(triangleId), subPart, triangleIndex);
 
-    uint shapeId = 0;
-
-    uint i=0;
-    while (i < subPart) {
-
-        shapeId += mTriangleMesh->getSubpart(i)->getNbTriangles();
-
-        i++;
-    }
+    // Get the triangle vertices for this node from the concave mesh shape
+    Vector3 trianglePoints[3];
+    mConcaveMeshShape.getTriangleVertices(subPart, triangleIndex, trianglePoints);
 
-    return shapeId + triangleIndex;
-}
-
-// Collect all the AABB nodes that are hit by the ray in the Dynamic AABB Tree
-decimal ConcaveMeshRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const Ray& ray) {
-
-    // Add the id of the hit AABB node into
-    mHitAABBNodes.add(nodeId);
-
-    return ray.maxFraction;
-}
-
-// Raycast all collision shapes that have been collected
-void ConcaveMeshRaycastCallback::raycastTriangles() {
-
-    List<int>::Iterator it;
-    decimal smallestHitFraction = mRay.maxFraction;
-
-    for (it = mHitAABBNodes.begin(); it != mHitAABBNodes.end(); ++it) {
-
-        // Get the node data (triangle index and mesh subpart index)
-        int32* data = mDynamicAABBTree.getNodeDataInt(*it);
-
-        // Get the triangle vertices for this node from the concave mesh shape
-        Vector3 trianglePoints[3];
-        mConcaveMeshShape.getTriangleVertices(data[0], data[1], trianglePoints);
+    // Get the vertices normals of the triangle
+    Vector3 verticesNormals[3];
+    mConcaveMeshShape.getTriangleVerticesNormals(subPart, triangleIndex, verticesNormals);
 
-        // Get the vertices normals of the triangle
-        Vector3 verticesNormals[3];
-        mConcaveMeshShape.getTriangleVerticesNormals(data[0], data[1], verticesNormals);
+    // Create a triangle collision shape
+    TriangleShape triangleShape(trianglePoints, verticesNormals, static_cast<uint>(triangleId), mAllocator);
+    triangleShape.setRaycastTestType(mConcaveMeshShape.getRaycastTestType());
 
-        // Create a triangle collision shape
-        TriangleShape triangleShape(trianglePoints, verticesNormals, mConcaveMeshShape.computeTriangleShapeId(data[0], data[1]), mAllocator);
-        triangleShape.setRaycastTestType(mConcaveMeshShape.getRaycastTestType());
-		
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 
-		// Set the profiler to the triangle shape
-		triangleShape.setProfiler(mProfiler);
+    // Set the profiler to the triangle shape
+    triangleShape.setProfiler(mProfiler);
 
 #endif
 
-        // Ray casting test against the collision shape
-        RaycastInfo raycastInfo;
-        bool isTriangleHit = triangleShape.raycast(mRay, raycastInfo, mCollider, mAllocator);
+    // Ray casting test against the collision shape
+    RaycastInfo raycastInfo;
+    bool isTriangleHit = triangleShape.raycast(ray, raycastInfo, mCollider, mAllocator);
 
-        // If the ray hit the collision shape
-        if (isTriangleHit && raycastInfo.hitFraction <= smallestHitFraction) {
+    // If the ray does not hit the triangle, the ray is not clipped
+    if (!isTriangleHit) {
+        return decimal(-1.0);
+    }
 
-            assert(raycastInfo.hitFraction >= decimal(0.0));
+    assert(raycastInfo.hitFraction >= decimal(0.0));
+    assert(raycastInfo.hitFraction <= ray.maxFraction);
 
-            mRaycastInfo.body = raycastInfo.body;
-            mRaycastInfo.collider = raycastInfo.collider;
-            mRaycastInfo.hitFraction = raycastInfo.hitFraction;
-            mRaycastInfo.worldPoint = raycastInfo.worldPoint * mMeshScale;
-            mRaycastInfo.worldNormal = raycastInfo.worldNormal;
-            mRaycastInfo.meshSubpart = data[0];
-            mRaycastInfo.triangleIndex = data[1];
+    mRaycastInfo.body = raycastInfo.body;
+    mRaycastInfo.collider = raycastInfo.collider;
+    mRaycastInfo.hitFraction = raycastInfo.hitFraction;
+    mRaycastInfo.worldPoint = raycastInfo.worldPoint * mMeshScale;
+    mRaycastInfo.worldNormal = raycastInfo.worldNormal;
+    mRaycastInfo.meshSubpart = subPart;
+    mRaycastInfo.triangleIndex = triangleIndex;
 
-            smallestHitFraction = raycastInfo.hitFraction;
-            mIsHit = true;
-        }
-    }
+    mIsHit = true;
+
+    // Clip the ray at the hit point
+    return raycastInfo.hitFraction;
 }
 
 // Return the string representation of the shape
@@ -28,6 +28,7 @@
 #include <reactphysics3d/collision/shapes/ConvexMeshShape.h>
 #include <reactphysics3d/engine/PhysicsWorld.h>
 #include <reactphysics3d/collision/RaycastInfo.h>
+#include <reactphysics3d/mathematics/SimdDecimal.h>
 
 using namespace reactphysics3d;
 
@@ -48,35 +49,80 @@ ConvexMeshShape::ConvexMeshShape(PolyhedronMesh* polyhedronMesh, MemoryAllocator
 }
 
 // Return a local support point in a given direction without the object margin.
-/// If the edges information is not used for collision detection, this method will go through
-/// the whole vertices list and pick up the vertex with the largest dot product in the support
-/// direction. This is an O(n) process with "n" being the number of vertices in the mesh.
-/// However, if the edges information is used, we can cache the previous support vertex and use
-/// it as a start in a hill-climbing (local search) process to find the new support vertex which
-/// will be in most of the cases very close to the previous one. Using hill-climbing, this method
-/// runs in almost constant time.
+/// This method goes through the whole vertices list and picks up the vertex with the largest
+/// dot product in the support direction. This is an O(n) process with "n" being the number of
+/// vertices in the mesh but the dot products of several vertices are computed at once with SIMD
+/// instructions. During the GJK algorithm, the getSupportVertexIndex() method is used instead
+/// to find the support vertex of large meshes with hill-climbing.
 Vector3 ConvexMeshShape::getLocalSupportPointWithoutMargin(const Vector3& direction) const {
 
-    decimal maxDotProduct = DECIMAL_SMALLEST;
-    uint indexMaxDotProduct = 0;
+    // The dot product of a scaled vertex with the direction is the dot product
+    // of the vertex with the scaled direction
+    const uint supportVertexIndex = mPolyhedronMesh->computeSupportVertexLinearScan(direction * mScale);
 
-    // For each vertex of the mesh
-    for (uint i=0; i<mPolyhedronMesh->getNbVertices(); i++) {
+    // Return the vertex with the largest dot product in the support direction
+    return mPolyhedronMesh->getVertex(supportVertexIndex) * mScale;
+}
+
+// Compute the local support points without margin in several directions
+/// The directions are processed SIMD_DECIMAL_NB_LANES at a time with a linear scan over the vertices
+/// of the mesh. The support points are the same as the ones of getLocalSupportPointWithoutMargin().
+/**
+ * @param directions Array with the x, y and z coordinates of the directions (nbDirections values each)
+ * @param nbDirections Number of directions (a multiple of the number of SIMD lanes)
+ * @param[out] outSupportPoints Array with the x, y and z coordinates of the support points
+ */
+void ConvexMeshShape::getLocalSupportPointsWithoutMargin(const decimal* directions, uint nbDirections,
+                                                         decimal* outSupportPoints) const {
+
+    assert(nbDirections % SIMD_DECIMAL_NB_LANES == 0);
+
+    decimal scaledDirections[3 * SIMD_DECIMAL_NB_LANES];
+    uint supportVerticesIndices[SIMD_DECIMAL_NB_LANES];
 
-        // Compute the dot product of the current vertex
-        decimal dotProduct = direction.dot(mPolyhedronMesh->getVertex(i));
+    for (uint d=0; d < nbDirections; d += SIMD_DECIMAL_NB_LANES) {
 
-        // If the current dot product is larger than the maximum one
-        if (dotProduct > maxDotProduct) {
-            indexMaxDotProduct = i;
-            maxDotProduct = dotProduct;
+        // The dot product of a scaled vertex with a direction is the dot
+        // product of the vertex with the scaled direction
+        for (int i=0; i < 3; i++) {
+            (SimdDecimal::load(directions + i * nbDirections + d) * SimdDecimal(mScale[i]))
+                    .store(scaledDirections + i * SIMD_DECIMAL_NB_LANES);
+        }
+
+        mPolyhedronMesh->computeSupportVerticesLinearScan(scaledDirections, SIMD_DECIMAL_NB_LANES, supportVerticesIndices);
+
+        for (uint32 l=0; l < SIMD_DECIMAL_NB_LANES; l++) {
+            const Vector3 supportPoint = mPolyhedronMesh->getVertex(supportVerticesIndices[l]) * mScale;
+            outSupportPoints[d + l] = supportPoint.x;
+            outSupportPoints[nbDirections + d + l] = supportPoint.y;
+            outSupportPoints[2 * nbDirections + d + l] = supportPoint.z;
         }
     }
+}
 
-    assert(maxDotProduct >= decimal(0.0));
+// Return the index of the support vertex in a given direction starting the search from a given vertex
+/// If the mesh has at least CONVEX_MESH_HILL_CLIMBING_MIN_NB_VERTICES vertices, we use the
+/// start vertex (previous support vertex) in a hill-climbing (local search) process to find the new
+/// support vertex which will be in most of the cases very close to the previous one. Using
+/// hill-climbing, this method runs in almost constant time. For smaller meshes, a linear scan
+/// over all the vertices is faster.
+/**
+ * @param direction Support direction in the local-space of the shape
+ * @param startVertexIndex Index of the vertex where the hill-climbing starts (for instance the
+ *                         support vertex found by the previous query)
+ * @return The index of the support vertex (use getVertexPosition() to get its position)
+ */
+uint ConvexMeshShape::getSupportVertexIndex(const Vector3& direction, uint startVertexIndex) const {
 
-    // Return the vertex with the largest dot product in the support direction
-    return mPolyhedronMesh->getVertex(indexMaxDotProduct) * mScale;
+    const Vector3 scaledDirection = direction * mScale;
+
+    if (mPolyhedronMesh->getNbVertices() >= CONVEX_MESH_HILL_CLIMBING_MIN_NB_VERTICES &&
+        mPolyhedronMesh->isHillClimbingEnabled()) {
+
+        return mPolyhedronMesh->computeSupportVertexHillClimbing(scaledDirection, startVertexIndex);
+    }
+
+    return mPolyhedronMesh->computeSupportVertexLinearScan(scaledDirection);
 }
 
 // Recompute the bounds of the mesh
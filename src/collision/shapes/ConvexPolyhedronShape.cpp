@@ -57,3 +57,26 @@ uint ConvexPolyhedronShape::findMostAntiParallelFace(const Vector3& direction) c
 
     return mostAntiParallelFace;
 }
+
+// Compute the local support points without margin in several directions
+/// The directions and the support points are stored as structures of arrays (the x coordinates
+/// of all the vectors, then their y and z coordinates). This method computes the support points
+/// one at a time and is overriden by the polyhedra that can compute several of them at once.
+/**
+ * @param directions Array with the x, y and z coordinates of the directions (nbDirections values each)
+ * @param nbDirections Number of directions (a multiple of the number of SIMD lanes)
+ * @param[out] outSupportPoints Array with the x, y and z coordinates of the support points
+ */
+void ConvexPolyhedronShape::getLocalSupportPointsWithoutMargin(const decimal* directions, uint nbDirections,
+                                                               decimal* outSupportPoints) const {
+
+    for (uint i=0; i < nbDirections; i++) {
+
+        const Vector3 direction(directions[i], directions[nbDirections + i], directions[2 * nbDirections + i]);
+        const Vector3 supportPoint = getLocalSupportPointWithoutMargin(direction);
+
+        outSupportPoints[i] = supportPoint.x;
+        outSupportPoints[nbDirections + i] = supportPoint.y;
+        outSupportPoints[2 * nbDirections + i] = supportPoint.z;
+    }
+}
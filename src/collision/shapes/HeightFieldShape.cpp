@@ -26,6 +26,7 @@
 // Libraries
 #include <reactphysics3d/collision/shapes/HeightFieldShape.h>
 #include <reactphysics3d/collision/RaycastInfo.h>
+#include <reactphysics3d/collision/Collider.h>
 #include <reactphysics3d/utils/Profiler.h>
 
 using namespace reactphysics3d;
@@ -47,7 +48,8 @@ HeightFieldShape::HeightFieldShape(int nbGridColumns, int nbGridRows, decimal mi
                  : ConcaveShape(CollisionShapeName::HEIGHTFIELD, allocator, scaling), mNbColumns(nbGridColumns), mNbRows(nbGridRows),
                    mWidth(nbGridColumns - 1), mLength(nbGridRows - 1), mMinHeight(minHeight),
                    mMaxHeight(maxHeight), mUpAxis(upAxis), mIntegerHeightScale(integerHeightScale),
-                   mHeightDataType(dataType) {
+                   mHeightDataType(dataType), mNbBlocksColumns((nbGridColumns - 2) / BLOCK_SIZE + 1),
+                   mNbBlocksRows((nbGridRows - 2) / BLOCK_SIZE + 1), mBlocksMinHeight(allocator), mBlocksMaxHeight(allocator) {
 
     assert(nbGridColumns >= 2);
     assert(nbGridRows >= 2);
@@ -74,6 +76,44 @@ HeightFieldShape::HeightFieldShape(int nbGridColumns, int nbGridRows, decimal mi
         mAABB.setMin(Vector3(-mWidth * decimal(0.5), -mLength * decimal(0.5), -halfHeight));
         mAABB.setMax(Vector3(mWidth * decimal(0.5), mLength * decimal(0.5), halfHeight));
     }
+
+    computeBlocksMinMaxHeights();
+}
+
+// Compute the minimum and maximum heights of each block of cells of the grid
+/// The raycasting uses them to skip the blocks of cells that are entirely above or
+/// below the ray.
+void HeightFieldShape::computeBlocksMinMaxHeights() {
+
+    const decimal heightOrigin = -(mMaxHeight - mMinHeight) * decimal(0.5) - mMinHeight;
+
+    const int nbBlocks = mNbBlocksColumns * mNbBlocksRows;
+    mBlocksMinHeight.reserve(nbBlocks);
+    mBlocksMaxHeight.reserve(nbBlocks);
+
+    for (int bj = 0; bj < mNbBlocksRows; bj++) {
+        for (int bi = 0; bi < mNbBlocksColumns; bi++) {
+
+            // The vertices of the block (shared with the neighbor blocks)
+            const int iStart = bi * BLOCK_SIZE;
+            const int jStart = bj * BLOCK_SIZE;
+            const int iEnd = std::min(iStart + BLOCK_SIZE, mNbColumns - 1);
+            const int jEnd = std::min(jStart + BLOCK_SIZE, mNbRows - 1);
+
+            decimal minHeight = DECIMAL_LARGEST;
+            decimal maxHeight = -DECIMAL_LARGEST;
+            for (int j = jStart; j <= jEnd; j++) {
+                for (int i = iStart; i <= iEnd; i++) {
+                    const decimal height = getHeightAt(i, j);
+                    minHeight = std::min(minHeight, height);
+                    maxHeight = std::max(maxHeight, height);
+                }
+            }
+
+            mBlocksMinHeight.add(heightOrigin + minHeight);
+            mBlocksMaxHeight.add(heightOrigin + maxHeight);
+        }
+    }
 }
 
 // Return the local bounds of the shape in x, y and z directions.
@@ -222,73 +262,203 @@ void HeightFieldShape::computeMinMaxGridCoordinates(int* minCoords, int* maxCoor
 }
 
 // Raycast method with feedback information
-/// Note that only the first triangle hit by the ray in the mesh will be returned, even if
-/// the ray hits many triangles.
+/// The ray is clipped with the AABB of the height field and the blocks of cells traversed by the
+/// ray are visited in order with a 2D DDA. The blocks entirely above or below the ray are skipped
+/// and the cells of the other blocks are visited in order until the first triangle hit. Note that
+/// only the first triangle hit by the ray in the height field will be returned.
 bool HeightFieldShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collider* collider, MemoryAllocator& allocator) const {
 
-    // TODO : Implement raycasting without using an AABB for the ray
-    //        but using a dynamic AABB tree or octree instead
-
     RP3D_PROFILE("HeightFieldShape::raycast()", mProfiler);
 
-    // Compute the AABB for the ray
-    const Vector3 rayEnd = ray.point1 + ray.maxFraction * (ray.point2 - ray.point1);
-    const AABB rayAABB(Vector3::min(ray.point1, rayEnd), Vector3::max(ray.point1, rayEnd));
+    // Compute the ray in the local-space of the height field without scaling
+    const Vector3 inverseScale(decimal(1.0) / mScale.x, decimal(1.0) / mScale.y, decimal(1.0) / mScale.z);
+    const Vector3 point1 = ray.point1 * inverseScale;
+    const Vector3 direction = (ray.point2 - ray.point1) * inverseScale;
 
-    // Compute the triangles overlapping with the ray AABB
-    List<Vector3> triangleVertices(allocator);
-    List<Vector3> triangleVerticesNormals(allocator);
-    List<uint> shapeIds(allocator);
-    computeOverlappingTriangles(rayAABB, triangleVertices, triangleVerticesNormals, shapeIds, allocator);
+    // Axes of the columns and rows of the grid
+    const int columnAxis = mUpAxis == 0 ? 1 : 0;
+    const int rowAxis = mUpAxis == 2 ? 1 : 2;
 
-    assert(triangleVertices.size() == triangleVerticesNormals.size());
-    assert(shapeIds.size() == triangleVertices.size() / 3);
-    assert(triangleVertices.size() % 3 == 0);
-    assert(triangleVerticesNormals.size() % 3 == 0);
+    // Clip the ray segment with the AABB of the height field
+    decimal tMin = decimal(0.0);
+    decimal tMax = ray.maxFraction;
+    for (int axis = 0; axis < 3; axis++) {
 
-    bool isHit = false;
-    decimal smallestHitFraction = ray.maxFraction;
+        const decimal minBound = mAABB.getMin()[axis];
+        const decimal maxBound = mAABB.getMax()[axis];
+
+        if (std::abs(direction[axis]) < MACHINE_EPSILON) {
+
+            // If the ray is parallel to the slab and outside of it
+            if (point1[axis] < minBound || point1[axis] > maxBound) return false;
+        }
+        else {
+
+            const decimal inverseDirection = decimal(1.0) / direction[axis];
+            decimal t1 = (minBound - point1[axis]) * inverseDirection;
+            decimal t2 = (maxBound - point1[axis]) * inverseDirection;
+            if (t1 > t2) std::swap(t1, t2);
+
+            tMin = std::max(tMin, t1);
+            tMax = std::min(tMax, t2);
+            if (tMin > tMax) return false;
+        }
+    }
+
+    // Coordinates of the ray in the grid where the vertex (i, j) is at (i, j)
+    const decimal u = point1[columnAxis] + mWidth * decimal(0.5);
+    const decimal v = point1[rowAxis] + mLength * decimal(0.5);
+    const decimal du = direction[columnAxis];
+    const decimal dv = direction[rowAxis];
+    const decimal height = point1[mUpAxis];
+    const decimal dHeight = direction[mUpAxis];
+
+    const int nbCellsColumns = mNbColumns - 1;
+    const int nbCellsRows = mNbRows - 1;
+
+    // Test the two triangles of a cell of the grid
+    auto cellCallback = [&](int i, int j, decimal /*tIn*/, decimal /*tOut*/) {
+        return raycastCell(i, j, ray, raycastInfo, collider);
+    };
+
+    // Visit the cells of a block of the grid if the ray can hit its triangles
+    auto blockCallback = [&](int bi, int bj, decimal tIn, decimal tOut) {
+
+        const decimal heightIn = height + tIn * dHeight;
+        const decimal heightOut = height + tOut * dHeight;
+        const int blockIndex = bj * mNbBlocksColumns + bi;
+        if (std::max(heightIn, heightOut) < mBlocksMinHeight[blockIndex] - MACHINE_EPSILON ||
+            std::min(heightIn, heightOut) > mBlocksMaxHeight[blockIndex] + MACHINE_EPSILON) {
+            return false;
+        }
 
-    // For each overlapping triangle
-    for (uint i=0; i < shapeIds.size(); i++)
-    {
-        // Create a triangle collision shape
-        TriangleShape triangleShape(&(triangleVertices[i * 3]), &(triangleVerticesNormals[i * 3]), shapeIds[i], allocator);
-        triangleShape.setRaycastTestType(getRaycastTestType());
+        const int iMin = bi * BLOCK_SIZE;
+        const int jMin = bj * BLOCK_SIZE;
+        return walkGridCells(u, v, du, dv, tIn, tOut, 1, iMin, jMin, std::min(iMin + BLOCK_SIZE, nbCellsColumns) - 1,
+                             std::min(jMin + BLOCK_SIZE, nbCellsRows) - 1, cellCallback);
+    };
 
-    #ifdef IS_RP3D_PROFILING_ENABLED
+    return walkGridCells(u, v, du, dv, tMin, tMax, BLOCK_SIZE, 0, 0, mNbBlocksColumns - 1, mNbBlocksRows - 1, blockCallback);
+}
 
+// Visit the cells of a grid traversed by a 2D segment in the order of the segment
+/// The segment is (u, v) + t * (du, dv) for t in [tStart, tEnd] and the cell (i, j) covers
+/// [i * cellSize, (i + 1) * cellSize] x [j * cellSize, (j + 1) * cellSize]. The callback is
+/// called with the cell coordinates and the parameters where the segment enters and exits the
+/// cell. The traversal stops when the callback returns true or when the segment leaves the cells
+/// range [iMin, iMax] x [jMin, jMax]. This method returns true if the callback has stopped the traversal.
+template<typename CellCallback>
+bool HeightFieldShape::walkGridCells(decimal u, decimal v, decimal du, decimal dv, decimal tStart, decimal tEnd,
+                                     int cellSize, int iMin, int jMin, int iMax, int jMax, CellCallback& callback) const {
+
+    // Cell containing the start point of the segment
+    int i = clamp(static_cast<int>(std::floor((u + tStart * du) / cellSize)), iMin, iMax);
+    int j = clamp(static_cast<int>(std::floor((v + tStart * dv) / cellSize)), jMin, jMax);
+
+    // Direction of the steps and parameters of the next cells boundaries crossed along each axis
+    const int stepI = du > decimal(0.0) ? 1 : -1;
+    const int stepJ = dv > decimal(0.0) ? 1 : -1;
+    const decimal tDeltaU = std::abs(du) > MACHINE_EPSILON ? cellSize / std::abs(du) : DECIMAL_LARGEST;
+    const decimal tDeltaV = std::abs(dv) > MACHINE_EPSILON ? cellSize / std::abs(dv) : DECIMAL_LARGEST;
+    decimal tNextU = std::abs(du) > MACHINE_EPSILON ? ((i + (stepI > 0 ? 1 : 0)) * cellSize - u) / du : DECIMAL_LARGEST;
+    decimal tNextV = std::abs(dv) > MACHINE_EPSILON ? ((j + (stepJ > 0 ? 1 : 0)) * cellSize - v) / dv : DECIMAL_LARGEST;
+
+    decimal tIn = tStart;
+    while (true) {
+
+        const decimal tOut = std::min(std::min(tNextU, tNextV), tEnd);
+
+        if (callback(i, j, tIn, tOut)) return true;
+
+        if (tOut >= tEnd) return false;
+
+        // Move to the next cell
+        if (tNextU < tNextV) {
+            i += stepI;
+            tNextU += tDeltaU;
+        }
+        else {
+            j += stepJ;
+            tNextV += tDeltaV;
+        }
+        tIn = tOut;
 
-        // Set the profiler to the triangle shape
-        triangleShape.setProfiler(mProfiler);
+        if (i < iMin || i > iMax || j < jMin || j > jMax) return false;
+    }
+}
 
-    #endif
+// Raycast the two triangles of a cell of the grid and return true if one of them is hit
+bool HeightFieldShape::raycastCell(int i, int j, const Ray& ray, RaycastInfo& raycastInfo, Collider* collider) const {
 
-        // Ray casting test against the collision shape
-        RaycastInfo triangleRaycastInfo;
-        bool isTriangleHit = triangleShape.raycast(ray, triangleRaycastInfo, collider, allocator);
+    // Compute the four point of the cell
+    const Vector3 p1 = getVertexAt(i, j);
+    const Vector3 p2 = getVertexAt(i, j + 1);
+    const Vector3 p3 = getVertexAt(i + 1, j);
+    const Vector3 p4 = getVertexAt(i + 1, j + 1);
 
-        // If the ray hit the collision shape
-        if (isTriangleHit && triangleRaycastInfo.hitFraction <= smallestHitFraction) {
+    decimal smallestHitFraction = ray.maxFraction;
+    Vector3 hitNormal;
+    bool isHit = false;
 
-            assert(triangleRaycastInfo.hitFraction >= decimal(0.0));
+    // Raycast the two triangles of the cell (with the same vertices as in computeOverlappingTriangles())
+    decimal hitFraction;
+    Vector3 normal;
+    if (raycastTriangle(p1, p2, p3, ray, hitFraction, normal) && hitFraction <= smallestHitFraction) {
+        smallestHitFraction = hitFraction;
+        hitNormal = normal;
+        isHit = true;
+    }
+    if (raycastTriangle(p3, p2, p4, ray, hitFraction, normal) && hitFraction <= smallestHitFraction) {
+        smallestHitFraction = hitFraction;
+        hitNormal = normal;
+        isHit = true;
+    }
 
-            raycastInfo.body = triangleRaycastInfo.body;
-            raycastInfo.collider = triangleRaycastInfo.collider;
-            raycastInfo.hitFraction = triangleRaycastInfo.hitFraction;
-            raycastInfo.worldPoint = triangleRaycastInfo.worldPoint;
-            raycastInfo.worldNormal = triangleRaycastInfo.worldNormal;
-            raycastInfo.meshSubpart = -1;
-            raycastInfo.triangleIndex = -1;
+    if (isHit) {
 
-            smallestHitFraction = triangleRaycastInfo.hitFraction;
-            isHit = true;
-        }
+        raycastInfo.body = collider->getBody();
+        raycastInfo.collider = collider;
+        raycastInfo.hitFraction = smallestHitFraction;
+        raycastInfo.worldPoint = ray.point1 + smallestHitFraction * (ray.point2 - ray.point1);
+        raycastInfo.worldNormal = hitNormal;
+        raycastInfo.meshSubpart = -1;
+        raycastInfo.triangleIndex = -1;
     }
 
     return isHit;
 }
 
+// Raycast a triangle of the height field and return true if it is hit
+/// The triangle faces hit by the ray depend on the raycast test type of the shape as
+/// in TriangleShape::raycast().
+bool HeightFieldShape::raycastTriangle(const Vector3& a, const Vector3& b, const Vector3& c, const Ray& ray,
+                                       decimal& hitFraction, Vector3& hitNormal) const {
+
+    const Vector3 pq = ray.point2 - ray.point1;
+    const Vector3 normal = (b - a).cross(c - a);
+    const decimal denom = normal.dot(pq);
+
+    // Reject the ray if it is parallel to the triangle or if it hits a culled face
+    if (denom == decimal(0.0)) return false;
+    if (getRaycastTestType() == TriangleRaycastSide::FRONT && denom > decimal(0.0)) return false;
+    if (getRaycastTestType() == TriangleRaycastSide::BACK && denom < decimal(0.0)) return false;
+
+    // Compute the intersection with the plane of the triangle
+    const decimal t = normal.dot(a - ray.point1) / denom;
+    if (t < decimal(0.0) || t > ray.maxFraction) return false;
+
+    // Test if the intersection point is inside the triangle
+    const Vector3 hitPoint = ray.point1 + t * pq;
+    if ((b - a).cross(hitPoint - a).dot(normal) < decimal(0.0)) return false;
+    if ((c - b).cross(hitPoint - b).dot(normal) < decimal(0.0)) return false;
+    if ((a - c).cross(hitPoint - c).dot(normal) < decimal(0.0)) return false;
+
+    hitFraction = t;
+    hitNormal = denom > decimal(0.0) ? -normal : normal;
+
+    return true;
+}
+
 // Return the vertex (local-coordinates) of the height field at a given (x,y) position
 Vector3 HeightFieldShape::getVertexAt(int x, int y) const {
 
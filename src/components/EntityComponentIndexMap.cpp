@@ -0,0 +1,120 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/components/EntityComponentIndexMap.h>
+#include <reactphysics3d/memory/MemoryAllocator.h>
+
+// We want to use the ReactPhysics3D namespace
+using namespace reactphysics3d;
+
+// Constructor
+EntityComponentIndexMap::EntityComponentIndexMap(MemoryAllocator& allocator)
+    : mAllocator(allocator), mPages(nullptr), mNbPages(0), mNbEntities(0) {
+
+}
+
+// Destructor
+EntityComponentIndexMap::~EntityComponentIndexMap() {
+
+    if (mPages != nullptr) {
+
+        // Release the pages
+        for (uint32 i=0; i < mNbPages; i++) {
+            if (mPages[i] != nullptr) {
+                mAllocator.release(mPages[i], PAGE_SIZE * sizeof(Slot));
+            }
+        }
+
+        mAllocator.release(mPages, mNbPages * sizeof(Slot*));
+    }
+}
+
+// Allocate the page of a given entity index if necessary and return it
+EntityComponentIndexMap::Slot* EntityComponentIndexMap::getOrAllocatePage(uint32 entityIndex) {
+
+    const uint32 pageIndex = entityIndex >> PAGE_SIZE_BITS;
+
+    // If the array of pages is too small
+    if (pageIndex >= mNbPages) {
+
+        uint32 newNbPages = mNbPages > 0 ? mNbPages : 1;
+        while (newNbPages <= pageIndex) newNbPages *= 2;
+
+        Slot** newPages = static_cast<Slot**>(mAllocator.allocate(newNbPages * sizeof(Slot*)));
+        for (uint32 i=0; i < newNbPages; i++) {
+            newPages[i] = i < mNbPages ? mPages[i] : nullptr;
+        }
+
+        if (mPages != nullptr) {
+            mAllocator.release(mPages, mNbPages * sizeof(Slot*));
+        }
+
+        mPages = newPages;
+        mNbPages = newNbPages;
+    }
+
+    // If the page is not allocated yet
+    if (mPages[pageIndex] == nullptr) {
+
+        Slot* page = static_cast<Slot*>(mAllocator.allocate(PAGE_SIZE * sizeof(Slot)));
+        for (uint32 i=0; i < PAGE_SIZE; i++) {
+            page[i].entityId = 0;
+            page[i].componentIndex = INVALID_INDEX;
+        }
+
+        mPages[pageIndex] = page;
+    }
+
+    return mPages[pageIndex];
+}
+
+// Add the component index of an entity (the entity must not be in the map)
+void EntityComponentIndexMap::add(const Pair<Entity, uint32>& entityComponentIndex) {
+
+    const Entity entity = entityComponentIndex.first;
+    assert(!containsKey(entity));
+    assert(entityComponentIndex.second != INVALID_INDEX);
+
+    // An entity index is used by a single living entity at a time
+    Slot& slot = getOrAllocatePage(entity.getIndex())[entity.getIndex() & (PAGE_SIZE - 1)];
+    assert(slot.componentIndex == INVALID_INDEX);
+
+    slot.entityId = entity.id;
+    slot.componentIndex = entityComponentIndex.second;
+
+    mNbEntities++;
+}
+
+// Remove an entity from the map
+void EntityComponentIndexMap::remove(Entity entity) {
+
+    assert(containsKey(entity));
+
+    const uint32 entityIndex = entity.getIndex();
+    mPages[entityIndex >> PAGE_SIZE_BITS][entityIndex & (PAGE_SIZE - 1)].componentIndex = INVALID_INDEX;
+
+    mNbEntities--;
+}
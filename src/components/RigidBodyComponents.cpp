@@ -43,7 +43,8 @@ RigidBodyComponents::RigidBodyComponents(MemoryAllocator& allocator)
                                 sizeof(Vector3) + sizeof(Vector3) + sizeof(Vector3) +
                                 sizeof(Vector3) + sizeof(Vector3) + sizeof(Vector3) +
                                 sizeof(Quaternion) + sizeof(Vector3) + sizeof(Vector3) +
-                                sizeof(bool) + sizeof(bool) + sizeof(List<Entity>)) {
+                                sizeof(Entity) + sizeof(Entity) + sizeof(uint32) +
+                                sizeof(bool) + sizeof(bool) + sizeof(List<Entity>) + sizeof(bool)) {
 
     // Allocate memory for the components data
     allocate(INIT_NB_ALLOCATED_COMPONENTS);
@@ -86,9 +87,13 @@ void RigidBodyComponents::allocate(uint32 nbComponentsToAllocate) {
     Quaternion* newConstrainedOrientations = reinterpret_cast<Quaternion*>(newConstrainedPositions + nbComponentsToAllocate);
     Vector3* newCentersOfMassLocal = reinterpret_cast<Vector3*>(newConstrainedOrientations + nbComponentsToAllocate);
     Vector3* newCentersOfMassWorld = reinterpret_cast<Vector3*>(newCentersOfMassLocal + nbComponentsToAllocate);
-    bool* newIsGravityEnabled = reinterpret_cast<bool*>(newCentersOfMassWorld + nbComponentsToAllocate);
+    Entity* newIslandParents = reinterpret_cast<Entity*>(newCentersOfMassWorld + nbComponentsToAllocate);
+    Entity* newIslandNextBodies = reinterpret_cast<Entity*>(newIslandParents + nbComponentsToAllocate);
+    uint32* newIslandSizes = reinterpret_cast<uint32*>(newIslandNextBodies + nbComponentsToAllocate);
+    bool* newIsGravityEnabled = reinterpret_cast<bool*>(newIslandSizes + nbComponentsToAllocate);
     bool* newIsAlreadyInIsland = reinterpret_cast<bool*>(newIsGravityEnabled + nbComponentsToAllocate);
     List<Entity>* newJoints = reinterpret_cast<List<Entity>*>(newIsAlreadyInIsland + nbComponentsToAllocate);
+    bool* newIsIslandSplitNeeded = reinterpret_cast<bool*>(newJoints + nbComponentsToAllocate);
 
     // If there was already components before
     if (mNbComponents > 0) {
@@ -98,7 +103,7 @@ void RigidBodyComponents::allocate(uint32 nbComponentsToAllocate) {
         memcpy(newBodies, mRigidBodies, mNbComponents * sizeof(RigidBody*));
         memcpy(newIsAllowedToSleep, mIsAllowedToSleep, mNbComponents * sizeof(bool));
         memcpy(newIsSleeping, mIsSleeping, mNbComponents * sizeof(bool));
-        memcpy(newSleepTimes, mSleepTimes, mNbComponents * sizeof(bool));
+        memcpy(newSleepTimes, mSleepTimes, mNbComponents * sizeof(decimal));
         memcpy(newBodyTypes, mBodyTypes, mNbComponents * sizeof(BodyType));
         memcpy(newLinearVelocities, mLinearVelocities, mNbComponents * sizeof(Vector3));
         memcpy(newAngularVelocities, mAngularVelocities, mNbComponents * sizeof(Vector3));
@@ -118,9 +123,13 @@ void RigidBodyComponents::allocate(uint32 nbComponentsToAllocate) {
         memcpy(newConstrainedOrientations, mConstrainedOrientations, mNbComponents * sizeof(Quaternion));
         memcpy(newCentersOfMassLocal, mCentersOfMassLocal, mNbComponents * sizeof(Vector3));
         memcpy(newCentersOfMassWorld, mCentersOfMassWorld, mNbComponents * sizeof(Vector3));
+        memcpy(newIslandParents, mIslandParents, mNbComponents * sizeof(Entity));
+        memcpy(newIslandNextBodies, mIslandNextBodies, mNbComponents * sizeof(Entity));
+        memcpy(newIslandSizes, mIslandSizes, mNbComponents * sizeof(uint32));
         memcpy(newIsGravityEnabled, mIsGravityEnabled, mNbComponents * sizeof(bool));
         memcpy(newIsAlreadyInIsland, mIsAlreadyInIsland, mNbComponents * sizeof(bool));
         memcpy(newJoints, mJoints, mNbComponents * sizeof(List<Entity>));
+        memcpy(newIsIslandSplitNeeded, mIsIslandSplitNeeded, mNbComponents * sizeof(bool));
 
         // Deallocate previous memory
         mMemoryAllocator.release(mBuffer, mNbAllocatedComponents * mComponentDataSize);
@@ -152,9 +161,13 @@ void RigidBodyComponents::allocate(uint32 nbComponentsToAllocate) {
     mConstrainedOrientations = newConstrainedOrientations;
     mCentersOfMassLocal = newCentersOfMassLocal;
     mCentersOfMassWorld = newCentersOfMassWorld;
+    mIslandParents = newIslandParents;
+    mIslandNextBodies = newIslandNextBodies;
+    mIslandSizes = newIslandSizes;
     mIsGravityEnabled = newIsGravityEnabled;
     mIsAlreadyInIsland = newIsAlreadyInIsland;
     mJoints = newJoints;
+    mIsIslandSplitNeeded = newIsIslandSplitNeeded;
 }
 
 // Add a component
@@ -188,9 +201,13 @@ void RigidBodyComponents::addComponent(Entity bodyEntity, bool isSleeping, const
     new (mConstrainedOrientations + index) Quaternion(0, 0, 0, 1);
     new (mCentersOfMassLocal + index) Vector3(0, 0, 0);
     new (mCentersOfMassWorld + index) Vector3(component.worldPosition);
+    new (mIslandParents + index) Entity(bodyEntity);
+    new (mIslandNextBodies + index) Entity(bodyEntity);
+    mIslandSizes[index] = 1;
     mIsGravityEnabled[index] = true;
     mIsAlreadyInIsland[index] = false;
     new (mJoints + index) List<Entity>(mMemoryAllocator);
+    mIsIslandSplitNeeded[index] = false;
 
     // Map the entity with the new component lookup index
     mMapEntityToComponentIndex.add(Pair<Entity, uint32>(bodyEntity, index));
@@ -232,9 +249,13 @@ void RigidBodyComponents::moveComponentToIndex(uint32 srcIndex, uint32 destIndex
     new (mConstrainedOrientations + destIndex) Quaternion(mConstrainedOrientations[srcIndex]);
     new (mCentersOfMassLocal + destIndex) Vector3(mCentersOfMassLocal[srcIndex]);
     new (mCentersOfMassWorld + destIndex) Vector3(mCentersOfMassWorld[srcIndex]);
+    new (mIslandParents + destIndex) Entity(mIslandParents[srcIndex]);
+    new (mIslandNextBodies + destIndex) Entity(mIslandNextBodies[srcIndex]);
+    mIslandSizes[destIndex] = mIslandSizes[srcIndex];
     mIsGravityEnabled[destIndex] = mIsGravityEnabled[srcIndex];
     mIsAlreadyInIsland[destIndex] = mIsAlreadyInIsland[srcIndex];
     new (mJoints + destIndex) List<Entity>(mJoints[srcIndex]);
+    mIsIslandSplitNeeded[destIndex] = mIsIslandSplitNeeded[srcIndex];
 
     // Destroy the source component
     destroyComponent(srcIndex);
@@ -275,9 +296,13 @@ void RigidBodyComponents::swapComponents(uint32 index1, uint32 index2) {
     Quaternion constrainedOrientation1 = mConstrainedOrientations[index1];
     Vector3 centerOfMassLocal1 = mCentersOfMassLocal[index1];
     Vector3 centerOfMassWorld1 = mCentersOfMassWorld[index1];
+    Entity islandParent1(mIslandParents[index1]);
+    Entity islandNextBody1(mIslandNextBodies[index1]);
+    uint32 islandSize1 = mIslandSizes[index1];
     bool isGravityEnabled1 = mIsGravityEnabled[index1];
     bool isAlreadyInIsland1 = mIsAlreadyInIsland[index1];
     List<Entity> joints1 = mJoints[index1];
+    bool isIslandSplitNeeded1 = mIsIslandSplitNeeded[index1];
 
     // Destroy component 1
     destroyComponent(index1);
@@ -309,9 +334,13 @@ void RigidBodyComponents::swapComponents(uint32 index1, uint32 index2) {
     mConstrainedOrientations[index2] = constrainedOrientation1;
     mCentersOfMassLocal[index2] = centerOfMassLocal1;
     mCentersOfMassWorld[index2] = centerOfMassWorld1;
+    new (mIslandParents + index2) Entity(islandParent1);
+    new (mIslandNextBodies + index2) Entity(islandNextBody1);
+    mIslandSizes[index2] = islandSize1;
     mIsGravityEnabled[index2] = isGravityEnabled1;
     mIsAlreadyInIsland[index2] = isAlreadyInIsland1;
     new (mJoints + index2) List<Entity>(joints1);
+    mIsIslandSplitNeeded[index2] = isIslandSplitNeeded1;
 
     // Update the entity to component index mapping
     mMapEntityToComponentIndex.add(Pair<Entity, uint32>(entity1, index2));
@@ -346,5 +375,86 @@ void RigidBodyComponents::destroyComponent(uint32 index) {
     mConstrainedOrientations[index].~Quaternion();
     mCentersOfMassLocal[index].~Vector3();
     mCentersOfMassWorld[index].~Vector3();
+    mIslandParents[index].~Entity();
+    mIslandNextBodies[index].~Entity();
     mJoints[index].~List<Entity>();
 }
+
+// Return the entity of the root body of the persistent island of a body
+/// The path from the body to the root is halved along the way (each visited body
+/// is linked to its grandparent) so that the next searches are faster.
+Entity RigidBodyComponents::getIslandRoot(Entity bodyEntity) {
+
+    uint32 index = mMapEntityToComponentIndex[bodyEntity];
+
+    while (mIslandParents[index] != mBodiesEntities[index]) {
+
+        const uint32 parentIndex = mMapEntityToComponentIndex[mIslandParents[index]];
+        mIslandParents[index] = mIslandParents[parentIndex];
+        index = mMapEntityToComponentIndex[mIslandParents[index]];
+    }
+
+    return mBodiesEntities[index];
+}
+
+// Merge the persistent islands of two bodies
+/// The smallest island is attached to the root of the largest one and the
+/// circular lists of bodies of the two islands are spliced together.
+void RigidBodyComponents::mergeIslands(Entity body1Entity, Entity body2Entity) {
+
+    uint32 root1Index = mMapEntityToComponentIndex[getIslandRoot(body1Entity)];
+    uint32 root2Index = mMapEntityToComponentIndex[getIslandRoot(body2Entity)];
+
+    // If the two bodies are already in the same island
+    if (root1Index == root2Index) return;
+
+    if (mIslandSizes[root1Index] < mIslandSizes[root2Index]) {
+        std::swap(root1Index, root2Index);
+    }
+
+    mIslandParents[root2Index] = mBodiesEntities[root1Index];
+    mIslandSizes[root1Index] += mIslandSizes[root2Index];
+    mIsIslandSplitNeeded[root1Index] = mIsIslandSplitNeeded[root1Index] || mIsIslandSplitNeeded[root2Index];
+
+    const Entity nextBody1 = mIslandNextBodies[root1Index];
+    mIslandNextBodies[root1Index] = mIslandNextBodies[root2Index];
+    mIslandNextBodies[root2Index] = nextBody1;
+}
+
+// Remove a body from its persistent island
+/// The body becomes the single body of its own island. The remaining bodies are attached
+/// to a common root and their island is flagged to be split because removing the body
+/// might have disconnected them.
+void RigidBodyComponents::removeBodyFromIsland(Entity bodyEntity) {
+
+    const uint32 index = mMapEntityToComponentIndex[bodyEntity];
+    const Entity rootEntity = getIslandRoot(bodyEntity);
+    const uint32 rootIndex = mMapEntityToComponentIndex[rootEntity];
+
+    // If the body is alone in its island
+    if (mIslandSizes[rootIndex] == 1) return;
+
+    const Entity newRootEntity = rootEntity == bodyEntity ? mIslandNextBodies[index] : rootEntity;
+    const uint32 newIslandSize = mIslandSizes[rootIndex] - 1;
+
+    // Attach the other bodies to the new root and find the body preceding the removed one in the list
+    Entity previousEntity = bodyEntity;
+    Entity memberEntity = mIslandNextBodies[index];
+    while (memberEntity != bodyEntity) {
+
+        const uint32 memberIndex = mMapEntityToComponentIndex[memberEntity];
+        mIslandParents[memberIndex] = newRootEntity;
+        previousEntity = memberEntity;
+        memberEntity = mIslandNextBodies[memberIndex];
+    }
+    mIslandNextBodies[mMapEntityToComponentIndex[previousEntity]] = mIslandNextBodies[index];
+
+    const uint32 newRootIndex = mMapEntityToComponentIndex[newRootEntity];
+    mIslandSizes[newRootIndex] = newIslandSize;
+    mIsIslandSplitNeeded[newRootIndex] = true;
+
+    mIslandParents[index] = bodyEntity;
+    mIslandNextBodies[index] = bodyEntity;
+    mIslandSizes[index] = 1;
+    mIsIslandSplitNeeded[index] = false;
+}
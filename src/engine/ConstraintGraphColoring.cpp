@@ -0,0 +1,120 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/engine/ConstraintGraphColoring.h>
+#include <algorithm>
+
+using namespace reactphysics3d;
+
+// Static constants definitions
+const uint32 ConstraintGraphColoring::MAX_NB_COLORS;
+const uint32 ConstraintGraphColoring::IGNORED_BODY;
+
+// Constructor
+ConstraintGraphColoring::ConstraintGraphColoring(MemoryAllocator& allocator)
+                        :mConstraintsIndices(allocator), mColorsStartIndices(allocator), mBodiesColors(allocator) {
+
+}
+
+// Compute the colors of the constraints
+/**
+ * @param bodies1 For each constraint, index of its first body (or IGNORED_BODY)
+ * @param bodies2 For each constraint, index of its second body (or IGNORED_BODY)
+ * @param nbBodies Number of bodies (all the body indices must be smaller than this number)
+ */
+void ConstraintGraphColoring::computeColors(const List<uint32>& bodies1, const List<uint32>& bodies2, uint32 nbBodies) {
+
+    assert(bodies1.size() == bodies2.size());
+
+    const uint32 nbConstraints = bodies1.size();
+    const uint32 overflowColor = MAX_NB_COLORS;
+
+    // Reset the colors of the bodies
+    mBodiesColors.clear();
+    mBodiesColors.reserve(nbBodies);
+    for (uint32 b=0; b < nbBodies; b++) {
+        mBodiesColors.add(0);
+    }
+
+    // The colors are stored temporarily in the constraints indices list
+    mConstraintsIndices.clear();
+    mConstraintsIndices.reserve(nbConstraints);
+
+    // Number of constraints of each color (the last one is the overflow color)
+    uint32 nbConstraintsPerColor[MAX_NB_COLORS + 1] = {0};
+
+    // Give to each constraint the first color that is not already used by one of its bodies
+    uint32 nbColors = 0;
+    for (uint32 c=0; c < nbConstraints; c++) {
+
+        const uint32 body1 = bodies1[c];
+        const uint32 body2 = bodies2[c];
+        assert(body1 == IGNORED_BODY || body1 < nbBodies);
+        assert(body2 == IGNORED_BODY || body2 < nbBodies);
+
+        uint64 usedColors = 0;
+        if (body1 != IGNORED_BODY) usedColors |= mBodiesColors[body1];
+        if (body2 != IGNORED_BODY) usedColors |= mBodiesColors[body2];
+
+        uint32 color = overflowColor;
+        if (usedColors != ~uint64(0)) {
+
+            // Find the first bit that is not set
+            color = 0;
+            while (usedColors & (uint64(1) << color)) {
+                color++;
+            }
+
+            if (body1 != IGNORED_BODY) mBodiesColors[body1] |= uint64(1) << color;
+            if (body2 != IGNORED_BODY) mBodiesColors[body2] |= uint64(1) << color;
+
+            nbColors = std::max(nbColors, color + 1);
+        }
+
+        mConstraintsIndices.add(color);
+        nbConstraintsPerColor[color]++;
+    }
+
+    // Compute the index of the first constraint of each color
+    mColorsStartIndices.clear();
+    uint32 startIndex = 0;
+    for (uint32 color=0; color < nbColors; color++) {
+        mColorsStartIndices.add(startIndex);
+        startIndex += nbConstraintsPerColor[color];
+    }
+    mColorsStartIndices.add(startIndex);
+
+    // Sort the constraints by color (keeping their order inside each color)
+    List<uint32> constraintsColors(mConstraintsIndices);
+    uint32 insertIndices[MAX_NB_COLORS + 1];
+    for (uint32 color=0; color < nbColors; color++) {
+        insertIndices[color] = mColorsStartIndices[color];
+    }
+    insertIndices[overflowColor] = startIndex;
+    for (uint32 c=0; c < nbConstraints; c++) {
+        mConstraintsIndices[insertIndices[constraintsColors[c]]++] = c;
+    }
+}
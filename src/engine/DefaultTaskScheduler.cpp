@@ -0,0 +1,263 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/engine/DefaultTaskScheduler.h>
+
+// We want to use the ReactPhysics3D namespace
+using namespace reactphysics3d;
+
+namespace {
+
+    /// Scheduler whose tasks are currently executed by this thread (null if none)
+    thread_local const DefaultTaskScheduler* currentScheduler = nullptr;
+
+    /// Index of this thread in the scheduler whose tasks it is executing
+    thread_local uint32 currentThreadIndex = 0;
+
+    // Pack a range of task indices into a 64-bits integer
+    inline uint64 packRange(uint32 begin, uint32 end) {
+        return (static_cast<uint64>(end) << 32) | static_cast<uint64>(begin);
+    }
+
+    // Return the first index of a packed range
+    inline uint32 rangeBegin(uint64 range) {
+        return static_cast<uint32>(range & 0xFFFFFFFF);
+    }
+
+    // Return the index after the last one of a packed range
+    inline uint32 rangeEnd(uint64 range) {
+        return static_cast<uint32>(range >> 32);
+    }
+}
+
+// Constructor
+/**
+ * @param nbThreads Number of threads (including the calling thread) used to execute the
+ *                  tasks. If zero, the number of hardware threads is used.
+ */
+DefaultTaskScheduler::DefaultTaskScheduler(uint32 nbThreads)
+                     :mNbThreads(nbThreads), mWorkers(nullptr), mQueues(nullptr), mTask(nullptr),
+                      mNbRemainingTasks(0), mNbActiveWorkers(0), mJobCounter(0), mIsExiting(false) {
+
+    if (mNbThreads == 0) {
+        mNbThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    mQueues = new WorkerQueue[mNbThreads];
+    for (uint32 i=0; i < mNbThreads; i++) {
+        mQueues[i].range.store(packRange(0, 0));
+    }
+
+    // Start the worker threads (the calling thread is the thread with index zero)
+    if (mNbThreads > 1) {
+        mWorkers = new std::thread[mNbThreads - 1];
+        for (uint32 i=1; i < mNbThreads; i++) {
+            mWorkers[i - 1] = std::thread(&DefaultTaskScheduler::workerMain, this, i);
+        }
+    }
+}
+
+// Destructor
+DefaultTaskScheduler::~DefaultTaskScheduler() {
+
+    // Ask the worker threads to exit
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mIsExiting = true;
+    }
+    mJobSubmittedCondition.notify_all();
+
+    for (uint32 i=1; i < mNbThreads; i++) {
+        mWorkers[i - 1].join();
+    }
+
+    delete[] mWorkers;
+    delete[] mQueues;
+}
+
+// Execute the tasks with index in [0, nbTasks) and return when all of them are finished
+/**
+ * @param nbTasks Number of tasks to execute
+ * @param task Function executing a single task
+ */
+void DefaultTaskScheduler::runTasks(uint32 nbTasks, const Task& task) {
+
+    if (nbTasks == 0) return;
+
+    // If there are no workers or if this method is called from a task of this scheduler,
+    // we execute the tasks on the current thread
+    if (mNbThreads == 1 || nbTasks == 1 || currentScheduler == this) {
+        const uint32 threadIndex = currentScheduler == this ? currentThreadIndex : 0;
+        for (uint32 i=0; i < nbTasks; i++) {
+            task(i, threadIndex);
+        }
+        return;
+    }
+
+    // Only one job can be executed at a time
+    std::lock_guard<std::mutex> runLock(mRunMutex);
+
+    mTask = &task;
+    mNbRemainingTasks.store(nbTasks);
+
+    // Split the tasks into contiguous ranges (one per thread)
+    const uint32 nbTasksPerThread = nbTasks / mNbThreads;
+    const uint32 nbExtraTasks = nbTasks % mNbThreads;
+    uint32 begin = 0;
+    for (uint32 i=0; i < mNbThreads; i++) {
+        const uint32 end = begin + nbTasksPerThread + (i < nbExtraTasks ? 1 : 0);
+        mQueues[i].range.store(packRange(begin, end));
+        begin = end;
+    }
+    assert(begin == nbTasks);
+
+    // Wake up the workers
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mJobCounter++;
+    }
+    mJobSubmittedCondition.notify_all();
+
+    // The calling thread also executes tasks
+    currentScheduler = this;
+    currentThreadIndex = 0;
+    executeTasks(0);
+    currentScheduler = nullptr;
+
+    // Wait until all the tasks are finished and no worker is using the job anymore
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mWorkerDoneCondition.wait(lock, [this]() {
+            return mNbRemainingTasks.load() == 0 && mNbActiveWorkers == 0;
+        });
+    }
+
+    mTask = nullptr;
+}
+
+// Main function of the worker threads
+void DefaultTaskScheduler::workerMain(uint32 threadIndex) {
+
+    currentScheduler = this;
+    currentThreadIndex = threadIndex;
+
+    uint64 lastJobCounter = 0;
+
+    while (true) {
+
+        // Wait for a new job
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mJobSubmittedCondition.wait(lock, [&]() {
+                return mIsExiting || mJobCounter != lastJobCounter;
+            });
+
+            if (mIsExiting) return;
+
+            lastJobCounter = mJobCounter;
+            mNbActiveWorkers++;
+        }
+
+        executeTasks(threadIndex);
+
+        // Notify the calling thread that this worker is done with the job
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mNbActiveWorkers--;
+        }
+        mWorkerDoneCondition.notify_all();
+    }
+}
+
+// Execute tasks of the current job until no task is left to take
+void DefaultTaskScheduler::executeTasks(uint32 threadIndex) {
+
+    uint32 taskIndex;
+
+    while (mNbRemainingTasks.load() > 0) {
+
+        // Take a task from our own range first
+        bool hasTask = popTask(threadIndex, taskIndex);
+
+        // Otherwise, try to steal a task from another thread
+        for (uint32 i=1; !hasTask && i < mNbThreads; i++) {
+            hasTask = stealTask((threadIndex + i) % mNbThreads, taskIndex);
+        }
+
+        // If there is no task left to take, the remaining ones are being executed by other threads
+        if (!hasTask) return;
+
+        (*mTask)(taskIndex, threadIndex);
+
+        mNbRemainingTasks.fetch_sub(1);
+    }
+}
+
+// Take the next task from the front of the range of a thread
+/**
+ * @param queueIndex Index of the thread whose range we take the task from
+ * @param[out] taskIndex Index of the task that has been taken
+ * @return True if a task has been taken
+ */
+bool DefaultTaskScheduler::popTask(uint32 queueIndex, uint32& taskIndex) {
+
+    std::atomic<uint64>& range = mQueues[queueIndex].range;
+    uint64 currentRange = range.load();
+
+    while (rangeBegin(currentRange) < rangeEnd(currentRange)) {
+
+        const uint64 newRange = packRange(rangeBegin(currentRange) + 1, rangeEnd(currentRange));
+        if (range.compare_exchange_weak(currentRange, newRange)) {
+            taskIndex = rangeBegin(currentRange);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Steal a task from the back of the range of a thread
+/**
+ * @param queueIndex Index of the thread whose range we steal the task from
+ * @param[out] taskIndex Index of the task that has been stolen
+ * @return True if a task has been stolen
+ */
+bool DefaultTaskScheduler::stealTask(uint32 queueIndex, uint32& taskIndex) {
+
+    std::atomic<uint64>& range = mQueues[queueIndex].range;
+    uint64 currentRange = range.load();
+
+    while (rangeBegin(currentRange) < rangeEnd(currentRange)) {
+
+        const uint64 newRange = packRange(rangeBegin(currentRange), rangeEnd(currentRange) - 1);
+        if (range.compare_exchange_weak(currentRange, newRange)) {
+            taskIndex = rangeEnd(currentRange) - 1;
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,137 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/engine/LastFrameCollisionInfoPool.h>
+#include <reactphysics3d/memory/MemoryAllocator.h>
+#include <utility>
+
+using namespace reactphysics3d;
+
+// Initialization of static variables
+const uint32 LastFrameCollisionInfoPool::NB_INFOS_PER_PAGE;
+
+// Constructor
+LastFrameCollisionInfoPool::LastFrameCollisionInfoPool(MemoryAllocator& allocator)
+                           : mAllocator(allocator), mPages(allocator), mKeys(allocator), mMapKeyToIndex(allocator),
+                             mNbUsedInfos(0) {
+
+}
+
+// Destructor
+LastFrameCollisionInfoPool::~LastFrameCollisionInfoPool() {
+
+    for (uint32 i=0; i < mKeys.size(); i++) {
+        getInfoAtIndex(i)->~LastFrameCollisionInfo();
+    }
+
+    for (uint32 i=0; i < mPages.size(); i++) {
+        mAllocator.release(mPages[i], NB_INFOS_PER_PAGE * sizeof(LastFrameCollisionInfo));
+    }
+}
+
+// Swap two infos of the pool (with their keys)
+void LastFrameCollisionInfoPool::swapInfos(uint32 index1, uint32 index2) {
+
+    assert(index1 != index2);
+
+    std::swap(*getInfoAtIndex(index1), *getInfoAtIndex(index2));
+
+    const Pair<uint64, uint64> key1 = mKeys[index1];
+    mKeys[index1] = mKeys[index2];
+    mKeys[index2] = key1;
+
+    mMapKeyToIndex[mKeys[index1]] = index1;
+    mMapKeyToIndex[mKeys[index2]] = index2;
+}
+
+// Return the info with a given key (created if necessary) and mark it as used in the current frame
+/// An info that is used for the first time in the frame is swapped with the first info that has not
+/// been used yet. This only moves infos that have not been given to the narrow-phase in this frame.
+/**
+ * @param key Unique id of the pair and shape ids of the two collision shapes
+ * @return A pointer to the info that stays valid until the next call to clearObsoleteInfos()
+ */
+LastFrameCollisionInfo* LastFrameCollisionInfoPool::addInfoIfNecessary(const Pair<uint64, uint64>& key) {
+
+    uint32 index;
+
+    auto it = mMapKeyToIndex.find(key);
+    if (it != mMapKeyToIndex.end()) {
+
+        index = it->second;
+
+        // If the info has already been used in this frame
+        if (index < mNbUsedInfos) {
+            return getInfoAtIndex(index);
+        }
+    }
+    else {
+
+        index = static_cast<uint32>(mKeys.size());
+
+        // Allocate a new page in the pool if necessary
+        if (index == mPages.size() * NB_INFOS_PER_PAGE) {
+            void* page = mAllocator.allocate(NB_INFOS_PER_PAGE * sizeof(LastFrameCollisionInfo));
+            mPages.add(static_cast<LastFrameCollisionInfo*>(page));
+        }
+
+        // Create a new info at the end of the pool
+        mKeys.add(key);
+        new (getInfoAtIndex(index)) LastFrameCollisionInfo();
+        mMapKeyToIndex.add(Pair<Pair<uint64, uint64>, uint32>(key, index));
+    }
+
+    // Move the info at the end of the infos used in this frame
+    if (index != mNbUsedInfos) {
+        swapInfos(index, mNbUsedInfos);
+    }
+    mNbUsedInfos++;
+
+    return getInfoAtIndex(mNbUsedInfos - 1);
+}
+
+// Remove the infos that have not been used since the previous call and mark the others as not used
+/// The obsolete infos are all at the end of the pool and only them are visited.
+void LastFrameCollisionInfoPool::clearObsoleteInfos() {
+
+    for (uint32 index = static_cast<uint32>(mKeys.size()); index > mNbUsedInfos; index--) {
+
+        mMapKeyToIndex.remove(mKeys[index - 1]);
+        getInfoAtIndex(index - 1)->~LastFrameCollisionInfo();
+        mKeys.removeAt(index - 1);
+    }
+
+    // Release the pages that are not used anymore (we keep an empty page to avoid reallocating it)
+    const uint32 nbUsedPages = (mNbUsedInfos + NB_INFOS_PER_PAGE - 1) / NB_INFOS_PER_PAGE;
+    while (mPages.size() > nbUsedPages + 1) {
+        const uint32 lastPage = static_cast<uint32>(mPages.size()) - 1;
+        mAllocator.release(mPages[lastPage], NB_INFOS_PER_PAGE * sizeof(LastFrameCollisionInfo));
+        mPages.removeAt(lastPage);
+    }
+
+    // The remaining infos become obsolete if they are not used before the next call
+    mNbUsedInfos = 0;
+}
@@ -35,14 +35,15 @@ using namespace reactphysics3d;
 
 // Constructor
 OverlappingPairs::OverlappingPairs(MemoryAllocator& persistentMemoryAllocator, MemoryAllocator& temporaryMemoryAllocator, ColliderComponents &colliderComponents,
-                                   CollisionBodyComponents& collisionBodyComponents, RigidBodyComponents& rigidBodyComponents, Set<bodypair> &noCollisionPairs, CollisionDispatch &collisionDispatch)
+                                   CollisionBodyComponents& collisionBodyComponents, RigidBodyComponents& rigidBodyComponents, FlatSet<bodypair> &noCollisionPairs, CollisionDispatch &collisionDispatch)
                 : mPersistentAllocator(persistentMemoryAllocator), mTempMemoryAllocator(temporaryMemoryAllocator),
-                  mNbPairs(0), mConcavePairsStartIndex(0), mPairDataSize(sizeof(uint64) + sizeof(int32) + sizeof(int32) + sizeof(Entity) +
-                                                                         sizeof(Entity) + sizeof(Map<uint64, LastFrameCollisionInfo*>) +
+                  mNbPairs(0), mConcavePairsStartIndex(0), mInactivePairsStartIndex(0), mPairDataSize(sizeof(uint64) + sizeof(int32) + sizeof(int32) + sizeof(Entity) +
+                                                                         sizeof(Entity) + sizeof(uint64) + sizeof(Transform) + sizeof(Quaternion) +
                                                                          sizeof(bool) + sizeof(bool) + sizeof(NarrowPhaseAlgorithmType) +
-                                                                         sizeof(bool) + sizeof(bool) + sizeof(bool)),
+                                                                         sizeof(bool) + sizeof(bool) + sizeof(bool) + sizeof(bool)),
                   mNbAllocatedPairs(0), mBuffer(nullptr),
-                  mMapPairIdToPairIndex(persistentMemoryAllocator),
+                  mMapPairIdToPairIndex(persistentMemoryAllocator), mNextPairUniqueId(0),
+                  mLastFrameInfoPool(persistentMemoryAllocator),
                   mColliderComponents(colliderComponents), mCollisionBodyComponents(collisionBodyComponents),
                   mRigidBodyComponents(rigidBodyComponents), mNoCollisionPairs(noCollisionPairs), mCollisionDispatch(collisionDispatch) {
     
@@ -59,16 +60,6 @@ OverlappingPairs::~OverlappingPairs() {
         // Destroy all the remaining pairs
         for (uint32 i = 0; i < mNbPairs; i++) {
 
-            // Remove all the remaining last frame collision info
-            for (auto it = mLastFrameCollisionInfos[i].begin(); it != mLastFrameCollisionInfos[i].end(); ++it) {
-
-                // Call the constructor
-                it->second->~LastFrameCollisionInfo();
-
-                // Release memory
-                mPersistentAllocator.release(it->second, sizeof(LastFrameCollisionInfo));
-            }
-
             // Remove the involved overlapping pair to the two colliders
             assert(mColliderComponents.getOverlappingPairs(mColliders1[i]).find(mPairIds[i]) != mColliderComponents.getOverlappingPairs(mColliders1[i]).end());
             assert(mColliderComponents.getOverlappingPairs(mColliders2[i]).find(mPairIds[i]) != mColliderComponents.getOverlappingPairs(mColliders2[i]).end());
@@ -84,9 +75,12 @@ OverlappingPairs::~OverlappingPairs() {
         // Release the allocated memory
         mPersistentAllocator.release(mBuffer, totalSizeBytes);
     }
+
 }
 
 // Compute the index where we need to insert the new pair
+// A new pair is always inserted into the active pairs. If it is not active,
+// it is moved into the inactive pairs by updateOverlappingPairIsActive().
 uint64 OverlappingPairs::prepareAddPair(bool isConvexVsConvex) {
 
     // If we need to allocate more components
@@ -94,22 +88,23 @@ uint64 OverlappingPairs::prepareAddPair(bool isConvexVsConvex) {
         allocate(mNbAllocatedPairs * 2);
     }
 
-    uint64 index;
-
-    // If the pair to add is not convex vs convex or there are no concave pairs yet
-    if (!isConvexVsConvex) {
+    // If there already are inactive pairs
+    if (mInactivePairsStartIndex != mNbPairs) {
 
-        // Add the component at the end of the array
-        index = mNbPairs;
+        // Move the first inactive pair to the end of the array
+        movePairToIndex(mInactivePairsStartIndex, mNbPairs);
     }
+
+    uint64 index = mInactivePairsStartIndex;
+
     // If the pair to add is convex vs convex
-    else {
+    if (isConvexVsConvex) {
 
-        // If there already are convex vs concave pairs
-        if (mConcavePairsStartIndex != mNbPairs) {
+        // If there already are active convex vs concave pairs
+        if (mConcavePairsStartIndex != mInactivePairsStartIndex) {
 
-            // Move the first convex vs concave pair to the end of the array
-            movePairToIndex(mConcavePairsStartIndex, mNbPairs);
+            // Move the first convex vs concave pair to the end of the active pairs
+            movePairToIndex(mConcavePairsStartIndex, mInactivePairsStartIndex);
         }
 
         index = mConcavePairsStartIndex;
@@ -117,6 +112,8 @@ uint64 OverlappingPairs::prepareAddPair(bool isConvexVsConvex) {
         mConcavePairsStartIndex++;
     }
 
+    mInactivePairsStartIndex++;
+
     return index;
 }
 
@@ -131,18 +128,11 @@ void OverlappingPairs::removePair(uint64 pairId) {
     assert(index < mNbPairs);
 
     // We want to keep the arrays tightly packed. Therefore, when a pair is removed,
-    // we replace it with the last element of the array. But we need to make sure that convex
-    // and concave pairs stay grouped together.
-
-    // Remove all the remaining last frame collision info
-    for (auto it = mLastFrameCollisionInfos[index].begin(); it != mLastFrameCollisionInfos[index].end(); ++it) {
+    // we replace it with the last element of its group. But we need to make sure that the
+    // active convex pairs, the active concave pairs and the inactive pairs stay grouped together.
 
-        // Call the constructor
-        it->second->~LastFrameCollisionInfo();
-
-        // Release memory
-        mPersistentAllocator.release(it->second, sizeof(LastFrameCollisionInfo));
-    }
+    // The last frame collision infos of the pair are not used anymore and will be removed
+    // by the next call to clearObsoleteLastFrameCollisionInfos()
 
     // Remove the involved overlapping pair to the two colliders
     assert(mColliderComponents.getOverlappingPairs(mColliders1[index]).find(pairId) != mColliderComponents.getOverlappingPairs(mColliders1[index]).end());
@@ -153,38 +143,48 @@ void OverlappingPairs::removePair(uint64 pairId) {
     // Destroy the pair
     destroyPair(index);
 
-    // If the pair to remove is convex vs concave
-    if (index >= mConcavePairsStartIndex) {
+    // Index of the free slot in the array
+    uint64 freeIndex = index;
 
-        // If the pair is not the last one
-        if (index != mNbPairs - 1) {
+    // If the pair to remove is an active pair
+    if (freeIndex < mInactivePairsStartIndex) {
 
-            // We replace it by the last convex vs concave pair
-            movePairToIndex(mNbPairs - 1, index);
-        }
-    }
-    else {   // If the pair to remove is convex vs convex
+        // If the pair to remove is convex vs convex
+        if (freeIndex < mConcavePairsStartIndex) {
 
-        // If it not the last convex vs convex pair
-        if (index != mConcavePairsStartIndex - 1) {
+            // If it not the last convex vs convex pair
+            if (freeIndex != mConcavePairsStartIndex - 1) {
 
-            // We replace it by the last convex vs convex pair
-            movePairToIndex(mConcavePairsStartIndex - 1, index);
+                // We replace it by the last convex vs convex pair
+                movePairToIndex(mConcavePairsStartIndex - 1, freeIndex);
+            }
+
+            freeIndex = mConcavePairsStartIndex - 1;
+            mConcavePairsStartIndex--;
         }
 
-        // If there are convex vs concave pairs at the end
-        if (mConcavePairsStartIndex != mNbPairs) {
+        // If the free slot is not the last active pair
+        if (freeIndex != mInactivePairsStartIndex - 1) {
 
-            // We replace the last convex vs convex pair by the last convex vs concave pair
-            movePairToIndex(mNbPairs - 1, mConcavePairsStartIndex - 1);
+            // We replace it by the last active convex vs concave pair
+            movePairToIndex(mInactivePairsStartIndex - 1, freeIndex);
         }
 
-        mConcavePairsStartIndex--;
+        freeIndex = mInactivePairsStartIndex - 1;
+        mInactivePairsStartIndex--;
+    }
+
+    // If the free slot is not the last pair
+    if (freeIndex != mNbPairs - 1) {
+
+        // We replace it by the last inactive pair
+        movePairToIndex(mNbPairs - 1, freeIndex);
     }
 
     mNbPairs--;
 
-    assert(mConcavePairsStartIndex <= mNbPairs);
+    assert(mConcavePairsStartIndex <= mInactivePairsStartIndex);
+    assert(mInactivePairsStartIndex <= mNbPairs);
     assert(mNbPairs == static_cast<uint32>(mMapPairIdToPairIndex.size()));
 }
 
@@ -206,13 +206,16 @@ void OverlappingPairs::allocate(uint64 nbPairsToAllocate) {
     int32* newPairBroadPhaseId2 = reinterpret_cast<int32*>(newPairBroadPhaseId1 + nbPairsToAllocate);
     Entity* newColliders1 = reinterpret_cast<Entity*>(newPairBroadPhaseId2 + nbPairsToAllocate);
     Entity* newColliders2 = reinterpret_cast<Entity*>(newColliders1 + nbPairsToAllocate);
-    Map<uint64, LastFrameCollisionInfo*>* newLastFrameCollisionInfos = reinterpret_cast<Map<uint64, LastFrameCollisionInfo*>*>(newColliders2 + nbPairsToAllocate);
-    bool* newNeedToTestOverlap = reinterpret_cast<bool*>(newLastFrameCollisionInfos + nbPairsToAllocate);
+    uint64* newPairUniqueIds = reinterpret_cast<uint64*>(newColliders2 + nbPairsToAllocate);
+    Transform* newContactsShape2ToShape1 = reinterpret_cast<Transform*>(newPairUniqueIds + nbPairsToAllocate);
+    Quaternion* newLastFrameShape1Orientations = reinterpret_cast<Quaternion*>(newContactsShape2ToShape1 + nbPairsToAllocate);
+    bool* newNeedToTestOverlap = reinterpret_cast<bool*>(newLastFrameShape1Orientations + nbPairsToAllocate);
     bool* newIsActive = reinterpret_cast<bool*>(newNeedToTestOverlap + nbPairsToAllocate);
     NarrowPhaseAlgorithmType* newNarrowPhaseAlgorithmType = reinterpret_cast<NarrowPhaseAlgorithmType*>(newIsActive + nbPairsToAllocate);
     bool* newIsShape1Convex = reinterpret_cast<bool*>(newNarrowPhaseAlgorithmType + nbPairsToAllocate);
     bool* wereCollidingInPreviousFrame = reinterpret_cast<bool*>(newIsShape1Convex + nbPairsToAllocate);
     bool* areCollidingInCurrentFrame = reinterpret_cast<bool*>(wereCollidingInPreviousFrame + nbPairsToAllocate);
+    bool* newAreContactsReusable = reinterpret_cast<bool*>(areCollidingInCurrentFrame + nbPairsToAllocate);
 
     // If there was already pairs before
     if (mNbPairs > 0) {
@@ -223,13 +226,16 @@ void OverlappingPairs::allocate(uint64 nbPairsToAllocate) {
         memcpy(newPairBroadPhaseId2, mPairBroadPhaseId2, mNbPairs * sizeof(int32));
         memcpy(newColliders1, mColliders1, mNbPairs * sizeof(Entity));
         memcpy(newColliders2, mColliders2, mNbPairs * sizeof(Entity));
-        memcpy(newLastFrameCollisionInfos, mLastFrameCollisionInfos, mNbPairs * sizeof(Map<uint64, LastFrameCollisionInfo*>));
+        memcpy(newPairUniqueIds, mPairUniqueIds, mNbPairs * sizeof(uint64));
+        memcpy(newContactsShape2ToShape1, mContactsShape2ToShape1, mNbPairs * sizeof(Transform));
+        memcpy(newLastFrameShape1Orientations, mLastFrameShape1Orientations, mNbPairs * sizeof(Quaternion));
         memcpy(newNeedToTestOverlap, mNeedToTestOverlap, mNbPairs * sizeof(bool));
         memcpy(newIsActive, mIsActive, mNbPairs * sizeof(bool));
         memcpy(newNarrowPhaseAlgorithmType, mNarrowPhaseAlgorithmType, mNbPairs * sizeof(NarrowPhaseAlgorithmType));
         memcpy(newIsShape1Convex, mIsShape1Convex, mNbPairs * sizeof(bool));
         memcpy(wereCollidingInPreviousFrame, mCollidingInPreviousFrame, mNbPairs * sizeof(bool));
         memcpy(areCollidingInCurrentFrame, mCollidingInCurrentFrame, mNbPairs * sizeof(bool));
+        memcpy(newAreContactsReusable, mAreContactsReusable, mNbPairs * sizeof(bool));
 
         // Deallocate previous memory
         mPersistentAllocator.release(mBuffer, mNbAllocatedPairs * mPairDataSize);
@@ -241,13 +247,16 @@ void OverlappingPairs::allocate(uint64 nbPairsToAllocate) {
     mPairBroadPhaseId2 = newPairBroadPhaseId2;
     mColliders1 = newColliders1;
     mColliders2 = newColliders2;
-    mLastFrameCollisionInfos = newLastFrameCollisionInfos;
+    mPairUniqueIds = newPairUniqueIds;
+    mContactsShape2ToShape1 = newContactsShape2ToShape1;
+    mLastFrameShape1Orientations = newLastFrameShape1Orientations;
     mNeedToTestOverlap = newNeedToTestOverlap;
     mIsActive = newIsActive;
     mNarrowPhaseAlgorithmType = newNarrowPhaseAlgorithmType;
     mIsShape1Convex = newIsShape1Convex;
     mCollidingInPreviousFrame = wereCollidingInPreviousFrame;
     mCollidingInCurrentFrame = areCollidingInCurrentFrame;
+    mAreContactsReusable = newAreContactsReusable;
 
     mNbAllocatedPairs = nbPairsToAllocate;
 }
@@ -285,7 +294,7 @@ uint64 OverlappingPairs::addPair(Collider* shape1, Collider* shape2) {
     NarrowPhaseAlgorithmType algorithmType;
     if (isConvexVsConvex) {
 
-        algorithmType = mCollisionDispatch.selectNarrowPhaseAlgorithm(collisionShape1->getType(), collisionShape2->getType());
+        algorithmType = mCollisionDispatch.selectNarrowPhaseAlgorithm(collisionShape1, collisionShape2);
     }
     else {
 
@@ -299,13 +308,18 @@ uint64 OverlappingPairs::addPair(Collider* shape1, Collider* shape2) {
     new (mPairBroadPhaseId2 + index) int32(shape2->getBroadPhaseId());
     new (mColliders1 + index) Entity(shape1->getEntity());
     new (mColliders2 + index) Entity(shape2->getEntity());
-    new (mLastFrameCollisionInfos + index) Map<uint64, LastFrameCollisionInfo*>(mPersistentAllocator);
+    new (mPairUniqueIds + index) uint64(mNextPairUniqueId);
+    new (mContactsShape2ToShape1 + index) Transform(Transform::identity());
+    new (mLastFrameShape1Orientations + index) Quaternion(Quaternion::identity());
     new (mNeedToTestOverlap + index) bool(false);
     new (mIsActive + index) bool(true);
     new (mNarrowPhaseAlgorithmType + index) NarrowPhaseAlgorithmType(algorithmType);
     new (mIsShape1Convex + index) bool(isShape1Convex);
     new (mCollidingInPreviousFrame + index) bool(false);
     new (mCollidingInCurrentFrame + index) bool(false);
+    new (mAreContactsReusable + index) bool(false);
+
+    mNextPairUniqueId++;
 
     // Map the entity with the new component lookup index
     mMapPairIdToPairIndex.add(Pair<uint64, uint64>(pairId, index));
@@ -318,7 +332,8 @@ uint64 OverlappingPairs::addPair(Collider* shape1, Collider* shape2) {
 
     mNbPairs++;
 
-    assert(mConcavePairsStartIndex <= mNbPairs);
+    assert(mConcavePairsStartIndex <= mInactivePairsStartIndex);
+    assert(mInactivePairsStartIndex <= mNbPairs);
     assert(mNbPairs == static_cast<uint64>(mMapPairIdToPairIndex.size()));
 
     updateOverlappingPairIsActive(pairId);
@@ -338,13 +353,16 @@ void OverlappingPairs::movePairToIndex(uint64 srcIndex, uint64 destIndex) {
     mPairBroadPhaseId2[destIndex] = mPairBroadPhaseId2[srcIndex];
     new (mColliders1 + destIndex) Entity(mColliders1[srcIndex]);
     new (mColliders2 + destIndex) Entity(mColliders2[srcIndex]);
-    new (mLastFrameCollisionInfos + destIndex) Map<uint64, LastFrameCollisionInfo*>(mLastFrameCollisionInfos[srcIndex]);
+    mPairUniqueIds[destIndex] = mPairUniqueIds[srcIndex];
+    new (mContactsShape2ToShape1 + destIndex) Transform(mContactsShape2ToShape1[srcIndex]);
+    new (mLastFrameShape1Orientations + destIndex) Quaternion(mLastFrameShape1Orientations[srcIndex]);
     mNeedToTestOverlap[destIndex] = mNeedToTestOverlap[srcIndex];
     mIsActive[destIndex] = mIsActive[srcIndex];
     new (mNarrowPhaseAlgorithmType + destIndex) NarrowPhaseAlgorithmType(mNarrowPhaseAlgorithmType[srcIndex]);
     mIsShape1Convex[destIndex] = mIsShape1Convex[srcIndex];
     mCollidingInPreviousFrame[destIndex] = mCollidingInPreviousFrame[srcIndex];
     mCollidingInCurrentFrame[destIndex] = mCollidingInCurrentFrame[srcIndex];
+    mAreContactsReusable[destIndex] = mAreContactsReusable[srcIndex];
 
     // Destroy the source pair
     destroyPair(srcIndex);
@@ -366,13 +384,16 @@ void OverlappingPairs::swapPairs(uint64 index1, uint64 index2) {
     int32 pairBroadPhaseId2 = mPairBroadPhaseId2[index1];
     Entity collider1 = mColliders1[index1];
     Entity collider2 = mColliders2[index1];
-    Map<uint64, LastFrameCollisionInfo*> lastFrameCollisionInfo(mLastFrameCollisionInfos[index1]);
+    uint64 pairUniqueId = mPairUniqueIds[index1];
+    Transform contactsShape2ToShape1 = mContactsShape2ToShape1[index1];
+    Quaternion lastFrameShape1Orientation = mLastFrameShape1Orientations[index1];
     bool needTestOverlap = mNeedToTestOverlap[index1];
     bool isActive = mIsActive[index1];
     NarrowPhaseAlgorithmType narrowPhaseAlgorithmType = mNarrowPhaseAlgorithmType[index1];
     bool isShape1Convex = mIsShape1Convex[index1];
     bool wereCollidingInPreviousFrame = mCollidingInPreviousFrame[index1];
     bool areCollidingInCurrentFrame = mCollidingInCurrentFrame[index1];
+    bool areContactsReusable = mAreContactsReusable[index1];
 
     // Destroy pair 1
     destroyPair(index1);
@@ -385,13 +406,16 @@ void OverlappingPairs::swapPairs(uint64 index1, uint64 index2) {
     mPairBroadPhaseId2[index2] = pairBroadPhaseId2;
     new (mColliders1 + index2) Entity(collider1);
     new (mColliders2 + index2) Entity(collider2);
-    new (mLastFrameCollisionInfos + index2) Map<uint64, LastFrameCollisionInfo*>(lastFrameCollisionInfo);
+    mPairUniqueIds[index2] = pairUniqueId;
+    new (mContactsShape2ToShape1 + index2) Transform(contactsShape2ToShape1);
+    new (mLastFrameShape1Orientations + index2) Quaternion(lastFrameShape1Orientation);
     mNeedToTestOverlap[index2] = needTestOverlap;
     mIsActive[index2] = isActive;
     new (mNarrowPhaseAlgorithmType + index2) NarrowPhaseAlgorithmType(narrowPhaseAlgorithmType);
     mIsShape1Convex[index2] = isShape1Convex;
     mCollidingInPreviousFrame[index2] = wereCollidingInPreviousFrame;
     mCollidingInCurrentFrame[index2] = areCollidingInCurrentFrame;
+    mAreContactsReusable[index2] = areContactsReusable;
 
     // Update the pairID to pair index mapping
     mMapPairIdToPairIndex.add(Pair<uint64, uint64>(pairId, index2));
@@ -412,8 +436,9 @@ void OverlappingPairs::destroyPair(uint64 index) {
 
     mColliders1[index].~Entity();
     mColliders2[index].~Entity();
-    mLastFrameCollisionInfos[index].~Map<uint64, LastFrameCollisionInfo*>();
     mNarrowPhaseAlgorithmType[index].~NarrowPhaseAlgorithmType();
+    mContactsShape2ToShape1[index].~Transform();
+    mLastFrameShape1Orientations[index].~Quaternion();
 }
 
 // Update whether a given overlapping pair is active or not
@@ -443,7 +468,61 @@ void OverlappingPairs::updateOverlappingPairIsActive(uint64 pairId) {
     bodypair bodiesIndex = OverlappingPairs::computeBodiesIndexPair(body1, body2);
     bool bodiesCanCollide = !mNoCollisionPairs.contains(bodiesIndex);
 
-    mIsActive[pairIndex] = bodiesCanCollide && (isBody1Active || isBody2Active);
+    const bool isActive = bodiesCanCollide && (isBody1Active || isBody2Active);
+
+    // If the pair becomes active, we move it into the active pairs
+    if (isActive && !mIsActive[pairIndex]) {
+
+        assert(pairIndex >= mInactivePairsStartIndex);
+
+        const bool isConvexVsConvex = isConvexVsConvexPair(pairIndex);
+
+        // Move the pair at the beginning of the inactive pairs and make it the last active pair
+        uint64 index = mInactivePairsStartIndex;
+        if (pairIndex != index) {
+            swapPairs(pairIndex, index);
+        }
+        mInactivePairsStartIndex++;
+
+        // If the pair is convex vs convex, make it the last active convex vs convex pair
+        if (isConvexVsConvex) {
+            if (index != mConcavePairsStartIndex) {
+                swapPairs(index, mConcavePairsStartIndex);
+            }
+            index = mConcavePairsStartIndex;
+            mConcavePairsStartIndex++;
+        }
+
+        mIsActive[index] = true;
+    }
+    // If the pair becomes inactive, we move it into the inactive pairs
+    else if (!isActive && mIsActive[pairIndex]) {
+
+        assert(pairIndex < mInactivePairsStartIndex);
+
+        uint64 index = pairIndex;
+
+        // If the pair is convex vs convex, make it the first active convex vs concave pair
+        if (index < mConcavePairsStartIndex) {
+            if (index != mConcavePairsStartIndex - 1) {
+                swapPairs(index, mConcavePairsStartIndex - 1);
+            }
+            index = mConcavePairsStartIndex - 1;
+            mConcavePairsStartIndex--;
+        }
+
+        // Make it the first inactive pair
+        if (index != mInactivePairsStartIndex - 1) {
+            swapPairs(index, mInactivePairsStartIndex - 1);
+        }
+        index = mInactivePairsStartIndex - 1;
+        mInactivePairsStartIndex--;
+
+        mIsActive[index] = false;
+    }
+
+    assert(mConcavePairsStartIndex <= mInactivePairsStartIndex);
+    assert(mInactivePairsStartIndex <= mNbPairs);
 }
 
 // Add a new last frame collision info if it does not exist for the given shapes already
@@ -460,67 +539,25 @@ LastFrameCollisionInfo* OverlappingPairs::addLastFrameInfoIfNecessary(uint64 pai
        minShapeId = shapeId1;
     }
 
-    // Try to get the corresponding last frame collision info
-    const uint64 shapesId = pairNumbers(maxShapeId, minShapeId);
-
-    // If there is no collision info for those two shapes already
-    auto it = mLastFrameCollisionInfos[pairIndex].find(shapesId);
-    if (it == mLastFrameCollisionInfos[pairIndex].end()) {
-
-        // Create a new collision info
-        LastFrameCollisionInfo* collisionInfo = new (mPersistentAllocator.allocate(sizeof(LastFrameCollisionInfo)))
-                                                LastFrameCollisionInfo();
-
-        // Add it into the map of collision infos
-        mLastFrameCollisionInfos[pairIndex].add(Pair<uint64, LastFrameCollisionInfo*>(shapesId, collisionInfo));
-
-        return collisionInfo;
-    }
-    else {
-
-       // The existing collision info is not obsolete
-       it->second->isObsolete = false;
-
-       return it->second;
-    }
+    // Get the corresponding last frame collision info (created if necessary)
+    return mLastFrameInfoPool.addInfoIfNecessary(Pair<uint64, uint64>(mPairUniqueIds[pairIndex], pairNumbers(maxShapeId, minShapeId)));
 }
 
 // Delete all the obsolete last frame collision info
+// The infos that have not been used since the previous call to this method are obsolete.
 void OverlappingPairs::clearObsoleteLastFrameCollisionInfos() {
 
     RP3D_PROFILE("OverlappingPairs::clearObsoleteLastFrameCollisionInfos()", mProfiler);
 
-    // For each overlapping pair
-    for (uint64 i=0; i < mNbPairs; i++) {
-
-        // For each collision info
-        for (auto it = mLastFrameCollisionInfos[i].begin(); it != mLastFrameCollisionInfos[i].end(); ) {
-
-            // If the collision info is obsolete
-            if (it->second->isObsolete) {
-
-                // Delete it
-                it->second->~LastFrameCollisionInfo();
-                mPersistentAllocator.release(it->second, sizeof(LastFrameCollisionInfo));
-
-                it = mLastFrameCollisionInfos[i].remove(it);
-            }
-            else {  // If the collision info is not obsolete
-
-                // Do not delete it but mark it as obsolete
-                it->second->isObsolete = true;
-
-                ++it;
-            }
-        }
-    }
+    mLastFrameInfoPool.clearObsoleteInfos();
 }
 
-// Set the collidingInPreviousFrame value with the collidinginCurrentFrame value for each pair
+// Set the collidingInPreviousFrame value with the collidinginCurrentFrame value for each active pair
+// The inactive pairs are not tested in the narrow-phase and their two values are already equal
 void OverlappingPairs::updateCollidingInPreviousFrame() {
 
-    // For each overlapping pair
-    for (uint64 i=0; i < mNbPairs; i++) {
+    // For each active overlapping pair
+    for (uint64 i=0; i < mInactivePairsStartIndex; i++) {
 
         mCollidingInPreviousFrame[i] = mCollidingInCurrentFrame[i];
     }
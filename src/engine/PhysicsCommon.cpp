@@ -25,6 +25,9 @@
 
 // Libraries
 #include <reactphysics3d/engine/PhysicsCommon.h>
+#include <reactphysics3d/collision/MeshCooker.h>
+#include <reactphysics3d/collision/PolygonVertexArray.h>
+#include <reactphysics3d/collision/TriangleVertexArray.h>
 
 using namespace reactphysics3d;
 
@@ -34,9 +37,11 @@ Logger* PhysicsCommon::mLogger = nullptr;
 /// Constructor
 /**
  * @param baseMemoryAllocator Pointer to a user custom memory allocator
+ * @param taskScheduler Pointer to a user custom task scheduler used by the worlds
+ *                      that do not have a task scheduler in their settings
  */
-PhysicsCommon::PhysicsCommon(MemoryAllocator* baseMemoryAllocator)
-              : mMemoryManager(baseMemoryAllocator),
+PhysicsCommon::PhysicsCommon(MemoryAllocator* baseMemoryAllocator, TaskScheduler* taskScheduler)
+              : mMemoryManager(baseMemoryAllocator), mTaskScheduler(taskScheduler),
                 mPhysicsWorlds(mMemoryManager.getHeapAllocator()), mSphereShapes(mMemoryManager.getHeapAllocator()),
                 mBoxShapes(mMemoryManager.getHeapAllocator()), mCapsuleShapes(mMemoryManager.getHeapAllocator()),
                 mConvexMeshShapes(mMemoryManager.getHeapAllocator()), mConcaveMeshShapes(mMemoryManager.getHeapAllocator()),
@@ -138,7 +143,13 @@ PhysicsWorld* PhysicsCommon::createPhysicsWorld(const PhysicsWorld::WorldSetting
 
 #endif
 
-    PhysicsWorld* world = new(mMemoryManager.allocate(MemoryManager::AllocationType::Heap, sizeof(PhysicsWorld))) PhysicsWorld(mMemoryManager, worldSettings, profiler);
+    // If the world does not have its own task scheduler, we use the one of the physics common
+    PhysicsWorld::WorldSettings settings = worldSettings;
+    if (settings.taskScheduler == nullptr) {
+        settings.taskScheduler = mTaskScheduler;
+    }
+
+    PhysicsWorld* world = new(mMemoryManager.allocate(MemoryManager::AllocationType::Heap, sizeof(PhysicsWorld))) PhysicsWorld(mMemoryManager, settings, profiler);
 
     mPhysicsWorlds.add(world);
 
@@ -352,6 +363,34 @@ HeightFieldShape* PhysicsCommon::createHeightFieldShape(int nbGridColumns, int n
     return shape;
 }
 
+// Create and return a height-field shape from cooked data
+/// The height values are not copied and the cooked data must remain valid during the life of the shape.
+/**
+ * @param cookedData Pointer to the data cooked with MeshCooker::cookHeightField() (aligned on 8 bytes)
+ * @param cookedDataSize Size of the cooked data in bytes
+ * @param scaling Scaling factor of the height field
+ * @param isChecksumVerified True if the checksum of the cooked data has to be verified
+ * @return A pointer to the created height field shape or null if the cooked data is not valid
+ */
+HeightFieldShape* PhysicsCommon::createHeightFieldShapeFromCookedData(const void* cookedData, size_t cookedDataSize,
+                                                                      const Vector3& scaling, bool isChecksumVerified) {
+
+    if (!MeshCooker::isCookedDataValid(cookedData, cookedDataSize, MeshCooker::CookedDataType::HEIGHT_FIELD, isChecksumVerified)) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when creating a HeightFieldShape from cooked data",  __FILE__, __LINE__);
+
+        return nullptr;
+    }
+
+    const MeshCooker::HeightFieldData& data = *MeshCooker::getArray<MeshCooker::HeightFieldData>(cookedData, MeshCooker::ALIGNMENT);
+
+    return createHeightFieldShape(data.nbColumns, data.nbRows, data.minHeight, data.maxHeight,
+                                  MeshCooker::getArray<void>(cookedData, data.heightsOffset),
+                                  static_cast<HeightFieldShape::HeightDataType>(data.heightDataType),
+                                  data.upAxis, data.integerHeightScale, scaling);
+}
+
 // Destroy a height-field shape
 /**
  * @param heightFieldShape A pointer to the height field shape to destroy
@@ -425,6 +464,50 @@ PolyhedronMesh* PhysicsCommon::createPolyhedronMesh(PolygonVertexArray* polygonV
     return mesh;
 }
 
+// Create a polyhedron mesh from cooked data
+/// The vertices and faces are not copied and the cooked data must remain valid during the life of the mesh.
+/// The half-edge structure of the mesh is not computed but copied from the cooked data.
+/**
+ * @param cookedData Pointer to the data cooked with MeshCooker::cookPolyhedronMesh() (aligned on 8 bytes)
+ * @param cookedDataSize Size of the cooked data in bytes
+ * @param isChecksumVerified True if the checksum of the cooked data has to be verified
+ * @return A pointer to the created polyhedron mesh or null if the cooked data is not valid
+ */
+PolyhedronMesh* PhysicsCommon::createPolyhedronMeshFromCookedData(const void* cookedData, size_t cookedDataSize, bool isChecksumVerified) {
+
+    if (!MeshCooker::isCookedDataValid(cookedData, cookedDataSize, MeshCooker::CookedDataType::POLYHEDRON_MESH, isChecksumVerified)) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when creating a PolyhedronMesh from cooked data",  __FILE__, __LINE__);
+
+        return nullptr;
+    }
+
+    const MeshCooker::PolyhedronMeshData& data = *MeshCooker::getArray<MeshCooker::PolyhedronMeshData>(cookedData, MeshCooker::ALIGNMENT);
+
+    // The polygon faces are only read by the polygon vertex array
+    PolygonVertexArray::PolygonFace* faces = const_cast<PolygonVertexArray::PolygonFace*>(
+                MeshCooker::getArray<PolygonVertexArray::PolygonFace>(cookedData, data.facesOffset));
+
+    const PolygonVertexArray::VertexDataType vertexType = sizeof(decimal) == sizeof(float) ? PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE :
+                                                                                             PolygonVertexArray::VertexDataType::VERTEX_DOUBLE_TYPE;
+
+    // The polygon vertex array is destroyed with the mesh
+    PolygonVertexArray* polygonVertexArray = new (mMemoryManager.allocate(MemoryManager::AllocationType::Heap, sizeof(PolygonVertexArray)))
+            PolygonVertexArray(data.nbVertices, MeshCooker::getArray<decimal>(cookedData, data.verticesOffset), 3 * sizeof(decimal),
+                               MeshCooker::getArray<uint32>(cookedData, data.facesIndicesOffset), sizeof(uint32), data.nbFaces, faces,
+                               vertexType, PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+
+    PolyhedronMesh* mesh = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(PolyhedronMesh)))
+            PolyhedronMesh(polygonVertexArray, MeshCooker::getArray<HalfEdgeStructure::Edge>(cookedData, data.halfEdgesOffset), data.nbHalfEdges,
+                           MeshCooker::getArray<uint32>(cookedData, data.verticesEdgesOffset),
+                           MeshCooker::getArray<uint32>(cookedData, data.facesEdgesOffset), mMemoryManager.getHeapAllocator());
+
+    mPolyhedronMeshes.add(mesh);
+
+    return mesh;
+}
+
 // Destroy a polyhedron mesh
 /**
  * @param polyhedronMesh A pointer to the polyhedron mesh to destroy
@@ -453,6 +536,59 @@ TriangleMesh* PhysicsCommon::createTriangleMesh() {
     return mesh;
 }
 
+// Create a triangle mesh from cooked data
+/// The vertices, normals and indices of the triangles are not copied and the cooked data must remain
+/// valid during the life of the mesh. The AABB tree of the triangles stored in the cooked data is
+/// used by the concave mesh shapes created with this mesh instead of being built again.
+/**
+ * @param cookedData Pointer to the data cooked with MeshCooker::cookTriangleMesh() (aligned on 8 bytes)
+ * @param cookedDataSize Size of the cooked data in bytes
+ * @param isChecksumVerified True if the checksum of the cooked data has to be verified
+ * @return A pointer to the created triangle mesh or null if the cooked data is not valid
+ */
+TriangleMesh* PhysicsCommon::createTriangleMeshFromCookedData(const void* cookedData, size_t cookedDataSize, bool isChecksumVerified) {
+
+    if (!MeshCooker::isCookedDataValid(cookedData, cookedDataSize, MeshCooker::CookedDataType::TRIANGLE_MESH, isChecksumVerified)) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when creating a TriangleMesh from cooked data",  __FILE__, __LINE__);
+
+        return nullptr;
+    }
+
+    const MeshCooker::TriangleMeshData& data = *MeshCooker::getArray<MeshCooker::TriangleMeshData>(cookedData, MeshCooker::ALIGNMENT);
+    const MeshCooker::TriangleMeshSubpartData* subparts = MeshCooker::getArray<MeshCooker::TriangleMeshSubpartData>(cookedData, data.subpartsOffset);
+
+    TriangleMesh* mesh = createTriangleMesh();
+
+    const TriangleVertexArray::VertexDataType vertexType = sizeof(decimal) == sizeof(float) ? TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE :
+                                                                                              TriangleVertexArray::VertexDataType::VERTEX_DOUBLE_TYPE;
+    const TriangleVertexArray::NormalDataType normalType = sizeof(decimal) == sizeof(float) ? TriangleVertexArray::NormalDataType::NORMAL_FLOAT_TYPE :
+                                                                                              TriangleVertexArray::NormalDataType::NORMAL_DOUBLE_TYPE;
+
+    // Create a triangle vertex array for each sub-part (destroyed with the mesh)
+    mesh->mCookedTriangleArrays.reserve(data.nbSubparts);
+    for (uint32 s=0; s < data.nbSubparts; s++) {
+
+        TriangleVertexArray* triangleArray = new (mMemoryManager.allocate(MemoryManager::AllocationType::Heap, sizeof(TriangleVertexArray)))
+                TriangleVertexArray(subparts[s].nbVertices, MeshCooker::getArray<decimal>(cookedData, subparts[s].verticesOffset), 3 * sizeof(decimal),
+                                    MeshCooker::getArray<decimal>(cookedData, subparts[s].normalsOffset), 3 * sizeof(decimal),
+                                    subparts[s].nbTriangles, MeshCooker::getArray<uint32>(cookedData, subparts[s].indicesOffset), 3 * sizeof(uint32),
+                                    vertexType, normalType, TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+
+        mesh->mCookedTriangleArrays.add(triangleArray);
+        mesh->addSubpart(triangleArray);
+    }
+
+    mesh->mCookedTreeNodes = MeshCooker::getArray<StaticAABBTreeNode>(cookedData, data.treeNodesOffset);
+    mesh->mCookedTreeRootReference = data.treeRootReference;
+    mesh->mCookedTreeRootAABB = AABB(Vector3(data.treeRootMin[0], data.treeRootMin[1], data.treeRootMin[2]),
+                                     Vector3(data.treeRootMax[0], data.treeRootMax[1], data.treeRootMax[2]));
+    mesh->mCookedTreeNbTriangles = data.nbTriangles;
+
+    return mesh;
+}
+
 // Destroy a triangle mesh
 /**
  * @param A pointer to the triangle mesh to destroy
@@ -35,6 +35,7 @@
 #include <reactphysics3d/engine/Island.h>
 #include <reactphysics3d/collision/ContactManifold.h>
 #include <reactphysics3d/containers/Stack.h>
+#include <reactphysics3d/containers/FlatMap.h>
 
 // Namespaces
 using namespace reactphysics3d;
@@ -51,21 +52,26 @@ uint PhysicsWorld::mNbWorlds = 0;
  * @param profiler Pointer to the profiler
  */
 PhysicsWorld::PhysicsWorld(MemoryManager& memoryManager, const WorldSettings& worldSettings, Profiler* profiler)
-              : mMemoryManager(memoryManager), mConfig(worldSettings), mEntityManager(mMemoryManager.getHeapAllocator()), mDebugRenderer(mMemoryManager.getHeapAllocator()),
+              : mMemoryManager(memoryManager, 1), mConfig(worldSettings),
+                mDefaultTaskScheduler(worldSettings.taskScheduler != nullptr ? 1 : worldSettings.nbThreads),
+                mTaskScheduler(worldSettings.taskScheduler != nullptr ? *worldSettings.taskScheduler : mDefaultTaskScheduler),
+                mEntityManager(mMemoryManager.getHeapAllocator()), mDebugRenderer(mMemoryManager.getHeapAllocator()),
                 mCollisionBodyComponents(mMemoryManager.getHeapAllocator()), mRigidBodyComponents(mMemoryManager.getHeapAllocator()),
                 mTransformComponents(mMemoryManager.getHeapAllocator()), mCollidersComponents(mMemoryManager.getHeapAllocator()),
                 mJointsComponents(mMemoryManager.getHeapAllocator()), mBallAndSocketJointsComponents(mMemoryManager.getHeapAllocator()),
                 mFixedJointsComponents(mMemoryManager.getHeapAllocator()), mHingeJointsComponents(mMemoryManager.getHeapAllocator()),
                 mSliderJointsComponents(mMemoryManager.getHeapAllocator()), mCollisionDetection(this, mCollidersComponents, mTransformComponents, mCollisionBodyComponents, mRigidBodyComponents,
-                                        mMemoryManager),
+                                        mMemoryManager, mTaskScheduler, mConfig.broadPhaseType, mConfig.fatAABBInflatePercentage,
+                                        mConfig.fatAABBDisplacementMultiplier),
                 mCollisionBodies(mMemoryManager.getHeapAllocator()), mEventListener(nullptr),
                 mName(worldSettings.worldName),  mIslands(mMemoryManager.getSingleFrameAllocator()),
-                mContactSolverSystem(mMemoryManager, *this, mIslands, mCollisionBodyComponents, mRigidBodyComponents,
+                mContactSolverSystem(mMemoryManager, *this, mTaskScheduler, mIslands, mCollisionBodyComponents, mRigidBodyComponents,
                                mCollidersComponents, mConfig.restitutionVelocityThreshold),
-                mConstraintSolverSystem(*this, mIslands, mRigidBodyComponents, mTransformComponents, mJointsComponents,
+                mConstraintSolverSystem(*this, mMemoryManager, mTaskScheduler, mIslands, mRigidBodyComponents, mTransformComponents, mJointsComponents,
                                         mBallAndSocketJointsComponents, mFixedJointsComponents, mHingeJointsComponents,
                                         mSliderJointsComponents),
-                mDynamicsSystem(*this, mCollisionBodyComponents, mRigidBodyComponents, mTransformComponents, mCollidersComponents, mIsGravityEnabled, mConfig.gravity),
+                mDynamicsSystem(*this, mCollisionBodyComponents, mRigidBodyComponents, mTransformComponents, mCollidersComponents, mTaskScheduler,
+                                mIsGravityEnabled, mConfig.gravity),
                 mNbVelocitySolverIterations(mConfig.defaultVelocitySolverNbIterations),
                 mNbPositionSolverIterations(mConfig.defaultPositionSolverNbIterations), 
                 mIsSleepingEnabled(mConfig.isSleepingEnabled), mRigidBodies(mMemoryManager.getPoolAllocator()),
@@ -85,6 +91,11 @@ PhysicsWorld::PhysicsWorld(MemoryManager& memoryManager, const WorldSettings& wo
         mName = ss.str();
     }
 
+    mContactSolverSystem.setIsWideSolverActive(mConfig.isWideContactSolverEnabled);
+
+    // Each thread of the task scheduler needs its own allocators
+    mMemoryManager.reserveThreadAllocators(mTaskScheduler.getNbThreads());
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 
@@ -342,6 +353,12 @@ void PhysicsWorld::update(decimal timeStep) {
     // Create the islands
     createIslands();
 
+    // Create the actual narrow-phase contacts (sorted by island)
+    mCollisionDetection.createContacts(mIslands.contactPairsIndices);
+
+    // Flag the islands that might have been disconnected by the lost contacts
+    flagIslandsWithLostContacts();
+
     // Report the contacts to the user
     mCollisionDetection.reportContactsAndTriggers();
 
@@ -368,6 +385,12 @@ void PhysicsWorld::update(decimal timeStep) {
 
     if (mIsSleepingEnabled) updateSleepingBodies(timeStep);
 
+    // Split the islands that have not been split by the sleeping technique
+    splitFlaggedIslands();
+
+    // The contact pairs of the bodies are not needed anymore
+    mCollisionDetection.mMapBodyToContactPairs.clear(true);
+
     // Reset the external force and torque applied to the bodies
     mDynamicsSystem.resetBodiesForceAndTorque();
 
@@ -397,15 +420,57 @@ void PhysicsWorld::solveContactsAndConstraints(decimal timeStep) {
     // Initialize the constraint solver
     mConstraintSolverSystem.initialize(timeStep);
 
-    // For each iteration of the velocity solver
-    for (uint i=0; i<mNbVelocitySolverIterations; i++) {
-
-        mConstraintSolverSystem.solveVelocityConstraints();
+    // Select the islands that are solved using a graph coloring of their constraints
+    for (uint32 islandIndex=0; islandIndex < mIslands.getNbIslands(); islandIndex++) {
+        mIslands.isSolvedWithGraphColoring[islandIndex] = isIslandSolvedWithGraphColoring(islandIndex);
+    }
 
-        mContactSolverSystem.solve();
+    // Pack the contact manifolds into blocks for the wide contact solver
+    if (mContactSolverSystem.isWideSolverActive()) {
+        mContactSolverSystem.createBlocks();
     }
 
-    mContactSolverSystem.storeImpulses();
+    // The islands do not share any dynamic body and are therefore solved in parallel. Inside an island,
+    // the joints and contacts are solved in the same order as they would be by a sequential solver
+    mTaskScheduler.parallelFor(0, mIslands.getNbIslands(), PARALLEL_ISLANDS_GRAIN_SIZE,
+                               [&](uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+
+        for (uint32 islandIndex=startIndex; islandIndex < endIndex; islandIndex++) {
+
+            // The large islands are solved afterwards
+            if (mIslands.isSolvedWithGraphColoring[islandIndex]) continue;
+
+            // For each iteration of the velocity solver
+            for (uint i=0; i<mNbVelocitySolverIterations; i++) {
+
+                mConstraintSolverSystem.solveVelocityConstraints(islandIndex);
+
+                mContactSolverSystem.solve(islandIndex);
+            }
+
+            mContactSolverSystem.storeImpulses(islandIndex);
+        }
+    });
+
+    // A large island would be solved by a single thread. Instead, its constraints are colored and
+    // the constraints of each color are solved in parallel
+    for (uint32 islandIndex=0; islandIndex < mIslands.getNbIslands(); islandIndex++) {
+
+        if (!mIslands.isSolvedWithGraphColoring[islandIndex]) continue;
+
+        mConstraintSolverSystem.computeIslandColoring(islandIndex);
+        mContactSolverSystem.computeIslandColoring(islandIndex);
+
+        // For each iteration of the velocity solver
+        for (uint i=0; i<mNbVelocitySolverIterations; i++) {
+
+            mConstraintSolverSystem.solveColoredIslandVelocityConstraints();
+
+            mContactSolverSystem.solveColoredIsland();
+        }
+
+        mContactSolverSystem.storeImpulses(islandIndex);
+    }
 
     // Reset the contact solver
     mContactSolverSystem.reset();
@@ -418,14 +483,39 @@ void PhysicsWorld::solvePositionCorrection() {
 
     // ---------- Solve the position error correction for the constraints ---------- //
 
-    // For each iteration of the position (error correction) solver
-    for (uint i=0; i<mNbPositionSolverIterations; i++) {
+    // Note that the islands are not solved in parallel here because the non-linear-gauss-seidel
+    // position solver of the joints renormalizes the orientation of the static bodies that are
+    // shared between several islands. Only the joints of the large islands are solved in parallel
+    // using a coloring that also takes the static bodies into account.
+    for (uint32 islandIndex=0; islandIndex < mIslands.getNbIslands(); islandIndex++) {
+
+        if (mIslands.isSolvedWithGraphColoring[islandIndex]) {
 
-        // Solve the position constraints
-        mConstraintSolverSystem.solvePositionConstraints();
+            mConstraintSolverSystem.computeIslandColoring(islandIndex);
+
+            // For each iteration of the position (error correction) solver
+            for (uint i=0; i<mNbPositionSolverIterations; i++) {
+                mConstraintSolverSystem.solveColoredIslandPositionConstraints();
+            }
+        }
+        else {
+
+            // For each iteration of the position (error correction) solver
+            for (uint i=0; i<mNbPositionSolverIterations; i++) {
+                mConstraintSolverSystem.solvePositionConstraints(islandIndex);
+            }
+        }
     }
 }
 
+// Return true if an island has to be solved using a graph coloring of its constraints
+bool PhysicsWorld::isIslandSolvedWithGraphColoring(uint32 islandIndex) const {
+
+    const uint minNbConstraints = mConfig.minNbConstraintsGraphColoring;
+    return minNbConstraints > 0 &&
+           mIslands.nbContactManifolds[islandIndex] + mConstraintSolverSystem.getNbIslandJoints(islandIndex) >= minNbConstraints;
+}
+
 // Disable the joints for pair of sleeping bodies
 void PhysicsWorld::disableJointsOfSleepingBodies() {
 
@@ -510,6 +600,9 @@ void PhysicsWorld::destroyRigidBody(RigidBody* rigidBody) {
         destroyJoint(mJointsComponents.getJoint(joints[i]));
     }
 
+    // Remove the body from its island
+    mRigidBodyComponents.removeBodyFromIsland(rigidBody->getEntity());
+
     // Destroy the corresponding entity and its components
     mCollisionBodyComponents.removeComponent(rigidBody->getEntity());
     mRigidBodyComponents.removeComponent(rigidBody->getEntity());
@@ -519,8 +612,15 @@ void PhysicsWorld::destroyRigidBody(RigidBody* rigidBody) {
     // Call the destructor of the rigid body
     rigidBody->~RigidBody();
 
-    // Remove the rigid body from the list of rigid bodies
-    mRigidBodies.remove(rigidBody);
+    // Remove the rigid body from the list of rigid bodies. The bodies are usually destroyed in the
+    // reverse order of their creation (when the world is destroyed for instance) and are therefore
+    // searched from the end of the list
+    for (uint32 i=mRigidBodies.size(); i > 0; i--) {
+        if (mRigidBodies[i - 1] == rigidBody) {
+            mRigidBodies.removeAt(i - 1);
+            break;
+        }
+    }
 
     // Free the object from the memory allocator
     mMemoryManager.release(MemoryManager::AllocationType::Pool, rigidBody, sizeof(RigidBody));
@@ -679,6 +779,9 @@ void PhysicsWorld::destroyJoint(Joint* joint) {
     mRigidBodyComponents.removeJointFromBody(body1->getEntity(), joint->getEntity());
     mRigidBodyComponents.removeJointFromBody(body2->getEntity(), joint->getEntity());
 
+    // The island of the two bodies might not be connected anymore
+    mRigidBodyComponents.setIsIslandSplitNeeded(body1->getEntity());
+
     size_t nbBytes = joint->getSizeInBytes();
 
     Entity jointEntity = joint->getEntity();
@@ -733,150 +836,302 @@ void PhysicsWorld::addJointToBodies(Entity body1, Entity body2, Entity joint) {
              "Body " + std::to_string(body2.id) + ": Joint " + std::to_string(joint.id) + " added to body",  __FILE__, __LINE__);
 }
 
+// Return true if a contact pair is a constraint between two rigid bodies that is solved in the islands
+bool PhysicsWorld::isIslandContactPair(const ContactPair& pair) const {
+
+    return mRigidBodyComponents.hasComponent(pair.body1Entity) && mRigidBodyComponents.hasComponent(pair.body2Entity) &&
+           !mCollidersComponents.getIsTrigger(pair.collider1Entity) && !mCollidersComponents.getIsTrigger(pair.collider2Entity);
+}
+
 // Compute the islands using potential contacts and joints
 /// We compute the islands before creating the actual contacts here because we want all
 /// the contact manifolds and contact points of the same island
 /// to be packed together into linear arrays of manifolds and contacts for better caching.
 /// An island is an isolated group of rigid bodies that have constraints (joints or contacts)
-/// between each other. This method computes the islands at each time step as follows: For each
-/// awake rigid body, we run a Depth First Search (DFS) through the constraint graph of that body
-/// (graph where nodes are the bodies and where the edges are the constraints between the bodies) to
-/// find all the bodies that are connected with it (the bodies that share joints or contacts with
-/// it). Then, we create an island with this group of connected bodies.
+/// between each other. The islands are persistent: each non-static body belongs to a union-find
+/// set of bodies that is kept from one frame to the next one. At each time step, the islands
+/// of the bodies that are connected by a contact or a joint are merged. A sleeping island is
+/// woken up as a whole when it is merged with an awake one. The islands are never split here:
+/// an island that might have been disconnected is only flagged and is split later, when some of
+/// its bodies are about to fall asleep (see updateSleepingBodies()) or within the budget of
+/// bodies split at each frame (see splitFlaggedIslands()).
 void PhysicsWorld::createIslands() {
 
     RP3D_PROFILE("PhysicsWorld::createIslands()", mProfiler);
 
-    // Reset all the isAlreadyInIsland variables of bodies and joints
-    for (uint b=0; b < mRigidBodyComponents.getNbComponents(); b++) {
+    List<ContactPair>& contactPairs = *(mCollisionDetection.mCurrentContactPairs);
+
+    // Merge the islands of the non-static bodies that are in contact
+    List<Entity> bodiesToAwake(mMemoryManager.getSingleFrameAllocator());
+    for (uint32 p=0; p < contactPairs.size(); p++) {
 
-        mRigidBodyComponents.mIsAlreadyInIsland[b] = false;
+        const ContactPair& pair = contactPairs[p];
+        if (!isIslandContactPair(pair)) continue;
+
+        if (mRigidBodyComponents.getBodyType(pair.body1Entity) == BodyType::STATIC ||
+            mRigidBodyComponents.getBodyType(pair.body2Entity) == BodyType::STATIC) continue;
+
+        mRigidBodyComponents.mergeIslands(pair.body1Entity, pair.body2Entity);
+
+        // A sleeping body in contact with an awake one has to be woken up
+        const bool isBody1Sleeping = mRigidBodyComponents.getIsSleeping(pair.body1Entity);
+        const bool isBody2Sleeping = mRigidBodyComponents.getIsSleeping(pair.body2Entity);
+        if (isBody1Sleeping != isBody2Sleeping) {
+            bodiesToAwake.add(isBody1Sleeping ? pair.body1Entity : pair.body2Entity);
+        }
     }
-    for (uint32 i=0; i < mJointsComponents.getNbComponents(); i++) {
-        mJointsComponents.mIsAlreadyInIsland[i] = false;
+    for (uint32 i=0; i < bodiesToAwake.size(); i++) {
+        awakeIsland(bodiesToAwake[i]);
     }
 
-    // Create a stack for the bodies to visit during the Depth First Search
-    Stack<Entity> bodyEntityIndicesToVisit(mMemoryManager.getSingleFrameAllocator());
+    // Merge the islands of the awake bodies with the islands of the bodies they are jointed to. Note that
+    // waking up an island moves its bodies at the end of the enabled components and they are visited as well.
+    for (uint32 b=0; b < mRigidBodyComponents.getNbEnabledComponents(); b++) {
+
+        if (mRigidBodyComponents.mBodyTypes[b] == BodyType::STATIC) continue;
+
+        const Entity bodyEntity = mRigidBodyComponents.mBodiesEntities[b];
 
-    uint nbTotalManifolds = 0;
+        for (uint32 i=0; i < mRigidBodyComponents.mJoints[b].size(); i++) {
 
-    // For each rigid body component
-    for (uint b=0; b < mRigidBodyComponents.getNbEnabledComponents(); b++) {
+            const Entity jointEntity = mRigidBodyComponents.mJoints[b][i];
+            const Entity body1Entity = mJointsComponents.getBody1Entity(jointEntity);
+            const Entity otherBodyEntity = body1Entity == bodyEntity ? mJointsComponents.getBody2Entity(jointEntity) : body1Entity;
 
-        // If the body has already been added to an island, we go to the next body
-        if (mRigidBodyComponents.mIsAlreadyInIsland[b]) continue;
+            if (mRigidBodyComponents.getBodyType(otherBodyEntity) == BodyType::STATIC) continue;
+
+            mRigidBodyComponents.mergeIslands(bodyEntity, otherBodyEntity);
+
+            if (mRigidBodyComponents.getIsSleeping(otherBodyEntity)) {
+                awakeIsland(otherBodyEntity);
+            }
+        }
+    }
+
+    // Create an island for each persistent island that contains awake bodies
+    FlatMap<Entity, uint32> mapIslandRootToIslandIndex(mMemoryManager.getSingleFrameAllocator());
+    for (uint32 b=0; b < mRigidBodyComponents.getNbEnabledComponents(); b++) {
 
-        // If the body is static, we go to the next body
         if (mRigidBodyComponents.mBodyTypes[b] == BodyType::STATIC) continue;
 
-        // Reset the stack of bodies to visit
-        bodyEntityIndicesToVisit.clear();
+        const Entity bodyEntity = mRigidBodyComponents.mBodiesEntities[b];
+        const Entity rootEntity = mRigidBodyComponents.getIslandRoot(bodyEntity);
+
+        uint32 islandIndex;
+        auto it = mapIslandRootToIslandIndex.find(rootEntity);
+        if (it != mapIslandRootToIslandIndex.end()) {
+            islandIndex = it->second;
+        }
+        else {
+            islandIndex = mIslands.addIsland(0);
+            mapIslandRootToIslandIndex.add(Pair<Entity, uint32>(rootEntity, islandIndex));
+        }
+
+        mIslands.bodyEntities[islandIndex].add(bodyEntity);
+    }
 
-        // Add the body into the stack of bodies to visit
-        mRigidBodyComponents.mIsAlreadyInIsland[b] = true;
-        bodyEntityIndicesToVisit.push(mRigidBodyComponents.mBodiesEntities[b]);
+    const uint32 nbIslands = mIslands.getNbIslands();
 
-        // Create the new island
-        uint32 islandIndex = mIslands.addIsland(nbTotalManifolds);
+    // Find the island of each contact pair and count the contact pairs and manifolds of each island
+    List<uint32> pairsIslands(mMemoryManager.getSingleFrameAllocator(), contactPairs.size());
+    List<uint32> islandsPairsStartIndices(mMemoryManager.getSingleFrameAllocator(), nbIslands + 1);
+    for (uint32 i=0; i <= nbIslands; i++) {
+        islandsPairsStartIndices.add(0);
+    }
+    for (uint32 p=0; p < contactPairs.size(); p++) {
 
-        // While there are still some bodies to visit in the stack
-        while (bodyEntityIndicesToVisit.size() > 0) {
+        ContactPair& pair = contactPairs[p];
+        pairsIslands.add(nbIslands);
 
-            // Get the next body to visit from the stack
-            const Entity bodyToVisitEntity = bodyEntityIndicesToVisit.pop();
+        if (!isIslandContactPair(pair)) continue;
 
-            // Add the body into the island
-            mIslands.bodyEntities[islandIndex].add(bodyToVisitEntity);
+        // The island of the pair is the island of its non-static body(ies)
+        const Entity bodyEntity = mRigidBodyComponents.getBodyType(pair.body1Entity) != BodyType::STATIC ?
+                                      pair.body1Entity : pair.body2Entity;
 
-            RigidBody* rigidBodyToVisit = static_cast<RigidBody*>(mCollisionBodyComponents.getBody(bodyToVisitEntity));
+        // A pair between a sleeping body and a static one is not solved
+        if (mRigidBodyComponents.getIsEntityDisabled(bodyEntity)) continue;
 
-            // Awake the body if it is sleeping
-            rigidBodyToVisit->setIsSleeping(false);
+        const uint32 islandIndex = mapIslandRootToIslandIndex[mRigidBodyComponents.getIslandRoot(bodyEntity)];
 
-            // If the current body is static, we do not want to perform the DFS search across that body
-            if (rigidBodyToVisit->getType() == BodyType::STATIC) continue;
+        assert(pair.potentialContactManifoldsIndices.size() > 0);
+        mIslands.nbContactManifolds[islandIndex] += pair.potentialContactManifoldsIndices.size();
+        islandsPairsStartIndices[islandIndex + 1]++;
+        pairsIslands[p] = islandIndex;
+        pair.isAlreadyInIsland = true;
+    }
 
-            // If the body is involved in contacts with other bodies
-            auto itBodyContactPairs = mCollisionDetection.mMapBodyToContactPairs.find(bodyToVisitEntity);
-            if (itBodyContactPairs != mCollisionDetection.mMapBodyToContactPairs.end()) {
+    // Sort the contact pairs by island (the order of the pairs of an island is preserved)
+    uint32 nbTotalManifolds = 0;
+    for (uint32 i=0; i < nbIslands; i++) {
+        mIslands.contactManifoldsIndices[i] = nbTotalManifolds;
+        nbTotalManifolds += mIslands.nbContactManifolds[i];
+        islandsPairsStartIndices[i + 1] += islandsPairsStartIndices[i];
+    }
+    const uint32 nbIslandsPairs = islandsPairsStartIndices[nbIslands];
+    mIslands.contactPairsIndices.reserve(nbIslandsPairs);
+    for (uint32 p=0; p < nbIslandsPairs; p++) {
+        mIslands.contactPairsIndices.add(0);
+    }
+    for (uint32 p=0; p < contactPairs.size(); p++) {
 
-                // For each contact pair in which the current body is involded
-                List<uint>& contactPairs = itBodyContactPairs->second;
-                for (uint p=0; p < contactPairs.size(); p++) {
+        const uint32 islandIndex = pairsIslands[p];
+        if (islandIndex == nbIslands) continue;
 
-                    ContactPair& pair = (*mCollisionDetection.mCurrentContactPairs)[contactPairs[p]];
+        mIslands.contactPairsIndices[islandsPairsStartIndices[islandIndex]] = p;
+        islandsPairsStartIndices[islandIndex]++;
+    }
+}
 
-                    // Check if the current contact pair has already been added into an island
-                    if (pair.isAlreadyInIsland) continue;
+// Flag the islands that have lost a contact between two of their bodies
+/// This method has to be called after the creation of the contacts because the lost contact
+/// pairs are only known at this point.
+void PhysicsWorld::flagIslandsWithLostContacts() {
 
-                    // If the colliding body is a RigidBody (and not a CollisionBody) and is not a trigger
-                    if (mRigidBodyComponents.hasComponent(pair.body1Entity) && mRigidBodyComponents.hasComponent(pair.body2Entity)
-                        && !mCollidersComponents.getIsTrigger(pair.collider1Entity) && !mCollidersComponents.getIsTrigger(pair.collider2Entity)) {
+    for (uint32 p=0; p < mCollisionDetection.mLostContactPairs.size(); p++) {
 
-                        assert(pair.potentialContactManifoldsIndices.size() > 0);
-                        nbTotalManifolds += pair.potentialContactManifoldsIndices.size();
+        const ContactPair& lostPair = mCollisionDetection.mLostContactPairs[p];
 
-                        // Add the contact manifold into the island
-                        mIslands.nbContactManifolds[islandIndex] += pair.potentialContactManifoldsIndices.size();
-                        pair.isAlreadyInIsland = true;
+        // The bodies of the pair might have been destroyed since the last frame
+        if (!mRigidBodyComponents.hasComponent(lostPair.body1Entity) || !mRigidBodyComponents.hasComponent(lostPair.body2Entity)) continue;
 
-                        const Entity otherBodyEntity = pair.body1Entity == bodyToVisitEntity ? pair.body2Entity : pair.body1Entity;
+        if (lostPair.isTrigger) continue;
 
-                        // Check if the other body has already been added to the island
-                        if (mRigidBodyComponents.getIsAlreadyInIsland(otherBodyEntity)) continue;
+        // A static body does not connect an island
+        if (mRigidBodyComponents.getBodyType(lostPair.body1Entity) == BodyType::STATIC ||
+            mRigidBodyComponents.getBodyType(lostPair.body2Entity) == BodyType::STATIC) continue;
 
-                        // Insert the other body into the stack of bodies to visit
-                        bodyEntityIndicesToVisit.push(otherBodyEntity);
-                        mRigidBodyComponents.setIsAlreadyInIsland(otherBodyEntity, true);
-                    }
-                    else {
+        mRigidBodyComponents.setIsIslandSplitNeeded(lostPair.body1Entity);
+    }
+}
 
-                        // Add the contact pair index in the list of contact pairs that won't be part of islands
-                        pair.isAlreadyInIsland = true;
-                    }
+// Wake up all the bodies of the persistent island of a body
+void PhysicsWorld::awakeIsland(Entity bodyEntity) {
+
+    Entity memberEntity = bodyEntity;
+    do {
+
+        if (mRigidBodyComponents.getIsSleeping(memberEntity)) {
+            mRigidBodyComponents.getRigidBody(memberEntity)->setIsSleeping(false);
+        }
+
+        memberEntity = mRigidBodyComponents.getIslandNextBody(memberEntity);
+
+    } while (memberEntity != bodyEntity);
+}
+
+// Split the persistent island of a body into its connected parts
+/// We run a Depth First Search (DFS) through the current contacts and the joints between the
+/// bodies of the island only. The roots of the resulting islands are added into a list.
+void PhysicsWorld::splitIsland(Entity bodyEntity, List<Entity>& newIslandsRoots) {
+
+    RP3D_PROFILE("PhysicsWorld::splitIsland()", mProfiler);
+
+    const Entity rootEntity = mRigidBodyComponents.getIslandRoot(bodyEntity);
+
+    // Reset the isAlreadyInIsland variables of the bodies of the island
+    Entity memberEntity = rootEntity;
+    do {
+        mRigidBodyComponents.setIsAlreadyInIsland(memberEntity, false);
+        memberEntity = mRigidBodyComponents.getIslandNextBody(memberEntity);
+    } while (memberEntity != rootEntity);
+
+    // Bodies of the island sorted by connected part
+    List<Entity> sortedBodies(mMemoryManager.getSingleFrameAllocator(), mRigidBodyComponents.mIslandSizes[mRigidBodyComponents.getEntityIndex(rootEntity)]);
+    List<uint32> partsStartIndices(mMemoryManager.getSingleFrameAllocator());
+
+    // Create a stack for the bodies to visit during the Depth First Search
+    Stack<Entity> bodyEntitiesToVisit(mMemoryManager.getSingleFrameAllocator());
+
+    // The bodies are not relinked during the search because the original island is used to know
+    // if a body belongs to it
+    memberEntity = rootEntity;
+    do {
+
+        const Entity startBodyEntity = memberEntity;
+        memberEntity = mRigidBodyComponents.getIslandNextBody(memberEntity);
+
+        if (mRigidBodyComponents.getIsAlreadyInIsland(startBodyEntity)) continue;
+
+        partsStartIndices.add(sortedBodies.size());
+        mRigidBodyComponents.setIsAlreadyInIsland(startBodyEntity, true);
+        bodyEntitiesToVisit.push(startBodyEntity);
+
+        // While there are still some bodies to visit in the stack
+        while (bodyEntitiesToVisit.size() > 0) {
+
+            // Get the next body to visit from the stack
+            const Entity bodyToVisitEntity = bodyEntitiesToVisit.pop();
+            sortedBodies.add(bodyToVisitEntity);
+
+            // For each contact pair in which the current body is involved
+            auto itBodyContactPairs = mCollisionDetection.mMapBodyToContactPairs.find(bodyToVisitEntity);
+            if (itBodyContactPairs != mCollisionDetection.mMapBodyToContactPairs.end()) {
+
+                const List<uint>& contactPairs = itBodyContactPairs->second;
+                for (uint32 p=0; p < contactPairs.size(); p++) {
+
+                    const ContactPair& pair = (*mCollisionDetection.mCurrentContactPairs)[contactPairs[p]];
+                    if (!isIslandContactPair(pair)) continue;
+
+                    const Entity otherBodyEntity = pair.body1Entity == bodyToVisitEntity ? pair.body2Entity : pair.body1Entity;
+
+                    if (mRigidBodyComponents.getBodyType(otherBodyEntity) == BodyType::STATIC) continue;
+                    if (mRigidBodyComponents.getIsAlreadyInIsland(otherBodyEntity)) continue;
+                    if (mRigidBodyComponents.getIslandRoot(otherBodyEntity) != rootEntity) continue;
+
+                    bodyEntitiesToVisit.push(otherBodyEntity);
+                    mRigidBodyComponents.setIsAlreadyInIsland(otherBodyEntity, true);
                 }
             }
 
             // For each joint in which the current body is involved
-            const List<Entity>& joints = mRigidBodyComponents.getJoints(rigidBodyToVisit->getEntity());
+            const List<Entity>& joints = mRigidBodyComponents.getJoints(bodyToVisitEntity);
             for (uint32 i=0; i < joints.size(); i++) {
 
-                // Check if the current joint has already been added into an island
-                if (mJointsComponents.getIsAlreadyInIsland(joints[i])) continue;
-
-                // Add the joint into the island
-                mJointsComponents.setIsAlreadyInIsland(joints[i], true);
-
                 const Entity body1Entity = mJointsComponents.getBody1Entity(joints[i]);
-                const Entity body2Entity = mJointsComponents.getBody2Entity(joints[i]);
-                const Entity otherBodyEntity = body1Entity == bodyToVisitEntity ? body2Entity : body1Entity;
+                const Entity otherBodyEntity = body1Entity == bodyToVisitEntity ? mJointsComponents.getBody2Entity(joints[i]) : body1Entity;
 
-                // Check if the other body has already been added to the island
+                if (mRigidBodyComponents.getBodyType(otherBodyEntity) == BodyType::STATIC) continue;
                 if (mRigidBodyComponents.getIsAlreadyInIsland(otherBodyEntity)) continue;
+                if (mRigidBodyComponents.getIslandRoot(otherBodyEntity) != rootEntity) continue;
 
-                // Insert the other body into the stack of bodies to visit
-                bodyEntityIndicesToVisit.push(otherBodyEntity);
+                bodyEntitiesToVisit.push(otherBodyEntity);
                 mRigidBodyComponents.setIsAlreadyInIsland(otherBodyEntity, true);
             }
         }
 
-        // Reset the isAlreadyIsland variable of the static bodies so that they
-        // can also be included in the other islands
-        for (uint j=0; j < mRigidBodyComponents.getNbEnabledComponents(); j++) {
+    } while (memberEntity != rootEntity);
 
-            if (mRigidBodyComponents.mBodyTypes[j] == BodyType::STATIC) {
-                mRigidBodyComponents.mIsAlreadyInIsland[j] = false;
-            }
+    partsStartIndices.add(sortedBodies.size());
+
+    // Relink the bodies of each connected part into its own island
+    for (uint32 i=0; i < partsStartIndices.size() - 1; i++) {
+
+        const uint32 startIndex = partsStartIndices[i];
+        const uint32 endIndex = partsStartIndices[i + 1];
+        const Entity newRootEntity = sortedBodies[startIndex];
+
+        for (uint32 b=startIndex; b < endIndex; b++) {
+
+            const uint32 index = mRigidBodyComponents.getEntityIndex(sortedBodies[b]);
+            mRigidBodyComponents.mIslandParents[index] = newRootEntity;
+            mRigidBodyComponents.mIslandNextBodies[index] = sortedBodies[b + 1 < endIndex ? b + 1 : startIndex];
         }
-    }
 
-    mCollisionDetection.mMapBodyToContactPairs.clear(true);
+        const uint32 newRootIndex = mRigidBodyComponents.getEntityIndex(newRootEntity);
+        mRigidBodyComponents.mIslandSizes[newRootIndex] = endIndex - startIndex;
+        mRigidBodyComponents.mIsIslandSplitNeeded[newRootIndex] = false;
+
+        newIslandsRoots.add(newRootEntity);
+    }
 }
 
 // Put bodies to sleep if needed.
 /// For each island, if all the bodies have been almost still for a long enough period of
-/// time, we put all the bodies of the island to sleep.
+/// time, we put all the bodies of the island to sleep. An island that has been flagged as
+/// possibly disconnected is first split into its connected parts as soon as one of its bodies
+/// is ready to sleep so that the parts that are still can fall asleep independently.
 void PhysicsWorld::updateSleepingBodies(decimal timeStep) {
 
     RP3D_PROFILE("PhysicsWorld::updateSleepingBodies()", mProfiler);
@@ -884,19 +1139,19 @@ void PhysicsWorld::updateSleepingBodies(decimal timeStep) {
     const decimal sleepLinearVelocitySquare = mSleepLinearVelocity * mSleepLinearVelocity;
     const decimal sleepAngularVelocitySquare = mSleepAngularVelocity * mSleepAngularVelocity;
 
+    List<Entity> newIslandsRoots(mMemoryManager.getSingleFrameAllocator());
+
     // For each island of the world
     for (uint i=0; i<mIslands.getNbIslands(); i++) {
 
         decimal minSleepTime = DECIMAL_LARGEST;
+        decimal maxSleepTime = decimal(0.0);
 
         // For each body of the island
         for (uint b=0; b < mIslands.bodyEntities[i].size(); b++) {
 
             const Entity bodyEntity = mIslands.bodyEntities[i][b];
 
-            // Skip static bodies
-            if (mRigidBodyComponents.getBodyType(bodyEntity) == BodyType::STATIC) continue;
-
             // If the body is velocity is large enough to stay awake
             if (mRigidBodyComponents.getLinearVelocity(bodyEntity).lengthSquare() > sleepLinearVelocitySquare ||
                 mRigidBodyComponents.getAngularVelocity(bodyEntity).lengthSquare() > sleepAngularVelocitySquare ||
@@ -915,13 +1170,43 @@ void PhysicsWorld::updateSleepingBodies(decimal timeStep) {
                 if (sleepTime < minSleepTime) {
                     minSleepTime = sleepTime;
                 }
+                if (sleepTime > maxSleepTime) {
+                    maxSleepTime = sleepTime;
+                }
+            }
+        }
+
+        // If some bodies of an island that might be disconnected are ready to sleep
+        if (maxSleepTime >= mTimeBeforeSleep && mRigidBodyComponents.getIsIslandSplitNeeded(mIslands.bodyEntities[i][0])) {
+
+            // Split the island and put to sleep the parts where all the bodies are ready to sleep
+            newIslandsRoots.clear();
+            splitIsland(mIslands.bodyEntities[i][0], newIslandsRoots);
+            for (uint32 r=0; r < newIslandsRoots.size(); r++) {
+
+                bool isReadyToSleep = true;
+                Entity bodyEntity = newIslandsRoots[r];
+                do {
+                    if (!mRigidBodyComponents.getIsSleeping(bodyEntity) && mRigidBodyComponents.getSleepTime(bodyEntity) < mTimeBeforeSleep) {
+                        isReadyToSleep = false;
+                        break;
+                    }
+                    bodyEntity = mRigidBodyComponents.getIslandNextBody(bodyEntity);
+                } while (bodyEntity != newIslandsRoots[r]);
+
+                if (isReadyToSleep) {
+                    do {
+                        mRigidBodyComponents.getRigidBody(bodyEntity)->setIsSleeping(true);
+                        bodyEntity = mRigidBodyComponents.getIslandNextBody(bodyEntity);
+                    } while (bodyEntity != newIslandsRoots[r]);
+                }
             }
         }
 
         // If the velocity of all the bodies of the island is under the
         // sleeping velocity threshold for a period of time larger than
         // the time required to become a sleeping body
-        if (minSleepTime >= mTimeBeforeSleep) {
+        else if (minSleepTime >= mTimeBeforeSleep) {
 
             // Put all the bodies of the island to sleep
             for (uint b=0; b < mIslands.bodyEntities[i].size(); b++) {
@@ -934,6 +1219,45 @@ void PhysicsWorld::updateSleepingBodies(decimal timeStep) {
     }
 }
 
+// Split the islands that might not be connected anymore within a budget of bodies
+/// Without this, an island that is not split by the sleeping technique (because sleeping is disabled
+/// or because its bodies keep moving) would only grow and its disconnected parts would never be solved
+/// in parallel. The islands are split in order until NB_SPLIT_ISLANDS_BODIES_PER_FRAME bodies have
+/// been visited. The remaining flagged islands are split during the next frames.
+void PhysicsWorld::splitFlaggedIslands() {
+
+    RP3D_PROFILE("PhysicsWorld::splitFlaggedIslands()", mProfiler);
+
+    List<Entity> newIslandsRoots(mMemoryManager.getSingleFrameAllocator());
+
+    uint32 nbSplitBodies = 0;
+    for (uint32 i=0; i < mIslands.getNbIslands() && nbSplitBodies < NB_SPLIT_ISLANDS_BODIES_PER_FRAME; i++) {
+
+        // The island might have been split and put to sleep by the sleeping technique
+        const Entity bodyEntity = mIslands.bodyEntities[i][0];
+        if (mRigidBodyComponents.getIsSleeping(bodyEntity) || !mRigidBodyComponents.getIsIslandSplitNeeded(bodyEntity)) continue;
+
+        newIslandsRoots.clear();
+        splitIsland(bodyEntity, newIslandsRoots);
+        nbSplitBodies += mIslands.bodyEntities[i].size();
+    }
+}
+
+// Return true if two rigid bodies are in the same island
+/// Two bodies are in the same island if they are connected by contacts and joints. An island whose
+/// bodies have been disconnected is only split at the end of a frame. A static body is not in any island.
+/**
+ * @param body1 Pointer to the first body
+ * @param body2 Pointer to the second body
+ * @return True if the two bodies are in the same island
+ */
+bool PhysicsWorld::areBodiesInSameIsland(const RigidBody* body1, const RigidBody* body2) {
+
+    if (body1->getType() == BodyType::STATIC || body2->getType() == BodyType::STATIC) return false;
+
+    return mRigidBodyComponents.getIslandRoot(body1->getEntity()) == mRigidBodyComponents.getIslandRoot(body2->getEntity());
+}
+
 // Enable/Disable the sleeping technique.
 /// The sleeping technique is used to put bodies that are not moving into sleep
 /// to speed up the simulation.
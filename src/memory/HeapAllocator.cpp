@@ -36,7 +36,7 @@ size_t HeapAllocator::INIT_ALLOCATED_SIZE = 5 * 1048576;    // 5 Mb
 
 // Constructor
 HeapAllocator::HeapAllocator(MemoryAllocator& baseAllocator, size_t initAllocatedMemory)
-              : mBaseAllocator(baseAllocator), mAllocatedMemory(0), mMemoryUnits(nullptr), mCachedFreeUnit(nullptr) {
+              : mBaseAllocator(baseAllocator), mAllocatedMemory(0), mMemoryUnits(nullptr), mFreeUnits(nullptr), mCachedFreeUnit(nullptr) {
 
 #ifndef NDEBUG
         mNbTimesAllocateMethodCalled = 0;
@@ -95,6 +95,8 @@ void HeapAllocator::splitMemoryUnit(MemoryUnitHeader* unit, size_t size) {
         unit->isNextContiguousMemory = true;
         unit->size = size;
 
+        addFreeUnit(newUnit);
+
        assert(unit->previousUnit == nullptr || unit->previousUnit->nextUnit == unit);
        assert(unit->nextUnit == nullptr || unit->nextUnit->previousUnit == unit);
 
@@ -119,7 +121,7 @@ void* HeapAllocator::allocate(size_t size) {
         mNbTimesAllocateMethodCalled++;
 #endif
 
-    MemoryUnitHeader* currentUnit = mMemoryUnits;
+    MemoryUnitHeader* currentUnit = mFreeUnits;
     assert(mMemoryUnits->previousUnit == nullptr);
 
     // If there is a cached free memory unit
@@ -133,11 +135,13 @@ void* HeapAllocator::allocate(size_t size) {
         }
     }
 
-    // For each memory unit
+    // For each free memory unit
     while (currentUnit != nullptr) {
 
+        assert(!currentUnit->isAllocated);
+
         // If we have found a free memory unit with size large enough for the allocation request
-        if (!currentUnit->isAllocated && size <= currentUnit->size) {
+        if (size <= currentUnit->size) {
 
             // Split the free memory unit in two memory units, one with the requested memory size
             // and a second one with the left over space
@@ -146,7 +150,7 @@ void* HeapAllocator::allocate(size_t size) {
             break;
         }
 
-        currentUnit = currentUnit->nextUnit;
+        currentUnit = currentUnit->nextFreeUnit;
     }
 
     // If we have not found a large enough memory unit we need to allocate more memory
@@ -165,6 +169,7 @@ void* HeapAllocator::allocate(size_t size) {
         splitMemoryUnit(currentUnit, size);
     }
 
+    removeFreeUnit(currentUnit);
     currentUnit->isAllocated = true;
 
     // Cache the next memory unit if it is not allocated
@@ -195,6 +200,7 @@ void HeapAllocator::release(void* pointer, size_t size) {
     MemoryUnitHeader* unit = reinterpret_cast<MemoryUnitHeader*>(unitLocation);
     assert(unit->isAllocated);
     unit->isAllocated = false;
+    addFreeUnit(unit);
 
     MemoryUnitHeader* currentUnit = unit;
 
@@ -235,6 +241,8 @@ void HeapAllocator::mergeUnits(MemoryUnitHeader* unit1, MemoryUnitHeader* unit2)
    }
    unit1->isNextContiguousMemory = unit2->isNextContiguousMemory;
 
+   removeFreeUnit(unit2);
+
    // Destroy unit 2
    unit2->~MemoryUnitHeader();
 
@@ -259,7 +267,43 @@ void HeapAllocator::reserve(size_t sizeToAllocate) {
     // Add the memory unit at the beginning of the linked-list of memory units
     mMemoryUnits = memoryUnit;
 
+    addFreeUnit(memoryUnit);
+
     mCachedFreeUnit = mMemoryUnits;
 
     mAllocatedMemory += sizeToAllocate;
 }
+
+// Add a memory unit into the linked-list of free memory units
+void HeapAllocator::addFreeUnit(MemoryUnitHeader* unit) {
+
+    assert(!unit->isAllocated);
+
+    unit->previousFreeUnit = nullptr;
+    unit->nextFreeUnit = mFreeUnits;
+    if (mFreeUnits != nullptr) {
+        mFreeUnits->previousFreeUnit = unit;
+    }
+    mFreeUnits = unit;
+}
+
+// Remove a memory unit from the linked-list of free memory units
+void HeapAllocator::removeFreeUnit(MemoryUnitHeader* unit) {
+
+    assert(unit->previousFreeUnit == nullptr || unit->previousFreeUnit->nextFreeUnit == unit);
+    assert(unit->nextFreeUnit == nullptr || unit->nextFreeUnit->previousFreeUnit == unit);
+
+    if (unit->previousFreeUnit != nullptr) {
+        unit->previousFreeUnit->nextFreeUnit = unit->nextFreeUnit;
+    }
+    else {
+        assert(mFreeUnits == unit);
+        mFreeUnits = unit->nextFreeUnit;
+    }
+    if (unit->nextFreeUnit != nullptr) {
+        unit->nextFreeUnit->previousFreeUnit = unit->previousFreeUnit;
+    }
+
+    unit->previousFreeUnit = nullptr;
+    unit->nextFreeUnit = nullptr;
+}
@@ -25,14 +25,92 @@
 
 // Libraries
 #include <reactphysics3d/memory/MemoryManager.h>
+#include <new>
 
 using namespace reactphysics3d;
 
 // Constructor
 MemoryManager::MemoryManager(MemoryAllocator* baseAllocator, size_t initAllocatedMemory) :
                mBaseAllocator(baseAllocator == nullptr ? &mDefaultAllocator : baseAllocator),
-               mHeapAllocator(*mBaseAllocator, initAllocatedMemory),
-               mPoolAllocator(mHeapAllocator),
-               mSingleFrameAllocator(mHeapAllocator) {
+               mIsOwningAllocators(true), mThreadAllocators(nullptr), mNbThreadAllocators(0) {
 
+    // Create the heap and pool allocators
+    mHeapAllocator = new (mBaseAllocator->allocate(sizeof(HeapAllocator))) HeapAllocator(*mBaseAllocator, initAllocatedMemory);
+    mPoolAllocator = new (mBaseAllocator->allocate(sizeof(PoolAllocator))) PoolAllocator(*mHeapAllocator);
+
+    // The thread running the simulation step always has allocators
+    reserveThreadAllocators(1);
+}
+
+// Constructor of a memory manager that shares the allocators of another one except for the thread allocators
+/// The base, heap and pool allocators (which are thread-safe) of the shared memory manager are used
+/// but this memory manager has its own single frame allocators and pool allocator caches. The shared
+/// memory manager must be destroyed after this one.
+/**
+ * @param sharedMemoryManager The memory manager whose base, heap and pool allocators are used
+ * @param nbThreads Number of threads that need allocators
+ */
+MemoryManager::MemoryManager(MemoryManager& sharedMemoryManager, uint32 nbThreads)
+              : mBaseAllocator(sharedMemoryManager.mBaseAllocator), mHeapAllocator(sharedMemoryManager.mHeapAllocator),
+                mPoolAllocator(sharedMemoryManager.mPoolAllocator), mIsOwningAllocators(false),
+                mThreadAllocators(nullptr), mNbThreadAllocators(0) {
+
+    // The thread running the simulation step always has allocators
+    reserveThreadAllocators(nbThreads > 0 ? nbThreads : 1);
+}
+
+// Destructor
+MemoryManager::~MemoryManager() {
+
+    // Destroy the allocators of the threads (the caches give back their memory units to the pool allocator)
+    for (uint32 i=0; i < mNbThreadAllocators; i++) {
+        mThreadAllocators[i]->~ThreadAllocators();
+        mBaseAllocator->release(mThreadAllocators[i], sizeof(ThreadAllocators));
+    }
+    mBaseAllocator->release(mThreadAllocators, mNbThreadAllocators * sizeof(ThreadAllocators*));
+
+    // Destroy the heap and pool allocators if they are not shared
+    if (mIsOwningAllocators) {
+        mPoolAllocator->~PoolAllocator();
+        mBaseAllocator->release(mPoolAllocator, sizeof(PoolAllocator));
+        mHeapAllocator->~HeapAllocator();
+        mBaseAllocator->release(mHeapAllocator, sizeof(HeapAllocator));
+    }
+}
+
+// Make sure that the threads with index in [0, nbThreads) have allocators
+/// This method must not be called during a simulation step. The allocators of the existing
+/// threads are not moved and the references to them remain valid.
+/**
+ * @param nbThreads Number of threads of the task scheduler
+ */
+void MemoryManager::reserveThreadAllocators(uint32 nbThreads) {
+
+    if (nbThreads <= mNbThreadAllocators) return;
+
+    // Allocate the new array of pointers to the allocators of the threads
+    ThreadAllocators** threadAllocators = static_cast<ThreadAllocators**>(mBaseAllocator->allocate(nbThreads * sizeof(ThreadAllocators*)));
+    if (mNbThreadAllocators > 0) {
+        memcpy(threadAllocators, mThreadAllocators, mNbThreadAllocators * sizeof(ThreadAllocators*));
+        mBaseAllocator->release(mThreadAllocators, mNbThreadAllocators * sizeof(ThreadAllocators*));
+    }
+
+    // Create the allocators of the new threads
+    for (uint32 i=mNbThreadAllocators; i < nbThreads; i++) {
+        const size_t frameAllocatorInitSize = i == 0 ? SingleFrameAllocator::INIT_SINGLE_FRAME_ALLOCATOR_NB_BYTES :
+                                                       INIT_THREAD_FRAME_ALLOCATOR_NB_BYTES;
+        threadAllocators[i] = new (mBaseAllocator->allocate(sizeof(ThreadAllocators)))
+                                  ThreadAllocators(*mHeapAllocator, *mPoolAllocator, frameAllocatorInitSize);
+    }
+
+    mThreadAllocators = threadAllocators;
+    mNbThreadAllocators = nbThreads;
+}
+
+// Reset the single frame allocators of all the threads
+void MemoryManager::resetFrameAllocator() {
+
+    for (uint32 i=0; i < mNbThreadAllocators; i++) {
+        mThreadAllocators[i]->frameAllocator.reset();
+    }
 }
@@ -123,6 +123,12 @@ void* PoolAllocator::allocate(size_t size) {
     int indexHeap = mMapSizeToHeapIndex[size];
     assert(indexHeap >= 0 && indexHeap < NB_HEAPS);
 
+    return allocateUnit(indexHeap);
+}
+
+// Return a free memory unit of a given heap
+void* PoolAllocator::allocateUnit(int indexHeap) {
+
     // If there still are free memory units in the corresponding heap
     if (mFreeMemoryUnits[indexHeap] != nullptr) {
 
@@ -202,9 +208,59 @@ void PoolAllocator::release(void* pointer, size_t size) {
     int indexHeap = mMapSizeToHeapIndex[size];
     assert(indexHeap >= 0 && indexHeap < NB_HEAPS);
 
+    releaseUnit(indexHeap, pointer);
+}
+
+// Insert a memory unit into the free memory units of a given heap
+void PoolAllocator::releaseUnit(int indexHeap, void* pointer) {
+
     // Insert the released memory unit into the list of free memory units of the
     // corresponding heap
     MemoryUnit* releasedUnit = static_cast<MemoryUnit*>(pointer);
     releasedUnit->nextUnit = mFreeMemoryUnits[indexHeap];
     mFreeMemoryUnits[indexHeap] = releasedUnit;
 }
+
+// Allocate several memory units of the same size with a single lock of the mutex
+/**
+ * @param indexHeap Index of the heap of the memory units
+ * @param nbUnits Number of memory units to allocate
+ * @param[out] units Array where the pointers to the allocated memory units are written
+ */
+void PoolAllocator::allocateUnits(int indexHeap, uint nbUnits, void** units) {
+
+    assert(indexHeap >= 0 && indexHeap < NB_HEAPS);
+
+    // Lock the method with a mutex
+    std::lock_guard<std::mutex> lock(mMutex);
+
+#ifndef NDEBUG
+        mNbTimesAllocateMethodCalled += nbUnits;
+#endif
+
+    for (uint i=0; i < nbUnits; i++) {
+        units[i] = allocateUnit(indexHeap);
+    }
+}
+
+// Release several memory units of the same size with a single lock of the mutex
+/**
+ * @param indexHeap Index of the heap of the memory units
+ * @param nbUnits Number of memory units to release
+ * @param units Array with the pointers to the memory units to release
+ */
+void PoolAllocator::releaseUnits(int indexHeap, uint nbUnits, void** units) {
+
+    assert(indexHeap >= 0 && indexHeap < NB_HEAPS);
+
+    // Lock the method with a mutex
+    std::lock_guard<std::mutex> lock(mMutex);
+
+#ifndef NDEBUG
+        mNbTimesAllocateMethodCalled -= nbUnits;
+#endif
+
+    for (uint i=0; i < nbUnits; i++) {
+        releaseUnit(indexHeap, units[i]);
+    }
+}
@@ -0,0 +1,111 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/memory/PoolAllocatorCache.h>
+#include <cassert>
+
+using namespace reactphysics3d;
+
+// Constructor
+PoolAllocatorCache::PoolAllocatorCache(PoolAllocator& poolAllocator) : mPoolAllocator(poolAllocator) {
+
+    memset(mNbUnitsInMagazines, 0, sizeof(mNbUnitsInMagazines));
+}
+
+// Destructor
+PoolAllocatorCache::~PoolAllocatorCache() {
+
+    flush();
+}
+
+// Allocate memory of a given size (in bytes) and return a pointer to the
+// allocated memory.
+void* PoolAllocatorCache::allocate(size_t size) {
+
+    assert(size > 0);
+
+    // We cannot allocate zero bytes
+    if (size == 0) return nullptr;
+
+    // If the size is too large for the memory units of the pool allocator
+    if (size > PoolAllocator::MAX_UNIT_SIZE) {
+        return mPoolAllocator.allocate(size);
+    }
+
+    const int indexHeap = PoolAllocator::mMapSizeToHeapIndex[size];
+    assert(indexHeap >= 0 && indexHeap < PoolAllocator::NB_HEAPS);
+
+    // If the magazine is empty, we fill half of it with units of the pool allocator
+    uint& nbUnits = mNbUnitsInMagazines[indexHeap];
+    if (nbUnits == 0) {
+        mPoolAllocator.allocateUnits(indexHeap, MAGAZINE_SIZE / 2, mMagazines[indexHeap]);
+        nbUnits = MAGAZINE_SIZE / 2;
+    }
+
+    nbUnits--;
+    return mMagazines[indexHeap][nbUnits];
+}
+
+// Release previously allocated memory.
+/// The memory can have been allocated by the pool allocator itself or by any cache of the pool allocator.
+void PoolAllocatorCache::release(void* pointer, size_t size) {
+
+    assert(size > 0);
+
+    // Cannot release a 0-byte allocated memory
+    if (size == 0) return;
+
+    // If the size is too large for the memory units of the pool allocator
+    if (size > PoolAllocator::MAX_UNIT_SIZE) {
+        mPoolAllocator.release(pointer, size);
+        return;
+    }
+
+    const int indexHeap = PoolAllocator::mMapSizeToHeapIndex[size];
+    assert(indexHeap >= 0 && indexHeap < PoolAllocator::NB_HEAPS);
+
+    // If the magazine is full, we give back the second half of it to the pool allocator
+    uint& nbUnits = mNbUnitsInMagazines[indexHeap];
+    if (nbUnits == MAGAZINE_SIZE) {
+        mPoolAllocator.releaseUnits(indexHeap, MAGAZINE_SIZE / 2, mMagazines[indexHeap] + MAGAZINE_SIZE / 2);
+        nbUnits = MAGAZINE_SIZE / 2;
+    }
+
+    mMagazines[indexHeap][nbUnits] = pointer;
+    nbUnits++;
+}
+
+// Give back all the free memory units of the cache to the pool allocator
+void PoolAllocatorCache::flush() {
+
+    for (int i=0; i < PoolAllocator::NB_HEAPS; i++) {
+
+        if (mNbUnitsInMagazines[i] > 0) {
+            mPoolAllocator.releaseUnits(i, mNbUnitsInMagazines[i], mMagazines[i]);
+            mNbUnitsInMagazines[i] = 0;
+        }
+    }
+}
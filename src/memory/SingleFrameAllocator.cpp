@@ -32,8 +32,13 @@
 using namespace reactphysics3d;
 
 // Constructor
-SingleFrameAllocator::SingleFrameAllocator(MemoryAllocator& baseAllocator) : mBaseAllocator(baseAllocator),
-                                           mTotalSizeBytes(INIT_SINGLE_FRAME_ALLOCATOR_NB_BYTES),
+/**
+ * @param baseAllocator Allocator used to allocate the memory of the frame
+ * @param isThreadSafe True if the allocator can be used by several threads at the same time
+ * @param initSizeBytes Initial size (in bytes) of the memory of the frame
+ */
+SingleFrameAllocator::SingleFrameAllocator(MemoryAllocator& baseAllocator, bool isThreadSafe, size_t initSizeBytes)
+                     : mIsThreadSafe(isThreadSafe), mBaseAllocator(baseAllocator), mTotalSizeBytes(initSizeBytes),
                                            mCurrentOffset(0), mNbFramesTooMuchAllocated(0), mNeedToAllocatedMore(false) {
 
     // Allocate a whole block of memory at the beginning
@@ -53,8 +58,9 @@ SingleFrameAllocator::~SingleFrameAllocator() {
 // allocated memory.
 void* SingleFrameAllocator::allocate(size_t size) {
 
-    // Lock the method with a mutex
-    std::lock_guard<std::mutex> lock(mMutex);
+    // Lock the method with a mutex (if the allocator is shared between threads)
+    std::unique_lock<std::mutex> lock(mMutex, std::defer_lock);
+    if (mIsThreadSafe) lock.lock();
 
     // Check that there is enough remaining memory in the buffer
     if (mCurrentOffset + size > mTotalSizeBytes) {
@@ -79,8 +85,9 @@ void* SingleFrameAllocator::allocate(size_t size) {
 // Release previously allocated memory.
 void SingleFrameAllocator::release(void* pointer, size_t size) {
 
-    // Lock the method with a mutex
-    std::lock_guard<std::mutex> lock(mMutex);
+    // Lock the method with a mutex (if the allocator is shared between threads)
+    std::unique_lock<std::mutex> lock(mMutex, std::defer_lock);
+    if (mIsThreadSafe) lock.lock();
 
     // If allocated memory is not within the single frame allocation range
     char* p = static_cast<char*>(pointer);
@@ -94,8 +101,9 @@ void SingleFrameAllocator::release(void* pointer, size_t size) {
 // Reset the marker of the current allocated memory
 void SingleFrameAllocator::reset() {
 
-    // Lock the method with a mutex
-    std::lock_guard<std::mutex> lock(mMutex);
+    // Lock the method with a mutex (if the allocator is shared between threads)
+    std::unique_lock<std::mutex> lock(mMutex, std::defer_lock);
+    if (mIsThreadSafe) lock.lock();
 
     // If too much memory is allocated
     if (mCurrentOffset < mTotalSizeBytes / 2) {
@@ -25,6 +25,8 @@
 
 // Libraries
 #include <reactphysics3d/systems/BroadPhaseSystem.h>
+#include <reactphysics3d/collision/broadphase/DynamicAABBTreeBroadPhase.h>
+#include <reactphysics3d/collision/broadphase/SweepAndPruneBroadPhase.h>
 #include <reactphysics3d/systems/CollisionDetectionSystem.h>
 #include <reactphysics3d/utils/Profiler.h>
 #include <reactphysics3d/collision/RaycastInfo.h>
@@ -36,11 +38,15 @@ using namespace reactphysics3d;
 
 // Constructor
 BroadPhaseSystem::BroadPhaseSystem(CollisionDetectionSystem& collisionDetection, ColliderComponents& collidersComponents,
-                                   TransformComponents& transformComponents, RigidBodyComponents& rigidBodyComponents)
-                    :mDynamicAABBTree(collisionDetection.getMemoryManager().getPoolAllocator(), DYNAMIC_TREE_FAT_AABB_INFLATE_PERCENTAGE),
+                                   TransformComponents& transformComponents, RigidBodyComponents& rigidBodyComponents,
+                                   TaskScheduler& taskScheduler, BroadPhaseType broadPhaseType, decimal fatAABBInflatePercentage,
+                                   decimal fatAABBDisplacementMultiplier)
+                    :mAllocator(collisionDetection.getMemoryManager().getPoolAllocator()), mBroadPhaseStrategy(nullptr),
                      mCollidersComponents(collidersComponents), mTransformsComponents(transformComponents),
                      mRigidBodyComponents(rigidBodyComponents), mMovedShapes(collisionDetection.getMemoryManager().getPoolAllocator()),
-                     mCollisionDetection(collisionDetection) {
+                     mOverlappingPairsBuffers(collisionDetection.getMemoryManager().getPoolAllocator()),
+                     mCollisionDetection(collisionDetection), mTaskScheduler(taskScheduler),
+                     mFatAABBDisplacementMultiplier(fatAABBDisplacementMultiplier) {
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -49,6 +55,30 @@ BroadPhaseSystem::BroadPhaseSystem(CollisionDetectionSystem& collisionDetection,
 
 #endif
 
+    // Create the broad-phase data structure
+    switch (broadPhaseType) {
+
+        case BroadPhaseType::SWEEP_AND_PRUNE:
+            mBroadPhaseStrategy = new (mAllocator.allocate(sizeof(SweepAndPruneBroadPhase)))
+                    SweepAndPruneBroadPhase(mAllocator, fatAABBInflatePercentage);
+            break;
+
+        case BroadPhaseType::DYNAMIC_AABB_TREE:
+        default:
+            mBroadPhaseStrategy = new (mAllocator.allocate(sizeof(DynamicAABBTreeBroadPhase)))
+                    DynamicAABBTreeBroadPhase(mAllocator, fatAABBInflatePercentage);
+            break;
+    }
+}
+
+// Destructor
+BroadPhaseSystem::~BroadPhaseSystem() {
+
+    // Destroy the broad-phase data structure
+    const size_t size = mBroadPhaseStrategy->getType() == BroadPhaseType::SWEEP_AND_PRUNE ?
+                        sizeof(SweepAndPruneBroadPhase) : sizeof(DynamicAABBTreeBroadPhase);
+    mBroadPhaseStrategy->~BroadPhaseStrategy();
+    mAllocator.release(mBroadPhaseStrategy, size);
 }
 
 // Return true if the two broad-phase collision shapes are overlapping
@@ -59,8 +89,8 @@ bool BroadPhaseSystem::testOverlappingShapes(int32 shape1BroadPhaseId, int32 sha
     assert(shape1BroadPhaseId != -1 && shape2BroadPhaseId != -1);
 
     // Get the two AABBs of the collision shapes
-    const AABB& aabb1 = mDynamicAABBTree.getFatAABB(shape1BroadPhaseId);
-    const AABB& aabb2 = mDynamicAABBTree.getFatAABB(shape2BroadPhaseId);
+    const AABB& aabb1 = mBroadPhaseStrategy->getFatAABB(shape1BroadPhaseId);
+    const AABB& aabb2 = mBroadPhaseStrategy->getFatAABB(shape2BroadPhaseId);
 
     // Check if the two AABBs are overlapping
     return aabb1.testCollision(aabb2);
@@ -72,9 +102,9 @@ void BroadPhaseSystem::raycast(const Ray& ray, RaycastTest& raycastTest,
 
     RP3D_PROFILE("BroadPhaseSystem::raycast()", mProfiler);
 
-    BroadPhaseRaycastCallback broadPhaseRaycastCallback(mDynamicAABBTree, raycastWithCategoryMaskBits, raycastTest);
+    BroadPhaseRaycastCallback broadPhaseRaycastCallback(*mBroadPhaseStrategy, raycastWithCategoryMaskBits, raycastTest);
 
-    mDynamicAABBTree.raycast(ray, broadPhaseRaycastCallback);
+    mBroadPhaseStrategy->raycast(ray, broadPhaseRaycastCallback);
 }
 
 // Add a collider into the broad-phase collision detection
@@ -82,8 +112,13 @@ void BroadPhaseSystem::addCollider(Collider* collider, const AABB& aabb) {
 
     assert(collider->getBroadPhaseId() == -1);
 
-    // Add the collision shape into the dynamic AABB tree and get its broad-phase ID
-    int nodeId = mDynamicAABBTree.addObject(aabb, collider);
+    // The colliders of a static rigid body are static objects of the broad-phase data structure
+    const Entity bodyEntity = mCollidersComponents.getBody(collider->getEntity());
+    const bool isStatic = mRigidBodyComponents.hasComponent(bodyEntity) &&
+                          mRigidBodyComponents.getBodyType(bodyEntity) == BodyType::STATIC;
+
+    // Add the collision shape into the broad-phase data structure and get its broad-phase ID
+    int nodeId = mBroadPhaseStrategy->addObject(aabb, collider, isStatic);
 
     // Set the broad-phase ID of the collider
     mCollidersComponents.setBroadPhaseId(collider->getEntity(), nodeId);
@@ -102,8 +137,8 @@ void BroadPhaseSystem::removeCollider(Collider* collider) {
 
     mCollidersComponents.setBroadPhaseId(collider->getEntity(), -1);
 
-    // Remove the collision shape from the dynamic AABB tree
-    mDynamicAABBTree.removeObject(broadPhaseID);
+    // Remove the collision shape from the broad-phase data structure
+    mBroadPhaseStrategy->removeObject(broadPhaseID);
 
     // Remove the collision shape into the array of shapes that have moved (or have been created)
     // during the last simulation step
@@ -135,15 +170,15 @@ void BroadPhaseSystem::updateColliders(decimal timeStep) {
 
 // Notify the broad-phase that a collision shape has moved and need to be updated
 void BroadPhaseSystem::updateColliderInternal(int32 broadPhaseId, Collider* collider, const AABB& aabb,
-                                              bool forceReInsert) {
+                                              const Vector3& displacement, bool forceReInsert) {
 
     assert(broadPhaseId >= 0);
 
-    // Update the dynamic AABB tree according to the movement of the collision shape
-    bool hasBeenReInserted = mDynamicAABBTree.updateObject(broadPhaseId, aabb, forceReInsert);
+    // Update the broad-phase data structure according to the movement of the collision shape
+    bool hasBeenReInserted = mBroadPhaseStrategy->updateObject(broadPhaseId, aabb, forceReInsert, displacement);
 
     // If the collision shape has moved out of its fat AABB (and therefore has been reinserted
-    // into the tree).
+    // into the broad-phase data structure).
     if (hasBeenReInserted) {
 
         // Add the collision shape into the array of shapes that have moved (or have been created)
@@ -166,25 +201,51 @@ void BroadPhaseSystem::updateCollidersComponents(uint32 startIndex, uint32 nbIte
     uint32 endIndex = std::min(startIndex + nbItems, mCollidersComponents.getNbEnabledComponents());
     nbItems = endIndex - startIndex;
 
+    if (nbItems == 0) return;
+
+    // Recompute the world-space AABBs of the collision shapes and the predicted displacements of their
+    // bodies during the next time step. This is done in parallel because the AABBs of the colliders are
+    // independent from each other.
+    MemoryAllocator& allocator = mCollisionDetection.getMemoryManager().getThreadPoolAllocator(0);
+    List<AABB> aabbs(allocator, nbItems);
+    aabbs.addWithoutInit(nbItems);
+    List<Vector3> displacements(allocator, nbItems);
+    displacements.addWithoutInit(nbItems);
+    const decimal displacementFactor = timeStep * mFatAABBDisplacementMultiplier;
+    mTaskScheduler.parallelFor(0, nbItems, PARALLEL_FOR_GRAIN_SIZE, [&](uint32 start, uint32 end, uint32 /*threadIndex*/) {
+
+        for (uint32 j = start; j < end; j++) {
+
+            const uint32 i = startIndex + j;
+            if (mCollidersComponents.mBroadPhaseIds[i] != -1) {
+
+                const Entity& bodyEntity = mCollidersComponents.mBodiesEntities[i];
+                const Transform& transform = mTransformsComponents.getTransform(bodyEntity);
+
+                mCollidersComponents.mCollisionShapes[i]->computeAABB(aabbs[j], transform * mCollidersComponents.mLocalToBodyTransforms[i]);
+
+                // The fat AABB is extended along the displacement of the body at its current linear velocity
+                displacements[j] = Vector3::zero();
+                if (displacementFactor > decimal(0.0) && mRigidBodyComponents.hasComponent(bodyEntity)) {
+                    displacements[j] = mRigidBodyComponents.getLinearVelocity(bodyEntity) * displacementFactor;
+                }
+            }
+        }
+    });
+
     // For each collider component to update
     for (uint32 i = startIndex; i < startIndex + nbItems; i++) {
 
         const int32 broadPhaseId = mCollidersComponents.mBroadPhaseIds[i];
         if (broadPhaseId != -1) {
 
-            const Entity& bodyEntity = mCollidersComponents.mBodiesEntities[i];
-            const Transform& transform = mTransformsComponents.getTransform(bodyEntity);
-
-            // Recompute the world-space AABB of the collision shape
-            AABB aabb;
-            mCollidersComponents.mCollisionShapes[i]->computeAABB(aabb, transform * mCollidersComponents.mLocalToBodyTransforms[i]);
-
             // If the size of the collision shape has been changed by the user,
             // we need to reset the broad-phase AABB to its new size
             const bool forceReInsert = mCollidersComponents.mHasCollisionShapeChangedSize[i];
 
             // Update the broad-phase state of the collider
-            updateColliderInternal(broadPhaseId, mCollidersComponents.mColliders[i], aabb, forceReInsert);
+            updateColliderInternal(broadPhaseId, mCollidersComponents.mColliders[i], aabbs[i - startIndex],
+                                   displacements[i - startIndex], forceReInsert);
 
             mCollidersComponents.mHasCollisionShapeChangedSize[i] = false;
         }
@@ -206,19 +267,79 @@ void BroadPhaseSystem::addMovedCollider(int broadPhaseID, Collider* collider) {
 }
 
 // Compute all the overlapping pairs of collision shapes
+/// The overlap query is split into tasks that run in parallel. Each task writes the pairs it finds into
+/// its own buffer and the buffers are then appended in the order of the tasks.
 void BroadPhaseSystem::computeOverlappingPairs(MemoryManager& memoryManager, List<Pair<int32, int32>>& overlappingNodes) {
 
     RP3D_PROFILE("BroadPhaseSystem::computeOverlappingPairs()", mProfiler);
 
     // Get the list of the colliders that have moved or have been created in the last frame
-    List<int> shapesToTest = mMovedShapes.toList(memoryManager.getPoolAllocator());
+    List<int> shapesToTest = mMovedShapes.toList(memoryManager.getThreadPoolAllocator(0));
+
+    mBroadPhaseStrategy->beginOverlapQuery(shapesToTest);
+
+    const uint32 nbItems = mBroadPhaseStrategy->getNbOverlapQueryItems(shapesToTest);
+    const uint32 nbTasks = (nbItems + PARALLEL_BROAD_PHASE_GRAIN_SIZE - 1) / PARALLEL_BROAD_PHASE_GRAIN_SIZE;
 
-    // Ask the dynamic AABB tree to report all collision shapes that overlap with the shapes to test
-    mDynamicAABBTree.reportAllShapesOverlappingWithShapes(shapesToTest, 0, shapesToTest.size(), overlappingNodes);
+    // Make sure that each task has an empty buffer
+    while (mOverlappingPairsBuffers.size() < nbTasks) {
+        mOverlappingPairsBuffers.add(List<Pair<int32, int32>>(mAllocator));
+    }
+    for (uint32 i=0; i < nbTasks; i++) {
+        mOverlappingPairsBuffers[i].clear();
+    }
+
+    // Ask the broad-phase data structure to report all collision shapes that overlap with the shapes to test
+    mTaskScheduler.parallelFor(0, nbItems, PARALLEL_BROAD_PHASE_GRAIN_SIZE,
+                               [&](uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+
+        List<Pair<int32, int32>>& overlappingPairs = mOverlappingPairsBuffers[startIndex / PARALLEL_BROAD_PHASE_GRAIN_SIZE];
+
+        mBroadPhaseStrategy->reportOverlappingPairs(shapesToTest, startIndex, endIndex, overlappingPairs);
+
+        removeDuplicatedPairs(overlappingPairs);
+    });
+
+    mBroadPhaseStrategy->endOverlapQuery(shapesToTest);
+
+    // Merge the pairs found by the tasks
+    uint32 nbPairs = 0;
+    for (uint32 i=0; i < nbTasks; i++) {
+        nbPairs += mOverlappingPairsBuffers[i].size();
+    }
+    overlappingNodes.reserve(overlappingNodes.size() + nbPairs);
+    for (uint32 i=0; i < nbTasks; i++) {
+        overlappingNodes.addRange(mOverlappingPairsBuffers[i]);
+    }
 
     // Reset the array of collision shapes that have move (or have been created) during the
-    // last simulation step
-    mMovedShapes.clear();
+    // last simulation step. The memory of the set is released if it is much larger than the number
+    // of shapes that have moved (after the creation of many bodies for instance) because the time
+    // to iterate over the set depends on its capacity
+    mMovedShapes.clear(mMovedShapes.capacity() > 8 * static_cast<int>(shapesToTest.size()) + 64);
+}
+
+// Remove the self-pairs and the pairs reported twice from the pairs found by a task of the overlap query
+/// When two shapes that have both moved overlap, the pair can be found from each shape. We only keep
+/// the pair found from the shape with the smallest broad-phase ID. This method is called by several
+/// threads at the same time and therefore only reads the set of moved shapes.
+void BroadPhaseSystem::removeDuplicatedPairs(List<Pair<int32, int32>>& overlappingPairs) const {
+
+    uint32 nbPairs = 0;
+    for (uint32 i=0; i < overlappingPairs.size(); i++) {
+
+        const Pair<int32, int32>& pair = overlappingPairs[i];
+
+        if (pair.first == pair.second) continue;
+        if (pair.second < pair.first && mMovedShapes.contains(pair.second)) continue;
+
+        overlappingPairs[nbPairs] = pair;
+        nbPairs++;
+    }
+
+    while (overlappingPairs.size() > nbPairs) {
+        overlappingPairs.removeAt(overlappingPairs.size() - 1);
+    }
 }
 
 // Called when a overlapping node has been found during the call to
@@ -233,7 +354,7 @@ decimal BroadPhaseRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const Ra
     decimal hitFraction = decimal(-1.0);
 
     // Get the collider from the node
-    Collider* collider = static_cast<Collider*>(mDynamicAABBTree.getNodeDataPointer(nodeId));
+    Collider* collider = static_cast<Collider*>(mBroadPhaseStrategy.getObjectData(nodeId));
 
     // Check if the raycast filtering mask allows raycast against this shape
     if ((mRaycastWithCategoryMaskBits & collider->getCollisionCategoryBits()) != 0) {
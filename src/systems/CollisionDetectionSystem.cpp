@@ -42,6 +42,7 @@
 #include <reactphysics3d/collision/RaycastInfo.h>
 #include <reactphysics3d/containers/Pair.h>
 #include <cassert>
+#include <cmath>
 #include <iostream>
 
 // We want to use the ReactPhysics3D namespace
@@ -50,13 +51,16 @@ using namespace std;
 
 // Constructor
 CollisionDetectionSystem::CollisionDetectionSystem(PhysicsWorld* world, ColliderComponents& collidersComponents, TransformComponents& transformComponents,
-                                       CollisionBodyComponents& collisionBodyComponents, RigidBodyComponents& rigidBodyComponents, MemoryManager& memoryManager)
-                   : mMemoryManager(memoryManager), mCollidersComponents(collidersComponents),
+                                       CollisionBodyComponents& collisionBodyComponents, RigidBodyComponents& rigidBodyComponents, MemoryManager& memoryManager,
+                                                   TaskScheduler& taskScheduler, BroadPhaseType broadPhaseType,
+                                                   decimal fatAABBInflatePercentage, decimal fatAABBDisplacementMultiplier)
+                   : mMemoryManager(memoryManager), mTaskScheduler(taskScheduler), mCollidersComponents(collidersComponents),
                      mCollisionDispatch(mMemoryManager.getPoolAllocator()), mWorld(world),
                      mNoCollisionPairs(mMemoryManager.getPoolAllocator()),
                      mOverlappingPairs(mMemoryManager.getPoolAllocator(), mMemoryManager.getSingleFrameAllocator(), mCollidersComponents,
                                        collisionBodyComponents, rigidBodyComponents, mNoCollisionPairs, mCollisionDispatch),
-                     mBroadPhaseSystem(*this, mCollidersComponents, transformComponents, rigidBodyComponents),
+                     mBroadPhaseSystem(*this, mCollidersComponents, transformComponents, rigidBodyComponents, taskScheduler, broadPhaseType,
+                                       fatAABBInflatePercentage, fatAABBDisplacementMultiplier),
                      mMapBroadPhaseIdToColliderEntity(memoryManager.getPoolAllocator()),
                      mNarrowPhaseInput(mMemoryManager.getSingleFrameAllocator(), mOverlappingPairs), mPotentialContactPoints(mMemoryManager.getSingleFrameAllocator()),
                      mPotentialContactManifolds(mMemoryManager.getSingleFrameAllocator()), mContactPairs1(mMemoryManager.getPoolAllocator()),
@@ -89,7 +93,8 @@ void CollisionDetectionSystem::computeCollisionDetection() {
     computeBroadPhase();
 
     // Compute the middle-phase collision detection
-    computeMiddlePhase(mNarrowPhaseInput, true);
+    mNarrowPhaseStatistics.reset();
+    computeMiddlePhase(mNarrowPhaseInput, true, true);
     
     // Compute the narrow-phase collision detection
     computeNarrowPhase();
@@ -103,7 +108,7 @@ void CollisionDetectionSystem::computeBroadPhase() {
     // Ask the broad-phase to compute all the shapes overlapping with the shapes that
     // have moved or have been added in the last frame. This call can only add new
     // overlapping pairs in the collision detection.
-    List<Pair<int32, int32>> overlappingNodes(mMemoryManager.getPoolAllocator(), 32);
+    List<Pair<int32, int32>> overlappingNodes(mMemoryManager.getThreadPoolAllocator(0), 32);
     mBroadPhaseSystem.computeOverlappingPairs(mMemoryManager, overlappingNodes);
 
     // Create new overlapping pairs if necessary
@@ -118,7 +123,9 @@ void CollisionDetectionSystem::removeNonOverlappingPairs() {
 
     RP3D_PROFILE("CollisionDetectionSystem::removeNonOverlappingPairs()", mProfiler);
 
-    for (uint64 i=0; i < mOverlappingPairs.getNbPairs(); i++) {
+    // The inactive pairs (pairs of sleeping or static bodies) are skipped. They will be
+    // tested for overlap again once they become active
+    for (uint64 i=0; i < mOverlappingPairs.getNbActivePairs(); i++) {
 
         // Check if we need to test overlap. If so, test if the two shapes are still overlapping.
         // Otherwise, we destroy the overlapping pair
@@ -158,7 +165,7 @@ void CollisionDetectionSystem::addLostContactPair(uint64 overlappingPairIndex) {
 
     // Create a lost contact pair
     ContactPair lostContactPair(mOverlappingPairs.mPairIds[overlappingPairIndex], body1Entity, body2Entity, collider1Entity, collider2Entity, mLostContactPairs.size(),
-                                true, isTrigger, mMemoryManager.getHeapAllocator());
+                                true, isTrigger, mMemoryManager.getPoolAllocator());
     mLostContactPairs.add(lostContactPair);
 }
 
@@ -231,7 +238,7 @@ void CollisionDetectionSystem::updateOverlappingPairs(const List<Pair<int32, int
 }
 
 // Compute the middle-phase collision detection
-void CollisionDetectionSystem::computeMiddlePhase(NarrowPhaseInput& narrowPhaseInput, bool needToReportContacts) {
+void CollisionDetectionSystem::computeMiddlePhase(NarrowPhaseInput& narrowPhaseInput, bool needToReportContacts, bool isWorldUpdate) {
 
     RP3D_PROFILE("CollisionDetectionSystem::computeMiddlePhase()", mProfiler);
 
@@ -241,6 +248,12 @@ void CollisionDetectionSystem::computeMiddlePhase(NarrowPhaseInput& narrowPhaseI
     // Remove the obsolete last frame collision infos and mark all the others as obsolete
     mOverlappingPairs.clearObsoleteLastFrameCollisionInfos();
 
+    // The contacts of the pairs at rest are reused during the update of the world (not for the
+    // collision queries of the user) if both thresholds of the world settings are positive
+    const bool isRestingPairsSkipEnabled = isWorldUpdate && mWorld->mConfig.restingPairLinearThreshold > decimal(0.0) &&
+                                           mWorld->mConfig.restingPairAngularThreshold > decimal(0.0);
+    const decimal cosHalfRestingMaxAngle = std::cos(mWorld->mConfig.restingPairAngularThreshold * decimal(0.5));
+
     // For each possible convex vs convex pair of bodies
     for (uint64 i=0; i < mOverlappingPairs.getNbConvexVsConvexPairs(); i++) {
 
@@ -266,12 +279,23 @@ void CollisionDetectionSystem::computeMiddlePhase(NarrowPhaseInput& narrowPhaseI
             const bool isCollider2Trigger = mCollidersComponents.mIsTrigger[collider2Index];
             const bool reportContacts = needToReportContacts && !isCollider1Trigger && !isCollider2Trigger;
 
-            // No middle-phase is necessary, simply create a narrow phase info
-            // for the narrow-phase collision detection
-            narrowPhaseInput.addNarrowPhaseTest(mOverlappingPairs.mPairIds[i], i, collider1Entity, collider2Entity, collisionShape1, collisionShape2,
-                                                      mCollidersComponents.mLocalToWorldTransforms[collider1Index],
-                                                      mCollidersComponents.mLocalToWorldTransforms[collider2Index],
-                                                      algorithmType, reportContacts, mMemoryManager.getSingleFrameAllocator());
+            if (isWorldUpdate) {
+                mNarrowPhaseStatistics.nbOverlappingPairsTests++;
+            }
+
+            // If the pair is at rest, its contacts of the previous frame are reused
+            if (isRestingPairsSkipEnabled && reuseRestingPairContacts(i, reportContacts, cosHalfRestingMaxAngle, narrowPhaseInput)) {
+                mNarrowPhaseStatistics.nbRestingPairsSkippedTests++;
+            }
+            else {
+
+                // No middle-phase is necessary, simply create a narrow phase info
+                // for the narrow-phase collision detection
+                narrowPhaseInput.addNarrowPhaseTest(mOverlappingPairs.mPairIds[i], i, collider1Entity, collider2Entity, collisionShape1, collisionShape2,
+                                                          mCollidersComponents.mLocalToWorldTransforms[collider1Index],
+                                                          mCollidersComponents.mLocalToWorldTransforms[collider2Index],
+                                                          algorithmType, reportContacts, mMemoryManager.getSingleFrameAllocator());
+            }
 
             mOverlappingPairs.mCollidingInCurrentFrame[i] = false;
         }
@@ -288,7 +312,23 @@ void CollisionDetectionSystem::computeMiddlePhase(NarrowPhaseInput& narrowPhaseI
         // Check that at least one body is enabled (active and awake) and not static
         if (mOverlappingPairs.mIsActive[i]) {
 
-            computeConvexVsConcaveMiddlePhase(i, mMemoryManager.getSingleFrameAllocator(), narrowPhaseInput);
+            const uint collider1Index = mCollidersComponents.getEntityIndex(mOverlappingPairs.mColliders1[i]);
+            const uint collider2Index = mCollidersComponents.getEntityIndex(mOverlappingPairs.mColliders2[i]);
+            const bool reportContacts = needToReportContacts && !mCollidersComponents.mIsTrigger[collider1Index] &&
+                                        !mCollidersComponents.mIsTrigger[collider2Index];
+
+            if (isWorldUpdate) {
+                mNarrowPhaseStatistics.nbOverlappingPairsTests++;
+            }
+
+            // If the pair is at rest, its contacts of the previous frame are reused (without
+            // computing the overlapping triangles of the concave shape)
+            if (isRestingPairsSkipEnabled && reuseRestingPairContacts(i, reportContacts, cosHalfRestingMaxAngle, narrowPhaseInput)) {
+                mNarrowPhaseStatistics.nbRestingPairsSkippedTests++;
+            }
+            else {
+                computeConvexVsConcaveMiddlePhase(i, mMemoryManager.getSingleFrameAllocator(), narrowPhaseInput);
+            }
 
             mOverlappingPairs.mCollidingInCurrentFrame[i] = false;
         }
@@ -431,9 +471,98 @@ void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(uint64 pairInde
     }
 }
 
+// Reuse the contacts of the previous frame of an overlapping pair at rest instead of computing them with the narrow-phase
+/// The contacts of the previous frame are reused if the relative translation and rotation of the colliders since
+/// the contacts have been computed by the narrow-phase are smaller than the thresholds of the world settings. The
+/// reused contact points stay at the same location in the local-space of each collider, their normal is rotated
+/// with the first collider and their penetration depth is computed again with the current transforms of the
+/// colliders. The points that do not penetrate anymore are removed. This method returns false if the contacts
+/// cannot be reused and the pair must be tested by the narrow-phase. In this case, the current relative transform
+/// of the colliders is kept to test whether the contacts computed by the narrow-phase can be reused later.
+bool CollisionDetectionSystem::reuseRestingPairContacts(uint64 pairIndex, bool reportContacts, decimal cosHalfMaxAngle,
+                                                        NarrowPhaseInput& narrowPhaseInput) {
+
+    const uint64 pairId = mOverlappingPairs.mPairIds[pairIndex];
+    const Entity collider1Entity = mOverlappingPairs.mColliders1[pairIndex];
+    const Entity collider2Entity = mOverlappingPairs.mColliders2[pairIndex];
+
+    const uint collider1Index = mCollidersComponents.getEntityIndex(collider1Entity);
+    const uint collider2Index = mCollidersComponents.getEntityIndex(collider2Entity);
+
+    const Transform& shape1ToWorldTransform = mCollidersComponents.mLocalToWorldTransforms[collider1Index];
+    const Transform& shape2ToWorldTransform = mCollidersComponents.mLocalToWorldTransforms[collider2Index];
+    const Transform shape2ToShape1Transform = shape1ToWorldTransform.getInverse() * shape2ToWorldTransform;
+
+    // Rotation of the first collider since the last frame (to rotate the normals of the contacts)
+    const Quaternion shape1Rotation = shape1ToWorldTransform.getOrientation() *
+                                      mOverlappingPairs.mLastFrameShape1Orientations[pairIndex].getInverse();
+    mOverlappingPairs.mLastFrameShape1Orientations[pairIndex] = shape1ToWorldTransform.getOrientation();
+
+    // The contacts of the previous frame (not swapped yet with the current ones) must have been
+    // computed for this pair
+    auto it = mCurrentMapPairIdToContactPairIndex->find(pairId);
+    if (reportContacts && mOverlappingPairs.mAreContactsReusable[pairIndex] && it != mCurrentMapPairIdToContactPairIndex->end()) {
+
+        const ContactPair& previousContactPair = (*mCurrentContactPairs)[it->second];
+        const Transform& contactsShape2ToShape1 = mOverlappingPairs.mContactsShape2ToShape1[pairIndex];
+
+        // Relative motion of the colliders since the contacts have been computed by the narrow-phase
+        const decimal maxDistance = mWorld->mConfig.restingPairLinearThreshold;
+        const decimal distanceSquare = (shape2ToShape1Transform.getPosition() - contactsShape2ToShape1.getPosition()).lengthSquare();
+        const Quaternion relativeRotation = shape2ToShape1Transform.getOrientation() * contactsShape2ToShape1.getOrientation().getInverse();
+
+        if (distanceSquare < maxDistance * maxDistance && std::abs(relativeRotation.w) > cosHalfMaxAngle) {
+
+            NarrowPhaseInfoBatch& restingPairsBatch = narrowPhaseInput.getRestingPairsBatch();
+            const uint batchIndex = restingPairsBatch.getNbObjects();
+            bool isPairAdded = false;
+
+            // For each contact point of the previous frame
+            const uint contactPointsIndex = previousContactPair.contactPointsIndex;
+            for (uint c=contactPointsIndex; c < contactPointsIndex + previousContactPair.nbToTalContactPoints; c++) {
+
+                const ContactPoint& contactPoint = (*mCurrentContactPoints)[c];
+
+                // Compute the contact normal and penetration depth with the current transforms
+                const Vector3 normal = shape1Rotation * contactPoint.getNormal();
+                const Vector3 point1 = shape1ToWorldTransform * contactPoint.getLocalPointOnShape1();
+                const Vector3 point2 = shape2ToWorldTransform * contactPoint.getLocalPointOnShape2();
+                const decimal penetrationDepth = (point1 - point2).dot(normal);
+
+                if (penetrationDepth > decimal(0.0)) {
+
+                    if (!isPairAdded) {
+                        restingPairsBatch.addNarrowPhaseInfo(pairId, pairIndex, collider1Entity, collider2Entity,
+                                                             mCollidersComponents.mCollisionShapes[collider1Index],
+                                                             mCollidersComponents.mCollisionShapes[collider2Index],
+                                                             shape1ToWorldTransform, shape2ToWorldTransform, true,
+                                                             mMemoryManager.getSingleFrameAllocator());
+                        restingPairsBatch.isColliding[batchIndex] = true;
+                        isPairAdded = true;
+                    }
+
+                    restingPairsBatch.addContactPoint(batchIndex, normal, penetrationDepth, contactPoint.getLocalPointOnShape1(),
+                                                      contactPoint.getLocalPointOnShape2());
+                }
+            }
+
+            if (isPairAdded) {
+                return true;
+            }
+        }
+    }
+
+    // The contacts will be computed by the narrow-phase with the current relative transform of the colliders
+    mOverlappingPairs.mContactsShape2ToShape1[pairIndex] = shape2ToShape1Transform;
+    mOverlappingPairs.mAreContactsReusable[pairIndex] = true;
+
+    return false;
+}
+
 // Execute the narrow-phase collision detection algorithm on batches
 bool CollisionDetectionSystem::testNarrowPhaseCollision(NarrowPhaseInput& narrowPhaseInput,
-                                                        bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& allocator) {
+                                                        bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& allocator,
+                                                        NarrowPhaseStatistics& statistics) {
 
     bool contactFound = false;
 
@@ -444,6 +573,7 @@ bool CollisionDetectionSystem::testNarrowPhaseCollision(NarrowPhaseInput& narrow
     SphereVsConvexPolyhedronAlgorithm* sphereVsConvexPolyAlgo = mCollisionDispatch.getSphereVsConvexPolyhedronAlgorithm();
     CapsuleVsConvexPolyhedronAlgorithm* capsuleVsConvexPolyAlgo = mCollisionDispatch.getCapsuleVsConvexPolyhedronAlgorithm();
     ConvexPolyhedronVsConvexPolyhedronAlgorithm* convexPolyVsConvexPolyAlgo = mCollisionDispatch.getConvexPolyhedronVsConvexPolyhedronAlgorithm();
+    BoxVsBoxAlgorithm* boxVsBoxAlgo = mCollisionDispatch.getBoxVsBoxAlgorithm();
 
     // get the narrow-phase batches to test for collision for contacts
     SphereVsSphereNarrowPhaseInfoBatch& sphereVsSphereBatchContacts = narrowPhaseInput.getSphereVsSphereBatch();
@@ -452,34 +582,99 @@ bool CollisionDetectionSystem::testNarrowPhaseCollision(NarrowPhaseInput& narrow
     NarrowPhaseInfoBatch& sphereVsConvexPolyhedronBatchContacts = narrowPhaseInput.getSphereVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& capsuleVsConvexPolyhedronBatchContacts = narrowPhaseInput.getCapsuleVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& convexPolyhedronVsConvexPolyhedronBatchContacts = narrowPhaseInput.getConvexPolyhedronVsConvexPolyhedronBatch();
+    BoxVsBoxNarrowPhaseInfoBatch& boxVsBoxBatchContacts = narrowPhaseInput.getBoxVsBoxBatch();
 
     // Compute the narrow-phase collision detection for each kind of collision shapes (for contacts)
-    if (sphereVsSphereBatchContacts.getNbObjects() > 0) {
-        contactFound |= sphereVsSphereAlgo->testCollision(sphereVsSphereBatchContacts, 0, sphereVsSphereBatchContacts.getNbObjects(), allocator);
-    }
-    if (sphereVsCapsuleBatchContacts.getNbObjects() > 0) {
-        contactFound |= sphereVsCapsuleAlgo->testCollision(sphereVsCapsuleBatchContacts, 0, sphereVsCapsuleBatchContacts.getNbObjects(), allocator);
-    }
-    if (capsuleVsCapsuleBatchContacts.getNbObjects() > 0) {
-        contactFound |= capsuleVsCapsuleAlgo->testCollision(capsuleVsCapsuleBatchContacts, 0, capsuleVsCapsuleBatchContacts.getNbObjects(), allocator);
-    }
-    if (sphereVsConvexPolyhedronBatchContacts.getNbObjects() > 0) {
-        contactFound |= sphereVsConvexPolyAlgo->testCollision(sphereVsConvexPolyhedronBatchContacts, 0, sphereVsConvexPolyhedronBatchContacts.getNbObjects(), clipWithPreviousAxisIfStillColliding, allocator);
-    }
-    if (capsuleVsConvexPolyhedronBatchContacts.getNbObjects() > 0) {
-        contactFound |= capsuleVsConvexPolyAlgo->testCollision(capsuleVsConvexPolyhedronBatchContacts, 0, capsuleVsConvexPolyhedronBatchContacts.getNbObjects(), clipWithPreviousAxisIfStillColliding, allocator);
+    contactFound |= testNarrowPhaseBatchInParallel(sphereVsSphereBatchContacts, allocator, statistics,
+                                                   [&](uint startIndex, uint nbItems, MemoryAllocator& taskAllocator,
+                                                       NarrowPhaseStatistics&) {
+        return sphereVsSphereAlgo->testCollision(sphereVsSphereBatchContacts, startIndex, nbItems, taskAllocator);
+    });
+    contactFound |= testNarrowPhaseBatchInParallel(sphereVsCapsuleBatchContacts, allocator, statistics,
+                                                   [&](uint startIndex, uint nbItems, MemoryAllocator& taskAllocator,
+                                                       NarrowPhaseStatistics&) {
+        return sphereVsCapsuleAlgo->testCollision(sphereVsCapsuleBatchContacts, startIndex, nbItems, taskAllocator);
+    });
+    contactFound |= testNarrowPhaseBatchInParallel(capsuleVsCapsuleBatchContacts, allocator, statistics,
+                                                   [&](uint startIndex, uint nbItems, MemoryAllocator& taskAllocator,
+                                                       NarrowPhaseStatistics&) {
+        return capsuleVsCapsuleAlgo->testCollision(capsuleVsCapsuleBatchContacts, startIndex, nbItems, taskAllocator);
+    });
+    contactFound |= testNarrowPhaseBatchInParallel(sphereVsConvexPolyhedronBatchContacts, allocator, statistics,
+                                                   [&](uint startIndex, uint nbItems, MemoryAllocator& taskAllocator,
+                                                       NarrowPhaseStatistics& taskStatistics) {
+        return sphereVsConvexPolyAlgo->testCollision(sphereVsConvexPolyhedronBatchContacts, startIndex, nbItems,
+                                                     clipWithPreviousAxisIfStillColliding, taskAllocator, taskStatistics);
+    });
+    contactFound |= testNarrowPhaseBatchInParallel(capsuleVsConvexPolyhedronBatchContacts, allocator, statistics,
+                                                   [&](uint startIndex, uint nbItems, MemoryAllocator& taskAllocator,
+                                                       NarrowPhaseStatistics& taskStatistics) {
+        return capsuleVsConvexPolyAlgo->testCollision(capsuleVsConvexPolyhedronBatchContacts, startIndex, nbItems,
+                                                      clipWithPreviousAxisIfStillColliding, taskAllocator, taskStatistics);
+    });
+    contactFound |= testNarrowPhaseBatchInParallel(convexPolyhedronVsConvexPolyhedronBatchContacts, allocator, statistics,
+                                                   [&](uint startIndex, uint nbItems, MemoryAllocator& taskAllocator,
+                                                       NarrowPhaseStatistics&) {
+        return convexPolyVsConvexPolyAlgo->testCollision(convexPolyhedronVsConvexPolyhedronBatchContacts, startIndex, nbItems,
+                                                         clipWithPreviousAxisIfStillColliding, taskAllocator);
+    });
+    contactFound |= testNarrowPhaseBatchInParallel(boxVsBoxBatchContacts, allocator, statistics,
+                                                   [&](uint startIndex, uint nbItems, MemoryAllocator& taskAllocator,
+                                                       NarrowPhaseStatistics&) {
+        return boxVsBoxAlgo->testCollision(boxVsBoxBatchContacts, startIndex, nbItems,
+                                           clipWithPreviousAxisIfStillColliding, taskAllocator);
+    });
+
+    return contactFound;
+}
+
+// Execute a narrow-phase collision detection test on the items of a batch in parallel
+/// The batch is split into ranges of items that are tested by different tasks. A task allocates the contact
+/// points it finds and the temporary memory of the test with the allocators of its own thread (the
+/// allocator in parameter is only used by the calling thread). The contact points of an item are stored
+/// with this item in the batch and are processed later in the order of the items. Therefore, the result
+/// does not depend on the number of threads. The statistics of the tests of all the tasks are added to the
+/// statistics in parameter. This method returns true if a collision has been found.
+bool CollisionDetectionSystem::testNarrowPhaseBatchInParallel(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, MemoryAllocator& allocator,
+                                                              NarrowPhaseStatistics& statistics, const NarrowPhaseBatchTest& testItems) {
+
+    const uint32 nbItems = narrowPhaseInfoBatch.getNbObjects();
+    if (nbItems == 0) return false;
+
+    const uint32 nbTasks = (nbItems + PARALLEL_NARROW_PHASE_GRAIN_SIZE - 1) / PARALLEL_NARROW_PHASE_GRAIN_SIZE;
+
+    // Result and statistics of each task (each task only writes its own elements)
+    List<bool> isCollisionFoundByTask(allocator, nbTasks);
+    List<NarrowPhaseStatistics> statisticsByTask(allocator, nbTasks);
+    for (uint32 i=0; i < nbTasks; i++) {
+        isCollisionFoundByTask.add(false);
+        statisticsByTask.add(NarrowPhaseStatistics());
     }
-    if (convexPolyhedronVsConvexPolyhedronBatchContacts.getNbObjects() > 0) {
-        contactFound |= convexPolyVsConvexPolyAlgo->testCollision(convexPolyhedronVsConvexPolyhedronBatchContacts, 0, convexPolyhedronVsConvexPolyhedronBatchContacts.getNbObjects(), clipWithPreviousAxisIfStillColliding, allocator);
+
+    mTaskScheduler.parallelFor(0, nbItems, PARALLEL_NARROW_PHASE_GRAIN_SIZE,
+                               [&](uint32 startIndex, uint32 endIndex, uint32 threadIndex) {
+
+        MemoryAllocator& taskAllocator = threadIndex == 0 ? allocator : mMemoryManager.getThreadFrameAllocator(threadIndex);
+
+        narrowPhaseInfoBatch.setContactPointsAllocator(startIndex, endIndex, mMemoryManager.getThreadFrameAllocator(threadIndex));
+
+        const uint32 taskIndex = startIndex / PARALLEL_NARROW_PHASE_GRAIN_SIZE;
+        isCollisionFoundByTask[taskIndex] = testItems(startIndex, endIndex - startIndex, taskAllocator, statisticsByTask[taskIndex]);
+    });
+
+    bool isCollisionFound = false;
+    for (uint32 i=0; i < nbTasks; i++) {
+        isCollisionFound |= isCollisionFoundByTask[i];
+        statistics += statisticsByTask[i];
     }
 
-    return contactFound;
+    return isCollisionFound;
 }
 
 // Process the potential contacts after narrow-phase collision detection
 void CollisionDetectionSystem::processAllPotentialContacts(NarrowPhaseInput& narrowPhaseInput, bool updateLastFrameInfo,
                                                      List<ContactPointInfo>& potentialContactPoints,
-                                                     Map<uint64, uint>* mapPairIdToContactPairIndex,
+                                                     FlatMap<uint64, uint>* mapPairIdToContactPairIndex,
                                                      List<ContactManifoldInfo>& potentialContactManifolds,
                                                      List<ContactPair>* contactPairs,
                                                      Map<Entity, List<uint>>& mapBodyToContactPairs) {
@@ -494,6 +689,8 @@ void CollisionDetectionSystem::processAllPotentialContacts(NarrowPhaseInput& nar
     NarrowPhaseInfoBatch& sphereVsConvexPolyhedronBatch = narrowPhaseInput.getSphereVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& capsuleVsConvexPolyhedronBatch = narrowPhaseInput.getCapsuleVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& convexPolyhedronVsConvexPolyhedronBatch = narrowPhaseInput.getConvexPolyhedronVsConvexPolyhedronBatch();
+    NarrowPhaseInfoBatch& boxVsBoxBatch = narrowPhaseInput.getBoxVsBoxBatch();
+    NarrowPhaseInfoBatch& restingPairsBatch = narrowPhaseInput.getRestingPairsBatch();
 
     // Process the potential contacts
     processPotentialContacts(sphereVsSphereBatch, updateLastFrameInfo, potentialContactPoints, mapPairIdToContactPairIndex,
@@ -508,6 +705,13 @@ void CollisionDetectionSystem::processAllPotentialContacts(NarrowPhaseInput& nar
                              potentialContactManifolds, contactPairs, mapBodyToContactPairs);
     processPotentialContacts(convexPolyhedronVsConvexPolyhedronBatch, updateLastFrameInfo, potentialContactPoints, mapPairIdToContactPairIndex,
                              potentialContactManifolds, contactPairs, mapBodyToContactPairs);
+    processPotentialContacts(boxVsBoxBatch, updateLastFrameInfo, potentialContactPoints, mapPairIdToContactPairIndex,
+                             potentialContactManifolds, contactPairs, mapBodyToContactPairs);
+
+    // The last frame collision infos are not updated for the reused contacts of the pairs at rest
+    // because these contacts have not been computed by a narrow-phase algorithm
+    processPotentialContacts(restingPairsBatch, false, potentialContactPoints, mapPairIdToContactPairIndex,
+                             potentialContactManifolds, contactPairs, mapBodyToContactPairs);
 }
 
 // Compute the narrow-phase collision detection
@@ -521,7 +725,7 @@ void CollisionDetectionSystem::computeNarrowPhase() {
     swapPreviousAndCurrentContacts();
 
     // Test the narrow-phase collision detection on the batches to be tested
-    testNarrowPhaseCollision(mNarrowPhaseInput, true, allocator);
+    testNarrowPhaseCollision(mNarrowPhaseInput, true, allocator, mNarrowPhaseStatistics);
 
     // Process all the potential contacts after narrow-phase collision
     processAllPotentialContacts(mNarrowPhaseInput, true, mPotentialContactPoints, mCurrentMapPairIdToContactPairIndex,
@@ -533,9 +737,6 @@ void CollisionDetectionSystem::computeNarrowPhase() {
     assert(mCurrentContactManifolds->size() == 0);
     assert(mCurrentContactPoints->size() == 0);
 
-    // Create the actual narrow-phase contacts
-    createContacts();
-
     mNarrowPhaseInput.clear();
 }
 
@@ -547,8 +748,10 @@ bool CollisionDetectionSystem::computeNarrowPhaseOverlapSnapshot(NarrowPhaseInpu
 
     MemoryAllocator& allocator = mMemoryManager.getPoolAllocator();
 
-    // Test the narrow-phase collision detection on the batches to be tested
-    bool collisionFound = testNarrowPhaseCollision(narrowPhaseInput, false, allocator);
+    // Test the narrow-phase collision detection on the batches to be tested (the statistics
+    // of the narrow-phase are only reported for the update of the world)
+    NarrowPhaseStatistics statistics;
+    bool collisionFound = testNarrowPhaseCollision(narrowPhaseInput, false, allocator, statistics);
     if (collisionFound && callback != nullptr) {
 
         // Compute the overlapping colliders
@@ -567,7 +770,7 @@ bool CollisionDetectionSystem::computeNarrowPhaseOverlapSnapshot(NarrowPhaseInpu
 // Process the potential overlapping bodies  for the testOverlap() methods
 void CollisionDetectionSystem::computeOverlapSnapshotContactPairs(NarrowPhaseInput& narrowPhaseInput, List<ContactPair>& contactPairs) const {
 
-    Set<uint64> setOverlapContactPairId(mMemoryManager.getHeapAllocator());
+    FlatSet<uint64> setOverlapContactPairId(mMemoryManager.getHeapAllocator());
 
     // get the narrow-phase batches to test for collision
     NarrowPhaseInfoBatch& sphereVsSphereBatch = narrowPhaseInput.getSphereVsSphereBatch();
@@ -576,6 +779,7 @@ void CollisionDetectionSystem::computeOverlapSnapshotContactPairs(NarrowPhaseInp
     NarrowPhaseInfoBatch& sphereVsConvexPolyhedronBatch = narrowPhaseInput.getSphereVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& capsuleVsConvexPolyhedronBatch = narrowPhaseInput.getCapsuleVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& convexPolyhedronVsConvexPolyhedronBatch = narrowPhaseInput.getConvexPolyhedronVsConvexPolyhedronBatch();
+    NarrowPhaseInfoBatch& boxVsBoxBatch = narrowPhaseInput.getBoxVsBoxBatch();
 
     // Process the potential contacts
     computeOverlapSnapshotContactPairs(sphereVsSphereBatch, contactPairs, setOverlapContactPairId);
@@ -584,6 +788,7 @@ void CollisionDetectionSystem::computeOverlapSnapshotContactPairs(NarrowPhaseInp
     computeOverlapSnapshotContactPairs(sphereVsConvexPolyhedronBatch, contactPairs, setOverlapContactPairId);
     computeOverlapSnapshotContactPairs(capsuleVsConvexPolyhedronBatch, contactPairs, setOverlapContactPairId);
     computeOverlapSnapshotContactPairs(convexPolyhedronVsConvexPolyhedronBatch, contactPairs, setOverlapContactPairId);
+    computeOverlapSnapshotContactPairs(boxVsBoxBatch, contactPairs, setOverlapContactPairId);
 }
 
 // Notify that the overlapping pairs where a given collider is involved need to be tested for overlap
@@ -599,9 +804,22 @@ void CollisionDetectionSystem::notifyOverlappingPairsToTestOverlap(Collider* col
     }
 }
 
+// Notify that the contacts of the overlapping pairs where a given collider is involved cannot be reused
+/// This is used when the size of the collision shape of the collider has changed. The contacts of its
+/// pairs must then be computed again by the narrow-phase even if the pairs are at rest.
+void CollisionDetectionSystem::notifyOverlappingPairsToComputeContacts(Collider* collider) {
+
+    // Get the overlapping pairs involved with this collider
+    List<uint64>& overlappingPairs = mCollidersComponents.getOverlappingPairs(collider->getEntity());
+
+    for (uint i=0; i < overlappingPairs.size(); i++) {
+        mOverlappingPairs.mAreContactsReusable[mOverlappingPairs.getPairIndex(overlappingPairs[i])] = false;
+    }
+}
+
 // Convert the potential overlapping bodies for the testOverlap() methods
 void CollisionDetectionSystem::computeOverlapSnapshotContactPairs(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, List<ContactPair>& contactPairs,
-                                                           Set<uint64>& setOverlapContactPairId) const {
+                                                           FlatSet<uint64>& setOverlapContactPairId) const {
 
     RP3D_PROFILE("CollisionDetectionSystem::computeSnapshotContactPairs()", mProfiler);
 
@@ -646,15 +864,17 @@ bool CollisionDetectionSystem::computeNarrowPhaseCollisionSnapshot(NarrowPhaseIn
 
     MemoryAllocator& allocator = mMemoryManager.getHeapAllocator();
 
-    // Test the narrow-phase collision detection on the batches to be tested
-    bool collisionFound = testNarrowPhaseCollision(narrowPhaseInput, false, allocator);
+    // Test the narrow-phase collision detection on the batches to be tested (the statistics
+    // of the narrow-phase are only reported for the update of the world)
+    NarrowPhaseStatistics statistics;
+    bool collisionFound = testNarrowPhaseCollision(narrowPhaseInput, false, allocator, statistics);
 
     // If collision has been found, create contacts
     if (collisionFound) {
 
         List<ContactPointInfo> potentialContactPoints(allocator);
         List<ContactManifoldInfo> potentialContactManifolds(allocator);
-        Map<uint64, uint> mapPairIdToContactPairIndex(allocator);
+        FlatMap<uint64, uint> mapPairIdToContactPairIndex(allocator);
         List<ContactPair> contactPairs(allocator);
         List<ContactPair> lostContactPairs(allocator);                  // Not used during collision snapshots
         List<ContactManifold> contactManifolds(allocator);
@@ -709,17 +929,33 @@ void CollisionDetectionSystem::swapPreviousAndCurrentContacts() {
 }
 
 // Create the actual contact manifolds and contacts points
-void CollisionDetectionSystem::createContacts() {
+/// The contact pairs of the islands are processed first (in the order of the islands) so that the
+/// contact manifolds and contact points of each island are contiguous in the arrays used by the
+/// contact solver. The contact pairs that are not part of any island (triggers or collision bodies)
+/// are processed afterwards.
+void CollisionDetectionSystem::createContacts(const List<uint>& islandsContactPairs) {
 
     RP3D_PROFILE("CollisionDetectionSystem::createContacts()", mProfiler);
 
     mCurrentContactManifolds->reserve(mCurrentContactPairs->size());
     mCurrentContactPoints->reserve(mCurrentContactManifolds->size());
 
+    // Compute the order in which the contact pairs are processed
+    List<uint> contactPairsOrder(mMemoryManager.getSingleFrameAllocator(), mCurrentContactPairs->size());
+    for (uint i=0; i < islandsContactPairs.size(); i++) {
+        contactPairsOrder.add(islandsContactPairs[i]);
+    }
+    for (uint p=0; p < mCurrentContactPairs->size(); p++) {
+        if (!(*mCurrentContactPairs)[p].isAlreadyInIsland) {
+            contactPairsOrder.add(p);
+        }
+    }
+    assert(contactPairsOrder.size() == mCurrentContactPairs->size());
+
     // For each contact pair
-    for (uint p=0; p < (*mCurrentContactPairs).size(); p++) {
+    for (uint i=0; i < contactPairsOrder.size(); i++) {
 
-        ContactPair& contactPair = (*mCurrentContactPairs)[p];
+        ContactPair& contactPair = (*mCurrentContactPairs)[contactPairsOrder[i]];
 
         contactPair.contactManifoldsIndex = mCurrentContactManifolds->size();
         contactPair.nbContactManifolds = contactPair.potentialContactManifoldsIndices.size();
@@ -767,7 +1003,11 @@ void CollisionDetectionSystem::createContacts() {
     mPreviousContactPoints->clear();
     mPreviousContactManifolds->clear();
     mPreviousContactPairs->clear();
-    mPreviousMapPairIdToContactPairIndex->clear();
+
+    // The memory of the map is released if it is much larger than the number of contact pairs
+    // because the time to clear the map depends on its capacity
+    const int nbPreviousContactPairs = mPreviousMapPairIdToContactPairIndex->size();
+    mPreviousMapPairIdToContactPairIndex->clear(mPreviousMapPairIdToContactPairIndex->capacity() > 8 * nbPreviousContactPairs + 64);
 
     // Reset the potential contacts
     mPotentialContactPoints.clear(true);
@@ -777,8 +1017,9 @@ void CollisionDetectionSystem::createContacts() {
 // Compute the lost contact pairs (contact pairs in contact in the previous frame but not in the current one)
 void CollisionDetectionSystem::computeLostContactPairs() {
 
-    // For each overlapping pair
-    for (uint i=0; i < mOverlappingPairs.getNbPairs(); i++) {
+    // For each active overlapping pair (the inactive pairs are not tested in the narrow-phase and
+    // cannot lose their contacts)
+    for (uint64 i=0; i < mOverlappingPairs.getNbActivePairs(); i++) {
 
         // If the two colliders of the pair were colliding in the previous frame but not in the current one
         if (mOverlappingPairs.mCollidingInPreviousFrame[i] && !mOverlappingPairs.mCollidingInCurrentFrame[i]) {
@@ -980,7 +1221,7 @@ void CollisionDetectionSystem::raycast(RaycastCallback* raycastCallback,
 // Convert the potential contact into actual contacts
 void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, bool updateLastFrameInfo,
                                                         List<ContactPointInfo>& potentialContactPoints,
-                                                        Map<uint64, uint>* mapPairIdToContactPairIndex,
+                                                        FlatMap<uint64, uint>* mapPairIdToContactPairIndex,
                                                         List<ContactManifoldInfo>& potentialContactManifolds,
                                                         List<ContactPair>* contactPairs,
                                                         Map<Entity, List<uint>>& mapBodyToContactPairs) {
@@ -1028,7 +1269,7 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
                 const uint newContactPairIndex = contactPairs->size();
                 ContactPair overlappingPairContact(pairId, body1Entity, body2Entity,
                                                    collider1Entity, collider2Entity,
-                                                   newContactPairIndex, mOverlappingPairs.getCollidingInPreviousFrame(pairId), isTrigger, mMemoryManager.getHeapAllocator());
+                                                   newContactPairIndex, mOverlappingPairs.getCollidingInPreviousFrame(pairId), isTrigger, mMemoryManager.getPoolAllocator());
                 contactPairs->add(overlappingPairContact);
                 pairContact = &((*contactPairs)[newContactPairIndex]);
                 mapPairIdToContactPairIndex->add(Pair<uint64, uint>(pairId, newContactPairIndex));
@@ -1038,7 +1279,7 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
                     itbodyContactPairs->second.add(newContactPairIndex);
                 }
                 else {
-                    List<uint> contactPairs(mMemoryManager.getPoolAllocator(), 1);
+                    List<uint> contactPairs(mMemoryManager.getThreadPoolAllocator(0), 1);
                     contactPairs.add(newContactPairIndex);
                     mapBodyToContactPairs.add(Pair<Entity, List<uint>>(body1Entity, contactPairs));
                 }
@@ -1047,7 +1288,7 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
                     itbodyContactPairs->second.add(newContactPairIndex);
                 }
                 else {
-                    List<uint> contactPairs(mMemoryManager.getPoolAllocator(), 1);
+                    List<uint> contactPairs(mMemoryManager.getThreadPoolAllocator(0), 1);
                     contactPairs.add(newContactPairIndex);
                     mapBodyToContactPairs.add(Pair<Entity, List<uint>>(body2Entity, contactPairs));
                 }
@@ -1101,7 +1342,7 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
                 if (!similarManifoldFound) {
 
                     // Create a new contact manifold for the overlapping pair
-                    ContactManifoldInfo contactManifoldInfo(pairId, mMemoryManager.getPoolAllocator());
+                    ContactManifoldInfo contactManifoldInfo(pairId, mMemoryManager.getThreadPoolAllocator(0));
 
                     // Add the contact point to the manifold
                     contactManifoldInfo.potentialContactPointsIndices.add(contactPointIndex);
@@ -1488,7 +1729,7 @@ void CollisionDetectionSystem::testOverlap(OverlapCallback& callback) {
     computeBroadPhase();
 
     // Compute the middle-phase collision detection
-    computeMiddlePhase(narrowPhaseInput, false);
+    computeMiddlePhase(narrowPhaseInput, false, false);
 
     // Compute the narrow-phase collision detection and report overlapping shapes
     computeNarrowPhaseOverlapSnapshot(narrowPhaseInput, &callback);
@@ -1572,7 +1813,7 @@ void CollisionDetectionSystem::testCollision(CollisionCallback& callback) {
     computeBroadPhase();
 
     // Compute the middle-phase collision detection
-    computeMiddlePhase(narrowPhaseInput, true);
+    computeMiddlePhase(narrowPhaseInput, true, false);
 
     // Compute the narrow-phase collision detection and report contacts
     computeNarrowPhaseCollisionSnapshot(narrowPhaseInput, callback);
@@ -1587,7 +1828,7 @@ void CollisionDetectionSystem::filterOverlappingPairs(Entity bodyEntity, List<ui
         if (mCollidersComponents.getBody(mOverlappingPairs.mColliders1[i]) == bodyEntity ||
             mCollidersComponents.getBody(mOverlappingPairs.mColliders2[i]) == bodyEntity) {
 
-            if (i < mOverlappingPairs.getNbConvexVsConvexPairs()) {
+            if (mOverlappingPairs.isConvexVsConvexPair(i)) {
                 convexPairs.add(mOverlappingPairs.mPairIds[i]);
             }
             else {
@@ -1609,7 +1850,7 @@ void CollisionDetectionSystem::filterOverlappingPairs(Entity body1Entity, Entity
         if ((collider1Body == body1Entity && collider2Body == body2Entity) ||
             (collider1Body == body2Entity && collider2Body == body1Entity)) {
 
-            if (i < mOverlappingPairs.getNbConvexVsConvexPairs()) {
+            if (mOverlappingPairs.isConvexVsConvexPair(i)) {
                 convexPairs.add(mOverlappingPairs.mPairIds[i]);
             }
             else {
@@ -29,18 +29,29 @@
 #include <reactphysics3d/components/BallAndSocketJointComponents.h>
 #include <reactphysics3d/utils/Profiler.h>
 #include <reactphysics3d/engine/Island.h>
+#include <reactphysics3d/engine/Islands.h>
+#include <reactphysics3d/engine/TaskScheduler.h>
+#include <reactphysics3d/memory/MemoryManager.h>
 
 using namespace reactphysics3d;
 
 // Constructor
-ConstraintSolverSystem::ConstraintSolverSystem(PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
+ConstraintSolverSystem::ConstraintSolverSystem(PhysicsWorld& world, MemoryManager& memoryManager, TaskScheduler& taskScheduler,
+                                               Islands& islands, RigidBodyComponents& rigidBodyComponents,
                                                TransformComponents& transformComponents,
                                                JointComponents& jointComponents,
                                                BallAndSocketJointComponents& ballAndSocketJointComponents,
                                                FixedJointComponents& fixedJointComponents,
                                                HingeJointComponents& hingeJointComponents,
                                                SliderJointComponents& sliderJointComponents)
-                 : mIsWarmStartingActive(true), mIslands(islands),
+                 : mIsWarmStartingActive(true), mMemoryManager(memoryManager), mIslands(islands), mTaskScheduler(taskScheduler),
+                   mBallAndSocketJointComponents(ballAndSocketJointComponents), mFixedJointComponents(fixedJointComponents),
+                   mHingeJointComponents(hingeJointComponents), mSliderJointComponents(sliderJointComponents),
+                   mBallAndSocketIslandsJoints(memoryManager.getPoolAllocator()), mFixedIslandsJoints(memoryManager.getPoolAllocator()),
+                   mHingeIslandsJoints(memoryManager.getPoolAllocator()), mSliderIslandsJoints(memoryManager.getPoolAllocator()),
+                   mColoring(memoryManager.getPoolAllocator()),
+                   mBallAndSocketColorsJoints(memoryManager.getPoolAllocator()), mFixedColorsJoints(memoryManager.getPoolAllocator()),
+                   mHingeColorsJoints(memoryManager.getPoolAllocator()), mSliderColorsJoints(memoryManager.getPoolAllocator()),
                    mConstraintSolverData(rigidBodyComponents, jointComponents),
                    mSolveBallAndSocketJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, ballAndSocketJointComponents),
                    mSolveFixedJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, fixedJointComponents),
@@ -77,37 +88,290 @@ void ConstraintSolverSystem::initialize(decimal dt) {
     mSolveSliderJointSystem.setTimeStep(dt);
     mSolveSliderJointSystem.setIsWarmStartingActive(mIsWarmStartingActive);
 
-    mSolveBallAndSocketJointSystem.initBeforeSolve();
-    mSolveFixedJointSystem.initBeforeSolve();
-    mSolveHingeJointSystem.initBeforeSolve();
-    mSolveSliderJointSystem.initBeforeSolve();
+    // Compute the island of each awake body. Static bodies can be part of several islands
+    // and are therefore skipped (a joint always belongs to the island of its non-static body)
+    const uint32 nbIslands = mIslands.getNbIslands();
+    RigidBodyComponents& rigidBodyComponents = mConstraintSolverData.rigidBodyComponents;
+    // Only the awake bodies (stored first in the components) can be in an island
+    const uint32 nbEnabledBodies = rigidBodyComponents.getNbEnabledComponents();
+    List<uint32> bodiesIslands(mMemoryManager.getSingleFrameAllocator(), nbEnabledBodies);
+    for (uint32 b=0; b < nbEnabledBodies; b++) {
+        bodiesIslands.add(nbIslands);
+    }
+    for (uint32 i=0; i < nbIslands; i++) {
+        for (uint32 b=0; b < mIslands.bodyEntities[i].size(); b++) {
+
+            const uint32 bodyIndex = rigidBodyComponents.getEntityIndex(mIslands.bodyEntities[i][b]);
+            if (rigidBodyComponents.mBodyTypes[bodyIndex] != BodyType::STATIC) {
+                assert(bodyIndex < nbEnabledBodies);
+                bodiesIslands[bodyIndex] = i;
+            }
+        }
+    }
+
+    // Sort the joints by island
+    computeIslandsJoints(mBallAndSocketJointComponents, bodiesIslands, mBallAndSocketIslandsJoints);
+    computeIslandsJoints(mFixedJointComponents, bodiesIslands, mFixedIslandsJoints);
+    computeIslandsJoints(mHingeJointComponents, bodiesIslands, mHingeIslandsJoints);
+    computeIslandsJoints(mSliderJointComponents, bodiesIslands, mSliderIslandsJoints);
+
+    // The initialization of a joint only writes the data of the joint itself and can be done in parallel
+    mTaskScheduler.parallelFor(0, mBallAndSocketJointComponents.getNbEnabledComponents(), PARALLEL_FOR_GRAIN_SIZE,
+                               [&](uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+        mSolveBallAndSocketJointSystem.initBeforeSolve(startIndex, endIndex);
+    });
+    mTaskScheduler.parallelFor(0, mFixedJointComponents.getNbEnabledComponents(), PARALLEL_FOR_GRAIN_SIZE,
+                               [&](uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+        mSolveFixedJointSystem.initBeforeSolve(startIndex, endIndex);
+    });
+    mTaskScheduler.parallelFor(0, mHingeJointComponents.getNbEnabledComponents(), PARALLEL_FOR_GRAIN_SIZE,
+                               [&](uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+        mSolveHingeJointSystem.initBeforeSolve(startIndex, endIndex);
+    });
+    mTaskScheduler.parallelFor(0, mSliderJointComponents.getNbEnabledComponents(), PARALLEL_FOR_GRAIN_SIZE,
+                               [&](uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+        mSolveSliderJointSystem.initBeforeSolve(startIndex, endIndex);
+    });
 
     if (mIsWarmStartingActive) {
-        mSolveBallAndSocketJointSystem.warmstart();
-        mSolveFixedJointSystem.warmstart();
-        mSolveHingeJointSystem.warmstart();
-        mSolveSliderJointSystem.warmstart();
+
+        // The islands do not share any dynamic body and can be warm started in parallel
+        mTaskScheduler.parallelFor(0, nbIslands, PARALLEL_ISLANDS_GRAIN_SIZE,
+                                   [&](uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+
+            for (uint32 i=startIndex; i < endIndex; i++) {
+
+                mSolveBallAndSocketJointSystem.warmstart(mBallAndSocketIslandsJoints.componentsIndices,
+                                                         mBallAndSocketIslandsJoints.groupsStartIndices[i],
+                                                         mBallAndSocketIslandsJoints.groupsStartIndices[i+1]);
+                mSolveFixedJointSystem.warmstart(mFixedIslandsJoints.componentsIndices,
+                                                 mFixedIslandsJoints.groupsStartIndices[i],
+                                                 mFixedIslandsJoints.groupsStartIndices[i+1]);
+                mSolveHingeJointSystem.warmstart(mHingeIslandsJoints.componentsIndices,
+                                                 mHingeIslandsJoints.groupsStartIndices[i],
+                                                 mHingeIslandsJoints.groupsStartIndices[i+1]);
+                mSolveSliderJointSystem.warmstart(mSliderIslandsJoints.componentsIndices,
+                                                  mSliderIslandsJoints.groupsStartIndices[i],
+                                                  mSliderIslandsJoints.groupsStartIndices[i+1]);
+            }
+        });
+    }
+}
+
+// Sort the enabled components of a given type of joint by island
+/// The joints are sorted with a counting sort that keeps the order of the components inside
+/// each island. Therefore, the joints of an island are solved in the same order as if all the
+/// joints of the world were solved sequentially. A joint that is not part of any island (both
+/// bodies are static or sleeping) does not need to be solved.
+template<typename JointsComponents>
+void ConstraintSolverSystem::computeIslandsJoints(const JointsComponents& jointsComponents, const List<uint32>& bodiesIslands,
+                                                  JointsGroups& islandsJoints) const {
+
+    const uint32 nbIslands = mIslands.getNbIslands();
+    const uint32 nbJoints = jointsComponents.getNbEnabledComponents();
+    const RigidBodyComponents& rigidBodyComponents = mConstraintSolverData.rigidBodyComponents;
+    const JointComponents& jointComponents = mConstraintSolverData.jointComponents;
+
+    // Compute the island of each joint and count the number of joints per island (the
+    // last slot is used for the joints that are not part of any island)
+    List<uint32> jointsIslands(mMemoryManager.getSingleFrameAllocator(), nbJoints);
+    islandsJoints.groupsStartIndices.clear();
+    for (uint32 i=0; i < nbIslands + 2; i++) {
+        islandsJoints.groupsStartIndices.add(0);
+    }
+    for (uint32 j=0; j < nbJoints; j++) {
+
+        const Entity jointEntity = jointsComponents.mJointEntities[j];
+        const uint32 body1Index = rigidBodyComponents.getEntityIndex(jointComponents.getBody1Entity(jointEntity));
+        const uint32 body2Index = rigidBodyComponents.getEntityIndex(jointComponents.getBody2Entity(jointEntity));
+
+        // The disabled bodies are not part of any island
+        const uint32 island1 = body1Index < bodiesIslands.size() ? bodiesIslands[body1Index] : nbIslands;
+        const uint32 island2 = body2Index < bodiesIslands.size() ? bodiesIslands[body2Index] : nbIslands;
+        assert(island1 == nbIslands || island2 == nbIslands || island1 == island2);
+
+        const uint32 islandIndex = island1 < nbIslands ? island1 : island2;
+        jointsIslands.add(islandIndex);
+        islandsJoints.groupsStartIndices[islandIndex + 1]++;
+    }
+
+    // Compute the index of the first joint of each island
+    for (uint32 i=1; i < nbIslands + 2; i++) {
+        islandsJoints.groupsStartIndices[i] += islandsJoints.groupsStartIndices[i-1];
+    }
+
+    // Place the joints in their island
+    List<uint32> insertIndices(mMemoryManager.getSingleFrameAllocator(), nbIslands + 1);
+    for (uint32 i=0; i < nbIslands + 1; i++) {
+        insertIndices.add(islandsJoints.groupsStartIndices[i]);
+    }
+    islandsJoints.componentsIndices.clear();
+    islandsJoints.componentsIndices.reserve(nbJoints);
+    islandsJoints.componentsIndices.addWithoutInit(nbJoints);
+    for (uint32 j=0; j < nbJoints; j++) {
+        islandsJoints.componentsIndices[insertIndices[jointsIslands[j]]++] = j;
+    }
+}
+
+// Solve the velocity constraints of the joints of an island
+/// This method can be called concurrently for different islands
+void ConstraintSolverSystem::solveVelocityConstraints(uint32 islandIndex) {
+
+    mSolveBallAndSocketJointSystem.solveVelocityConstraint(mBallAndSocketIslandsJoints.componentsIndices,
+                                                           mBallAndSocketIslandsJoints.groupsStartIndices[islandIndex],
+                                                           mBallAndSocketIslandsJoints.groupsStartIndices[islandIndex+1]);
+    mSolveFixedJointSystem.solveVelocityConstraint(mFixedIslandsJoints.componentsIndices,
+                                                   mFixedIslandsJoints.groupsStartIndices[islandIndex],
+                                                   mFixedIslandsJoints.groupsStartIndices[islandIndex+1]);
+    mSolveHingeJointSystem.solveVelocityConstraint(mHingeIslandsJoints.componentsIndices,
+                                                   mHingeIslandsJoints.groupsStartIndices[islandIndex],
+                                                   mHingeIslandsJoints.groupsStartIndices[islandIndex+1]);
+    mSolveSliderJointSystem.solveVelocityConstraint(mSliderIslandsJoints.componentsIndices,
+                                                    mSliderIslandsJoints.groupsStartIndices[islandIndex],
+                                                    mSliderIslandsJoints.groupsStartIndices[islandIndex+1]);
+}
+
+// Solve the position constraints of the joints of an island
+void ConstraintSolverSystem::solvePositionConstraints(uint32 islandIndex) {
+
+    mSolveBallAndSocketJointSystem.solvePositionConstraint(mBallAndSocketIslandsJoints.componentsIndices,
+                                                           mBallAndSocketIslandsJoints.groupsStartIndices[islandIndex],
+                                                           mBallAndSocketIslandsJoints.groupsStartIndices[islandIndex+1]);
+    mSolveFixedJointSystem.solvePositionConstraint(mFixedIslandsJoints.componentsIndices,
+                                                   mFixedIslandsJoints.groupsStartIndices[islandIndex],
+                                                   mFixedIslandsJoints.groupsStartIndices[islandIndex+1]);
+    mSolveHingeJointSystem.solvePositionConstraint(mHingeIslandsJoints.componentsIndices,
+                                                   mHingeIslandsJoints.groupsStartIndices[islandIndex],
+                                                   mHingeIslandsJoints.groupsStartIndices[islandIndex+1]);
+    mSolveSliderJointSystem.solvePositionConstraint(mSliderIslandsJoints.componentsIndices,
+                                                    mSliderIslandsJoints.groupsStartIndices[islandIndex],
+                                                    mSliderIslandsJoints.groupsStartIndices[islandIndex+1]);
+}
+
+// Return the number of joints in an island
+uint32 ConstraintSolverSystem::getNbIslandJoints(uint32 islandIndex) const {
+
+    return mBallAndSocketIslandsJoints.groupsStartIndices[islandIndex+1] - mBallAndSocketIslandsJoints.groupsStartIndices[islandIndex] +
+           mFixedIslandsJoints.groupsStartIndices[islandIndex+1] - mFixedIslandsJoints.groupsStartIndices[islandIndex] +
+           mHingeIslandsJoints.groupsStartIndices[islandIndex+1] - mHingeIslandsJoints.groupsStartIndices[islandIndex] +
+           mSliderIslandsJoints.groupsStartIndices[islandIndex+1] - mSliderIslandsJoints.groupsStartIndices[islandIndex];
+}
+
+// Compute the graph coloring of the joints of an island
+/// Contrary to the contacts, the static bodies are taken into account by the coloring of the joints
+/// because the position solver of the joints renormalizes the orientation of all the bodies
+void ConstraintSolverSystem::computeIslandColoring(uint32 islandIndex) {
+
+    RP3D_PROFILE("ConstraintSolverSystem::computeIslandColoring()", mProfiler);
+
+    const RigidBodyComponents& rigidBodyComponents = mConstraintSolverData.rigidBodyComponents;
+    const JointComponents& jointComponents = mConstraintSolverData.jointComponents;
+
+    const JointsGroups* islandsJoints[4] = {&mBallAndSocketIslandsJoints, &mFixedIslandsJoints, &mHingeIslandsJoints, &mSliderIslandsJoints};
+    const Entity* jointsEntities[4] = {mBallAndSocketJointComponents.mJointEntities, mFixedJointComponents.mJointEntities,
+                                       mHingeJointComponents.mJointEntities, mSliderJointComponents.mJointEntities};
+    JointsGroups* colorsJoints[4] = {&mBallAndSocketColorsJoints, &mFixedColorsJoints, &mHingeColorsJoints, &mSliderColorsJoints};
+
+    // Get the bodies of all the joints of the island
+    const uint32 nbJoints = getNbIslandJoints(islandIndex);
+    List<uint32> bodies1(mMemoryManager.getSingleFrameAllocator(), nbJoints);
+    List<uint32> bodies2(mMemoryManager.getSingleFrameAllocator(), nbJoints);
+    List<uint32> jointsTypes(mMemoryManager.getSingleFrameAllocator(), nbJoints);
+    List<uint32> jointsComponentsIndices(mMemoryManager.getSingleFrameAllocator(), nbJoints);
+    uint32 nbBodies = 0;
+    for (uint32 t=0; t < 4; t++) {
+
+        const JointsGroups& joints = *islandsJoints[t];
+        for (uint32 j=joints.groupsStartIndices[islandIndex]; j < joints.groupsStartIndices[islandIndex+1]; j++) {
+
+            const Entity jointEntity = jointsEntities[t][joints.componentsIndices[j]];
+            const uint32 body1 = rigidBodyComponents.getEntityIndex(jointComponents.getBody1Entity(jointEntity));
+            const uint32 body2 = rigidBodyComponents.getEntityIndex(jointComponents.getBody2Entity(jointEntity));
+            bodies1.add(body1);
+            bodies2.add(body2);
+            jointsTypes.add(t);
+            jointsComponentsIndices.add(joints.componentsIndices[j]);
+            nbBodies = std::max(nbBodies, std::max(body1, body2) + 1);
+        }
+    }
+
+    // Only the bodies up to the largest index of the island are colored (and not all the bodies of the world)
+    mColoring.computeColors(bodies1, bodies2, nbBodies);
+
+    // Sort the joints of each type by color (the last group contains the joints that could not be colored)
+    for (uint32 t=0; t < 4; t++) {
+        colorsJoints[t]->componentsIndices.clear();
+        colorsJoints[t]->groupsStartIndices.clear();
+    }
+    const List<uint32>& coloredJoints = mColoring.getConstraintsIndices();
+    for (uint32 color=0; color <= mColoring.getNbColors(); color++) {
+
+        for (uint32 t=0; t < 4; t++) {
+            colorsJoints[t]->groupsStartIndices.add(colorsJoints[t]->componentsIndices.size());
+        }
+
+        const uint32 endIndex = color < mColoring.getNbColors() ? mColoring.getColorStartIndex(color + 1) : mColoring.getNbConstraints();
+        for (uint32 j=mColoring.getColorStartIndex(color); j < endIndex; j++) {
+            colorsJoints[jointsTypes[coloredJoints[j]]]->componentsIndices.add(jointsComponentsIndices[coloredJoints[j]]);
+        }
+    }
+    for (uint32 t=0; t < 4; t++) {
+        colorsJoints[t]->groupsStartIndices.add(colorsJoints[t]->componentsIndices.size());
+    }
+}
+
+// Solve the joints of the colored island with a given solve function
+/// The joints of a color do not share any body and are solved in parallel. The colors are solved
+/// one after the other and the joints that could not be colored are solved sequentially at the end.
+template<typename SolveFunction>
+void ConstraintSolverSystem::solveColoredIslandJoints(SolveFunction solveJoints) {
+
+    const JointsGroups* colorsJoints[4] = {&mBallAndSocketColorsJoints, &mFixedColorsJoints, &mHingeColorsJoints, &mSliderColorsJoints};
+
+    const uint32 nbColors = mColoring.getNbColors();
+    for (uint32 color=0; color < nbColors; color++) {
+
+        for (uint32 t=0; t < 4; t++) {
+
+            const JointsGroups& joints = *colorsJoints[t];
+            mTaskScheduler.parallelFor(joints.groupsStartIndices[color], joints.groupsStartIndices[color+1], PARALLEL_COLOR_GRAIN_SIZE,
+                                       [&](uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+                solveJoints(t, joints.componentsIndices, startIndex, endIndex);
+            });
+        }
+    }
+
+    // Solve the joints that could not be colored
+    for (uint32 t=0; t < 4; t++) {
+        const JointsGroups& joints = *colorsJoints[t];
+        solveJoints(t, joints.componentsIndices, joints.groupsStartIndices[nbColors], joints.groupsStartIndices[nbColors+1]);
     }
 }
 
-// Solve the velocity constraints
-void ConstraintSolverSystem::solveVelocityConstraints() {
+// Solve the velocity constraints of the joints of the colored island
+void ConstraintSolverSystem::solveColoredIslandVelocityConstraints() {
 
-    RP3D_PROFILE("ConstraintSolverSystem::solveVelocityConstraints()", mProfiler);
+    solveColoredIslandJoints([this](uint32 jointType, const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex) {
 
-    mSolveBallAndSocketJointSystem.solveVelocityConstraint();
-    mSolveFixedJointSystem.solveVelocityConstraint();
-    mSolveHingeJointSystem.solveVelocityConstraint();
-    mSolveSliderJointSystem.solveVelocityConstraint();
+        switch (jointType) {
+            case 0: mSolveBallAndSocketJointSystem.solveVelocityConstraint(componentsIndices, startIndex, endIndex); break;
+            case 1: mSolveFixedJointSystem.solveVelocityConstraint(componentsIndices, startIndex, endIndex); break;
+            case 2: mSolveHingeJointSystem.solveVelocityConstraint(componentsIndices, startIndex, endIndex); break;
+            default: mSolveSliderJointSystem.solveVelocityConstraint(componentsIndices, startIndex, endIndex); break;
+        }
+    });
 }
 
-// Solve the position constraints
-void ConstraintSolverSystem::solvePositionConstraints() {
+// Solve the position constraints of the joints of the colored island
+void ConstraintSolverSystem::solveColoredIslandPositionConstraints() {
 
-    RP3D_PROFILE("ConstraintSolverSystem::solvePositionConstraints()", mProfiler);
+    solveColoredIslandJoints([this](uint32 jointType, const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex) {
 
-    mSolveBallAndSocketJointSystem.solvePositionConstraint();
-    mSolveFixedJointSystem.solvePositionConstraint();
-    mSolveHingeJointSystem.solvePositionConstraint();
-    mSolveSliderJointSystem.solvePositionConstraint();
+        switch (jointType) {
+            case 0: mSolveBallAndSocketJointSystem.solvePositionConstraint(componentsIndices, startIndex, endIndex); break;
+            case 1: mSolveFixedJointSystem.solvePositionConstraint(componentsIndices, startIndex, endIndex); break;
+            case 2: mSolveHingeJointSystem.solvePositionConstraint(componentsIndices, startIndex, endIndex); break;
+            default: mSolveSliderJointSystem.solvePositionConstraint(componentsIndices, startIndex, endIndex); break;
+        }
+    });
 }
@@ -34,6 +34,8 @@
 #include <reactphysics3d/components/CollisionBodyComponents.h>
 #include <reactphysics3d/components/ColliderComponents.h>
 #include <reactphysics3d/collision/ContactManifold.h>
+#include <reactphysics3d/engine/TaskScheduler.h>
+#include <cstring>
 
 using namespace reactphysics3d;
 using namespace std;
@@ -42,16 +44,22 @@ using namespace std;
 const decimal ContactSolverSystem::BETA = decimal(0.2);
 const decimal ContactSolverSystem::BETA_SPLIT_IMPULSE = decimal(0.2);
 const decimal ContactSolverSystem::SLOP = decimal(0.01);
+const uint32 ContactSolverSystem::INVALID_MANIFOLD_INDEX = ~uint32(0);
+const uint32 ContactSolverSystem::NB_OPEN_BLOCKS;
+const uint32 ContactSolverSystem::MAX_NB_CONTACT_POINTS_IN_BLOCK;
 
 // Constructor
-ContactSolverSystem::ContactSolverSystem(MemoryManager& memoryManager, PhysicsWorld& world, Islands& islands,
+ContactSolverSystem::ContactSolverSystem(MemoryManager& memoryManager, PhysicsWorld& world, TaskScheduler& taskScheduler, Islands& islands,
                                          CollisionBodyComponents& bodyComponents, RigidBodyComponents& rigidBodyComponents,
                                          ColliderComponents& colliderComponents, decimal& restitutionVelocityThreshold)
-              :mMemoryManager(memoryManager), mWorld(world), mRestitutionVelocityThreshold(restitutionVelocityThreshold),
+              :mMemoryManager(memoryManager), mWorld(world), mTaskScheduler(taskScheduler), mRestitutionVelocityThreshold(restitutionVelocityThreshold),
                mContactConstraints(nullptr), mContactPoints(nullptr),
                mIslands(islands), mAllContactManifolds(nullptr), mAllContactPoints(nullptr),
                mBodyComponents(bodyComponents), mRigidBodyComponents(rigidBodyComponents),
-               mColliderComponents(colliderComponents), mIsSplitImpulseActive(true) {
+               mColliderComponents(colliderComponents), mIsSplitImpulseActive(true),
+               mColoring(memoryManager.getPoolAllocator()), mColoredIslandIndex(0), mIsWideSolverActive(false),
+               mContactBlocks(nullptr), mNbContactBlocks(0), mIslandsBlocksStartIndices(nullptr), mContactManifoldsLanes(nullptr),
+               mColoredIslandBlocks(nullptr), mColorsBlocksStartIndices(memoryManager.getPoolAllocator()) {
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -73,11 +81,12 @@ void ContactSolverSystem::init(List<ContactManifold>* contactManifolds, List<Con
     uint nbContactManifolds = mAllContactManifolds->size();
     uint nbContactPoints = mAllContactPoints->size();
 
-    mNbContactManifolds = 0;
-    mNbContactPoints = 0;
-
     mContactConstraints = nullptr;
     mContactPoints = nullptr;
+    mContactBlocks = nullptr;
+    mNbContactBlocks = 0;
+    mIslandsBlocksStartIndices = nullptr;
+    mContactManifoldsLanes = nullptr;
 
     if (nbContactManifolds == 0 || nbContactPoints == 0) return;
 
@@ -89,16 +98,22 @@ void ContactSolverSystem::init(List<ContactManifold>* contactManifolds, List<Con
                                                                                       sizeof(ContactManifoldSolver) * nbContactManifolds));
     assert(mContactConstraints != nullptr);
 
-    // For each island of the world
-    for (uint i = 0; i < mIslands.getNbIslands(); i++) {
+    // The contact manifolds of each island are stored contiguously in the manifolds array. Therefore, each
+    // island writes its own range of the contact constraints and contact points arrays and the islands can be
+    // initialized in parallel
+    mTaskScheduler.parallelFor(0, mIslands.getNbIslands(), PARALLEL_ISLANDS_GRAIN_SIZE,
+                               [&](uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
 
-        if (mIslands.nbContactManifolds[i] > 0) {
-            initializeForIsland(i);
-        }
-    }
+        for (uint32 i = startIndex; i < endIndex; i++) {
+
+            if (mIslands.nbContactManifolds[i] > 0) {
+                initializeForIsland(i);
 
-    // Warmstarting
-    warmStart();
+                // Warmstarting
+                warmStart(i);
+            }
+        }
+    });
 }
 
 // Release allocated memory
@@ -106,13 +121,282 @@ void ContactSolverSystem::reset() {
 
     if (mAllContactPoints->size() > 0) mMemoryManager.release(MemoryManager::AllocationType::Frame, mContactPoints, sizeof(ContactPointSolver) * mAllContactPoints->size());
     if (mAllContactManifolds->size() > 0) mMemoryManager.release(MemoryManager::AllocationType::Frame, mContactConstraints, sizeof(ContactManifoldSolver) * mAllContactManifolds->size());
+
+    // Release the blocks of the wide solver
+    if (mContactManifoldsLanes != nullptr) {
+        mMemoryManager.release(MemoryManager::AllocationType::Frame, mContactManifoldsLanes, sizeof(uint32) * mAllContactManifolds->size());
+        mMemoryManager.release(MemoryManager::AllocationType::Frame, mIslandsBlocksStartIndices, sizeof(uint32) * (mIslands.getNbIslands() + 1));
+        mContactManifoldsLanes = nullptr;
+        mIslandsBlocksStartIndices = nullptr;
+    }
+    if (mContactBlocks != nullptr) {
+        mMemoryManager.release(MemoryManager::AllocationType::Frame, mContactBlocks, sizeof(ContactManifoldsBlockSolver) * mNbContactBlocks);
+        mContactBlocks = nullptr;
+    }
+    if (mColoredIslandBlocks != nullptr) {
+        mMemoryManager.release(MemoryManager::AllocationType::Frame, mColoredIslandBlocks,
+                               sizeof(ContactManifoldsBlockSolver) * mColorsBlocksStartIndices[mColorsBlocksStartIndices.size() - 1]);
+        mColoredIslandBlocks = nullptr;
+    }
+}
+
+// Pack the contact manifolds of the islands into blocks for the wide solver
+/// The islands that are solved with a graph coloring of their constraints are packed later, one
+/// color after the other, when the coloring of the island is computed
+void ContactSolverSystem::createBlocks() {
+
+    RP3D_PROFILE("ContactSolverSystem::createBlocks()", mProfiler);
+
+    assert(mIsWideSolverActive);
+
+    const uint32 nbIslands = mIslands.getNbIslands();
+    const uint32 nbContactManifolds = mAllContactManifolds->size();
+    if (nbContactManifolds == 0 || mAllContactPoints->size() == 0) return;
+
+    mIslandsBlocksStartIndices = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
+                                                                              sizeof(uint32) * (nbIslands + 1)));
+    mContactManifoldsLanes = static_cast<uint32*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
+                                                                          sizeof(uint32) * nbContactManifolds));
+
+    // The islands do not share any dynamic body and their manifolds can be assigned to lanes in parallel
+    mTaskScheduler.parallelFor(0, nbIslands, PARALLEL_ISLANDS_GRAIN_SIZE,
+                               [&](uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+
+        for (uint32 i=startIndex; i < endIndex; i++) {
+            mIslandsBlocksStartIndices[i + 1] = mIslands.isSolvedWithGraphColoring[i] ? 0 : computeIslandBlocksLanes(i);
+        }
+    });
+
+    // Compute the index of the first block of each island
+    mIslandsBlocksStartIndices[0] = 0;
+    for (uint32 i=0; i < nbIslands; i++) {
+        mIslandsBlocksStartIndices[i + 1] += mIslandsBlocksStartIndices[i];
+    }
+    mNbContactBlocks = mIslandsBlocksStartIndices[nbIslands];
+    if (mNbContactBlocks == 0) return;
+
+    mContactBlocks = static_cast<ContactManifoldsBlockSolver*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
+                                                                                       sizeof(ContactManifoldsBlockSolver) * mNbContactBlocks));
+    assert(mContactBlocks != nullptr);
+
+    // Copy the solver data of the manifolds into the blocks
+    mTaskScheduler.parallelFor(0, nbIslands, PARALLEL_ISLANDS_GRAIN_SIZE,
+                               [&](uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+
+        for (uint32 i=startIndex; i < endIndex; i++) {
+
+            if (mIslandsBlocksStartIndices[i] == mIslandsBlocksStartIndices[i + 1]) continue;
+
+            for (uint32 b=mIslandsBlocksStartIndices[i]; b < mIslandsBlocksStartIndices[i + 1]; b++) {
+                initBlock(mContactBlocks[b]);
+            }
+
+            const uint32 contactManifoldsIndex = mIslands.contactManifoldsIndices[i];
+            for (uint32 m=contactManifoldsIndex; m < contactManifoldsIndex + mIslands.nbContactManifolds[i]; m++) {
+
+                const uint32 lane = mContactManifoldsLanes[m];
+                packContactManifold(mContactBlocks[mIslandsBlocksStartIndices[i] + lane / SIMD_DECIMAL_NB_LANES],
+                                    lane % SIMD_DECIMAL_NB_LANES, m);
+            }
+        }
+    });
+}
+
+// Assign the contact manifolds of an island to the lanes of its blocks and return the number of blocks
+/// The manifolds are assigned greedily, in the order of the island, to the first open block that does
+/// not already contain one of their dynamic bodies. Only the NB_OPEN_BLOCKS last blocks are considered
+/// so that the assignment stays linear in the number of manifolds. The static bodies are ignored
+/// because their velocities are never written by the solver.
+uint32 ContactSolverSystem::computeIslandBlocksLanes(uint32 islandIndex) {
+
+    // Block that can still receive contact manifolds
+    struct OpenBlock {
+
+        /// Index of the block in the island
+        uint32 blockIndex;
+
+        /// Number of used lanes
+        uint32 nbLanes;
+
+        /// Non-static bodies of the manifolds of the block
+        uint32 bodies[2 * SIMD_DECIMAL_NB_LANES];
+    };
+
+    OpenBlock openBlocks[NB_OPEN_BLOCKS];
+    uint32 nbOpenBlocks = 0;
+    uint32 nbBlocks = 0;
+
+    const uint32 contactManifoldsIndex = mIslands.contactManifoldsIndices[islandIndex];
+    const uint32 nbContactManifolds = mIslands.nbContactManifolds[islandIndex];
+    for (uint32 m=contactManifoldsIndex; m < contactManifoldsIndex + nbContactManifolds; m++) {
+
+        uint32 bodies[2] = {mContactConstraints[m].rigidBodyComponentIndexBody1, mContactConstraints[m].rigidBodyComponentIndexBody2};
+        uint32 nbBodies = 0;
+        for (uint32 k=0; k < 2; k++) {
+            if (mRigidBodyComponents.mBodyTypes[bodies[k]] != BodyType::STATIC) {
+                bodies[nbBodies++] = bodies[k];
+            }
+        }
+
+        // Find the first open block without any of the bodies of the manifold
+        uint32 b = 0;
+        for (; b < nbOpenBlocks; b++) {
+
+            bool isBodyInBlock = false;
+            for (uint32 l=0; l < 2 * openBlocks[b].nbLanes && !isBodyInBlock; l++) {
+                for (uint32 k=0; k < nbBodies; k++) {
+                    isBodyInBlock |= openBlocks[b].bodies[l] == bodies[k];
+                }
+            }
+
+            if (!isBodyInBlock) break;
+        }
+
+        // If there is no such block, we open a new one (and close the oldest open block if necessary)
+        if (b == nbOpenBlocks) {
+
+            if (nbOpenBlocks == NB_OPEN_BLOCKS) {
+                for (uint32 o=1; o < nbOpenBlocks; o++) {
+                    openBlocks[o - 1] = openBlocks[o];
+                }
+                nbOpenBlocks--;
+            }
+
+            b = nbOpenBlocks;
+            openBlocks[b].blockIndex = nbBlocks;
+            openBlocks[b].nbLanes = 0;
+            nbOpenBlocks++;
+            nbBlocks++;
+        }
+
+        // Add the manifold into the next lane of the block
+        OpenBlock& block = openBlocks[b];
+        mContactManifoldsLanes[m] = block.blockIndex * SIMD_DECIMAL_NB_LANES + block.nbLanes;
+        block.bodies[2 * block.nbLanes] = nbBodies > 0 ? bodies[0] : ConstraintGraphColoring::IGNORED_BODY;
+        block.bodies[2 * block.nbLanes + 1] = nbBodies > 1 ? bodies[1] : ConstraintGraphColoring::IGNORED_BODY;
+        block.nbLanes++;
+
+        // Close the block if it is full
+        if (block.nbLanes == SIMD_DECIMAL_NB_LANES) {
+            for (uint32 o=b + 1; o < nbOpenBlocks; o++) {
+                openBlocks[o - 1] = openBlocks[o];
+            }
+            nbOpenBlocks--;
+        }
+    }
+
+    return nbBlocks;
+}
+
+// Initialize a block of contact manifolds with empty lanes
+void ContactSolverSystem::initBlock(ContactManifoldsBlockSolver& block) const {
+
+    std::memset(&block, 0, sizeof(ContactManifoldsBlockSolver));
+
+    for (uint32 lane=0; lane < SIMD_DECIMAL_NB_LANES; lane++) {
+        block.contactManifoldsIndices[lane] = INVALID_MANIFOLD_INDEX;
+    }
+}
+
+// Copy the solver data of a contact manifold into a lane of a block
+void ContactSolverSystem::packContactManifold(ContactManifoldsBlockSolver& block, uint32 lane, uint32 contactManifoldIndex) const {
+
+    const ContactManifoldSolver& manifold = mContactConstraints[contactManifoldIndex];
+
+    assert(lane < SIMD_DECIMAL_NB_LANES);
+    assert(block.contactManifoldsIndices[lane] == INVALID_MANIFOLD_INDEX);
+    assert(manifold.nbContacts <= int8(MAX_NB_CONTACT_POINTS_IN_BLOCK));
+
+    block.contactManifoldsIndices[lane] = contactManifoldIndex;
+    block.rigidBodyComponentIndexBody1[lane] = manifold.rigidBodyComponentIndexBody1;
+    block.rigidBodyComponentIndexBody2[lane] = manifold.rigidBodyComponentIndexBody2;
+    block.isBody1Updated[lane] = manifold.isBody1Updated;
+    block.isBody2Updated[lane] = manifold.isBody2Updated;
+    block.nbContacts = std::max(block.nbContacts, manifold.nbContacts);
+    block.hasRollingResistance |= manifold.rollingResistanceFactor > 0;
+
+    block.massInverseBody1[lane] = manifold.massInverseBody1;
+    block.massInverseBody2[lane] = manifold.massInverseBody2;
+    block.inverseInertiaTensorBody1.setLane(lane, manifold.inverseInertiaTensorBody1);
+    block.inverseInertiaTensorBody2.setLane(lane, manifold.inverseInertiaTensorBody2);
+    block.frictionCoefficient[lane] = manifold.frictionCoefficient;
+    block.rollingResistanceFactor[lane] = manifold.rollingResistanceFactor;
+    block.normal.setLane(lane, manifold.normal);
+    block.r1Friction.setLane(lane, manifold.r1Friction);
+    block.r2Friction.setLane(lane, manifold.r2Friction);
+    block.r1CrossT1.setLane(lane, manifold.r1CrossT1);
+    block.r1CrossT2.setLane(lane, manifold.r1CrossT2);
+    block.r2CrossT1.setLane(lane, manifold.r2CrossT1);
+    block.r2CrossT2.setLane(lane, manifold.r2CrossT2);
+    block.inverseFriction1Mass[lane] = manifold.inverseFriction1Mass;
+    block.inverseFriction2Mass[lane] = manifold.inverseFriction2Mass;
+    block.inverseTwistFrictionMass[lane] = manifold.inverseTwistFrictionMass;
+    block.inverseRollingResistance.setLane(lane, manifold.inverseRollingResistance);
+    block.frictionVector1.setLane(lane, manifold.frictionVector1);
+    block.frictionVector2.setLane(lane, manifold.frictionVector2);
+    block.friction1Impulse[lane] = manifold.friction1Impulse;
+    block.friction2Impulse[lane] = manifold.friction2Impulse;
+    block.frictionTwistImpulse[lane] = manifold.frictionTwistImpulse;
+    block.rollingResistanceImpulse.setLane(lane, manifold.rollingResistanceImpulse);
+
+    const decimal beta = mIsSplitImpulseActive ? BETA_SPLIT_IMPULSE : BETA;
+
+    // For each contact point of the manifold
+    const uint contactPointsIndex = manifold.externalContactManifold->contactPointsIndex;
+    for (int8 i=0; i < manifold.nbContacts; i++) {
+
+        const ContactPointSolver& contactPoint = mContactPoints[contactPointsIndex + i];
+        ContactPointsLanes& contactPointsLanes = block.contactPoints[i];
+
+        // The bias of the penetration does not change during the iterations and is computed here
+        decimal biasPenetrationDepth = 0.0;
+        if (contactPoint.penetrationDepth > SLOP) biasPenetrationDepth = -(beta/mTimeStep) *
+                max(0.0f, float(contactPoint.penetrationDepth - SLOP));
+
+        contactPointsLanes.normal.setLane(lane, contactPoint.normal);
+        contactPointsLanes.r1.setLane(lane, contactPoint.r1);
+        contactPointsLanes.r2.setLane(lane, contactPoint.r2);
+        contactPointsLanes.penetrationBias[lane] = biasPenetrationDepth;
+        contactPointsLanes.restitutionBias[lane] = contactPoint.restitutionBias;
+        contactPointsLanes.inversePenetrationMass[lane] = contactPoint.inversePenetrationMass;
+        contactPointsLanes.i1TimesR1CrossN.setLane(lane, contactPoint.i1TimesR1CrossN);
+        contactPointsLanes.i2TimesR2CrossN.setLane(lane, contactPoint.i2TimesR2CrossN);
+        contactPointsLanes.penetrationImpulse[lane] = contactPoint.penetrationImpulse;
+        contactPointsLanes.penetrationSplitImpulse[lane] = contactPoint.penetrationSplitImpulse;
+    }
+}
+
+// Copy the accumulated impulses of the manifolds of blocks back into the contact manifolds solver data
+void ContactSolverSystem::unpackBlocks(const ContactManifoldsBlockSolver* blocks, uint32 nbBlocks) {
+
+    for (uint32 b=0; b < nbBlocks; b++) {
+
+        const ContactManifoldsBlockSolver& block = blocks[b];
+
+        for (uint32 lane=0; lane < SIMD_DECIMAL_NB_LANES; lane++) {
+
+            const uint32 m = block.contactManifoldsIndices[lane];
+            if (m == INVALID_MANIFOLD_INDEX) continue;
+
+            mContactConstraints[m].friction1Impulse = block.friction1Impulse[lane];
+            mContactConstraints[m].friction2Impulse = block.friction2Impulse[lane];
+            mContactConstraints[m].frictionTwistImpulse = block.frictionTwistImpulse[lane];
+            mContactConstraints[m].rollingResistanceImpulse = block.rollingResistanceImpulse.getLane(lane);
+
+            const uint contactPointsIndex = mContactConstraints[m].externalContactManifold->contactPointsIndex;
+            for (int8 i=0; i < mContactConstraints[m].nbContacts; i++) {
+                mContactPoints[contactPointsIndex + i].penetrationImpulse = block.contactPoints[i].penetrationImpulse[lane];
+                mContactPoints[contactPointsIndex + i].penetrationSplitImpulse = block.contactPoints[i].penetrationSplitImpulse[lane];
+            }
+        }
+    }
 }
 
 // Initialize the constraint solver for a given island
+/// The solver data of a contact manifold (and of its contact points) is stored at the same index as
+/// the manifold (and the points) in the arrays of the narrow-phase
 void ContactSolverSystem::initializeForIsland(uint islandIndex) {
 
-    RP3D_PROFILE("ContactSolver::initializeForIsland()", mProfiler);
-
     assert(mIslands.bodyEntities[islandIndex].size() > 0);
     assert(mIslands.nbContactManifolds[islandIndex] > 0);
 
@@ -144,20 +428,22 @@ void ContactSolverSystem::initializeForIsland(uint islandIndex) {
         const Vector3& x2 = mRigidBodyComponents.mCentersOfMassWorld[rigidBodyIndex2];
 
         // Initialize the internal contact manifold structure using the external contact manifold
-        new (mContactConstraints + mNbContactManifolds) ContactManifoldSolver();
-        mContactConstraints[mNbContactManifolds].rigidBodyComponentIndexBody1 = rigidBodyIndex1;
-        mContactConstraints[mNbContactManifolds].rigidBodyComponentIndexBody2 = rigidBodyIndex2;
-        mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody1 = RigidBody::getWorldInertiaTensorInverse(mWorld, externalManifold.bodyEntity1);
-        mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody2 = RigidBody::getWorldInertiaTensorInverse(mWorld, externalManifold.bodyEntity2);
-        mContactConstraints[mNbContactManifolds].massInverseBody1 = mRigidBodyComponents.mInverseMasses[rigidBodyIndex1];
-        mContactConstraints[mNbContactManifolds].massInverseBody2 = mRigidBodyComponents.mInverseMasses[rigidBodyIndex2];
-        mContactConstraints[mNbContactManifolds].nbContacts = externalManifold.nbContactPoints;
-        mContactConstraints[mNbContactManifolds].frictionCoefficient = computeMixedFrictionCoefficient(collider1, collider2);
-        mContactConstraints[mNbContactManifolds].rollingResistanceFactor = computeMixedRollingResistance(collider1, collider2);
-        mContactConstraints[mNbContactManifolds].externalContactManifold = &externalManifold;
-        mContactConstraints[mNbContactManifolds].normal.setToZero();
-        mContactConstraints[mNbContactManifolds].frictionPointBody1.setToZero();
-        mContactConstraints[mNbContactManifolds].frictionPointBody2.setToZero();
+        new (mContactConstraints + m) ContactManifoldSolver();
+        mContactConstraints[m].rigidBodyComponentIndexBody1 = rigidBodyIndex1;
+        mContactConstraints[m].rigidBodyComponentIndexBody2 = rigidBodyIndex2;
+        mContactConstraints[m].isBody1Updated = mRigidBodyComponents.mBodyTypes[rigidBodyIndex1] != BodyType::STATIC;
+        mContactConstraints[m].isBody2Updated = mRigidBodyComponents.mBodyTypes[rigidBodyIndex2] != BodyType::STATIC;
+        mContactConstraints[m].inverseInertiaTensorBody1 = RigidBody::getWorldInertiaTensorInverse(mWorld, externalManifold.bodyEntity1);
+        mContactConstraints[m].inverseInertiaTensorBody2 = RigidBody::getWorldInertiaTensorInverse(mWorld, externalManifold.bodyEntity2);
+        mContactConstraints[m].massInverseBody1 = mRigidBodyComponents.mInverseMasses[rigidBodyIndex1];
+        mContactConstraints[m].massInverseBody2 = mRigidBodyComponents.mInverseMasses[rigidBodyIndex2];
+        mContactConstraints[m].nbContacts = externalManifold.nbContactPoints;
+        mContactConstraints[m].frictionCoefficient = computeMixedFrictionCoefficient(collider1, collider2);
+        mContactConstraints[m].rollingResistanceFactor = computeMixedRollingResistance(collider1, collider2);
+        mContactConstraints[m].externalContactManifold = &externalManifold;
+        mContactConstraints[m].normal.setToZero();
+        mContactConstraints[m].frictionPointBody1.setToZero();
+        mContactConstraints[m].frictionPointBody2.setToZero();
 
         // Get the velocities of the bodies
         const Vector3& v1 = mRigidBodyComponents.mLinearVelocities[rigidBodyIndex1];
@@ -177,161 +463,157 @@ void ContactSolverSystem::initializeForIsland(uint islandIndex) {
             Vector3 p1 = mColliderComponents.getLocalToWorldTransform(externalManifold.colliderEntity1) * externalContact.getLocalPointOnShape1();
             Vector3 p2 = mColliderComponents.getLocalToWorldTransform(externalManifold.colliderEntity2) * externalContact.getLocalPointOnShape2();
 
-            new (mContactPoints + mNbContactPoints) ContactPointSolver();
-            mContactPoints[mNbContactPoints].externalContact = &externalContact;
-            mContactPoints[mNbContactPoints].normal = externalContact.getNormal();
-            mContactPoints[mNbContactPoints].r1.x = p1.x - x1.x;
-            mContactPoints[mNbContactPoints].r1.y = p1.y - x1.y;
-            mContactPoints[mNbContactPoints].r1.z = p1.z - x1.z;
-            mContactPoints[mNbContactPoints].r2.x = p2.x - x2.x;
-            mContactPoints[mNbContactPoints].r2.y = p2.y - x2.y;
-            mContactPoints[mNbContactPoints].r2.z = p2.z - x2.z;
-            mContactPoints[mNbContactPoints].penetrationDepth = externalContact.getPenetrationDepth();
-            mContactPoints[mNbContactPoints].isRestingContact = externalContact.getIsRestingContact();
+            new (mContactPoints + c) ContactPointSolver();
+            mContactPoints[c].externalContact = &externalContact;
+            mContactPoints[c].normal = externalContact.getNormal();
+            mContactPoints[c].r1.x = p1.x - x1.x;
+            mContactPoints[c].r1.y = p1.y - x1.y;
+            mContactPoints[c].r1.z = p1.z - x1.z;
+            mContactPoints[c].r2.x = p2.x - x2.x;
+            mContactPoints[c].r2.y = p2.y - x2.y;
+            mContactPoints[c].r2.z = p2.z - x2.z;
+            mContactPoints[c].penetrationDepth = externalContact.getPenetrationDepth();
+            mContactPoints[c].isRestingContact = externalContact.getIsRestingContact();
             externalContact.setIsRestingContact(true);
-            mContactPoints[mNbContactPoints].penetrationImpulse = externalContact.getPenetrationImpulse();
-            mContactPoints[mNbContactPoints].penetrationSplitImpulse = 0.0;
+            mContactPoints[c].penetrationImpulse = externalContact.getPenetrationImpulse();
+            mContactPoints[c].penetrationSplitImpulse = 0.0;
 
-            mContactConstraints[mNbContactManifolds].frictionPointBody1.x += p1.x;
-            mContactConstraints[mNbContactManifolds].frictionPointBody1.y += p1.y;
-            mContactConstraints[mNbContactManifolds].frictionPointBody1.z += p1.z;
-            mContactConstraints[mNbContactManifolds].frictionPointBody2.x += p2.x;
-            mContactConstraints[mNbContactManifolds].frictionPointBody2.y += p2.y;
-            mContactConstraints[mNbContactManifolds].frictionPointBody2.z += p2.z;
+            mContactConstraints[m].frictionPointBody1.x += p1.x;
+            mContactConstraints[m].frictionPointBody1.y += p1.y;
+            mContactConstraints[m].frictionPointBody1.z += p1.z;
+            mContactConstraints[m].frictionPointBody2.x += p2.x;
+            mContactConstraints[m].frictionPointBody2.y += p2.y;
+            mContactConstraints[m].frictionPointBody2.z += p2.z;
 
             // Compute the velocity difference
-            //deltaV = v2 + w2.cross(mContactPoints[mNbContactPoints].r2) - v1 - w1.cross(mContactPoints[mNbContactPoints].r1);
-            Vector3 deltaV(v2.x + w2.y * mContactPoints[mNbContactPoints].r2.z - w2.z * mContactPoints[mNbContactPoints].r2.y
-                           - v1.x - w1.y * mContactPoints[mNbContactPoints].r1.z - w1.z * mContactPoints[mNbContactPoints].r1.y,
-                           v2.y + w2.z * mContactPoints[mNbContactPoints].r2.x - w2.x * mContactPoints[mNbContactPoints].r2.z
-                           - v1.y - w1.z * mContactPoints[mNbContactPoints].r1.x - w1.x * mContactPoints[mNbContactPoints].r1.z,
-                           v2.z + w2.x * mContactPoints[mNbContactPoints].r2.y - w2.y * mContactPoints[mNbContactPoints].r2.x
-                           - v1.z - w1.x * mContactPoints[mNbContactPoints].r1.y - w1.y * mContactPoints[mNbContactPoints].r1.x);
-
-            // r1CrossN = mContactPoints[mNbContactPoints].r1.cross(mContactPoints[mNbContactPoints].normal);
-            Vector3 r1CrossN(mContactPoints[mNbContactPoints].r1.y * mContactPoints[mNbContactPoints].normal.z -
-                             mContactPoints[mNbContactPoints].r1.z * mContactPoints[mNbContactPoints].normal.y,
-                             mContactPoints[mNbContactPoints].r1.z * mContactPoints[mNbContactPoints].normal.x -
-                             mContactPoints[mNbContactPoints].r1.x * mContactPoints[mNbContactPoints].normal.z,
-                             mContactPoints[mNbContactPoints].r1.x * mContactPoints[mNbContactPoints].normal.y -
-                             mContactPoints[mNbContactPoints].r1.y * mContactPoints[mNbContactPoints].normal.x);
-            // r2CrossN = mContactPoints[mNbContactPoints].r2.cross(mContactPoints[mNbContactPoints].normal);
-            Vector3 r2CrossN(mContactPoints[mNbContactPoints].r2.y * mContactPoints[mNbContactPoints].normal.z -
-                             mContactPoints[mNbContactPoints].r2.z * mContactPoints[mNbContactPoints].normal.y,
-                             mContactPoints[mNbContactPoints].r2.z * mContactPoints[mNbContactPoints].normal.x -
-                             mContactPoints[mNbContactPoints].r2.x * mContactPoints[mNbContactPoints].normal.z,
-                             mContactPoints[mNbContactPoints].r2.x * mContactPoints[mNbContactPoints].normal.y -
-                             mContactPoints[mNbContactPoints].r2.y * mContactPoints[mNbContactPoints].normal.x);
-
-            mContactPoints[mNbContactPoints].i1TimesR1CrossN = mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody1 * r1CrossN;
-            mContactPoints[mNbContactPoints].i2TimesR2CrossN = mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody2 * r2CrossN;
+            //deltaV = v2 + w2.cross(mContactPoints[c].r2) - v1 - w1.cross(mContactPoints[c].r1);
+            Vector3 deltaV(v2.x + w2.y * mContactPoints[c].r2.z - w2.z * mContactPoints[c].r2.y
+                           - v1.x - w1.y * mContactPoints[c].r1.z - w1.z * mContactPoints[c].r1.y,
+                           v2.y + w2.z * mContactPoints[c].r2.x - w2.x * mContactPoints[c].r2.z
+                           - v1.y - w1.z * mContactPoints[c].r1.x - w1.x * mContactPoints[c].r1.z,
+                           v2.z + w2.x * mContactPoints[c].r2.y - w2.y * mContactPoints[c].r2.x
+                           - v1.z - w1.x * mContactPoints[c].r1.y - w1.y * mContactPoints[c].r1.x);
+
+            // r1CrossN = mContactPoints[c].r1.cross(mContactPoints[c].normal);
+            Vector3 r1CrossN(mContactPoints[c].r1.y * mContactPoints[c].normal.z -
+                             mContactPoints[c].r1.z * mContactPoints[c].normal.y,
+                             mContactPoints[c].r1.z * mContactPoints[c].normal.x -
+                             mContactPoints[c].r1.x * mContactPoints[c].normal.z,
+                             mContactPoints[c].r1.x * mContactPoints[c].normal.y -
+                             mContactPoints[c].r1.y * mContactPoints[c].normal.x);
+            // r2CrossN = mContactPoints[c].r2.cross(mContactPoints[c].normal);
+            Vector3 r2CrossN(mContactPoints[c].r2.y * mContactPoints[c].normal.z -
+                             mContactPoints[c].r2.z * mContactPoints[c].normal.y,
+                             mContactPoints[c].r2.z * mContactPoints[c].normal.x -
+                             mContactPoints[c].r2.x * mContactPoints[c].normal.z,
+                             mContactPoints[c].r2.x * mContactPoints[c].normal.y -
+                             mContactPoints[c].r2.y * mContactPoints[c].normal.x);
+
+            mContactPoints[c].i1TimesR1CrossN = mContactConstraints[m].inverseInertiaTensorBody1 * r1CrossN;
+            mContactPoints[c].i2TimesR2CrossN = mContactConstraints[m].inverseInertiaTensorBody2 * r2CrossN;
 
             // Compute the inverse mass matrix K for the penetration constraint
-            decimal massPenetration = mContactConstraints[mNbContactManifolds].massInverseBody1 + mContactConstraints[mNbContactManifolds].massInverseBody2 +
-                    ((mContactPoints[mNbContactPoints].i1TimesR1CrossN).cross(mContactPoints[mNbContactPoints].r1)).dot(mContactPoints[mNbContactPoints].normal) +
-                    ((mContactPoints[mNbContactPoints].i2TimesR2CrossN).cross(mContactPoints[mNbContactPoints].r2)).dot(mContactPoints[mNbContactPoints].normal);
-            mContactPoints[mNbContactPoints].inversePenetrationMass = massPenetration > decimal(0.0) ? decimal(1.0) / massPenetration : decimal(0.0);
+            decimal massPenetration = mContactConstraints[m].massInverseBody1 + mContactConstraints[m].massInverseBody2 +
+                    ((mContactPoints[c].i1TimesR1CrossN).cross(mContactPoints[c].r1)).dot(mContactPoints[c].normal) +
+                    ((mContactPoints[c].i2TimesR2CrossN).cross(mContactPoints[c].r2)).dot(mContactPoints[c].normal);
+            mContactPoints[c].inversePenetrationMass = massPenetration > decimal(0.0) ? decimal(1.0) / massPenetration : decimal(0.0);
 
             // Compute the restitution velocity bias "b". We compute this here instead
             // of inside the solve() method because we need to use the velocity difference
             // at the beginning of the contact. Note that if it is a resting contact (normal
             // velocity bellow a given threshold), we do not add a restitution velocity bias
-            mContactPoints[mNbContactPoints].restitutionBias = 0.0;
-            // deltaVDotN = deltaV.dot(mContactPoints[mNbContactPoints].normal);
-            decimal deltaVDotN = deltaV.x * mContactPoints[mNbContactPoints].normal.x +
-                                 deltaV.y * mContactPoints[mNbContactPoints].normal.y +
-                                 deltaV.z * mContactPoints[mNbContactPoints].normal.z;
+            mContactPoints[c].restitutionBias = 0.0;
+            // deltaVDotN = deltaV.dot(mContactPoints[c].normal);
+            decimal deltaVDotN = deltaV.x * mContactPoints[c].normal.x +
+                                 deltaV.y * mContactPoints[c].normal.y +
+                                 deltaV.z * mContactPoints[c].normal.z;
             const decimal restitutionFactor = computeMixedRestitutionFactor(collider1, collider2);
             if (deltaVDotN < -mRestitutionVelocityThreshold) {
-                mContactPoints[mNbContactPoints].restitutionBias = restitutionFactor * deltaVDotN;
+                mContactPoints[c].restitutionBias = restitutionFactor * deltaVDotN;
             }
 
-            mContactConstraints[mNbContactManifolds].normal.x += mContactPoints[mNbContactPoints].normal.x;
-            mContactConstraints[mNbContactManifolds].normal.y += mContactPoints[mNbContactPoints].normal.y;
-            mContactConstraints[mNbContactManifolds].normal.z += mContactPoints[mNbContactPoints].normal.z;
-
-            mNbContactPoints++;
+            mContactConstraints[m].normal.x += mContactPoints[c].normal.x;
+            mContactConstraints[m].normal.y += mContactPoints[c].normal.y;
+            mContactConstraints[m].normal.z += mContactPoints[c].normal.z;
         }
 
-        mContactConstraints[mNbContactManifolds].frictionPointBody1 /=static_cast<decimal>(mContactConstraints[mNbContactManifolds].nbContacts);
-        mContactConstraints[mNbContactManifolds].frictionPointBody2 /=static_cast<decimal>(mContactConstraints[mNbContactManifolds].nbContacts);
-        mContactConstraints[mNbContactManifolds].r1Friction.x = mContactConstraints[mNbContactManifolds].frictionPointBody1.x - x1.x;
-        mContactConstraints[mNbContactManifolds].r1Friction.y = mContactConstraints[mNbContactManifolds].frictionPointBody1.y - x1.y;
-        mContactConstraints[mNbContactManifolds].r1Friction.z = mContactConstraints[mNbContactManifolds].frictionPointBody1.z - x1.z;
-        mContactConstraints[mNbContactManifolds].r2Friction.x = mContactConstraints[mNbContactManifolds].frictionPointBody2.x - x2.x;
-        mContactConstraints[mNbContactManifolds].r2Friction.y = mContactConstraints[mNbContactManifolds].frictionPointBody2.y - x2.y;
-        mContactConstraints[mNbContactManifolds].r2Friction.z = mContactConstraints[mNbContactManifolds].frictionPointBody2.z - x2.z;
-        mContactConstraints[mNbContactManifolds].oldFrictionVector1 = externalManifold.frictionVector1;
-        mContactConstraints[mNbContactManifolds].oldFrictionVector2 = externalManifold.frictionVector2;
+        mContactConstraints[m].frictionPointBody1 /=static_cast<decimal>(mContactConstraints[m].nbContacts);
+        mContactConstraints[m].frictionPointBody2 /=static_cast<decimal>(mContactConstraints[m].nbContacts);
+        mContactConstraints[m].r1Friction.x = mContactConstraints[m].frictionPointBody1.x - x1.x;
+        mContactConstraints[m].r1Friction.y = mContactConstraints[m].frictionPointBody1.y - x1.y;
+        mContactConstraints[m].r1Friction.z = mContactConstraints[m].frictionPointBody1.z - x1.z;
+        mContactConstraints[m].r2Friction.x = mContactConstraints[m].frictionPointBody2.x - x2.x;
+        mContactConstraints[m].r2Friction.y = mContactConstraints[m].frictionPointBody2.y - x2.y;
+        mContactConstraints[m].r2Friction.z = mContactConstraints[m].frictionPointBody2.z - x2.z;
+        mContactConstraints[m].oldFrictionVector1 = externalManifold.frictionVector1;
+        mContactConstraints[m].oldFrictionVector2 = externalManifold.frictionVector2;
 
         // Initialize the accumulated impulses with the previous step accumulated impulses
-        mContactConstraints[mNbContactManifolds].friction1Impulse = externalManifold.frictionImpulse1;
-        mContactConstraints[mNbContactManifolds].friction2Impulse = externalManifold.frictionImpulse2;
-        mContactConstraints[mNbContactManifolds].frictionTwistImpulse = externalManifold.frictionTwistImpulse;
+        mContactConstraints[m].friction1Impulse = externalManifold.frictionImpulse1;
+        mContactConstraints[m].friction2Impulse = externalManifold.frictionImpulse2;
+        mContactConstraints[m].frictionTwistImpulse = externalManifold.frictionTwistImpulse;
 
         // Compute the inverse K matrix for the rolling resistance constraint
         bool isBody1DynamicType = body1->getType() == BodyType::DYNAMIC;
         bool isBody2DynamicType = body2->getType() == BodyType::DYNAMIC;
-        mContactConstraints[mNbContactManifolds].inverseRollingResistance.setToZero();
-        if (mContactConstraints[mNbContactManifolds].rollingResistanceFactor > 0 && (isBody1DynamicType || isBody2DynamicType)) {
+        mContactConstraints[m].inverseRollingResistance.setToZero();
+        if (mContactConstraints[m].rollingResistanceFactor > 0 && (isBody1DynamicType || isBody2DynamicType)) {
 
-            mContactConstraints[mNbContactManifolds].inverseRollingResistance = mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody1 + mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody2;
-            decimal det = mContactConstraints[mNbContactManifolds].inverseRollingResistance.getDeterminant();
+            mContactConstraints[m].inverseRollingResistance = mContactConstraints[m].inverseInertiaTensorBody1 + mContactConstraints[m].inverseInertiaTensorBody2;
+            decimal det = mContactConstraints[m].inverseRollingResistance.getDeterminant();
 
             // If the matrix is not inversible
             if (approxEqual(det, decimal(0.0))) {
-               mContactConstraints[mNbContactManifolds].inverseRollingResistance.setToZero();
+               mContactConstraints[m].inverseRollingResistance.setToZero();
             }
             else {
-               mContactConstraints[mNbContactManifolds].inverseRollingResistance = mContactConstraints[mNbContactManifolds].inverseRollingResistance.getInverse();
+               mContactConstraints[m].inverseRollingResistance = mContactConstraints[m].inverseRollingResistance.getInverse();
             }
         }
 
-        mContactConstraints[mNbContactManifolds].normal.normalize();
-
-        // deltaVFrictionPoint = v2 + w2.cross(mContactConstraints[mNbContactManifolds].r2Friction) -
-        //                              v1 - w1.cross(mContactConstraints[mNbContactManifolds].r1Friction);
-        Vector3 deltaVFrictionPoint(v2.x + w2.y * mContactConstraints[mNbContactManifolds].r2Friction.z -
-                                    w2.z * mContactConstraints[mNbContactManifolds].r2Friction.y -
-                                      v1.x - w1.y * mContactConstraints[mNbContactManifolds].r1Friction.z -
-                                      w1.z * mContactConstraints[mNbContactManifolds].r1Friction.y,
-                                   v2.y + w2.z * mContactConstraints[mNbContactManifolds].r2Friction.x -
-                                    w2.x * mContactConstraints[mNbContactManifolds].r2Friction.z -
-                                      v1.y - w1.z * mContactConstraints[mNbContactManifolds].r1Friction.x -
-                                      w1.x * mContactConstraints[mNbContactManifolds].r1Friction.z,
-                                   v2.z + w2.x * mContactConstraints[mNbContactManifolds].r2Friction.y -
-                                    w2.y * mContactConstraints[mNbContactManifolds].r2Friction.x -
-                                      v1.z - w1.x * mContactConstraints[mNbContactManifolds].r1Friction.y -
-                                      w1.y * mContactConstraints[mNbContactManifolds].r1Friction.x);
+        mContactConstraints[m].normal.normalize();
+
+        // deltaVFrictionPoint = v2 + w2.cross(mContactConstraints[m].r2Friction) -
+        //                              v1 - w1.cross(mContactConstraints[m].r1Friction);
+        Vector3 deltaVFrictionPoint(v2.x + w2.y * mContactConstraints[m].r2Friction.z -
+                                    w2.z * mContactConstraints[m].r2Friction.y -
+                                      v1.x - w1.y * mContactConstraints[m].r1Friction.z -
+                                      w1.z * mContactConstraints[m].r1Friction.y,
+                                   v2.y + w2.z * mContactConstraints[m].r2Friction.x -
+                                    w2.x * mContactConstraints[m].r2Friction.z -
+                                      v1.y - w1.z * mContactConstraints[m].r1Friction.x -
+                                      w1.x * mContactConstraints[m].r1Friction.z,
+                                   v2.z + w2.x * mContactConstraints[m].r2Friction.y -
+                                    w2.y * mContactConstraints[m].r2Friction.x -
+                                      v1.z - w1.x * mContactConstraints[m].r1Friction.y -
+                                      w1.y * mContactConstraints[m].r1Friction.x);
 
         // Compute the friction vectors
-        computeFrictionVectors(deltaVFrictionPoint, mContactConstraints[mNbContactManifolds]);
+        computeFrictionVectors(deltaVFrictionPoint, mContactConstraints[m]);
 
         // Compute the inverse mass matrix K for the friction constraints at the center of
         // the contact manifold
-        mContactConstraints[mNbContactManifolds].r1CrossT1 = mContactConstraints[mNbContactManifolds].r1Friction.cross(mContactConstraints[mNbContactManifolds].frictionVector1);
-        mContactConstraints[mNbContactManifolds].r1CrossT2 = mContactConstraints[mNbContactManifolds].r1Friction.cross(mContactConstraints[mNbContactManifolds].frictionVector2);
-        mContactConstraints[mNbContactManifolds].r2CrossT1 = mContactConstraints[mNbContactManifolds].r2Friction.cross(mContactConstraints[mNbContactManifolds].frictionVector1);
-        mContactConstraints[mNbContactManifolds].r2CrossT2 = mContactConstraints[mNbContactManifolds].r2Friction.cross(mContactConstraints[mNbContactManifolds].frictionVector2);
-        decimal friction1Mass = mContactConstraints[mNbContactManifolds].massInverseBody1 + mContactConstraints[mNbContactManifolds].massInverseBody2 +
-                                ((mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody1 * mContactConstraints[mNbContactManifolds].r1CrossT1).cross(mContactConstraints[mNbContactManifolds].r1Friction)).dot(
-                                mContactConstraints[mNbContactManifolds].frictionVector1) +
-                                ((mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody2 * mContactConstraints[mNbContactManifolds].r2CrossT1).cross(mContactConstraints[mNbContactManifolds].r2Friction)).dot(
-                                mContactConstraints[mNbContactManifolds].frictionVector1);
-        decimal friction2Mass = mContactConstraints[mNbContactManifolds].massInverseBody1 + mContactConstraints[mNbContactManifolds].massInverseBody2 +
-                                ((mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody1 * mContactConstraints[mNbContactManifolds].r1CrossT2).cross(mContactConstraints[mNbContactManifolds].r1Friction)).dot(
-                                mContactConstraints[mNbContactManifolds].frictionVector2) +
-                                ((mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody2 * mContactConstraints[mNbContactManifolds].r2CrossT2).cross(mContactConstraints[mNbContactManifolds].r2Friction)).dot(
-                                mContactConstraints[mNbContactManifolds].frictionVector2);
-        decimal frictionTwistMass = mContactConstraints[mNbContactManifolds].normal.dot(mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody1 *
-                                       mContactConstraints[mNbContactManifolds].normal) +
-                                    mContactConstraints[mNbContactManifolds].normal.dot(mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody2 *
-                                       mContactConstraints[mNbContactManifolds].normal);
-        mContactConstraints[mNbContactManifolds].inverseFriction1Mass = friction1Mass > decimal(0.0) ? decimal(1.0) / friction1Mass : decimal(0.0);
-        mContactConstraints[mNbContactManifolds].inverseFriction2Mass = friction2Mass > decimal(0.0) ? decimal(1.0) / friction2Mass : decimal(0.0);
-        mContactConstraints[mNbContactManifolds].inverseTwistFrictionMass = frictionTwistMass > decimal(0.0) ? decimal(1.0) / frictionTwistMass : decimal(0.0);
-
-        mNbContactManifolds++;
+        mContactConstraints[m].r1CrossT1 = mContactConstraints[m].r1Friction.cross(mContactConstraints[m].frictionVector1);
+        mContactConstraints[m].r1CrossT2 = mContactConstraints[m].r1Friction.cross(mContactConstraints[m].frictionVector2);
+        mContactConstraints[m].r2CrossT1 = mContactConstraints[m].r2Friction.cross(mContactConstraints[m].frictionVector1);
+        mContactConstraints[m].r2CrossT2 = mContactConstraints[m].r2Friction.cross(mContactConstraints[m].frictionVector2);
+        decimal friction1Mass = mContactConstraints[m].massInverseBody1 + mContactConstraints[m].massInverseBody2 +
+                                ((mContactConstraints[m].inverseInertiaTensorBody1 * mContactConstraints[m].r1CrossT1).cross(mContactConstraints[m].r1Friction)).dot(
+                                mContactConstraints[m].frictionVector1) +
+                                ((mContactConstraints[m].inverseInertiaTensorBody2 * mContactConstraints[m].r2CrossT1).cross(mContactConstraints[m].r2Friction)).dot(
+                                mContactConstraints[m].frictionVector1);
+        decimal friction2Mass = mContactConstraints[m].massInverseBody1 + mContactConstraints[m].massInverseBody2 +
+                                ((mContactConstraints[m].inverseInertiaTensorBody1 * mContactConstraints[m].r1CrossT2).cross(mContactConstraints[m].r1Friction)).dot(
+                                mContactConstraints[m].frictionVector2) +
+                                ((mContactConstraints[m].inverseInertiaTensorBody2 * mContactConstraints[m].r2CrossT2).cross(mContactConstraints[m].r2Friction)).dot(
+                                mContactConstraints[m].frictionVector2);
+        decimal frictionTwistMass = mContactConstraints[m].normal.dot(mContactConstraints[m].inverseInertiaTensorBody1 *
+                                       mContactConstraints[m].normal) +
+                                    mContactConstraints[m].normal.dot(mContactConstraints[m].inverseInertiaTensorBody2 *
+                                       mContactConstraints[m].normal);
+        mContactConstraints[m].inverseFriction1Mass = friction1Mass > decimal(0.0) ? decimal(1.0) / friction1Mass : decimal(0.0);
+        mContactConstraints[m].inverseFriction2Mass = friction2Mass > decimal(0.0) ? decimal(1.0) / friction2Mass : decimal(0.0);
+        mContactConstraints[m].inverseTwistFrictionMass = frictionTwistMass > decimal(0.0) ? decimal(1.0) / frictionTwistMass : decimal(0.0);
     }
 }
 
@@ -339,14 +621,22 @@ void ContactSolverSystem::initializeForIsland(uint islandIndex) {
 /// For each constraint, we apply the previous impulse (from the previous step)
 /// at the beginning. With this technique, we will converge faster towards
 /// the solution of the linear system
-void ContactSolverSystem::warmStart() {
+void ContactSolverSystem::warmStart(uint32 islandIndex) {
 
-    RP3D_PROFILE("ContactSolver::warmStart()", mProfiler);
+    const uint32 contactManifoldsIndex = mIslands.contactManifoldsIndices[islandIndex];
+    const uint32 nbContactManifolds = mIslands.nbContactManifolds[islandIndex];
+    if (nbContactManifolds == 0) return;
 
-    uint contactPointIndex = 0;
+    uint contactPointIndex = mContactConstraints[contactManifoldsIndex].externalContactManifold->contactPointsIndex;
 
     // For each constraint
-    for (uint c=0; c<mNbContactManifolds; c++) {
+    for (uint c=contactManifoldsIndex; c < contactManifoldsIndex + nbContactManifolds; c++) {
+
+        // Get the constrained velocities
+        Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1];
+        Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1];
+        Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2];
+        Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2];
 
         bool atLeastOneRestingContactPoint = false;
 
@@ -364,22 +654,22 @@ void ContactSolverSystem::warmStart() {
                 Vector3 impulsePenetration(mContactPoints[contactPointIndex].normal.x * mContactPoints[contactPointIndex].penetrationImpulse,
                                            mContactPoints[contactPointIndex].normal.y * mContactPoints[contactPointIndex].penetrationImpulse,
                                            mContactPoints[contactPointIndex].normal.z * mContactPoints[contactPointIndex].penetrationImpulse);
-                mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].x -= mContactConstraints[c].massInverseBody1 * impulsePenetration.x;
-                mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].y -= mContactConstraints[c].massInverseBody1 * impulsePenetration.y;
-                mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].z -= mContactConstraints[c].massInverseBody1 * impulsePenetration.z;
+                v1.x -= mContactConstraints[c].massInverseBody1 * impulsePenetration.x;
+                v1.y -= mContactConstraints[c].massInverseBody1 * impulsePenetration.y;
+                v1.z -= mContactConstraints[c].massInverseBody1 * impulsePenetration.z;
 
-                mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * mContactPoints[contactPointIndex].penetrationImpulse;
-                mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * mContactPoints[contactPointIndex].penetrationImpulse;
-                mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * mContactPoints[contactPointIndex].penetrationImpulse;
+                w1.x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * mContactPoints[contactPointIndex].penetrationImpulse;
+                w1.y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * mContactPoints[contactPointIndex].penetrationImpulse;
+                w1.z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * mContactPoints[contactPointIndex].penetrationImpulse;
 
                 // Update the velocities of the body 2 by applying the impulse P
-                mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].x += mContactConstraints[c].massInverseBody2 * impulsePenetration.x;
-                mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].y += mContactConstraints[c].massInverseBody2 * impulsePenetration.y;
-                mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].z += mContactConstraints[c].massInverseBody2 * impulsePenetration.z;
+                v2.x += mContactConstraints[c].massInverseBody2 * impulsePenetration.x;
+                v2.y += mContactConstraints[c].massInverseBody2 * impulsePenetration.y;
+                v2.z += mContactConstraints[c].massInverseBody2 * impulsePenetration.z;
 
-                mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * mContactPoints[contactPointIndex].penetrationImpulse;
-                mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * mContactPoints[contactPointIndex].penetrationImpulse;
-                mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * mContactPoints[contactPointIndex].penetrationImpulse;
+                w2.x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * mContactPoints[contactPointIndex].penetrationImpulse;
+                w2.y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * mContactPoints[contactPointIndex].penetrationImpulse;
+                w2.z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * mContactPoints[contactPointIndex].penetrationImpulse;
             }
             else {  // If it is a new contact point
 
@@ -419,12 +709,12 @@ void ContactSolverSystem::warmStart() {
                                         mContactConstraints[c].r2CrossT1.z * mContactConstraints[c].friction1Impulse);
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1] -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2;
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1] += mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1;
+            v1 -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2;
+            w1 += mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1;
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2] += mContactConstraints[c].massInverseBody2 * linearImpulseBody2;
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2] += mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2;
+            v2 += mContactConstraints[c].massInverseBody2 * linearImpulseBody2;
+            w2 += mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2;
 
             // ------ Second friction constraint at the center of the contact manifold ----- //
 
@@ -440,18 +730,18 @@ void ContactSolverSystem::warmStart() {
             angularImpulseBody2.z = mContactConstraints[c].r2CrossT2.z * mContactConstraints[c].friction2Impulse;
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x;
-            mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y;
-            mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z;
+            v1.x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x;
+            v1.y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y;
+            v1.z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z;
 
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1] += mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1;
+            w1 += mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1;
 
             // Update the velocities of the body 2 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x;
-            mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y;
-            mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z;
+            v2.x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x;
+            v2.y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y;
+            v2.z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z;
 
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2] += mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2;
+            w2 += mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2;
 
             // ------ Twist friction constraint at the center of the contact manifold ------ //
 
@@ -465,10 +755,10 @@ void ContactSolverSystem::warmStart() {
             angularImpulseBody2.z = mContactConstraints[c].normal.z * mContactConstraints[c].frictionTwistImpulse;
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1] += mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1;
+            w1 += mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1;
 
             // Update the velocities of the body 2 by applying the impulse P
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2] += mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2;
+            w2 += mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2;
 
             // ------ Rolling resistance at the center of the contact manifold ------ //
 
@@ -476,10 +766,10 @@ void ContactSolverSystem::warmStart() {
             angularImpulseBody2 = mContactConstraints[c].rollingResistanceImpulse;
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1] -= mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody2;
+            w1 -= mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody2;
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2] += mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2;
+            w2 += mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2;
         }
         else {  // If it is a new contact manifold
 
@@ -489,287 +779,710 @@ void ContactSolverSystem::warmStart() {
             mContactConstraints[c].frictionTwistImpulse = 0.0;
             mContactConstraints[c].rollingResistanceImpulse.setToZero();
         }
+
+        storeConstrainedVelocities(c, v1, w1, v2, w2);
     }
 }
 
-// Solve the contacts
-void ContactSolverSystem::solve() {
+// Solve the contacts of an island
+/// The islands do not share any dynamic body so this method can be called concurrently for different
+/// islands. A static body can be part of several islands but the solver never writes its velocities
+/// (see storeConstrainedVelocities()).
+void ContactSolverSystem::solve(uint32 islandIndex) {
 
-    RP3D_PROFILE("ContactSolverSystem::solve()", mProfiler);
+    // If the contacts are solved by blocks of manifolds
+    if (mIsWideSolverActive) {
 
-    decimal deltaLambda;
-    decimal lambdaTemp;
-    uint contactPointIndex = 0;
+        if (mIslandsBlocksStartIndices == nullptr) return;
 
-    const decimal beta = mIsSplitImpulseActive ? BETA_SPLIT_IMPULSE : BETA;
+        for (uint32 b=mIslandsBlocksStartIndices[islandIndex]; b < mIslandsBlocksStartIndices[islandIndex + 1]; b++) {
+            solveBlock(mContactBlocks[b]);
+        }
 
-    // For each contact manifold
-    for (uint c=0; c<mNbContactManifolds; c++) {
+        return;
+    }
 
-        decimal sumPenetrationImpulse = 0.0;
+    const uint32 contactManifoldsIndex = mIslands.contactManifoldsIndices[islandIndex];
+    const uint32 nbContactManifolds = mIslands.nbContactManifolds[islandIndex];
 
-        // Get the constrained velocities
-        const Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1];
-        const Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1];
-        const Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2];
-        const Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2];
+    // For each contact manifold
+    for (uint32 c=contactManifoldsIndex; c < contactManifoldsIndex + nbContactManifolds; c++) {
+        solveContactManifold(c);
+    }
+}
 
-        for (short int i=0; i<mContactConstraints[c].nbContacts; i++) {
+// Compute the graph coloring of the contact manifolds of an island
+/// The static bodies are ignored by the coloring because the solver never writes their velocities
+/// (see storeConstrainedVelocities()). Two manifolds of a color can therefore share a static body.
+void ContactSolverSystem::computeIslandColoring(uint32 islandIndex) {
 
-            // --------- Penetration --------- //
-
-            // Compute J*v
-            //Vector3 deltaV = v2 + w2.cross(mContactPoints[contactPointIndex].r2) - v1 - w1.cross(mContactPoints[contactPointIndex].r1);
-            Vector3 deltaV(v2.x + w2.y * mContactPoints[contactPointIndex].r2.z - w2.z * mContactPoints[contactPointIndex].r2.y - v1.x -
-                           w1.y * mContactPoints[contactPointIndex].r1.z + w1.z * mContactPoints[contactPointIndex].r1.y,
-                           v2.y + w2.z * mContactPoints[contactPointIndex].r2.x - w2.x * mContactPoints[contactPointIndex].r2.z - v1.y -
-                           w1.z * mContactPoints[contactPointIndex].r1.x + w1.x * mContactPoints[contactPointIndex].r1.z,
-                           v2.z + w2.x * mContactPoints[contactPointIndex].r2.y - w2.y * mContactPoints[contactPointIndex].r2.x - v1.z -
-                           w1.x * mContactPoints[contactPointIndex].r1.y + w1.y * mContactPoints[contactPointIndex].r1.x);
-            decimal deltaVDotN = deltaV.x * mContactPoints[contactPointIndex].normal.x + deltaV.y * mContactPoints[contactPointIndex].normal.y +
-                                 deltaV.z * mContactPoints[contactPointIndex].normal.z;
-            decimal Jv = deltaVDotN;
-
-            // Compute the bias "b" of the constraint
-            decimal biasPenetrationDepth = 0.0;
-            if (mContactPoints[contactPointIndex].penetrationDepth > SLOP) biasPenetrationDepth = -(beta/mTimeStep) *
-                    max(0.0f, float(mContactPoints[contactPointIndex].penetrationDepth - SLOP));
-            decimal b = biasPenetrationDepth + mContactPoints[contactPointIndex].restitutionBias;
-
-            // Compute the Lagrange multiplier lambda
-            if (mIsSplitImpulseActive) {
-                deltaLambda = - (Jv + mContactPoints[contactPointIndex].restitutionBias) *
-                        mContactPoints[contactPointIndex].inversePenetrationMass;
-            }
-            else {
-                deltaLambda = - (Jv + b) * mContactPoints[contactPointIndex].inversePenetrationMass;
-            }
-            lambdaTemp = mContactPoints[contactPointIndex].penetrationImpulse;
-            mContactPoints[contactPointIndex].penetrationImpulse = std::max(mContactPoints[contactPointIndex].penetrationImpulse +
-                                                       deltaLambda, decimal(0.0));
-            deltaLambda = mContactPoints[contactPointIndex].penetrationImpulse - lambdaTemp;
+    RP3D_PROFILE("ContactSolverSystem::computeIslandColoring()", mProfiler);
 
-            Vector3 linearImpulse(mContactPoints[contactPointIndex].normal.x * deltaLambda,
-                                  mContactPoints[contactPointIndex].normal.y * deltaLambda,
-                                  mContactPoints[contactPointIndex].normal.z * deltaLambda);
+    mColoredIslandIndex = islandIndex;
 
-            // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].x -= mContactConstraints[c].massInverseBody1 * linearImpulse.x;
-            mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].y -= mContactConstraints[c].massInverseBody1 * linearImpulse.y;
-            mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].z -= mContactConstraints[c].massInverseBody1 * linearImpulse.z;
+    const uint32 contactManifoldsIndex = mIslands.contactManifoldsIndices[islandIndex];
+    const uint32 nbContactManifolds = mIslands.nbContactManifolds[islandIndex];
 
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * deltaLambda;
+    List<uint32> bodies1(mMemoryManager.getSingleFrameAllocator(), nbContactManifolds);
+    List<uint32> bodies2(mMemoryManager.getSingleFrameAllocator(), nbContactManifolds);
+    uint32 nbBodies = 0;
+    for (uint32 c=contactManifoldsIndex; c < contactManifoldsIndex + nbContactManifolds; c++) {
 
-            // Update the velocities of the body 2 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].x += mContactConstraints[c].massInverseBody2 * linearImpulse.x;
-            mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].y += mContactConstraints[c].massInverseBody2 * linearImpulse.y;
-            mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].z += mContactConstraints[c].massInverseBody2 * linearImpulse.z;
+        // Only the bodies whose velocities are written by the solver can conflict
+        const uint32 body1 = mContactConstraints[c].rigidBodyComponentIndexBody1;
+        const uint32 body2 = mContactConstraints[c].rigidBodyComponentIndexBody2;
+        bodies1.add(mContactConstraints[c].isBody1Updated ? body1 : ConstraintGraphColoring::IGNORED_BODY);
+        bodies2.add(mContactConstraints[c].isBody2Updated ? body2 : ConstraintGraphColoring::IGNORED_BODY);
+        nbBodies = std::max(nbBodies, std::max(body1, body2) + 1);
+    }
 
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * deltaLambda;
+    // Only the bodies up to the largest index of the island are colored (and not all the bodies of the world)
+    mColoring.computeColors(bodies1, bodies2, nbBodies);
 
-            sumPenetrationImpulse += mContactPoints[contactPointIndex].penetrationImpulse;
+    if (!mIsWideSolverActive) return;
 
-            // If the split impulse position correction is active
-            if (mIsSplitImpulseActive) {
+    // Release the blocks of the previous colored island
+    if (mColoredIslandBlocks != nullptr) {
+        mMemoryManager.release(MemoryManager::AllocationType::Frame, mColoredIslandBlocks,
+                               sizeof(ContactManifoldsBlockSolver) * mColorsBlocksStartIndices[mColorsBlocksStartIndices.size() - 1]);
+        mColoredIslandBlocks = nullptr;
+    }
 
-                // Split impulse (position correction)
-                const Vector3& v1Split = mRigidBodyComponents.mSplitLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1];
-                const Vector3& w1Split = mRigidBodyComponents.mSplitAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1];
-                const Vector3& v2Split = mRigidBodyComponents.mSplitLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2];
-                const Vector3& w2Split = mRigidBodyComponents.mSplitAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2];
-
-                //Vector3 deltaVSplit = v2Split + w2Split.cross(mContactPoints[contactPointIndex].r2) - v1Split - w1Split.cross(mContactPoints[contactPointIndex].r1);
-                Vector3 deltaVSplit(v2Split.x + w2Split.y * mContactPoints[contactPointIndex].r2.z - w2Split.z * mContactPoints[contactPointIndex].r2.y - v1Split.x -
-                                    w1Split.y * mContactPoints[contactPointIndex].r1.z + w1Split.z * mContactPoints[contactPointIndex].r1.y,
-                                    v2Split.y + w2Split.z * mContactPoints[contactPointIndex].r2.x - w2Split.x * mContactPoints[contactPointIndex].r2.z - v1Split.y -
-                                    w1Split.z * mContactPoints[contactPointIndex].r1.x + w1Split.x * mContactPoints[contactPointIndex].r1.z,
-                                    v2Split.z + w2Split.x * mContactPoints[contactPointIndex].r2.y - w2Split.y * mContactPoints[contactPointIndex].r2.x - v1Split.z -
-                                    w1Split.x * mContactPoints[contactPointIndex].r1.y + w1Split.y * mContactPoints[contactPointIndex].r1.x);
-                decimal JvSplit = deltaVSplit.x * mContactPoints[contactPointIndex].normal.x +
-                                  deltaVSplit.y * mContactPoints[contactPointIndex].normal.y +
-                                  deltaVSplit.z * mContactPoints[contactPointIndex].normal.z;
-                decimal deltaLambdaSplit = - (JvSplit + biasPenetrationDepth) *
-                        mContactPoints[contactPointIndex].inversePenetrationMass;
-                decimal lambdaTempSplit = mContactPoints[contactPointIndex].penetrationSplitImpulse;
-                mContactPoints[contactPointIndex].penetrationSplitImpulse = std::max(
-                            mContactPoints[contactPointIndex].penetrationSplitImpulse +
-                            deltaLambdaSplit, decimal(0.0));
-                deltaLambdaSplit = mContactPoints[contactPointIndex].penetrationSplitImpulse - lambdaTempSplit;
-
-                Vector3 linearImpulse(mContactPoints[contactPointIndex].normal.x * deltaLambdaSplit,
-                                      mContactPoints[contactPointIndex].normal.y * deltaLambdaSplit,
-                                      mContactPoints[contactPointIndex].normal.z * deltaLambdaSplit);
+    // The manifolds of a color never share a dynamic body and can be packed into blocks in any order
+    mColorsBlocksStartIndices.clear();
+    mColorsBlocksStartIndices.add(0);
+    for (uint32 color=0; color < mColoring.getNbColors(); color++) {
+        const uint32 nbColorManifolds = mColoring.getColorStartIndex(color + 1) - mColoring.getColorStartIndex(color);
+        mColorsBlocksStartIndices.add(mColorsBlocksStartIndices[color] + (nbColorManifolds + SIMD_DECIMAL_NB_LANES - 1) / SIMD_DECIMAL_NB_LANES);
+    }
 
-                // Update the velocities of the body 1 by applying the impulse P
-                mRigidBodyComponents.mSplitLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].x -= mContactConstraints[c].massInverseBody1 * linearImpulse.x;
-                mRigidBodyComponents.mSplitLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].y -= mContactConstraints[c].massInverseBody1 * linearImpulse.y;
-                mRigidBodyComponents.mSplitLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].z -= mContactConstraints[c].massInverseBody1 * linearImpulse.z;
+    const uint32 nbBlocks = mColorsBlocksStartIndices[mColorsBlocksStartIndices.size() - 1];
+    if (nbBlocks == 0) return;
 
-                mRigidBodyComponents.mSplitAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * deltaLambdaSplit;
+    mColoredIslandBlocks = static_cast<ContactManifoldsBlockSolver*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
+                                                                                             sizeof(ContactManifoldsBlockSolver) * nbBlocks));
+    assert(mColoredIslandBlocks != nullptr);
 
-                // Update the velocities of the body 1 by applying the impulse P
-                mRigidBodyComponents.mSplitLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].x += mContactConstraints[c].massInverseBody2 * linearImpulse.x;
-                mRigidBodyComponents.mSplitLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].y += mContactConstraints[c].massInverseBody2 * linearImpulse.y;
-                mRigidBodyComponents.mSplitLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].z += mContactConstraints[c].massInverseBody2 * linearImpulse.z;
+    const List<uint32>& manifoldsIndices = mColoring.getConstraintsIndices();
+    for (uint32 color=0; color < mColoring.getNbColors(); color++) {
+
+        const uint32 colorStartIndex = mColoring.getColorStartIndex(color);
+        for (uint32 m=colorStartIndex; m < mColoring.getColorStartIndex(color + 1); m++) {
 
-                mRigidBodyComponents.mSplitAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * deltaLambdaSplit;
+            const uint32 colorLane = m - colorStartIndex;
+            ContactManifoldsBlockSolver& block = mColoredIslandBlocks[mColorsBlocksStartIndices[color] + colorLane / SIMD_DECIMAL_NB_LANES];
+            if (colorLane % SIMD_DECIMAL_NB_LANES == 0) {
+                initBlock(block);
             }
+            packContactManifold(block, colorLane % SIMD_DECIMAL_NB_LANES, contactManifoldsIndex + manifoldsIndices[m]);
+        }
+    }
+}
 
-            contactPointIndex++;
+// Solve the contacts of the island for which the graph coloring has been computed
+/// The contact manifolds of a color do not share any dynamic body and are solved in parallel.
+/// The colors are solved one after the other and the manifolds that could not be colored
+/// are solved sequentially at the end.
+void ContactSolverSystem::solveColoredIsland() {
+
+    const uint32 contactManifoldsIndex = mIslands.contactManifoldsIndices[mColoredIslandIndex];
+    const List<uint32>& manifoldsIndices = mColoring.getConstraintsIndices();
+
+    // For each color
+    for (uint32 color=0; color < mColoring.getNbColors(); color++) {
+
+        // If the manifolds of the color are solved by blocks
+        if (mIsWideSolverActive) {
+
+            if (mColoredIslandBlocks == nullptr) break;
+
+            const uint32 blocksGrainSize = std::max(PARALLEL_COLOR_GRAIN_SIZE / SIMD_DECIMAL_NB_LANES, uint32(1));
+            mTaskScheduler.parallelFor(mColorsBlocksStartIndices[color], mColorsBlocksStartIndices[color + 1], blocksGrainSize,
+                                       [&](uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
+
+                for (uint32 b=startIndex; b < endIndex; b++) {
+                    solveBlock(mColoredIslandBlocks[b]);
+                }
+            });
+
+            continue;
         }
 
-        // ------ First friction constraint at the center of the contact manifold ------ //
+        mTaskScheduler.parallelFor(mColoring.getColorStartIndex(color), mColoring.getColorStartIndex(color + 1), PARALLEL_COLOR_GRAIN_SIZE,
+                                   [&](uint32 startIndex, uint32 endIndex, uint32 /*threadIndex*/) {
 
-        // Compute J*v
-        // deltaV = v2 + w2.cross(mContactConstraints[c].r2Friction) - v1 - w1.cross(mContactConstraints[c].r1Friction);
-        Vector3 deltaV(v2.x + w2.y * mContactConstraints[c].r2Friction.z - w2.z * mContactConstraints[c].r2Friction.y - v1.x -
-                       w1.y * mContactConstraints[c].r1Friction.z + w1.z * mContactConstraints[c].r1Friction.y,
+            for (uint32 m=startIndex; m < endIndex; m++) {
+                solveContactManifold(contactManifoldsIndex + manifoldsIndices[m]);
+            }
+        });
+    }
+
+    // Solve the contact manifolds that could not be colored
+    for (uint32 m=mColoring.getOverflowStartIndex(); m < mColoring.getNbConstraints(); m++) {
+        solveContactManifold(contactManifoldsIndex + manifoldsIndices[m]);
+    }
+}
+
+// Solve the contacts of a contact manifold
+void ContactSolverSystem::solveContactManifold(uint32 c) {
+
+    decimal deltaLambda;
+    decimal lambdaTemp;
+    uint contactPointIndex = mContactConstraints[c].externalContactManifold->contactPointsIndex;
+
+    const decimal beta = mIsSplitImpulseActive ? BETA_SPLIT_IMPULSE : BETA;
+
+    decimal sumPenetrationImpulse = 0.0;
+
+    // Get the constrained velocities
+    Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1];
+    Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1];
+    Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2];
+    Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2];
+
+    // Get the split velocities
+    Vector3 v1Split, w1Split, v2Split, w2Split;
+    if (mIsSplitImpulseActive) {
+        v1Split = mRigidBodyComponents.mSplitLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1];
+        w1Split = mRigidBodyComponents.mSplitAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1];
+        v2Split = mRigidBodyComponents.mSplitLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2];
+        w2Split = mRigidBodyComponents.mSplitAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2];
+    }
 
-                       v2.y + w2.z * mContactConstraints[c].r2Friction.x - w2.x * mContactConstraints[c].r2Friction.z - v1.y -
-                       w1.z * mContactConstraints[c].r1Friction.x + w1.x * mContactConstraints[c].r1Friction.z,
+    for (short int i=0; i<mContactConstraints[c].nbContacts; i++) {
 
-                       v2.z + w2.x * mContactConstraints[c].r2Friction.y - w2.y * mContactConstraints[c].r2Friction.x - v1.z -
-                       w1.x * mContactConstraints[c].r1Friction.y + w1.y * mContactConstraints[c].r1Friction.x);
-        decimal Jv = deltaV.x * mContactConstraints[c].frictionVector1.x +
-                     deltaV.y * mContactConstraints[c].frictionVector1.y +
-                     deltaV.z * mContactConstraints[c].frictionVector1.z;
+        // --------- Penetration --------- //
+
+        // Compute J*v
+        //Vector3 deltaV = v2 + w2.cross(mContactPoints[contactPointIndex].r2) - v1 - w1.cross(mContactPoints[contactPointIndex].r1);
+        Vector3 deltaV(v2.x + w2.y * mContactPoints[contactPointIndex].r2.z - w2.z * mContactPoints[contactPointIndex].r2.y - v1.x -
+                       w1.y * mContactPoints[contactPointIndex].r1.z + w1.z * mContactPoints[contactPointIndex].r1.y,
+                       v2.y + w2.z * mContactPoints[contactPointIndex].r2.x - w2.x * mContactPoints[contactPointIndex].r2.z - v1.y -
+                       w1.z * mContactPoints[contactPointIndex].r1.x + w1.x * mContactPoints[contactPointIndex].r1.z,
+                       v2.z + w2.x * mContactPoints[contactPointIndex].r2.y - w2.y * mContactPoints[contactPointIndex].r2.x - v1.z -
+                       w1.x * mContactPoints[contactPointIndex].r1.y + w1.y * mContactPoints[contactPointIndex].r1.x);
+        decimal deltaVDotN = deltaV.x * mContactPoints[contactPointIndex].normal.x + deltaV.y * mContactPoints[contactPointIndex].normal.y +
+                             deltaV.z * mContactPoints[contactPointIndex].normal.z;
+        decimal Jv = deltaVDotN;
+
+        // Compute the bias "b" of the constraint
+        decimal biasPenetrationDepth = 0.0;
+        if (mContactPoints[contactPointIndex].penetrationDepth > SLOP) biasPenetrationDepth = -(beta/mTimeStep) *
+                max(0.0f, float(mContactPoints[contactPointIndex].penetrationDepth - SLOP));
+        decimal b = biasPenetrationDepth + mContactPoints[contactPointIndex].restitutionBias;
 
         // Compute the Lagrange multiplier lambda
-        decimal deltaLambda = -Jv * mContactConstraints[c].inverseFriction1Mass;
-        decimal frictionLimit = mContactConstraints[c].frictionCoefficient * sumPenetrationImpulse;
-        lambdaTemp = mContactConstraints[c].friction1Impulse;
-        mContactConstraints[c].friction1Impulse = std::max(-frictionLimit,
-                                                    std::min(mContactConstraints[c].friction1Impulse +
-                                                             deltaLambda, frictionLimit));
-        deltaLambda = mContactConstraints[c].friction1Impulse - lambdaTemp;
-
-        // Compute the impulse P=J^T * lambda
-        Vector3 angularImpulseBody1(-mContactConstraints[c].r1CrossT1.x * deltaLambda,
-                                    -mContactConstraints[c].r1CrossT1.y * deltaLambda,
-                                    -mContactConstraints[c].r1CrossT1.z * deltaLambda);
-        Vector3 linearImpulseBody2(mContactConstraints[c].frictionVector1.x * deltaLambda,
-                                   mContactConstraints[c].frictionVector1.y * deltaLambda,
-                                   mContactConstraints[c].frictionVector1.z * deltaLambda);
-        Vector3 angularImpulseBody2(mContactConstraints[c].r2CrossT1.x * deltaLambda,
-                                    mContactConstraints[c].r2CrossT1.y * deltaLambda,
-                                    mContactConstraints[c].r2CrossT1.z * deltaLambda);
+        if (mIsSplitImpulseActive) {
+            deltaLambda = - (Jv + mContactPoints[contactPointIndex].restitutionBias) *
+                    mContactPoints[contactPointIndex].inversePenetrationMass;
+        }
+        else {
+            deltaLambda = - (Jv + b) * mContactPoints[contactPointIndex].inversePenetrationMass;
+        }
+        lambdaTemp = mContactPoints[contactPointIndex].penetrationImpulse;
+        mContactPoints[contactPointIndex].penetrationImpulse = std::max(mContactPoints[contactPointIndex].penetrationImpulse +
+                                                   deltaLambda, decimal(0.0));
+        deltaLambda = mContactPoints[contactPointIndex].penetrationImpulse - lambdaTemp;
 
+        Vector3 linearImpulse(mContactPoints[contactPointIndex].normal.x * deltaLambda,
+                              mContactPoints[contactPointIndex].normal.y * deltaLambda,
+                              mContactPoints[contactPointIndex].normal.z * deltaLambda);
 
         // Update the velocities of the body 1 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z;
+        v1.x -= mContactConstraints[c].massInverseBody1 * linearImpulse.x;
+        v1.y -= mContactConstraints[c].massInverseBody1 * linearImpulse.y;
+        v1.z -= mContactConstraints[c].massInverseBody1 * linearImpulse.z;
 
-        mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1] += mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1;
+        w1.x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * deltaLambda;
+        w1.y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * deltaLambda;
+        w1.z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * deltaLambda;
 
         // Update the velocities of the body 2 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z;
+        v2.x += mContactConstraints[c].massInverseBody2 * linearImpulse.x;
+        v2.y += mContactConstraints[c].massInverseBody2 * linearImpulse.y;
+        v2.z += mContactConstraints[c].massInverseBody2 * linearImpulse.z;
+
+        w2.x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * deltaLambda;
+        w2.y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * deltaLambda;
+        w2.z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * deltaLambda;
+
+        sumPenetrationImpulse += mContactPoints[contactPointIndex].penetrationImpulse;
+
+        // If the split impulse position correction is active
+        if (mIsSplitImpulseActive) {
+
+            // Split impulse (position correction)
+            //Vector3 deltaVSplit = v2Split + w2Split.cross(mContactPoints[contactPointIndex].r2) - v1Split - w1Split.cross(mContactPoints[contactPointIndex].r1);
+            Vector3 deltaVSplit(v2Split.x + w2Split.y * mContactPoints[contactPointIndex].r2.z - w2Split.z * mContactPoints[contactPointIndex].r2.y - v1Split.x -
+                                w1Split.y * mContactPoints[contactPointIndex].r1.z + w1Split.z * mContactPoints[contactPointIndex].r1.y,
+                                v2Split.y + w2Split.z * mContactPoints[contactPointIndex].r2.x - w2Split.x * mContactPoints[contactPointIndex].r2.z - v1Split.y -
+                                w1Split.z * mContactPoints[contactPointIndex].r1.x + w1Split.x * mContactPoints[contactPointIndex].r1.z,
+                                v2Split.z + w2Split.x * mContactPoints[contactPointIndex].r2.y - w2Split.y * mContactPoints[contactPointIndex].r2.x - v1Split.z -
+                                w1Split.x * mContactPoints[contactPointIndex].r1.y + w1Split.y * mContactPoints[contactPointIndex].r1.x);
+            decimal JvSplit = deltaVSplit.x * mContactPoints[contactPointIndex].normal.x +
+                              deltaVSplit.y * mContactPoints[contactPointIndex].normal.y +
+                              deltaVSplit.z * mContactPoints[contactPointIndex].normal.z;
+            decimal deltaLambdaSplit = - (JvSplit + biasPenetrationDepth) *
+                    mContactPoints[contactPointIndex].inversePenetrationMass;
+            decimal lambdaTempSplit = mContactPoints[contactPointIndex].penetrationSplitImpulse;
+            mContactPoints[contactPointIndex].penetrationSplitImpulse = std::max(
+                        mContactPoints[contactPointIndex].penetrationSplitImpulse +
+                        deltaLambdaSplit, decimal(0.0));
+            deltaLambdaSplit = mContactPoints[contactPointIndex].penetrationSplitImpulse - lambdaTempSplit;
+
+            Vector3 linearImpulse(mContactPoints[contactPointIndex].normal.x * deltaLambdaSplit,
+                                  mContactPoints[contactPointIndex].normal.y * deltaLambdaSplit,
+                                  mContactPoints[contactPointIndex].normal.z * deltaLambdaSplit);
+
+            // Update the velocities of the body 1 by applying the impulse P
+            v1Split.x -= mContactConstraints[c].massInverseBody1 * linearImpulse.x;
+            v1Split.y -= mContactConstraints[c].massInverseBody1 * linearImpulse.y;
+            v1Split.z -= mContactConstraints[c].massInverseBody1 * linearImpulse.z;
+
+            w1Split.x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * deltaLambdaSplit;
+            w1Split.y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * deltaLambdaSplit;
+            w1Split.z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * deltaLambdaSplit;
+
+            // Update the velocities of the body 1 by applying the impulse P
+            v2Split.x += mContactConstraints[c].massInverseBody2 * linearImpulse.x;
+            v2Split.y += mContactConstraints[c].massInverseBody2 * linearImpulse.y;
+            v2Split.z += mContactConstraints[c].massInverseBody2 * linearImpulse.z;
+
+            w2Split.x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * deltaLambdaSplit;
+            w2Split.y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * deltaLambdaSplit;
+            w2Split.z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * deltaLambdaSplit;
+        }
 
-        mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2] += mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2;
+        contactPointIndex++;
+    }
 
-        // ------ Second friction constraint at the center of the contact manifold ----- //
+    // ------ First friction constraint at the center of the contact manifold ------ //
+
+    // Compute J*v
+    // deltaV = v2 + w2.cross(mContactConstraints[c].r2Friction) - v1 - w1.cross(mContactConstraints[c].r1Friction);
+    Vector3 deltaV(v2.x + w2.y * mContactConstraints[c].r2Friction.z - w2.z * mContactConstraints[c].r2Friction.y - v1.x -
+                   w1.y * mContactConstraints[c].r1Friction.z + w1.z * mContactConstraints[c].r1Friction.y,
+
+                   v2.y + w2.z * mContactConstraints[c].r2Friction.x - w2.x * mContactConstraints[c].r2Friction.z - v1.y -
+                   w1.z * mContactConstraints[c].r1Friction.x + w1.x * mContactConstraints[c].r1Friction.z,
+
+                   v2.z + w2.x * mContactConstraints[c].r2Friction.y - w2.y * mContactConstraints[c].r2Friction.x - v1.z -
+                   w1.x * mContactConstraints[c].r1Friction.y + w1.y * mContactConstraints[c].r1Friction.x);
+    decimal Jv = deltaV.x * mContactConstraints[c].frictionVector1.x +
+                 deltaV.y * mContactConstraints[c].frictionVector1.y +
+                 deltaV.z * mContactConstraints[c].frictionVector1.z;
+
+    // Compute the Lagrange multiplier lambda
+    deltaLambda = -Jv * mContactConstraints[c].inverseFriction1Mass;
+    decimal frictionLimit = mContactConstraints[c].frictionCoefficient * sumPenetrationImpulse;
+    lambdaTemp = mContactConstraints[c].friction1Impulse;
+    mContactConstraints[c].friction1Impulse = std::max(-frictionLimit,
+                                                std::min(mContactConstraints[c].friction1Impulse +
+                                                         deltaLambda, frictionLimit));
+    deltaLambda = mContactConstraints[c].friction1Impulse - lambdaTemp;
+
+    // Compute the impulse P=J^T * lambda
+    Vector3 angularImpulseBody1(-mContactConstraints[c].r1CrossT1.x * deltaLambda,
+                                -mContactConstraints[c].r1CrossT1.y * deltaLambda,
+                                -mContactConstraints[c].r1CrossT1.z * deltaLambda);
+    Vector3 linearImpulseBody2(mContactConstraints[c].frictionVector1.x * deltaLambda,
+                               mContactConstraints[c].frictionVector1.y * deltaLambda,
+                               mContactConstraints[c].frictionVector1.z * deltaLambda);
+    Vector3 angularImpulseBody2(mContactConstraints[c].r2CrossT1.x * deltaLambda,
+                                mContactConstraints[c].r2CrossT1.y * deltaLambda,
+                                mContactConstraints[c].r2CrossT1.z * deltaLambda);
+
+
+    // Update the velocities of the body 1 by applying the impulse P
+    v1.x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x;
+    v1.y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y;
+    v1.z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z;
+
+    w1 += mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1;
+
+    // Update the velocities of the body 2 by applying the impulse P
+    v2.x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x;
+    v2.y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y;
+    v2.z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z;
+
+    w2 += mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2;
+
+    // ------ Second friction constraint at the center of the contact manifold ----- //
+
+    // Compute J*v
+    //deltaV = v2 + w2.cross(mContactConstraints[c].r2Friction) - v1 - w1.cross(mContactConstraints[c].r1Friction);
+    deltaV.x = v2.x + w2.y * mContactConstraints[c].r2Friction.z - w2.z * mContactConstraints[c].r2Friction.y  - v1.x -
+               w1.y * mContactConstraints[c].r1Friction.z + w1.z * mContactConstraints[c].r1Friction.y;
+    deltaV.y = v2.y + w2.z * mContactConstraints[c].r2Friction.x - w2.x * mContactConstraints[c].r2Friction.z  - v1.y -
+               w1.z * mContactConstraints[c].r1Friction.x + w1.x * mContactConstraints[c].r1Friction.z;
+    deltaV.z = v2.z + w2.x * mContactConstraints[c].r2Friction.y - w2.y * mContactConstraints[c].r2Friction.x  - v1.z -
+               w1.x * mContactConstraints[c].r1Friction.y + w1.y * mContactConstraints[c].r1Friction.x;
+    Jv = deltaV.x * mContactConstraints[c].frictionVector2.x + deltaV.y * mContactConstraints[c].frictionVector2.y +
+         deltaV.z * mContactConstraints[c].frictionVector2.z;
+
+    // Compute the Lagrange multiplier lambda
+    deltaLambda = -Jv * mContactConstraints[c].inverseFriction2Mass;
+    frictionLimit = mContactConstraints[c].frictionCoefficient * sumPenetrationImpulse;
+    lambdaTemp = mContactConstraints[c].friction2Impulse;
+    mContactConstraints[c].friction2Impulse = std::max(-frictionLimit,
+                                                std::min(mContactConstraints[c].friction2Impulse +
+                                                         deltaLambda, frictionLimit));
+    deltaLambda = mContactConstraints[c].friction2Impulse - lambdaTemp;
+
+    // Compute the impulse P=J^T * lambda
+    angularImpulseBody1.x = -mContactConstraints[c].r1CrossT2.x * deltaLambda;
+    angularImpulseBody1.y = -mContactConstraints[c].r1CrossT2.y * deltaLambda;
+    angularImpulseBody1.z = -mContactConstraints[c].r1CrossT2.z * deltaLambda;
+
+    linearImpulseBody2.x = mContactConstraints[c].frictionVector2.x * deltaLambda;
+    linearImpulseBody2.y = mContactConstraints[c].frictionVector2.y * deltaLambda;
+    linearImpulseBody2.z = mContactConstraints[c].frictionVector2.z * deltaLambda;
+
+    angularImpulseBody2.x = mContactConstraints[c].r2CrossT2.x * deltaLambda;
+    angularImpulseBody2.y = mContactConstraints[c].r2CrossT2.y * deltaLambda;
+    angularImpulseBody2.z = mContactConstraints[c].r2CrossT2.z * deltaLambda;
+
+    // Update the velocities of the body 1 by applying the impulse P
+    v1.x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x;
+    v1.y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y;
+    v1.z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z;
+    w1 += mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1;
+
+    // Update the velocities of the body 2 by applying the impulse P
+    v2.x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x;
+    v2.y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y;
+    v2.z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z;
+    w2 += mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2;
+
+    // ------ Twist friction constraint at the center of the contact manifol ------ //
+
+    // Compute J*v
+    deltaV = w2 - w1;
+    Jv = deltaV.x * mContactConstraints[c].normal.x + deltaV.y * mContactConstraints[c].normal.y +
+         deltaV.z * mContactConstraints[c].normal.z;
+
+    deltaLambda = -Jv * (mContactConstraints[c].inverseTwistFrictionMass);
+    frictionLimit = mContactConstraints[c].frictionCoefficient * sumPenetrationImpulse;
+    lambdaTemp = mContactConstraints[c].frictionTwistImpulse;
+    mContactConstraints[c].frictionTwistImpulse = std::max(-frictionLimit,
+                                                    std::min(mContactConstraints[c].frictionTwistImpulse
+                                                             + deltaLambda, frictionLimit));
+    deltaLambda = mContactConstraints[c].frictionTwistImpulse - lambdaTemp;
+
+    // Compute the impulse P=J^T * lambda
+    angularImpulseBody2.x = mContactConstraints[c].normal.x * deltaLambda;
+    angularImpulseBody2.y = mContactConstraints[c].normal.y * deltaLambda;
+    angularImpulseBody2.z = mContactConstraints[c].normal.z * deltaLambda;
+
+    // Update the velocities of the body 1 by applying the impulse P
+    w1 -= mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody2;
+
+    // Update the velocities of the body 1 by applying the impulse P
+    w2 += mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2;
+
+    // --------- Rolling resistance constraint at the center of the contact manifold --------- //
+
+    if (mContactConstraints[c].rollingResistanceFactor > 0) {
 
         // Compute J*v
-        //deltaV = v2 + w2.cross(mContactConstraints[c].r2Friction) - v1 - w1.cross(mContactConstraints[c].r1Friction);
-        deltaV.x = v2.x + w2.y * mContactConstraints[c].r2Friction.z - w2.z * mContactConstraints[c].r2Friction.y  - v1.x -
-                   w1.y * mContactConstraints[c].r1Friction.z + w1.z * mContactConstraints[c].r1Friction.y;
-        deltaV.y = v2.y + w2.z * mContactConstraints[c].r2Friction.x - w2.x * mContactConstraints[c].r2Friction.z  - v1.y -
-                   w1.z * mContactConstraints[c].r1Friction.x + w1.x * mContactConstraints[c].r1Friction.z;
-        deltaV.z = v2.z + w2.x * mContactConstraints[c].r2Friction.y - w2.y * mContactConstraints[c].r2Friction.x  - v1.z -
-                   w1.x * mContactConstraints[c].r1Friction.y + w1.y * mContactConstraints[c].r1Friction.x;
-        Jv = deltaV.x * mContactConstraints[c].frictionVector2.x + deltaV.y * mContactConstraints[c].frictionVector2.y +
-             deltaV.z * mContactConstraints[c].frictionVector2.z;
+        const Vector3 JvRolling = w2 - w1;
 
         // Compute the Lagrange multiplier lambda
-        deltaLambda = -Jv * mContactConstraints[c].inverseFriction2Mass;
-        frictionLimit = mContactConstraints[c].frictionCoefficient * sumPenetrationImpulse;
-        lambdaTemp = mContactConstraints[c].friction2Impulse;
-        mContactConstraints[c].friction2Impulse = std::max(-frictionLimit,
-                                                    std::min(mContactConstraints[c].friction2Impulse +
-                                                             deltaLambda, frictionLimit));
-        deltaLambda = mContactConstraints[c].friction2Impulse - lambdaTemp;
-
-        // Compute the impulse P=J^T * lambda
-        angularImpulseBody1.x = -mContactConstraints[c].r1CrossT2.x * deltaLambda;
-        angularImpulseBody1.y = -mContactConstraints[c].r1CrossT2.y * deltaLambda;
-        angularImpulseBody1.z = -mContactConstraints[c].r1CrossT2.z * deltaLambda;
-
-        linearImpulseBody2.x = mContactConstraints[c].frictionVector2.x * deltaLambda;
-        linearImpulseBody2.y = mContactConstraints[c].frictionVector2.y * deltaLambda;
-        linearImpulseBody2.z = mContactConstraints[c].frictionVector2.z * deltaLambda;
-
-        angularImpulseBody2.x = mContactConstraints[c].r2CrossT2.x * deltaLambda;
-        angularImpulseBody2.y = mContactConstraints[c].r2CrossT2.y * deltaLambda;
-        angularImpulseBody2.z = mContactConstraints[c].r2CrossT2.z * deltaLambda;
+        Vector3 deltaLambdaRolling = mContactConstraints[c].inverseRollingResistance * (-JvRolling);
+        decimal rollingLimit = mContactConstraints[c].rollingResistanceFactor * sumPenetrationImpulse;
+        Vector3 lambdaTempRolling = mContactConstraints[c].rollingResistanceImpulse;
+        mContactConstraints[c].rollingResistanceImpulse = clamp(mContactConstraints[c].rollingResistanceImpulse +
+                                                             deltaLambdaRolling, rollingLimit);
+        deltaLambdaRolling = mContactConstraints[c].rollingResistanceImpulse - lambdaTempRolling;
 
         // Update the velocities of the body 1 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1].z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z;
-        mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1] += mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1;
+        w1 -= mContactConstraints[c].inverseInertiaTensorBody1 * deltaLambdaRolling;
 
         // Update the velocities of the body 2 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2].z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z;
-        mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2] += mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2;
+        w2 += mContactConstraints[c].inverseInertiaTensorBody2 * deltaLambdaRolling;
+    }
+
+    storeConstrainedVelocities(c, v1, w1, v2, w2);
+    if (mIsSplitImpulseActive) {
+        storeSplitVelocities(c, v1Split, w1Split, v2Split, w2Split);
+    }
+}
+
+// Store the constrained velocities of the non-static bodies of a contact manifold
+/// A static body can be part of several islands (or several manifolds of a color) solved in parallel.
+/// Its velocities are not modified by the solver (its inverse mass and inverse inertia tensor are zero)
+/// and are never written to avoid a data race between the threads.
+void ContactSolverSystem::storeConstrainedVelocities(uint32 c, const Vector3& v1, const Vector3& w1,
+                                                     const Vector3& v2, const Vector3& w2) {
+
+    if (mContactConstraints[c].isBody1Updated) {
+        mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1] = v1;
+        mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1] = w1;
+    }
+    if (mContactConstraints[c].isBody2Updated) {
+        mRigidBodyComponents.mConstrainedLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2] = v2;
+        mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2] = w2;
+    }
+}
+
+// Store the split velocities of the non-static bodies of a contact manifold
+void ContactSolverSystem::storeSplitVelocities(uint32 c, const Vector3& v1Split, const Vector3& w1Split,
+                                               const Vector3& v2Split, const Vector3& w2Split) {
+
+    if (mContactConstraints[c].isBody1Updated) {
+        mRigidBodyComponents.mSplitLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1] = v1Split;
+        mRigidBodyComponents.mSplitAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1] = w1Split;
+    }
+    if (mContactConstraints[c].isBody2Updated) {
+        mRigidBodyComponents.mSplitLinearVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2] = v2Split;
+        mRigidBodyComponents.mSplitAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2] = w2Split;
+    }
+}
+
+// Solve the contacts of the contact manifolds of a block
+/// The lanes of the block are solved at the same time with the exact same sequence of operations
+/// as the one of the solveContactManifold() method. The velocities of the bodies are gathered
+/// at the beginning and scattered back at the end because the lanes of a block never share a
+/// dynamic body. The empty lanes and the missing contact points only contain zeros and do not
+/// apply any impulse.
+void ContactSolverSystem::solveBlock(ContactManifoldsBlockSolver& block) {
+
+    // Gather the constrained velocities of the bodies of the lanes
+    Vector3Lanes v1Lanes, w1Lanes, v2Lanes, w2Lanes;
+    Vector3Lanes v1SplitLanes, w1SplitLanes, v2SplitLanes, w2SplitLanes;
+    for (uint32 lane=0; lane < SIMD_DECIMAL_NB_LANES; lane++) {
+
+        const bool isLaneUsed = block.contactManifoldsIndices[lane] != INVALID_MANIFOLD_INDEX;
+        const uint32 body1 = block.rigidBodyComponentIndexBody1[lane];
+        const uint32 body2 = block.rigidBodyComponentIndexBody2[lane];
+
+        v1Lanes.setLane(lane, isLaneUsed ? mRigidBodyComponents.mConstrainedLinearVelocities[body1] : Vector3::zero());
+        w1Lanes.setLane(lane, isLaneUsed ? mRigidBodyComponents.mConstrainedAngularVelocities[body1] : Vector3::zero());
+        v2Lanes.setLane(lane, isLaneUsed ? mRigidBodyComponents.mConstrainedLinearVelocities[body2] : Vector3::zero());
+        w2Lanes.setLane(lane, isLaneUsed ? mRigidBodyComponents.mConstrainedAngularVelocities[body2] : Vector3::zero());
+
+        if (mIsSplitImpulseActive) {
+            v1SplitLanes.setLane(lane, isLaneUsed ? mRigidBodyComponents.mSplitLinearVelocities[body1] : Vector3::zero());
+            w1SplitLanes.setLane(lane, isLaneUsed ? mRigidBodyComponents.mSplitAngularVelocities[body1] : Vector3::zero());
+            v2SplitLanes.setLane(lane, isLaneUsed ? mRigidBodyComponents.mSplitLinearVelocities[body2] : Vector3::zero());
+            w2SplitLanes.setLane(lane, isLaneUsed ? mRigidBodyComponents.mSplitAngularVelocities[body2] : Vector3::zero());
+        }
+    }
+
+    SimdVector3 v1 = SimdVector3::load(v1Lanes);
+    SimdVector3 w1 = SimdVector3::load(w1Lanes);
+    SimdVector3 v2 = SimdVector3::load(v2Lanes);
+    SimdVector3 w2 = SimdVector3::load(w2Lanes);
+    SimdVector3 v1Split, w1Split, v2Split, w2Split;
+    if (mIsSplitImpulseActive) {
+        v1Split = SimdVector3::load(v1SplitLanes);
+        w1Split = SimdVector3::load(w1SplitLanes);
+        v2Split = SimdVector3::load(v2SplitLanes);
+        w2Split = SimdVector3::load(w2SplitLanes);
+    }
+
+    // Compute v2 + w2.cross(r2) - v1 - w1.cross(r1) in the same order as the scalar solver
+    auto computeDeltaV = [](const SimdVector3& v1, const SimdVector3& w1, const SimdVector3& v2, const SimdVector3& w2,
+                            const SimdVector3& r1, const SimdVector3& r2) {
+        return SimdVector3(v2.x + w2.y * r2.z - w2.z * r2.y - v1.x - w1.y * r1.z + w1.z * r1.y,
+                           v2.y + w2.z * r2.x - w2.x * r2.z - v1.y - w1.z * r1.x + w1.x * r1.z,
+                           v2.z + w2.x * r2.y - w2.y * r2.x - v1.z - w1.x * r1.y + w1.y * r1.x);
+    };
+
+    const SimdDecimal zero(decimal(0.0));
+    const SimdDecimal massInverseBody1 = SimdDecimal::load(block.massInverseBody1);
+    const SimdDecimal massInverseBody2 = SimdDecimal::load(block.massInverseBody2);
+
+    SimdDecimal sumPenetrationImpulse = zero;
+
+    for (int8 i=0; i < block.nbContacts; i++) {
+
+        ContactPointsLanes& contactPoints = block.contactPoints[i];
 
-        // ------ Twist friction constraint at the center of the contact manifol ------ //
+        // --------- Penetration --------- //
+
+        const SimdVector3 normal = SimdVector3::load(contactPoints.normal);
+        const SimdVector3 r1 = SimdVector3::load(contactPoints.r1);
+        const SimdVector3 r2 = SimdVector3::load(contactPoints.r2);
+        const SimdVector3 i1TimesR1CrossN = SimdVector3::load(contactPoints.i1TimesR1CrossN);
+        const SimdVector3 i2TimesR2CrossN = SimdVector3::load(contactPoints.i2TimesR2CrossN);
+        const SimdDecimal inversePenetrationMass = SimdDecimal::load(contactPoints.inversePenetrationMass);
+        const SimdDecimal restitutionBias = SimdDecimal::load(contactPoints.restitutionBias);
+        const SimdDecimal biasPenetrationDepth = SimdDecimal::load(contactPoints.penetrationBias);
 
         // Compute J*v
-        deltaV = w2 - w1;
-        Jv = deltaV.x * mContactConstraints[c].normal.x + deltaV.y * mContactConstraints[c].normal.y +
-             deltaV.z * mContactConstraints[c].normal.z;
-
-        deltaLambda = -Jv * (mContactConstraints[c].inverseTwistFrictionMass);
-        frictionLimit = mContactConstraints[c].frictionCoefficient * sumPenetrationImpulse;
-        lambdaTemp = mContactConstraints[c].frictionTwistImpulse;
-        mContactConstraints[c].frictionTwistImpulse = std::max(-frictionLimit,
-                                                        std::min(mContactConstraints[c].frictionTwistImpulse
-                                                                 + deltaLambda, frictionLimit));
-        deltaLambda = mContactConstraints[c].frictionTwistImpulse - lambdaTemp;
-
-        // Compute the impulse P=J^T * lambda
-        angularImpulseBody2.x = mContactConstraints[c].normal.x * deltaLambda;
-        angularImpulseBody2.y = mContactConstraints[c].normal.y * deltaLambda;
-        angularImpulseBody2.z = mContactConstraints[c].normal.z * deltaLambda;
+        const SimdDecimal Jv = computeDeltaV(v1, w1, v2, w2, r1, r2).dot(normal);
 
-        // Update the velocities of the body 1 by applying the impulse P
-        mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1] -= mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody2;
+        // Compute the Lagrange multiplier lambda
+        SimdDecimal deltaLambda;
+        if (mIsSplitImpulseActive) {
+            deltaLambda = -(Jv + restitutionBias) * inversePenetrationMass;
+        }
+        else {
+            deltaLambda = -(Jv + (biasPenetrationDepth + restitutionBias)) * inversePenetrationMass;
+        }
+        const SimdDecimal lambdaTemp = SimdDecimal::load(contactPoints.penetrationImpulse);
+        const SimdDecimal penetrationImpulse = SimdDecimal::max(lambdaTemp + deltaLambda, zero);
+        penetrationImpulse.store(contactPoints.penetrationImpulse);
+        deltaLambda = penetrationImpulse - lambdaTemp;
+
+        const SimdVector3 linearImpulse = normal * deltaLambda;
+
+        // Update the velocities of the bodies by applying the impulse P
+        v1 -= massInverseBody1 * linearImpulse;
+        w1 -= i1TimesR1CrossN * deltaLambda;
+        v2 += massInverseBody2 * linearImpulse;
+        w2 += i2TimesR2CrossN * deltaLambda;
+
+        sumPenetrationImpulse += penetrationImpulse;
+
+        // If the split impulse position correction is active
+        if (mIsSplitImpulseActive) {
+
+            const SimdDecimal JvSplit = computeDeltaV(v1Split, w1Split, v2Split, w2Split, r1, r2).dot(normal);
+            SimdDecimal deltaLambdaSplit = -(JvSplit + biasPenetrationDepth) * inversePenetrationMass;
+            const SimdDecimal lambdaTempSplit = SimdDecimal::load(contactPoints.penetrationSplitImpulse);
+            const SimdDecimal penetrationSplitImpulse = SimdDecimal::max(lambdaTempSplit + deltaLambdaSplit, zero);
+            penetrationSplitImpulse.store(contactPoints.penetrationSplitImpulse);
+            deltaLambdaSplit = penetrationSplitImpulse - lambdaTempSplit;
+
+            const SimdVector3 linearImpulseSplit = normal * deltaLambdaSplit;
+
+            // Update the split velocities of the bodies by applying the impulse P
+            v1Split -= massInverseBody1 * linearImpulseSplit;
+            w1Split -= i1TimesR1CrossN * deltaLambdaSplit;
+            v2Split += massInverseBody2 * linearImpulseSplit;
+            w2Split += i2TimesR2CrossN * deltaLambdaSplit;
+        }
+    }
 
-        // Update the velocities of the body 1 by applying the impulse P
-        mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2] += mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2;
+    const SimdMatrix3x3 inverseInertiaTensorBody1 = SimdMatrix3x3::load(block.inverseInertiaTensorBody1);
+    const SimdMatrix3x3 inverseInertiaTensorBody2 = SimdMatrix3x3::load(block.inverseInertiaTensorBody2);
+    const SimdVector3 r1Friction = SimdVector3::load(block.r1Friction);
+    const SimdVector3 r2Friction = SimdVector3::load(block.r2Friction);
+    const SimdDecimal frictionLimit = SimdDecimal::load(block.frictionCoefficient) * sumPenetrationImpulse;
 
-        // --------- Rolling resistance constraint at the center of the contact manifold --------- //
+    // ------ First friction constraint at the center of the contact manifold ------ //
 
-        if (mContactConstraints[c].rollingResistanceFactor > 0) {
+    const SimdVector3 frictionVector1 = SimdVector3::load(block.frictionVector1);
+    SimdDecimal Jv = computeDeltaV(v1, w1, v2, w2, r1Friction, r2Friction).dot(frictionVector1);
 
-            // Compute J*v
-            const Vector3 JvRolling = w2 - w1;
+    // Compute the Lagrange multiplier lambda
+    SimdDecimal deltaLambda = -Jv * SimdDecimal::load(block.inverseFriction1Mass);
+    SimdDecimal lambdaTemp = SimdDecimal::load(block.friction1Impulse);
+    SimdDecimal frictionImpulse = SimdDecimal::max(-frictionLimit, SimdDecimal::min(lambdaTemp + deltaLambda, frictionLimit));
+    frictionImpulse.store(block.friction1Impulse);
+    deltaLambda = frictionImpulse - lambdaTemp;
 
-            // Compute the Lagrange multiplier lambda
-            Vector3 deltaLambdaRolling = mContactConstraints[c].inverseRollingResistance * (-JvRolling);
-            decimal rollingLimit = mContactConstraints[c].rollingResistanceFactor * sumPenetrationImpulse;
-            Vector3 lambdaTempRolling = mContactConstraints[c].rollingResistanceImpulse;
-            mContactConstraints[c].rollingResistanceImpulse = clamp(mContactConstraints[c].rollingResistanceImpulse +
-                                                                 deltaLambdaRolling, rollingLimit);
-            deltaLambdaRolling = mContactConstraints[c].rollingResistanceImpulse - lambdaTempRolling;
+    // Compute the impulse P=J^T * lambda
+    SimdVector3 angularImpulseBody1 = -SimdVector3::load(block.r1CrossT1) * deltaLambda;
+    SimdVector3 linearImpulseBody2 = frictionVector1 * deltaLambda;
+    SimdVector3 angularImpulseBody2 = SimdVector3::load(block.r2CrossT1) * deltaLambda;
 
-            // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody1] -= mContactConstraints[c].inverseInertiaTensorBody1 * deltaLambdaRolling;
+    // Update the velocities of the bodies by applying the impulse P
+    v1 -= massInverseBody1 * linearImpulseBody2;
+    w1 += inverseInertiaTensorBody1 * angularImpulseBody1;
+    v2 += massInverseBody2 * linearImpulseBody2;
+    w2 += inverseInertiaTensorBody2 * angularImpulseBody2;
 
-            // Update the velocities of the body 2 by applying the impulse P
-            mRigidBodyComponents.mConstrainedAngularVelocities[mContactConstraints[c].rigidBodyComponentIndexBody2] += mContactConstraints[c].inverseInertiaTensorBody2 * deltaLambdaRolling;
+    // ------ Second friction constraint at the center of the contact manifold ----- //
+
+    const SimdVector3 frictionVector2 = SimdVector3::load(block.frictionVector2);
+    Jv = computeDeltaV(v1, w1, v2, w2, r1Friction, r2Friction).dot(frictionVector2);
+
+    // Compute the Lagrange multiplier lambda
+    deltaLambda = -Jv * SimdDecimal::load(block.inverseFriction2Mass);
+    lambdaTemp = SimdDecimal::load(block.friction2Impulse);
+    frictionImpulse = SimdDecimal::max(-frictionLimit, SimdDecimal::min(lambdaTemp + deltaLambda, frictionLimit));
+    frictionImpulse.store(block.friction2Impulse);
+    deltaLambda = frictionImpulse - lambdaTemp;
+
+    // Compute the impulse P=J^T * lambda
+    angularImpulseBody1 = -SimdVector3::load(block.r1CrossT2) * deltaLambda;
+    linearImpulseBody2 = frictionVector2 * deltaLambda;
+    angularImpulseBody2 = SimdVector3::load(block.r2CrossT2) * deltaLambda;
+
+    // Update the velocities of the bodies by applying the impulse P
+    v1 -= massInverseBody1 * linearImpulseBody2;
+    w1 += inverseInertiaTensorBody1 * angularImpulseBody1;
+    v2 += massInverseBody2 * linearImpulseBody2;
+    w2 += inverseInertiaTensorBody2 * angularImpulseBody2;
+
+    // ------ Twist friction constraint at the center of the contact manifold ------ //
+
+    const SimdVector3 normal = SimdVector3::load(block.normal);
+    Jv = (w2 - w1).dot(normal);
+
+    deltaLambda = -Jv * SimdDecimal::load(block.inverseTwistFrictionMass);
+    lambdaTemp = SimdDecimal::load(block.frictionTwistImpulse);
+    frictionImpulse = SimdDecimal::max(-frictionLimit, SimdDecimal::min(lambdaTemp + deltaLambda, frictionLimit));
+    frictionImpulse.store(block.frictionTwistImpulse);
+    deltaLambda = frictionImpulse - lambdaTemp;
+
+    // Compute the impulse P=J^T * lambda
+    angularImpulseBody2 = normal * deltaLambda;
+
+    // Update the velocities of the bodies by applying the impulse P
+    w1 -= inverseInertiaTensorBody1 * angularImpulseBody2;
+    w2 += inverseInertiaTensorBody2 * angularImpulseBody2;
+
+    // --------- Rolling resistance constraint at the center of the contact manifold --------- //
+
+    // The lanes without rolling resistance have a zero inverse rolling resistance matrix
+    if (block.hasRollingResistance) {
+
+        // Compute J*v
+        const SimdVector3 JvRolling = w2 - w1;
+
+        // Compute the Lagrange multiplier lambda
+        SimdVector3 deltaLambdaRolling = SimdMatrix3x3::load(block.inverseRollingResistance) * (-JvRolling);
+        const SimdDecimal rollingLimit = SimdDecimal::load(block.rollingResistanceFactor) * sumPenetrationImpulse;
+        const SimdVector3 lambdaTempRolling = SimdVector3::load(block.rollingResistanceImpulse);
+
+        // Clamp the length of the accumulated impulse to the rolling limit
+        const SimdVector3 rollingImpulse = lambdaTempRolling + deltaLambdaRolling;
+        const SimdDecimal lengthSquare = rollingImpulse.lengthSquare();
+        const SimdDecimal scale = SimdDecimal::selectGreater(lengthSquare, rollingLimit * rollingLimit,
+                                                             rollingLimit / SimdDecimal::sqrt(lengthSquare), SimdDecimal(decimal(1.0)));
+        const SimdVector3 clampedRollingImpulse = rollingImpulse * scale;
+        clampedRollingImpulse.store(block.rollingResistanceImpulse);
+        deltaLambdaRolling = clampedRollingImpulse - lambdaTempRolling;
+
+        // Update the velocities of the bodies by applying the impulse P
+        w1 -= inverseInertiaTensorBody1 * deltaLambdaRolling;
+        w2 += inverseInertiaTensorBody2 * deltaLambdaRolling;
+    }
+
+    // Scatter the new velocities to the bodies that can be modified by the solver
+    v1.store(v1Lanes);
+    w1.store(w1Lanes);
+    v2.store(v2Lanes);
+    w2.store(w2Lanes);
+    if (mIsSplitImpulseActive) {
+        v1Split.store(v1SplitLanes);
+        w1Split.store(w1SplitLanes);
+        v2Split.store(v2SplitLanes);
+        w2Split.store(w2SplitLanes);
+    }
+    for (uint32 lane=0; lane < SIMD_DECIMAL_NB_LANES; lane++) {
+
+        if (block.isBody1Updated[lane]) {
+            const uint32 body1 = block.rigidBodyComponentIndexBody1[lane];
+            mRigidBodyComponents.mConstrainedLinearVelocities[body1] = v1Lanes.getLane(lane);
+            mRigidBodyComponents.mConstrainedAngularVelocities[body1] = w1Lanes.getLane(lane);
+            if (mIsSplitImpulseActive) {
+                mRigidBodyComponents.mSplitLinearVelocities[body1] = v1SplitLanes.getLane(lane);
+                mRigidBodyComponents.mSplitAngularVelocities[body1] = w1SplitLanes.getLane(lane);
+            }
+        }
+        if (block.isBody2Updated[lane]) {
+            const uint32 body2 = block.rigidBodyComponentIndexBody2[lane];
+            mRigidBodyComponents.mConstrainedLinearVelocities[body2] = v2Lanes.getLane(lane);
+            mRigidBodyComponents.mConstrainedAngularVelocities[body2] = w2Lanes.getLane(lane);
+            if (mIsSplitImpulseActive) {
+                mRigidBodyComponents.mSplitLinearVelocities[body2] = v2SplitLanes.getLane(lane);
+                mRigidBodyComponents.mSplitAngularVelocities[body2] = w2SplitLanes.getLane(lane);
+            }
         }
     }
 }
@@ -796,16 +1509,30 @@ inline decimal ContactSolverSystem::computeMixedRollingResistance(Collider* coll
     return decimal(0.5f) * (collider1->getMaterial().getRollingResistance() + collider2->getMaterial().getRollingResistance());
 }
 
-// Store the computed impulses to use them to
+// Store the computed impulses of an island to use them to
 // warm start the solver at the next iteration
-void ContactSolverSystem::storeImpulses() {
+void ContactSolverSystem::storeImpulses(uint32 islandIndex) {
+
+    const uint32 contactManifoldsIndex = mIslands.contactManifoldsIndices[islandIndex];
+    const uint32 nbContactManifolds = mIslands.nbContactManifolds[islandIndex];
+    if (nbContactManifolds == 0) return;
+
+    // Copy the impulses accumulated in the blocks back into the contact manifolds
+    if (mIsWideSolverActive) {
 
-    RP3D_PROFILE("ContactSolver::storeImpulses()", mProfiler);
+        if (mIslandsBlocksStartIndices != nullptr) {
+            unpackBlocks(mContactBlocks + mIslandsBlocksStartIndices[islandIndex],
+                         mIslandsBlocksStartIndices[islandIndex + 1] - mIslandsBlocksStartIndices[islandIndex]);
+        }
+        if (islandIndex == mColoredIslandIndex && mColoredIslandBlocks != nullptr) {
+            unpackBlocks(mColoredIslandBlocks, mColorsBlocksStartIndices[mColorsBlocksStartIndices.size() - 1]);
+        }
+    }
 
-    uint contactPointIndex = 0;
+    uint contactPointIndex = mContactConstraints[contactManifoldsIndex].externalContactManifold->contactPointsIndex;
 
     // For each contact manifold
-    for (uint c=0; c<mNbContactManifolds; c++) {
+    for (uint c=contactManifoldsIndex; c < contactManifoldsIndex + nbContactManifolds; c++) {
 
         for (short int i=0; i<mContactConstraints[c].nbContacts; i++) {
 
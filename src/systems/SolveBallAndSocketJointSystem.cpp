@@ -45,10 +45,10 @@ SolveBallAndSocketJointSystem::SolveBallAndSocketJointSystem(PhysicsWorld& world
 }
 
 // Initialize before solving the constraint
-void SolveBallAndSocketJointSystem::initBeforeSolve() {
+void SolveBallAndSocketJointSystem::initBeforeSolve(uint32 startIndex, uint32 endIndex) {
 
     // For each joint
-    for (uint32 i=0; i < mBallAndSocketJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
 
@@ -65,7 +65,7 @@ void SolveBallAndSocketJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mBallAndSocketJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
 
@@ -82,7 +82,7 @@ void SolveBallAndSocketJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mBallAndSocketJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
 
@@ -122,7 +122,7 @@ void SolveBallAndSocketJointSystem::initBeforeSolve() {
     const decimal biasFactor = (BETA / mTimeStep);
 
     // For each joint
-    for (uint32 i=0; i < mBallAndSocketJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
 
@@ -147,7 +147,7 @@ void SolveBallAndSocketJointSystem::initBeforeSolve() {
     if (!mIsWarmStartingActive) {
 
         // For each joint
-        for (uint32 i=0; i < mBallAndSocketJointComponents.getNbEnabledComponents(); i++) {
+        for (uint32 i=startIndex; i < endIndex; i++) {
 
             // Reset the accumulated impulse
             mBallAndSocketJointComponents.mImpulse[i].setToZero();
@@ -156,10 +156,12 @@ void SolveBallAndSocketJointSystem::initBeforeSolve() {
 }
 
 // Warm start the constraint (apply the previous impulse at the beginning of the step)
-void SolveBallAndSocketJointSystem::warmstart() {
+void SolveBallAndSocketJointSystem::warmstart(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex) {
 
     // For each joint component
-    for (uint32 i=0; i < mBallAndSocketJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
 
@@ -170,10 +172,10 @@ void SolveBallAndSocketJointSystem::warmstart() {
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+        Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+        Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+        Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
         const Vector3& r1World = mBallAndSocketJointComponents.mR1World[i];
         const Vector3& r2World = mBallAndSocketJointComponents.mR2World[i];
@@ -195,14 +197,20 @@ void SolveBallAndSocketJointSystem::warmstart() {
         // Apply the impulse to the body to the body 2
         v2 += mRigidBodyComponents.mInverseMasses[componentIndexBody2] * mBallAndSocketJointComponents.mImpulse[i];
         w2 += i2 * angularImpulseBody2;
+
+        // Store the velocities of the bodies
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody1, v1, w1);
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody2, v2, w2);
     }
 }
 
 // Solve the velocity constraint
-void SolveBallAndSocketJointSystem::solveVelocityConstraint() {
+void SolveBallAndSocketJointSystem::solveVelocityConstraint(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex) {
 
     // For each joint component
-    for (uint32 i=0; i < mBallAndSocketJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
 
@@ -213,10 +221,10 @@ void SolveBallAndSocketJointSystem::solveVelocityConstraint() {
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+        Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+        Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+        Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
         const Matrix3x3& i1 = mBallAndSocketJointComponents.mI1[i];
         const Matrix3x3& i2 = mBallAndSocketJointComponents.mI2[i];
@@ -242,14 +250,20 @@ void SolveBallAndSocketJointSystem::solveVelocityConstraint() {
         // Apply the impulse to the body 2
         v2 += mRigidBodyComponents.mInverseMasses[componentIndexBody2] * deltaLambda;
         w2 += i2 * angularImpulseBody2;
+
+        // Store the velocities of the bodies
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody1, v1, w1);
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody2, v2, w2);
     }
 }
 
 // Solve the position constraint (for position error correction)
-void SolveBallAndSocketJointSystem::solvePositionConstraint() {
+void SolveBallAndSocketJointSystem::solvePositionConstraint(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex) {
 
     // For each joint component
-    for (uint32 i=0; i < mBallAndSocketJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
 
@@ -266,7 +280,9 @@ void SolveBallAndSocketJointSystem::solvePositionConstraint() {
     }
 
     // For each joint component
-    for (uint32 i=0; i < mBallAndSocketJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
 
@@ -285,7 +301,9 @@ void SolveBallAndSocketJointSystem::solvePositionConstraint() {
     }
 
     // For each joint component
-    for (uint32 i=0; i < mBallAndSocketJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
 
@@ -325,7 +343,9 @@ void SolveBallAndSocketJointSystem::solvePositionConstraint() {
     }
 
     // For each joint component
-    for (uint32 i=0; i < mBallAndSocketJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
 
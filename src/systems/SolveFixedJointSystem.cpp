@@ -45,10 +45,10 @@ SolveFixedJointSystem::SolveFixedJointSystem(PhysicsWorld& world, RigidBodyCompo
 }
 
 // Initialize before solving the constraint
-void SolveFixedJointSystem::initBeforeSolve() {
+void SolveFixedJointSystem::initBeforeSolve(uint32 startIndex, uint32 endIndex) {
 
     // For each joint
-    for (uint32 i=0; i < mFixedJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
 
@@ -65,7 +65,7 @@ void SolveFixedJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mFixedJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
 
@@ -82,7 +82,7 @@ void SolveFixedJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mFixedJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
 
@@ -118,7 +118,7 @@ void SolveFixedJointSystem::initBeforeSolve() {
     const decimal biasFactor = BETA / mTimeStep;
 
     // For each joint
-    for (uint32 i=0; i < mFixedJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
 
@@ -141,7 +141,7 @@ void SolveFixedJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mFixedJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
 
@@ -158,7 +158,7 @@ void SolveFixedJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mFixedJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
 
@@ -182,7 +182,7 @@ void SolveFixedJointSystem::initBeforeSolve() {
     if (!mIsWarmStartingActive) {
 
         // For each joint
-        for (uint32 i=0; i < mFixedJointComponents.getNbEnabledComponents(); i++) {
+        for (uint32 i=startIndex; i < endIndex; i++) {
 
             // Reset the accumulated impulses
             mFixedJointComponents.mImpulseTranslation[i].setToZero();
@@ -192,10 +192,12 @@ void SolveFixedJointSystem::initBeforeSolve() {
 }
 
 // Warm start the constraint (apply the previous impulse at the beginning of the step)
-void SolveFixedJointSystem::warmstart() {
+void SolveFixedJointSystem::warmstart(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex) {
 
     // For each joint
-    for (uint32 i=0; i < mFixedJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
 
@@ -207,10 +209,10 @@ void SolveFixedJointSystem::warmstart() {
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+        Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+        Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+        Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
         // Get the inverse mass of the bodies
         const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
@@ -246,14 +248,20 @@ void SolveFixedJointSystem::warmstart() {
         // Apply the impulse to the body 2
         v2 += inverseMassBody2 * impulseTranslation;
         w2 += i2 * angularImpulseBody2;
+
+        // Store the velocities of the bodies
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody1, v1, w1);
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody2, v2, w2);
     }
 }
 
 // Solve the velocity constraint
-void SolveFixedJointSystem::solveVelocityConstraint() {
+void SolveFixedJointSystem::solveVelocityConstraint(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex) {
 
     // For each joint
-    for (uint32 i=0; i < mFixedJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
 
@@ -265,10 +273,10 @@ void SolveFixedJointSystem::solveVelocityConstraint() {
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+        Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+        Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+        Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
         // Get the inverse mass of the bodies
         decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
@@ -327,14 +335,20 @@ void SolveFixedJointSystem::solveVelocityConstraint() {
 
         // Apply the impulse to the body 2
         w2 += i2 * deltaLambda2;
+
+        // Store the velocities of the bodies
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody1, v1, w1);
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody2, v2, w2);
     }
 }
 
 // Solve the position constraint (for position error correction)
-void SolveFixedJointSystem::solvePositionConstraint() {
+void SolveFixedJointSystem::solvePositionConstraint(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex) {
 
     // For each joint
-    for (uint32 i=0; i < mFixedJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
 
@@ -352,7 +366,9 @@ void SolveFixedJointSystem::solvePositionConstraint() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mFixedJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
 
@@ -374,7 +390,9 @@ void SolveFixedJointSystem::solvePositionConstraint() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mFixedJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
 
@@ -417,7 +435,9 @@ void SolveFixedJointSystem::solvePositionConstraint() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mFixedJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
 
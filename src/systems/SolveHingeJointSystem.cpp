@@ -45,10 +45,10 @@ SolveHingeJointSystem::SolveHingeJointSystem(PhysicsWorld& world, RigidBodyCompo
 }
 
 // Initialize before solving the constraint
-void SolveHingeJointSystem::initBeforeSolve() {
+void SolveHingeJointSystem::initBeforeSolve(uint32 startIndex, uint32 endIndex) {
 
     // For each joint
-    for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
 
@@ -65,7 +65,7 @@ void SolveHingeJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
 
@@ -84,7 +84,7 @@ void SolveHingeJointSystem::initBeforeSolve() {
     const decimal biasFactor = (BETA / mTimeStep);
 
     // For each joint
-    for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
 
@@ -115,7 +115,7 @@ void SolveHingeJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
 
@@ -148,7 +148,7 @@ void SolveHingeJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
 
@@ -168,7 +168,7 @@ void SolveHingeJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
 
@@ -202,7 +202,7 @@ void SolveHingeJointSystem::initBeforeSolve() {
     if (!mIsWarmStartingActive) {
 
         // For each joint
-        for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+        for (uint32 i=startIndex; i < endIndex; i++) {
 
             // Reset all the accumulated impulses
             mHingeJointComponents.mImpulseTranslation[i].setToZero();
@@ -214,7 +214,7 @@ void SolveHingeJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
 
@@ -276,10 +276,12 @@ void SolveHingeJointSystem::initBeforeSolve() {
 }
 
 // Warm start the constraint (apply the previous impulse at the beginning of the step)
-void SolveHingeJointSystem::warmstart() {
+void SolveHingeJointSystem::warmstart(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex) {
 
     // For each joint component
-    for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
 
@@ -291,10 +293,10 @@ void SolveHingeJointSystem::warmstart() {
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+        Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+        Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+        Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
         // Get the inverse mass and inverse inertia tensors of the bodies
         const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
@@ -350,14 +352,20 @@ void SolveHingeJointSystem::warmstart() {
         // Apply the impulse to the body 2
         v2 += inverseMassBody2 * impulseTranslation;
         w2 += mHingeJointComponents.mI2[i] * angularImpulseBody2;
+
+        // Store the velocities of the bodies
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody1, v1, w1);
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody2, v2, w2);
     }
 }
 
 // Solve the velocity constraint
-void SolveHingeJointSystem::solveVelocityConstraint() {
+void SolveHingeJointSystem::solveVelocityConstraint(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex) {
 
     // For each joint component
-    for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
 
@@ -369,10 +377,10 @@ void SolveHingeJointSystem::solveVelocityConstraint() {
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+        Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+        Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+        Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
         // Get the inverse mass and inverse inertia tensors of the bodies
         decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
@@ -521,14 +529,20 @@ void SolveHingeJointSystem::solveVelocityConstraint() {
             // Apply the impulse to the body 2
             w2 += i2 * angularImpulseBody2;
         }
+
+        // Store the velocities of the bodies
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody1, v1, w1);
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody2, v2, w2);
     }
 }
 
 // Solve the position constraint (for position error correction)
-void SolveHingeJointSystem::solvePositionConstraint() {
+void SolveHingeJointSystem::solvePositionConstraint(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex) {
 
     // For each joint component
-    for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
 
@@ -545,7 +559,9 @@ void SolveHingeJointSystem::solvePositionConstraint() {
     }
 
     // For each joint component
-    for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
 
@@ -565,7 +581,9 @@ void SolveHingeJointSystem::solvePositionConstraint() {
     }
 
     // For each joint component
-    for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
 
@@ -602,7 +620,9 @@ void SolveHingeJointSystem::solvePositionConstraint() {
     }
 
     // For each joint component
-    for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
 
@@ -725,7 +745,9 @@ void SolveHingeJointSystem::solvePositionConstraint() {
     }
 
     // For each joint component
-    for (uint32 i=0; i < mHingeJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
 
@@ -45,10 +45,10 @@ SolveSliderJointSystem::SolveSliderJointSystem(PhysicsWorld& world, RigidBodyCom
 }
 
 // Initialize before solving the constraint
-void SolveSliderJointSystem::initBeforeSolve() {
+void SolveSliderJointSystem::initBeforeSolve(uint32 startIndex, uint32 endIndex) {
 
     // For each joint
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
 
@@ -65,7 +65,7 @@ void SolveSliderJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
 
@@ -82,7 +82,7 @@ void SolveSliderJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
 
@@ -95,7 +95,7 @@ void SolveSliderJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         mSliderJointComponents.mN1[i] = mSliderJointComponents.mSliderAxisWorld[i].getOneUnitOrthogonalVector();
         mSliderJointComponents.mN2[i] = mSliderJointComponents.mSliderAxisWorld[i].cross(mSliderJointComponents.mN1[i]);
@@ -104,7 +104,7 @@ void SolveSliderJointSystem::initBeforeSolve() {
     const decimal biasFactor = (BETA / mTimeStep);
 
     // For each joint
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
 
@@ -186,7 +186,7 @@ void SolveSliderJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         // Compute the cross products used in the Jacobians
         mSliderJointComponents.mR2CrossN1[i] = mSliderJointComponents.mR2[i].cross(mSliderJointComponents.mN1[i]);
@@ -195,7 +195,7 @@ void SolveSliderJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
 
@@ -250,7 +250,7 @@ void SolveSliderJointSystem::initBeforeSolve() {
     }
 
     // For each joint
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 i=startIndex; i < endIndex; i++) {
 
         const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
 
@@ -286,7 +286,7 @@ void SolveSliderJointSystem::initBeforeSolve() {
     if (!mIsWarmStartingActive) {
 
         // For each joint
-        for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+        for (uint32 i=startIndex; i < endIndex; i++) {
 
             // Reset all the accumulated impulses
             mSliderJointComponents.mImpulseTranslation[i].setToZero();
@@ -299,10 +299,12 @@ void SolveSliderJointSystem::initBeforeSolve() {
 }
 
 // Warm start the constraint (apply the previous impulse at the beginning of the step)
-void SolveSliderJointSystem::warmstart() {
+void SolveSliderJointSystem::warmstart(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex) {
 
     // For each joint component
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
 
@@ -314,10 +316,10 @@ void SolveSliderJointSystem::warmstart() {
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+        Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+        Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+        Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
         // Get the inverse mass and inverse inertia tensors of the bodies
         const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
@@ -373,14 +375,20 @@ void SolveSliderJointSystem::warmstart() {
         // Apply the impulse to the body 2
         v2 += inverseMassBody2 * linearImpulseBody2;
         w2 += mSliderJointComponents.mI2[i] * angularImpulseBody2;
+
+        // Store the velocities of the bodies
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody1, v1, w1);
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody2, v2, w2);
     }
 }
 
 // Solve the velocity constraint
-void SolveSliderJointSystem::solveVelocityConstraint() {
+void SolveSliderJointSystem::solveVelocityConstraint(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex) {
 
     // For each joint component
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
 
@@ -392,10 +400,10 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+        Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+        Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+        Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
         const Matrix3x3& i1 = mSliderJointComponents.mI1[i];
         const Matrix3x3& i2 = mSliderJointComponents.mI2[i];
@@ -441,10 +449,16 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
         // Apply the impulse to the body 2
         v2 += inverseMassBody2 * linearImpulseBody2;
         w2 += i2 * angularImpulseBody2;
+
+        // Store the velocities of the bodies
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody1, v1, w1);
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody2, v2, w2);
     }
 
     // For each joint component
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
 
@@ -457,8 +471,10 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
 
         // --------------- Rotation Constraints --------------- //
 
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+        Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+        Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+        Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
         // Compute J*v for the 3 rotation constraints
         const Vector3 JvRotation = w2 - w1;
@@ -479,10 +495,16 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
 
         // Apply the impulse to the body 2
         w2 += mSliderJointComponents.mI2[i] * angularImpulseBody2;
+
+        // Store the velocities of the bodies
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody1, v1, w1);
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody2, v2, w2);
     }
 
     // For each joint component
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
 
@@ -493,8 +515,10 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
         const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+        Vector3 v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+        Vector3 v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+        Vector3 w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+        Vector3 w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
         decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
         decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
@@ -508,9 +532,6 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
 
         if (mSliderJointComponents.mIsLimitEnabled[i]) {
 
-            Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-            Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
-
             const decimal inverseMassMatrixLimit = mSliderJointComponents.mInverseMassMatrixLimit[i];
 
             // If the lower limit is violated
@@ -600,14 +621,20 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
             // Apply the impulse to the body 2
             v2 += inverseMassBody2 * linearImpulseBody2;
         }
+
+        // Store the velocities of the bodies
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody1, v1, w1);
+        mRigidBodyComponents.storeConstrainedVelocities(componentIndexBody2, v2, w2);
     }
 }
 
 // Solve the position constraint (for position error correction)
-void SolveSliderJointSystem::solvePositionConstraint() {
+void SolveSliderJointSystem::solvePositionConstraint(const List<uint32>& componentsIndices, uint32 startIndex, uint32 endIndex) {
 
     // For each joint component
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
 
@@ -625,7 +652,9 @@ void SolveSliderJointSystem::solvePositionConstraint() {
     }
 
     // For each joint component
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
 
@@ -646,7 +675,9 @@ void SolveSliderJointSystem::solvePositionConstraint() {
     }
 
     // For each joint component
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
 
@@ -771,7 +802,9 @@ void SolveSliderJointSystem::solvePositionConstraint() {
     }
 
     // For each joint component
-    for (uint32 i=0; i < mSliderJointComponents.getNbEnabledComponents(); i++) {
+    for (uint32 j=startIndex; j < endIndex; j++) {
+
+        const uint32 i = componentsIndices[j];
 
         const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
 
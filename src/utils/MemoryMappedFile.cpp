@@ -0,0 +1,150 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/utils/MemoryMappedFile.h>
+
+#if defined(WINDOWS_OS)   // For Windows platform
+   #define NOMINMAX       // This is used to avoid definition of max() and min() macros
+   #include <windows.h>
+#else                     // For Mac OS or Linux platform
+   #include <fcntl.h>
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+   #include <unistd.h>
+#endif
+
+using namespace reactphysics3d;
+
+// Constructor
+MemoryMappedFile::MemoryMappedFile()
+                 : mData(nullptr), mSize(0)
+#if defined(WINDOWS_OS)
+                 , mFileHandle(nullptr), mMappingHandle(nullptr)
+#endif
+{
+
+}
+
+// Constructor that maps a file
+/**
+ * @param filePath Path of the file to map (use isMapped() to know if it has been mapped)
+ */
+MemoryMappedFile::MemoryMappedFile(const std::string& filePath) : MemoryMappedFile() {
+    map(filePath);
+}
+
+// Destructor
+MemoryMappedFile::~MemoryMappedFile() {
+    unmap();
+}
+
+// Map a file into memory and return true if it has been mapped
+/**
+ * @param filePath Path of the file to map
+ * @return True if the file has been mapped into memory
+ */
+bool MemoryMappedFile::map(const std::string& filePath) {
+
+    unmap();
+
+#if defined(WINDOWS_OS)
+
+    HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        return false;
+    }
+
+    const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    mFileHandle = file;
+    mMappingHandle = mapping;
+    mData = data;
+    mSize = static_cast<size_t>(fileSize.QuadPart);
+
+#else
+
+    const int file = open(filePath.c_str(), O_RDONLY);
+    if (file < 0) return false;
+
+    struct stat fileStatus;
+    if (fstat(file, &fileStatus) != 0 || fileStatus.st_size == 0) {
+        close(file);
+        return false;
+    }
+
+    void* data = mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+    // The mapping remains valid after the file is closed
+    close(file);
+
+    if (data == MAP_FAILED) return false;
+
+    mData = data;
+    mSize = static_cast<size_t>(fileStatus.st_size);
+
+#endif
+
+    return true;
+}
+
+// Unmap the file
+void MemoryMappedFile::unmap() {
+
+    if (mData == nullptr) return;
+
+#if defined(WINDOWS_OS)
+
+    UnmapViewOfFile(mData);
+    CloseHandle(mMappingHandle);
+    CloseHandle(mFileHandle);
+    mFileHandle = nullptr;
+    mMappingHandle = nullptr;
+
+#else
+
+    munmap(const_cast<void*>(mData), mSize);
+
+#endif
+
+    mData = nullptr;
+    mSize = 0;
+}
@@ -39,11 +39,29 @@
 #include "tests/collision/TestDynamicAABBTree.h"
 #include "tests/collision/TestHalfEdgeStructure.h"
 #include "tests/collision/TestTriangleVertexArray.h"
+#include "tests/collision/TestSweepAndPruneBroadPhase.h"
+#include "tests/collision/TestStaticAABBTree.h"
+#include "tests/collision/TestMeshCooker.h"
+#include "tests/collision/TestPrimitiveNarrowPhase.h"
+#include "tests/collision/TestBoxVsBoxAlgorithm.h"
+#include "tests/collision/TestConvexMeshShape.h"
+#include "tests/collision/TestGJKAlgorithm.h"
+#include "tests/collision/TestSATAlgorithm.h"
+#include "tests/collision/TestRestingPairs.h"
 #include "tests/containers/TestList.h"
 #include "tests/containers/TestMap.h"
 #include "tests/containers/TestSet.h"
+#include "tests/containers/TestFlatMap.h"
+#include "tests/containers/TestFlatSet.h"
 #include "tests/containers/TestDeque.h"
 #include "tests/containers/TestStack.h"
+#include "tests/engine/TestConstraintGraphColoring.h"
+#include "tests/engine/TestLastFrameCollisionInfoPool.h"
+#include "tests/engine/TestTaskScheduler.h"
+#include "tests/engine/TestWideContactSolver.h"
+#include "tests/engine/TestIslands.h"
+#include "tests/memory/TestMemoryManager.h"
+#include "tests/components/TestEntityComponentIndexMap.h"
 
 using namespace reactphysics3d;
 
@@ -56,6 +74,8 @@ int main() {
     testSuite.addTest(new TestList("List"));
     testSuite.addTest(new TestMap("Map"));
     testSuite.addTest(new TestSet("Set"));
+    testSuite.addTest(new TestFlatMap("FlatMap"));
+    testSuite.addTest(new TestFlatSet("FlatSet"));
     testSuite.addTest(new TestDeque("Deque"));
     testSuite.addTest(new TestStack("Stack"));
 
@@ -77,7 +97,32 @@ int main() {
     testSuite.addTest(new TestRaycast("Raycasting"));
     testSuite.addTest(new TestCollisionWorld("CollisionWorld"));
     testSuite.addTest(new TestDynamicAABBTree("DynamicAABBTree"));
+    testSuite.addTest(new TestStaticAABBTree("StaticAABBTree"));
     testSuite.addTest(new TestHalfEdgeStructure("HalfEdgeStructure"));
+    testSuite.addTest(new TestSweepAndPruneBroadPhase("SweepAndPruneBroadPhase"));
+    testSuite.addTest(new TestMeshCooker("MeshCooker"));
+    testSuite.addTest(new TestPrimitiveNarrowPhase("PrimitiveNarrowPhase"));
+    testSuite.addTest(new TestBoxVsBoxAlgorithm("BoxVsBoxAlgorithm"));
+    testSuite.addTest(new TestConvexMeshShape("ConvexMeshShape"));
+    testSuite.addTest(new TestGJKAlgorithm("GJKAlgorithm"));
+    testSuite.addTest(new TestSATAlgorithm("SATAlgorithm"));
+    testSuite.addTest(new TestRestingPairs("RestingPairs"));
+
+    // ---------- Engine tests ---------- //
+
+    testSuite.addTest(new TestConstraintGraphColoring("ConstraintGraphColoring"));
+    testSuite.addTest(new TestLastFrameCollisionInfoPool("LastFrameCollisionInfoPool"));
+    testSuite.addTest(new TestTaskScheduler("TaskScheduler"));
+    testSuite.addTest(new TestWideContactSolver("WideContactSolver"));
+    testSuite.addTest(new TestIslands("Islands"));
+
+    // ---------- Memory tests ---------- //
+
+    testSuite.addTest(new TestMemoryManager("MemoryManager"));
+
+    // ---------- Components tests ---------- //
+
+    testSuite.addTest(new TestEntityComponentIndexMap("EntityComponentIndexMap"));
 
     // Run the tests
     testSuite.run();
@@ -0,0 +1,500 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_BOX_VS_BOX_ALGORITHM_H
+#define TEST_BOX_VS_BOX_ALGORITHM_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <cmath>
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class BoxContactsCollisionCallback
+/**
+ * Collision callback that records the contact points between two colliders.
+ * The contact points are converted so that the first collider is always the
+ * one given in the constructor.
+ */
+class BoxContactsCollisionCallback : public CollisionCallback {
+
+    public:
+
+        struct BoxContactPoint {
+
+            /// World contact point on the first collider
+            Vector3 worldPoint1;
+
+            /// World contact point on the second collider
+            Vector3 worldPoint2;
+
+            /// Local contact point on the first collider
+            Vector3 localPoint1;
+
+            /// Local contact point on the second collider
+            Vector3 localPoint2;
+
+            /// World normal (from the first collider toward the second one)
+            Vector3 normal;
+
+            decimal penetrationDepth;
+        };
+
+        Collider* mCollider1;
+
+        std::vector<BoxContactPoint> mContactPoints;
+
+        BoxContactsCollisionCallback(Collider* collider1) : mCollider1(collider1) {
+
+        }
+
+        virtual void onContact(const CallbackData& callbackData) override {
+
+            for (uint p=0; p < callbackData.getNbContactPairs(); p++) {
+
+                ContactPair contactPair = callbackData.getContactPair(p);
+                const bool isSwapped = contactPair.getCollider1() != mCollider1;
+                Collider* collider1 = isSwapped ? contactPair.getCollider2() : contactPair.getCollider1();
+                Collider* collider2 = isSwapped ? contactPair.getCollider1() : contactPair.getCollider2();
+
+                for (uint c=0; c < contactPair.getNbContactPoints(); c++) {
+
+                    ContactPoint contactPoint = contactPair.getContactPoint(c);
+
+                    BoxContactPoint point;
+                    point.localPoint1 = isSwapped ? contactPoint.getLocalPointOnCollider2() : contactPoint.getLocalPointOnCollider1();
+                    point.localPoint2 = isSwapped ? contactPoint.getLocalPointOnCollider1() : contactPoint.getLocalPointOnCollider2();
+                    point.worldPoint1 = collider1->getLocalToWorldTransform() * point.localPoint1;
+                    point.worldPoint2 = collider2->getLocalToWorldTransform() * point.localPoint2;
+                    point.normal = isSwapped ? -contactPoint.getWorldNormal() : contactPoint.getWorldNormal();
+                    point.penetrationDepth = contactPoint.getPenetrationDepth();
+                    mContactPoints.push_back(point);
+                }
+            }
+        }
+};
+
+// Class TestBoxVsBoxAlgorithm
+/**
+ * Unit test for the box vs box narrow-phase algorithm. The contacts are checked for
+ * face and edge contacts with known results. The collision status of many random poses
+ * is compared with a brute-force separating axis test and with the convex polyhedron vs
+ * convex polyhedron (SAT) algorithm by replacing the first box with a convex mesh of the
+ * same size.
+ */
+class TestBoxVsBoxAlgorithm : public Test {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Number of random poses compared with the SAT algorithm
+        static const int NB_RANDOM_POSES = 500;
+
+        /// Number of different sizes of boxes
+        static const int NB_BOX_SIZES = 3;
+
+        // ---------- Attributes ---------- //
+
+        PhysicsCommon mPhysicsCommon;
+
+        PhysicsWorld* mWorld;
+
+        BoxShape* mBoxShapes[NB_BOX_SIZES];
+
+        /// Convex meshes with the same sizes as the boxes
+        ConvexMeshShape* mConvexMeshShapes[NB_BOX_SIZES];
+        PolyhedronMesh* mPolyhedronMeshes[NB_BOX_SIZES];
+        PolygonVertexArray* mPolygonVertexArrays[NB_BOX_SIZES];
+        float mConvexMeshVertices[NB_BOX_SIZES][8 * 3];
+        int mConvexMeshIndices[24];
+        PolygonVertexArray::PolygonFace mConvexMeshFaces[6];
+
+        /// Seed of the pseudo-random numbers
+        uint32 mRandomSeed;
+
+        // ---------- Methods ---------- //
+
+        /// Return a pseudo-random number in the range [min, max]
+        decimal random(decimal min, decimal max) {
+            mRandomSeed = mRandomSeed * 1664525u + 1013904223u;
+            return min + (max - min) * decimal(mRandomSeed >> 8) / decimal(1 << 24);
+        }
+
+        /// Return the half-extents of the boxes of a given size
+        static Vector3 getHalfExtents(int sizeIndex) {
+            const Vector3 halfExtents[NB_BOX_SIZES] = {Vector3(1, 1, 1), Vector3(decimal(0.5), decimal(1.5), decimal(0.8)),
+                                                       Vector3(decimal(2.0), decimal(0.25), decimal(1.2))};
+            return halfExtents[sizeIndex];
+        }
+
+        /// Create a convex mesh with the same vertices as a box
+        void createConvexMesh(int sizeIndex) {
+
+            const Vector3 halfExtents = getHalfExtents(sizeIndex);
+            const decimal signs[8][3] = {{-1, -1, 1}, {1, -1, 1}, {1, -1, -1}, {-1, -1, -1},
+                                         {-1, 1, 1}, {1, 1, 1}, {1, 1, -1}, {-1, 1, -1}};
+            for (int v=0; v < 8; v++) {
+                for (int i=0; i < 3; i++) {
+                    mConvexMeshVertices[sizeIndex][v * 3 + i] = float(signs[v][i] * halfExtents[i]);
+                }
+            }
+
+            mPolygonVertexArrays[sizeIndex] = new PolygonVertexArray(8, &(mConvexMeshVertices[sizeIndex][0]), 3 * sizeof(float),
+                    &(mConvexMeshIndices[0]), sizeof(int), 6, mConvexMeshFaces,
+                    PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                    PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            mPolyhedronMeshes[sizeIndex] = mPhysicsCommon.createPolyhedronMesh(mPolygonVertexArrays[sizeIndex]);
+            mConvexMeshShapes[sizeIndex] = mPhysicsCommon.createConvexMeshShape(mPolyhedronMeshes[sizeIndex]);
+        }
+
+        /// Return a pseudo-random orientation
+        Quaternion randomOrientation() {
+            return Quaternion::fromEulerAngles(random(-PI, PI), random(-PI, PI), random(-PI, PI));
+        }
+
+        /// Test the contact points between two colliders and return them
+        std::vector<BoxContactsCollisionCallback::BoxContactPoint> computeContactPoints(Collider* collider1, Collider* collider2) {
+
+            BoxContactsCollisionCallback callback(collider1);
+            mWorld->testCollision(collider1->getBody(), collider2->getBody(), callback);
+            return callback.mContactPoints;
+        }
+
+        /// Compute the minimum penetration depth of two boxes over the 15 candidate separating axes by
+        /// projecting all their vertices onto the axes (negative if the boxes are separated)
+        static decimal computeReferencePenetrationDepth(const Vector3& halfExtents1, const Transform& transform1,
+                                                        const Vector3& halfExtents2, const Transform& transform2) {
+
+            Vector3 vertices1[8];
+            Vector3 vertices2[8];
+            for (int v=0; v < 8; v++) {
+                const Vector3 signs((v & 1) ? 1 : -1, (v & 2) ? 1 : -1, (v & 4) ? 1 : -1);
+                vertices1[v] = transform1 * Vector3(signs.x * halfExtents1.x, signs.y * halfExtents1.y, signs.z * halfExtents1.z);
+                vertices2[v] = transform2 * Vector3(signs.x * halfExtents2.x, signs.y * halfExtents2.y, signs.z * halfExtents2.z);
+            }
+
+            const Matrix3x3 rotation1 = transform1.getOrientation().getMatrix();
+            const Matrix3x3 rotation2 = transform2.getOrientation().getMatrix();
+            std::vector<Vector3> axes;
+            for (int i=0; i < 3; i++) {
+                axes.push_back(rotation1.getColumn(i));
+                axes.push_back(rotation2.getColumn(i));
+                for (int j=0; j < 3; j++) {
+                    const Vector3 axis = rotation1.getColumn(i).cross(rotation2.getColumn(j));
+                    if (axis.lengthSquare() > decimal(0.00001)) {
+                        axes.push_back(axis.getUnit());
+                    }
+                }
+            }
+
+            decimal minPenetrationDepth = DECIMAL_LARGEST;
+            for (uint a=0; a < axes.size(); a++) {
+                decimal min1 = DECIMAL_LARGEST, max1 = DECIMAL_SMALLEST, min2 = DECIMAL_LARGEST, max2 = DECIMAL_SMALLEST;
+                for (int v=0; v < 8; v++) {
+                    min1 = std::min(min1, vertices1[v].dot(axes[a]));
+                    max1 = std::max(max1, vertices1[v].dot(axes[a]));
+                    min2 = std::min(min2, vertices2[v].dot(axes[a]));
+                    max2 = std::max(max2, vertices2[v].dot(axes[a]));
+                }
+                minPenetrationDepth = std::min(minPenetrationDepth, std::min(max1 - min2, max2 - min1));
+            }
+
+            return minPenetrationDepth;
+        }
+
+        /// Return true if a local point is inside a box (with a tolerance)
+        static bool isPointInsideBox(const Vector3& localPoint, const Vector3& halfExtents) {
+            const decimal tolerance = decimal(0.001);
+            return std::abs(localPoint.x) <= halfExtents.x + tolerance && std::abs(localPoint.y) <= halfExtents.y + tolerance &&
+                   std::abs(localPoint.z) <= halfExtents.z + tolerance;
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestBoxVsBoxAlgorithm(const std::string& name) : Test(name), mRandomSeed(42) {
+
+            mWorld = mPhysicsCommon.createPhysicsWorld();
+
+            const int indices[24] = {0, 3, 2, 1, 4, 5, 6, 7, 0, 1, 5, 4, 1, 2, 6, 5, 2, 3, 7, 6, 0, 4, 7, 3};
+            for (int i=0; i < 24; i++) {
+                mConvexMeshIndices[i] = indices[i];
+            }
+            for (int f=0; f < 6; f++) {
+                mConvexMeshFaces[f].indexBase = f * 4;
+                mConvexMeshFaces[f].nbVertices = 4;
+            }
+
+            for (int i=0; i < NB_BOX_SIZES; i++) {
+                mBoxShapes[i] = mPhysicsCommon.createBoxShape(getHalfExtents(i));
+                createConvexMesh(i);
+            }
+        }
+
+        /// Destructor
+        virtual ~TestBoxVsBoxAlgorithm() {
+
+            mPhysicsCommon.destroyPhysicsWorld(mWorld);
+
+            for (int i=0; i < NB_BOX_SIZES; i++) {
+                mPhysicsCommon.destroyBoxShape(mBoxShapes[i]);
+                mPhysicsCommon.destroyConvexMeshShape(mConvexMeshShapes[i]);
+                mPhysicsCommon.destroyPolyhedronMesh(mPolyhedronMeshes[i]);
+                delete mPolygonVertexArrays[i];
+            }
+        }
+
+        /// Run the tests
+        void run() {
+
+            testFaceContact();
+            testEdgeContact();
+            testSeparatedBoxes();
+            testCompareWithConvexMesh();
+            testRestingBoxes();
+        }
+
+        /// Test a small box lying on the face of a larger box
+        void testFaceContact() {
+
+            CollisionBody* body1 = mWorld->createCollisionBody(Transform(Vector3(0, 0, 0), Quaternion::identity()));
+            Collider* collider1 = body1->addCollider(mBoxShapes[0], Transform::identity());
+            BoxShape* smallBox = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            CollisionBody* body2 = mWorld->createCollisionBody(Transform(Vector3(decimal(0.2), decimal(1.4), decimal(-0.1)),
+                                                                         Quaternion::fromEulerAngles(0, decimal(0.3), 0)));
+            Collider* collider2 = body2->addCollider(smallBox, Transform::identity());
+
+            rp3d_test(mWorld->testOverlap(body1, body2));
+
+            std::vector<BoxContactsCollisionCallback::BoxContactPoint> contactPoints = computeContactPoints(collider1, collider2);
+            rp3d_test(contactPoints.size() == 4);
+            for (uint i=0; i < contactPoints.size(); i++) {
+                rp3d_test(approxEqual(contactPoints[i].penetrationDepth, decimal(0.1), decimal(0.001)));
+                rp3d_test(approxEqual(contactPoints[i].normal, Vector3(0, 1, 0), decimal(0.001)));
+                rp3d_test(approxEqual(contactPoints[i].worldPoint1.y, decimal(1.0), decimal(0.001)));
+                rp3d_test(approxEqual(contactPoints[i].worldPoint2.y, decimal(0.9), decimal(0.001)));
+            }
+
+            // The same contact with the boxes in the opposite order
+            contactPoints = computeContactPoints(collider2, collider1);
+            rp3d_test(contactPoints.size() == 4);
+            for (uint i=0; i < contactPoints.size(); i++) {
+                rp3d_test(approxEqual(contactPoints[i].penetrationDepth, decimal(0.1), decimal(0.001)));
+                rp3d_test(approxEqual(contactPoints[i].normal, Vector3(0, -1, 0), decimal(0.001)));
+            }
+
+            mWorld->destroyCollisionBody(body1);
+            mWorld->destroyCollisionBody(body2);
+            mPhysicsCommon.destroyBoxShape(smallBox);
+        }
+
+        /// Test two boxes touching with two crossing edges
+        void testEdgeContact() {
+
+            const decimal sqrt2 = std::sqrt(decimal(2.0));
+
+            // The top of the first box is an edge along the z axis and the bottom of
+            // the second box is an edge along the x axis
+            CollisionBody* body1 = mWorld->createCollisionBody(Transform(Vector3(0, 0, 0), Quaternion::fromEulerAngles(0, 0, PI / decimal(4.0))));
+            Collider* collider1 = body1->addCollider(mBoxShapes[0], Transform::identity());
+            CollisionBody* body2 = mWorld->createCollisionBody(Transform(Vector3(0, decimal(2.0) * sqrt2 - decimal(0.1), 0),
+                                                                         Quaternion::fromEulerAngles(PI / decimal(4.0), 0, 0)));
+            Collider* collider2 = body2->addCollider(mBoxShapes[0], Transform::identity());
+
+            rp3d_test(mWorld->testOverlap(body1, body2));
+
+            std::vector<BoxContactsCollisionCallback::BoxContactPoint> contactPoints = computeContactPoints(collider1, collider2);
+            rp3d_test(contactPoints.size() == 1);
+            if (contactPoints.size() == 1) {
+                rp3d_test(approxEqual(contactPoints[0].penetrationDepth, decimal(0.1), decimal(0.001)));
+                rp3d_test(approxEqual(contactPoints[0].normal, Vector3(0, 1, 0), decimal(0.001)));
+                rp3d_test(approxEqual(contactPoints[0].worldPoint1, Vector3(0, sqrt2, 0), decimal(0.001)));
+                rp3d_test(approxEqual(contactPoints[0].worldPoint2, Vector3(0, sqrt2 - decimal(0.1), 0), decimal(0.001)));
+            }
+
+            // Move the second box up so that the edges do not touch anymore
+            body2->setTransform(Transform(Vector3(0, decimal(2.0) * sqrt2 + decimal(0.1), 0), Quaternion::fromEulerAngles(PI / decimal(4.0), 0, 0)));
+            rp3d_test(!mWorld->testOverlap(body1, body2));
+            rp3d_test(computeContactPoints(collider1, collider2).size() == 0);
+
+            mWorld->destroyCollisionBody(body1);
+            mWorld->destroyCollisionBody(body2);
+        }
+
+        /// Test two boxes that are only separated along an edge-edge axis
+        void testSeparatedBoxes() {
+
+            const decimal sqrt2 = std::sqrt(decimal(2.0));
+
+            // The two boxes overlap along all the face normals but not along
+            // the cross product of their closest edges
+            CollisionBody* body1 = mWorld->createCollisionBody(Transform(Vector3(0, 0, 0), Quaternion::fromEulerAngles(0, 0, PI / decimal(4.0))));
+            Collider* collider1 = body1->addCollider(mBoxShapes[0], Transform::identity());
+            CollisionBody* body2 = mWorld->createCollisionBody(Transform(Vector3(0, decimal(2.0) * sqrt2 + decimal(0.01), 0),
+                                                                         Quaternion::fromEulerAngles(PI / decimal(4.0), 0, 0)));
+            Collider* collider2 = body2->addCollider(mBoxShapes[0], Transform::identity());
+
+            rp3d_test(!mWorld->testOverlap(body1, body2));
+            rp3d_test(computeContactPoints(collider1, collider2).size() == 0);
+
+            mWorld->destroyCollisionBody(body1);
+            mWorld->destroyCollisionBody(body2);
+        }
+
+        /// Compare the collisions between boxes with the collisions between a convex mesh and a box in random poses
+        void testCompareWithConvexMesh() {
+
+            CollisionBody* boxBody1 = mWorld->createCollisionBody(Transform::identity());
+            CollisionBody* boxBody2 = mWorld->createCollisionBody(Transform::identity());
+
+            // The convex mesh body is far from the boxes so that they never collide with each other
+            const Vector3 meshOffset(100, 0, 0);
+            CollisionBody* meshBody1 = mWorld->createCollisionBody(Transform::identity());
+            CollisionBody* meshBody2 = mWorld->createCollisionBody(Transform::identity());
+
+            int nbCollidingPoses = 0;
+            for (int i=0; i < NB_RANDOM_POSES; i++) {
+
+                const int size1 = i % NB_BOX_SIZES;
+                const int size2 = (i / NB_BOX_SIZES) % NB_BOX_SIZES;
+                const Vector3 halfExtents1 = getHalfExtents(size1);
+                const Vector3 halfExtents2 = getHalfExtents(size2);
+
+                Collider* boxCollider1 = boxBody1->addCollider(mBoxShapes[size1], Transform::identity());
+                Collider* boxCollider2 = boxBody2->addCollider(mBoxShapes[size2], Transform::identity());
+                Collider* meshCollider1 = meshBody1->addCollider(mConvexMeshShapes[size1], Transform::identity());
+                Collider* meshCollider2 = meshBody2->addCollider(mBoxShapes[size2], Transform::identity());
+
+                // The distance between the centers is in the range where the boxes may or may not collide
+                const decimal maxDistance = halfExtents1.length() + halfExtents2.length();
+                const Vector3 direction = Vector3(random(-1, 1), random(-1, 1), random(-1, 1)) + Vector3(decimal(0.01), 0, 0);
+                const Vector3 position2 = direction.getUnit() * random(decimal(0.2), decimal(1.0)) * maxDistance;
+                const Quaternion orientation1 = randomOrientation();
+                const Quaternion orientation2 = randomOrientation();
+
+                boxBody1->setTransform(Transform(Vector3(0, 0, 0), orientation1));
+                boxBody2->setTransform(Transform(position2, orientation2));
+                meshBody1->setTransform(Transform(meshOffset, orientation1));
+                meshBody2->setTransform(Transform(meshOffset + position2, orientation2));
+
+                const bool isBoxOverlap = mWorld->testOverlap(boxBody1, boxBody2);
+                const bool isMeshOverlap = mWorld->testOverlap(meshBody1, meshBody2);
+                const decimal referencePenetrationDepth = computeReferencePenetrationDepth(halfExtents1, boxBody1->getTransform(),
+                                                                                           halfExtents2, boxBody2->getTransform());
+
+                // The SAT algorithm can miss an edge-edge collision (when the face used to clip the shapes does not
+                // give any contact point) but it never reports a collision between separated shapes
+                if (std::abs(referencePenetrationDepth) > decimal(0.001)) {
+                    rp3d_test(isBoxOverlap == (referencePenetrationDepth > decimal(0.0)));
+                    rp3d_test(!isMeshOverlap || isBoxOverlap);
+                }
+
+                std::vector<BoxContactsCollisionCallback::BoxContactPoint> boxContactPoints = computeContactPoints(boxCollider1, boxCollider2);
+                rp3d_test(isBoxOverlap == (boxContactPoints.size() > 0));
+
+                if (isBoxOverlap) {
+
+                    nbCollidingPoses++;
+
+                    // The contact points must be on the boxes and they must be separated by the penetration depth along the normal
+                    decimal maxBoxPenetrationDepth = 0;
+                    for (uint c=0; c < boxContactPoints.size(); c++) {
+
+                        const BoxContactsCollisionCallback::BoxContactPoint& point = boxContactPoints[c];
+                        rp3d_test(point.penetrationDepth > decimal(0.0));
+                        rp3d_test(approxEqual(point.normal.length(), decimal(1.0), decimal(0.001)));
+                        rp3d_test(isPointInsideBox(point.localPoint1, halfExtents1));
+                        rp3d_test(isPointInsideBox(point.localPoint2, halfExtents2));
+                        rp3d_test(approxEqual(point.worldPoint1 - point.worldPoint2, point.normal * point.penetrationDepth, decimal(0.001)));
+                        maxBoxPenetrationDepth = std::max(maxBoxPenetrationDepth, point.penetrationDepth);
+                    }
+
+                    // The contact points are computed along an axis whose penetration depth is at most a bit
+                    // larger than the minimum one (because the face axes are preferred)
+                    rp3d_test(maxBoxPenetrationDepth <= referencePenetrationDepth * decimal(1.002) + decimal(0.0015));
+                }
+
+                boxBody1->removeCollider(boxCollider1);
+                boxBody2->removeCollider(boxCollider2);
+                meshBody1->removeCollider(meshCollider1);
+                meshBody2->removeCollider(meshCollider2);
+            }
+
+            // Make sure that the random poses test both colliding and separated boxes
+            rp3d_test(nbCollidingPoses > NB_RANDOM_POSES / 5);
+            rp3d_test(nbCollidingPoses < NB_RANDOM_POSES * 4 / 5);
+
+            mWorld->destroyCollisionBody(boxBody1);
+            mWorld->destroyCollisionBody(boxBody2);
+            mWorld->destroyCollisionBody(meshBody1);
+            mWorld->destroyCollisionBody(meshBody2);
+        }
+
+        /// Test that a stack of boxes comes to rest on a static box
+        void testRestingBoxes() {
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+
+            BoxShape* groundShape = mPhysicsCommon.createBoxShape(Vector3(10, decimal(0.5), 10));
+            RigidBody* ground = world->createRigidBody(Transform(Vector3(0, decimal(-0.5), 0), Quaternion::identity()));
+            ground->setType(BodyType::STATIC);
+            ground->addCollider(groundShape, Transform::identity());
+
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            const int nbBoxes = 3;
+            RigidBody* boxes[nbBoxes];
+            for (int i=0; i < nbBoxes; i++) {
+                boxes[i] = world->createRigidBody(Transform(Vector3(0, decimal(0.6) + decimal(1.1) * i, 0),
+                                                            Quaternion::fromEulerAngles(0, decimal(0.2) * i, 0)));
+                boxes[i]->addCollider(boxShape, Transform::identity());
+            }
+
+            for (int step=0; step < 180; step++) {
+                world->update(decimal(1.0 / 60.0));
+            }
+
+            for (int i=0; i < nbBoxes; i++) {
+                const Transform& transform = boxes[i]->getTransform();
+                rp3d_test(approxEqual(transform.getPosition().y, decimal(0.5) + i, decimal(0.05)));
+                rp3d_test(std::abs(transform.getPosition().x) < decimal(0.05));
+                rp3d_test(std::abs(transform.getPosition().z) < decimal(0.05));
+                rp3d_test(boxes[i]->getLinearVelocity().length() < decimal(0.05));
+            }
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyBoxShape(groundShape);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+        }
+};
+
+}
+
+#endif
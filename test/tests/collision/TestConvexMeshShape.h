@@ -0,0 +1,327 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_CONVEX_MESH_SHAPE_H
+#define TEST_CONVEX_MESH_SHAPE_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestConvexMeshShape
+/**
+ * Unit test for the support points of the ConvexMeshShape class. The support vertices
+ * found with hill-climbing (large mesh) or with a linear scan (small mesh) are compared
+ * with the vertex with the largest dot product found by testing all the vertices.
+ */
+class TestConvexMeshShape : public Test {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Number of rings of vertices (without the poles) of the sphere mesh
+        static const int NB_RINGS = 8;
+
+        /// Number of vertices in each ring of the sphere mesh
+        static const int NB_SEGMENTS = 16;
+
+        /// Number of vertices of the sphere mesh
+        static const int NB_SPHERE_VERTICES = NB_RINGS * NB_SEGMENTS + 2;
+
+        /// Number of faces of the sphere mesh
+        static const int NB_SPHERE_FACES = (NB_RINGS + 1) * NB_SEGMENTS;
+
+        /// Number of random support directions tested
+        static const int NB_DIRECTIONS = 500;
+
+        // ---------- Attributes ---------- //
+
+        PhysicsCommon mPhysicsCommon;
+
+        /// Sphere mesh (with more vertices than CONVEX_MESH_HILL_CLIMBING_MIN_NB_VERTICES)
+        float mSphereVertices[NB_SPHERE_VERTICES * 3];
+        std::vector<int> mSphereIndices;
+        PolygonVertexArray::PolygonFace mSphereFaces[NB_SPHERE_FACES];
+        PolygonVertexArray* mSpherePolygonVertexArray;
+        PolyhedronMesh* mSpherePolyhedronMesh;
+        ConvexMeshShape* mSphereMeshShape;
+        ConvexMeshShape* mScaledSphereMeshShape;
+
+        /// Cube mesh (with less vertices than CONVEX_MESH_HILL_CLIMBING_MIN_NB_VERTICES)
+        float mCubeVertices[8 * 3];
+        int mCubeIndices[24];
+        PolygonVertexArray::PolygonFace mCubeFaces[6];
+        PolygonVertexArray* mCubePolygonVertexArray;
+        PolyhedronMesh* mCubePolyhedronMesh;
+        ConvexMeshShape* mCubeMeshShape;
+
+        /// Seed of the pseudo-random numbers
+        uint32 mRandomSeed;
+
+        // ---------- Methods ---------- //
+
+        /// Return a pseudo-random number in the range [min, max]
+        decimal random(decimal min, decimal max) {
+            mRandomSeed = mRandomSeed * 1664525u + 1013904223u;
+            return min + (max - min) * decimal(mRandomSeed >> 8) / decimal(1 << 24);
+        }
+
+        /// Return a pseudo-random direction
+        Vector3 randomDirection() {
+            return Vector3(random(-1, 1), random(-1, 1), random(-1, 1)) + Vector3(0, 0, decimal(0.001));
+        }
+
+        /// Create a sphere mesh of radius 1 made of rings of vertices
+        void createSphereMesh() {
+
+            // Vertices (the two poles are the last vertices)
+            for (int r=0; r < NB_RINGS; r++) {
+                const decimal latitude = PI * decimal(r + 1) / decimal(NB_RINGS + 1);
+                for (int s=0; s < NB_SEGMENTS; s++) {
+                    const decimal longitude = PI_TIMES_2 * decimal(s) / decimal(NB_SEGMENTS);
+                    float* vertex = &(mSphereVertices[(r * NB_SEGMENTS + s) * 3]);
+                    vertex[0] = float(std::sin(latitude) * std::cos(longitude));
+                    vertex[1] = float(std::cos(latitude));
+                    vertex[2] = float(std::sin(latitude) * std::sin(longitude));
+                }
+            }
+            const int topPole = NB_RINGS * NB_SEGMENTS;
+            const int bottomPole = topPole + 1;
+            mSphereVertices[topPole * 3] = 0; mSphereVertices[topPole * 3 + 1] = 1; mSphereVertices[topPole * 3 + 2] = 0;
+            mSphereVertices[bottomPole * 3] = 0; mSphereVertices[bottomPole * 3 + 1] = -1; mSphereVertices[bottomPole * 3 + 2] = 0;
+
+            // Faces (counter clockwise when seen from outside the sphere)
+            int face = 0;
+            for (int s=0; s < NB_SEGMENTS; s++) {
+                const int nextS = (s + 1) % NB_SEGMENTS;
+                addSphereFace(face++, {topPole, nextS, s});
+                addSphereFace(face++, {bottomPole, (NB_RINGS - 1) * NB_SEGMENTS + s, (NB_RINGS - 1) * NB_SEGMENTS + nextS});
+                for (int r=0; r < NB_RINGS - 1; r++) {
+                    addSphereFace(face++, {r * NB_SEGMENTS + s, r * NB_SEGMENTS + nextS,
+                                           (r + 1) * NB_SEGMENTS + nextS, (r + 1) * NB_SEGMENTS + s});
+                }
+            }
+            assert(face == NB_SPHERE_FACES);
+
+            mSpherePolygonVertexArray = new PolygonVertexArray(NB_SPHERE_VERTICES, mSphereVertices, 3 * sizeof(float),
+                    mSphereIndices.data(), sizeof(int), NB_SPHERE_FACES, mSphereFaces,
+                    PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                    PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            mSpherePolyhedronMesh = mPhysicsCommon.createPolyhedronMesh(mSpherePolygonVertexArray);
+            mSphereMeshShape = mPhysicsCommon.createConvexMeshShape(mSpherePolyhedronMesh);
+            mScaledSphereMeshShape = mPhysicsCommon.createConvexMeshShape(mSpherePolyhedronMesh,
+                                                                          Vector3(decimal(3.0), decimal(0.5), decimal(1.5)));
+        }
+
+        /// Add a face to the sphere mesh
+        void addSphereFace(int faceIndex, const std::vector<int>& vertices) {
+            mSphereFaces[faceIndex].indexBase = uint(mSphereIndices.size());
+            mSphereFaces[faceIndex].nbVertices = uint(vertices.size());
+            mSphereIndices.insert(mSphereIndices.end(), vertices.begin(), vertices.end());
+        }
+
+        /// Create a cube mesh of half-extent 1
+        void createCubeMesh() {
+
+            const float signs[8][3] = {{-1, -1, 1}, {1, -1, 1}, {1, -1, -1}, {-1, -1, -1},
+                                       {-1, 1, 1}, {1, 1, 1}, {1, 1, -1}, {-1, 1, -1}};
+            for (int v=0; v < 8; v++) {
+                for (int i=0; i < 3; i++) {
+                    mCubeVertices[v * 3 + i] = signs[v][i];
+                }
+            }
+            const int indices[24] = {0, 3, 2, 1, 4, 5, 6, 7, 0, 1, 5, 4, 1, 2, 6, 5, 2, 3, 7, 6, 0, 4, 7, 3};
+            for (int i=0; i < 24; i++) {
+                mCubeIndices[i] = indices[i];
+            }
+            for (int f=0; f < 6; f++) {
+                mCubeFaces[f].indexBase = f * 4;
+                mCubeFaces[f].nbVertices = 4;
+            }
+
+            mCubePolygonVertexArray = new PolygonVertexArray(8, mCubeVertices, 3 * sizeof(float),
+                    mCubeIndices, sizeof(int), 6, mCubeFaces,
+                    PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                    PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            mCubePolyhedronMesh = mPhysicsCommon.createPolyhedronMesh(mCubePolygonVertexArray);
+            mCubeMeshShape = mPhysicsCommon.createConvexMeshShape(mCubePolyhedronMesh);
+        }
+
+        /// Return the largest dot product of a vertex of a mesh with a direction
+        static decimal computeMaxDotProduct(const ConvexMeshShape* shape, const Vector3& direction) {
+
+            decimal maxDotProduct = DECIMAL_SMALLEST;
+            for (uint v=0; v < shape->getNbVertices(); v++) {
+                maxDotProduct = std::max(maxDotProduct, direction.dot(shape->getVertexPosition(v)));
+            }
+            return maxDotProduct;
+        }
+
+        /// Return true if a vertex of a mesh has the largest dot product with a direction
+        static bool isSupportVertex(const ConvexMeshShape* shape, const Vector3& direction, uint vertexIndex) {
+
+            if (vertexIndex >= shape->getNbVertices()) return false;
+
+            const decimal dotProduct = direction.dot(shape->getVertexPosition(vertexIndex));
+            return approxEqual(dotProduct, computeMaxDotProduct(shape, direction), decimal(0.0001));
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestConvexMeshShape(const std::string& name) : Test(name), mRandomSeed(7) {
+
+            createSphereMesh();
+            createCubeMesh();
+        }
+
+        /// Destructor
+        virtual ~TestConvexMeshShape() {
+
+            mPhysicsCommon.destroyConvexMeshShape(mSphereMeshShape);
+            mPhysicsCommon.destroyConvexMeshShape(mScaledSphereMeshShape);
+            mPhysicsCommon.destroyConvexMeshShape(mCubeMeshShape);
+            mPhysicsCommon.destroyPolyhedronMesh(mSpherePolyhedronMesh);
+            mPhysicsCommon.destroyPolyhedronMesh(mCubePolyhedronMesh);
+            delete mSpherePolygonVertexArray;
+            delete mCubePolygonVertexArray;
+        }
+
+        /// Run the tests
+        void run() {
+
+            testHillClimbing();
+            testHillClimbingCoherence();
+            testLinearScan();
+            testCollisionWithSphere();
+        }
+
+        /// Test the support vertices of the sphere mesh found with hill-climbing from random vertices
+        void testHillClimbing() {
+
+            rp3d_test(mSphereMeshShape->getNbVertices() >= CONVEX_MESH_HILL_CLIMBING_MIN_NB_VERTICES);
+            rp3d_test(mSpherePolyhedronMesh->isHillClimbingEnabled());
+
+            // Support vertices of the poles
+            rp3d_test(mSphereMeshShape->getSupportVertexIndex(Vector3(0, 1, 0), 0) == uint(NB_RINGS * NB_SEGMENTS));
+            rp3d_test(mSphereMeshShape->getSupportVertexIndex(Vector3(0, -1, 0), 0) == uint(NB_RINGS * NB_SEGMENTS + 1));
+
+            for (int i=0; i < NB_DIRECTIONS; i++) {
+
+                const Vector3 direction = randomDirection();
+                const uint startVertex = uint(random(0, NB_SPHERE_VERTICES - 1));
+
+                rp3d_test(isSupportVertex(mSphereMeshShape, direction, mSphereMeshShape->getSupportVertexIndex(direction, startVertex)));
+
+                // The support vertex of a scaled mesh is not the scaled support vertex of the mesh
+                rp3d_test(isSupportVertex(mScaledSphereMeshShape, direction, mScaledSphereMeshShape->getSupportVertexIndex(direction, startVertex)));
+            }
+
+            // A start vertex that is not in the mesh is ignored
+            rp3d_test(isSupportVertex(mSphereMeshShape, Vector3(1, 2, 3), mSphereMeshShape->getSupportVertexIndex(Vector3(1, 2, 3), 100000)));
+        }
+
+        /// Test the support vertices found with hill-climbing from the previous support vertex
+        /// with a slowly rotating direction (as during the simulation)
+        void testHillClimbingCoherence() {
+
+            uint supportVertex = 0;
+            for (int i=0; i < NB_DIRECTIONS; i++) {
+
+                const decimal angle = decimal(i) * decimal(0.05);
+                const Vector3 direction(std::cos(angle), std::sin(decimal(0.3) * angle), std::sin(angle));
+
+                supportVertex = mScaledSphereMeshShape->getSupportVertexIndex(direction, supportVertex);
+                rp3d_test(isSupportVertex(mScaledSphereMeshShape, direction, supportVertex));
+            }
+        }
+
+        /// Test the support vertices of the cube mesh found with a linear scan
+        void testLinearScan() {
+
+            rp3d_test(mCubeMeshShape->getNbVertices() < CONVEX_MESH_HILL_CLIMBING_MIN_NB_VERTICES);
+
+            for (int i=0; i < NB_DIRECTIONS; i++) {
+
+                const Vector3 direction = randomDirection();
+                rp3d_test(isSupportVertex(mCubeMeshShape, direction, mCubeMeshShape->getSupportVertexIndex(direction, 0)));
+            }
+
+            // With several support vertices, the one with the smallest index is returned
+            rp3d_test(mCubeMeshShape->getSupportVertexIndex(Vector3(1, 0, 0), 7) == 1);
+            rp3d_test(mCubeMeshShape->getSupportVertexIndex(Vector3(0, 1, 0), 0) == 4);
+            rp3d_test(mCubeMeshShape->getSupportVertexIndex(Vector3(0, 0, -1), 0) == 2);
+        }
+
+        /// Test the collision between the sphere mesh and a sphere (GJK algorithm)
+        void testCollisionWithSphere() {
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.5));
+
+            RigidBody* meshBody = world->createRigidBody(Transform::identity());
+            meshBody->addCollider(mSphereMeshShape, Transform::identity());
+            RigidBody* sphereBody = world->createRigidBody(Transform::identity());
+            sphereBody->addCollider(sphereShape, Transform::identity());
+
+            // Sphere above the top pole of the mesh
+            const decimal offsets[4] = {decimal(-0.02), decimal(0.02), decimal(-0.01), decimal(0.01)};
+            for (int i=0; i < 4; i++) {
+                sphereBody->setTransform(Transform(Vector3(0, decimal(1.5) + offsets[i], 0), Quaternion::identity()));
+                rp3d_test(world->testOverlap(meshBody, sphereBody) == (offsets[i] < 0));
+            }
+
+            // Sphere moving around the mesh (slightly overlapping a support vertex and then
+            // slightly outside the support plane of the mesh)
+            for (int i=0; i < 100; i++) {
+
+                const decimal angle = decimal(i) * PI_TIMES_2 / decimal(100);
+                const Vector3 direction(std::cos(angle), decimal(0.2), std::sin(angle));
+                const Vector3 supportVertex = mSphereMeshShape->getVertexPosition(mSphereMeshShape->getSupportVertexIndex(direction, 0));
+                sphereBody->setTransform(Transform(supportVertex + direction.getUnit() * decimal(0.49), Quaternion::identity()));
+                rp3d_test(world->testOverlap(meshBody, sphereBody));
+
+                const decimal distance = computeMaxDotProduct(mSphereMeshShape, direction.getUnit()) + decimal(0.51);
+                sphereBody->setTransform(Transform(direction.getUnit() * distance, Quaternion::identity()));
+                rp3d_test(!world->testOverlap(meshBody, sphereBody));
+            }
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+        }
+};
+
+}
+
+#endif
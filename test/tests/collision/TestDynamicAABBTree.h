@@ -29,9 +29,12 @@
 // Libraries
 #include "Test.h"
 #include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/collision/broadphase/DynamicAABBTreeBroadPhase.h>
+#include <reactphysics3d/reactphysics3d.h>
 #include <reactphysics3d/memory/MemoryManager.h>
 #include <reactphysics3d/engine/PhysicsCommon.h>
 #include <reactphysics3d/utils/Profiler.h>
+#include <set>
 #include <vector>
 
 /// Reactphysics3D namespace
@@ -136,6 +139,9 @@ class TestDynamicAABBTree : public Test {
             testBasicsMethods();
             testOverlapping();
             testRaycast();
+            testStaticObjects();
+            testRebuildAndOptimize();
+            testWorldBroadPhaseRebuild();
 
         }
 
@@ -560,6 +566,284 @@ class TestDynamicAABBTree : public Test {
             rp3d_test(mRaycastCallback.isHit(object4Id));
 
         }
+
+        void testStaticObjects() {
+
+            // ---------- Broad-phase with static objects ---------- //
+
+            DynamicAABBTreeBroadPhase broadPhase(mAllocator, decimal(0.0));
+            int data1 = 1, data2 = 2, data3 = 3, data4 = 4;
+
+            // Two overlapping static objects and two overlapping non-static objects on top of them
+            const int32 static1Id = broadPhase.addObject(AABB(Vector3(-10, -1, -10), Vector3(0, 0, 10)), &data1, true);
+            const int32 static2Id = broadPhase.addObject(AABB(Vector3(-1, -1, -10), Vector3(10, 0, 10)), &data2, true);
+            const int32 dynamic1Id = broadPhase.addObject(AABB(Vector3(-2, -0.5, 0), Vector3(-1.5, 1, 1)), &data3, false);
+            const int32 dynamic2Id = broadPhase.addObject(AABB(Vector3(-1.8, -0.5, 0), Vector3(2, 1, 1)), &data4, false);
+
+            rp3d_test(static1Id != static2Id && static1Id != dynamic1Id && static1Id != dynamic2Id);
+            rp3d_test(static2Id != dynamic1Id && static2Id != dynamic2Id && dynamic1Id != dynamic2Id);
+            rp3d_test(broadPhase.getObjectData(static1Id) == &data1);
+            rp3d_test(broadPhase.getObjectData(static2Id) == &data2);
+            rp3d_test(broadPhase.getObjectData(dynamic1Id) == &data3);
+            rp3d_test(broadPhase.getObjectData(dynamic2Id) == &data4);
+            rp3d_test(broadPhase.getFatAABB(static2Id).getMin() == Vector3(-1, -1, -10));
+            rp3d_test(broadPhase.getFatAABB(dynamic2Id).getMax() == Vector3(2, 1, 1));
+
+            // All the objects are tested but the two static objects are not reported together
+            List<int32> objectsToTest(mAllocator);
+            objectsToTest.add(static1Id);
+            objectsToTest.add(dynamic1Id);
+            objectsToTest.add(static2Id);
+            objectsToTest.add(dynamic2Id);
+            List<Pair<int32, int32>> overlappingPairs(mAllocator);
+            broadPhase.reportAllShapesOverlappingWithShapes(objectsToTest, overlappingPairs);
+
+            std::set<std::pair<int32, int32>> pairs;
+            for (uint32 i=0; i < overlappingPairs.size(); i++) {
+                if (overlappingPairs[i].first != overlappingPairs[i].second) {
+                    pairs.insert(std::make_pair(std::min(overlappingPairs[i].first, overlappingPairs[i].second),
+                                                std::max(overlappingPairs[i].first, overlappingPairs[i].second)));
+                }
+            }
+            rp3d_test(pairs.size() == 4);
+            rp3d_test(pairs.count(std::make_pair(std::min(static1Id, dynamic1Id), std::max(static1Id, dynamic1Id))) == 1);
+            rp3d_test(pairs.count(std::make_pair(std::min(static1Id, dynamic2Id), std::max(static1Id, dynamic2Id))) == 1);
+            rp3d_test(pairs.count(std::make_pair(std::min(static2Id, dynamic2Id), std::max(static2Id, dynamic2Id))) == 1);
+            rp3d_test(pairs.count(std::make_pair(std::min(dynamic1Id, dynamic2Id), std::max(dynamic1Id, dynamic2Id))) == 1);
+
+            // A static object that has moved is still tested against the non-static objects
+            rp3d_test(broadPhase.updateObject(static2Id, AABB(Vector3(-3, -1, -10), Vector3(-1.7, 0, 10)), false, Vector3::zero()));
+            objectsToTest.clear();
+            objectsToTest.add(static2Id);
+            overlappingPairs.clear();
+            broadPhase.reportAllShapesOverlappingWithShapes(objectsToTest, overlappingPairs);
+            rp3d_test(overlappingPairs.size() == 2);
+
+            // ---------- Body that becomes static ---------- //
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            BoxShape* groundShape = mPhysicsCommon.createBoxShape(Vector3(10, 1, 10));
+
+            // The type of the ground is set after its collider has been added
+            RigidBody* ground = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            ground->addCollider(groundShape, Transform::identity());
+            ground->setType(BodyType::STATIC);
+
+            RigidBody* box = world->createRigidBody(Transform(Vector3(0, 1, 0), Quaternion::identity()));
+            box->addCollider(boxShape, Transform::identity());
+
+            for (int i=0; i < 60; i++) {
+                world->update(decimal(1.0) / decimal(60.0));
+            }
+            rp3d_test(box->getTransform().getPosition().y > decimal(0.4));
+            rp3d_test(world->testOverlap(box, ground));
+
+            // The box becomes static and then dynamic again
+            box->setType(BodyType::STATIC);
+            world->update(decimal(1.0) / decimal(60.0));
+            box->setType(BodyType::DYNAMIC);
+            for (int i=0; i < 60; i++) {
+                world->update(decimal(1.0) / decimal(60.0));
+            }
+            rp3d_test(box->getTransform().getPosition().y > decimal(0.4));
+            rp3d_test(world->testOverlap(box, ground));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+            mPhysicsCommon.destroyBoxShape(groundShape);
+        }
+        /// Return true if the leaves of the tree overlapping with AABBs are the same as with a brute-force test
+        bool testQueries(const DynamicAABBTree& tree, const std::vector<int32>& nodes, const std::vector<AABB>& aabbs) {
+
+            for (size_t i=0; i < aabbs.size(); i += 7) {
+
+                List<int32> overlappingNodes(mAllocator);
+                tree.reportAllShapesOverlappingWithAABB(aabbs[i], overlappingNodes);
+
+                std::set<int32> expectedNodes;
+                for (size_t j=0; j < nodes.size(); j++) {
+                    if (aabbs[i].testCollision(tree.getFatAABB(nodes[j]))) {
+                        expectedNodes.insert(nodes[j]);
+                    }
+                }
+
+                std::set<int32> foundNodes(overlappingNodes.begin(), overlappingNodes.end());
+                if (foundNodes != expectedNodes || overlappingNodes.size() != expectedNodes.size()) return false;
+            }
+
+            return true;
+        }
+
+        void testRebuildAndOptimize() {
+
+            DynamicAABBTree tree(mAllocator);
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+            tree.setProfiler(mProfiler);
+#endif
+
+            // An empty tree and a tree with a single object do not have any internal node
+            rp3d_test(tree.computeSAHCost() == decimal(0.0));
+            tree.rebuild();
+            tree.optimize(10);
+            int data = 0;
+            const int32 singleNodeId = tree.addObject(AABB(Vector3(0, 0, 0), Vector3(1, 1, 1)), &data);
+            tree.rebuild();
+            tree.optimize(10);
+            rp3d_test(tree.computeSAHCost() == decimal(0.0));
+            rp3d_test(tree.getNodeDataPointer(singleNodeId) == &data);
+            tree.removeObject(singleNodeId);
+
+            // Objects at random positions
+            const int nbObjects = 1000;
+            std::vector<int> objectsData(nbObjects);
+            std::vector<int32> nodes;
+            std::vector<AABB> aabbs;
+            uint32 seed = 12345;
+            auto random = [&seed]() {
+                seed = seed * 1664525u + 1013904223u;
+                return decimal(seed >> 8) / decimal(1 << 24);
+            };
+            for (int i=0; i < nbObjects; i++) {
+                objectsData[i] = i;
+                const Vector3 center(random() * 100, random() * 10, random() * 100);
+                const Vector3 halfExtents(random() + decimal(0.1), random() + decimal(0.1), random() + decimal(0.1));
+                aabbs.push_back(AABB(center - halfExtents, center + halfExtents));
+                nodes.push_back(tree.addObject(aabbs[i], &objectsData[i]));
+            }
+
+            // Move the objects to degrade the tree
+            for (int k=0; k < 5; k++) {
+                for (int i=0; i < nbObjects; i++) {
+                    const Vector3 center(random() * 100, random() * 10, random() * 100);
+                    const Vector3 halfExtents = aabbs[i].getExtent() * decimal(0.5);
+                    aabbs[i] = AABB(center - halfExtents, center + halfExtents);
+                    tree.updateObject(nodes[i], aabbs[i]);
+                }
+            }
+            rp3d_test(testQueries(tree, nodes, aabbs));
+
+            // The optimization does not increase the cost of the tree
+            const decimal initialCost = tree.computeSAHCost();
+            rp3d_test(initialCost > decimal(1.0));
+            tree.optimize(100);
+            const decimal optimizedCost = tree.computeSAHCost();
+            rp3d_test(optimizedCost <= initialCost);
+            for (int k=0; k < 10; k++) {
+                tree.optimize(nbObjects);
+            }
+            rp3d_test(tree.computeSAHCost() <= optimizedCost);
+            rp3d_test(testQueries(tree, nodes, aabbs));
+
+            // The rebuilt tree is better than the tree built by insertions and keeps the IDs of the objects
+            tree.rebuild();
+            const decimal rebuiltCost = tree.computeSAHCost();
+            rp3d_test(rebuiltCost < initialCost);
+            rp3d_test(testQueries(tree, nodes, aabbs));
+            for (int i=0; i < nbObjects; i++) {
+                rp3d_test(*(int*)(tree.getNodeDataPointer(nodes[i])) == objectsData[i]);
+            }
+
+            // The tree can still be modified after a rebuild
+            for (int i=0; i < nbObjects; i += 2) {
+                tree.removeObject(nodes[i]);
+            }
+            std::vector<int32> remainingNodes;
+            std::vector<AABB> remainingAABBs;
+            for (int i=1; i < nbObjects; i += 2) {
+                remainingNodes.push_back(nodes[i]);
+                remainingAABBs.push_back(aabbs[i]);
+            }
+            rp3d_test(testQueries(tree, remainingNodes, remainingAABBs));
+            tree.rebuild();
+            rp3d_test(testQueries(tree, remainingNodes, remainingAABBs));
+
+            // Objects with the same center
+            DynamicAABBTree tree2(mAllocator);
+            nodes.clear();
+            aabbs.clear();
+            for (int i=0; i < 50; i++) {
+                aabbs.push_back(AABB(Vector3(-1, -1, -1) * decimal(i + 1), Vector3(1, 1, 1) * decimal(i + 1)));
+                nodes.push_back(tree2.addObject(aabbs[i], &objectsData[i]));
+            }
+            tree2.rebuild();
+            rp3d_test(testQueries(tree2, nodes, aabbs));
+            tree2.optimize(100);
+            rp3d_test(testQueries(tree2, nodes, aabbs));
+        }
+
+        void testWorldBroadPhaseRebuild() {
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            BoxShape* groundShape = mPhysicsCommon.createBoxShape(Vector3(60, 1, 60));
+
+            RigidBody* ground = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            ground->setType(BodyType::STATIC);
+            ground->addCollider(groundShape, Transform::identity());
+
+            // Bodies inserted at random positions and teleported to degrade the tree
+            uint32 seed = 6789;
+            auto random = [&seed]() {
+                seed = seed * 1664525u + 1013904223u;
+                return decimal(seed >> 8) / decimal(1 << 24);
+            };
+            std::vector<RigidBody*> bodies;
+            for (int i=0; i < 400; i++) {
+                const Vector3 position(random() * 100 - 50, 20 + random() * 20, random() * 100 - 50);
+                RigidBody* body = world->createRigidBody(Transform(position, Quaternion::identity()));
+                body->addCollider(boxShape, Transform::identity());
+                bodies.push_back(body);
+            }
+            for (uint i=0; i < bodies.size(); i++) {
+                const Vector3 position(decimal(i % 20) * 4 - 40, decimal(0.5), decimal(i / 20) * 4 - 40);
+                bodies[i]->setTransform(Transform(position, Quaternion::identity()));
+            }
+            world->update(decimal(1.0) / decimal(60.0));
+
+            const decimal initialCost = world->getBroadPhaseSAHCost();
+            rp3d_test(initialCost > decimal(1.0));
+
+            world->rebuildBroadPhase();
+            const decimal rebuiltCost = world->getBroadPhaseSAHCost();
+            rp3d_test(rebuiltCost < initialCost);
+
+            // The simulation continues with the rebuilt broad-phase
+            for (int i=0; i < 60; i++) {
+                world->update(decimal(1.0) / decimal(60.0));
+            }
+            bool isResting = true;
+            for (uint i=0; i < bodies.size(); i++) {
+                isResting &= bodies[i]->getTransform().getPosition().y > decimal(0.4);
+            }
+            rp3d_test(isResting);
+            rp3d_test(world->testOverlap(bodies[0], ground));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+
+            // The sweep-and-prune is not a hierarchy
+            PhysicsWorld::WorldSettings settings;
+            settings.broadPhaseType = BroadPhaseType::SWEEP_AND_PRUNE;
+            world = mPhysicsCommon.createPhysicsWorld(settings);
+            RigidBody* box = world->createRigidBody(Transform(Vector3(0, 1, 0), Quaternion::identity()));
+            box->addCollider(boxShape, Transform::identity());
+            ground = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            ground->setType(BodyType::STATIC);
+            ground->addCollider(groundShape, Transform::identity());
+            world->rebuildBroadPhase();
+            rp3d_test(world->getBroadPhaseSAHCost() == decimal(0.0));
+            for (int i=0; i < 60; i++) {
+                world->update(decimal(1.0) / decimal(60.0));
+            }
+            rp3d_test(world->testOverlap(box, ground));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+            mPhysicsCommon.destroyBoxShape(groundShape);
+        }
  };
 
 }
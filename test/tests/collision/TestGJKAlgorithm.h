@@ -0,0 +1,308 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_GJK_ALGORITHM_H
+#define TEST_GJK_ALGORITHM_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <cmath>
+#include <algorithm>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestGJKAlgorithm
+/**
+ * Unit test for the frame coherence of the GJK algorithm. A sphere and a capsule move and rotate
+ * near a static box and the collision status of each frame (with the tests skipped because of the
+ * separation of the previous frame and the tests started from the previous simplex) is compared
+ * with the distance between the shape and the box.
+ */
+class TestGJKAlgorithm : public Test {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Radius of the sphere
+        static constexpr decimal SPHERE_RADIUS = decimal(0.5);
+
+        /// Distance between the center of the sphere and the origin of its body
+        static constexpr decimal SPHERE_OFFSET = decimal(1.0);
+
+        /// Collision status of a pose is not checked if the distance between the sphere and the box
+        /// is closer to the radius of the sphere than this tolerance
+        static constexpr decimal DISTANCE_TOLERANCE = decimal(0.005);
+
+        /// Radius of the capsule
+        static constexpr decimal CAPSULE_RADIUS = decimal(0.2);
+
+        /// Height of the capsule
+        static constexpr decimal CAPSULE_HEIGHT = decimal(1.6);
+
+        /// Number of points of the inner segment of the capsule used to compute its distance to the box
+        static const int NB_CAPSULE_SEGMENT_POINTS = 400;
+
+        /// Time step of the updates
+        static constexpr decimal TIME_STEP = decimal(1.0 / 60.0);
+
+        // ---------- Attributes ---------- //
+
+        PhysicsCommon mPhysicsCommon;
+
+        PhysicsWorld* mWorld;
+
+        BoxShape* mBoxShape;
+        SphereShape* mSphereShape;
+        CapsuleShape* mCapsuleShape;
+
+        RigidBody* mBoxBody;
+        RigidBody* mSphereBody;
+        Collider* mSphereCollider;
+        RigidBody* mCapsuleBody;
+
+        // ---------- Methods ---------- //
+
+        /// Return the distance between a point and the box
+        decimal computeDistanceToBox(const Vector3& point) const {
+
+            const Vector3 halfExtents = mBoxShape->getHalfExtents();
+            const Vector3 outside(std::max(std::abs(point.x) - halfExtents.x, decimal(0.0)),
+                                  std::max(std::abs(point.y) - halfExtents.y, decimal(0.0)),
+                                  std::max(std::abs(point.z) - halfExtents.z, decimal(0.0)));
+            return outside.length();
+        }
+
+        /// Move a body, update the world and check the collision status of the body with the box. The distance
+        /// between the inner point or segment of its shape and the box is computed by the function in parameter.
+        /// Return false if the distance between the shape and the box is too close to the radius of the shape.
+        template<typename DistanceFunction>
+        bool moveBody(RigidBody* body, const Transform& transform, decimal radius, DistanceFunction computeDistance) {
+
+            body->setTransform(transform);
+            body->setLinearVelocity(Vector3::zero());
+            body->setAngularVelocity(Vector3::zero());
+            mWorld->update(TIME_STEP);
+
+            const decimal distance = computeDistance();
+            if (std::abs(distance - radius) < DISTANCE_TOLERANCE) {
+                return false;
+            }
+
+            rp3d_test(mWorld->testOverlap(mBoxBody, body) == (distance < radius));
+
+            return true;
+        }
+
+        /// Move the body of the sphere, update the world and check the collision status of the sphere
+        bool moveSphere(const Transform& transform) {
+
+            return moveBody(mSphereBody, transform, mSphereShape->getRadius(), [&]() {
+                return computeDistanceToBox(mSphereCollider->getLocalToWorldTransform().getPosition());
+            });
+        }
+
+        /// Move the body of the capsule, update the world and check the collision status of the capsule
+        bool moveCapsule(const Transform& transform) {
+
+            return moveBody(mCapsuleBody, transform, CAPSULE_RADIUS, [&]() {
+
+                // The distance between the inner segment of the capsule and the box is approximated
+                // by the distance of the closest point among points regularly spaced on the segment
+                const Vector3 segmentPoint1 = transform * Vector3(0, CAPSULE_HEIGHT * decimal(0.5), 0);
+                const Vector3 segmentPoint2 = transform * Vector3(0, -CAPSULE_HEIGHT * decimal(0.5), 0);
+                decimal distance = DECIMAL_LARGEST;
+                for (int i=0; i <= NB_CAPSULE_SEGMENT_POINTS; i++) {
+                    const decimal t = decimal(i) / decimal(NB_CAPSULE_SEGMENT_POINTS);
+                    distance = std::min(distance, computeDistanceToBox(segmentPoint1 + t * (segmentPoint2 - segmentPoint1)));
+                }
+                return distance;
+            });
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestGJKAlgorithm(const std::string& name) : Test(name) {
+
+            mWorld = mPhysicsCommon.createPhysicsWorld();
+
+            mBoxShape = mPhysicsCommon.createBoxShape(Vector3(1, 1, 1));
+            mSphereShape = mPhysicsCommon.createSphereShape(SPHERE_RADIUS);
+            mCapsuleShape = mPhysicsCommon.createCapsuleShape(CAPSULE_RADIUS, CAPSULE_HEIGHT);
+
+            mBoxBody = mWorld->createRigidBody(Transform::identity());
+            mBoxBody->setType(BodyType::STATIC);
+            mBoxBody->addCollider(mBoxShape, Transform::identity());
+
+            // The sphere is not at the origin of its body so that a rotation of the body moves it
+            mSphereBody = mWorld->createRigidBody(Transform(Vector3(0, 5, 0), Quaternion::identity()));
+            mSphereBody->enableGravity(false);
+            mSphereBody->setIsAllowedToSleep(false);
+            mSphereCollider = mSphereBody->addCollider(mSphereShape, Transform(Vector3(SPHERE_OFFSET, 0, 0), Quaternion::identity()));
+
+            mCapsuleBody = mWorld->createRigidBody(Transform(Vector3(0, -5, 0), Quaternion::identity()));
+            mCapsuleBody->enableGravity(false);
+            mCapsuleBody->setIsAllowedToSleep(false);
+            mCapsuleBody->addCollider(mCapsuleShape, Transform::identity());
+        }
+
+        /// Destructor
+        virtual ~TestGJKAlgorithm() {
+
+            mPhysicsCommon.destroyPhysicsWorld(mWorld);
+            mPhysicsCommon.destroyBoxShape(mBoxShape);
+            mPhysicsCommon.destroySphereShape(mSphereShape);
+            mPhysicsCommon.destroyCapsuleShape(mCapsuleShape);
+        }
+
+        /// Run the tests
+        void run() {
+
+            testSkippedTests();
+            testWarmStartedTests();
+            testRotatingSphere();
+            testRotatingCapsule();
+            testTeleportedSphere();
+            testResizedSphere();
+        }
+
+        /// Test that the GJK tests of a sphere slowly moving near a corner of the box (but still
+        /// separated from it) are skipped
+        void testSkippedTests() {
+
+            // The AABBs overlap but the sphere is separated from the corner of the box by about 0.13
+            uint32 nbSkippedTests = 0;
+            for (int i=0; i < 20; i++) {
+
+                const decimal a = decimal(0.45) + decimal(0.001) * decimal(i % 5);
+                rp3d_test(moveSphere(Transform(Vector3(1 + a - SPHERE_OFFSET, 1 + a, 0), Quaternion::identity())));
+
+                const NarrowPhaseStatistics& statistics = mWorld->getNarrowPhaseStatistics();
+                rp3d_test(statistics.nbGJKTests == 1);
+                nbSkippedTests += statistics.nbGJKSkippedTests;
+            }
+
+            // Only the first test is not skipped
+            rp3d_test(nbSkippedTests == 19);
+            rp3d_test(mWorld->getNarrowPhaseStatistics().getGJKSkipRate() == decimal(1.0));
+        }
+
+        /// Test that the GJK tests of a sphere slowly moving on the top face of the box (with a
+        /// shallow penetration) start from the simplex of the previous test
+        void testWarmStartedTests() {
+
+            uint32 nbWarmStartedTests = 0;
+            for (int i=0; i < 20; i++) {
+
+                const Vector3 center(decimal(0.01) * decimal(i), 1 + SPHERE_RADIUS - decimal(0.02), decimal(0.2));
+                rp3d_test(moveSphere(Transform(center - Vector3(SPHERE_OFFSET, 0, 0), Quaternion::identity())));
+
+                const NarrowPhaseStatistics& statistics = mWorld->getNarrowPhaseStatistics();
+                rp3d_test(statistics.nbGJKTests == 1);
+                rp3d_test(statistics.nbGJKSkippedTests == 0);
+                nbWarmStartedTests += statistics.nbGJKWarmStartedTests;
+            }
+
+            rp3d_test(nbWarmStartedTests >= 15);
+        }
+
+        /// Test the collision status of a sphere with a body rotating around a point near the box
+        /// (most of the displacement of the sphere comes from the rotation of its body)
+        void testRotatingSphere() {
+
+            int nbCheckedPoses = 0;
+            for (int i=0; i < 600; i++) {
+
+                // Angle of the rotation of the body and distance between the rotation center and the box
+                const decimal angle = decimal(i) * decimal(0.02);
+                const decimal distance = decimal(1.3) + decimal(0.4) * std::sin(decimal(i) * decimal(0.013));
+
+                const Quaternion orientation = Quaternion::fromEulerAngles(0, angle, decimal(0.3) * std::sin(angle));
+                nbCheckedPoses += moveSphere(Transform(Vector3(0, distance, 0), orientation));
+            }
+
+            rp3d_test(nbCheckedPoses > 500);
+        }
+
+        /// Test the collision status of a capsule rotating around its center near an edge of the box
+        /// (the capsule only collides with the box when it points toward the edge)
+        void testRotatingCapsule() {
+
+            int nbCheckedPoses = 0;
+            uint32 nbSkippedTests = 0;
+            for (int i=0; i < 600; i++) {
+
+                const decimal angle = decimal(i) * decimal(0.02);
+                const Vector3 center(decimal(1.25), decimal(1.25), decimal(0.1) * std::sin(angle));
+                nbCheckedPoses += moveCapsule(Transform(center, Quaternion::fromEulerAngles(0, 0, angle)));
+                nbSkippedTests += mWorld->getNarrowPhaseStatistics().nbGJKSkippedTests;
+            }
+
+            rp3d_test(nbCheckedPoses > 500);
+            rp3d_test(nbSkippedTests > 0);
+
+            // Move the capsule away from the box
+            moveCapsule(Transform(Vector3(0, -5, 0), Quaternion::identity()));
+        }
+
+        /// Test that a sphere that is moved from a separated pose to an overlapping pose in a single
+        /// frame is colliding
+        void testTeleportedSphere() {
+
+            const Transform separatedTransform(Vector3(decimal(1.45) - SPHERE_OFFSET, decimal(1.45), 0), Quaternion::identity());
+            rp3d_test(moveSphere(separatedTransform));
+            rp3d_test(moveSphere(separatedTransform));
+            rp3d_test(mWorld->getNarrowPhaseStatistics().nbGJKSkippedTests == 1);
+
+            rp3d_test(moveSphere(Transform(Vector3(decimal(1.2) - SPHERE_OFFSET, decimal(1.2), 0), Quaternion::identity())));
+            rp3d_test(mWorld->testOverlap(mBoxBody, mSphereBody));
+            rp3d_test(mWorld->getNarrowPhaseStatistics().nbGJKSkippedTests == 0);
+        }
+
+        /// Test that a separated sphere that becomes larger (without moving) is colliding
+        void testResizedSphere() {
+
+            const Transform separatedTransform(Vector3(decimal(1.45) - SPHERE_OFFSET, decimal(1.45), 0), Quaternion::identity());
+            rp3d_test(moveSphere(separatedTransform));
+            rp3d_test(moveSphere(separatedTransform));
+            rp3d_test(!mWorld->testOverlap(mBoxBody, mSphereBody));
+
+            mSphereShape->setRadius(decimal(0.8));
+            rp3d_test(moveSphere(separatedTransform));
+            rp3d_test(mWorld->testOverlap(mBoxBody, mSphereBody));
+            rp3d_test(mWorld->getNarrowPhaseStatistics().nbGJKSkippedTests == 0);
+
+            mSphereShape->setRadius(SPHERE_RADIUS);
+        }
+};
+
+}
+
+#endif
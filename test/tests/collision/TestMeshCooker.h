@@ -0,0 +1,346 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_MESH_COOKER_H
+#define TEST_MESH_COOKER_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <reactphysics3d/memory/DefaultAllocator.h>
+#include <vector>
+#include <cstddef>
+#include <limits>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestMeshCooker
+/**
+ * Unit test for the cooking of the collision meshes
+ */
+class TestMeshCooker : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        DefaultAllocator mAllocator;
+
+        PhysicsCommon mPhysicsCommon;
+
+        /// Vertices and indices of a grid of triangles
+        std::vector<float> mGridVertices;
+        std::vector<uint32> mGridIndices;
+
+        /// Vertices, indices and faces of a box
+        float mBoxVertices[24];
+        uint32 mBoxIndices[24];
+        PolygonVertexArray::PolygonFace mBoxFaces[6];
+
+        /// Heights of a height field
+        std::vector<float> mHeights;
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestMeshCooker(const std::string& name) : Test(name) {
+
+            // Grid of 20x20 quads with bumps
+            const int nbQuads = 20;
+            for (int i=0; i <= nbQuads; i++) {
+                for (int j=0; j <= nbQuads; j++) {
+                    mGridVertices.push_back(float(i) - 10);
+                    mGridVertices.push_back(float((i * 7 + j * 3) % 5) * 0.2f);
+                    mGridVertices.push_back(float(j) - 10);
+                }
+            }
+            for (int i=0; i < nbQuads; i++) {
+                for (int j=0; j < nbQuads; j++) {
+                    const uint32 v = i * (nbQuads + 1) + j;
+                    mGridIndices.push_back(v); mGridIndices.push_back(v + 1); mGridIndices.push_back(v + nbQuads + 1);
+                    mGridIndices.push_back(v + 1); mGridIndices.push_back(v + nbQuads + 2); mGridIndices.push_back(v + nbQuads + 1);
+                }
+            }
+
+            const float boxVertices[24] = {-1, -1, 1,  1, -1, 1,  1, -1, -1,  -1, -1, -1,
+                                           -1, 1, 1,  1, 1, 1,  1, 1, -1,  -1, 1, -1};
+            const uint32 boxIndices[24] = {0, 3, 2, 1,  4, 5, 6, 7,  0, 1, 5, 4,  1, 2, 6, 5,  2, 3, 7, 6,  0, 4, 7, 3};
+            for (int i=0; i < 24; i++) {
+                mBoxVertices[i] = boxVertices[i];
+                mBoxIndices[i] = boxIndices[i];
+            }
+            for (int f=0; f < 6; f++) {
+                mBoxFaces[f].indexBase = f * 4;
+                mBoxFaces[f].nbVertices = 4;
+            }
+
+            for (int i=0; i < 8 * 6; i++) {
+                mHeights.push_back(float((i * 13) % 7) - 3);
+            }
+        }
+
+        /// Run the tests
+        void run() {
+
+            testTriangleMesh();
+            testPolyhedronMesh();
+            testHeightField();
+            testInvalidData();
+            testOutOfRangeIndices();
+        }
+
+        /// Return true if cooked data with a modified index is rejected even without verifying the checksum
+        bool isIndexChangeDetected(List<uint8>& cookedData, MeshCooker::CookedDataType dataType, uint64 offset, uint32 newIndex) {
+
+            uint32& index = *reinterpret_cast<uint32*>(&(cookedData[static_cast<uint32>(offset)]));
+            const uint32 previousIndex = index;
+            index = newIndex;
+            const bool isDetected = !MeshCooker::isCookedDataValid(&(cookedData[0]), cookedData.size(), dataType, false);
+            index = previousIndex;
+
+            return isDetected && MeshCooker::isCookedDataValid(&(cookedData[0]), cookedData.size(), dataType, false);
+        }
+
+        void testTriangleMesh() {
+
+            TriangleVertexArray triangleArray(static_cast<uint>(mGridVertices.size() / 3), mGridVertices.data(), 3 * sizeof(float),
+                                              static_cast<uint>(mGridIndices.size() / 3), mGridIndices.data(), 3 * sizeof(uint32),
+                                              TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                              TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            TriangleMesh* triangleMesh = mPhysicsCommon.createTriangleMesh();
+            triangleMesh->addSubpart(&triangleArray);
+
+            List<uint8> cookedData(mAllocator);
+            rp3d_test(MeshCooker::cookTriangleMesh(*triangleMesh, mAllocator, cookedData));
+            rp3d_test(cookedData.size() % MeshCooker::ALIGNMENT == 0);
+
+            TriangleMesh* cookedMesh = mPhysicsCommon.createTriangleMeshFromCookedData(&(cookedData[0]), cookedData.size());
+            rp3d_test(cookedMesh != nullptr);
+            rp3d_test(cookedMesh->getNbSubparts() == 1);
+            rp3d_test(cookedMesh->getSubpart(0)->getNbTriangles() == triangleArray.getNbTriangles());
+            rp3d_test(cookedMesh->getSubpart(0)->getNbVertices() == triangleArray.getNbVertices());
+
+            // The shapes created with the original and the cooked meshes must report the same raycast hits
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+            CollisionBody* body = world->createCollisionBody(Transform::identity());
+            CollisionBody* cookedBody = world->createCollisionBody(Transform::identity());
+            ConcaveMeshShape* shape = mPhysicsCommon.createConcaveMeshShape(triangleMesh);
+            ConcaveMeshShape* cookedShape = mPhysicsCommon.createConcaveMeshShape(cookedMesh);
+            Collider* collider = body->addCollider(shape, Transform::identity());
+            Collider* cookedCollider = cookedBody->addCollider(cookedShape, Transform::identity());
+
+            for (int i=0; i < 50; i++) {
+
+                const Vector3 point1(decimal(i % 10) * decimal(1.9) - decimal(9.5), 10, decimal(i / 10) * decimal(3.7) - decimal(9.0));
+                const Ray ray(point1, point1 + Vector3(decimal(0.3), -20, decimal(-0.2)));
+
+                RaycastInfo raycastInfo;
+                RaycastInfo cookedRaycastInfo;
+                const bool isHit = collider->raycast(ray, raycastInfo);
+                const bool isCookedHit = cookedCollider->raycast(ray, cookedRaycastInfo);
+
+                rp3d_test(isHit);
+                rp3d_test(isHit == isCookedHit);
+                rp3d_test(approxEqual(raycastInfo.hitFraction, cookedRaycastInfo.hitFraction, decimal(0.0001)));
+                rp3d_test(approxEqual(raycastInfo.worldPoint.y, cookedRaycastInfo.worldPoint.y, decimal(0.0001)));
+            }
+
+            body->removeCollider(collider);
+            cookedBody->removeCollider(cookedCollider);
+            mPhysicsCommon.destroyConcaveMeshShape(shape);
+            mPhysicsCommon.destroyConcaveMeshShape(cookedShape);
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyTriangleMesh(triangleMesh);
+            mPhysicsCommon.destroyTriangleMesh(cookedMesh);
+        }
+
+        void testPolyhedronMesh() {
+
+            PolygonVertexArray polygonArray(8, mBoxVertices, 3 * sizeof(float), mBoxIndices, sizeof(uint32), 6, mBoxFaces,
+                                            PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                            PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            PolyhedronMesh* mesh = mPhysicsCommon.createPolyhedronMesh(&polygonArray);
+
+            List<uint8> cookedData(mAllocator);
+            rp3d_test(MeshCooker::cookPolyhedronMesh(*mesh, cookedData));
+
+            PolyhedronMesh* cookedMesh = mPhysicsCommon.createPolyhedronMeshFromCookedData(&(cookedData[0]), cookedData.size());
+            rp3d_test(cookedMesh != nullptr);
+
+            const HalfEdgeStructure& halfEdges = mesh->getHalfEdgeStructure();
+            const HalfEdgeStructure& cookedHalfEdges = cookedMesh->getHalfEdgeStructure();
+
+            rp3d_test(cookedMesh->getNbVertices() == 8);
+            rp3d_test(cookedMesh->getNbFaces() == 6);
+            rp3d_test(cookedHalfEdges.getNbHalfEdges() == halfEdges.getNbHalfEdges());
+            rp3d_test(cookedMesh->getCentroid() == mesh->getCentroid());
+
+            for (uint v=0; v < 8; v++) {
+                rp3d_test(cookedMesh->getVertex(v) == mesh->getVertex(v));
+                rp3d_test(cookedHalfEdges.getVertex(v).edgeIndex == halfEdges.getVertex(v).edgeIndex);
+            }
+            for (uint f=0; f < 6; f++) {
+                rp3d_test(cookedMesh->getFaceNormal(f) == mesh->getFaceNormal(f));
+                rp3d_test(cookedHalfEdges.getFace(f).edgeIndex == halfEdges.getFace(f).edgeIndex);
+            }
+            for (uint e=0; e < halfEdges.getNbHalfEdges(); e++) {
+                const HalfEdgeStructure::Edge& edge = halfEdges.getHalfEdge(e);
+                const HalfEdgeStructure::Edge& cookedEdge = cookedHalfEdges.getHalfEdge(e);
+                rp3d_test(cookedEdge.vertexIndex == edge.vertexIndex);
+                rp3d_test(cookedEdge.twinEdgeIndex == edge.twinEdgeIndex);
+                rp3d_test(cookedEdge.faceIndex == edge.faceIndex);
+                rp3d_test(cookedEdge.nextEdgeIndex == edge.nextEdgeIndex);
+            }
+
+            mPhysicsCommon.destroyPolyhedronMesh(mesh);
+            mPhysicsCommon.destroyPolyhedronMesh(cookedMesh);
+        }
+
+        void testHeightField() {
+
+            HeightFieldShape* heightField = mPhysicsCommon.createHeightFieldShape(8, 6, -3, 3, mHeights.data(),
+                                                                                  HeightFieldShape::HeightDataType::HEIGHT_FLOAT_TYPE, 1);
+
+            List<uint8> cookedData(mAllocator);
+            rp3d_test(MeshCooker::cookHeightField(*heightField, cookedData));
+
+            HeightFieldShape* cookedHeightField = mPhysicsCommon.createHeightFieldShapeFromCookedData(&(cookedData[0]), cookedData.size(),
+                                                                                                      Vector3(2, 2, 2));
+            rp3d_test(cookedHeightField != nullptr);
+            rp3d_test(cookedHeightField->getNbColumns() == 8);
+            rp3d_test(cookedHeightField->getNbRows() == 6);
+            rp3d_test(cookedHeightField->getScale() == Vector3(2, 2, 2));
+
+            for (int y=0; y < 6; y++) {
+                for (int x=0; x < 8; x++) {
+                    rp3d_test(cookedHeightField->getHeightAt(x, y) == heightField->getHeightAt(x, y));
+                }
+            }
+
+            mPhysicsCommon.destroyHeightFieldShape(heightField);
+            mPhysicsCommon.destroyHeightFieldShape(cookedHeightField);
+        }
+
+        void testInvalidData() {
+
+            PolygonVertexArray polygonArray(8, mBoxVertices, 3 * sizeof(float), mBoxIndices, sizeof(uint32), 6, mBoxFaces,
+                                            PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                            PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            PolyhedronMesh* mesh = mPhysicsCommon.createPolyhedronMesh(&polygonArray);
+
+            List<uint8> cookedData(mAllocator);
+            rp3d_test(MeshCooker::cookPolyhedronMesh(*mesh, cookedData));
+            mPhysicsCommon.destroyPolyhedronMesh(mesh);
+
+            const uint8* data = &(cookedData[0]);
+            rp3d_test(MeshCooker::isCookedDataValid(data, cookedData.size(), MeshCooker::CookedDataType::POLYHEDRON_MESH));
+
+            // Wrong type or size
+            rp3d_test(!MeshCooker::isCookedDataValid(data, cookedData.size(), MeshCooker::CookedDataType::TRIANGLE_MESH));
+            rp3d_test(!MeshCooker::isCookedDataValid(data, cookedData.size() - MeshCooker::ALIGNMENT,
+                                                     MeshCooker::CookedDataType::POLYHEDRON_MESH));
+            rp3d_test(mPhysicsCommon.createTriangleMeshFromCookedData(data, cookedData.size()) == nullptr);
+
+            // A corrupted vertex is only detected by the checksum
+            const MeshCooker::PolyhedronMeshData& description = *MeshCooker::getArray<MeshCooker::PolyhedronMeshData>(data, MeshCooker::ALIGNMENT);
+            cookedData[static_cast<uint32>(description.verticesOffset) + 1] ^= 0x10;
+            rp3d_test(!MeshCooker::isCookedDataValid(data, cookedData.size(), MeshCooker::CookedDataType::POLYHEDRON_MESH));
+            rp3d_test(MeshCooker::isCookedDataValid(data, cookedData.size(), MeshCooker::CookedDataType::POLYHEDRON_MESH, false));
+            rp3d_test(mPhysicsCommon.createPolyhedronMeshFromCookedData(data, cookedData.size()) == nullptr);
+            cookedData[static_cast<uint32>(description.verticesOffset) + 1] ^= 0x10;
+
+            // Another version of the format
+            reinterpret_cast<MeshCooker::Header*>(&(cookedData[0]))->version = MeshCooker::VERSION + 1;
+            rp3d_test(!MeshCooker::isCookedDataValid(data, cookedData.size(), MeshCooker::CookedDataType::POLYHEDRON_MESH));
+        }
+
+        void testOutOfRangeIndices() {
+
+            // Polyhedron mesh
+            PolygonVertexArray polygonArray(8, mBoxVertices, 3 * sizeof(float), mBoxIndices, sizeof(uint32), 6, mBoxFaces,
+                                            PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                            PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            PolyhedronMesh* mesh = mPhysicsCommon.createPolyhedronMesh(&polygonArray);
+
+            List<uint8> polyhedronData(mAllocator);
+            rp3d_test(MeshCooker::cookPolyhedronMesh(*mesh, polyhedronData));
+            mPhysicsCommon.destroyPolyhedronMesh(mesh);
+
+            const MeshCooker::CookedDataType polyhedronType = MeshCooker::CookedDataType::POLYHEDRON_MESH;
+            const MeshCooker::PolyhedronMeshData polyhedron = *MeshCooker::getArray<MeshCooker::PolyhedronMeshData>(&(polyhedronData[0]),
+                                                                                                                     MeshCooker::ALIGNMENT);
+            const uint64 lastEdgeOffset = polyhedron.halfEdgesOffset + (polyhedron.nbHalfEdges - 1) * sizeof(HalfEdgeStructure::Edge);
+
+            rp3d_test(isIndexChangeDetected(polyhedronData, polyhedronType, polyhedron.facesIndicesOffset + 5 * sizeof(uint32), 8));
+            rp3d_test(isIndexChangeDetected(polyhedronData, polyhedronType, polyhedron.facesOffset + 5 * 2 * sizeof(uint32) + sizeof(uint32), 21));
+            rp3d_test(isIndexChangeDetected(polyhedronData, polyhedronType, lastEdgeOffset, 8));
+            rp3d_test(isIndexChangeDetected(polyhedronData, polyhedronType, lastEdgeOffset + sizeof(uint32), polyhedron.nbHalfEdges));
+            rp3d_test(isIndexChangeDetected(polyhedronData, polyhedronType, lastEdgeOffset + 2 * sizeof(uint32), 6));
+            rp3d_test(isIndexChangeDetected(polyhedronData, polyhedronType, lastEdgeOffset + 3 * sizeof(uint32), ~uint32(0)));
+            rp3d_test(isIndexChangeDetected(polyhedronData, polyhedronType, polyhedron.verticesEdgesOffset + 7 * sizeof(uint32), polyhedron.nbHalfEdges));
+            rp3d_test(isIndexChangeDetected(polyhedronData, polyhedronType, polyhedron.facesEdgesOffset, polyhedron.nbHalfEdges));
+            PolyhedronMesh* cookedMesh = mPhysicsCommon.createPolyhedronMeshFromCookedData(&(polyhedronData[0]), polyhedronData.size(), false);
+            rp3d_test(cookedMesh != nullptr);
+            mPhysicsCommon.destroyPolyhedronMesh(cookedMesh);
+
+            // Triangle mesh
+            TriangleVertexArray triangleArray(static_cast<uint>(mGridVertices.size() / 3), mGridVertices.data(), 3 * sizeof(float),
+                                              static_cast<uint>(mGridIndices.size() / 3), mGridIndices.data(), 3 * sizeof(uint32),
+                                              TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                              TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            TriangleMesh* triangleMesh = mPhysicsCommon.createTriangleMesh();
+            triangleMesh->addSubpart(&triangleArray);
+
+            List<uint8> triangleData(mAllocator);
+            rp3d_test(MeshCooker::cookTriangleMesh(*triangleMesh, mAllocator, triangleData));
+            mPhysicsCommon.destroyTriangleMesh(triangleMesh);
+
+            const MeshCooker::CookedDataType triangleType = MeshCooker::CookedDataType::TRIANGLE_MESH;
+            const MeshCooker::TriangleMeshData triangles = *MeshCooker::getArray<MeshCooker::TriangleMeshData>(&(triangleData[0]),
+                                                                                                                 MeshCooker::ALIGNMENT);
+            const MeshCooker::TriangleMeshSubpartData subpart = *MeshCooker::getArray<MeshCooker::TriangleMeshSubpartData>(&(triangleData[0]),
+                                                                                                                             triangles.subpartsOffset);
+            const uint64 lastNodeOffset = triangles.treeNodesOffset + (triangles.nbTriangles - 2) * sizeof(StaticAABBTreeNode);
+            const uint64 childrenOffset = offsetof(StaticAABBTreeNode, children);
+            const uint32 nbTriangles = triangles.nbTriangles;
+
+            rp3d_test(isIndexChangeDetected(triangleData, triangleType, subpart.indicesOffset + 100 * sizeof(uint32), subpart.nbVertices));
+            rp3d_test(isIndexChangeDetected(triangleData, triangleType, triangles.treeNodesOffset + childrenOffset, 0));
+            rp3d_test(isIndexChangeDetected(triangleData, triangleType, lastNodeOffset + childrenOffset, nbTriangles - 1));
+            rp3d_test(isIndexChangeDetected(triangleData, triangleType, lastNodeOffset + childrenOffset + sizeof(int32), uint32(-int32(nbTriangles) - 1)));
+            rp3d_test(isIndexChangeDetected(triangleData, triangleType, lastNodeOffset + childrenOffset, uint32(std::numeric_limits<int32>::min())));
+            rp3d_test(isIndexChangeDetected(triangleData, triangleType, MeshCooker::ALIGNMENT + offsetof(MeshCooker::TriangleMeshData, treeRootReference), 1));
+            TriangleMesh* cookedTriangleMesh = mPhysicsCommon.createTriangleMeshFromCookedData(&(triangleData[0]), triangleData.size(), false);
+            rp3d_test(cookedTriangleMesh != nullptr);
+            mPhysicsCommon.destroyTriangleMesh(cookedTriangleMesh);
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,316 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_PRIMITIVE_NARROW_PHASE_H
+#define TEST_PRIMITIVE_NARROW_PHASE_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <cmath>
+#include <map>
+#include <set>
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class PrimitivePairsCollisionCallback
+/**
+ * Collision callback that records the deepest contact point of each colliding body
+ */
+class PrimitivePairsCollisionCallback : public CollisionCallback {
+
+    public:
+
+        std::map<const CollisionBody*, decimal> mPenetrationDepths;
+
+        virtual void onContact(const CallbackData& callbackData) override {
+
+            for (uint p=0; p < callbackData.getNbContactPairs(); p++) {
+
+                ContactPair contactPair = callbackData.getContactPair(p);
+
+                decimal maxPenetrationDepth = 0;
+                for (uint c=0; c < contactPair.getNbContactPoints(); c++) {
+                    maxPenetrationDepth = std::max(maxPenetrationDepth, contactPair.getContactPoint(c).getPenetrationDepth());
+                }
+
+                mPenetrationDepths[contactPair.getBody1()] = maxPenetrationDepth;
+                mPenetrationDepths[contactPair.getBody2()] = maxPenetrationDepth;
+            }
+        }
+};
+
+// Class PrimitivePairsOverlapCallback
+/**
+ * Overlap callback that records the overlapping bodies
+ */
+class PrimitivePairsOverlapCallback : public OverlapCallback {
+
+    public:
+
+        std::set<const CollisionBody*> mOverlappingBodies;
+
+        virtual void onOverlap(CallbackData& callbackData) override {
+
+            for (uint i=0; i < callbackData.getNbOverlappingPairs(); i++) {
+
+                OverlapPair overlapPair = callbackData.getOverlappingPair(i);
+                mOverlappingBodies.insert(overlapPair.getBody1());
+                mOverlappingBodies.insert(overlapPair.getBody2());
+            }
+        }
+};
+
+// Class TestPrimitiveNarrowPhase
+/**
+ * Unit test for the sphere vs sphere, sphere vs capsule and capsule vs capsule narrow-phase
+ * algorithms. Many pairs are tested at once so that the batches are processed by the SIMD
+ * overlap tests. The shapes of each pair are placed at a known distance (some of them just
+ * inside or just outside of the sum of their radiuses).
+ */
+class TestPrimitiveNarrowPhase : public Test {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Number of pairs of each kind (not a multiple of the number of SIMD lanes)
+        static const int NB_PAIRS = 51;
+
+        // ---------- Attributes ---------- //
+
+        PhysicsCommon mPhysicsCommon;
+
+        PhysicsWorld* mWorld;
+
+        /// First body of each pair
+        std::vector<CollisionBody*> mBodies1;
+
+        /// Second body of each pair
+        std::vector<CollisionBody*> mBodies2;
+
+        /// Expected penetration depth of each pair (negative if the shapes do not overlap)
+        std::vector<decimal> mExpectedPenetrationDepths;
+
+        std::vector<SphereShape*> mSphereShapes;
+        std::vector<CapsuleShape*> mCapsuleShapes;
+
+        // ---------- Methods ---------- //
+
+        /// Return the ratio between the distance of the shapes of a pair and the sum of their radiuses
+        static decimal getDistanceRatio(int pairIndex) {
+            const decimal ratios[] = {decimal(0.5), decimal(0.9), decimal(0.99), decimal(0.997), decimal(1.003),
+                                      decimal(1.01), decimal(1.05), decimal(1.2)};
+            return ratios[pairIndex % 8];
+        }
+
+        /// Return a unit vector orthogonal to a given unit vector
+        static Vector3 getOrthogonalVector(const Vector3& vector, int pairIndex) {
+            Vector3 orthogonal = vector.cross(Vector3(decimal(0.3), decimal(1.0), decimal(0.1) * (pairIndex % 7)));
+            if (orthogonal.lengthSquare() < decimal(0.01)) {
+                orthogonal = vector.cross(Vector3(1, 0, 0));
+            }
+            return orthogonal.getUnit();
+        }
+
+        /// Create a body with a collider at a given position
+        CollisionBody* createBody(CollisionShape* shape, const Transform& transform) {
+            CollisionBody* body = mWorld->createCollisionBody(transform);
+            body->addCollider(shape, Transform::identity());
+            return body;
+        }
+
+        /// Add a pair of bodies and its expected penetration depth
+        void addPair(CollisionBody* body1, CollisionBody* body2, decimal sumRadiuses, decimal distance) {
+            mBodies1.push_back(body1);
+            mBodies2.push_back(body2);
+            mExpectedPenetrationDepths.push_back(sumRadiuses - distance);
+        }
+
+        /// Create the pairs of spheres
+        void createSpherePairs(const Vector3& origin) {
+
+            for (int i=0; i < NB_PAIRS; i++) {
+
+                SphereShape* sphere1 = mPhysicsCommon.createSphereShape(decimal(0.4) + decimal(0.05) * (i % 5));
+                SphereShape* sphere2 = mPhysicsCommon.createSphereShape(decimal(0.3) + decimal(0.1) * (i % 3));
+                mSphereShapes.push_back(sphere1);
+                mSphereShapes.push_back(sphere2);
+
+                const decimal sumRadiuses = sphere1->getRadius() + sphere2->getRadius();
+                const decimal distance = sumRadiuses * getDistanceRatio(i);
+                const Vector3 direction = Vector3(decimal(1.0), decimal(0.2) * (i % 4), decimal(-0.5)).getUnit();
+                const Vector3 center1 = origin + Vector3(decimal(10.0) * i, 0, 0);
+                const Quaternion orientation = Quaternion::fromEulerAngles(decimal(0.1) * i, decimal(0.3), decimal(-0.2) * i);
+
+                addPair(createBody(sphere1, Transform(center1, orientation)),
+                        createBody(sphere2, Transform(center1 + direction * distance, orientation.getInverse())), sumRadiuses, distance);
+            }
+        }
+
+        /// Create the pairs made of a sphere and a capsule
+        void createSphereCapsulePairs(const Vector3& origin) {
+
+            for (int i=0; i < NB_PAIRS; i++) {
+
+                SphereShape* sphere = mPhysicsCommon.createSphereShape(decimal(0.3) + decimal(0.1) * (i % 3));
+                CapsuleShape* capsule = mPhysicsCommon.createCapsuleShape(decimal(0.25) + decimal(0.05) * (i % 4), decimal(1.0) + decimal(0.5) * (i % 3));
+                mSphereShapes.push_back(sphere);
+                mCapsuleShapes.push_back(capsule);
+
+                // The sphere center is placed in front of an inner point of the capsule segment
+                const decimal sumRadiuses = sphere->getRadius() + capsule->getRadius();
+                const decimal distance = sumRadiuses * getDistanceRatio(i);
+                const Vector3 capsuleCenter = origin + Vector3(decimal(10.0) * i, 0, 0);
+                const Quaternion capsuleOrientation = Quaternion::fromEulerAngles(decimal(0.4) * i, decimal(0.2) * (i % 5), decimal(0.7));
+                const Vector3 capsuleAxis = capsuleOrientation * Vector3(0, 1, 0);
+                const decimal segmentParameter = capsule->getHeight() * decimal(0.4) * (decimal((i % 5) - 2) / decimal(2.0));
+                const Vector3 sphereCenter = capsuleCenter + capsuleAxis * segmentParameter + getOrthogonalVector(capsuleAxis, i) * distance;
+
+                CollisionBody* capsuleBody = createBody(capsule, Transform(capsuleCenter, capsuleOrientation));
+                CollisionBody* sphereBody = createBody(sphere, Transform(sphereCenter, Quaternion::identity()));
+
+                // Alternate the order of the shapes in the pairs
+                if (i % 2 == 0) {
+                    addPair(sphereBody, capsuleBody, sumRadiuses, distance);
+                }
+                else {
+                    addPair(capsuleBody, sphereBody, sumRadiuses, distance);
+                }
+            }
+        }
+
+        /// Create the pairs of capsules
+        void createCapsulePairs(const Vector3& origin) {
+
+            for (int i=0; i < NB_PAIRS; i++) {
+
+                CapsuleShape* capsule1 = mPhysicsCommon.createCapsuleShape(decimal(0.25) + decimal(0.05) * (i % 4), decimal(1.0) + decimal(0.5) * (i % 3));
+                CapsuleShape* capsule2 = mPhysicsCommon.createCapsuleShape(decimal(0.3) + decimal(0.05) * (i % 3), decimal(1.5) + decimal(0.25) * (i % 4));
+                mCapsuleShapes.push_back(capsule1);
+                mCapsuleShapes.push_back(capsule2);
+
+                const decimal sumRadiuses = capsule1->getRadius() + capsule2->getRadius();
+                const decimal distance = sumRadiuses * getDistanceRatio(i);
+                const Vector3 center1 = origin + Vector3(decimal(10.0) * i, 0, 0);
+                const Quaternion orientation1 = Quaternion::fromEulerAngles(decimal(0.3) * i, decimal(0.5), decimal(0.1) * (i % 6));
+                const Vector3 axis1 = orientation1 * Vector3(0, 1, 0);
+
+                // One pair out of three has parallel inner segments. Otherwise, the second capsule is rotated
+                // around the first one and the closest points are inner points of the two segments on the line
+                // orthogonal to both segments
+                Quaternion orientation2 = orientation1;
+                Vector3 normal = getOrthogonalVector(axis1, i);
+                if (i % 3 != 0) {
+                    const decimal angle = decimal(0.4) + decimal(0.3) * (i % 4);
+                    const Quaternion rotation(normal * std::sin(angle * decimal(0.5)), std::cos(angle * decimal(0.5)));
+                    orientation2 = rotation * orientation1;
+                }
+                const Vector3 axis2 = orientation2 * Vector3(0, 1, 0);
+                if (i % 3 != 0) {
+                    normal = axis1.cross(axis2).getUnit();
+                }
+
+                const decimal segment1Parameter = capsule1->getHeight() * decimal(0.1) * decimal((i % 5) - 2);
+                const decimal segment2Parameter = capsule2->getHeight() * decimal(0.1) * decimal((i % 3) - 1);
+                const Vector3 center2 = center1 + axis1 * segment1Parameter + normal * distance - axis2 * segment2Parameter;
+
+                addPair(createBody(capsule1, Transform(center1, orientation1)),
+                        createBody(capsule2, Transform(center2, orientation2)), sumRadiuses, distance);
+            }
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestPrimitiveNarrowPhase(const std::string& name) : Test(name) {
+
+            mWorld = mPhysicsCommon.createPhysicsWorld();
+
+            createSpherePairs(Vector3(0, 0, 0));
+            createSphereCapsulePairs(Vector3(0, 0, 20));
+            createCapsulePairs(Vector3(0, 0, 40));
+        }
+
+        /// Destructor
+        virtual ~TestPrimitiveNarrowPhase() {
+
+            mPhysicsCommon.destroyPhysicsWorld(mWorld);
+
+            for (uint i=0; i < mSphereShapes.size(); i++) {
+                mPhysicsCommon.destroySphereShape(mSphereShapes[i]);
+            }
+            for (uint i=0; i < mCapsuleShapes.size(); i++) {
+                mPhysicsCommon.destroyCapsuleShape(mCapsuleShapes[i]);
+            }
+        }
+
+        /// Run the tests
+        void run() {
+
+            testCollisionContacts();
+            testOverlap();
+        }
+
+        /// Test that the contacts of all the pairs are reported with the correct penetration depth
+        void testCollisionContacts() {
+
+            PrimitivePairsCollisionCallback callback;
+            mWorld->testCollision(callback);
+
+            for (uint i=0; i < mBodies1.size(); i++) {
+
+                const bool isColliding = mExpectedPenetrationDepths[i] > decimal(0.0);
+                rp3d_test(isColliding == (callback.mPenetrationDepths.count(mBodies1[i]) == 1));
+                rp3d_test(isColliding == (callback.mPenetrationDepths.count(mBodies2[i]) == 1));
+
+                if (isColliding) {
+                    rp3d_test(approxEqual(callback.mPenetrationDepths[mBodies1[i]], mExpectedPenetrationDepths[i], decimal(0.001)));
+                }
+            }
+        }
+
+        /// Test that the overlapping pairs are reported when the contacts are not computed
+        void testOverlap() {
+
+            PrimitivePairsOverlapCallback callback;
+            mWorld->testOverlap(callback);
+
+            for (uint i=0; i < mBodies1.size(); i++) {
+
+                const bool isColliding = mExpectedPenetrationDepths[i] > decimal(0.0);
+                rp3d_test(isColliding == (callback.mOverlappingBodies.count(mBodies1[i]) == 1));
+                rp3d_test(isColliding == (callback.mOverlappingBodies.count(mBodies2[i]) == 1));
+            }
+        }
+};
+
+}
+
+#endif
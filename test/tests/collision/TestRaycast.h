@@ -327,6 +327,7 @@ class TestRaycast : public Test {
             testCompound();
             testConcaveMesh();
             testHeightField();
+            testHeightFieldGridWalk();
         }
 
         /// Test the Collider::raycast(), CollisionBody::raycast() and
@@ -1742,6 +1743,86 @@ class TestRaycast : public Test {
             mWorld->raycast(Ray(ray14.point1, ray14.point2, decimal(0.8)), &mCallback);
             rp3d_test(mCallback.isHit);
         }
+
+        /// Test the raycast of a non-flat and scaled height field against the
+        /// triangles returned by HeightFieldShape::computeOverlappingTriangles()
+        void testHeightFieldGridWalk() {
+
+            // Non-flat height field larger than a block of cells
+            const int nbColumns = 37;
+            const int nbRows = 23;
+            std::vector<float> heights(nbColumns * nbRows);
+            for (int j=0; j < nbRows; j++) {
+                for (int i=0; i < nbColumns; i++) {
+                    heights[j * nbColumns + i] = float(3 * std::sin(i * 0.4) * std::cos(j * 0.3) + ((i * 7 + j * 3) % 5) * 0.2);
+                }
+            }
+
+            HeightFieldShape* heightFieldShape = mPhysicsCommon.createHeightFieldShape(nbColumns, nbRows, -3, 4, heights.data(),
+                                                                                        HeightFieldShape::HeightDataType::HEIGHT_FLOAT_TYPE,
+                                                                                        1, 1, Vector3(2, decimal(1.5), decimal(0.5)));
+            CollisionBody* body = mWorld->createCollisionBody(Transform::identity());
+            Collider* collider = body->addCollider(heightFieldShape, Transform::identity());
+
+            // Compute all the triangles of the height field
+            Vector3 min, max;
+            heightFieldShape->getLocalBounds(min, max);
+            List<Vector3> triangleVertices(mAllocator);
+            List<Vector3> triangleNormals(mAllocator);
+            List<uint> shapeIds(mAllocator);
+            heightFieldShape->computeOverlappingTriangles(AABB(min, max), triangleVertices, triangleNormals, shapeIds, mAllocator);
+            rp3d_test(shapeIds.size() == uint((nbColumns - 1) * (nbRows - 1) * 2));
+
+            int nbHits = 0;
+            for (int k=0; k < 200; k++) {
+
+                // Rays going down across the height field in different directions
+                const decimal angle = k * decimal(0.173);
+                const Vector3 center(std::sin(k * decimal(1.3)) * 20, 0, std::cos(k * decimal(0.7)) * 4);
+                const Vector3 offset(std::cos(angle) * 45, decimal(7) - (k % 9), std::sin(angle) * 15);
+                const Ray ray(center + offset, center - offset - Vector3(0, 3, 0), decimal(0.5) + (k % 4) * decimal(0.25));
+
+                // Find the closest triangle hit by the ray (front faces only)
+                bool isExpectedHit = false;
+                decimal expectedHitFraction = ray.maxFraction;
+                const Vector3 pq = ray.point2 - ray.point1;
+                for (uint t=0; t < shapeIds.size(); t++) {
+                    const Vector3& a = triangleVertices[t * 3];
+                    const Vector3& b = triangleVertices[t * 3 + 1];
+                    const Vector3& c = triangleVertices[t * 3 + 2];
+                    const Vector3 normal = (b - a).cross(c - a);
+                    const decimal denom = normal.dot(pq);
+                    if (denom >= 0) continue;
+                    const decimal fraction = normal.dot(a - ray.point1) / denom;
+                    if (fraction < 0 || fraction > expectedHitFraction) continue;
+                    const Vector3 point = ray.point1 + fraction * pq;
+                    if ((b - a).cross(point - a).dot(normal) < 0 || (c - b).cross(point - b).dot(normal) < 0 ||
+                        (a - c).cross(point - c).dot(normal) < 0) continue;
+                    expectedHitFraction = fraction;
+                    isExpectedHit = true;
+                }
+
+                RaycastInfo raycastInfo;
+                const bool isHit = collider->raycast(ray, raycastInfo);
+                rp3d_test(isHit == isExpectedHit);
+                if (isHit && isExpectedHit) {
+                    nbHits++;
+                    rp3d_test(approxEqual(raycastInfo.hitFraction, expectedHitFraction, epsilon));
+                    const Vector3 hitPoint = ray.point1 + expectedHitFraction * pq;
+                    rp3d_test(approxEqual(raycastInfo.worldPoint.x, hitPoint.x, epsilon));
+                    rp3d_test(approxEqual(raycastInfo.worldPoint.y, hitPoint.y, epsilon));
+                    rp3d_test(approxEqual(raycastInfo.worldPoint.z, hitPoint.z, epsilon));
+                }
+            }
+
+            // Make sure that both hits and misses are tested
+            rp3d_test(nbHits > 20);
+            rp3d_test(nbHits < 200);
+
+            body->removeCollider(collider);
+            mWorld->destroyCollisionBody(body);
+            mPhysicsCommon.destroyHeightFieldShape(heightFieldShape);
+        }
 };
 
 }
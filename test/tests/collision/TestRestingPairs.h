@@ -0,0 +1,466 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_RESTING_PAIRS_H
+#define TEST_RESTING_PAIRS_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <cmath>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class RestingPairsContactsListener
+/**
+ * This event listener keeps the number of contact points, the sum of their penetration depths and
+ * the contact normal of the contact pairs of three pairs of bodies in the last update of a world
+ */
+class RestingPairsContactsListener : public EventListener {
+
+    public:
+
+        /// First body of each pair of bodies (the contact normal is reported from this body)
+        CollisionBody* bodies1[3];
+
+        /// Number of contact points of each pair of bodies
+        uint nbContactPoints[3];
+
+        /// Sum of the penetration depths of the contact points of each pair of bodies
+        decimal sumPenetrationDepths[3];
+
+        /// Contact normal (from the first body to the second one) of the last contact point of each pair of bodies
+        Vector3 normals[3];
+
+        /// Reset the contacts
+        void reset() {
+            for (int i=0; i < 3; i++) {
+                nbContactPoints[i] = 0;
+                sumPenetrationDepths[i] = decimal(0.0);
+                normals[i].setToZero();
+            }
+        }
+
+        /// Called when some contacts occur
+        virtual void onContact(const CollisionCallback::CallbackData& callbackData) override {
+
+            for (uint p=0; p < callbackData.getNbContactPairs(); p++) {
+
+                CollisionCallback::ContactPair contactPair = callbackData.getContactPair(p);
+                for (int i=0; i < 3; i++) {
+
+                    const bool isBody1First = contactPair.getBody1() == bodies1[i];
+                    if (!isBody1First && contactPair.getBody2() != bodies1[i]) continue;
+
+                    for (uint c=0; c < contactPair.getNbContactPoints(); c++) {
+
+                        CollisionCallback::ContactPoint contactPoint = contactPair.getContactPoint(c);
+                        nbContactPoints[i]++;
+                        sumPenetrationDepths[i] += contactPoint.getPenetrationDepth();
+                        normals[i] = isBody1First ? contactPoint.getWorldNormal() : -contactPoint.getWorldNormal();
+                    }
+                }
+            }
+        }
+};
+
+// Class RestingPairsQueriesCallback
+/**
+ * This callback counts the contact points of the collision queries of the user
+ */
+class RestingPairsQueriesCallback : public CollisionCallback, public OverlapCallback {
+
+    public:
+
+        /// Number of contact points of the collision queries
+        uint nbContactPoints = 0;
+
+        /// Number of overlapping pairs of the overlap queries
+        uint nbOverlappingPairs = 0;
+
+        /// Called when some contacts are reported by a collision query
+        virtual void onContact(const CollisionCallback::CallbackData& callbackData) override {
+
+            for (uint p=0; p < callbackData.getNbContactPairs(); p++) {
+                nbContactPoints += callbackData.getContactPair(p).getNbContactPoints();
+            }
+        }
+
+        /// Called when some overlapping pairs are reported by an overlap query
+        virtual void onOverlap(OverlapCallback::CallbackData& callbackData) override {
+            nbOverlappingPairs += callbackData.getNbOverlappingPairs();
+        }
+};
+
+// Class TestRestingPairs
+/**
+ * Unit test for the reuse of the contacts of the overlapping pairs at rest. A box lies on a static
+ * box, another box lies on a static concave mesh and a third box lies on a box that is not static.
+ * The bodies are moved by small amounts and the contacts of a world that reuses the contacts of the
+ * pairs at rest are compared with the contacts of a world where all the pairs are tested by the
+ * narrow-phase.
+ */
+class TestRestingPairs : public Test {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Relative translation of the colliders of a pair to reuse its contacts
+        static constexpr decimal LINEAR_THRESHOLD = decimal(0.005);
+
+        /// Relative rotation angle (in radians) of the colliders of a pair to reuse its contacts
+        static constexpr decimal ANGULAR_THRESHOLD = decimal(0.01);
+
+        /// Half-extent of the boxes
+        static constexpr decimal BOX_HALF_EXTENT = decimal(0.5);
+
+        /// Number of pairs of bodies in contact
+        static const uint NB_PAIRS = 3;
+
+        /// Time step of the updates
+        static constexpr decimal TIME_STEP = decimal(1.0 / 60.0);
+
+        // ---------- Attributes ---------- //
+
+        PhysicsCommon mPhysicsCommon;
+
+        BoxShape* mGroundShape;
+        BoxShape* mBoxShape;
+
+        float mMeshVertices[12];
+        int mMeshIndices[6];
+        TriangleVertexArray* mTriangleVertexArray;
+        TriangleMesh* mTriangleMesh;
+        ConcaveMeshShape* mConcaveMeshShape;
+
+        /// World where the contacts of the pairs at rest are reused
+        PhysicsWorld* mWorld;
+
+        /// World where the contacts of all the pairs are computed by the narrow-phase
+        PhysicsWorld* mReferenceWorld;
+
+        /// Bodies of the two worlds (box on the ground, box on the mesh, upper and lower boxes of the stack)
+        RigidBody* mBoxBodies[2];
+        RigidBody* mMeshBoxBodies[2];
+        RigidBody* mUpperBoxBodies[2];
+        RigidBody* mLowerBoxBodies[2];
+
+        /// Contacts of the last update of the two worlds
+        RestingPairsContactsListener mListeners[2];
+
+        // ---------- Methods ---------- //
+
+        /// Create the bodies of a world
+        void createBodies(PhysicsWorld* world, int w) {
+
+            RigidBody* ground = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            ground->setType(BodyType::STATIC);
+            ground->addCollider(mGroundShape, Transform::identity());
+
+            RigidBody* meshGround = world->createRigidBody(Transform(Vector3(20, 0, 0), Quaternion::identity()));
+            meshGround->setType(BodyType::STATIC);
+            meshGround->addCollider(mConcaveMeshShape, Transform::identity());
+
+            mBoxBodies[w] = createBox(world);
+            mMeshBoxBodies[w] = createBox(world);
+            mUpperBoxBodies[w] = createBox(world);
+            mLowerBoxBodies[w] = createBox(world);
+
+            mListeners[w].bodies1[0] = mBoxBodies[w];
+            mListeners[w].bodies1[1] = mMeshBoxBodies[w];
+            mListeners[w].bodies1[2] = mUpperBoxBodies[w];
+            world->setEventListener(&(mListeners[w]));
+        }
+
+        /// Create a box body (without gravity) that is never sleeping
+        RigidBody* createBox(PhysicsWorld* world) {
+
+            RigidBody* body = world->createRigidBody(Transform(Vector3(0, 10, 0), Quaternion::identity()));
+            body->enableGravity(false);
+            body->setIsAllowedToSleep(false);
+            body->addCollider(mBoxShape, Transform::identity());
+            return body;
+        }
+
+        /// Move a body and reset its velocity
+        static void moveBody(RigidBody* body, const Transform& transform) {
+
+            body->setTransform(transform);
+            body->setLinearVelocity(Vector3::zero());
+            body->setAngularVelocity(Vector3::zero());
+        }
+
+        /// Move the bodies of the two worlds and update the worlds. The two boxes on the ground and on the mesh
+        /// are moved by a given offset and rotated around the vertical axis. The two boxes of the stack have
+        /// the same orientation and are rotated around the center of the lower box.
+        void updateWorlds(decimal penetrationDepth, const Vector3& offset, decimal yawAngle, const Quaternion& stackOrientation) {
+
+            const Quaternion yawOrientation = Quaternion::fromEulerAngles(0, yawAngle, 0);
+            const Vector3 stackCenter(-20, 0, 0);
+
+            for (int w=0; w < 2; w++) {
+
+                moveBody(mBoxBodies[w], Transform(Vector3(0, BOX_HALF_EXTENT - penetrationDepth, 0) + offset, yawOrientation));
+                moveBody(mMeshBoxBodies[w], Transform(Vector3(20, BOX_HALF_EXTENT - penetrationDepth, 0) + offset, yawOrientation));
+                moveBody(mLowerBoxBodies[w], Transform(stackCenter, stackOrientation));
+                moveBody(mUpperBoxBodies[w], Transform(stackCenter + stackOrientation * Vector3(0, 2 * BOX_HALF_EXTENT - penetrationDepth, 0),
+                                                       stackOrientation));
+
+                mListeners[w].reset();
+            }
+
+            mWorld->update(TIME_STEP);
+            mReferenceWorld->update(TIME_STEP);
+
+            rp3d_test(mWorld->getNarrowPhaseStatistics().nbOverlappingPairsTests == NB_PAIRS);
+            rp3d_test(mReferenceWorld->getNarrowPhaseStatistics().nbOverlappingPairsTests == NB_PAIRS);
+            rp3d_test(mReferenceWorld->getNarrowPhaseStatistics().nbRestingPairsSkippedTests == 0);
+        }
+
+        /// Return the number of pairs whose contacts have been reused in the last update
+        uint32 getNbSkippedPairs() const {
+            return mWorld->getNarrowPhaseStatistics().nbRestingPairsSkippedTests;
+        }
+
+        /// Check that the contacts of the last update of the two worlds are the same
+        void checkContacts() {
+
+            for (uint i=0; i < NB_PAIRS; i++) {
+
+                rp3d_test(mListeners[0].nbContactPoints[i] == mListeners[1].nbContactPoints[i]);
+                rp3d_test(approxEqual(mListeners[0].sumPenetrationDepths[i], mListeners[1].sumPenetrationDepths[i], decimal(0.0001)));
+                rp3d_test(approxEqual(mListeners[0].normals[i].x, mListeners[1].normals[i].x, decimal(0.0001)));
+                rp3d_test(approxEqual(mListeners[0].normals[i].y, mListeners[1].normals[i].y, decimal(0.0001)));
+                rp3d_test(approxEqual(mListeners[0].normals[i].z, mListeners[1].normals[i].z, decimal(0.0001)));
+            }
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestRestingPairs(const std::string& name) : Test(name) {
+
+            mGroundShape = mPhysicsCommon.createBoxShape(Vector3(10, 1, 10));
+            mBoxShape = mPhysicsCommon.createBoxShape(Vector3(BOX_HALF_EXTENT, BOX_HALF_EXTENT, BOX_HALF_EXTENT));
+
+            // Square of two triangles in the plane y=0
+            const float meshVertices[12] = {-5, 0, -5,   5, 0, -5,   5, 0, 5,   -5, 0, 5};
+            const int meshIndices[6] = {0, 2, 1,   0, 3, 2};
+            for (int i=0; i < 12; i++) mMeshVertices[i] = meshVertices[i];
+            for (int i=0; i < 6; i++) mMeshIndices[i] = meshIndices[i];
+            mTriangleVertexArray = new TriangleVertexArray(4, mMeshVertices, 3 * sizeof(float), 2, mMeshIndices, 3 * sizeof(int),
+                                                           TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                                           TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            mTriangleMesh = mPhysicsCommon.createTriangleMesh();
+            mTriangleMesh->addSubpart(mTriangleVertexArray);
+            mConcaveMeshShape = mPhysicsCommon.createConcaveMeshShape(mTriangleMesh);
+
+            PhysicsWorld::WorldSettings settings;
+            settings.restingPairLinearThreshold = LINEAR_THRESHOLD;
+            settings.restingPairAngularThreshold = ANGULAR_THRESHOLD;
+            mWorld = mPhysicsCommon.createPhysicsWorld(settings);
+            mReferenceWorld = mPhysicsCommon.createPhysicsWorld();
+
+            createBodies(mWorld, 0);
+            createBodies(mReferenceWorld, 1);
+        }
+
+        /// Destructor
+        virtual ~TestRestingPairs() {
+
+            mPhysicsCommon.destroyPhysicsWorld(mWorld);
+            mPhysicsCommon.destroyPhysicsWorld(mReferenceWorld);
+            mPhysicsCommon.destroyBoxShape(mGroundShape);
+            mPhysicsCommon.destroyBoxShape(mBoxShape);
+            mPhysicsCommon.destroyConcaveMeshShape(mConcaveMeshShape);
+            mPhysicsCommon.destroyTriangleMesh(mTriangleMesh);
+            delete mTriangleVertexArray;
+        }
+
+        /// Run the tests
+        void run() {
+
+            testRestingPairs();
+            testTranslation();
+            testRotation();
+            testRotatingStack();
+            testCollisionQueries();
+            testSeparation();
+            testResizedShape();
+        }
+
+        /// Test that the contacts of the pairs that do not move are reused
+        void testRestingPairs() {
+
+            const decimal penetrationDepth = decimal(0.01);
+
+            updateWorlds(penetrationDepth, Vector3::zero(), 0, Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == 0);
+            checkContacts();
+            rp3d_test(mListeners[0].nbContactPoints[0] == 4);
+            rp3d_test(mListeners[0].nbContactPoints[1] > 0);
+            rp3d_test(mListeners[0].nbContactPoints[2] == 4);
+
+            for (int i=0; i < 10; i++) {
+                updateWorlds(penetrationDepth, Vector3::zero(), 0, Quaternion::identity());
+                rp3d_test(getNbSkippedPairs() == NB_PAIRS);
+                checkContacts();
+            }
+
+            rp3d_test(mWorld->getNarrowPhaseStatistics().getRestingPairsSkipRate() == decimal(1.0));
+            rp3d_test(mReferenceWorld->getNarrowPhaseStatistics().getRestingPairsSkipRate() == decimal(0.0));
+        }
+
+        /// Test that the reused contacts follow a small translation of the boxes and that the contacts
+        /// are computed again when the translation since the last narrow-phase is larger than the threshold
+        void testTranslation() {
+
+            const decimal penetrationDepth = decimal(0.02);
+            updateWorlds(penetrationDepth, Vector3::zero(), 0, Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == 0);
+
+            // The boxes move down and slide on the ground
+            for (int i=1; i <= 4; i++) {
+                const decimal displacement = decimal(0.001) * decimal(i);
+                updateWorlds(penetrationDepth + displacement * decimal(0.5), Vector3(displacement, 0, 0), 0, Quaternion::identity());
+                rp3d_test(getNbSkippedPairs() == NB_PAIRS);
+                checkContacts();
+            }
+
+            // Only the contacts of the stack (that does not move) are reused
+            updateWorlds(penetrationDepth + decimal(0.003), Vector3(decimal(0.006), 0, 0), 0, Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == 1);
+            checkContacts();
+        }
+
+        /// Test that the contacts are computed again when the rotation since the last narrow-phase is larger
+        /// than the threshold
+        void testRotation() {
+
+            const decimal penetrationDepth = decimal(0.01);
+            updateWorlds(penetrationDepth, Vector3::zero(), 0, Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == 0);
+
+            updateWorlds(penetrationDepth, Vector3::zero(), decimal(0.004), Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == NB_PAIRS);
+            checkContacts();
+
+            updateWorlds(penetrationDepth, Vector3::zero(), decimal(0.008), Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == NB_PAIRS);
+            checkContacts();
+
+            updateWorlds(penetrationDepth, Vector3::zero(), decimal(0.012), Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == 1);
+            checkContacts();
+        }
+
+        /// Test that the normals of the reused contacts of two boxes that are rotating together (without
+        /// relative motion) are rotated with the boxes
+        void testRotatingStack() {
+
+            const decimal penetrationDepth = decimal(0.01);
+            updateWorlds(penetrationDepth, Vector3::zero(), 0, Quaternion::identity());
+
+            for (int i=1; i <= 10; i++) {
+                const Quaternion stackOrientation = Quaternion::fromEulerAngles(decimal(0.3) * decimal(i), decimal(0.2) * decimal(i), 0);
+                updateWorlds(penetrationDepth, Vector3::zero(), 0, stackOrientation);
+                rp3d_test(getNbSkippedPairs() == NB_PAIRS);
+                checkContacts();
+            }
+        }
+
+        /// Test that the collision queries of the user between two updates do not change the reused contacts
+        void testCollisionQueries() {
+
+            const decimal penetrationDepth = decimal(0.02);
+            updateWorlds(penetrationDepth, Vector3::zero(), 0, Quaternion::identity());
+            updateWorlds(penetrationDepth, Vector3::zero(), 0, Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == NB_PAIRS);
+
+            for (int i=0; i < 3; i++) {
+
+                RestingPairsQueriesCallback callback;
+                mWorld->testCollision(callback);
+                mWorld->testOverlap(callback);
+                rp3d_test(callback.nbContactPoints == mListeners[0].nbContactPoints[0] + mListeners[0].nbContactPoints[1] +
+                                                      mListeners[0].nbContactPoints[2]);
+                rp3d_test(callback.nbOverlappingPairs == NB_PAIRS);
+
+                updateWorlds(penetrationDepth, Vector3::zero(), 0, Quaternion::identity());
+                rp3d_test(getNbSkippedPairs() == NB_PAIRS);
+                checkContacts();
+            }
+        }
+
+        /// Test that the contacts are computed again when the reused contacts do not penetrate anymore
+        void testSeparation() {
+
+            updateWorlds(decimal(0.001), Vector3::zero(), 0, Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == 0);
+
+            // The boxes move up and are not in contact anymore
+            updateWorlds(decimal(-0.002), Vector3::zero(), 0, Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == 0);
+            checkContacts();
+            for (uint i=0; i < NB_PAIRS; i++) {
+                rp3d_test(mListeners[0].nbContactPoints[i] == 0);
+            }
+
+            // The contacts are computed by the narrow-phase until the boxes collide again
+            updateWorlds(decimal(-0.002), Vector3::zero(), 0, Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == 0);
+            updateWorlds(decimal(0.001), Vector3::zero(), 0, Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == 0);
+            updateWorlds(decimal(0.001), Vector3::zero(), 0, Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == NB_PAIRS);
+            checkContacts();
+        }
+
+        /// Test that the contacts of a box are computed again when the size of its shape changes
+        void testResizedShape() {
+
+            const decimal penetrationDepth = decimal(0.01);
+            updateWorlds(penetrationDepth, Vector3::zero(), 0, Quaternion::identity());
+            updateWorlds(penetrationDepth, Vector3::zero(), 0, Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == NB_PAIRS);
+
+            mBoxShape->setHalfExtents(Vector3(BOX_HALF_EXTENT, BOX_HALF_EXTENT, BOX_HALF_EXTENT) * decimal(1.01));
+            updateWorlds(penetrationDepth, Vector3::zero(), 0, Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == 0);
+            checkContacts();
+
+            mBoxShape->setHalfExtents(Vector3(BOX_HALF_EXTENT, BOX_HALF_EXTENT, BOX_HALF_EXTENT));
+            updateWorlds(penetrationDepth, Vector3::zero(), 0, Quaternion::identity());
+            rp3d_test(getNbSkippedPairs() == 0);
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,368 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_SAT_ALGORITHM_H
+#define TEST_SAT_ALGORITHM_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <reactphysics3d/collision/ConvexPolyhedronArrays.h>
+#include <reactphysics3d/mathematics/SimdDecimal.h>
+#include <cmath>
+#include <algorithm>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestSATAlgorithm
+/**
+ * Unit test for the SAT algorithm between two convex polyhedra. The faces and edges of the
+ * boxes and convex meshes are tested several at a time with SIMD instructions using the arrays
+ * of the polyhedra. This test checks the content of those arrays and compares the collision
+ * status of random poses of two polyhedra with a separation computed on all the candidate
+ * separating axes (face normals and cross products of edges).
+ */
+class TestSATAlgorithm : public Test {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Number of convex meshes (prisms)
+        static const int NB_PRISMS = 2;
+
+        /// Maximum number of sides of a prism
+        static const int MAX_NB_PRISM_SIDES = 8;
+
+        /// Number of random poses
+        static const int NB_POSES = 3000;
+
+        /// Collision status of a pose is not checked if the separation of the polyhedra is closer
+        /// to zero than this tolerance
+        static constexpr decimal SEPARATION_TOLERANCE = decimal(0.005);
+
+        // ---------- Attributes ---------- //
+
+        PhysicsCommon mPhysicsCommon;
+
+        PhysicsWorld* mWorld;
+
+        float mPrismsVertices[NB_PRISMS][2 * MAX_NB_PRISM_SIDES * 3];
+        int mPrismsIndices[NB_PRISMS][6 * MAX_NB_PRISM_SIDES];
+        PolygonVertexArray::PolygonFace mPrismsFaces[NB_PRISMS][MAX_NB_PRISM_SIDES + 2];
+        PolygonVertexArray* mPolygonVertexArrays[NB_PRISMS];
+        PolyhedronMesh* mPolyhedronMeshes[NB_PRISMS];
+
+        ConvexMeshShape* mConvexMeshShapes[NB_PRISMS];
+        BoxShape* mBoxShape;
+
+        uint32 mRandomSeed;
+
+        // ---------- Methods ---------- //
+
+        /// Return a pseudo-random number in the range [min, max]
+        decimal random(decimal min, decimal max) {
+            mRandomSeed = mRandomSeed * 1664525u + 1013904223u;
+            return min + (max - min) * decimal(mRandomSeed >> 8) / decimal(1 << 24);
+        }
+
+        /// Return a pseudo-random orientation
+        Quaternion randomOrientation() {
+            return Quaternion::fromEulerAngles(random(-PI, PI), random(-PI, PI), random(-PI, PI));
+        }
+
+        /// Create a convex mesh of a prism with a given number of sides (along the y axis)
+        void createPrism(int prismIndex, int nbSides, const Vector3& scale) {
+
+            for (int k=0; k < 2; k++) {
+                for (int i=0; i < nbSides; i++) {
+                    const decimal angle = PI_TIMES_2 * decimal(i) / decimal(nbSides);
+                    float* vertex = &(mPrismsVertices[prismIndex][(k * nbSides + i) * 3]);
+                    vertex[0] = float(std::cos(angle));
+                    vertex[1] = k == 0 ? -1.0f : 1.0f;
+                    vertex[2] = float(std::sin(angle));
+                }
+            }
+
+            // Bottom and top faces
+            int* indices = mPrismsIndices[prismIndex];
+            int nbIndices = 0;
+            for (int i=0; i < nbSides; i++) {
+                indices[nbIndices++] = i;
+            }
+            for (int i=nbSides - 1; i >= 0; i--) {
+                indices[nbIndices++] = nbSides + i;
+            }
+            mPrismsFaces[prismIndex][0].indexBase = 0;
+            mPrismsFaces[prismIndex][0].nbVertices = nbSides;
+            mPrismsFaces[prismIndex][1].indexBase = nbSides;
+            mPrismsFaces[prismIndex][1].nbVertices = nbSides;
+
+            // Side faces
+            for (int i=0; i < nbSides; i++) {
+                mPrismsFaces[prismIndex][2 + i].indexBase = nbIndices;
+                mPrismsFaces[prismIndex][2 + i].nbVertices = 4;
+                indices[nbIndices++] = i;
+                indices[nbIndices++] = nbSides + i;
+                indices[nbIndices++] = nbSides + (i + 1) % nbSides;
+                indices[nbIndices++] = (i + 1) % nbSides;
+            }
+
+            mPolygonVertexArrays[prismIndex] = new PolygonVertexArray(2 * nbSides, &(mPrismsVertices[prismIndex][0]), 3 * sizeof(float),
+                    indices, sizeof(int), nbSides + 2, mPrismsFaces[prismIndex],
+                    PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                    PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            mPolyhedronMeshes[prismIndex] = mPhysicsCommon.createPolyhedronMesh(mPolygonVertexArrays[prismIndex]);
+            mConvexMeshShapes[prismIndex] = mPhysicsCommon.createConvexMeshShape(mPolyhedronMeshes[prismIndex], scale);
+        }
+
+        /// Check the arrays of faces and edges of a polyhedron
+        void checkPolyhedronArrays(const ConvexPolyhedronShape* polyhedron) {
+
+            Vector3 scale;
+            const ConvexPolyhedronArrays* arrays = polyhedron->getPolyhedronArrays(scale);
+            rp3d_test(arrays != nullptr);
+
+            const uint nbPaddedFaces = arrays->getNbPaddedFaces();
+            const uint nbPaddedEdges = arrays->getNbPaddedEdges();
+            rp3d_test(arrays->getNbFaces() == polyhedron->getNbFaces());
+            rp3d_test(2 * arrays->getNbEdges() == polyhedron->getNbHalfEdges());
+            rp3d_test(nbPaddedFaces % SIMD_DECIMAL_NB_LANES == 0);
+            rp3d_test(nbPaddedFaces >= arrays->getNbFaces() && nbPaddedFaces < arrays->getNbFaces() + SIMD_DECIMAL_NB_LANES);
+            rp3d_test(nbPaddedEdges % SIMD_DECIMAL_NB_LANES == 0);
+            rp3d_test(nbPaddedEdges >= arrays->getNbEdges() && nbPaddedEdges < arrays->getNbEdges() + SIMD_DECIMAL_NB_LANES);
+
+            for (uint f=0; f < arrays->getNbFaces(); f++) {
+
+                const Vector3 normal(arrays->getFacesNormals()[f], arrays->getFacesNormals()[nbPaddedFaces + f],
+                                     arrays->getFacesNormals()[2 * nbPaddedFaces + f]);
+                const Vector3 vertex(arrays->getFacesVertices()[f], arrays->getFacesVertices()[nbPaddedFaces + f],
+                                     arrays->getFacesVertices()[2 * nbPaddedFaces + f]);
+                rp3d_test(normal == polyhedron->getFaceNormal(f));
+                rp3d_test(vertex * scale == polyhedron->getVertexPosition(polyhedron->getFace(f).faceVertices[0]));
+            }
+
+            for (uint e=0; e < arrays->getNbEdges(); e++) {
+
+                const HalfEdgeStructure::Edge& edge = polyhedron->getHalfEdge(2 * e);
+                const HalfEdgeStructure::Edge& twinEdge = polyhedron->getHalfEdge(edge.twinEdgeIndex);
+
+                const Vector3 vertex1(arrays->getEdgesVertices1()[e], arrays->getEdgesVertices1()[nbPaddedEdges + e],
+                                      arrays->getEdgesVertices1()[2 * nbPaddedEdges + e]);
+                const Vector3 vertex2(arrays->getEdgesVertices2()[e], arrays->getEdgesVertices2()[nbPaddedEdges + e],
+                                      arrays->getEdgesVertices2()[2 * nbPaddedEdges + e]);
+                const Vector3 normal1(arrays->getEdgesFacesNormals1()[e], arrays->getEdgesFacesNormals1()[nbPaddedEdges + e],
+                                      arrays->getEdgesFacesNormals1()[2 * nbPaddedEdges + e]);
+                const Vector3 normal2(arrays->getEdgesFacesNormals2()[e], arrays->getEdgesFacesNormals2()[nbPaddedEdges + e],
+                                      arrays->getEdgesFacesNormals2()[2 * nbPaddedEdges + e]);
+
+                rp3d_test(vertex1 * scale == polyhedron->getVertexPosition(edge.vertexIndex));
+                rp3d_test(vertex2 * scale == polyhedron->getVertexPosition(twinEdge.vertexIndex));
+                rp3d_test(vertex2 * scale == polyhedron->getVertexPosition(polyhedron->getHalfEdge(edge.nextEdgeIndex).vertexIndex));
+                rp3d_test(normal1 == polyhedron->getFaceNormal(edge.faceIndex));
+                rp3d_test(normal2 == polyhedron->getFaceNormal(twinEdge.faceIndex));
+            }
+        }
+
+        /// Return the separation of two polyhedra along an axis (negative if their projections overlap)
+        static decimal computeSeparation(const ConvexPolyhedronShape* polyhedron1, const Transform& transform1,
+                                         const ConvexPolyhedronShape* polyhedron2, const Transform& transform2,
+                                         const Vector3& axis) {
+
+            decimal min1 = DECIMAL_LARGEST, max1 = DECIMAL_SMALLEST;
+            for (uint v=0; v < polyhedron1->getNbVertices(); v++) {
+                const decimal projection = (transform1 * polyhedron1->getVertexPosition(v)).dot(axis);
+                min1 = std::min(min1, projection);
+                max1 = std::max(max1, projection);
+            }
+
+            decimal min2 = DECIMAL_LARGEST, max2 = DECIMAL_SMALLEST;
+            for (uint v=0; v < polyhedron2->getNbVertices(); v++) {
+                const decimal projection = (transform2 * polyhedron2->getVertexPosition(v)).dot(axis);
+                min2 = std::min(min2, projection);
+                max2 = std::max(max2, projection);
+            }
+
+            return std::max(min2 - max1, min1 - max2);
+        }
+
+        /// Return the largest separation of two polyhedra along the face normals and the cross products of edges
+        /// (positive if the polyhedra are separated and negative if they overlap)
+        static decimal computeLargestSeparation(const ConvexPolyhedronShape* polyhedron1, const Transform& transform1,
+                                                const ConvexPolyhedronShape* polyhedron2, const Transform& transform2) {
+
+            decimal largestSeparation = DECIMAL_SMALLEST;
+
+            for (uint f=0; f < polyhedron1->getNbFaces(); f++) {
+                const Vector3 axis = transform1.getOrientation() * polyhedron1->getFaceNormal(f);
+                largestSeparation = std::max(largestSeparation, computeSeparation(polyhedron1, transform1, polyhedron2, transform2, axis));
+            }
+            for (uint f=0; f < polyhedron2->getNbFaces(); f++) {
+                const Vector3 axis = transform2.getOrientation() * polyhedron2->getFaceNormal(f);
+                largestSeparation = std::max(largestSeparation, computeSeparation(polyhedron1, transform1, polyhedron2, transform2, axis));
+            }
+
+            for (uint i=0; i < polyhedron1->getNbHalfEdges(); i += 2) {
+
+                const HalfEdgeStructure::Edge& edge1 = polyhedron1->getHalfEdge(i);
+                const Vector3 edge1Direction = transform1.getOrientation() *
+                        (polyhedron1->getVertexPosition(polyhedron1->getHalfEdge(edge1.twinEdgeIndex).vertexIndex) -
+                         polyhedron1->getVertexPosition(edge1.vertexIndex));
+
+                for (uint j=0; j < polyhedron2->getNbHalfEdges(); j += 2) {
+
+                    const HalfEdgeStructure::Edge& edge2 = polyhedron2->getHalfEdge(j);
+                    const Vector3 edge2Direction = transform2.getOrientation() *
+                            (polyhedron2->getVertexPosition(polyhedron2->getHalfEdge(edge2.twinEdgeIndex).vertexIndex) -
+                             polyhedron2->getVertexPosition(edge2.vertexIndex));
+
+                    const Vector3 cross = edge1Direction.cross(edge2Direction);
+                    if (cross.lengthSquare() > decimal(0.0001)) {
+                        largestSeparation = std::max(largestSeparation, computeSeparation(polyhedron1, transform1, polyhedron2,
+                                                                                          transform2, cross.getUnit()));
+                    }
+                }
+            }
+
+            return largestSeparation;
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestSATAlgorithm(const std::string& name) : Test(name), mRandomSeed(7) {
+
+            mWorld = mPhysicsCommon.createPhysicsWorld();
+
+            // The scales of the prisms do not change the directions of their face normals
+            createPrism(0, 5, Vector3(decimal(0.8), decimal(0.5), decimal(0.8)));
+            createPrism(1, MAX_NB_PRISM_SIDES, Vector3(decimal(0.6), decimal(1.1), decimal(0.6)));
+            mBoxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.4), decimal(1.3), decimal(0.7)));
+        }
+
+        /// Destructor
+        virtual ~TestSATAlgorithm() {
+
+            mPhysicsCommon.destroyPhysicsWorld(mWorld);
+
+            mPhysicsCommon.destroyBoxShape(mBoxShape);
+            for (int i=0; i < NB_PRISMS; i++) {
+                mPhysicsCommon.destroyConvexMeshShape(mConvexMeshShapes[i]);
+                mPhysicsCommon.destroyPolyhedronMesh(mPolyhedronMeshes[i]);
+                delete mPolygonVertexArrays[i];
+            }
+        }
+
+        /// Run the tests
+        void run() {
+
+            testPolyhedronArrays();
+            testCompareWithSeparatingAxes();
+        }
+
+        /// Test the arrays of faces and edges of the polyhedra
+        void testPolyhedronArrays() {
+
+            checkPolyhedronArrays(mBoxShape);
+            for (int i=0; i < NB_PRISMS; i++) {
+                checkPolyhedronArrays(mConvexMeshShapes[i]);
+            }
+
+            // The arrays of a box are scaled by its half-extents
+            Vector3 scale;
+            mBoxShape->getPolyhedronArrays(scale);
+            rp3d_test(scale == mBoxShape->getHalfExtents());
+            mBoxShape->setHalfExtents(Vector3(decimal(0.5), decimal(0.2), decimal(0.9)));
+            checkPolyhedronArrays(mBoxShape);
+            mBoxShape->setHalfExtents(Vector3(decimal(0.4), decimal(1.3), decimal(0.7)));
+        }
+
+        /// Compare the collision status of random poses of two polyhedra with their separation
+        void testCompareWithSeparatingAxes() {
+
+            ConvexPolyhedronShape* polyhedra[3] = {mConvexMeshShapes[0], mConvexMeshShapes[1], mBoxShape};
+
+            // Pairs of polyhedra (the box vs box pairs are tested by another algorithm)
+            const int pairs[8][2] = {{0, 0}, {0, 1}, {0, 2}, {1, 0}, {1, 1}, {1, 2}, {2, 0}, {2, 1}};
+
+            CollisionBody* body1 = mWorld->createCollisionBody(Transform::identity());
+            CollisionBody* body2 = mWorld->createCollisionBody(Transform::identity());
+
+            int nbCollidingPoses = 0;
+            int nbSeparatedPoses = 0;
+            int nbMissedCollidingPoses = 0;
+
+            for (int p=0; p < NB_POSES; p++) {
+
+                ConvexPolyhedronShape* polyhedron1 = polyhedra[pairs[p % 8][0]];
+                ConvexPolyhedronShape* polyhedron2 = polyhedra[pairs[p % 8][1]];
+
+                const Transform transform1(Vector3(random(-1, 1), random(-1, 1), random(-1, 1)), randomOrientation());
+                const Transform transform2(Vector3(random(-1, 1), random(-1, 1), random(-1, 1)), randomOrientation());
+
+                body1->setTransform(transform1);
+                body2->setTransform(transform2);
+                Collider* collider1 = body1->addCollider(polyhedron1, Transform::identity());
+                Collider* collider2 = body2->addCollider(polyhedron2, Transform::identity());
+
+                const decimal separation = computeLargestSeparation(polyhedron1, transform1, polyhedron2, transform2);
+                if (std::abs(separation) > SEPARATION_TOLERANCE) {
+
+                    const bool isOverlapping = mWorld->testOverlap(body1, body2);
+                    if (separation > decimal(0.0)) {
+
+                        // A separating axis exists, the polyhedra cannot be reported as overlapping
+                        rp3d_test(!isOverlapping);
+                        nbSeparatedPoses++;
+                    }
+                    else {
+
+                        // The contact points of a few deep configurations cannot be found by
+                        // clipping the faces, those poses are reported as not overlapping
+                        nbCollidingPoses++;
+                        nbMissedCollidingPoses += !isOverlapping;
+                    }
+                }
+
+                body1->removeCollider(collider1);
+                body2->removeCollider(collider2);
+            }
+
+            // Make sure that both cases have been tested
+            rp3d_test(nbCollidingPoses > NB_POSES / 10);
+            rp3d_test(nbSeparatedPoses > NB_POSES / 10);
+            rp3d_test(nbMissedCollidingPoses < nbCollidingPoses / 50);
+
+            mWorld->destroyCollisionBody(body1);
+            mWorld->destroyCollisionBody(body2);
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,293 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_STATIC_AABB_TREE_H
+#define TEST_STATIC_AABB_TREE_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/collision/broadphase/StaticAABBTree.h>
+#include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/mathematics/Ray.h>
+#include <reactphysics3d/memory/DefaultAllocator.h>
+#include <set>
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class StaticTreeRaycastCallback
+/**
+ * Raycast callback that records the objects hit by a ray and that can clip the ray
+ * at the entry point of the AABB of each object
+ */
+class StaticTreeRaycastCallback : public DynamicAABBTreeRaycastCallback {
+
+    public:
+
+        std::set<int32> mHitObjects;
+
+        const List<AABB>* mObjectsAABBs = nullptr;
+
+        decimal mClosestFraction = DECIMAL_LARGEST;
+
+        // Called when the AABB of a leaf is hit by a ray
+        virtual decimal raycastBroadPhaseShape(int32 objectId, const Ray& ray) override {
+
+            mHitObjects.insert(objectId);
+
+            if (mObjectsAABBs == nullptr) return decimal(-1.0);
+
+            // Clip the ray at the fraction where it enters the exact AABB of the object
+            decimal fraction;
+            if (computeEntryFraction(ray, (*mObjectsAABBs)[objectId], fraction)) {
+                mClosestFraction = std::min(mClosestFraction, fraction);
+                return fraction;
+            }
+            return decimal(-1.0);
+        }
+
+        // Compute the fraction where a ray enters an AABB
+        static bool computeEntryFraction(const Ray& ray, const AABB& aabb, decimal& outFraction) {
+            decimal entry = 0, exit = ray.maxFraction;
+            const Vector3 direction = ray.point2 - ray.point1;
+            for (int i=0; i < 3; i++) {
+                decimal t1 = (aabb.getMin()[i] - ray.point1[i]) / direction[i];
+                decimal t2 = (aabb.getMax()[i] - ray.point1[i]) / direction[i];
+                if (t1 > t2) std::swap(t1, t2);
+                entry = std::max(entry, t1);
+                exit = std::min(exit, t2);
+            }
+            outFraction = entry;
+            return entry <= exit;
+        }
+};
+
+// Class TestStaticAABBTree
+/**
+ * Unit test for the static AABB tree
+ */
+class TestStaticAABBTree : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        DefaultAllocator mAllocator;
+
+        /// State of the pseudo-random generator
+        uint32 mRandomState;
+
+        // ---------- Methods ---------- //
+
+        /// Return a pseudo-random number in [min, max]
+        decimal random(decimal min, decimal max) {
+            mRandomState = mRandomState * 1664525u + 1013904223u;
+            return min + (max - min) * decimal(mRandomState >> 8) / decimal(1 << 24);
+        }
+
+        /// Fill a list with random AABBs
+        void createRandomAABBs(List<AABB>& aabbs, uint32 nbAABBs, decimal offset) {
+            for (uint32 i=0; i < nbAABBs; i++) {
+                const Vector3 center(random(-50, 50) + offset, random(-10, 10) + offset, random(-50, 50) + offset);
+                const Vector3 halfExtents(random(decimal(0.01), 2), random(decimal(0.01), 2), random(decimal(0.01), 2));
+                aabbs.add(AABB(center - halfExtents, center + halfExtents));
+            }
+        }
+
+        /// Return true if an AABB contains another one up to a small tolerance
+        static bool isAlmostContained(const AABB& aabb, const AABB& otherAABB, decimal tolerance) {
+            AABB inflatedAABB = aabb;
+            inflatedAABB.inflate(tolerance, tolerance, tolerance);
+            return inflatedAABB.contains(otherAABB);
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestStaticAABBTree(const std::string& name): Test(name), mRandomState(4242) {
+
+        }
+
+        /// Run the tests
+        void run() {
+
+            testNodeQuantization();
+            testSmallTrees();
+            testOverlap();
+            testRaycast();
+        }
+
+        void testNodeQuantization() {
+
+            StaticAABBTreeNode node;
+            const AABB nodeAABB(Vector3(1000, -3, decimal(0.5)), Vector3(decimal(1000.75), 20, decimal(0.5)));
+
+            for (int i=0; i < 100; i++) {
+
+                Vector3 min(random(1000, decimal(1000.75)), random(-3, 20), decimal(0.5));
+                Vector3 max(random(1000, decimal(1000.75)), random(-3, 20), decimal(0.5));
+                const AABB childAABB(Vector3::min(min, max), Vector3::max(min, max));
+
+                const AABB decodedAABB = node.encodeChildAABB(i % 2, nodeAABB, childAABB);
+
+                // The decoded AABB contains the child AABB, is close to it and is always decoded the same way
+                rp3d_test(decodedAABB.contains(childAABB));
+                rp3d_test(nodeAABB.contains(decodedAABB));
+                rp3d_test(isAlmostContained(childAABB, decodedAABB, decimal(0.001)));
+                const AABB decodedAgainAABB = node.decodeChildAABB(i % 2, nodeAABB);
+                rp3d_test(decodedAgainAABB.getMin() == decodedAABB.getMin());
+                rp3d_test(decodedAgainAABB.getMax() == decodedAABB.getMax());
+            }
+
+            rp3d_test(sizeof(StaticAABBTreeNode) == 32);
+        }
+
+        void testSmallTrees() {
+
+            StaticAABBTree tree(mAllocator);
+
+            // Empty tree
+            List<AABB> aabbs(mAllocator);
+            tree.build(aabbs);
+            List<int32> overlappingObjects(mAllocator);
+            tree.reportAllShapesOverlappingWithAABB(AABB(Vector3(-1, -1, -1), Vector3(1, 1, 1)), overlappingObjects);
+            rp3d_test(tree.getNbObjects() == 0);
+            rp3d_test(overlappingObjects.size() == 0);
+
+            // Single object
+            aabbs.add(AABB(Vector3(0, 0, 0), Vector3(1, 1, 1)));
+            tree.build(aabbs);
+            tree.reportAllShapesOverlappingWithAABB(AABB(Vector3(-1, -1, -1), Vector3(decimal(0.5), decimal(0.5), decimal(0.5))), overlappingObjects);
+            rp3d_test(tree.getNbObjects() == 1);
+            rp3d_test(tree.getNbNodes() == 0);
+            rp3d_test(tree.getHeight() == 0);
+            rp3d_test(overlappingObjects.size() == 1 && overlappingObjects[0] == 0);
+
+            // Objects with the same centroid
+            aabbs.clear();
+            for (int i=0; i < 5; i++) {
+                aabbs.add(AABB(Vector3(-1, -1, -1) * decimal(i + 1), Vector3(1, 1, 1) * decimal(i + 1)));
+            }
+            tree.build(aabbs);
+            overlappingObjects.clear();
+            tree.reportAllShapesOverlappingWithAABB(AABB(Vector3(decimal(2.5), 0, 0), Vector3(3, 1, 1)), overlappingObjects);
+            rp3d_test(tree.getNbNodes() == 4);
+            rp3d_test(overlappingObjects.size() == 3);
+            rp3d_test(tree.getRootAABB().getMin() == Vector3(-5, -5, -5));
+            rp3d_test(tree.getRootAABB().getMax() == Vector3(5, 5, 5));
+        }
+
+        void testOverlap() {
+
+            List<AABB> aabbs(mAllocator);
+            createRandomAABBs(aabbs, 2000, decimal(5000.0));
+
+            StaticAABBTree tree(mAllocator);
+            tree.build(aabbs);
+
+            rp3d_test(tree.getNbObjects() == 2000);
+            rp3d_test(tree.getNbNodes() == 1999);
+
+            // The SAH tree must be reasonably balanced
+            rp3d_test(tree.getHeight() < 40);
+
+            bool isSuperSet = true;
+            bool isAlmostExact = true;
+            for (int q=0; q < 50; q++) {
+
+                const Vector3 center(random(-50, 50) + 5000, random(-10, 10) + 5000, random(-50, 50) + 5000);
+                const AABB queryAABB(center - Vector3(4, 4, 4), center + Vector3(4, 4, 4));
+
+                List<int32> overlappingObjects(mAllocator);
+                tree.reportAllShapesOverlappingWithAABB(queryAABB, overlappingObjects);
+                std::set<int32> reportedObjects(overlappingObjects.begin(), overlappingObjects.end());
+                rp3d_test(reportedObjects.size() == overlappingObjects.size());
+
+                for (uint32 i=0; i < aabbs.size(); i++) {
+
+                    // All the overlapping objects must be reported
+                    if (queryAABB.testCollision(aabbs[i])) {
+                        isSuperSet &= reportedObjects.count(static_cast<int32>(i)) == 1;
+                    }
+                    // The reported objects must overlap up to the quantization error
+                    else if (reportedObjects.count(static_cast<int32>(i)) == 1) {
+                        AABB inflatedQueryAABB = queryAABB;
+                        inflatedQueryAABB.inflate(decimal(0.01), decimal(0.01), decimal(0.01));
+                        isAlmostExact &= inflatedQueryAABB.testCollision(aabbs[i]);
+                    }
+                }
+            }
+
+            rp3d_test(isSuperSet);
+            rp3d_test(isAlmostExact);
+        }
+
+        void testRaycast() {
+
+            List<AABB> aabbs(mAllocator);
+            createRandomAABBs(aabbs, 1000, decimal(0.0));
+
+            StaticAABBTree tree(mAllocator);
+            tree.build(aabbs);
+
+            bool isSuperSet = true;
+            bool isClosestFound = true;
+            for (int r=0; r < 50; r++) {
+
+                const Ray ray(Vector3(random(-60, 60), random(-15, 15), -70), Vector3(random(-60, 60), random(-15, 15), 70),
+                              random(decimal(0.5), decimal(1.0)));
+
+                // All the objects hit by the ray must be reported when the ray is not clipped
+                StaticTreeRaycastCallback callback;
+                tree.raycast(ray, callback);
+
+                decimal closestFraction = DECIMAL_LARGEST;
+                for (uint32 i=0; i < aabbs.size(); i++) {
+                    decimal fraction;
+                    if (StaticTreeRaycastCallback::computeEntryFraction(ray, aabbs[i], fraction)) {
+                        isSuperSet &= callback.mHitObjects.count(static_cast<int32>(i)) == 1;
+                        closestFraction = std::min(closestFraction, fraction);
+                    }
+                }
+
+                // The closest object must be found when the ray is clipped
+                StaticTreeRaycastCallback clippingCallback;
+                clippingCallback.mObjectsAABBs = &aabbs;
+                tree.raycast(ray, clippingCallback);
+                isClosestFound &= clippingCallback.mClosestFraction == closestFraction;
+                isClosestFound &= clippingCallback.mHitObjects.size() <= callback.mHitObjects.size();
+            }
+
+            rp3d_test(isSuperSet);
+            rp3d_test(isClosestFound);
+        }
+ };
+
+}
+
+#endif
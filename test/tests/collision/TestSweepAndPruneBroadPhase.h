@@ -0,0 +1,468 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_SWEEP_AND_PRUNE_BROAD_PHASE_H
+#define TEST_SWEEP_AND_PRUNE_BROAD_PHASE_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <reactphysics3d/collision/broadphase/SweepAndPruneBroadPhase.h>
+#include <reactphysics3d/collision/broadphase/DynamicAABBTreeBroadPhase.h>
+#include <reactphysics3d/memory/DefaultAllocator.h>
+#include <algorithm>
+#include <set>
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class BroadPhaseHitsCallback
+/**
+ * Raycast callback that records the objects hit by a ray
+ */
+class BroadPhaseHitsCallback : public DynamicAABBTreeRaycastCallback {
+
+    public:
+
+        std::set<int32> mHitObjects;
+
+        // Called when the AABB of an object is hit by a ray
+        virtual decimal raycastBroadPhaseShape(int32 objectId, const Ray& /*ray*/) override {
+            mHitObjects.insert(objectId);
+            return decimal(-1.0);
+        }
+};
+
+// Class BroadPhaseClosestHitCallback
+/**
+ * Raycast callback that clips the ray at the entry point of each AABB that is hit
+ */
+class BroadPhaseClosestHitCallback : public DynamicAABBTreeRaycastCallback {
+
+    public:
+
+        BroadPhaseStrategy& mBroadPhase;
+
+        int32 mClosestObject = -1;
+
+        decimal mClosestHitFraction = decimal(1.0);
+
+        BroadPhaseClosestHitCallback(BroadPhaseStrategy& broadPhase) : mBroadPhase(broadPhase) {
+
+        }
+
+        // Called when the AABB of an object is hit by a ray
+        virtual decimal raycastBroadPhaseShape(int32 objectId, const Ray& ray) override {
+
+            const AABB& aabb = mBroadPhase.getFatAABB(objectId);
+
+            // Compute the fraction of the entry point of the ray into the AABB with the slabs method
+            decimal hitFraction = decimal(0.0);
+            decimal exitFraction = ray.maxFraction;
+            for (int axis=0; axis < 3; axis++) {
+
+                const decimal delta = ray.point2[axis] - ray.point1[axis];
+                if (std::abs(delta) < MACHINE_EPSILON) {
+                    if (ray.point1[axis] < aabb.getMin()[axis] || ray.point1[axis] > aabb.getMax()[axis]) return decimal(-1.0);
+                    continue;
+                }
+
+                decimal fraction1 = (aabb.getMin()[axis] - ray.point1[axis]) / delta;
+                decimal fraction2 = (aabb.getMax()[axis] - ray.point1[axis]) / delta;
+                if (fraction1 > fraction2) std::swap(fraction1, fraction2);
+                hitFraction = std::max(hitFraction, fraction1);
+                exitFraction = std::min(exitFraction, fraction2);
+            }
+            if (hitFraction > exitFraction) return decimal(-1.0);
+
+            if (hitFraction < mClosestHitFraction) {
+                mClosestHitFraction = hitFraction;
+                mClosestObject = objectId;
+            }
+
+            return hitFraction;
+        }
+};
+
+// Class TestSweepAndPruneBroadPhase
+/**
+ * Unit test for the sweep-and-prune broad-phase
+ */
+class TestSweepAndPruneBroadPhase : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        DefaultAllocator mAllocator;
+
+        /// State of the pseudo-random generator
+        uint32 mRandomState;
+
+        // ---------- Methods ---------- //
+
+        /// Return a pseudo-random number in [min, max]
+        decimal random(decimal min, decimal max) {
+            mRandomState = mRandomState * 1664525u + 1013904223u;
+            return min + (max - min) * decimal(mRandomState >> 8) / decimal(1 << 24);
+        }
+
+        /// Return a random AABB
+        AABB randomAABB() {
+            const Vector3 center(random(-50, 50), random(-5, 5), random(-20, 20));
+            const Vector3 halfExtents(random(decimal(0.2), 2), random(decimal(0.2), 2), random(decimal(0.2), 2));
+            return AABB(center - halfExtents, center + halfExtents);
+        }
+
+        /// Return the overlapping pairs reported by a broad-phase as pairs of object keys stored in the object data
+        std::set<std::pair<intptr_t, intptr_t>> computePairs(BroadPhaseStrategy& broadPhase, const std::vector<int32>& objectsToTest) {
+
+            List<int32> objects(mAllocator);
+            for (uint i=0; i < objectsToTest.size(); i++) objects.add(objectsToTest[i]);
+
+            List<Pair<int32, int32>> overlappingPairs(mAllocator);
+            broadPhase.reportAllShapesOverlappingWithShapes(objects, overlappingPairs);
+
+            std::set<std::pair<intptr_t, intptr_t>> pairs;
+            for (uint i=0; i < overlappingPairs.size(); i++) {
+                const intptr_t key1 = reinterpret_cast<intptr_t>(broadPhase.getObjectData(overlappingPairs[i].first));
+                const intptr_t key2 = reinterpret_cast<intptr_t>(broadPhase.getObjectData(overlappingPairs[i].second));
+                if (key1 != key2) pairs.insert(std::make_pair(std::min(key1, key2), std::max(key1, key2)));
+            }
+
+            return pairs;
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestSweepAndPruneBroadPhase(const std::string& name): Test(name), mRandomState(12345) {
+
+        }
+
+        /// Run the tests
+        void run() {
+
+            testObjects();
+            testOverlappingPairs();
+            testRaycast();
+            testRaycastMovedObjects();
+            testWorld();
+        }
+
+        void testObjects() {
+
+            SweepAndPruneBroadPhase broadPhase(mAllocator, decimal(0.0));
+            int data1 = 1, data2 = 2, data3 = 3;
+
+            const int32 id1 = broadPhase.addObject(AABB(Vector3(0, 0, 0), Vector3(1, 1, 1)), &data1, false);
+            const int32 id2 = broadPhase.addObject(AABB(Vector3(5, 0, 0), Vector3(6, 1, 1)), &data2, false);
+
+            rp3d_test(broadPhase.getType() == BroadPhaseType::SWEEP_AND_PRUNE);
+            rp3d_test(broadPhase.getNbObjects() == 2);
+            rp3d_test(id1 != id2);
+            rp3d_test(broadPhase.getObjectData(id1) == &data1);
+            rp3d_test(broadPhase.getObjectData(id2) == &data2);
+            rp3d_test(broadPhase.getFatAABB(id2).getMin() == Vector3(5, 0, 0));
+
+            // An AABB inside the fat AABB does not change it unless the fat AABB is much larger than needed
+            rp3d_test(!broadPhase.updateObject(id1, AABB(Vector3(0, 0, 0), Vector3(1, 1, 1)), false, Vector3::zero()));
+            rp3d_test(broadPhase.updateObject(id1, AABB(Vector3(0, 0, 0), Vector3(1, 1, 1)), true, Vector3::zero()));
+            rp3d_test(broadPhase.updateObject(id1, AABB(Vector3(0, 0, 0), Vector3(decimal(0.5), 1, 1)), false, Vector3::zero()));
+            rp3d_test(broadPhase.getFatAABB(id1).getMax() == Vector3(decimal(0.5), 1, 1));
+            rp3d_test(broadPhase.updateObject(id1, AABB(Vector3(2, 0, 0), Vector3(3, 1, 1)), false, Vector3::zero()));
+
+            // The fat AABB is extended along the displacement of the object
+            rp3d_test(broadPhase.updateObject(id1, AABB(Vector3(0, 0, 0), Vector3(1, 1, 1)), false, Vector3(2, 0, -1)));
+            rp3d_test(broadPhase.getFatAABB(id1).getMin() == Vector3(0, 0, -1));
+            rp3d_test(broadPhase.getFatAABB(id1).getMax() == Vector3(3, 1, 1));
+            rp3d_test(!broadPhase.updateObject(id1, AABB(Vector3(1, 0, -1), Vector3(2, 1, 0)), false, Vector3(2, 0, -1)));
+            rp3d_test(!broadPhase.updateObject(id1, AABB(Vector3(2, 0, 0), Vector3(3, 1, 1)), false, Vector3(2, 0, -1)));
+            rp3d_test(broadPhase.updateObject(id1, AABB(Vector3(3, 0, 0), Vector3(4, 1, 1)), false, Vector3(2, 0, -1)));
+
+            // The fat AABB of an object that has stopped is shrunk
+            rp3d_test(broadPhase.updateObject(id1, AABB(Vector3(3, 0, 0), Vector3(4, 1, 1)), false, Vector3::zero()));
+            rp3d_test(broadPhase.getFatAABB(id1).getMin() == Vector3(3, 0, 0));
+            rp3d_test(broadPhase.getFatAABB(id1).getMax() == Vector3(4, 1, 1));
+
+            // The ID of a removed object is reused
+            broadPhase.removeObject(id1);
+            rp3d_test(broadPhase.getNbObjects() == 1);
+            const int32 id3 = broadPhase.addObject(AABB(Vector3(5, 0, 0), Vector3(6, 1, 1)), &data3, false);
+            rp3d_test(id3 == id1);
+            rp3d_test(broadPhase.getObjectData(id3) == &data3);
+            rp3d_test(broadPhase.getNbObjects() == 2);
+
+            std::set<std::pair<intptr_t, intptr_t>> pairs = computePairs(broadPhase, {id3});
+            const intptr_t key2 = reinterpret_cast<intptr_t>(&data2);
+            const intptr_t key3 = reinterpret_cast<intptr_t>(&data3);
+            rp3d_test(pairs.size() == 1);
+            rp3d_test(pairs.count(std::make_pair(std::min(key2, key3), std::max(key2, key3))) == 1);
+        }
+
+        void testOverlappingPairs() {
+
+            SweepAndPruneBroadPhase sweepAndPrune(mAllocator, decimal(0.08));
+            DynamicAABBTreeBroadPhase tree(mAllocator, decimal(0.08));
+
+            // Each object has a key (stored as object data) and an ID in each broad-phase. One
+            // object out of five is static.
+            struct Object {
+                intptr_t key;
+                bool isStatic;
+                int32 sweepAndPruneId;
+                int32 treeId;
+            };
+
+            std::vector<Object> objects;
+            intptr_t nextKey = 1;
+            auto addObject = [&](const AABB& aabb) {
+                Object object;
+                object.key = nextKey++;
+                object.isStatic = object.key % 5 == 0;
+                object.sweepAndPruneId = sweepAndPrune.addObject(aabb, reinterpret_cast<void*>(object.key), object.isStatic);
+                object.treeId = tree.addObject(aabb, reinterpret_cast<void*>(object.key), object.isStatic);
+                objects.push_back(object);
+            };
+
+            for (int i=0; i < 300; i++) {
+                addObject(randomAABB());
+            }
+
+            for (int step=0; step < 10; step++) {
+
+                // Compare the pairs with a brute-force computation
+                std::vector<int32> sweepAndPruneIdsToTest;
+                std::vector<int32> treeIdsToTest;
+                std::set<std::pair<intptr_t, intptr_t>> expectedPairs;
+                for (uint i=0; i < objects.size(); i += (step % 2 == 0 ? 1 : 7)) {
+
+                    sweepAndPruneIdsToTest.push_back(objects[i].sweepAndPruneId);
+                    treeIdsToTest.push_back(objects[i].treeId);
+
+                    const AABB& aabb1 = sweepAndPrune.getFatAABB(objects[i].sweepAndPruneId);
+                    rp3d_test(approxEqual(aabb1.getMin(), tree.getFatAABB(objects[i].treeId).getMin(), decimal(0.0001)));
+                    rp3d_test(approxEqual(aabb1.getMax(), tree.getFatAABB(objects[i].treeId).getMax(), decimal(0.0001)));
+
+                    for (uint j=0; j < objects.size(); j++) {
+                        if (i != j && !(objects[i].isStatic && objects[j].isStatic) &&
+                            aabb1.testCollision(sweepAndPrune.getFatAABB(objects[j].sweepAndPruneId))) {
+                            expectedPairs.insert(std::make_pair(std::min(objects[i].key, objects[j].key),
+                                                                std::max(objects[i].key, objects[j].key)));
+                        }
+                    }
+                }
+
+                rp3d_test(computePairs(sweepAndPrune, sweepAndPruneIdsToTest) == expectedPairs);
+                rp3d_test(computePairs(tree, treeIdsToTest) == expectedPairs);
+
+                // Move the objects coherently, remove some of them and add new ones
+                for (uint i=0; i < objects.size(); i++) {
+                    AABB aabb = sweepAndPrune.getFatAABB(objects[i].sweepAndPruneId);
+                    const Vector3 offset(random(0, 1), random(decimal(-0.2), decimal(0.2)), random(decimal(-0.5), decimal(0.5)));
+                    aabb.setMin(aabb.getMin() + offset);
+                    aabb.setMax(aabb.getMax() + offset);
+                    const bool hasChanged = sweepAndPrune.updateObject(objects[i].sweepAndPruneId, aabb, false, offset);
+                    rp3d_test(tree.updateObject(objects[i].treeId, aabb, false, offset) == hasChanged);
+                }
+                for (int k=0; k < 5; k++) {
+                    const uint index = static_cast<uint>(random(0, decimal(objects.size() - 1)));
+                    sweepAndPrune.removeObject(objects[index].sweepAndPruneId);
+                    tree.removeObject(objects[index].treeId);
+                    objects.erase(objects.begin() + index);
+                }
+                for (int k=0; k < 3; k++) {
+                    addObject(randomAABB());
+                }
+            }
+
+            // The objects are mostly spread along the x axis
+            rp3d_test(sweepAndPrune.getSweepAxis() == 0);
+        }
+
+        void testRaycast() {
+
+            SweepAndPruneBroadPhase broadPhase(mAllocator, decimal(0.0));
+
+            std::vector<int32> ids;
+            for (int i=0; i < 100; i++) {
+                ids.push_back(broadPhase.addObject(randomAABB(), nullptr, false));
+            }
+            broadPhase.removeObject(ids[10]);
+
+            const Ray ray(Vector3(-60, 0, 0), Vector3(60, decimal(1.0), decimal(0.5)));
+
+            BroadPhaseHitsCallback callback;
+            broadPhase.raycast(ray, callback);
+
+            std::set<int32> expectedHits;
+            for (uint i=0; i < ids.size(); i++) {
+                if (i != 10 && broadPhase.getFatAABB(ids[i]).testRayIntersect(ray)) expectedHits.insert(ids[i]);
+            }
+
+            rp3d_test(expectedHits.size() > 0);
+            rp3d_test(callback.mHitObjects == expectedHits);
+
+            // The tree broad-phase stores the static objects in a separate tree
+            DynamicAABBTreeBroadPhase tree(mAllocator, decimal(0.0));
+
+            std::vector<int32> treeIds;
+            for (int i=0; i < 100; i++) {
+                treeIds.push_back(tree.addObject(randomAABB(), nullptr, i % 3 == 0));
+            }
+            tree.removeObject(treeIds[9]);
+            tree.removeObject(treeIds[10]);
+
+            // A static and a non-static object on the ray
+            treeIds.push_back(tree.addObject(AABB(Vector3(-10, -1, -1), Vector3(-9, 1, 1)), nullptr, true));
+            treeIds.push_back(tree.addObject(AABB(Vector3(9, -1, -1), Vector3(10, 2, 2)), nullptr, false));
+
+            BroadPhaseHitsCallback treeCallback;
+            tree.raycast(ray, treeCallback);
+
+            std::set<int32> expectedTreeHits;
+            for (uint i=0; i < treeIds.size(); i++) {
+                if (i != 9 && i != 10 && tree.getFatAABB(treeIds[i]).testRayIntersect(ray)) expectedTreeHits.insert(treeIds[i]);
+            }
+
+            rp3d_test(expectedTreeHits.size() >= 2);
+            rp3d_test(treeCallback.mHitObjects == expectedTreeHits);
+        }
+
+        void testRaycastMovedObjects() {
+
+            SweepAndPruneBroadPhase broadPhase(mAllocator, decimal(0.0));
+
+            std::vector<int32> ids;
+            for (int i=0; i < 200; i++) {
+                ids.push_back(broadPhase.addObject(randomAABB(), nullptr, false));
+            }
+
+            // Sort the objects
+            broadPhase.rebuild();
+            rp3d_test(broadPhase.getSweepAxis() == 0);
+
+            // Move some sorted objects far away in both directions, remove and add some objects
+            for (uint i=0; i < ids.size(); i += 7) {
+                const decimal offset = i % 2 == 0 ? decimal(30.0) : decimal(-30.0);
+                const AABB aabb = broadPhase.getFatAABB(ids[i]);
+                broadPhase.updateObject(ids[i], AABB(aabb.getMin() + Vector3(offset, 0, 0), aabb.getMax() + Vector3(offset, 0, 0)),
+                                        true, Vector3::zero());
+            }
+            broadPhase.updateObject(ids[3], AABB(Vector3(-40, -1, -1), Vector3(40, 1, 1)), true, Vector3::zero());
+            for (uint i=5; i < ids.size(); i += 11) {
+                broadPhase.removeObject(ids[i]);
+                ids[i] = -1;
+            }
+            for (int i=0; i < 10; i++) {
+                ids.push_back(broadPhase.addObject(randomAABB(), nullptr, false));
+            }
+
+            // Short and long rays in both directions along the sweep axis through the center of each object
+            bool isCorrect = true;
+            bool isClosestHitCorrect = true;
+            for (uint r=0; r < ids.size(); r++) {
+
+                if (ids[r] == -1) continue;
+
+                const Vector3 center = broadPhase.getFatAABB(ids[r]).getCenter();
+                const Vector3 direction(r % 2 == 0 ? decimal(1.0) : decimal(-1.0), random(decimal(-0.1), decimal(0.1)),
+                                        random(decimal(-0.1), decimal(0.1)));
+                const decimal length = r % 4 < 2 ? decimal(5.0) : decimal(60.0);
+                const Vector3 point1 = center - random(0, length) * direction;
+                const Ray ray(point1, point1 + length * direction);
+
+                BroadPhaseHitsCallback callback;
+                broadPhase.raycast(ray, callback);
+
+                std::set<int32> expectedHits;
+                for (uint i=0; i < ids.size(); i++) {
+                    if (ids[i] != -1 && broadPhase.getFatAABB(ids[i]).testRayIntersect(ray)) expectedHits.insert(ids[i]);
+                }
+                isCorrect &= callback.mHitObjects == expectedHits;
+
+                // The ray is clipped at each hit
+                BroadPhaseClosestHitCallback closestHitCallback(broadPhase);
+                broadPhase.raycast(ray, closestHitCallback);
+
+                BroadPhaseClosestHitCallback expectedClosestHit(broadPhase);
+                for (std::set<int32>::iterator it = expectedHits.begin(); it != expectedHits.end(); ++it) {
+                    expectedClosestHit.raycastBroadPhaseShape(*it, ray);
+                }
+                isClosestHitCorrect &= closestHitCallback.mClosestHitFraction == expectedClosestHit.mClosestHitFraction;
+            }
+
+            rp3d_test(isCorrect);
+            rp3d_test(isClosestHitCorrect);
+        }
+
+        void testWorld() {
+
+            PhysicsCommon physicsCommon;
+            PhysicsWorld::WorldSettings settings;
+            settings.broadPhaseType = BroadPhaseType::SWEEP_AND_PRUNE;
+            PhysicsWorld* world = physicsCommon.createPhysicsWorld(settings);
+
+            BoxShape* groundShape = physicsCommon.createBoxShape(Vector3(20, 1, 20));
+            BoxShape* boxShape = physicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+
+            RigidBody* ground = world->createRigidBody(Transform::identity());
+            ground->setType(BodyType::STATIC);
+            ground->addCollider(groundShape, Transform::identity());
+
+            std::vector<RigidBody*> bodies;
+            for (int i=0; i < 40; i++) {
+                const Vector3 position(decimal(i % 8) * decimal(1.5) - 6, decimal(2 + (i / 8) * 1.2), decimal(0.3) * (i % 3));
+                RigidBody* body = world->createRigidBody(Transform(position, Quaternion::identity()));
+                body->addCollider(boxShape, Transform::identity());
+                bodies.push_back(body);
+            }
+
+            // Remove a body during the simulation
+            for (int i=0; i < 120; i++) {
+                world->update(decimal(1.0) / decimal(60.0));
+                if (i == 30) {
+                    world->destroyRigidBody(bodies.back());
+                    bodies.pop_back();
+                }
+            }
+
+            bool isResting = true;
+            for (uint i=0; i < bodies.size(); i++) {
+                isResting &= bodies[i]->getTransform().getPosition().y > decimal(1.3);
+            }
+            rp3d_test(isResting);
+            rp3d_test(world->testOverlap(bodies[0], ground));
+
+            physicsCommon.destroyPhysicsWorld(world);
+        }
+ };
+
+}
+
+#endif
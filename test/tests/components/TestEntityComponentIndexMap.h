@@ -0,0 +1,175 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+#ifndef TEST_ENTITY_COMPONENT_INDEX_MAP_H
+#define TEST_ENTITY_COMPONENT_INDEX_MAP_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/components/EntityComponentIndexMap.h>
+#include <reactphysics3d/memory/DefaultAllocator.h>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestEntityComponentIndexMap
+/**
+ * Unit test for the EntityComponentIndexMap class
+ */
+class TestEntityComponentIndexMap : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        DefaultAllocator mAllocator;
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestEntityComponentIndexMap(const std::string& name) : Test(name) {
+
+        }
+
+        /// Run the tests
+        void run() {
+
+            testAddRemove();
+            testReusedIndex();
+            testSeveralPages();
+        }
+
+        void testAddRemove() {
+
+            EntityComponentIndexMap map(mAllocator);
+            rp3d_test(map.size() == 0);
+            rp3d_test(!map.containsKey(Entity(0, 0)));
+
+            const Entity entity1(0, 0);
+            const Entity entity2(5, 0);
+            const Entity entity3(1023, 0);
+            map.add(Pair<Entity, uint32>(entity1, 2));
+            map.add(Pair<Entity, uint32>(entity2, 0));
+            map.add(Pair<Entity, uint32>(entity3, 1));
+            rp3d_test(map.size() == 3);
+            rp3d_test(map.containsKey(entity1));
+            rp3d_test(map.containsKey(entity2));
+            rp3d_test(map.containsKey(entity3));
+            rp3d_test(!map.containsKey(Entity(1, 0)));
+            rp3d_test(map[entity1] == 2);
+            rp3d_test(map[entity2] == 0);
+            rp3d_test(map[entity3] == 1);
+
+            map.remove(entity2);
+            rp3d_test(map.size() == 2);
+            rp3d_test(!map.containsKey(entity2));
+            rp3d_test(map.containsKey(entity1));
+            rp3d_test(map.containsKey(entity3));
+            rp3d_test(map[entity1] == 2);
+            rp3d_test(map[entity3] == 1);
+
+            // The entity can be added again with another component index
+            map.add(Pair<Entity, uint32>(entity2, 7));
+            rp3d_test(map.size() == 3);
+            rp3d_test(map[entity2] == 7);
+
+            map.remove(entity1);
+            map.remove(entity2);
+            map.remove(entity3);
+            rp3d_test(map.size() == 0);
+            rp3d_test(!map.containsKey(entity1));
+            rp3d_test(!map.containsKey(entity2));
+            rp3d_test(!map.containsKey(entity3));
+        }
+
+        void testReusedIndex() {
+
+            EntityComponentIndexMap map(mAllocator);
+
+            const Entity oldEntity(12, 3);
+            const Entity newEntity(12, 4);
+            rp3d_test(oldEntity.getIndex() == newEntity.getIndex());
+
+            // An entity with the same index but another generation is not in the map
+            map.add(Pair<Entity, uint32>(oldEntity, 4));
+            rp3d_test(map.containsKey(oldEntity));
+            rp3d_test(!map.containsKey(newEntity));
+
+            // The index is reused by an entity of a newer generation
+            map.remove(oldEntity);
+            map.add(Pair<Entity, uint32>(newEntity, 9));
+            rp3d_test(map.size() == 1);
+            rp3d_test(map.containsKey(newEntity));
+            rp3d_test(!map.containsKey(oldEntity));
+            rp3d_test(map[newEntity] == 9);
+
+            map.remove(newEntity);
+            rp3d_test(!map.containsKey(newEntity));
+            rp3d_test(!map.containsKey(oldEntity));
+        }
+
+        void testSeveralPages() {
+
+            EntityComponentIndexMap map(mAllocator);
+
+            // Entities spread over several pages (with pages that are not allocated in between)
+            const uint32 nbEntities = 3000;
+            for (uint32 i=0; i < nbEntities; i++) {
+                map.add(Pair<Entity, uint32>(Entity(i, 1), nbEntities - i));
+            }
+            map.add(Pair<Entity, uint32>(Entity(100000, 1), 0));
+            rp3d_test(map.size() == int(nbEntities) + 1);
+
+            bool isFound = true;
+            for (uint32 i=0; i < nbEntities; i++) {
+                isFound &= map.containsKey(Entity(i, 1)) && map[Entity(i, 1)] == nbEntities - i;
+            }
+            rp3d_test(isFound);
+            rp3d_test(map.containsKey(Entity(100000, 1)));
+            rp3d_test(map[Entity(100000, 1)] == 0);
+            rp3d_test(!map.containsKey(Entity(nbEntities, 1)));
+            rp3d_test(!map.containsKey(Entity(50000, 1)));
+            rp3d_test(!map.containsKey(Entity(200000, 1)));
+            rp3d_test(!map.containsKey(Entity(1024, 2)));
+
+            // Remove every other entity
+            for (uint32 i=0; i < nbEntities; i += 2) {
+                map.remove(Entity(i, 1));
+            }
+            rp3d_test(map.size() == int(nbEntities / 2) + 1);
+
+            bool isCorrect = true;
+            for (uint32 i=0; i < nbEntities; i++) {
+                isCorrect &= (i % 2 == 0) ? !map.containsKey(Entity(i, 1)) :
+                                             map.containsKey(Entity(i, 1)) && map[Entity(i, 1)] == nbEntities - i;
+            }
+            rp3d_test(isCorrect);
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,194 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_CONSTRAINT_GRAPH_COLORING_H
+#define TEST_CONSTRAINT_GRAPH_COLORING_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/engine/ConstraintGraphColoring.h>
+#include <reactphysics3d/memory/DefaultAllocator.h>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestConstraintGraphColoring
+/**
+ * Unit test for the ConstraintGraphColoring class
+ */
+class TestConstraintGraphColoring : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        DefaultAllocator mAllocator;
+
+        // ---------- Methods ---------- //
+
+        /// Return true if the constraints of each color do not share any body
+        bool isColoringValid(const ConstraintGraphColoring& coloring, const List<uint32>& bodies1,
+                             const List<uint32>& bodies2, uint32 nbBodies) {
+
+            const List<uint32>& constraints = coloring.getConstraintsIndices();
+            for (uint32 color=0; color < coloring.getNbColors(); color++) {
+
+                List<bool> isBodyUsed(mAllocator, nbBodies);
+                for (uint32 b=0; b < nbBodies; b++) isBodyUsed.add(false);
+
+                for (uint32 i=coloring.getColorStartIndex(color); i < coloring.getColorStartIndex(color + 1); i++) {
+
+                    const uint32 bodies[2] = {bodies1[constraints[i]], bodies2[constraints[i]]};
+                    for (uint32 k=0; k < 2; k++) {
+                        if (bodies[k] == ConstraintGraphColoring::IGNORED_BODY) continue;
+                        if (isBodyUsed[bodies[k]]) return false;
+                        isBodyUsed[bodies[k]] = true;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestConstraintGraphColoring(const std::string& name) : Test(name) {
+
+        }
+
+        /// Run the tests
+        void run() {
+
+            testEmpty();
+            testChain();
+            testIgnoredBodies();
+            testOverflow();
+        }
+
+        void testEmpty() {
+
+            ConstraintGraphColoring coloring(mAllocator);
+            List<uint32> bodies1(mAllocator);
+            List<uint32> bodies2(mAllocator);
+
+            coloring.computeColors(bodies1, bodies2, 10);
+
+            rp3d_test(coloring.getNbColors() == 0);
+            rp3d_test(coloring.getNbConstraints() == 0);
+            rp3d_test(coloring.getOverflowStartIndex() == 0);
+        }
+
+        void testChain() {
+
+            // Chain of bodies 0-1-2-...-20 and a few extra constraints between the same bodies
+            const uint32 nbBodies = 21;
+            ConstraintGraphColoring coloring(mAllocator);
+            List<uint32> bodies1(mAllocator);
+            List<uint32> bodies2(mAllocator);
+            for (uint32 b=0; b < nbBodies - 1; b++) {
+                bodies1.add(b);
+                bodies2.add(b + 1);
+            }
+            bodies1.add(3); bodies2.add(4);
+            bodies1.add(4); bodies2.add(3);
+
+            coloring.computeColors(bodies1, bodies2, nbBodies);
+
+            rp3d_test(coloring.getNbConstraints() == bodies1.size());
+            rp3d_test(coloring.getOverflowStartIndex() == bodies1.size());
+            rp3d_test(coloring.getNbColors() == 4);
+            rp3d_test(isColoringValid(coloring, bodies1, bodies2, nbBodies));
+
+            // The constraints keep their order inside a color
+            const List<uint32>& constraints = coloring.getConstraintsIndices();
+            bool isSorted = true;
+            for (uint32 color=0; color < coloring.getNbColors(); color++) {
+                for (uint32 i=coloring.getColorStartIndex(color) + 1; i < coloring.getColorStartIndex(color + 1); i++) {
+                    isSorted &= constraints[i - 1] < constraints[i];
+                }
+            }
+            rp3d_test(isSorted);
+
+            // Each constraint is present exactly once
+            List<uint32> nbOccurences(mAllocator, bodies1.size());
+            for (uint32 c=0; c < bodies1.size(); c++) nbOccurences.add(0);
+            for (uint32 i=0; i < constraints.size(); i++) nbOccurences[constraints[i]]++;
+            bool isPresentOnce = true;
+            for (uint32 c=0; c < bodies1.size(); c++) isPresentOnce &= nbOccurences[c] == 1;
+            rp3d_test(isPresentOnce);
+        }
+
+        void testIgnoredBodies() {
+
+            // Many constraints between a single ignored body (ground) and different bodies
+            const uint32 nbBodies = 200;
+            ConstraintGraphColoring coloring(mAllocator);
+            List<uint32> bodies1(mAllocator);
+            List<uint32> bodies2(mAllocator);
+            for (uint32 b=0; b < nbBodies; b++) {
+                bodies1.add(ConstraintGraphColoring::IGNORED_BODY);
+                bodies2.add(b);
+            }
+
+            coloring.computeColors(bodies1, bodies2, nbBodies);
+
+            rp3d_test(coloring.getNbColors() == 1);
+            rp3d_test(coloring.getColorStartIndex(1) == nbBodies);
+            rp3d_test(coloring.getOverflowStartIndex() == nbBodies);
+        }
+
+        void testOverflow() {
+
+            // A body with more constraints than the maximum number of colors
+            const uint32 nbConstraints = ConstraintGraphColoring::MAX_NB_COLORS + 10;
+            const uint32 nbBodies = nbConstraints + 1;
+            ConstraintGraphColoring coloring(mAllocator);
+            List<uint32> bodies1(mAllocator);
+            List<uint32> bodies2(mAllocator);
+            for (uint32 c=0; c < nbConstraints; c++) {
+                bodies1.add(0);
+                bodies2.add(c + 1);
+            }
+
+            coloring.computeColors(bodies1, bodies2, nbBodies);
+
+            rp3d_test(coloring.getNbColors() == ConstraintGraphColoring::MAX_NB_COLORS);
+            rp3d_test(coloring.getOverflowStartIndex() == ConstraintGraphColoring::MAX_NB_COLORS);
+            rp3d_test(coloring.getNbConstraints() == nbConstraints);
+            rp3d_test(isColoringValid(coloring, bodies1, bodies2, nbBodies));
+
+            // The last constraints are in the overflow batch
+            const List<uint32>& constraints = coloring.getConstraintsIndices();
+            rp3d_test(constraints[coloring.getOverflowStartIndex()] == ConstraintGraphColoring::MAX_NB_COLORS);
+            rp3d_test(constraints[nbConstraints - 1] == nbConstraints - 1);
+        }
+ };
+
+}
+
+#endif
@@ -0,0 +1,371 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+
+#ifndef TEST_ISLANDS_H
+#define TEST_ISLANDS_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <reactphysics3d/components/RigidBodyComponents.h>
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestIslands
+/**
+ * Unit test for the persistent islands of rigid bodies
+ */
+class TestIslands : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        /// Base allocator
+        DefaultAllocator mAllocator;
+
+        // ---------- Methods ---------- //
+
+        /// Return the number of bodies in the persistent island of a body
+        uint32 getNbBodiesInIsland(RigidBodyComponents& components, Entity bodyEntity) {
+
+            uint32 nbBodies = 0;
+            Entity memberEntity = bodyEntity;
+            do {
+                nbBodies++;
+                memberEntity = components.getIslandNextBody(memberEntity);
+            } while (memberEntity != bodyEntity);
+
+            return nbBodies;
+        }
+
+        /// Simulate the world during a given number of steps
+        void simulate(PhysicsWorld* world, uint nbSteps) {
+
+            for (uint i=0; i < nbSteps; i++) {
+                world->update(decimal(1.0) / decimal(60.0));
+            }
+        }
+
+        /// Create a dynamic box at a given position
+        RigidBody* createBox(PhysicsWorld* world, BoxShape* shape, const Vector3& position) {
+
+            RigidBody* body = world->createRigidBody(Transform(position, Quaternion::identity()));
+            body->addCollider(shape, Transform::identity());
+            return body;
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestIslands(const std::string& name) : Test(name) {
+
+        }
+
+        /// Run the tests
+        void run() {
+
+            testMergeAndRemove();
+            testSleepingStacks();
+            testJointedBodies();
+            testSplitWithoutSleeping();
+            testSleepAfterReallocation();
+        }
+
+        /// Test the union-find operations on the islands of the rigid body components
+        void testMergeAndRemove() {
+
+            RigidBodyComponents components(mAllocator);
+
+            std::vector<Entity> entities;
+            for (uint32 i=0; i < 6; i++) {
+                entities.push_back(Entity(i, 0));
+                components.addComponent(entities[i], false, RigidBodyComponents::RigidBodyComponent(nullptr, BodyType::DYNAMIC, Vector3::zero()));
+            }
+
+            for (uint32 i=0; i < 6; i++) {
+                rp3d_test(components.getIslandRoot(entities[i]) == entities[i]);
+                rp3d_test(getNbBodiesInIsland(components, entities[i]) == 1);
+                rp3d_test(!components.getIsIslandSplitNeeded(entities[i]));
+            }
+
+            components.mergeIslands(entities[0], entities[1]);
+            components.mergeIslands(entities[2], entities[3]);
+            components.mergeIslands(entities[3], entities[4]);
+            components.mergeIslands(entities[1], entities[4]);
+            components.mergeIslands(entities[0], entities[2]);
+
+            const Entity rootEntity = components.getIslandRoot(entities[0]);
+            for (uint32 i=0; i < 5; i++) {
+                rp3d_test(components.getIslandRoot(entities[i]) == rootEntity);
+                rp3d_test(getNbBodiesInIsland(components, entities[i]) == 5);
+            }
+            rp3d_test(components.getIslandRoot(entities[5]) == entities[5]);
+            rp3d_test(getNbBodiesInIsland(components, entities[5]) == 1);
+
+            // Moving the components in the array does not change the islands
+            components.setIsEntityDisabled(entities[2], true);
+            components.setIsEntityDisabled(entities[0], true);
+            for (uint32 i=0; i < 5; i++) {
+                rp3d_test(components.getIslandRoot(entities[i]) == rootEntity);
+            }
+
+            // Remove the root body from the island
+            components.removeBodyFromIsland(rootEntity);
+            rp3d_test(components.getIslandRoot(rootEntity) == rootEntity);
+            rp3d_test(getNbBodiesInIsland(components, rootEntity) == 1);
+            rp3d_test(!components.getIsIslandSplitNeeded(rootEntity));
+
+            Entity otherEntity = rootEntity == entities[0] ? entities[1] : entities[0];
+            const Entity newRootEntity = components.getIslandRoot(otherEntity);
+            rp3d_test(newRootEntity != rootEntity);
+            rp3d_test(getNbBodiesInIsland(components, otherEntity) == 4);
+            rp3d_test(components.getIsIslandSplitNeeded(otherEntity));
+            for (uint32 i=0; i < 5; i++) {
+                if (entities[i] != rootEntity) {
+                    rp3d_test(components.getIslandRoot(entities[i]) == newRootEntity);
+                }
+            }
+
+            for (uint32 i=0; i < 6; i++) {
+                components.removeComponent(entities[i]);
+            }
+        }
+
+        /// Test that two separated stacks of boxes fall asleep and wake up independently
+        void testSleepingStacks() {
+
+            PhysicsCommon physicsCommon;
+            PhysicsWorld* world = physicsCommon.createPhysicsWorld();
+
+            BoxShape* groundShape = physicsCommon.createBoxShape(Vector3(50, 1, 50));
+            BoxShape* boxShape = physicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+
+            RigidBody* ground = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            ground->setType(BodyType::STATIC);
+            ground->addCollider(groundShape, Transform::identity());
+
+            RigidBody* boxA1 = createBox(world, boxShape, Vector3(-5, decimal(0.5), 0));
+            RigidBody* boxA2 = createBox(world, boxShape, Vector3(-5, decimal(1.5), 0));
+            RigidBody* boxB1 = createBox(world, boxShape, Vector3(5, decimal(0.5), 0));
+            RigidBody* boxB2 = createBox(world, boxShape, Vector3(5, decimal(1.5), 0));
+
+            simulate(world, 300);
+
+            rp3d_test(boxA1->isSleeping());
+            rp3d_test(boxA2->isSleeping());
+            rp3d_test(boxB1->isSleeping());
+            rp3d_test(boxB2->isSleeping());
+
+            // Waking up the top box of a stack wakes up the whole stack
+            boxA2->applyForceToCenterOfMass(Vector3(0, 10, 0));
+
+            simulate(world, 1);
+
+            rp3d_test(!boxA1->isSleeping());
+            rp3d_test(!boxA2->isSleeping());
+            rp3d_test(boxB1->isSleeping());
+            rp3d_test(boxB2->isSleeping());
+
+            simulate(world, 300);
+
+            rp3d_test(boxA1->isSleeping());
+            rp3d_test(boxA2->isSleeping());
+
+            // Move the top box away from its stack. The bottom box falls asleep again
+            // while the top box is still moving
+            boxA2->setTransform(Transform(Vector3(-5, decimal(3.0), 10), Quaternion::identity()));
+            boxA2->setLinearVelocity(Vector3(0, 0, 3));
+
+            simulate(world, 100);
+
+            rp3d_test(boxA1->isSleeping());
+
+            simulate(world, 300);
+
+            rp3d_test(boxA2->isSleeping());
+            rp3d_test(boxB1->isSleeping());
+            rp3d_test(boxB2->isSleeping());
+
+            physicsCommon.destroyPhysicsWorld(world);
+        }
+
+        /// Test that the bodies connected by a joint are in the same island
+        void testJointedBodies() {
+
+            PhysicsCommon physicsCommon;
+            PhysicsWorld* world = physicsCommon.createPhysicsWorld();
+
+            BoxShape* groundShape = physicsCommon.createBoxShape(Vector3(50, 1, 50));
+            BoxShape* boxShape = physicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+
+            RigidBody* ground = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            ground->setType(BodyType::STATIC);
+            ground->addCollider(groundShape, Transform::identity());
+
+            RigidBody* box1 = createBox(world, boxShape, Vector3(-2, decimal(0.5), 0));
+            RigidBody* box2 = createBox(world, boxShape, Vector3(2, decimal(0.5), 0));
+            RigidBody* box3 = createBox(world, boxShape, Vector3(8, decimal(0.5), 0));
+
+            FixedJointInfo jointInfo(box1, box2, Vector3(0, decimal(0.5), 0));
+            Joint* joint = world->createJoint(jointInfo);
+
+            simulate(world, 300);
+
+            rp3d_test(box1->isSleeping());
+            rp3d_test(box2->isSleeping());
+            rp3d_test(box3->isSleeping());
+
+            // Waking up a body wakes up the body it is jointed to
+            box1->applyForceToCenterOfMass(Vector3(0, 10, 0));
+
+            simulate(world, 1);
+
+            rp3d_test(!box1->isSleeping());
+            rp3d_test(!box2->isSleeping());
+            rp3d_test(box3->isSleeping());
+
+            simulate(world, 300);
+
+            rp3d_test(box1->isSleeping());
+            rp3d_test(box2->isSleeping());
+
+            // Without the joint, the two bodies wake up independently
+            world->destroyJoint(joint);
+
+            simulate(world, 300);
+
+            rp3d_test(box1->isSleeping());
+            rp3d_test(box2->isSleeping());
+
+            box1->applyForceToCenterOfMass(Vector3(0, 10, 0));
+
+            simulate(world, 1);
+
+            rp3d_test(!box1->isSleeping());
+            rp3d_test(box2->isSleeping());
+
+            physicsCommon.destroyPhysicsWorld(world);
+        }
+
+        /// Test that the islands are split when the sleeping technique is disabled
+        void testSplitWithoutSleeping() {
+
+            PhysicsCommon physicsCommon;
+            PhysicsWorld* world = physicsCommon.createPhysicsWorld();
+            world->enableSleeping(false);
+
+            BoxShape* groundShape = physicsCommon.createBoxShape(Vector3(50, 1, 50));
+            BoxShape* boxShape = physicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+
+            RigidBody* ground = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            ground->setType(BodyType::STATIC);
+            ground->addCollider(groundShape, Transform::identity());
+
+            RigidBody* box1 = createBox(world, boxShape, Vector3(0, decimal(0.5), 0));
+            RigidBody* box2 = createBox(world, boxShape, Vector3(0, decimal(1.5), 0));
+            RigidBody* box3 = createBox(world, boxShape, Vector3(0, decimal(2.5), 0));
+            RigidBody* box4 = createBox(world, boxShape, Vector3(10, decimal(0.5), 0));
+
+            simulate(world, 60);
+
+            rp3d_test(world->areBodiesInSameIsland(box1, box2));
+            rp3d_test(world->areBodiesInSameIsland(box1, box3));
+            rp3d_test(!world->areBodiesInSameIsland(box1, box4));
+            rp3d_test(!world->areBodiesInSameIsland(box1, ground));
+
+            // Move the top box away from the stack
+            box3->setTransform(Transform(Vector3(-10, decimal(0.5), 0), Quaternion::identity()));
+
+            simulate(world, 2);
+
+            rp3d_test(world->areBodiesInSameIsland(box1, box2));
+            rp3d_test(!world->areBodiesInSameIsland(box1, box3));
+            rp3d_test(!world->areBodiesInSameIsland(box3, box4));
+
+            physicsCommon.destroyPhysicsWorld(world);
+        }
+
+        /// Test that the bodies fall asleep when the rigid body components are reallocated
+        /// while they are accumulating their sleep time
+        void testSleepAfterReallocation() {
+
+            PhysicsCommon physicsCommon;
+            PhysicsWorld* world = physicsCommon.createPhysicsWorld();
+
+            BoxShape* groundShape = physicsCommon.createBoxShape(Vector3(50, 1, 50));
+            BoxShape* boxShape = physicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+
+            RigidBody* ground = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            ground->setType(BodyType::STATIC);
+            ground->addCollider(groundShape, Transform::identity());
+
+            std::vector<RigidBody*> boxes;
+            for (int i=0; i < 8; i++) {
+                boxes.push_back(createBox(world, boxShape, Vector3(decimal(-20 + 2 * i), decimal(0.5), -10)));
+            }
+
+            // The boxes are resting but have not reached the time before sleep yet
+            simulate(world, 50);
+
+            bool areAwake = true;
+            for (uint i=0; i < boxes.size(); i++) areAwake &= !boxes[i]->isSleeping();
+            rp3d_test(areAwake);
+
+            // Create enough bodies to reallocate the rigid body components
+            std::vector<RigidBody*> newBoxes;
+            for (int i=0; i < 40; i++) {
+                newBoxes.push_back(createBox(world, boxShape, Vector3(decimal(-20 + 2 * (i % 20)), decimal(0.5), decimal(10 + 2 * (i / 20)))));
+            }
+
+            // The first boxes keep their sleep time and fall asleep before the new ones
+            simulate(world, 30);
+
+            bool areFirstBoxesSleeping = true;
+            for (uint i=0; i < boxes.size(); i++) areFirstBoxesSleeping &= boxes[i]->isSleeping();
+            rp3d_test(areFirstBoxesSleeping);
+
+            bool areNewBoxesAwake = true;
+            for (uint i=0; i < newBoxes.size(); i++) areNewBoxesAwake &= !newBoxes[i]->isSleeping();
+            rp3d_test(areNewBoxesAwake);
+
+            simulate(world, 60);
+
+            bool areNewBoxesSleeping = true;
+            for (uint i=0; i < newBoxes.size(); i++) areNewBoxesSleeping &= newBoxes[i]->isSleeping();
+            rp3d_test(areNewBoxesSleeping);
+
+            physicsCommon.destroyPhysicsWorld(world);
+        }
+};
+
+}
+
+#endif
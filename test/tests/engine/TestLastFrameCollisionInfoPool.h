@@ -0,0 +1,236 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+#ifndef TEST_LAST_FRAME_COLLISION_INFO_POOL_H
+#define TEST_LAST_FRAME_COLLISION_INFO_POOL_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/engine/LastFrameCollisionInfoPool.h>
+#include <reactphysics3d/memory/DefaultAllocator.h>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestLastFrameCollisionInfoPool
+/**
+ * Unit test for the LastFrameCollisionInfoPool class
+ */
+class TestLastFrameCollisionInfoPool : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        DefaultAllocator mAllocator;
+
+        // ---------- Methods ---------- //
+
+        /// Return the key of the info with a given number
+        static Pair<uint64, uint64> key(uint32 number) {
+            return Pair<uint64, uint64>(number, uint64(number) * 7 + 1);
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestLastFrameCollisionInfoPool(const std::string& name) : Test(name) {
+
+        }
+
+        /// Run the tests
+        void run() {
+
+            testAddAndGet();
+            testObsoleteInfos();
+            testRemapAfterRemoval();
+            testPages();
+        }
+
+        void testAddAndGet() {
+
+            LastFrameCollisionInfoPool pool(mAllocator);
+            rp3d_test(pool.getNbInfos() == 0);
+            rp3d_test(pool.getInfo(key(1)) == nullptr);
+
+            LastFrameCollisionInfo* info1 = pool.addInfoIfNecessary(key(1));
+            LastFrameCollisionInfo* info2 = pool.addInfoIfNecessary(key(2));
+            rp3d_test(pool.getNbInfos() == 2);
+            rp3d_test(pool.getNbUsedInfos() == 2);
+            rp3d_test(pool.getInfo(key(1)) == info1);
+            rp3d_test(pool.getInfo(key(2)) == info2);
+            rp3d_test(pool.getInfo(key(3)) == nullptr);
+
+            // An existing info is not added again
+            rp3d_test(pool.addInfoIfNecessary(key(1)) == info1);
+            rp3d_test(pool.getNbInfos() == 2);
+            rp3d_test(pool.getNbUsedInfos() == 2);
+
+            // All the fields of a new info are initialized
+            rp3d_test(!info1->isValid);
+            rp3d_test(!info1->wasColliding);
+            rp3d_test(!info1->wasUsingGJK);
+            rp3d_test(!info1->wasUsingSAT);
+            rp3d_test(!info1->satIsAxisFacePolyhedron1);
+            rp3d_test(!info1->satIsAxisFacePolyhedron2);
+            rp3d_test(info1->satMinAxisFaceIndex == 0);
+            rp3d_test(info1->satMinEdge1Index == 0);
+            rp3d_test(info1->satMinEdge2Index == 0);
+            rp3d_test(info1->gjkNbSimplexPoints == 0);
+            rp3d_test(info1->boxVsBoxAxisIndex == 0);
+        }
+
+        void testObsoleteInfos() {
+
+            LastFrameCollisionInfoPool pool(mAllocator);
+
+            // The infos used in the frame are kept
+            for (uint32 i=0; i < 3; i++) {
+                pool.addInfoIfNecessary(key(i))->satMinAxisFaceIndex = i + 10;
+            }
+            pool.clearObsoleteInfos();
+            rp3d_test(pool.getNbInfos() == 3);
+            rp3d_test(pool.getNbUsedInfos() == 0);
+
+            // The infos that are not used in a frame are removed at the end of the frame
+            rp3d_test(pool.addInfoIfNecessary(key(1))->satMinAxisFaceIndex == 11);
+            pool.clearObsoleteInfos();
+            rp3d_test(pool.getNbInfos() == 1);
+            rp3d_test(pool.getInfo(key(0)) == nullptr);
+            rp3d_test(pool.getInfo(key(2)) == nullptr);
+            rp3d_test(pool.getInfo(key(1)) != nullptr);
+            rp3d_test(pool.getInfo(key(1))->satMinAxisFaceIndex == 11);
+
+            // A removed info is created again if its key is used again
+            LastFrameCollisionInfo* info = pool.addInfoIfNecessary(key(2));
+            rp3d_test(info->satMinAxisFaceIndex == 0);
+            rp3d_test(pool.getNbInfos() == 2);
+
+            // No info is used in the frame
+            pool.clearObsoleteInfos();
+            pool.clearObsoleteInfos();
+            rp3d_test(pool.getNbInfos() == 0);
+            rp3d_test(pool.getInfo(key(1)) == nullptr);
+            rp3d_test(pool.getInfo(key(2)) == nullptr);
+        }
+
+        void testRemapAfterRemoval() {
+
+            LastFrameCollisionInfoPool pool(mAllocator);
+
+            const uint32 nbInfos = 10;
+            for (uint32 i=0; i < nbInfos; i++) {
+                pool.addInfoIfNecessary(key(i))->satMinAxisFaceIndex = i;
+            }
+            pool.clearObsoleteInfos();
+
+            // The infos in the middle of the pool are not used and the others are used in reverse order
+            LastFrameCollisionInfo* usedInfos[nbInfos];
+            for (uint32 i=nbInfos; i > 0; i--) {
+                const uint32 number = i - 1;
+                usedInfos[number] = nullptr;
+                if (number == 3 || number == 4 || number == 6) continue;
+                usedInfos[number] = pool.addInfoIfNecessary(key(number));
+            }
+
+            // The pointers given in the frame are still valid at the end of the frame
+            bool isValid = true;
+            for (uint32 i=0; i < nbInfos; i++) {
+                if (usedInfos[i] == nullptr) continue;
+                isValid &= usedInfos[i]->satMinAxisFaceIndex == i;
+                isValid &= pool.getInfo(key(i)) == usedInfos[i];
+            }
+            rp3d_test(isValid);
+
+            // The remaining infos are found with their keys after the removal
+            pool.clearObsoleteInfos();
+            rp3d_test(pool.getNbInfos() == nbInfos - 3);
+            bool isFound = true;
+            for (uint32 i=0; i < nbInfos; i++) {
+                LastFrameCollisionInfo* info = pool.getInfo(key(i));
+                if (i == 3 || i == 4 || i == 6) {
+                    isFound &= info == nullptr;
+                }
+                else {
+                    isFound &= info != nullptr && info->satMinAxisFaceIndex == i;
+                }
+            }
+            rp3d_test(isFound);
+
+            // New infos are added after the removal
+            for (uint32 i=0; i < nbInfos; i++) {
+                LastFrameCollisionInfo* info = pool.addInfoIfNecessary(key(i));
+                if (i == 3 || i == 4 || i == 6) {
+                    info->satMinAxisFaceIndex = i;
+                }
+            }
+            pool.clearObsoleteInfos();
+            rp3d_test(pool.getNbInfos() == nbInfos);
+            isFound = true;
+            for (uint32 i=0; i < nbInfos; i++) {
+                isFound &= pool.getInfo(key(i))->satMinAxisFaceIndex == i;
+            }
+            rp3d_test(isFound);
+        }
+
+        void testPages() {
+
+            LastFrameCollisionInfoPool pool(mAllocator);
+
+            // More infos than in a page
+            const uint32 nbInfos = 600;
+            for (uint32 i=0; i < nbInfos; i++) {
+                pool.addInfoIfNecessary(key(i))->satMinEdge1Index = i;
+            }
+            rp3d_test(pool.getNbPages() == 3);
+            pool.clearObsoleteInfos();
+            rp3d_test(pool.getNbInfos() == nbInfos);
+
+            // Only every third info is used
+            for (uint32 i=0; i < nbInfos; i += 3) {
+                pool.addInfoIfNecessary(key(i));
+            }
+            pool.clearObsoleteInfos();
+            rp3d_test(pool.getNbInfos() == nbInfos / 3);
+            rp3d_test(pool.getNbPages() == 2);
+
+            bool isFound = true;
+            for (uint32 i=0; i < nbInfos; i++) {
+                LastFrameCollisionInfo* info = pool.getInfo(key(i));
+                isFound &= (i % 3 == 0) ? (info != nullptr && info->satMinEdge1Index == i) : info == nullptr;
+            }
+            rp3d_test(isFound);
+
+            // An empty page is kept when all the infos are removed
+            pool.clearObsoleteInfos();
+            rp3d_test(pool.getNbInfos() == 0);
+            rp3d_test(pool.getNbPages() == 1);
+        }
+};
+
+}
+
+#endif
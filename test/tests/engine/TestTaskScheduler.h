@@ -0,0 +1,440 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_TASK_SCHEDULER_H
+#define TEST_TASK_SCHEDULER_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class ContactPointsCallback
+/**
+ * Collision callback that collects the contact points reported by the testCollision() method
+ */
+class ContactPointsCallback : public CollisionCallback {
+
+    public:
+
+        /// Penetration depths of the reported contact points
+        std::vector<decimal> penetrationDepths;
+
+        /// Called when some contacts are reported
+        virtual void onContact(const CallbackData& callbackData) override {
+
+            for (uint p=0; p < callbackData.getNbContactPairs(); p++) {
+
+                ContactPair contactPair = callbackData.getContactPair(p);
+                for (uint c=0; c < contactPair.getNbContactPoints(); c++) {
+                    penetrationDepths.push_back(contactPair.getContactPoint(c).getPenetrationDepth());
+                }
+            }
+        }
+};
+
+// Class TestTaskScheduler
+/**
+ * Unit test for the task schedulers and the multithreaded simulation
+ */
+class TestTaskScheduler : public Test {
+
+    private :
+
+        // ---------- Methods ---------- //
+
+        /// Create a pile of boxes on a ground and chains of bodies hanging from static anchors in a world
+        void createPile(PhysicsCommon& physicsCommon, PhysicsWorld* world, std::vector<RigidBody*>& bodies,
+                        std::vector<RigidBody*>& staticBodies) {
+
+            BoxShape* groundShape = physicsCommon.createBoxShape(Vector3(50, 1, 50));
+            BoxShape* boxShape = physicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+
+            RigidBody* ground = world->createRigidBody(Transform::identity());
+            ground->setType(BodyType::STATIC);
+            ground->addCollider(groundShape, Transform::identity());
+
+            staticBodies.push_back(ground);
+
+            for (int y=0; y < 3; y++) {
+                for (int x=0; x < 12; x++) {
+                    for (int z=0; z < 12; z++) {
+                        const Vector3 position(decimal(x) * decimal(1.5) - 9, decimal(2 + y * 1.2), decimal(z) * decimal(1.5) - 9);
+                        RigidBody* body = world->createRigidBody(Transform(position, Quaternion::fromEulerAngles(0, decimal(0.1) * x, 0)));
+                        body->addCollider(boxShape, Transform::identity());
+                        bodies.push_back(body);
+                    }
+                }
+            }
+
+            // Chains of bodies connected by the different types of joints and hanging from static anchors
+            for (int c=0; c < 8; c++) {
+
+                const Vector3 anchorPosition(decimal(c) * 3 - 12, 14, 14);
+                RigidBody* previousBody = world->createRigidBody(Transform(anchorPosition, Quaternion::identity()));
+                previousBody->setType(BodyType::STATIC);
+                staticBodies.push_back(previousBody);
+
+                for (int k=1; k <= 4; k++) {
+
+                    const Vector3 position = anchorPosition + Vector3(decimal(1.2) * k, 0, 0);
+                    RigidBody* body = world->createRigidBody(Transform(position, Quaternion::identity()));
+                    body->addCollider(boxShape, Transform::identity());
+                    bodies.push_back(body);
+
+                    const Vector3 anchorPoint = position - Vector3(decimal(0.6), 0, 0);
+                    switch (c % 4) {
+                        case 0: world->createJoint(BallAndSocketJointInfo(previousBody, body, anchorPoint)); break;
+                        case 1: world->createJoint(HingeJointInfo(previousBody, body, anchorPoint, Vector3(0, 0, 1))); break;
+                        case 2: world->createJoint(FixedJointInfo(previousBody, body, anchorPoint)); break;
+                        default: world->createJoint(SliderJointInfo(previousBody, body, anchorPoint, Vector3(1, -1, 0))); break;
+                    }
+
+                    previousBody = body;
+                }
+            }
+        }
+
+        /// Create a world with a pile of boxes falling on a ground and simulate it. The static bodies
+        /// (ground and anchors) are shared by the islands and by the colors solved in parallel and
+        /// areStaticBodiesAtRest tells if their velocities have been left untouched by the solvers.
+        std::vector<Transform> simulatePile(const PhysicsWorld::WorldSettings& settings, uint nbSteps,
+                                            bool* areStaticBodiesAtRest = nullptr) {
+
+            PhysicsCommon physicsCommon;
+            PhysicsWorld* world = physicsCommon.createPhysicsWorld(settings);
+
+            std::vector<RigidBody*> bodies;
+            std::vector<RigidBody*> staticBodies;
+            createPile(physicsCommon, world, bodies, staticBodies);
+
+            for (uint i=0; i < nbSteps; i++) {
+                world->update(decimal(1.0) / decimal(60.0));
+            }
+
+            std::vector<Transform> transforms;
+            for (uint i=0; i < bodies.size(); i++) {
+                transforms.push_back(bodies[i]->getTransform());
+            }
+
+            if (areStaticBodiesAtRest != nullptr) {
+                *areStaticBodiesAtRest = true;
+                for (uint i=0; i < staticBodies.size(); i++) {
+                    *areStaticBodiesAtRest &= staticBodies[i]->getLinearVelocity() == Vector3::zero();
+                    *areStaticBodiesAtRest &= staticBodies[i]->getAngularVelocity() == Vector3::zero();
+                }
+            }
+
+            physicsCommon.destroyPhysicsWorld(world);
+
+            return transforms;
+        }
+
+        /// Create a world with spheres, capsules and boxes falling into each other on a ground, simulate it
+        /// and return the contact points reported by the testCollision() method at the end
+        std::vector<Transform> simulateMixedShapes(const PhysicsWorld::WorldSettings& settings, uint nbSteps,
+                                                   std::vector<decimal>& penetrationDepths) {
+
+            PhysicsCommon physicsCommon;
+            PhysicsWorld* world = physicsCommon.createPhysicsWorld(settings);
+
+            BoxShape* groundShape = physicsCommon.createBoxShape(Vector3(50, 1, 50));
+            SphereShape* sphereShape = physicsCommon.createSphereShape(decimal(0.5));
+            CapsuleShape* capsuleShape = physicsCommon.createCapsuleShape(decimal(0.4), decimal(1.0));
+            BoxShape* boxShape = physicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+
+            RigidBody* ground = world->createRigidBody(Transform::identity());
+            ground->setType(BodyType::STATIC);
+            ground->addCollider(groundShape, Transform::identity());
+
+            std::vector<RigidBody*> bodies;
+            for (int y=0; y < 4; y++) {
+                for (int x=0; x < 10; x++) {
+                    for (int z=0; z < 10; z++) {
+                        const Vector3 position(decimal(x) * decimal(1.1) - 6, decimal(2 + y * 1.3), decimal(z) * decimal(1.1) - 6);
+                        RigidBody* body = world->createRigidBody(Transform(position, Quaternion::fromEulerAngles(decimal(0.3) * z, 0, decimal(0.2) * x)));
+                        switch ((x + y + z) % 3) {
+                            case 0: body->addCollider(sphereShape, Transform::identity()); break;
+                            case 1: body->addCollider(capsuleShape, Transform::identity()); break;
+                            default: body->addCollider(boxShape, Transform::identity()); break;
+                        }
+                        bodies.push_back(body);
+                    }
+                }
+            }
+
+            for (uint i=0; i < nbSteps; i++) {
+                world->update(decimal(1.0) / decimal(60.0));
+            }
+
+            ContactPointsCallback callback;
+            world->testCollision(callback);
+            penetrationDepths = callback.penetrationDepths;
+
+            std::vector<Transform> transforms;
+            for (uint i=0; i < bodies.size(); i++) {
+                transforms.push_back(bodies[i]->getTransform());
+            }
+
+            physicsCommon.destroyPhysicsWorld(world);
+
+            return transforms;
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestTaskScheduler(const std::string& name): Test(name) {
+
+        }
+
+        /// Run the tests
+        void run() {
+
+            testRunTasks();
+            testParallelFor();
+            testNestedTasks();
+            testDeterministicSimulation();
+            testGraphColoringSimulation();
+            testSweepAndPruneSimulation();
+            testNarrowPhaseSimulation();
+            testConcurrentWorlds();
+        }
+
+        void testRunTasks() {
+
+            for (uint32 nbThreads = 1; nbThreads <= 4; nbThreads++) {
+
+                DefaultTaskScheduler scheduler(nbThreads);
+                rp3d_test(scheduler.getNbThreads() == nbThreads);
+
+                // Run the jobs several times to reuse the worker threads
+                for (uint32 job=0; job < 20; job++) {
+
+                    const uint32 nbTasks = 1 + job * 37;
+                    std::vector<std::atomic<uint32>> nbExecutions(nbTasks);
+                    for (uint32 i=0; i < nbTasks; i++) nbExecutions[i] = 0;
+                    std::atomic<bool> isThreadIndexValid(true);
+
+                    scheduler.runTasks(nbTasks, [&](uint32 taskIndex, uint32 threadIndex) {
+                        nbExecutions[taskIndex]++;
+                        if (threadIndex >= nbThreads) isThreadIndexValid = false;
+                    });
+
+                    bool isEachTaskExecutedOnce = true;
+                    for (uint32 i=0; i < nbTasks; i++) {
+                        isEachTaskExecutedOnce &= nbExecutions[i] == 1;
+                    }
+
+                    rp3d_test(isEachTaskExecutedOnce);
+                    rp3d_test(isThreadIndexValid);
+                }
+            }
+
+            DefaultTaskScheduler hardwareScheduler(0);
+            rp3d_test(hardwareScheduler.getNbThreads() >= 1);
+        }
+
+        void testParallelFor() {
+
+            DefaultTaskScheduler scheduler(4);
+
+            const uint32 nbItems = 10000;
+            std::vector<uint32> values(nbItems, 0);
+
+            scheduler.parallelFor(10, nbItems, 64, [&](uint32 start, uint32 end, uint32 /*threadIndex*/) {
+                for (uint32 i=start; i < end; i++) {
+                    values[i] += i;
+                }
+            });
+
+            bool isValid = true;
+            for (uint32 i=0; i < nbItems; i++) {
+                isValid &= values[i] == (i < 10 ? 0 : i);
+            }
+            rp3d_test(isValid);
+
+            // An empty range must not call the task
+            bool isCalled = false;
+            scheduler.parallelFor(5, 5, 64, [&](uint32, uint32, uint32) { isCalled = true; });
+            rp3d_test(!isCalled);
+        }
+
+        void testNestedTasks() {
+
+            DefaultTaskScheduler scheduler(3);
+
+            std::atomic<uint32> nbInnerTasks(0);
+
+            scheduler.runTasks(8, [&](uint32 /*taskIndex*/, uint32 /*threadIndex*/) {
+                scheduler.runTasks(5, [&](uint32, uint32) { nbInnerTasks++; });
+            });
+
+            rp3d_test(nbInnerTasks == 40);
+        }
+
+        void testDeterministicSimulation() {
+
+            PhysicsWorld::WorldSettings settings;
+            settings.nbThreads = 1;
+            std::vector<Transform> singleThreadTransforms = simulatePile(settings, 60);
+
+            settings.nbThreads = 4;
+            std::vector<Transform> multiThreadTransforms = simulatePile(settings, 60);
+
+            DefaultTaskScheduler customScheduler(3);
+            settings.taskScheduler = &customScheduler;
+            std::vector<Transform> customSchedulerTransforms = simulatePile(settings, 60);
+
+            rp3d_test(singleThreadTransforms.size() == multiThreadTransforms.size());
+
+            bool isSame = true;
+            for (uint i=0; i < singleThreadTransforms.size(); i++) {
+                isSame &= singleThreadTransforms[i] == multiThreadTransforms[i];
+                isSame &= singleThreadTransforms[i] == customSchedulerTransforms[i];
+            }
+            rp3d_test(isSame);
+        }
+
+        void testGraphColoringSimulation() {
+
+            // Solve all the islands with the graph coloring
+            PhysicsWorld::WorldSettings settings;
+            settings.minNbConstraintsGraphColoring = 1;
+            settings.nbThreads = 1;
+            std::vector<Transform> singleThreadTransforms = simulatePile(settings, 60);
+
+            settings.nbThreads = 4;
+            bool areStaticBodiesAtRest = false;
+            std::vector<Transform> multiThreadTransforms = simulatePile(settings, 60, &areStaticBodiesAtRest);
+
+            rp3d_test(singleThreadTransforms.size() == multiThreadTransforms.size());
+            rp3d_test(areStaticBodiesAtRest);
+
+            bool isSame = true;
+            bool isValid = true;
+            for (uint i=0; i < singleThreadTransforms.size(); i++) {
+                isSame &= singleThreadTransforms[i] == multiThreadTransforms[i];
+                isValid &= singleThreadTransforms[i].isValid();
+            }
+            rp3d_test(isSame);
+            rp3d_test(isValid);
+        }
+
+        void testSweepAndPruneSimulation() {
+
+            // The overlapping pairs of the sweep-and-prune are computed by ranges of sorted colliders
+            PhysicsWorld::WorldSettings settings;
+            settings.broadPhaseType = BroadPhaseType::SWEEP_AND_PRUNE;
+            settings.nbThreads = 1;
+            std::vector<Transform> singleThreadTransforms = simulatePile(settings, 60);
+
+            settings.nbThreads = 4;
+            std::vector<Transform> multiThreadTransforms = simulatePile(settings, 60);
+
+            rp3d_test(singleThreadTransforms.size() == multiThreadTransforms.size());
+
+            bool isSame = true;
+            for (uint i=0; i < singleThreadTransforms.size(); i++) {
+                isSame &= singleThreadTransforms[i] == multiThreadTransforms[i];
+            }
+            rp3d_test(isSame);
+        }
+
+        void testNarrowPhaseSimulation() {
+
+            // The pairs of each narrow-phase batch are tested by ranges in different tasks
+            PhysicsWorld::WorldSettings settings;
+            settings.nbThreads = 1;
+            std::vector<decimal> singleThreadDepths;
+            std::vector<Transform> singleThreadTransforms = simulateMixedShapes(settings, 90, singleThreadDepths);
+
+            settings.nbThreads = 4;
+            std::vector<decimal> multiThreadDepths;
+            std::vector<Transform> multiThreadTransforms = simulateMixedShapes(settings, 90, multiThreadDepths);
+
+            rp3d_test(singleThreadTransforms.size() == multiThreadTransforms.size());
+
+            bool isSame = true;
+            for (uint i=0; i < singleThreadTransforms.size(); i++) {
+                isSame &= singleThreadTransforms[i] == multiThreadTransforms[i];
+            }
+            rp3d_test(isSame);
+
+            // The contact points of the testCollision() method are reported in the same order
+            rp3d_test(singleThreadDepths.size() > 0);
+            rp3d_test(singleThreadDepths == multiThreadDepths);
+        }
+
+        void testConcurrentWorlds() {
+
+            PhysicsWorld::WorldSettings settings;
+            settings.nbThreads = 2;
+            std::vector<Transform> referenceTransforms = simulatePile(settings, 60);
+
+            // Two worlds of the same PhysicsCommon are updated at the same time by different threads
+            PhysicsCommon physicsCommon;
+            PhysicsWorld* worlds[2];
+            std::vector<RigidBody*> bodies[2];
+            for (uint w=0; w < 2; w++) {
+                worlds[w] = physicsCommon.createPhysicsWorld(settings);
+                std::vector<RigidBody*> staticBodies;
+                createPile(physicsCommon, worlds[w], bodies[w], staticBodies);
+            }
+
+            auto simulate = [](PhysicsWorld* world) {
+                for (uint i=0; i < 60; i++) {
+                    world->update(decimal(1.0) / decimal(60.0));
+                }
+            };
+
+            std::thread thread(simulate, worlds[1]);
+            simulate(worlds[0]);
+            thread.join();
+
+            bool isSame = true;
+            for (uint w=0; w < 2; w++) {
+                rp3d_test(bodies[w].size() == referenceTransforms.size());
+                for (uint i=0; i < bodies[w].size(); i++) {
+                    isSame &= bodies[w][i]->getTransform() == referenceTransforms[i];
+                }
+            }
+            rp3d_test(isSame);
+
+            physicsCommon.destroyPhysicsWorld(worlds[0]);
+            physicsCommon.destroyPhysicsWorld(worlds[1]);
+        }
+ };
+
+}
+
+#endif
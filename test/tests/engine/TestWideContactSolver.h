@@ -0,0 +1,225 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_WIDE_CONTACT_SOLVER_H
+#define TEST_WIDE_CONTACT_SOLVER_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <reactphysics3d/mathematics/SimdMatrix3x3.h>
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestWideContactSolver
+/**
+ * Unit test for the SIMD types and the wide contact solver
+ */
+class TestWideContactSolver : public Test {
+
+    private :
+
+        // ---------- Methods ---------- //
+
+        /// Simulate boxes falling on a ground. The boxes are stacked in columns of the given height.
+        std::vector<Transform> simulateBoxes(const PhysicsWorld::WorldSettings& settings, int columnHeight, uint nbSteps) {
+
+            PhysicsCommon physicsCommon;
+            PhysicsWorld* world = physicsCommon.createPhysicsWorld(settings);
+
+            BoxShape* groundShape = physicsCommon.createBoxShape(Vector3(50, 1, 50));
+            BoxShape* boxShape = physicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            SphereShape* sphereShape = physicsCommon.createSphereShape(decimal(0.5));
+
+            RigidBody* ground = world->createRigidBody(Transform::identity());
+            ground->setType(BodyType::STATIC);
+            ground->addCollider(groundShape, Transform::identity());
+
+            std::vector<RigidBody*> bodies;
+            for (int x=0; x < 6; x++) {
+                for (int z=0; z < 6; z++) {
+                    for (int y=0; y < columnHeight; y++) {
+                        const Vector3 position(decimal(x) * 3 - 9, decimal(1.6 + y * 1.05), decimal(z) * 3 - 9);
+                        RigidBody* body = world->createRigidBody(Transform(position, Quaternion::fromEulerAngles(0, decimal(0.1) * z, 0)));
+                        Collider* collider = body->addCollider((x + z + y) % 3 == 0 ? static_cast<CollisionShape*>(sphereShape) : boxShape,
+                                                               Transform::identity());
+                        if (x % 2 == 0) collider->getMaterial().setRollingResistance(decimal(0.1));
+                        body->setLinearVelocity(Vector3(decimal(0.1) * (x - 3), 0, decimal(0.05) * z));
+                        bodies.push_back(body);
+                    }
+                }
+            }
+
+            for (uint i=0; i < nbSteps; i++) {
+                world->update(decimal(1.0) / decimal(60.0));
+            }
+
+            std::vector<Transform> transforms;
+            for (uint i=0; i < bodies.size(); i++) {
+                transforms.push_back(bodies[i]->getTransform());
+            }
+
+            physicsCommon.destroyPhysicsWorld(world);
+
+            return transforms;
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestWideContactSolver(const std::string& name): Test(name) {
+
+        }
+
+        /// Run the tests
+        void run() {
+
+            testSimdDecimal();
+            testSimdVector3();
+            testIndependentBodies();
+            testStacks();
+        }
+
+        void testSimdDecimal() {
+
+            decimal values1[SIMD_DECIMAL_NB_LANES];
+            decimal values2[SIMD_DECIMAL_NB_LANES];
+            for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) {
+                values1[i] = decimal(i) - decimal(1.5);
+                values2[i] = decimal(2.0) - decimal(i) * decimal(0.5);
+            }
+
+            const SimdDecimal a = SimdDecimal::load(values1);
+            const SimdDecimal b = SimdDecimal::load(values2);
+
+            decimal sum[SIMD_DECIMAL_NB_LANES], difference[SIMD_DECIMAL_NB_LANES], product[SIMD_DECIMAL_NB_LANES];
+            decimal minimum[SIMD_DECIMAL_NB_LANES], maximum[SIMD_DECIMAL_NB_LANES], selected[SIMD_DECIMAL_NB_LANES];
+            decimal squareRoot[SIMD_DECIMAL_NB_LANES], negative[SIMD_DECIMAL_NB_LANES];
+            (a + b).store(sum);
+            (a - b).store(difference);
+            (a * b).store(product);
+            SimdDecimal::min(a, b).store(minimum);
+            SimdDecimal::max(a, b).store(maximum);
+            SimdDecimal::selectGreater(a, b, SimdDecimal(1), SimdDecimal(2)).store(selected);
+            SimdDecimal::sqrt(a * a).store(squareRoot);
+            (-a).store(negative);
+
+            bool isValid = true;
+            for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) {
+                isValid &= approxEqual(sum[i], values1[i] + values2[i]);
+                isValid &= approxEqual(difference[i], values1[i] - values2[i]);
+                isValid &= approxEqual(product[i], values1[i] * values2[i]);
+                isValid &= minimum[i] == std::min(values1[i], values2[i]);
+                isValid &= maximum[i] == std::max(values1[i], values2[i]);
+                isValid &= selected[i] == (values1[i] > values2[i] ? 1 : 2);
+                isValid &= approxEqual(squareRoot[i], std::abs(values1[i]));
+                isValid &= negative[i] == -values1[i];
+            }
+            rp3d_test(isValid);
+        }
+
+        void testSimdVector3() {
+
+            Vector3Lanes vectorsLanes;
+            Matrix3x3Lanes matricesLanes;
+            for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) {
+                vectorsLanes.setLane(i, Vector3(decimal(i), 2, -decimal(i) * 3));
+                matricesLanes.setLane(i, Matrix3x3(1, decimal(i), 0, 2, 1, 3, -decimal(i), 0, 4));
+            }
+
+            const SimdVector3 vectors = SimdVector3::load(vectorsLanes);
+            const SimdMatrix3x3 matrices = SimdMatrix3x3::load(matricesLanes);
+
+            Vector3Lanes productLanes;
+            (matrices * vectors).store(productLanes);
+            decimal dot[SIMD_DECIMAL_NB_LANES];
+            vectors.dot(vectors + vectors).store(dot);
+
+            bool isValid = true;
+            for (uint32 i=0; i < SIMD_DECIMAL_NB_LANES; i++) {
+                const Vector3 vector(decimal(i), 2, -decimal(i) * 3);
+                const Matrix3x3 matrix(1, decimal(i), 0, 2, 1, 3, -decimal(i), 0, 4);
+                isValid &= vectorsLanes.getLane(i) == vector;
+                isValid &= approxEqual(productLanes.getLane(i), matrix * vector);
+                isValid &= approxEqual(dot[i], vector.dot(vector + vector));
+            }
+            rp3d_test(isValid);
+        }
+
+        void testIndependentBodies() {
+
+            // Each body is alone in its island and the scalar and wide solvers perform the same operations
+            PhysicsWorld::WorldSettings settings;
+            settings.isWideContactSolverEnabled = false;
+            std::vector<Transform> scalarTransforms = simulateBoxes(settings, 1, 60);
+
+            settings.isWideContactSolverEnabled = true;
+            std::vector<Transform> wideTransforms = simulateBoxes(settings, 1, 60);
+
+            rp3d_test(scalarTransforms.size() == wideTransforms.size());
+
+            bool isClose = true;
+            for (uint i=0; i < scalarTransforms.size(); i++) {
+                isClose &= approxEqual(scalarTransforms[i].getPosition(), wideTransforms[i].getPosition(), decimal(0.0001));
+                isClose &= approxEqual(scalarTransforms[i].getOrientation().getVectorV(), wideTransforms[i].getOrientation().getVectorV(), decimal(0.0001));
+            }
+            rp3d_test(isClose);
+        }
+
+        void testStacks() {
+
+            // The contact manifolds of the stacks are solved in a different order by the wide solver
+            PhysicsWorld::WorldSettings settings;
+            settings.isWideContactSolverEnabled = true;
+            settings.nbThreads = 1;
+            std::vector<Transform> singleThreadTransforms = simulateBoxes(settings, 4, 120);
+
+            settings.nbThreads = 4;
+            std::vector<Transform> multiThreadTransforms = simulateBoxes(settings, 4, 120);
+
+            // Solve the stacks with the graph coloring
+            settings.minNbConstraintsGraphColoring = 1;
+            std::vector<Transform> coloredTransforms = simulateBoxes(settings, 4, 120);
+
+            bool isSame = true;
+            bool isResting = true;
+            for (uint i=0; i < singleThreadTransforms.size(); i++) {
+                isSame &= singleThreadTransforms[i] == multiThreadTransforms[i];
+                isResting &= singleThreadTransforms[i].isValid() && coloredTransforms[i].isValid();
+                isResting &= singleThreadTransforms[i].getPosition().y > decimal(0.9);
+                isResting &= coloredTransforms[i].getPosition().y > decimal(0.9);
+            }
+            rp3d_test(isSame);
+            rp3d_test(isResting);
+        }
+ };
+
+}
+
+#endif
@@ -0,0 +1,271 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_MEMORY_MANAGER_H
+#define TEST_MEMORY_MANAGER_H
+
+// Libraries
+#include "Test.h"
+#include <reactphysics3d/memory/MemoryManager.h>
+#include <reactphysics3d/memory/HeapAllocator.h>
+#include <reactphysics3d/engine/DefaultTaskScheduler.h>
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class CountingAllocator
+/**
+ * Base allocator that counts the number of allocations that have been requested
+ */
+class CountingAllocator : public DefaultAllocator {
+
+    public :
+
+        /// Number of calls to allocate()
+        uint32 mNbAllocations = 0;
+
+        /// Allocate memory of a given size (in bytes) and return a pointer to the allocated memory
+        virtual void* allocate(size_t size) override {
+            mNbAllocations++;
+            return DefaultAllocator::allocate(size);
+        }
+};
+
+// Class TestMemoryManager
+/**
+ * Unit test for the allocators of the memory manager
+ */
+class TestMemoryManager : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        /// Base allocator
+        DefaultAllocator mBaseAllocator;
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestMemoryManager(const std::string& name) : Test(name) {
+
+        }
+
+        /// Run the tests
+        void run() {
+
+            testHeapAllocator();
+            testPoolAllocatorCache();
+            testThreadAllocators();
+        }
+
+        /// Test the allocation, the release and the merge of the free memory units of the heap allocator
+        void testHeapAllocator() {
+
+            const size_t initSize = 64 * 1024;
+            CountingAllocator baseAllocator;
+            HeapAllocator heapAllocator(baseAllocator, initSize);
+            rp3d_test(baseAllocator.mNbAllocations == 1);
+
+            // Allocate blocks of different sizes and fill them with their index
+            const uint32 nbBlocks = 200;
+            std::vector<uint8*> blocks;
+            for (uint32 i=0; i < nbBlocks; i++) {
+                const size_t size = 16 + (i % 5) * 8;
+                uint8* block = static_cast<uint8*>(heapAllocator.allocate(size));
+                for (size_t k=0; k < size; k++) block[k] = static_cast<uint8>(i);
+                blocks.push_back(block);
+            }
+            rp3d_test(baseAllocator.mNbAllocations == 1);
+            uint8* firstBlock = blocks[0];
+
+            // Release every other block. The released blocks cannot be merged together
+            for (uint32 i=0; i < nbBlocks; i += 2) {
+                heapAllocator.release(blocks[i], 16 + (i % 5) * 8);
+            }
+
+            // The new blocks reuse the free memory units and do not overlap with the remaining blocks
+            for (uint32 i=0; i < nbBlocks; i += 2) {
+                const size_t size = 16 + (i % 5) * 8;
+                blocks[i] = static_cast<uint8*>(heapAllocator.allocate(size));
+                for (size_t k=0; k < size; k++) blocks[i][k] = static_cast<uint8>(i);
+            }
+            rp3d_test(baseAllocator.mNbAllocations == 1);
+
+            bool areValid = true;
+            for (uint32 i=0; i < nbBlocks; i++) {
+                for (size_t k=0; k < 16 + (i % 5) * 8; k++) {
+                    if (blocks[i][k] != static_cast<uint8>(i)) areValid = false;
+                }
+            }
+            rp3d_test(areValid);
+
+            // Release all the blocks in an order where a block is merged with its previous
+            // and next free units
+            for (uint32 i=1; i < nbBlocks; i += 2) {
+                heapAllocator.release(blocks[i], 16 + (i % 5) * 8);
+            }
+            for (uint32 i=0; i < nbBlocks; i += 2) {
+                heapAllocator.release(blocks[i], 16 + (i % 5) * 8);
+            }
+
+            // All the units have been merged back into a single free unit that can hold the initial size
+            void* largeBlock = heapAllocator.allocate(initSize);
+            rp3d_test(largeBlock == firstBlock);
+            rp3d_test(baseAllocator.mNbAllocations == 1);
+
+            // A larger allocation needs more memory from the base allocator
+            void* extraBlock = heapAllocator.allocate(initSize);
+            rp3d_test(extraBlock != nullptr);
+            rp3d_test(baseAllocator.mNbAllocations == 2);
+
+            heapAllocator.release(largeBlock, initSize);
+            heapAllocator.release(extraBlock, initSize);
+        }
+
+        /// Test the cache of the pool allocator
+        void testPoolAllocatorCache() {
+
+            MemoryManager memoryManager(&mBaseAllocator);
+            PoolAllocatorCache& cache = memoryManager.getThreadPoolAllocator(0);
+            PoolAllocator& pool = memoryManager.getPoolAllocator();
+
+            // Allocate more units than the size of a magazine and write into them
+            std::vector<int*> pointers;
+            for (int i=0; i < 100; i++) {
+                int* p = static_cast<int*>(cache.allocate(sizeof(int) * 4));
+                for (int k=0; k < 4; k++) p[k] = i;
+                pointers.push_back(p);
+            }
+
+            // All the units must be different
+            bool areDistinct = true;
+            for (size_t i=0; i < pointers.size(); i++) {
+                for (size_t j=i+1; j < pointers.size(); j++) {
+                    if (pointers[i] == pointers[j]) areDistinct = false;
+                }
+            }
+            rp3d_test(areDistinct);
+
+            bool areValid = true;
+            for (size_t i=0; i < pointers.size(); i++) {
+                for (int k=0; k < 4; k++) {
+                    if (pointers[i][k] != int(i)) areValid = false;
+                }
+            }
+            rp3d_test(areValid);
+
+            // Release half of the units with the cache and the other half with the pool
+            for (size_t i=0; i < pointers.size(); i++) {
+                if (i % 2 == 0) cache.release(pointers[i], sizeof(int) * 4);
+                else pool.release(pointers[i], sizeof(int) * 4);
+            }
+
+            // A unit released into the cache is reused by the next allocation of the same size
+            void* p1 = cache.allocate(sizeof(int) * 4);
+            cache.release(p1, sizeof(int) * 4);
+            void* p2 = cache.allocate(sizeof(int) * 4);
+            rp3d_test(p1 == p2);
+            cache.release(p2, sizeof(int) * 4);
+
+            // Large allocations are forwarded to the pool allocator
+            void* large = cache.allocate(4096);
+            rp3d_test(large != nullptr);
+            cache.release(large, 4096);
+
+            cache.flush();
+        }
+
+        /// Test the allocators of the threads used by the task scheduler
+        void testThreadAllocators() {
+
+            const uint32 nbThreads = 4;
+            MemoryManager memoryManager(&mBaseAllocator);
+            rp3d_test(memoryManager.getNbThreadAllocators() == 1);
+
+            SingleFrameAllocator& mainFrameAllocator = memoryManager.getSingleFrameAllocator();
+            memoryManager.reserveThreadAllocators(nbThreads);
+            rp3d_test(memoryManager.getNbThreadAllocators() == nbThreads);
+            rp3d_test(&memoryManager.getThreadFrameAllocator(0) == &mainFrameAllocator);
+
+            // Reserving less threads does not change anything
+            memoryManager.reserveThreadAllocators(2);
+            rp3d_test(memoryManager.getNbThreadAllocators() == nbThreads);
+
+            DefaultTaskScheduler scheduler(nbThreads);
+            const uint32 nbTasks = 64;
+            const uint32 nbAllocations = 200;
+            std::vector<uint32> nbErrors(nbTasks, 0);
+
+            for (int frame=0; frame < 3; frame++) {
+
+                scheduler.runTasks(nbTasks, [&](uint32 taskIndex, uint32 threadIndex) {
+
+                    SingleFrameAllocator& frameAllocator = memoryManager.getThreadFrameAllocator(threadIndex);
+                    PoolAllocatorCache& poolAllocator = memoryManager.getThreadPoolAllocator(threadIndex);
+
+                    // Fill frame and pool memory with the index of the task
+                    std::vector<uint32*> framePointers;
+                    std::vector<uint32*> poolPointers;
+                    for (uint32 i=0; i < nbAllocations; i++) {
+                        const size_t size = (1 + (i % 7)) * sizeof(uint32);
+                        uint32* framePointer = static_cast<uint32*>(frameAllocator.allocate(size));
+                        uint32* poolPointer = static_cast<uint32*>(poolAllocator.allocate(size));
+                        for (size_t k=0; k < size / sizeof(uint32); k++) {
+                            framePointer[k] = taskIndex;
+                            poolPointer[k] = taskIndex;
+                        }
+                        framePointers.push_back(framePointer);
+                        poolPointers.push_back(poolPointer);
+                    }
+
+                    // Check that no other thread has written into this memory
+                    for (uint32 i=0; i < nbAllocations; i++) {
+                        const size_t size = (1 + (i % 7)) * sizeof(uint32);
+                        for (size_t k=0; k < size / sizeof(uint32); k++) {
+                            if (framePointers[i][k] != taskIndex || poolPointers[i][k] != taskIndex) {
+                                nbErrors[taskIndex]++;
+                            }
+                        }
+                        frameAllocator.release(framePointers[i], size);
+                        poolAllocator.release(poolPointers[i], size);
+                    }
+                });
+
+                memoryManager.resetFrameAllocator();
+            }
+
+            uint32 totalNbErrors = 0;
+            for (uint32 i=0; i < nbTasks; i++) totalNbErrors += nbErrors[i];
+            rp3d_test(totalNbErrors == 0);
+        }
+};
+
+}
+
+#endif
@@ -0,0 +1,275 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2020 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/reactphysics3d.h>
+#include <reactphysics3d/memory/DefaultAllocator.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace reactphysics3d;
+
+// Vertices and polygon faces read from a Wavefront OBJ file
+struct ObjMesh {
+
+    /// Three coordinates of each vertex
+    std::vector<float> vertices;
+
+    /// Vertex indices of all the faces
+    std::vector<uint32> indices;
+
+    /// Faces (number of vertices and index of the first vertex in the indices)
+    std::vector<PolygonVertexArray::PolygonFace> faces;
+};
+
+// Print how to use the tool
+static void printUsage() {
+
+    std::cout << "Usage: rp3d_cook <type> <arguments>" << std::endl << std::endl;
+    std::cout << "  rp3d_cook triangle-mesh <input.obj> <output>" << std::endl;
+    std::cout << "      Cook a triangle mesh (with its AABB tree) for a ConcaveMeshShape" << std::endl;
+    std::cout << "  rp3d_cook polyhedron-mesh <input.obj> <output>" << std::endl;
+    std::cout << "      Cook a closed convex polyhedron mesh (with its half-edge structure) for a ConvexMeshShape" << std::endl;
+    std::cout << "  rp3d_cook height-field <nbColumns> <nbRows> <upAxis> <input.raw> <output>" << std::endl;
+    std::cout << "      Cook a height field from a file with (nbColumns * nbRows) 32 bits float heights" << std::endl;
+}
+
+// Read the vertices and faces of a Wavefront OBJ file (the other elements are ignored)
+static bool readObjFile(const std::string& filePath, ObjMesh& outMesh) {
+
+    std::ifstream file(filePath);
+    if (!file.is_open()) {
+        std::cerr << "Error: cannot open the file " << filePath << std::endl;
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+
+        std::istringstream lineStream(line);
+        std::string element;
+        lineStream >> element;
+
+        if (element == "v") {
+
+            float x, y, z;
+            lineStream >> x >> y >> z;
+            outMesh.vertices.push_back(x);
+            outMesh.vertices.push_back(y);
+            outMesh.vertices.push_back(z);
+        }
+        else if (element == "f") {
+
+            PolygonVertexArray::PolygonFace face;
+            face.nbVertices = 0;
+            face.indexBase = static_cast<uint>(outMesh.indices.size());
+
+            // A vertex of a face is "v", "v/vt", "v//vn" or "v/vt/vn" where v is a one-based (or negative) index
+            std::string faceVertex;
+            while (lineStream >> faceVertex) {
+
+                long index = std::stol(faceVertex.substr(0, faceVertex.find('/')));
+                const long nbVertices = static_cast<long>(outMesh.vertices.size() / 3);
+                index = index < 0 ? nbVertices + index : index - 1;
+                if (index < 0 || index >= nbVertices) {
+                    std::cerr << "Error: invalid vertex index in the face \"" << line << "\"" << std::endl;
+                    return false;
+                }
+
+                outMesh.indices.push_back(static_cast<uint32>(index));
+                face.nbVertices++;
+            }
+
+            if (face.nbVertices < 3) {
+                std::cerr << "Error: the face \"" << line << "\" has less than three vertices" << std::endl;
+                return false;
+            }
+
+            outMesh.faces.push_back(face);
+        }
+    }
+
+    if (outMesh.vertices.empty() || outMesh.faces.empty()) {
+        std::cerr << "Error: the file " << filePath << " does not contain any face" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+// Write the cooked data into a file
+static bool writeCookedData(const List<uint8>& data, const std::string& filePath) {
+
+    std::ofstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Error: cannot create the file " << filePath << std::endl;
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&(data[0])), data.size());
+    if (!file.good()) {
+        std::cerr << "Error: cannot write the file " << filePath << std::endl;
+        return false;
+    }
+
+    std::cout << "Cooked data written into " << filePath << " (" << data.size() << " bytes)" << std::endl;
+
+    return true;
+}
+
+// Cook a triangle mesh from an OBJ file (the polygon faces are triangulated)
+static bool cookTriangleMesh(PhysicsCommon& physicsCommon, MemoryAllocator& allocator, const std::string& inputPath, List<uint8>& outData) {
+
+    ObjMesh objMesh;
+    if (!readObjFile(inputPath, objMesh)) return false;
+
+    // Triangulate the faces with triangle fans
+    std::vector<uint32> trianglesIndices;
+    for (const PolygonVertexArray::PolygonFace& face : objMesh.faces) {
+        for (uint v=2; v < face.nbVertices; v++) {
+            trianglesIndices.push_back(objMesh.indices[face.indexBase]);
+            trianglesIndices.push_back(objMesh.indices[face.indexBase + v - 1]);
+            trianglesIndices.push_back(objMesh.indices[face.indexBase + v]);
+        }
+    }
+
+    TriangleVertexArray triangleArray(static_cast<uint>(objMesh.vertices.size() / 3), objMesh.vertices.data(), 3 * sizeof(float),
+                                      static_cast<uint>(trianglesIndices.size() / 3), trianglesIndices.data(), 3 * sizeof(uint32),
+                                      TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                      TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+
+    TriangleMesh* triangleMesh = physicsCommon.createTriangleMesh();
+    triangleMesh->addSubpart(&triangleArray);
+
+    const bool isCooked = MeshCooker::cookTriangleMesh(*triangleMesh, allocator, outData);
+
+    physicsCommon.destroyTriangleMesh(triangleMesh);
+
+    return isCooked;
+}
+
+// Cook a convex polyhedron mesh from an OBJ file
+static bool cookPolyhedronMesh(PhysicsCommon& physicsCommon, const std::string& inputPath, List<uint8>& outData) {
+
+    ObjMesh objMesh;
+    if (!readObjFile(inputPath, objMesh)) return false;
+
+    PolygonVertexArray polygonArray(static_cast<uint>(objMesh.vertices.size() / 3), objMesh.vertices.data(), 3 * sizeof(float),
+                                    objMesh.indices.data(), sizeof(uint32), static_cast<uint>(objMesh.faces.size()), objMesh.faces.data(),
+                                    PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                    PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+
+    PolyhedronMesh* polyhedronMesh = physicsCommon.createPolyhedronMesh(&polygonArray);
+
+    const bool isCooked = MeshCooker::cookPolyhedronMesh(*polyhedronMesh, outData);
+
+    physicsCommon.destroyPolyhedronMesh(polyhedronMesh);
+
+    return isCooked;
+}
+
+// Cook a height field from a file with 32 bits float heights
+static bool cookHeightField(PhysicsCommon& physicsCommon, int nbColumns, int nbRows, int upAxis,
+                            const std::string& inputPath, List<uint8>& outData) {
+
+    if (nbColumns < 2 || nbRows < 2 || upAxis < 0 || upAxis > 2) {
+        std::cerr << "Error: the height field needs at least two columns and two rows and the up axis must be 0, 1 or 2" << std::endl;
+        return false;
+    }
+
+    std::ifstream file(inputPath, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Error: cannot open the file " << inputPath << std::endl;
+        return false;
+    }
+
+    std::vector<float> heights(static_cast<size_t>(nbColumns) * static_cast<size_t>(nbRows));
+    file.read(reinterpret_cast<char*>(heights.data()), heights.size() * sizeof(float));
+    if (file.gcount() != static_cast<std::streamsize>(heights.size() * sizeof(float))) {
+        std::cerr << "Error: the file " << inputPath << " does not contain " << heights.size() << " heights" << std::endl;
+        return false;
+    }
+
+    float minHeight = heights[0];
+    float maxHeight = heights[0];
+    for (float height : heights) {
+        minHeight = std::min(minHeight, height);
+        maxHeight = std::max(maxHeight, height);
+    }
+
+    HeightFieldShape* heightField = physicsCommon.createHeightFieldShape(nbColumns, nbRows, minHeight, maxHeight, heights.data(),
+                                                                         HeightFieldShape::HeightDataType::HEIGHT_FLOAT_TYPE, upAxis);
+
+    const bool isCooked = MeshCooker::cookHeightField(*heightField, outData);
+
+    physicsCommon.destroyHeightFieldShape(heightField);
+
+    return isCooked;
+}
+
+// Offline tool that cooks the collision meshes into files that can be loaded with
+// the PhysicsCommon::createXXXFromCookedData() methods
+int main(int argc, char** argv) {
+
+    if (argc < 2) {
+        printUsage();
+        return 1;
+    }
+
+    const std::string type = argv[1];
+
+    PhysicsCommon physicsCommon;
+    DefaultAllocator allocator;
+    List<uint8> cookedData(allocator);
+
+    bool isCooked = false;
+    std::string outputPath;
+
+    if ((type == "triangle-mesh" || type == "polyhedron-mesh") && argc == 4) {
+
+        outputPath = argv[3];
+        isCooked = type == "triangle-mesh" ? cookTriangleMesh(physicsCommon, allocator, argv[2], cookedData) :
+                                             cookPolyhedronMesh(physicsCommon, argv[2], cookedData);
+    }
+    else if (type == "height-field" && argc == 7) {
+
+        outputPath = argv[6];
+        isCooked = cookHeightField(physicsCommon, std::atoi(argv[2]), std::atoi(argv[3]), std::atoi(argv[4]), argv[5], cookedData);
+    }
+    else {
+        printUsage();
+        return 1;
+    }
+
+    if (!isCooked) {
+        std::cerr << "Error: the mesh cannot be cooked" << std::endl;
+        return 1;
+    }
+
+    return writeCookedData(cookedData, outputPath) ? 0 : 1;
+}